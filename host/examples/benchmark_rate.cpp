@@ -17,8 +17,13 @@
 #include <chrono>
 #include <complex>
 #include <cstdlib>
+#include <ctime>
+#include <fstream>
 #include <iostream>
+#include <mutex>
+#include <sstream>
 #include <thread>
+#include <vector>
 
 namespace po = boost::program_options;
 using namespace std::chrono_literals;
@@ -64,6 +69,192 @@ inline std::string time_delta_str(const start_time_type& ref_time)
 
 #define NOW() (time_delta_str(start_time))
 
+/***********************************************************************
+ * Machine-readable reporting
+ **********************************************************************/
+//! Snapshot of the test counters, used for the per-second JSON series
+struct stats_sample_type
+{
+    double time                       = 0.0; // seconds since test start
+    unsigned long long rx_samps       = 0;
+    unsigned long long tx_samps       = 0;
+    unsigned long long overruns       = 0;
+    unsigned long long underruns      = 0;
+    unsigned long long dropped_samps  = 0;
+    unsigned long long seq_errors_tx  = 0;
+    unsigned long long seq_errors_rx  = 0;
+    unsigned long long late_commands  = 0;
+    unsigned long long timeouts_rx    = 0;
+    unsigned long long timeouts_tx    = 0;
+};
+
+//! CPU usage of one benchmark thread over the whole run
+struct thread_stats_type
+{
+    std::string name;
+    double cpu_time;
+    double wall_time;
+};
+
+std::mutex thread_stats_mutex;
+std::vector<thread_stats_type> thread_stats;
+
+//! CPU time consumed by the calling thread, in seconds (0.0 if unsupported)
+double get_thread_cpu_time(void)
+{
+#ifdef __linux__
+    timespec ts{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+        return double(ts.tv_sec) + double(ts.tv_nsec) / 1e9;
+    }
+#endif
+    return 0.0;
+}
+
+//! Record CPU usage of the calling thread under the given name
+void record_thread_stats(const std::string& name, const start_time_type& start_time)
+{
+    const double wall_time = std::chrono::duration<double>(time_delta(start_time)).count();
+    std::lock_guard<std::mutex> lock(thread_stats_mutex);
+    thread_stats.push_back({name, get_thread_cpu_time(), wall_time});
+}
+
+//! Read the current totals of the global counters
+stats_sample_type read_counters(const start_time_type& start_time)
+{
+    stats_sample_type sample;
+    sample.time          = std::chrono::duration<double>(time_delta(start_time)).count();
+    sample.rx_samps      = num_rx_samps;
+    sample.tx_samps      = num_tx_samps;
+    sample.overruns      = num_overruns;
+    sample.underruns     = num_underruns;
+    sample.dropped_samps = num_dropped_samps;
+    sample.seq_errors_tx = num_seq_errors;
+    sample.seq_errors_rx = num_seqrx_errors;
+    sample.late_commands = num_late_commands;
+    sample.timeouts_rx   = num_timeouts_rx;
+    sample.timeouts_tx   = num_timeouts_tx;
+    return sample;
+}
+
+//! Sample the global counters once per second, storing per-second deltas
+void benchmark_stats_monitor(const start_time_type& start_time,
+    std::atomic<bool>& burst_timer_elapsed,
+    std::vector<stats_sample_type>& samples)
+{
+    stats_sample_type prev = read_counters(start_time);
+    while (not burst_timer_elapsed) {
+        std::this_thread::sleep_for(1s);
+        const stats_sample_type total = read_counters(start_time);
+        stats_sample_type delta;
+        delta.time          = total.time;
+        delta.rx_samps      = total.rx_samps - prev.rx_samps;
+        delta.tx_samps      = total.tx_samps - prev.tx_samps;
+        delta.overruns      = total.overruns - prev.overruns;
+        delta.underruns     = total.underruns - prev.underruns;
+        delta.dropped_samps = total.dropped_samps - prev.dropped_samps;
+        delta.seq_errors_tx = total.seq_errors_tx - prev.seq_errors_tx;
+        delta.seq_errors_rx = total.seq_errors_rx - prev.seq_errors_rx;
+        delta.late_commands = total.late_commands - prev.late_commands;
+        delta.timeouts_rx   = total.timeouts_rx - prev.timeouts_rx;
+        delta.timeouts_tx   = total.timeouts_tx - prev.timeouts_tx;
+        samples.push_back(delta);
+        prev = total;
+    }
+}
+
+std::string json_escape(const std::string& in)
+{
+    std::string out;
+    for (const char c : in) {
+        if (c == '"' or c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+//! Write the counters of one sample as JSON object fields
+void write_sample_json(std::ostream& os, const stats_sample_type& sample)
+{
+    os << "\"time\": " << sample.time << ", \"rx_samples\": " << sample.rx_samps
+       << ", \"tx_samples\": " << sample.tx_samps << ", \"overruns\": " << sample.overruns
+       << ", \"underruns\": " << sample.underruns
+       << ", \"dropped_samples\": " << sample.dropped_samps
+       << ", \"seq_errors_tx\": " << sample.seq_errors_tx
+       << ", \"seq_errors_rx\": " << sample.seq_errors_rx
+       << ", \"late_commands\": " << sample.late_commands
+       << ", \"timeouts_rx\": " << sample.timeouts_rx
+       << ", \"timeouts_tx\": " << sample.timeouts_tx;
+}
+
+//! Parse a comma-separated list of CPU numbers
+std::vector<size_t> parse_cpu_list(const std::string& list)
+{
+    std::vector<size_t> cpus;
+    if (list.empty()) {
+        return cpus;
+    }
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of("\"',"));
+    for (const std::string& token : tokens) {
+        if (not token.empty()) {
+            cpus.push_back(std::stoul(token));
+        }
+    }
+    return cpus;
+}
+
+//! One point of the sweep grid: converter formats and samples/packet
+struct sweep_point_type
+{
+    std::string cpu_fmt; //!< empty: keep --rx_cpu/--tx_cpu
+    std::string otw_fmt; //!< empty: keep --rx_otw/--tx_otw
+    size_t spp = 0; //!< 0: keep --rx_spp/--tx_spp
+};
+
+//! Parse a comma-separated list of host:wire converter pairs, e.g.
+//! "fc32:sc16,sc16:sc8"
+std::vector<sweep_point_type> parse_conv_list(const std::string& list)
+{
+    std::vector<sweep_point_type> convs;
+    if (list.empty()) {
+        return convs;
+    }
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","));
+    for (const std::string& token : tokens) {
+        const size_t sep = token.find(':');
+        if (sep == std::string::npos or sep == 0 or sep + 1 == token.size()) {
+            throw std::runtime_error(
+                "Invalid converter pair (expected host:wire): " + token);
+        }
+        sweep_point_type point;
+        point.cpu_fmt = token.substr(0, sep);
+        point.otw_fmt = token.substr(sep + 1);
+        convs.push_back(point);
+    }
+    return convs;
+}
+
+//! Parse a comma-separated list of samples/packet values
+std::vector<size_t> parse_spp_list(const std::string& list)
+{
+    std::vector<size_t> spps;
+    if (list.empty()) {
+        return spps;
+    }
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","));
+    for (const std::string& token : tokens) {
+        if (not token.empty()) {
+            spps.push_back(std::stoul(token));
+        }
+    }
+    return spps;
+}
+
 /***********************************************************************
  * Benchmark RX Rate
  **********************************************************************/
@@ -343,6 +534,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     bool rx_stream_now = false;
     std::string priority;
     bool elevate_priority = false;
+    std::string rx_pin_list, tx_pin_list;
+    std::string json_path;
+    std::string sweep_conv_list, sweep_spp_list;
+    std::string csv_path;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -386,6 +581,12 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("rx_delay", po::value<double>(&rx_delay)->default_value(0.0), "delay before starting RX in seconds")
         ("priority", po::value<std::string>(&priority)->default_value("normal"), "thread priority (normal, high)")
         ("multi_streamer", "Create a separate streamer per channel")
+        ("pin_rx", po::value<std::string>(&rx_pin_list)->default_value(""), "comma-separated CPU list; the i-th RX streamer thread is pinned to the i-th entry (e.g. NUMA-local cores)")
+        ("pin_tx", po::value<std::string>(&tx_pin_list)->default_value(""), "comma-separated CPU list; the i-th TX streamer thread is pinned to the i-th entry (e.g. NUMA-local cores)")
+        ("json", po::value<std::string>(&json_path)->default_value(""), "write a machine-readable JSON report with per-second counter series and per-thread CPU usage to this file (\"-\" for stdout)")
+        ("sweep_conv", po::value<std::string>(&sweep_conv_list)->default_value(""), "comma-separated list of host:wire converter pairs to sweep (e.g. \"fc32:sc16,sc16:sc8\"); overrides rx/tx_cpu and rx/tx_otw")
+        ("sweep_spp", po::value<std::string>(&sweep_spp_list)->default_value(""), "comma-separated list of samples/packet values to sweep; overrides rx_spp and tx_spp")
+        ("csv", po::value<std::string>(&csv_path)->default_value(""), "write a CSV performance matrix with one row per swept configuration to this file (\"-\" for stdout)")
     ;
     // clang-format on
     po::variables_map vm;
@@ -442,8 +643,6 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     std::cout << boost::format("Using Device: %s") % usrp->get_pp_string() << std::endl;
     int num_mboards = usrp->get_num_mboards();
 
-    boost::thread_group thread_group;
-
     if (vm.count("ref")) {
         if (ref == "mimo") {
             if (num_mboards != 2) {
@@ -544,44 +743,144 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         usrp->set_time_now(0.0);
     }
 
-    // spawn the receive test thread
-    if (vm.count("rx_rate")) {
-        usrp->set_rx_rate(rx_rate);
-        // Set an appropriate rx_delay value (if needed) to be used as the time_spec for
-        // streaming.
-        // A time_spec is needed to time align multiple channels or if the user specifies
-        // a delay. Also delay start in case we are using multiple streamers to stream
-        // multi channel data to avoid management transaction contention between threads
-        // during setup.
-        if ((rx_delay == 0.0 || vm.count("multi_streamer"))
-            && rx_channel_nums.size() > 1) {
-            adjusted_rx_delay = std::max(rx_delay, 0.05);
-        }
-        if (rx_delay == 0.0
-            && (vm.count("multi_streamer") || rx_channel_nums.size() == 1)) {
-            rx_stream_now = true;
-        }
-
-        size_t spb = 0;
-        if (vm.count("rx_spp")) {
-            std::cout << boost::format("Setting RX spp to %u\n") % rx_spp;
-            usrp->set_rx_spp(rx_spp);
-            spb = rx_spp;
-        }
-        if (vm.count("rx_spb")) {
-            spb = rx_spb;
-        }
-        if (vm.count("multi_streamer")) {
-            for (size_t count = 0; count < rx_channel_nums.size(); count++) {
-                std::vector<size_t> this_streamer_channels{rx_channel_nums[count]};
+    // CPU lists for pinning the streamer threads (empty means no pinning)
+    const std::vector<size_t> rx_cpus = parse_cpu_list(rx_pin_list);
+    const std::vector<size_t> tx_cpus = parse_cpu_list(tx_pin_list);
+
+    // Build the sweep grid. Without sweep options this is a single point that
+    // keeps the formats and spp selected above, so the test runs once as
+    // before.
+    std::vector<sweep_point_type> conv_sweep = parse_conv_list(sweep_conv_list);
+    std::vector<size_t> spp_sweep            = parse_spp_list(sweep_spp_list);
+    const bool sweeping = not conv_sweep.empty() or not spp_sweep.empty();
+    if (conv_sweep.empty()) {
+        conv_sweep.push_back(sweep_point_type());
+    }
+    if (spp_sweep.empty()) {
+        spp_sweep.push_back(0);
+    }
+    std::vector<sweep_point_type> sweep_grid;
+    for (const sweep_point_type& conv : conv_sweep) {
+        for (const size_t grid_spp : spp_sweep) {
+            sweep_grid.push_back({conv.cpu_fmt, conv.otw_fmt, grid_spp});
+        }
+    }
+    if (sweeping and not json_path.empty()) {
+        std::cerr << "WARNING: --json reports only the last swept configuration; "
+                     "use --csv for the full matrix."
+                  << std::endl;
+    }
+
+    std::vector<std::string> csv_rows;
+    std::vector<stats_sample_type> stats_samples;
+    bool all_passed = true;
+
+    for (const sweep_point_type& sweep_pt : sweep_grid) {
+        // Per-run format and spp selection (empty/zero sweep entries keep the
+        // values from the command line)
+        const std::string run_rx_cpu =
+            sweep_pt.cpu_fmt.empty() ? rx_cpu : sweep_pt.cpu_fmt;
+        const std::string run_tx_cpu =
+            sweep_pt.cpu_fmt.empty() ? tx_cpu : sweep_pt.cpu_fmt;
+        const std::string run_rx_otw =
+            sweep_pt.otw_fmt.empty() ? rx_otw : sweep_pt.otw_fmt;
+        const std::string run_tx_otw =
+            sweep_pt.otw_fmt.empty() ? tx_otw : sweep_pt.otw_fmt;
+        const size_t run_rx_spp =
+            sweep_pt.spp ? sweep_pt.spp : (vm.count("rx_spp") ? rx_spp : 0);
+        const size_t run_tx_spp =
+            sweep_pt.spp ? sweep_pt.spp : (vm.count("tx_spp") ? tx_spp : 0);
+        if (sweeping) {
+            std::cout << boost::format(
+                             "[%s] Running configuration: rx %s->%s, tx %s->%s, spp %s\n")
+                             % NOW() % run_rx_otw % run_rx_cpu % run_tx_cpu % run_tx_otw
+                             % (sweep_pt.spp ? std::to_string(sweep_pt.spp) : "default");
+        }
+
+        // reset the counters and the stop flag for this run
+        num_overruns        = 0;
+        num_underruns       = 0;
+        num_rx_samps        = 0;
+        num_tx_samps        = 0;
+        num_dropped_samps   = 0;
+        num_seq_errors      = 0;
+        num_seqrx_errors    = 0;
+        num_late_commands   = 0;
+        num_timeouts_rx     = 0;
+        num_timeouts_tx     = 0;
+        burst_timer_elapsed = false;
+        boost::thread_group thread_group;
+        const start_time_type run_start_time(std::chrono::steady_clock::now());
+
+        // spawn the receive test thread
+        if (vm.count("rx_rate")) {
+            usrp->set_rx_rate(rx_rate);
+            // Set an appropriate rx_delay value (if needed) to be used as the
+            // time_spec for streaming.
+            // A time_spec is needed to time align multiple channels or if the
+            // user specifies a delay. Also delay start in case we are using
+            // multiple streamers to stream multi channel data to avoid
+            // management transaction contention between threads during setup.
+            if ((rx_delay == 0.0 || vm.count("multi_streamer"))
+                && rx_channel_nums.size() > 1) {
+                adjusted_rx_delay = std::max(rx_delay, 0.05);
+            }
+            if (rx_delay == 0.0
+                && (vm.count("multi_streamer") || rx_channel_nums.size() == 1)) {
+                rx_stream_now = true;
+            }
+
+            size_t spb = 0;
+            if (run_rx_spp != 0) {
+                std::cout << boost::format("Setting RX spp to %u\n") % run_rx_spp;
+                usrp->set_rx_spp(run_rx_spp);
+                spb = run_rx_spp;
+            }
+            if (vm.count("rx_spb")) {
+                spb = rx_spb;
+            }
+            if (vm.count("multi_streamer")) {
+                for (size_t count = 0; count < rx_channel_nums.size(); count++) {
+                    std::vector<size_t> this_streamer_channels{rx_channel_nums[count]};
+                    // create a receive streamer
+                    uhd::stream_args_t stream_args(run_rx_cpu, run_rx_otw);
+                    stream_args.channels             = this_streamer_channels;
+                    stream_args.args                 = uhd::device_addr_t(rx_stream_args);
+                    uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
+                    auto rx_thread =
+                        thread_group.create_thread([=, &burst_timer_elapsed]() {
+                        if (count < rx_cpus.size()) {
+                            uhd::set_thread_affinity({rx_cpus[count]});
+                        }
+                        benchmark_rx_rate(usrp,
+                            run_rx_cpu,
+                            rx_stream,
+                            spb,
+                            random_nsamps,
+                            start_time,
+                            burst_timer_elapsed,
+                            elevate_priority,
+                            adjusted_rx_delay,
+                            rx_delay,
+                            rx_stream_now);
+                        record_thread_stats(
+                            "bmark_rx_strm" + std::to_string(count), start_time);
+                    });
+                    uhd::set_thread_name(
+                        rx_thread, "bmark_rx_strm" + std::to_string(count));
+                }
+            } else {
                 // create a receive streamer
-                uhd::stream_args_t stream_args(rx_cpu, rx_otw);
-                stream_args.channels             = this_streamer_channels;
+                uhd::stream_args_t stream_args(run_rx_cpu, run_rx_otw);
+                stream_args.channels             = rx_channel_nums;
                 stream_args.args                 = uhd::device_addr_t(rx_stream_args);
                 uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
                 auto rx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
+                    if (not rx_cpus.empty()) {
+                        uhd::set_thread_affinity({rx_cpus.front()});
+                    }
                     benchmark_rx_rate(usrp,
-                        rx_cpu,
+                        run_rx_cpu,
                         rx_stream,
                         spb,
                         random_nsamps,
@@ -591,71 +890,97 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                         adjusted_rx_delay,
                         rx_delay,
                         rx_stream_now);
+                    record_thread_stats("bmark_rx_stream", start_time);
                 });
-                uhd::set_thread_name(rx_thread, "bmark_rx_strm" + std::to_string(count));
+                uhd::set_thread_name(rx_thread, "bmark_rx_stream");
             }
-        } else {
-            // create a receive streamer
-            uhd::stream_args_t stream_args(rx_cpu, rx_otw);
-            stream_args.channels             = rx_channel_nums;
-            stream_args.args                 = uhd::device_addr_t(rx_stream_args);
-            uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
-            auto rx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_rx_rate(usrp,
-                    rx_cpu,
-                    rx_stream,
-                    spb,
-                    random_nsamps,
-                    start_time,
-                    burst_timer_elapsed,
-                    elevate_priority,
-                    adjusted_rx_delay,
-                    rx_delay,
-                    rx_stream_now);
-            });
-            uhd::set_thread_name(rx_thread, "bmark_rx_stream");
         }
-    }
 
-    // spawn the transmit test thread
-    if (vm.count("tx_rate")) {
-        usrp->set_tx_rate(tx_rate);
-        // Set an appropriate tx_delay value (if needed) to be used as the time_spec for
-        // streaming.
-        // A time_spec is needed to time align multiple channels or if the user specifies
-        // a delay. Also delay start in case we are using multiple streamers to stream
-        // multi channel data to avoid management transaction contention between threads
-        // during setup.
-        if ((tx_delay == 0.0 || vm.count("multi_streamer"))
-            && tx_channel_nums.size() > 1) {
-            adjusted_tx_delay = std::max(tx_delay, 0.25);
-        }
-
-        if (vm.count("multi_streamer")) {
-            for (size_t count = 0; count < tx_channel_nums.size(); count++) {
-                std::vector<size_t> this_streamer_channels{tx_channel_nums[count]};
+        // spawn the transmit test thread
+        if (vm.count("tx_rate")) {
+            usrp->set_tx_rate(tx_rate);
+            // Set an appropriate tx_delay value (if needed) to be used as the
+            // time_spec for streaming.
+            // A time_spec is needed to time align multiple channels or if the
+            // user specifies a delay. Also delay start in case we are using
+            // multiple streamers to stream multi channel data to avoid
+            // management transaction contention between threads during setup.
+            if ((tx_delay == 0.0 || vm.count("multi_streamer"))
+                && tx_channel_nums.size() > 1) {
+                adjusted_tx_delay = std::max(tx_delay, 0.25);
+            }
 
+            if (vm.count("multi_streamer")) {
+                for (size_t count = 0; count < tx_channel_nums.size(); count++) {
+                    std::vector<size_t> this_streamer_channels{tx_channel_nums[count]};
+
+                    // create a transmit streamer
+                    uhd::stream_args_t stream_args(run_tx_cpu, run_tx_otw);
+                    stream_args.channels             = this_streamer_channels;
+                    stream_args.args                 = uhd::device_addr_t(tx_stream_args);
+                    uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
+                    const size_t max_spp             = tx_stream->get_max_num_samps();
+                    size_t spp                       = max_spp;
+                    if (run_tx_spp != 0) {
+                        spp = std::min(spp, run_tx_spp);
+                    }
+                    if (vm.count("tx_sample_align")) {
+                        spp = spp - (spp % tx_align);
+                    }
+                    size_t spb = spp;
+                    if (vm.count("tx_spb")) {
+                        spb = tx_spb;
+                    }
+                    std::cout << boost::format("Setting TX spb to %u\n") % spb;
+                    auto tx_thread =
+                        thread_group.create_thread([=, &burst_timer_elapsed]() {
+                        if (count < tx_cpus.size()) {
+                            uhd::set_thread_affinity({tx_cpus[count]});
+                        }
+                        benchmark_tx_rate(usrp,
+                            run_tx_cpu,
+                            tx_stream,
+                            burst_timer_elapsed,
+                            start_time,
+                            spb,
+                            elevate_priority,
+                            adjusted_tx_delay,
+                            random_nsamps);
+                        record_thread_stats(
+                            "bmark_tx_strm" + std::to_string(count), start_time);
+                    });
+                    uhd::set_thread_name(
+                        tx_thread, "bmark_tx_strm" + std::to_string(count));
+                    auto tx_async_thread =
+                        thread_group.create_thread([=, &burst_timer_elapsed]() {
+                            benchmark_tx_rate_async_helper(
+                                tx_stream, start_time, burst_timer_elapsed);
+                        });
+                    uhd::set_thread_name(
+                        tx_async_thread, "bmark_tx_hlpr" + std::to_string(count));
+                }
+            } else {
                 // create a transmit streamer
-                uhd::stream_args_t stream_args(tx_cpu, tx_otw);
-                stream_args.channels             = this_streamer_channels;
+                uhd::stream_args_t stream_args(run_tx_cpu, run_tx_otw);
+                stream_args.channels             = tx_channel_nums;
                 stream_args.args                 = uhd::device_addr_t(tx_stream_args);
                 uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
                 const size_t max_spp             = tx_stream->get_max_num_samps();
                 size_t spp                       = max_spp;
-                if (vm.count("tx_spp")) {
-                    spp = std::min(spp, tx_spp);
-                }
-                if (vm.count("tx_sample_align")) {
-                    spp = spp - (spp % tx_align);
+                if (run_tx_spp != 0) {
+                    spp = std::min(spp, run_tx_spp);
                 }
                 size_t spb = spp;
                 if (vm.count("tx_spb")) {
                     spb = tx_spb;
                 }
-                std::cout << boost::format("Setting TX spb to %u\n") % spb;
+                std::cout << boost::format("Setting TX spp to %u\n") % spp;
                 auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
+                    if (not tx_cpus.empty()) {
+                        uhd::set_thread_affinity({tx_cpus.front()});
+                    }
                     benchmark_tx_rate(usrp,
-                        tx_cpu,
+                        run_tx_cpu,
                         tx_stream,
                         burst_timer_elapsed,
                         start_time,
@@ -663,128 +988,202 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                         elevate_priority,
                         adjusted_tx_delay,
                         random_nsamps);
+                    record_thread_stats("bmark_tx_stream", start_time);
                 });
-                uhd::set_thread_name(tx_thread, "bmark_tx_strm" + std::to_string(count));
+                uhd::set_thread_name(tx_thread, "bmark_tx_stream");
                 auto tx_async_thread =
                     thread_group.create_thread([=, &burst_timer_elapsed]() {
                         benchmark_tx_rate_async_helper(
                             tx_stream, start_time, burst_timer_elapsed);
                     });
-                uhd::set_thread_name(
-                    tx_async_thread, "bmark_tx_hlpr" + std::to_string(count));
+                uhd::set_thread_name(tx_async_thread, "bmark_tx_helper");
             }
+        }
+
+        // spawn the stats monitor for the JSON report
+        if (not json_path.empty()) {
+            auto monitor_thread = thread_group.create_thread([&]() {
+                benchmark_stats_monitor(start_time, burst_timer_elapsed, stats_samples);
+            });
+            uhd::set_thread_name(monitor_thread, "bmark_monitor");
+        }
+
+        // Sleep for the required duration (add any initial delay).
+        // If you are benchmarking Rx and Tx at the same time, Rx threads will run longer
+        // than specified duration if tx_delay > rx_delay because of the overly simplified
+        // logic below and vice versa.
+        double run_duration = duration;
+        if (vm.count("rx_rate") and vm.count("tx_rate")) {
+            run_duration += std::max(adjusted_rx_delay, adjusted_tx_delay);
+        } else if (vm.count("rx_rate")) {
+            run_duration += adjusted_rx_delay;
         } else {
-            // create a transmit streamer
-            uhd::stream_args_t stream_args(tx_cpu, tx_otw);
-            stream_args.channels             = tx_channel_nums;
-            stream_args.args                 = uhd::device_addr_t(tx_stream_args);
-            uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
-            const size_t max_spp             = tx_stream->get_max_num_samps();
-            size_t spp                       = max_spp;
-            if (vm.count("tx_spp")) {
-                spp = std::min(spp, tx_spp);
+            run_duration += adjusted_tx_delay;
+        }
+        const int64_t secs  = int64_t(run_duration);
+        const int64_t usecs = int64_t((run_duration - secs) * 1e6);
+        std::this_thread::sleep_for(
+            std::chrono::seconds(secs) + std::chrono::microseconds(usecs));
+
+        // interrupt and join the threads
+        burst_timer_elapsed = true;
+        thread_group.join_all();
+
+        std::cout << "[" << NOW() << "] Benchmark complete." << std::endl << std::endl;
+
+        // record the CSV row for this configuration
+        if (not csv_path.empty()) {
+            const stats_sample_type totals = read_counters(run_start_time);
+            csv_rows.push_back(
+                str(boost::format("%s,%s,%s,%s,%u,%.3f,%.0f,%.0f,%u,%u,%u,%u,%u,%u,"
+                                  "%u,%u,%u,\"%s\"")
+                    % run_rx_cpu % run_rx_otw % run_tx_cpu % run_tx_otw % run_rx_spp
+                    % totals.time % (vm.count("rx_rate") ? rx_rate : 0.0)
+                    % (vm.count("tx_rate") ? tx_rate : 0.0) % totals.rx_samps
+                    % totals.tx_samps % totals.overruns % totals.underruns
+                    % totals.dropped_samps % totals.seq_errors_tx % totals.seq_errors_rx
+                    % totals.late_commands % totals.timeouts_rx % totals.timeouts_tx
+                    % args));
+        }
+
+        // print summary
+        const std::string threshold_err(" ERROR: Exceeds threshold!");
+        const bool overrun_threshold_err = vm.count("overrun-threshold")
+                                           and num_overruns > overrun_threshold;
+        const bool underrun_threshold_err = vm.count("underrun-threshold")
+                                            and num_underruns > underrun_threshold;
+        const bool drop_threshold_err = vm.count("drop-threshold")
+                                        and num_seqrx_errors > drop_threshold;
+        const bool seq_threshold_err = vm.count("seq-threshold")
+                                       and num_seq_errors > seq_threshold;
+        std::cout << std::endl
+                  << boost::format("Benchmark rate summary:\n"
+                                   "  Num received samples:     %u\n"
+                                   "  Num dropped samples:      %u\n"
+                                   "  Num overruns detected:    %u\n"
+                                   "  Num transmitted samples:  %u\n"
+                                   "  Num sequence errors (Tx): %u\n"
+                                   "  Num sequence errors (Rx): %u\n"
+                                   "  Num underruns detected:   %u\n"
+                                   "  Num late commands:        %u\n"
+                                   "  Num timeouts (Tx):        %u\n"
+                                   "  Num timeouts (Rx):        %u\n")
+                         % num_rx_samps % num_dropped_samps % num_overruns % num_tx_samps
+                         % num_seq_errors % num_seqrx_errors % num_underruns
+                         % num_late_commands % num_timeouts_tx % num_timeouts_rx
+                  << std::endl;
+        const bool passed = not(overrun_threshold_err or underrun_threshold_err
+                                or drop_threshold_err or seq_threshold_err);
+        if (not passed) {
+            std::cout << "The following error thresholds were exceeded:\n";
+            if (overrun_threshold_err) {
+                std::cout << boost::format("  * Overruns (%d/%d)") % num_overruns
+                                 % overrun_threshold
+                          << std::endl;
             }
-            size_t spb = spp;
-            if (vm.count("tx_spb")) {
-                spb = tx_spb;
+            if (underrun_threshold_err) {
+                std::cout << boost::format("  * Underruns (%d/%d)") % num_underruns
+                                 % underrun_threshold
+                          << std::endl;
+            }
+            if (drop_threshold_err) {
+                std::cout << boost::format("  * Dropped packets (RX) (%d/%d)")
+                                 % num_seqrx_errors % drop_threshold
+                          << std::endl;
+            }
+            if (seq_threshold_err) {
+                std::cout << boost::format("  * Dropped packets (TX) (%d/%d)")
+                                 % num_seq_errors % seq_threshold
+                          << std::endl;
             }
-            std::cout << boost::format("Setting TX spp to %u\n") % spp;
-            auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_tx_rate(usrp,
-                    tx_cpu,
-                    tx_stream,
-                    burst_timer_elapsed,
-                    start_time,
-                    spb,
-                    elevate_priority,
-                    adjusted_tx_delay,
-                    random_nsamps);
-            });
-            uhd::set_thread_name(tx_thread, "bmark_tx_stream");
-            auto tx_async_thread =
-                thread_group.create_thread([=, &burst_timer_elapsed]() {
-                    benchmark_tx_rate_async_helper(
-                        tx_stream, start_time, burst_timer_elapsed);
-                });
-            uhd::set_thread_name(tx_async_thread, "bmark_tx_helper");
         }
-    }
-
-    // Sleep for the required duration (add any initial delay).
-    // If you are benchmarking Rx and Tx at the same time, Rx threads will run longer
-    // than specified duration if tx_delay > rx_delay because of the overly simplified
-    // logic below and vice versa.
-    if (vm.count("rx_rate") and vm.count("tx_rate")) {
-        duration += std::max(adjusted_rx_delay, adjusted_tx_delay);
-    } else if (vm.count("rx_rate")) {
-        duration += adjusted_rx_delay;
-    } else {
-        duration += adjusted_tx_delay;
-    }
-    const int64_t secs  = int64_t(duration);
-    const int64_t usecs = int64_t((duration - secs) * 1e6);
-    std::this_thread::sleep_for(
-        std::chrono::seconds(secs) + std::chrono::microseconds(usecs));
-
-    // interrupt and join the threads
-    burst_timer_elapsed = true;
-    thread_group.join_all();
-
-    std::cout << "[" << NOW() << "] Benchmark complete." << std::endl << std::endl;
-
-    // print summary
-    const std::string threshold_err(" ERROR: Exceeds threshold!");
-    const bool overrun_threshold_err = vm.count("overrun-threshold")
-                                       and num_overruns > overrun_threshold;
-    const bool underrun_threshold_err = vm.count("underrun-threshold")
-                                        and num_underruns > underrun_threshold;
-    const bool drop_threshold_err = vm.count("drop-threshold")
-                                    and num_seqrx_errors > drop_threshold;
-    const bool seq_threshold_err = vm.count("seq-threshold")
-                                   and num_seq_errors > seq_threshold;
-    std::cout << std::endl
-              << boost::format("Benchmark rate summary:\n"
-                               "  Num received samples:     %u\n"
-                               "  Num dropped samples:      %u\n"
-                               "  Num overruns detected:    %u\n"
-                               "  Num transmitted samples:  %u\n"
-                               "  Num sequence errors (Tx): %u\n"
-                               "  Num sequence errors (Rx): %u\n"
-                               "  Num underruns detected:   %u\n"
-                               "  Num late commands:        %u\n"
-                               "  Num timeouts (Tx):        %u\n"
-                               "  Num timeouts (Rx):        %u\n")
-                     % num_rx_samps % num_dropped_samps % num_overruns % num_tx_samps
-                     % num_seq_errors % num_seqrx_errors % num_underruns
-                     % num_late_commands % num_timeouts_tx % num_timeouts_rx
-              << std::endl;
-    // finished
-    std::cout << std::endl << "Done!" << std::endl << std::endl;
+        all_passed = all_passed and passed;
+    } // for each sweep point
 
-    if (overrun_threshold_err || underrun_threshold_err || drop_threshold_err
-        || seq_threshold_err) {
-        std::cout << "The following error thresholds were exceeded:\n";
-        if (overrun_threshold_err) {
-            std::cout << boost::format("  * Overruns (%d/%d)") % num_overruns
-                             % overrun_threshold
-                      << std::endl;
+    // write the JSON report
+    if (not json_path.empty()) {
+        const stats_sample_type totals = read_counters(start_time);
+        std::ostringstream json;
+        json << "{\n";
+        json << "  \"config\": {\"args\": \"" << json_escape(args) << "\""
+             << ", \"duration\": " << duration;
+        if (vm.count("rx_rate")) {
+            json << ", \"rx_rate\": " << rx_rate
+                 << ", \"num_rx_channels\": " << rx_channel_nums.size();
+        }
+        if (vm.count("tx_rate")) {
+            json << ", \"tx_rate\": " << tx_rate
+                 << ", \"num_tx_channels\": " << tx_channel_nums.size();
         }
-        if (underrun_threshold_err) {
-            std::cout << boost::format("  * Underruns (%d/%d)") % num_underruns
-                             % underrun_threshold
-                      << std::endl;
+        json << ", \"multi_streamer\": "
+             << (vm.count("multi_streamer") ? "true" : "false") << "},\n";
+        json << "  \"totals\": {";
+        write_sample_json(json, totals);
+        json << "},\n";
+        json << "  \"per_second\": [";
+        for (size_t i = 0; i < stats_samples.size(); i++) {
+            json << (i ? ",\n    {" : "\n    {");
+            write_sample_json(json, stats_samples[i]);
+            json << "}";
         }
-        if (drop_threshold_err) {
-            std::cout << boost::format("  * Dropped packets (RX) (%d/%d)")
-                             % num_seqrx_errors % drop_threshold
-                      << std::endl;
+        json << "\n  ],\n";
+        json << "  \"threads\": [";
+        {
+            std::lock_guard<std::mutex> lock(thread_stats_mutex);
+            for (size_t i = 0; i < thread_stats.size(); i++) {
+                const thread_stats_type& stats = thread_stats[i];
+                json << (i ? ",\n    {" : "\n    {");
+                json << "\"name\": \"" << json_escape(stats.name) << "\""
+                     << ", \"cpu_time\": " << stats.cpu_time
+                     << ", \"wall_time\": " << stats.wall_time << ", \"utilization\": "
+                     << (stats.wall_time > 0.0 ? stats.cpu_time / stats.wall_time : 0.0)
+                     << "}";
+            }
+        }
+        json << "\n  ],\n";
+        json << "  \"passed\": " << (all_passed ? "true" : "false") << "\n";
+        json << "}\n";
+
+        if (json_path == "-") {
+            std::cout << json.str();
+        } else {
+            std::ofstream json_file(json_path);
+            if (json_file) {
+                json_file << json.str();
+                std::cout << "Wrote JSON report to " << json_path << std::endl;
+            } else {
+                std::cerr << "ERROR: Could not open " << json_path
+                          << " for writing the JSON report." << std::endl;
+            }
+        }
+    }
+
+    // write the CSV performance matrix
+    if (not csv_path.empty()) {
+        std::ostringstream csv;
+        csv << "rx_cpu,rx_otw,tx_cpu,tx_otw,spp,elapsed,rx_rate,tx_rate,"
+               "rx_samples,tx_samples,overruns,underruns,dropped_samples,"
+               "seq_errors_tx,seq_errors_rx,late_commands,timeouts_rx,"
+               "timeouts_tx,args\n";
+        for (const std::string& row : csv_rows) {
+            csv << row << "\n";
         }
-        if (seq_threshold_err) {
-            std::cout << boost::format("  * Dropped packets (TX) (%d/%d)")
-                             % num_seq_errors % seq_threshold
-                      << std::endl;
+        if (csv_path == "-") {
+            std::cout << csv.str();
+        } else {
+            std::ofstream csv_file(csv_path);
+            if (csv_file) {
+                csv_file << csv.str();
+                std::cout << "Wrote CSV report to " << csv_path << std::endl;
+            } else {
+                std::cerr << "ERROR: Could not open " << csv_path
+                          << " for writing the CSV report." << std::endl;
+            }
         }
-        return EXIT_FAILURE;
     }
-    return EXIT_SUCCESS;
+
+    // finished
+    std::cout << std::endl << "Done!" << std::endl << std::endl;
+
+    return all_passed ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -8,13 +8,139 @@
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <complex>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace po = boost::program_options;
 
+//! Outcome counts of one batch of timed loopback runs
+struct latency_results_t
+{
+    int ack        = 0;
+    int time_error = 0;
+    int underflow  = 0;
+    int other      = 0;
+};
+
+/*!
+ * Run a batch of timed loopback tests with a fixed RTT budget.
+ *
+ * Each run receives a packet with a device timestamp and sends a packet
+ * timed rtt seconds after it; the device reports via async message
+ * whether the packet made it back in time (ACK) or was late (time
+ * error). A run thus succeeds iff the host round trip fits in rtt.
+ */
+latency_results_t run_latency_tests(uhd::usrp::multi_usrp::sptr usrp,
+    uhd::rx_streamer::sptr rx_stream,
+    uhd::tx_streamer::sptr tx_stream,
+    std::vector<std::complex<float>>& buffer,
+    const double rtt,
+    const size_t nruns,
+    const double rx_time,
+    const bool from_eob,
+    const bool verbose)
+{
+    latency_results_t results;
+
+    const auto count_event = [&results](const uhd::async_metadata_t& async_md) {
+        switch (async_md.event_code) {
+            case uhd::async_metadata_t::EVENT_CODE_TIME_ERROR:
+                results.time_error++;
+                break;
+
+            case uhd::async_metadata_t::EVENT_CODE_BURST_ACK:
+                results.ack++;
+                break;
+
+            case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW:
+                results.underflow++;
+                break;
+
+            default:
+                std::cerr << boost::format(
+                                 "failed:\n    Got unexpected event code 0x%x.\n")
+                                 % async_md.event_code
+                          << std::endl;
+                results.other++;
+                break;
+        }
+    };
+
+    for (size_t nrun = 0; nrun < nruns; nrun++) {
+        /***************************************************************
+         * Issue a stream command some time in the near future
+         **************************************************************/
+        uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+        stream_cmd.num_samps  = buffer.size();
+        stream_cmd.stream_now = false;
+        stream_cmd.time_spec  = usrp->get_time_now() + uhd::time_spec_t(0.01);
+        rx_stream->issue_stream_cmd(stream_cmd);
+
+        /***************************************************************
+         * Receive the requested packet
+         **************************************************************/
+        uhd::rx_metadata_t rx_md;
+        size_t num_rx_samps = rx_stream->recv(&buffer.front(), buffer.size(), rx_md);
+
+        if (verbose) {
+            std::cout << boost::format(
+                             "Run %d: Got packet: %u samples, %u full secs, %f frac secs")
+                             % nrun % num_rx_samps % rx_md.time_spec.get_full_secs()
+                             % rx_md.time_spec.get_frac_secs()
+                      << std::endl;
+        } else {
+            std::cout << "." << std::flush;
+        }
+
+        /***************************************************************
+         * Transmit a packet with delta time after received packet
+         **************************************************************/
+        uhd::tx_metadata_t tx_md;
+        tx_md.start_of_burst = true;
+        tx_md.end_of_burst   = true;
+        tx_md.has_time_spec  = true;
+        tx_md.time_spec      = rx_md.time_spec + uhd::time_spec_t(rtt);
+        if (from_eob) {
+            tx_md.time_spec += uhd::time_spec_t(rx_time);
+        }
+        size_t num_tx_samps = tx_stream->send(&buffer.front(), buffer.size(), tx_md);
+        if (verbose) {
+            std::cout << boost::format("Sent %d samples") % num_tx_samps << std::endl;
+        }
+
+        /***************************************************************
+         * Check the async messages for result
+         **************************************************************/
+        uhd::async_metadata_t async_md;
+        if (not tx_stream->recv_async_msg(async_md)) {
+            std::cout << boost::format("failed:\n    Async message recv timed out.\n")
+                      << std::endl;
+            continue;
+        }
+        count_event(async_md);
+    }
+
+    // drain any remaining async messages
+    while (true) {
+        uhd::async_metadata_t async_md;
+        if (not tx_stream->recv_async_msg(async_md)) {
+            break;
+        }
+        count_event(async_md);
+    }
+    if (!verbose) {
+        std::cout << std::endl;
+    }
+
+    return results;
+}
+
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
@@ -23,6 +149,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     double rate;
     double rtt;
     size_t nruns;
+    double rtt_min, rtt_max, rtt_step;
+    std::string percentile_list;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -36,6 +164,11 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("rate",   po::value<double>(&rate)->default_value(100e6/4), "sample rate for receive and transmit (sps)")
         ("from-eob", "specify to define rtt to not include the time to clock out the RX samples (removes dependence on nsamps and rate)")
         ("verbose", "specify to enable inner-loop verbose")
+        ("sweep", "sweep RTT values from rtt-min to rtt-max and report an RTT histogram with percentiles")
+        ("rtt-min",  po::value<double>(&rtt_min)->default_value(0.0002),  "smallest RTT value of the sweep (seconds)")
+        ("rtt-max",  po::value<double>(&rtt_max)->default_value(0.003),   "largest RTT value of the sweep (seconds)")
+        ("rtt-step", po::value<double>(&rtt_step)->default_value(0.0001), "RTT increment of the sweep (seconds)")
+        ("percentiles", po::value<std::string>(&percentile_list)->default_value("50,99,99.9"), "comma-separated percentile targets reported by the sweep")
     ;
     // clang-format on
     po::variables_map vm;
@@ -55,7 +188,11 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                "    arrive too late at the device indicate an error.\n"
                "    The smallest value of rtt that does not indicate an error is an\n"
                "    approximation for the time it takes for a sample packet to\n"
-               "    go to UHD and back to the device."
+               "    go to UHD and back to the device.\n"
+               "    With --sweep, a range of rtt values is tested instead and the\n"
+               "    resulting histogram and percentiles (p50/p99/...) of the round\n"
+               "    trip time are reported, which is useful to validate kernel and\n"
+               "    NIC tuning changes."
             << std::endl;
         return EXIT_SUCCESS;
     }
@@ -99,117 +236,89 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
     uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
 
-    // initialize result counts
-    int time_error = 0;
-    int ack        = 0;
-    int underflow  = 0;
-    int other      = 0;
-
-    for (size_t nrun = 0; nrun < nruns; nrun++) {
-        /***************************************************************
-         * Issue a stream command some time in the near future
-         **************************************************************/
-        uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
-        stream_cmd.num_samps  = buffer.size();
-        stream_cmd.stream_now = false;
-        stream_cmd.time_spec  = usrp->get_time_now() + uhd::time_spec_t(0.01);
-        rx_stream->issue_stream_cmd(stream_cmd);
-
-        /***************************************************************
-         * Receive the requested packet
-         **************************************************************/
-        uhd::rx_metadata_t rx_md;
-        size_t num_rx_samps = rx_stream->recv(&buffer.front(), buffer.size(), rx_md);
-
-        if (verbose) {
-            std::cout << boost::format(
-                             "Run %d: Got packet: %u samples, %u full secs, %f frac secs")
-                             % nrun % num_rx_samps % rx_md.time_spec.get_full_secs()
-                             % rx_md.time_spec.get_frac_secs()
-                      << std::endl;
-        } else {
-            std::cout << "." << std::flush;
+    /***************************************************************
+     * Sweep mode: measure the RTT distribution
+     **************************************************************/
+    if (vm.count("sweep")) {
+        if (rtt_step <= 0.0 or rtt_max < rtt_min) {
+            std::cerr << "ERROR: Invalid sweep range." << std::endl;
+            return EXIT_FAILURE;
         }
 
-        /***************************************************************
-         * Transmit a packet with delta time after received packet
-         **************************************************************/
-        uhd::tx_metadata_t tx_md;
-        tx_md.start_of_burst = true;
-        tx_md.end_of_burst   = true;
-        tx_md.has_time_spec  = true;
-        tx_md.time_spec      = rx_md.time_spec + uhd::time_spec_t(rtt);
-        if (from_eob) {
-            tx_md.time_spec += uhd::time_spec_t(rx_time);
-        }
-        size_t num_tx_samps = tx_stream->send(&buffer.front(), buffer.size(), tx_md);
-        if (verbose) {
-            std::cout << boost::format("Sent %d samples") % num_tx_samps << std::endl;
+        // parse the percentile targets
+        std::vector<double> percentiles;
+        std::vector<std::string> percentile_strings;
+        boost::split(percentile_strings, percentile_list, boost::is_any_of("\"',"));
+        for (const std::string& percentile_string : percentile_strings) {
+            if (not percentile_string.empty()) {
+                percentiles.push_back(std::stod(percentile_string));
+            }
         }
 
-        /***************************************************************
-         * Check the async messages for result
-         **************************************************************/
-        uhd::async_metadata_t async_md;
-        if (not tx_stream->recv_async_msg(async_md)) {
-            std::cout << boost::format("failed:\n    Async message recv timed out.\n")
-                      << std::endl;
-            continue;
+        std::vector<double> rtts;
+        std::vector<latency_results_t> sweep_results;
+        for (double sweep_rtt = rtt_min; sweep_rtt <= rtt_max + rtt_step / 2;
+             sweep_rtt += rtt_step) {
+            std::cout << boost::format("Testing RTT %.3f ms ") % (sweep_rtt * 1e3)
+                      << std::flush;
+            rtts.push_back(sweep_rtt);
+            sweep_results.push_back(run_latency_tests(usrp,
+                rx_stream,
+                tx_stream,
+                buffer,
+                sweep_rtt,
+                nruns,
+                rx_time,
+                from_eob,
+                verbose));
         }
-        switch (async_md.event_code) {
-            case uhd::async_metadata_t::EVENT_CODE_TIME_ERROR:
-                time_error++;
-                break;
-
-            case uhd::async_metadata_t::EVENT_CODE_BURST_ACK:
-                ack++;
-                break;
 
-            case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW:
-                underflow++;
-                break;
-
-            default:
-                std::cerr << boost::format(
-                                 "failed:\n    Got unexpected event code 0x%x.\n")
-                                 % async_md.event_code
-                          << std::endl;
-                other++;
-                break;
-        }
-    }
-
-    while (true) {
-        uhd::async_metadata_t async_md;
-        if (not tx_stream->recv_async_msg(async_md)) {
-            break;
+        // Each run succeeds iff the host round trip fits into the tested
+        // RTT budget (the device timestamps both the rx packet and the
+        // timed send), so the per-RTT success count is the measured RTT
+        // CDF and adjacent differences give the histogram.
+        std::cout << "\nRTT histogram\n"
+                  << "================\n"
+                  << "   RTT [ms]   ACKs   late     in bin\n";
+        int prev_acks = 0;
+        for (size_t i = 0; i < rtts.size(); i++) {
+            const int in_bin = std::max(0, sweep_results[i].ack - prev_acks);
+            std::cout << boost::format("%11.3f %6d %6d %10d\n") % (rtts[i] * 1e3)
+                             % sweep_results[i].ack % sweep_results[i].time_error
+                             % in_bin;
+            prev_acks = std::max(prev_acks, sweep_results[i].ack);
         }
-        switch (async_md.event_code) {
-            case uhd::async_metadata_t::EVENT_CODE_TIME_ERROR:
-                time_error++;
-                break;
-
-            case uhd::async_metadata_t::EVENT_CODE_BURST_ACK:
-                ack++;
-                break;
-
-            case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW:
-                underflow++;
-                break;
 
-            default:
-                std::cerr << boost::format(
-                                 "failed:\n    Got unexpected event code 0x%x.\n")
-                                 % async_md.event_code
-                          << std::endl;
-                other++;
-                break;
+        std::cout << "\nPercentiles\n"
+                  << "================\n";
+        bool missed_percentile = false;
+        for (const double percentile : percentiles) {
+            const double target_acks = percentile / 100.0 * double(nruns);
+            bool found               = false;
+            for (size_t i = 0; i < rtts.size(); i++) {
+                if (double(sweep_results[i].ack) >= target_acks) {
+                    std::cout << boost::format("p%-8g <= %.3f ms\n") % percentile
+                                     % (rtts[i] * 1e3);
+                    found = true;
+                    break;
+                }
+            }
+            if (not found) {
+                std::cout << boost::format("p%-8g >  %.3f ms\n") % percentile
+                                 % (rtt_max * 1e3);
+                missed_percentile = true;
+            }
         }
-    }
-    if (!verbose) {
         std::cout << std::endl;
+        return missed_percentile ? EXIT_FAILURE : EXIT_SUCCESS;
     }
 
+    /***************************************************************
+     * Single-RTT mode
+     **************************************************************/
+    const latency_results_t results = run_latency_tests(
+        usrp, rx_stream, tx_stream, buffer, rtt, nruns, rx_time, from_eob, verbose);
+
     /***************************************************************
      * Print the summary
      **************************************************************/
@@ -217,10 +326,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
               << "================\n"
               << "Number of runs:   " << nruns << std::endl
               << "RTT value tested: " << (rtt * 1e3) << " ms" << std::endl
-              << "ACKs received:    " << ack << "/" << nruns << std::endl
-              << "Underruns:        " << underflow << std::endl
-              << "Late packets:     " << time_error << std::endl
-              << "Other errors:     " << other << std::endl
+              << "ACKs received:    " << results.ack << "/" << nruns << std::endl
+              << "Underruns:        " << results.underflow << std::endl
+              << "Late packets:     " << results.time_error << std::endl
+              << "Other errors:     " << results.other << std::endl
               << std::endl;
     return EXIT_SUCCESS;
 }
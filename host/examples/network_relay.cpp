@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
+#include <uhd/utils/compression.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <uhd/utils/thread.hpp>
 #include <boost/asio.hpp>
@@ -14,11 +16,19 @@
 #include <chrono>
 #include <csignal>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <thread>
 #include <vector>
+#ifdef __linux__
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
 
 namespace po   = boost::program_options;
 namespace asio = boost::asio;
@@ -74,29 +84,60 @@ public:
         const size_t server_rx_size = 0,
         const size_t server_tx_size = 0,
         const size_t client_rx_size = 0,
-        const size_t client_tx_size = 0)
+        const size_t client_tx_size = 0,
+        const size_t num_workers    = 0,
+        const size_t batch_size     = 64,
+        const std::string& compress = "",
+        const int compress_level    = 0)
         : _port(port)
+        , _compress(compress)
+        , _compress_level(compress_level)
+#ifdef __linux__
+        , _batch_size(batch_size)
+#endif
     {
+#ifndef __linux__
+        (void)num_workers;
+        (void)batch_size;
+#endif
         {
             asio::ip::udp::resolver resolver(_io_context);
-            asio::ip::udp::endpoint endpoint =
+            _server_endpoint =
                 *resolver.resolve(asio::ip::udp::v4(), server_addr, port).begin();
-
-            _server_socket = std::shared_ptr<asio::ip::udp::socket>(
-                new asio::ip::udp::socket(_io_context, endpoint));
-            resize_buffs(_server_socket, server_rx_size, server_tx_size);
         }
         {
             asio::ip::udp::resolver resolver(_io_context);
-            asio::ip::udp::endpoint endpoint =
+            _client_endpoint =
                 *resolver.resolve(asio::ip::udp::v4(), client_addr, port).begin();
+        }
 
-            _client_socket = std::shared_ptr<asio::ip::udp::socket>(
-                new asio::ip::udp::socket(_io_context));
-            _client_socket->open(asio::ip::udp::v4());
-            _client_socket->connect(endpoint);
-            resize_buffs(_client_socket, client_rx_size, client_tx_size);
+#ifdef __linux__
+        if (num_workers > 0) {
+            _make_mmsg_sockets(
+                num_workers, server_rx_size, server_tx_size, client_rx_size,
+                client_tx_size);
+            std::cout << "spawning " << num_workers << "+1 relay worker threads... "
+                      << _port << std::endl;
+            for (const int fd : _server_fds) {
+                (void)_thread_group.create_thread(
+                    std::bind(&udp_relay_type::mmsg_server_worker, this, fd));
+            }
+            (void)_thread_group.create_thread(
+                std::bind(&udp_relay_type::mmsg_client_worker, this));
+            std::cout << "    done!" << std::endl << std::endl;
+            return;
         }
+#endif
+
+        _server_socket = std::shared_ptr<asio::ip::udp::socket>(
+            new asio::ip::udp::socket(_io_context, _server_endpoint));
+        resize_buffs(_server_socket, server_rx_size, server_tx_size);
+
+        _client_socket = std::shared_ptr<asio::ip::udp::socket>(
+            new asio::ip::udp::socket(_io_context));
+        _client_socket->open(asio::ip::udp::v4());
+        _client_socket->connect(_client_endpoint);
+        resize_buffs(_client_socket, client_rx_size, client_tx_size);
 
         std::cout << "spawning relay threads... " << _port << std::endl;
         std::unique_lock<std::mutex> lock(
@@ -115,9 +156,36 @@ public:
         std::cout << "killing relay threads... " << _port << std::endl;
         _thread_group.interrupt_all();
         _thread_group.join_all();
+#ifdef __linux__
+        for (const int fd : _server_fds) {
+            ::close(fd);
+        }
+        if (_client_fd >= 0) {
+            ::close(_client_fd);
+        }
+#endif
         std::cout << "    done!" << std::endl << std::endl;
     }
 
+    //! Print per-flow forwarding counters (mmsg mode only)
+    void print_flow_counters(void)
+    {
+#ifdef __linux__
+        std::lock_guard<std::mutex> lock(_counter_mutex);
+        for (const auto& flow : _flows) {
+            in_addr addr;
+            addr.s_addr = flow.first.first;
+            std::cout << "  port " << _port << " <- " << ::inet_ntoa(addr) << ":"
+                      << flow.first.second << ": " << flow.second.packets << " pkts, "
+                      << flow.second.bytes << " bytes" << std::endl;
+        }
+        if (_return_packets != 0) {
+            std::cout << "  port " << _port << " -> app: " << _return_packets
+                      << " pkts, " << _return_bytes << " bytes" << std::endl;
+        }
+#endif
+    }
+
 private:
     static void resize_buffs(socket_type sock, const size_t rx_size, const size_t tx_size)
     {
@@ -160,25 +228,241 @@ private:
         std::cout << "    entering client_thread..." << std::endl;
         wait_for_thread.notify_one(); // notify constructor that this thread has started
         std::vector<char> buff(insane_mtu);
+        // Optional per-datagram compression of the device-to-app direction;
+        // codecs are not thread-safe, so this thread owns its own
+        uhd::chunk_compressor::sptr codec;
+        std::vector<char> comp_buff;
+        if (not _compress.empty()) {
+            codec = uhd::chunk_compressor::make(_compress, _compress_level);
+            comp_buff.resize(codec->bound(insane_mtu));
+        }
         while (not boost::this_thread::interruption_requested()) {
             if (wait_for_recv_ready(_client_socket->native_handle())) {
-                const size_t len =
+                size_t len =
                     _client_socket->receive(asio::buffer(&buff.front(), buff.size()));
+                const char* payload = &buff.front();
+                if (codec) {
+                    len     = codec->compress(
+                        comp_buff.data(), comp_buff.size(), payload, len);
+                    payload = comp_buff.data();
+                }
                 std::lock_guard<std::mutex> lock(_endpoint_mutex);
-                _server_socket->send_to(asio::buffer(&buff.front(), len), _endpoint);
+                _server_socket->send_to(asio::buffer(payload, len), _endpoint);
             }
         }
         std::cout << "    exiting client_thread..." << std::endl;
     }
 
+#ifdef __linux__
+    //! One relay direction's forwarding totals
+    struct flow_counters_type
+    {
+        uint64_t packets = 0;
+        uint64_t bytes   = 0;
+    };
+
+    int _make_udp_fd(const size_t rx_size, const size_t tx_size)
+    {
+        const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0) {
+            throw std::runtime_error("network_relay: could not create socket");
+        }
+        // Bounded blocking so the workers can poll the stop flag
+        timeval tv;
+        tv.tv_sec  = 0;
+        tv.tv_usec = 100000; // 100ms
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        if (rx_size != 0) {
+            const int size = int(rx_size);
+            ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+        }
+        if (tx_size != 0) {
+            const int size = int(tx_size);
+            ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+        }
+        return fd;
+    }
+
+    void _make_mmsg_sockets(const size_t num_workers,
+        const size_t server_rx_size,
+        const size_t server_tx_size,
+        const size_t client_rx_size,
+        const size_t client_tx_size)
+    {
+        // One bound socket per worker: SO_REUSEPORT makes the kernel spread
+        // incoming flows across the workers by flow hash
+        for (size_t i = 0; i < num_workers; i++) {
+            const int fd  = _make_udp_fd(server_rx_size, server_tx_size);
+            const int one = 1;
+            ::setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+            if (::bind(fd, _server_endpoint.data(), _server_endpoint.size()) != 0) {
+                ::close(fd);
+                throw std::runtime_error(
+                    "network_relay: could not bind to port " + _port);
+            }
+            _server_fds.push_back(fd);
+        }
+        _client_fd = _make_udp_fd(client_rx_size, client_tx_size);
+        if (::connect(_client_fd, _client_endpoint.data(), _client_endpoint.size())
+            != 0) {
+            throw std::runtime_error(
+                "network_relay: could not connect to client address");
+        }
+    }
+
+    //! Forward batches of datagrams from the app side to the device
+    void mmsg_server_worker(const int fd)
+    {
+        std::vector<std::vector<char>> buffs(_batch_size, std::vector<char>(insane_mtu));
+        std::vector<mmsghdr> msgs(_batch_size);
+        std::vector<iovec> iovs(_batch_size);
+        std::vector<sockaddr_in> srcs(_batch_size);
+
+        while (not boost::this_thread::interruption_requested()) {
+            for (size_t i = 0; i < _batch_size; i++) {
+                iovs[i].iov_base = buffs[i].data();
+                iovs[i].iov_len  = insane_mtu;
+                std::memset(&msgs[i], 0, sizeof(mmsghdr));
+                msgs[i].msg_hdr.msg_iov     = &iovs[i];
+                msgs[i].msg_hdr.msg_iovlen  = 1;
+                msgs[i].msg_hdr.msg_name    = &srcs[i];
+                msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+            const int num_rx =
+                ::recvmmsg(fd, msgs.data(), _batch_size, MSG_WAITFORONE, NULL);
+            if (num_rx <= 0) {
+                continue; // timeout
+            }
+
+            // Remember the app endpoint for the return direction
+            {
+                std::lock_guard<std::mutex> lock(_endpoint_mutex);
+                _return_addr     = srcs[num_rx - 1];
+                _have_return_addr = true;
+            }
+
+            // The client socket is connected: strip the source addresses and
+            // push the whole batch out in as few syscalls as possible
+            for (int i = 0; i < num_rx; i++) {
+                iovs[i].iov_len             = msgs[i].msg_len;
+                msgs[i].msg_hdr.msg_name    = NULL;
+                msgs[i].msg_hdr.msg_namelen = 0;
+            }
+            int num_sent = 0;
+            while (num_sent < num_rx) {
+                const int ret =
+                    ::sendmmsg(_client_fd, &msgs[num_sent], num_rx - num_sent, 0);
+                if (ret <= 0) {
+                    break;
+                }
+                num_sent += ret;
+            }
+
+            std::lock_guard<std::mutex> lock(_counter_mutex);
+            for (int i = 0; i < num_rx; i++) {
+                flow_counters_type& flow =
+                    _flows[{srcs[i].sin_addr.s_addr, ntohs(srcs[i].sin_port)}];
+                flow.packets++;
+                flow.bytes += msgs[i].msg_len;
+            }
+        }
+    }
+
+    //! Forward batches of datagrams from the device back to the app
+    void mmsg_client_worker(void)
+    {
+        std::vector<std::vector<char>> buffs(_batch_size, std::vector<char>(insane_mtu));
+        std::vector<mmsghdr> msgs(_batch_size);
+        std::vector<iovec> iovs(_batch_size);
+        std::vector<sockaddr_in> dsts(_batch_size);
+
+        // Optional per-datagram compression of the device-to-app direction
+        uhd::chunk_compressor::sptr codec;
+        std::vector<std::vector<char>> comp_buffs;
+        if (not _compress.empty()) {
+            codec = uhd::chunk_compressor::make(_compress, _compress_level);
+            comp_buffs.assign(
+                _batch_size, std::vector<char>(codec->bound(insane_mtu)));
+        }
+
+        while (not boost::this_thread::interruption_requested()) {
+            for (size_t i = 0; i < _batch_size; i++) {
+                iovs[i].iov_base = buffs[i].data();
+                iovs[i].iov_len  = insane_mtu;
+                std::memset(&msgs[i], 0, sizeof(mmsghdr));
+                msgs[i].msg_hdr.msg_iov    = &iovs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+            const int num_rx =
+                ::recvmmsg(_client_fd, msgs.data(), _batch_size, MSG_WAITFORONE, NULL);
+            if (num_rx <= 0) {
+                continue; // timeout
+            }
+
+            sockaddr_in return_addr;
+            {
+                std::lock_guard<std::mutex> lock(_endpoint_mutex);
+                if (not _have_return_addr) {
+                    continue; // nothing has talked to us yet: drop
+                }
+                return_addr = _return_addr;
+            }
+
+            uint64_t num_bytes = 0;
+            for (int i = 0; i < num_rx; i++) {
+                iovs[i].iov_len = msgs[i].msg_len;
+                if (codec) {
+                    iovs[i].iov_len  = codec->compress(comp_buffs[i].data(),
+                        comp_buffs[i].size(),
+                        buffs[i].data(),
+                        msgs[i].msg_len);
+                    iovs[i].iov_base = comp_buffs[i].data();
+                }
+                msgs[i].msg_hdr.msg_name    = &dsts[i];
+                msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                dsts[i]                     = return_addr;
+                num_bytes += iovs[i].iov_len;
+            }
+            int num_sent = 0;
+            while (num_sent < num_rx) {
+                const int ret =
+                    ::sendmmsg(_server_fds[0], &msgs[num_sent], num_rx - num_sent, 0);
+                if (ret <= 0) {
+                    break;
+                }
+                num_sent += ret;
+            }
+
+            std::lock_guard<std::mutex> lock(_counter_mutex);
+            _return_packets += num_rx;
+            _return_bytes += num_bytes;
+        }
+    }
+#endif /* __linux__ */
+
     const std::string _port;
+    const std::string _compress;
+    const int _compress_level;
     boost::thread_group _thread_group;
     asio::io_context _io_context;
     asio::ip::udp::endpoint _endpoint;
+    asio::ip::udp::endpoint _server_endpoint, _client_endpoint;
     std::mutex _endpoint_mutex;
     socket_type _server_socket, _client_socket;
     std::mutex spawn_mutex;
     boost::condition wait_for_thread;
+
+#ifdef __linux__
+    const size_t _batch_size;
+    std::vector<int> _server_fds;
+    int _client_fd = -1;
+    sockaddr_in _return_addr;
+    bool _have_return_addr = false;
+    std::mutex _counter_mutex;
+    std::map<std::pair<uint32_t, uint16_t>, flow_counters_type> _flows;
+    uint64_t _return_packets = 0;
+    uint64_t _return_bytes   = 0;
+#endif
 };
 
 
@@ -190,6 +474,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     // variables to be set by po
     std::string addr;
     std::string bind;
+    size_t workers;
+    size_t batch;
+    std::string compress;
+    int compress_level;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -198,6 +486,11 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("help", "help message")
         ("addr", po::value<std::string>(&addr), "the resolvable address of the usrp (must be specified)")
         ("bind", po::value<std::string>(&bind)->default_value("0.0.0.0"), "bind the server to this network address (default: any)")
+        ("workers", po::value<size_t>(&workers)->default_value(0), "number of SO_REUSEPORT worker threads per relay port (Linux only, 0 = classic single-packet relay)")
+        ("batch", po::value<size_t>(&batch)->default_value(64), "datagrams per recvmmsg/sendmmsg batch in worker mode")
+        ("stats", "print per-flow forwarding counters every second (worker mode)")
+        ("compress", po::value<std::string>(&compress)->default_value(""), "compress the device-to-app direction of the rx dsp ports on the fly (lz4 or zstd); the receiving end must unwrap the frames")
+        ("compress-level", po::value<int>(&compress_level)->default_value(0), "compression level (0 = codec default)")
     ;
     // clang-format on
     po::variables_map vm;
@@ -215,21 +508,53 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+#ifndef __linux__
+    if (workers > 0) {
+        std::cout << "--workers is only supported on Linux, using the classic relay"
+                  << std::endl;
+        workers = 0;
+    }
+#endif
+
+    if (not compress.empty()) {
+        // Fail early (and in the main thread) if the codec is not compiled in
+        try {
+            uhd::chunk_compressor::make(compress, compress_level);
+        } catch (const uhd::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
     {
-        std::shared_ptr<udp_relay_type> ctrl(new udp_relay_type(bind, addr, "49152"));
-        std::shared_ptr<udp_relay_type> rxdsp0(new udp_relay_type(
-            bind, addr, "49156", 0, tx_dsp_buff_size, rx_dsp_buff_size, 0));
-        std::shared_ptr<udp_relay_type> txdsp0(new udp_relay_type(
-            bind, addr, "49157", tx_dsp_buff_size, 0, 0, tx_dsp_buff_size));
-        std::shared_ptr<udp_relay_type> rxdsp1(new udp_relay_type(
-            bind, addr, "49158", 0, tx_dsp_buff_size, rx_dsp_buff_size, 0));
-        std::shared_ptr<udp_relay_type> gps(new udp_relay_type(bind, addr, "49172"));
+        // Only the rx dsp ports carry the sample stream worth compressing;
+        // the control and gps ports are forwarded untouched
+        std::shared_ptr<udp_relay_type> ctrl(
+            new udp_relay_type(bind, addr, "49152", 0, 0, 0, 0, workers, batch));
+        std::shared_ptr<udp_relay_type> rxdsp0(new udp_relay_type(bind, addr, "49156",
+            0, tx_dsp_buff_size, rx_dsp_buff_size, 0, workers, batch, compress,
+            compress_level));
+        std::shared_ptr<udp_relay_type> txdsp0(new udp_relay_type(bind, addr, "49157",
+            tx_dsp_buff_size, 0, 0, tx_dsp_buff_size, workers, batch));
+        std::shared_ptr<udp_relay_type> rxdsp1(new udp_relay_type(bind, addr, "49158",
+            0, tx_dsp_buff_size, rx_dsp_buff_size, 0, workers, batch, compress,
+            compress_level));
+        std::shared_ptr<udp_relay_type> gps(
+            new udp_relay_type(bind, addr, "49172", 0, 0, 0, 0, workers, batch));
 
         std::signal(SIGINT, &sig_int_handler);
         std::cout << "Press Ctrl + C to stop streaming..." << std::endl;
 
+        const bool print_stats = workers > 0 and vm.count("stats") > 0;
         while (not stop_signal_called) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            if (print_stats) {
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+                for (const auto& relay : {ctrl, rxdsp0, txdsp0, rxdsp1, gps}) {
+                    relay->print_flow_counters();
+                }
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
         }
     }
 
@@ -18,9 +18,13 @@
 #include <uhd/utils/safe_main.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <csignal>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <thread>
 
 namespace po = boost::program_options;
@@ -36,13 +40,71 @@ void sig_int_handler(int)
     stop_signal_called = true;
 }
 
+/****************************************************************************
+ * Self-test measurements
+ ***************************************************************************/
+struct control_latency_result_t
+{
+    double avg_us;
+    double min_us;
+    double max_us;
+};
+
+// Measure the round-trip time of a control transaction by timing repeated
+// reads of the radio's timekeeper register
+control_latency_result_t measure_control_latency(
+    radio_control::sptr radio, const size_t iterations)
+{
+    using namespace std::chrono;
+    control_latency_result_t result{0.0, 1e9, 0.0};
+    for (size_t i = 0; i < iterations; i++) {
+        const auto start = steady_clock::now();
+        radio->get_time_now();
+        const double elapsed_us =
+            duration<double, std::micro>(steady_clock::now() - start).count();
+        result.avg_us += elapsed_us;
+        result.min_us = std::min(result.min_us, elapsed_us);
+        result.max_us = std::max(result.max_us, elapsed_us);
+    }
+    result.avg_us /= iterations;
+    return result;
+}
+
+struct timed_command_result_t
+{
+    double avg_us;
+    double max_us;
+};
+
+// Measure how accurately the radio's command queue releases timed commands.
+// A read scheduled with a command time executes on the radio when the
+// timekeeper reaches that time, so the difference between the returned
+// timestamp and the scheduled time is the command release error.
+timed_command_result_t measure_timed_command_accuracy(
+    radio_control::sptr radio, const size_t chan, const size_t iterations)
+{
+    static const double COMMAND_LEAD_TIME = 0.05; // seconds
+    timed_command_result_t result{0.0, 0.0};
+    for (size_t i = 0; i < iterations; i++) {
+        const uhd::time_spec_t target = radio->get_time_now() + COMMAND_LEAD_TIME;
+        radio->set_command_time(target, chan);
+        const uhd::time_spec_t actual = radio->get_time_now();
+        radio->clear_command_time(chan);
+        const double error_us = std::abs((actual - target).get_real_secs()) * 1e6;
+        result.avg_us += error_us;
+        result.max_us = std::max(result.max_us, error_us);
+    }
+    result.avg_us /= iterations;
+    return result;
+}
+
 /****************************************************************************
  * main
  ***************************************************************************/
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
-    std::string args, rx_ant, tx_ant, rx_blockid, tx_blockid, ref, pps;
+    std::string args, rx_ant, tx_ant, rx_blockid, tx_blockid, ref, pps, report_file;
     size_t total_num_samps, spp, rx_chan, tx_chan;
     double rate, rx_freq, tx_freq, rx_gain, tx_gain, rx_bw, tx_bw, total_time, setup_time;
     bool rx_timestamps;
@@ -74,6 +136,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("int-n", "Tune USRP with integer-N tuning")
         ("ref", po::value<std::string>(&ref), "clock reference (internal, external, gpsdo, mimo)")
         ("pps", po::value<std::string>(&pps), "PPS source (internal, external, mimo, gpsdo)")
+        ("self-test", "Run a quantitative loopback self-test and emit a machine-readable report")
+        ("report-file", po::value<std::string>(&report_file)->default_value(""), "Also write the self-test report to this file")
     ;
     // clang-format on
     po::variables_map vm;
@@ -86,6 +150,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         std::cout
             << std::endl
             << "This application streams data from one radio to another using RFNoC.\n"
+            << "With --self-test, it measures sustained loopback rate, control\n"
+            << "latency and timed-command accuracy and emits a machine-readable\n"
+            << "report suitable for device qualification.\n"
             << std::endl;
         return ~0;
     }
@@ -253,6 +320,119 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     // Arm SIGINT handler
     std::signal(SIGINT, &sig_int_handler);
 
+    /************************************************************************
+     * Self-test mode
+     ***********************************************************************/
+    if (vm.count("self-test")) {
+        using namespace std::chrono;
+        static const size_t LATENCY_ITERATIONS = 100;
+        static const size_t TIMED_CMD_ITERATIONS = 20;
+        // Pass/fail thresholds: the device clock must track the host clock to
+        // within 500 ppm over the test duration (i.e., the radio never
+        // stalled), and timed commands must release within 100 us of their
+        // scheduled time.
+        static const double CLOCK_RATIO_TOLERANCE    = 500e-6;
+        static const double TIMED_CMD_TOLERANCE_US   = 100.0;
+        const double test_duration = (total_time > 0.0) ? total_time : 10.0;
+
+        std::cout << "Running radio loopback self-test..." << std::endl;
+        const bool single_radio = rx_radio_ctrl_id == tx_radio_ctrl_id;
+
+        // Control latency and timed-command accuracy, per radio block
+        const control_latency_result_t rx_latency =
+            measure_control_latency(rx_radio_ctrl, LATENCY_ITERATIONS);
+        const control_latency_result_t tx_latency =
+            single_radio ? rx_latency
+                         : measure_control_latency(tx_radio_ctrl, LATENCY_ITERATIONS);
+        const timed_command_result_t rx_timed =
+            measure_timed_command_accuracy(rx_radio_ctrl, rx_chan, TIMED_CMD_ITERATIONS);
+        const timed_command_result_t tx_timed =
+            single_radio ? rx_timed
+                         : measure_timed_command_accuracy(
+                             tx_radio_ctrl, tx_chan, TIMED_CMD_ITERATIONS);
+
+        // Sustained loopback rate: stream RX->TX for the test duration and
+        // compare the radio timekeeper against the host clock. A radio that
+        // overruns or seizes stops advancing at the tick rate, which shows up
+        // as a clock ratio error.
+        uhd::stream_cmd_t start_cmd(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+        start_cmd.stream_now = false;
+        start_cmd.time_spec  = rx_radio_ctrl->get_time_now() + setup_time;
+        rx_radio_ctrl->issue_stream_cmd(start_cmd, rx_chan);
+        std::this_thread::sleep_for(1s * setup_time);
+
+        const auto host_start                = steady_clock::now();
+        const uhd::time_spec_t device_start  = rx_radio_ctrl->get_time_now();
+        while (not stop_signal_called
+               and duration<double>(steady_clock::now() - host_start).count()
+                       < test_duration) {
+            std::this_thread::sleep_for(100ms);
+        }
+        const uhd::time_spec_t device_stop = rx_radio_ctrl->get_time_now();
+        const double host_elapsed =
+            duration<double>(steady_clock::now() - host_start).count();
+
+        uhd::stream_cmd_t stop_cmd(uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
+        rx_radio_ctrl->issue_stream_cmd(stop_cmd, rx_chan);
+        std::this_thread::sleep_for(100ms);
+
+        const double device_elapsed = (device_stop - device_start).get_real_secs();
+        const double clock_ratio    = device_elapsed / host_elapsed;
+        const double sustained_rate = rate * clock_ratio;
+
+        const bool pass = std::abs(clock_ratio - 1.0) < CLOCK_RATIO_TOLERANCE
+                          and rx_timed.avg_us < TIMED_CMD_TOLERANCE_US
+                          and tx_timed.avg_us < TIMED_CMD_TOLERANCE_US;
+
+        // Emit the report as key=value pairs between well-known markers so
+        // that burn-in scripts can parse it from the console output
+        std::ostringstream report;
+        report << "self-test-report-begin" << std::endl
+               << "rx_radio=" << rx_radio_ctrl_id << std::endl
+               << "tx_radio=" << tx_radio_ctrl_id << std::endl
+               << boost::format("rate_sps=%f") % rate << std::endl
+               << boost::format("test_duration_s=%f") % test_duration << std::endl
+               << boost::format("rx_control_latency_avg_us=%.3f") % rx_latency.avg_us
+               << std::endl
+               << boost::format("rx_control_latency_min_us=%.3f") % rx_latency.min_us
+               << std::endl
+               << boost::format("rx_control_latency_max_us=%.3f") % rx_latency.max_us
+               << std::endl
+               << boost::format("tx_control_latency_avg_us=%.3f") % tx_latency.avg_us
+               << std::endl
+               << boost::format("tx_control_latency_min_us=%.3f") % tx_latency.min_us
+               << std::endl
+               << boost::format("tx_control_latency_max_us=%.3f") % tx_latency.max_us
+               << std::endl
+               << boost::format("rx_timed_command_error_avg_us=%.3f") % rx_timed.avg_us
+               << std::endl
+               << boost::format("rx_timed_command_error_max_us=%.3f") % rx_timed.max_us
+               << std::endl
+               << boost::format("tx_timed_command_error_avg_us=%.3f") % tx_timed.avg_us
+               << std::endl
+               << boost::format("tx_timed_command_error_max_us=%.3f") % tx_timed.max_us
+               << std::endl
+               << boost::format("loopback_host_elapsed_s=%.6f") % host_elapsed
+               << std::endl
+               << boost::format("loopback_device_elapsed_s=%.6f") % device_elapsed
+               << std::endl
+               << boost::format("loopback_clock_ratio=%.9f") % clock_ratio << std::endl
+               << boost::format("loopback_sustained_rate_sps=%f") % sustained_rate
+               << std::endl
+               << "self_test_result=" << (pass ? "pass" : "fail") << std::endl
+               << "self-test-report-end" << std::endl;
+        std::cout << report.str();
+        if (not report_file.empty()) {
+            std::ofstream out(report_file, std::ios::trunc);
+            if (out) {
+                out << report.str();
+            } else {
+                std::cerr << "Could not open report file: " << report_file << std::endl;
+            }
+        }
+        return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     // Calculate timeout and set timers
     // We just need to check is nsamps was set, otherwise we'll use the duration
     if (total_num_samps > 0) {
@@ -9,6 +9,8 @@
 #include <uhd/exception.hpp>
 #include <uhd/types/tune_request.hpp>
 #include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/utils/compression.hpp>
+#include <uhd/utils/disk_writer.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
@@ -148,9 +150,13 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     bool null                        = false,
     bool enable_size_map             = false,
     bool continue_on_bad_packet      = false,
-    const std::string& thread_prefix = "")
+    const std::string& thread_prefix = "",
+    bool direct_io                   = false,
+    const std::string& compress      = "",
+    int compress_level               = 0)
 {
     unsigned long long num_total_samps = 0;
+    unsigned long long num_overflows   = 0;
     // create a receive streamer
     uhd::stream_args_t stream_args(cpu_format, wire_format);
     stream_args.channels             = channel_nums;
@@ -174,6 +180,7 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     }
 
     std::vector<std::ofstream> outfiles(rx_stream->get_num_channels());
+    std::vector<uhd::disk_writer::sptr> writers(rx_stream->get_num_channels());
     std::string filename;
     for (size_t ch = 0; ch < rx_stream->get_num_channels(); ch++) {
         if (not null) {
@@ -191,7 +198,26 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
                     filename = file + "_" + "ch" + std::to_string(channel_nums[ch]);
                 }
             }
-            outfiles[ch].open(filename.c_str(), std::ofstream::binary);
+            if (direct_io or not compress.empty()) {
+                // Ring-buffered writer: keeps disk I/O (and compression)
+                // off the receive thread
+                uhd::disk_writer::config_t writer_config;
+                writer_config.path = filename;
+                if (compress.empty()) {
+                    writer_config.preallocate_bytes =
+                        num_requested_samples * sizeof(samp_type);
+                } else {
+                    // Compressed size is unknown up front, so skip the
+                    // extent preallocation; name the file so the standard
+                    // tools pick the right codec
+                    writer_config.compression       = compress;
+                    writer_config.compression_level = compress_level;
+                    writer_config.path += (compress == "lz4") ? ".lz4" : ".zst";
+                }
+                writers[ch] = uhd::disk_writer::make(writer_config);
+            } else {
+                outfiles[ch].open(filename.c_str(), std::ofstream::binary);
+            }
         }
     }
 
@@ -229,6 +255,7 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
             break;
         }
         if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) {
+            num_overflows++;
             const std::lock_guard<std::mutex> lock(recv_mutex);
             if (overflow_message) {
                 overflow_message = false;
@@ -265,7 +292,9 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
         num_total_samps += num_rx_samps;
 
         for (size_t ch = 0; ch < rx_stream->get_num_channels(); ch++) {
-            if (outfiles[ch].is_open()) {
+            if (writers[ch]) {
+                writers[ch]->write(buffs[ch], num_rx_samps * sizeof(samp_type));
+            } else if (outfiles[ch].is_open()) {
                 outfiles[ch].write(
                     (const char*)buffs[ch], num_rx_samps * sizeof(samp_type));
             }
@@ -293,6 +322,19 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
         }
     }
 
+    unsigned long long bytes_dropped = 0;
+    for (size_t i = 0; i < writers.size(); i++) {
+        if (writers[i]) {
+            try {
+                writers[i]->close();
+            } catch (const uhd::exception& e) {
+                const std::lock_guard<std::mutex> lock(recv_mutex);
+                std::cerr << thread_prefix << e.what() << std::endl;
+            }
+            bytes_dropped += writers[i]->get_bytes_dropped();
+        }
+    }
+
     for (size_t i = 0; i < rx_stream->get_num_channels(); i++) {
         delete[] buffs[i];
     }
@@ -307,6 +349,13 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
                          % num_total_samps % actual_duration_seconds
                   << std::endl;
 
+        if (direct_io) {
+            std::cout << boost::format("%s%d overflows, %d samples dropped at the disk")
+                             % thread_prefix % num_overflows
+                             % (bytes_dropped / sizeof(samp_type))
+                      << std::endl;
+        }
+
         if (enable_size_map) {
             std::cout << std::endl;
             std::cout << "Packet size map (bytes: count)" << std::endl;
@@ -362,8 +411,9 @@ bool check_locked_sensor(std::vector<std::string> sensor_names,
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
-    std::string args, file, type, ant, subdev, ref, wirefmt, channels;
+    std::string args, file, type, ant, subdev, ref, wirefmt, channels, compress;
     size_t total_num_samps, spb;
+    int compress_level;
     double rate, freq, gain, bw, total_time, setup_time, lo_offset;
 
     std::vector<std::thread> threads;
@@ -397,6 +447,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("stats", "show average bandwidth on exit")
         ("sizemap", "track packet size and display breakdown on exit. Use with multi_streamer option if CPU limits stream rate.")
         ("null", "run without writing to file")
+        ("dio", "write through the O_DIRECT ring-buffered disk writer (recommended for NVMe-rate captures)")
+        ("compress", po::value<std::string>(&compress)->default_value(""), "compress the capture on the fly (lz4 or zstd); output gets a .lz4/.zst suffix and decodes with the matching tool")
+        ("compress-level", po::value<int>(&compress_level)->default_value(0), "compression level (0 = codec default)")
         ("continue", "don't abort on a bad packet")
         ("skip-lo", "skip checking LO lock status")
         ("int-n", "tune USRP with integer-N tuning")
@@ -423,6 +476,17 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     bool enable_size_map        = vm.count("sizemap") > 0;
     bool continue_on_bad_packet = vm.count("continue") > 0;
     bool multithread            = vm.count("multi_streamer") > 0;
+    bool direct_io              = vm.count("dio") > 0;
+
+    if (not compress.empty()) {
+        // Fail early (and in the main thread) if the codec is not compiled in
+        try {
+            uhd::chunk_compressor::make(compress, compress_level);
+        } catch (const uhd::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return ~0;
+        }
+    }
 
     if (enable_size_map)
         std::cout << "Packet size tracking enabled - will only recv one packet at a time!"
@@ -591,7 +655,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         null,                                                                        \
         enable_size_map,                                                             \
         continue_on_bad_packet,                                                      \
-        th_prefix)
+        th_prefix,                                                                   \
+        direct_io,                                                                   \
+        compress,                                                                    \
+        compress_level)
 
     for (size_t i = 0; i < channel_list.size(); i++) {
         std::string th_prefix = "";
@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uhd { namespace convert {
 
@@ -30,6 +31,11 @@ public:
     //! Set the scale factor (used in floating point conversions)
     virtual void set_scalar(const double) = 0;
 
+    //! Hint that the output buffers will not be read back soon (e.g. a huge
+    // capture ring written to disk). Converters that can may then bypass the
+    // cache with non-temporal stores. Ignored by default.
+    virtual void set_nt_stores(const bool) {}
+
     //! The public conversion method to convert inputs -> outputs
     UHD_INLINE void conv(const input_type& in, const output_type& out, const size_t num)
     {
@@ -90,6 +96,37 @@ UHD_API void register_converter(
  */
 UHD_API function_type get_converter(const id_type& id, const priority_type prio = -1);
 
+/*!
+ * Get all conversion IDs currently in the registry.
+ * \return a vector of registered conversion IDs
+ */
+UHD_API std::vector<id_type> get_ids(void);
+
+/*!
+ * Get all priorities registered for a conversion ID.
+ * \param id identify the conversion
+ * \return a vector of registered priorities, unsorted
+ */
+UHD_API std::vector<priority_type> get_priorities(const id_type& id);
+
+/*!
+ * Get a converter that runs the conversion on multiple threads.
+ *
+ * The returned converter wraps the registered converter for \p id and
+ * splits large buffers into cache-line-aligned chunks that are converted
+ * in parallel on a pool of worker threads. Buffers too small to benefit
+ * are converted inline on the calling thread. With num_threads < 2 this
+ * is identical to instantiating the registered converter directly.
+ *
+ * \param id identify the conversion
+ * \param num_threads total number of threads to convert with, including
+ *                    the calling thread
+ * \param prio the desired prio or -1 for best
+ * \return a new converter object
+ */
+UHD_API converter::sptr get_parallel_converter(
+    const id_type& id, const size_t num_threads, const priority_type prio = -1);
+
 /*!
  * Register the size of a particular item.
  * \param format the item format
@@ -0,0 +1,72 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/features/discoverable_feature.hpp>
+#include <stddef.h>
+
+namespace uhd { namespace features {
+
+/*! Interface to query the state of a block's command queue.
+ *
+ * RFNoC blocks execute register writes (including timed tunes) from a
+ * command FIFO of limited depth. The host tracks the occupancy of that FIFO
+ * through control-plane flow control and blocks further writes while it is
+ * full, so queueing more timed commands than fit does not overflow the FIFO
+ * -- but without visibility into the occupancy, a scheduler cannot tell how
+ * close it is to that stall, and a stalled write eventually fails with a
+ * timeout.
+ *
+ * This feature exposes the host-side view of the FIFO occupancy (reading it
+ * requires no control transaction) and lets the user trade the default
+ * fail-fast behavior for backpressure by extending the time a write may
+ * block while waiting for FIFO space.
+ */
+class UHD_API cmd_queue_status_iface : public discoverable_feature
+{
+public:
+    using sptr = std::shared_ptr<cmd_queue_status_iface>;
+
+    static discoverable_feature::feature_id_t get_feature_id()
+    {
+        return discoverable_feature::CMD_QUEUE_STATUS;
+    }
+
+    std::string get_feature_name() const
+    {
+        return "Command Queue Status";
+    }
+
+    virtual ~cmd_queue_status_iface() = default;
+
+    /*! Get the current occupancy of the block's command FIFO in 32-bit words.
+     *
+     * This is the number of words that have been sent to the block but not
+     * yet acknowledged as consumed. Note that timed commands occupy the FIFO
+     * until their execution time has passed.
+     */
+    virtual size_t get_cmd_queue_occupancy() = 0;
+
+    /*! Get the total capacity of the block's command FIFO in 32-bit words
+     */
+    virtual size_t get_cmd_queue_capacity() = 0;
+
+    /*! Set the time a register write may block while waiting for FIFO space.
+     *
+     * With the default timeout, a write into a full command FIFO fails with
+     * uhd::op_timeout after one second. Setting a larger value here turns a
+     * full FIFO into backpressure instead: the caller blocks until earlier
+     * commands have drained. This allows keeping a long schedule of timed
+     * commands in flight by letting the enqueuing thread pace itself off the
+     * FIFO.
+     *
+     * \param timeout The time, in seconds, to wait for FIFO space
+     */
+    virtual void set_enqueue_timeout(const double timeout) = 0;
+};
+
+}} // namespace uhd::features
@@ -8,6 +8,7 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/features/discoverable_feature.hpp>
+#include <memory>
 #include <vector>
 
 namespace uhd { namespace features {
@@ -29,13 +30,27 @@ public:
     template <typename T>
     T& get_feature()
     {
-        auto p = get_feature_ptr(T::get_feature_id());
-        UHD_ASSERT_THROW(p);
-        auto typed_p = dynamic_cast<T*>(p.get());
+        auto typed_p = get_feature_sptr<T>();
         UHD_ASSERT_THROW(typed_p);
         return *typed_p;
     }
 
+    //! Retrieves a typed handle to a feature of the specified type.
+    //
+    // Returns nullptr if the given feature type does not exist. Features are
+    // registered once at device initialization and never removed, so the
+    // returned handle remains valid for the lifetime of the device. Callers
+    // that access a feature in a loop should retrieve the handle once and
+    // dereference it per iteration rather than calling get_feature() each
+    // time, which repeats the lookup and cast.
+    // Usage:
+    // auto feature = radio.get_feature_sptr<desired_feature_class>();
+    template <typename T>
+    std::shared_ptr<T> get_feature_sptr()
+    {
+        return std::dynamic_pointer_cast<T>(get_feature_ptr(T::get_feature_id()));
+    }
+
     //! Determines whether a given feature exists
     //
     // This function should be used to gate functionality before calling
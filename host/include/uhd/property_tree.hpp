@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace uhd {
@@ -215,6 +216,54 @@ struct UHD_API_HEADER fs_path : std::string
 UHD_API fs_path operator/(const fs_path&, const fs_path&);
 UHD_API fs_path operator/(const fs_path&, size_t);
 
+/*!
+ * Interned property path handle.
+ *
+ * A handle is created from a path once via property_tree::intern(), and is
+ * resolved to the underlying property on its first use with
+ * property_tree::access_cached(). Subsequent accesses through the handle
+ * cost a pointer dereference instead of a string parse and tree walk, which
+ * matters for paths read at a high rate (e.g. sensor polling loops).
+ *
+ * Handles track the property, not the path: if the property is popped or
+ * removed, the handle expires and the next access_cached() call resolves
+ * the path again (throwing uhd::lookup_error if it no longer exists).
+ */
+class UHD_API_HEADER path_handle
+{
+public:
+    path_handle(void) {}
+
+private:
+    friend class property_tree;
+
+    path_handle(const fs_path& path) : _path(path) {}
+
+    //! Full path, kept for (re-)resolution and error messages
+    fs_path _path;
+    //! The resolved property; expires when the property is popped or removed
+    std::weak_ptr<property_iface> _prop;
+    //! Type of the cached typed pointer below
+    const std::type_info* _type = nullptr;
+    //! Cached result of the cast to property<T>, valid while _prop is alive
+    void* _typed = nullptr;
+};
+
+//! \cond
+namespace prop_detail {
+// Internal machinery for coalesced subscriber notification, used by the
+// property implementation in property_tree.ipp. See
+// property_tree::begin_update() for the user-facing API.
+
+//! True if the calling thread is inside an update transaction
+UHD_API bool in_update_transaction(void);
+
+//! Queue a notification, replacing a pending one for the same subscriber
+UHD_API void defer_notification(
+    const void* subscriber_id, std::function<void(void)> notify);
+} // namespace prop_detail
+//! \endcond
+
 /*!
  * The property tree provides a file system structure for accessing properties.
  */
@@ -250,6 +299,47 @@ public:
     template <typename T>
     property<T>& access(const fs_path& path);
 
+    //! Intern a path for repeated access via access_cached()
+    path_handle intern(const fs_path& path) const
+    {
+        return path_handle(path);
+    }
+
+    /*! Get access to a property through an interned path handle
+     *
+     * Resolves the path on the first call (or after the property was popped
+     * or removed) and caches the result in the handle, so repeated accesses
+     * avoid the string parse and tree walk of access(). The handle must only
+     * be used with the tree (or subtree) that interned it, and is not
+     * thread-safe: use one handle per polling thread.
+     */
+    template <typename T>
+    property<T>& access_cached(path_handle& handle);
+
+    /*! Begin coalescing subscriber notifications on this thread
+     *
+     * Between begin_update() and commit(), property set() calls on the
+     * calling thread update values and run coercers as usual, but defer the
+     * subscriber callbacks. At commit(), each affected subscriber fires
+     * exactly once with the property's final value, so a sequence of related
+     * writes (e.g. a tune) causes one notification per subscriber instead of
+     * one per write.
+     *
+     * Transactions nest: notifications fire when the outermost commit() is
+     * reached. The transaction is thread-local and spans all trees; do not
+     * pop or remove properties written inside an open transaction.
+     */
+    void begin_update(void);
+
+    /*! Fire the notifications deferred since begin_update()
+     *
+     * Subscriber exceptions propagate to the caller, in which case the
+     * remaining pending notifications are dropped.
+     *
+     * \throws uhd::runtime_error if there is no open transaction
+     */
+    void commit(void);
+
     //! Pop a property off the tree, and returns the property
     template <typename T>
     std::shared_ptr<property<T>> pop(const fs_path& path);
@@ -81,7 +81,7 @@ public:
     {
         init_or_set_value(_coerced_value, value);
         for (typename property<T>::subscriber_type& csub : _coerced_subscribers) {
-            csub(get_value_ref(_coerced_value)); // let errors propagate
+            notify(csub, get_value_ref(_coerced_value)); // let errors propagate
         }
     }
 
@@ -89,7 +89,7 @@ public:
     {
         init_or_set_value(_value, value);
         for (typename property<T>::subscriber_type& dsub : _desired_subscribers) {
-            dsub(get_value_ref(_value)); // let errors propagate
+            notify(dsub, get_value_ref(_value)); // let errors propagate
         }
         if (_coercer) {
             _set_coerced(_coercer(get_value_ref(_value)));
@@ -160,6 +160,18 @@ private:
         return *scoped_value.get();
     }
 
+    // Call the subscriber, or, inside an update transaction (see
+    // property_tree::begin_update()), queue it so it fires once at
+    // commit() with the value the property had at the last set
+    static void notify(typename property<T>::subscriber_type& sub, const T& value)
+    {
+        if (prop_detail::in_update_transaction()) {
+            prop_detail::defer_notification(&sub, [&sub, value]() { sub(value); });
+        } else {
+            sub(value);
+        }
+    }
+
     const property_tree::coerce_mode_t _coerce_mode;
     std::vector<typename property<T>::subscriber_type> _desired_subscribers;
     std::vector<typename property<T>::subscriber_type> _coerced_subscribers;
@@ -194,6 +206,28 @@ property<T>& property_tree::access(const fs_path& path)
     return *ptr;
 }
 
+template <typename T>
+property<T>& property_tree::access_cached(path_handle& handle)
+{
+    if (handle._typed != nullptr && handle._type != nullptr
+        && *handle._type == typeid(T) && !handle._prop.expired()) {
+        return *static_cast<property<T>*>(handle._typed);
+    }
+
+    // First access, property was re-created, or accessed with a new type:
+    // resolve the path and cache the result in the handle
+    auto iface = this->_access(handle._path);
+    auto ptr   = std::dynamic_pointer_cast<property<T>>(iface);
+    if (!ptr) {
+        throw uhd::type_error(
+            "Property " + handle._path + " exists, but was accessed with wrong type");
+    }
+    handle._prop  = iface;
+    handle._type  = &typeid(T);
+    handle._typed = ptr.get();
+    return *ptr;
+}
+
 template <typename T>
 typename std::shared_ptr<property<T>> property_tree::pop(const fs_path& path)
 {
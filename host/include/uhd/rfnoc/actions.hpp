@@ -65,7 +65,7 @@ public:
     //! Factory function
     static sptr make(const uhd::stream_cmd_t::stream_mode_t stream_mode);
 
-private:
+protected:
     stream_cmd_action_info(const uhd::stream_cmd_t::stream_mode_t stream_mode);
 };
 
@@ -122,7 +122,7 @@ public:
     //! Factory function
     static sptr make(const uhd::tune_request_t tune_request);
 
-private:
+protected:
     tune_request_action_info(const uhd::tune_request_t tune_request);
 };
 
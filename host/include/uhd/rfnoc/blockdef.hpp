@@ -17,6 +17,12 @@
 namespace uhd { namespace rfnoc {
 
 /*! Reads and stores block definitions for blocks and components.
+ *
+ * \note This interface dates from the XML-based block description days and
+ *       has no implementation in this codebase. Block capabilities are now
+ *       reported by the device (see uhd::rfnoc::detail::client_zero) and
+ *       block behavior is registered in code via UHD_RFNOC_BLOCK_REGISTER_*,
+ *       so no per-session XML parsing takes place.
  */
 class UHD_API blockdef : public std::enable_shared_from_this<blockdef>
 {
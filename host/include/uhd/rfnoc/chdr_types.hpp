@@ -12,7 +12,6 @@
 #include <boost/format.hpp>
 #include <boost/optional.hpp>
 #include <deque>
-#include <list>
 #include <memory>
 #include <vector>
 
@@ -775,17 +774,22 @@ public:
         return _ops.at(i);
     }
 
-    //! Serialize the payload to a uint64_t buffer
+    //! Serialize the hop into a flat word buffer, starting at \p index and
+    //  advancing it past this hop.
     //  The RFNoC Specification section 2.2.6 specifies that for chdr widths
     //  greater than 64, all MSBs are 0, so we pad out the hop based on the width
-    size_t serialize(std::vector<uint64_t>& target,
+    size_t serialize(uint64_t* target,
+        size_t& index,
         const std::function<uint64_t(uint64_t)>& conv_byte_order,
         const size_t padding_size) const;
 
-    //! Deserialize the payload from a uint64_t buffer
+    //! Deserialize the hop from a flat word buffer of \p num_words words,
+    //  starting at \p index and advancing it past this hop.
     //  The RFNoC Specification section 2.2.6 specifies that for chdr widths
     //  greater than 64, all MSBs are 0, so we remove padding based on the width
-    void deserialize(std::list<uint64_t>& src,
+    void deserialize(const uint64_t* src,
+        size_t& index,
+        const size_t num_words,
         const std::function<uint64_t(uint64_t)>& conv_byte_order,
         const size_t padding_size);
 
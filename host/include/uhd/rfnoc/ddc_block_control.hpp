@@ -10,6 +10,7 @@
 #include <uhd/rfnoc/noc_block_base.hpp>
 #include <uhd/types/ranges.hpp>
 #include <boost/optional.hpp>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -144,6 +145,21 @@ public:
      */
     virtual void issue_stream_cmd(
         const uhd::stream_cmd_t& stream_cmd, const size_t port) = 0;
+
+    /*! Issue the same stream command to multiple ports at once
+     *
+     * This is equivalent to calling the single-port issue_stream_cmd() once
+     * per entry in \p ports, but all commands are delivered upstream as a
+     * single batched graph action (one graph traversal instead of one per
+     * port). For timed commands this means every upstream radio is
+     * programmed back-to-back with the same time spec, which tightens
+     * multi-channel start alignment.
+     *
+     * \param stream_cmd The actual stream command to execute
+     * \param ports The ports for which the stream command is meant
+     */
+    virtual void issue_stream_cmd(
+        const uhd::stream_cmd_t& stream_cmd, const std::vector<size_t>& ports) = 0;
 };
 
 }} // namespace uhd::rfnoc
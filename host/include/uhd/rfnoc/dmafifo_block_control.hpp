@@ -19,6 +19,18 @@ class UHD_API dmafifo_block_control : public noc_block_base
 {
 public:
     RFNOC_DECLARE_BLOCK(dmafifo_block_control)
+
+    /*! Get the number of bytes currently buffered in DRAM for a given channel
+     *
+     * When the FIFO is used as an elasticity buffer (e.g., to absorb host
+     * scheduling stalls on RX, see the `rx_dram_buff` stream argument), this
+     * is the watermark to monitor: a fullness that keeps growing means the
+     * host is not keeping up with the radio.
+     *
+     * \param chan The channel (FIFO instance) to query
+     * \returns the current FIFO fullness in bytes
+     */
+    virtual uint64_t get_fifo_fullness(const size_t chan) = 0;
 };
 
 }} // namespace uhd::rfnoc
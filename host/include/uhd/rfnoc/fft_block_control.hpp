@@ -8,6 +8,8 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/stream.hpp>
+#include <complex>
 
 namespace uhd { namespace rfnoc {
 
@@ -148,6 +150,71 @@ public:
      * \returns Current FFT length
      */
     virtual size_t get_length() const = 0;
+
+    /**************************************************************************
+     * Spectral Capture API calls
+     *************************************************************************/
+    /*! Start a managed spectral capture
+     *
+     * Starts a background worker that continuously receives transforms from
+     * this block through \p rx_stream into a host-side ring holding the most
+     * recent \p num_spectra transforms. This amortizes the streamer setup
+     * over many pulls: create the streamer once, then read spectra out of
+     * the ring with get_spectra() at whatever rate the application needs.
+     * If the application does not keep up, the oldest transforms in the ring
+     * are silently overwritten.
+     *
+     * The \p rx_stream must be a single-channel sc16 streamer that is
+     * connected (through the graph) to the output port of this block, and it
+     * must stay alive until stop_capture() is called. Starting the flow of
+     * data into this block (e.g., issuing a stream command to an upstream
+     * radio) remains the responsibility of the caller.
+     *
+     * The FFT length must not be changed while a capture is running.
+     *
+     * \param rx_stream The RX streamer connected to this block's output port
+     * \param num_spectra Number of transforms held in the host-side ring
+     * \throws uhd::value_error if the streamer or ring size are invalid.
+     * \throws uhd::runtime_error if a capture is already running.
+     */
+    virtual void start_capture(
+        uhd::rx_streamer::sptr rx_stream, const size_t num_spectra = 256) = 0;
+
+    /*! Stop a running spectral capture
+     *
+     * Stops the background worker and releases the streamer reference. This
+     * is a no-op if no capture is running.
+     */
+    virtual void stop_capture() = 0;
+
+    /*! Pull the most recent transforms from the capture ring
+     *
+     * Copies up to \p num_spectra of the most recently captured transforms
+     * into \p buff, oldest first. \p buff must hold at least \p num_spectra
+     * times get_length() sc16 samples. If fewer than \p num_spectra
+     * transforms have been captured when this is called, this call blocks
+     * for up to \p timeout seconds for the ring to fill up, and then returns
+     * whatever is available.
+     *
+     * \param buff Buffer to copy the transforms into
+     * \param num_spectra Number of transforms requested
+     * \param timeout Time to wait for transforms to become available, in
+     *                seconds
+     * \returns the number of transforms copied into \p buff
+     * \throws uhd::runtime_error if no capture is running.
+     */
+    virtual size_t get_spectra(std::complex<int16_t>* buff,
+        const size_t num_spectra,
+        const double timeout = 0.1) = 0;
+
+    /*! Get the total number of transforms captured
+     *
+     * Returns the number of transforms received into the capture ring since
+     * start_capture(), including transforms that have since been overwritten.
+     *
+     * \returns the total number of captured transforms
+     */
+    virtual uint64_t get_capture_count() const = 0;
 };
 
 }} // namespace uhd::rfnoc
@@ -8,6 +8,8 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/stream.hpp>
+#include <functional>
 
 namespace uhd { namespace rfnoc {
 
@@ -379,6 +381,75 @@ public:
      * \returns The waterfall decimation factor
      */
     virtual uint16_t get_waterfall_decimation() const = 0;
+
+    /**************************************************************************
+     * Managed Capture API calls
+     *************************************************************************/
+    /*! Row-complete notification for a managed capture
+     *
+     * Invoked from the capture worker after each row has been written into
+     * the caller's ring. \p row_index is the slot in the ring that was just
+     * completed and \p row_count is the total number of rows captured so
+     * far. The callback must not block; it is intended to kick a render
+     * pass or fence a GPU upload, not to process the data inline.
+     */
+    using capture_row_cb_t = std::function<void(size_t row_index, uint64_t row_count)>;
+
+    /*! Start a managed capture into a caller-registered ring buffer
+     *
+     * Starts a background worker that receives rows of decoded display data
+     * from this block through \p rx_stream directly into \p ring_buff, which
+     * the caller owns and which may be GPU-mapped memory (e.g., a persistent
+     * pixel buffer object or CUDA host-mapped allocation). Each received row
+     * is written into slot `row_count % num_rows` at a spacing of
+     * \p row_pitch bytes, so there are no intermediate host copies between
+     * the streamer and the display memory; when the transport links were
+     * opened with the `ext_alloc` link argument, the packet buffers
+     * themselves are in externally managed memory as well.
+     *
+     * The \p rx_stream must be a single-channel streamer with a one-byte
+     * item type (the block produces u8 data) connected to either the
+     * histogram or the waterfall output port of this block, and it must stay
+     * alive until stop_capture() is called. For the waterfall port a row is
+     * one line of \p row_size bins; for the histogram port, 66 rows form one
+     * full histogram frame (see the block description above).
+     *
+     * \param rx_stream The RX streamer connected to one of this block's
+     *                  output ports
+     * \param ring_buff The caller-owned ring buffer to write rows into; must
+     *                  hold at least \p num_rows times \p row_pitch bytes and
+     *                  stay valid until stop_capture() is called
+     * \param num_rows Number of row slots in the ring
+     * \param row_size Row length in bins (one byte per bin)
+     * \param row_pitch Spacing of consecutive rows in the ring in bytes, or
+     *                  0 for tightly packed rows (\p row_size bytes)
+     * \param row_cb Optional row-complete notification
+     * \throws uhd::value_error if the streamer or ring geometry are invalid.
+     * \throws uhd::runtime_error if a capture is already running.
+     */
+    virtual void start_capture(uhd::rx_streamer::sptr rx_stream,
+        void* ring_buff,
+        const size_t num_rows,
+        const size_t row_size,
+        const size_t row_pitch       = 0,
+        capture_row_cb_t&& row_cb = nullptr) = 0;
+
+    /*! Stop a running managed capture
+     *
+     * Stops the background worker and releases the streamer reference. The
+     * caller's ring buffer is not touched after this call returns. This is
+     * a no-op if no capture is running.
+     */
+    virtual void stop_capture() = 0;
+
+    /*! Get the total number of rows captured
+     *
+     * Returns the number of rows written into the ring since
+     * start_capture(), including rows that have since been overwritten.
+     *
+     * \returns the total number of captured rows
+     */
+    virtual uint64_t get_capture_count() const = 0;
 };
 
 }} // namespace uhd::rfnoc
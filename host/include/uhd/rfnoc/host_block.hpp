@@ -0,0 +1,111 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace rfnoc {
+
+/*! Host-side software DSP stage
+ *
+ * A host block is the software counterpart of an RFNoC block: a DSP stage
+ * that runs on the host CPU instead of the FPGA. Host blocks are inserted
+ * into the streamer path with host_block_streamer, which lets a graph
+ * route radio -> host FIR/channelizer -> application when the FPGA image
+ * lacks a block, trading CPU cores for FPGA real estate without
+ * restructuring the application.
+ *
+ * Implementations operate on opaque items (samples in the streamer's CPU
+ * format); the engine never inspects the data. A host block instance
+ * processes exactly one channel, so per-channel state (e.g., FIR history)
+ * needs no locking, and process() is never called concurrently on the
+ * same instance.
+ */
+class UHD_API host_block : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<host_block>;
+
+    virtual ~host_block() = default;
+
+    /*! Upper bound on the number of output items produced for \p in_nitems
+     * input items
+     *
+     * The engine uses this to size scratch buffers and to limit how many
+     * items it pulls from the source per call, so interpolating stages
+     * (e.g., a channelizer) must override this. The bound must be
+     * monotonic in \p in_nitems. The default is rate-preserving.
+     */
+    virtual size_t get_output_bound(const size_t in_nitems) const
+    {
+        return in_nitems;
+    }
+
+    /*! Process \p in_nitems items from \p in into \p out
+     *
+     * Both buffers are 64-byte aligned so implementations can use aligned
+     * SIMD loads and stores without a scalar prologue. \p out holds at
+     * least get_output_bound(in_nitems) items. In-place operation is not
+     * supported; \p in and \p out never alias.
+     *
+     * \param in input items
+     * \param in_nitems number of input items
+     * \param out output buffer
+     * \return the number of items written to \p out
+     */
+    virtual size_t process(const void* in, const size_t in_nitems, void* out) = 0;
+};
+
+/*! Host block execution engine, presented as an RX streamer
+ *
+ * Wraps an existing RX streamer and runs a chain of host blocks over every
+ * received buffer before handing the samples to the application. Because
+ * the engine implements the rx_streamer interface itself, applications
+ * keep calling recv() unchanged; only the streamer creation site needs to
+ * know that part of the DSP happens on the host.
+ *
+ * The per-channel chains are executed on a pool of worker threads, one
+ * task per channel per recv() call, with the recv() caller chipping in, so
+ * multi-channel processing scales with cores. Samples travel between
+ * stages through 64-byte aligned scratch buffers (see host_block). recv()
+ * retains its blocking and error semantics; the metadata (including the
+ * time spec of the first sample) is passed through from the wrapped
+ * streamer.
+ */
+class UHD_API host_block_streamer : public uhd::rx_streamer
+{
+public:
+    using sptr = std::shared_ptr<host_block_streamer>;
+
+    /*! Create a host block execution engine around \p source
+     *
+     * \param source The streamer to pull samples from
+     * \param chains One chain of host blocks per channel, applied in
+     *               order. Chains may differ per channel (and may be
+     *               empty, which passes that channel through), but every
+     *               chain must produce the same number of items per call
+     *               so the channels stay aligned. Block instances must not
+     *               be shared between channels.
+     * \param item_size Bytes per item, i.e. the size of one sample in the
+     *                  streamer's CPU format
+     * \param num_threads Number of worker threads (0 processes all
+     *                    channels inline on the recv() caller)
+     * \throws uhd::value_error if the number of chains does not match the
+     *         number of channels, or \p item_size is zero
+     */
+    static sptr make(uhd::rx_streamer::sptr source,
+        std::vector<std::vector<host_block::sptr>> chains,
+        const size_t item_size,
+        const size_t num_threads = 0);
+};
+
+}} // namespace uhd::rfnoc
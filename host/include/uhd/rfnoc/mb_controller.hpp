@@ -14,10 +14,13 @@
 #include <uhd/usrp/mboard_eeprom.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <unordered_map>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -169,6 +172,55 @@ public:
             return _tick_rate;
         }
 
+        /*! Update the host/device clock model with a fresh device time reading
+         *
+         * Performs a single get_ticks_now() round trip and pairs the reading
+         * with the host clock captured at the midpoint of the call. The
+         * observation is folded into an affine model (offset and drift) of
+         * the device clock versus the host clock, which
+         * device_time_to_host_time() uses to convert timestamps without
+         * further device communication.
+         *
+         * The drift estimate improves with the baseline between the first
+         * and the most recent observation; calling this a second time a few
+         * hundred milliseconds after the first will already track typical
+         * reference drift. If the device time is reset (e.g., via
+         * set_time_now()), the model detects the discontinuity and restarts
+         * from the new reading.
+         */
+        void update_clock_model();
+
+        /*! Opportunistically update the clock model from an observed device time
+         *
+         * Callers that have just observed a fresh device timestamp (e.g.,
+         * from the metadata of a packet that arrived moments ago) can feed
+         * it here to keep the clock model current without a device round
+         * trip. The one-way transit latency of the observation biases the
+         * model offset, so readings from update_clock_model(), which
+         * brackets the round trip, are preferred when available.
+         *
+         * \param device_time The device time that was observed "now"
+         */
+        void observe_device_time(const uhd::time_spec_t& device_time);
+
+        /*! Convert a device timestamp to host wallclock time
+         *
+         * This is a multiply-add using the clock model maintained by
+         * update_clock_model() and observe_device_time(); it does not
+         * communicate with the device and is therefore cheap enough to call
+         * per received buffer. The accuracy depends on the freshness of the
+         * model and on how far \p device_time extrapolates beyond the last
+         * observation.
+         *
+         * \param device_time The device time to convert
+         * \returns the host wallclock time corresponding to \p device_time
+         * \throws uhd::runtime_error if the clock model has no observations
+         *         yet (neither update_clock_model() nor
+         *         observe_device_time() were called)
+         */
+        std::chrono::system_clock::time_point device_time_to_host_time(
+            const uhd::time_spec_t& device_time);
+
     protected:
         /*! Set the tick rate
          *
@@ -187,8 +239,28 @@ public:
         virtual void set_period(const uint64_t period_ns) = 0;
 
     private:
+        //! Fold a (host time, device time) pair into the clock model
+        void _fold_clock_observation(
+            const std::chrono::steady_clock::time_point host_time,
+            const std::chrono::system_clock::time_point system_time,
+            const double device_secs);
+
         //! Ticks/Second
         double _tick_rate = 1.0;
+
+        //! Guards the clock model state below
+        std::mutex _clock_model_mutex;
+        //! Number of observations folded into the clock model
+        size_t _clock_model_obs = 0;
+        //! First observation, used as the anchor for the drift estimate
+        std::chrono::steady_clock::time_point _host_first;
+        double _device_first = 0.0;
+        //! Most recent observation, used as the anchor for conversions
+        std::chrono::steady_clock::time_point _host_latest;
+        std::chrono::system_clock::time_point _system_latest;
+        double _device_latest = 0.0;
+        //! Device seconds elapsed per host second
+        double _clock_drift = 1.0;
     };
 
     //! Returns the number of timekeepers, which equals the number of timebases
@@ -422,6 +494,17 @@ public:
      */
     virtual std::vector<std::string> get_sensor_names() = 0;
 
+    /*! Get all motherboard sensor values in a single call
+     *
+     * The default implementation reads the sensors one at a time via
+     * get_sensor(). Implementations that can query all sensors in one
+     * round trip to the device override this, which is considerably cheaper
+     * for telemetry pollers than per-sensor reads.
+     *
+     * \return a map from sensor name to sensor value
+     */
+    virtual std::map<std::string, uhd::sensor_value_t> get_sensors();
+
     /*! Return the motherboard EEPROM data
      */
     virtual uhd::usrp::mboard_eeprom_t get_eeprom() = 0;
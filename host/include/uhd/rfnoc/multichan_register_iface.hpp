@@ -12,6 +12,7 @@
 #include <uhd/types/time_spec.hpp>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -157,6 +158,56 @@ public:
             _get_addr(first_addr, instance), data, time, ack);
     }
 
+    /*! Write the same 32-bit register across multiple block instances.
+     *
+     * Element i of \p data is written to \p addr on instance i. This is the
+     * call to use when one register has to be configured on every channel,
+     * e.g. re-tuning all DDCs of a multi-channel block.
+     *
+     * Without \p ack the writes are fire-and-forget and simply pipelined by
+     * the control transport. With \p ack, the writes are issued through
+     * poke32_async() and their futures collected after the last one was
+     * sent, so the per-channel control round trips overlap instead of
+     * serializing one blocking poke per instance.
+     *
+     * \param addr The byte address of the register to write to
+     *             (truncated to 20 bits).
+     * \param data New values of this register, one per instance.
+     * \param time The time at which the first transaction should be executed.
+     * \param ack Should transaction completion be acknowledged?
+     *
+     * \throws op_failed if an ACK is requested and a transaction fails
+     * \throws op_timeout if an ACK is requested and no response is received
+     * \throws op_seqerr if an ACK is requested and a sequence error occurs
+     * \throws op_timeerr if an ACK is requested and a time error occurs (late command)
+     */
+    inline void poke32_vector(uint32_t addr,
+        const std::vector<uint32_t>& data,
+        uhd::time_spec_t time = uhd::time_spec_t::ASAP,
+        bool ack              = false)
+    {
+        if (!ack) {
+            for (size_t instance = 0; instance < data.size(); instance++) {
+                poke32(addr,
+                    data[instance],
+                    instance,
+                    (instance == 0) ? time : uhd::time_spec_t::ASAP,
+                    false);
+            }
+            return;
+        }
+        std::vector<std::future<void>> acks;
+        acks.reserve(data.size());
+        for (size_t instance = 0; instance < data.size(); instance++) {
+            acks.push_back(_reg_iface_holder.regs().poke32_async(_get_addr(addr, instance),
+                data[instance],
+                (instance == 0) ? time : uhd::time_spec_t::ASAP));
+        }
+        for (auto& fut : acks) {
+            fut.get();
+        }
+    }
+
     /*! Read a 32-bit register implemented in the NoC block.
      *
      * \param addr The byte address of the register to read from (truncated to 20 bits).
@@ -16,6 +16,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <boost/graph/adjacency_list.hpp>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -36,9 +37,12 @@ class UHD_API node_t
 public:
     using resolver_fn_t          = std::function<void(void)>;
     using resolve_callback_t     = std::function<void(void)>;
+    using fast_prop_fn_t         = std::function<void(const double)>;
     using graph_mutex_callback_t = std::function<std::recursive_mutex&(void)>;
     using action_handler_t =
         std::function<void(const res_source_info&, action_info::sptr)>;
+    using action_batch_t = std::vector<std::pair<res_source_info, action_info::sptr>>;
+    using action_batch_handler_t = std::function<void(const action_batch_t&)>;
     using forwarding_map_t =
         std::unordered_map<res_source_info, std::vector<res_source_info>>;
 
@@ -162,6 +166,74 @@ public:
      */
     void set_properties(const uhd::device_addr_t& props, const size_t instance = 0);
 
+    /*! Opaque container for a property snapshot
+     *
+     * See snapshot_props() and restore_props().
+     */
+    using prop_snapshot_t = std::vector<std::unique_ptr<property_base_t>>;
+
+    /*! Take a snapshot of all user properties on this node
+     *
+     * The returned container holds copies of every valid user property,
+     * including their current values. It can later be passed to
+     * restore_props() to return the node to this configuration, either on
+     * this node or on another node of the same type (e.g., the same block on
+     * a different device).
+     *
+     * \returns A snapshot of this node's user properties
+     */
+    prop_snapshot_t snapshot_props();
+
+    /*! Restore the user properties from a snapshot
+     *
+     * This is the counterpart to snapshot_props(). Properties whose current
+     * value already matches the snapshot are left untouched. All differing
+     * properties are updated back-to-back, and like set_properties(), a
+     * single property resolution runs after all values have been written, so
+     * restoring a full block configuration costs one resolution pass instead
+     * of one per property.
+     *
+     * If a property in the snapshot does not exist on this node, a warning is
+     * logged, but no error is raised.
+     *
+     * \param snapshot A snapshot previously taken with snapshot_props()
+     */
+    void restore_props(const prop_snapshot_t& snapshot);
+
+    /*! Update a fast property without serializing on the graph mutex
+     *
+     * Fast properties are numeric properties without topology side effects
+     * (e.g., a gain value) that the block registered through the fast-property
+     * overload of register_property(). Unlike set_property(), this call does
+     * not take the graph mutex and does not trigger a property resolution:
+     * The new value is stored atomically and handed to the apply-callback the
+     * block registered, so frequent scalar updates (e.g., a software AGC
+     * loop) never contend with streamer state changes. The regular property
+     * registry is reconciled with the fast value the next time a property
+     * resolution runs, so get_property() and dependent properties catch up
+     * then.
+     *
+     * \param id The identifier of the fast property to write
+     * \param val The new value of the property
+     * \param instance The instance number of this property
+     * \throws uhd::lookup_error if no fast property with this ID and instance
+     *         was registered
+     */
+    void set_fast_property(
+        const std::string& id, const double val, const size_t instance = 0);
+
+    /*! Read back a fast property without serializing on the graph mutex
+     *
+     * Returns the last value written through set_fast_property() or, if a
+     * property resolution ran since, the value of the backing property.
+     *
+     * \param id The identifier of the fast property to read
+     * \param instance The instance number of this property
+     * \throws uhd::lookup_error if no fast property with this ID and instance
+     *         was registered
+     */
+    double get_fast_property(const std::string& id, const size_t instance = 0) const;
+
     /*! Get the value of a specific block argument. \p The type of an argument
      *  must be known at compile time.
      *
@@ -242,6 +314,34 @@ protected:
     void register_property(
         property_base_t* prop, resolve_callback_t&& clean_callback = nullptr);
 
+    /*! Register a fast property for this block
+     *
+     * This registers \p prop like register_property() does, and additionally
+     * makes it writable through the lock-free set_fast_property() path. Only
+     * numeric properties without topology side effects should be registered
+     * this way: Any graph-wide effect of the property (resolvers, edge
+     * propagation) still only happens during a regular property resolution.
+     *
+     * Like register_property(), this is typically called from the
+     * constructor. The fast-property table is not write-protected against
+     * concurrent set_fast_property() calls, so registering fast properties
+     * after construction requires external serialization.
+     *
+     * \param prop A reference to the property
+     * \param apply_fn A callback that is invoked with the new value on every
+     *                 set_fast_property() call. It runs on the caller's
+     *                 thread without the graph mutex held, so it must be
+     *                 thread-safe on its own (e.g., a register write).
+     * \param clean_callback A callback that gets executed whenever this
+     *                       property is dirty and gets marked clean
+     *
+     * \throws uhd::key_error if another property with the same ID and source
+     *         type is already registered
+     */
+    void register_property(property_t<double>* prop,
+        fast_prop_fn_t&& apply_fn,
+        resolve_callback_t&& clean_callback = nullptr);
+
     /*! Add a resolver function to this block.
      *
      * A resolver function is used to reconcile state changes in the block, and
@@ -434,6 +534,22 @@ protected:
      */
     void post_action(const res_source_info& edge_info, action_info::sptr action);
 
+    /*! Post a batch of actions to up- or downstream nodes in the graph.
+     *
+     * This is equivalent to calling post_action() for every (edge, action)
+     * pair in \p actions, but the graph is locked only once and all actions
+     * are delivered in a single traversal. Use this for fan-out operations
+     * such as issuing a stream command to many channels, where per-action
+     * serialization on the graph mutex is measurable.
+     *
+     * Like with post_action(), actions posted to unconnected edges are lost.
+     *
+     * \param actions The (edge, action) pairs to post, in delivery order
+     * \throws uhd::runtime_error if any edge info is not either INPUT_EDGE or
+     *         OUTPUT_EDGE
+     */
+    void post_actions(const action_batch_t& actions);
+
     /**************************************************************************
      * Graph Interaction
      *************************************************************************/
@@ -571,6 +687,23 @@ private:
      */
     void clean_props();
 
+    /*! Synchronize the property registry with the fast-property shadow values
+     *
+     * This runs at the start of every local property resolution, i.e., with
+     * the graph serialized by the caller. Fast values written since the last
+     * resolution are copied into their backing properties (making them dirty,
+     * so dependent properties resolve); otherwise, the shadow value is
+     * refreshed from the backing property so that slow-path updates become
+     * visible to get_fast_property().
+     */
+    void _reconcile_fast_props();
+
+    //! Key into the fast-property table
+    static std::string _fast_prop_key(const std::string& id, const size_t instance)
+    {
+        return id + ":" + std::to_string(instance);
+    }
+
     /*! Sets a callback that the framework can call when it needs to trigger a
      * property resolution.
      */
@@ -650,6 +783,15 @@ private:
         _post_action_cb = std::move(post_handler);
     }
 
+    /*! Sets a callback that this node can call to post a batch of actions in
+     * a single graph traversal. When unset (nullptr), post_actions() falls
+     * back to posting the actions one at a time.
+     */
+    void set_post_actions_callback(action_batch_handler_t&& post_handler)
+    {
+        _post_actions_cb = std::move(post_handler);
+    }
+
     /*! This function gets called by the framework when there's a new action for
      * this node. It will then dispatch appropriate action handlers.
      *
@@ -690,6 +832,24 @@ private:
     //! Stores the list of property resolvers
     std::vector<property_resolver_t> _prop_resolvers;
 
+    //! Storage for a fast property: the atomically updated shadow value, a
+    // flag telling the next resolution that the shadow is ahead of the
+    // backing property, and the apply callback
+    struct fast_prop_slot_t
+    {
+        property_t<double>* prop;
+        std::atomic<double> value{0.0};
+        std::atomic<bool> pending{false};
+        fast_prop_fn_t apply_fn;
+    };
+
+    //! Fast-property table, keyed by property ID and instance. The slots are
+    // heap-allocated because atomics are neither copyable nor movable. The
+    // table itself is only written during registration (typically the
+    // constructor); the lock-free set/get path relies on it not changing
+    // afterwards.
+    std::unordered_map<std::string, std::unique_ptr<fast_prop_slot_t>> _fast_props;
+
     //! A callback that the graph sets when the node is connected to graph.
     // This will return a global mutex to the graph. It is required to propagate
     // properties on multithread applications.
@@ -742,6 +902,12 @@ private:
     action_handler_t _post_action_cb = [](const res_source_info&,
                                            action_info::sptr) { /* nop */ };
 
+    //! Callback which allows us to post a batch of actions in one traversal
+    //
+    // Unlike _post_action_cb, this may be unset, in which case post_actions()
+    // falls back to the one-at-a-time callback
+    action_batch_handler_t _post_actions_cb = nullptr;
+
     //! Map describing how incoming actions should be forwarded for USE_MAP
     forwarding_map_t _action_fwd_map;
 
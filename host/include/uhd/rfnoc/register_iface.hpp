@@ -9,8 +9,10 @@
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/time_spec.hpp>
 #include <boost/optional.hpp>
+#include <array>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -26,6 +28,24 @@ struct custom_register_space
     std::function<uint32_t(uint32_t)> peek_fn;
 };
 
+/*! Latency statistics for control transactions on a register interface.
+ *
+ * Latencies are measured from the moment a request packet is handed to the
+ * transport until its ACK is processed, and are binned into power-of-two
+ * microsecond buckets: bucket i counts transactions that completed in
+ * [2^i, 2^(i+1)) microseconds, and the last bucket additionally absorbs
+ * everything beyond the histogram range.
+ */
+struct ctrl_latency_stats_t
+{
+    //! Number of histogram buckets (covers up to ~16 seconds)
+    static constexpr size_t NUM_BUCKETS = 24;
+    //! Total number of send-to-ack transactions recorded
+    uint64_t num_transactions = 0;
+    //! Histogram bucket counts
+    std::array<uint64_t, NUM_BUCKETS> buckets{};
+};
+
 /*!  A software interface to access low-level registers in a NoC block.
  *
  * This interface supports the following:
@@ -214,6 +234,71 @@ public:
         size_t length,
         time_spec_t time = uhd::time_spec_t::ASAP) = 0;
 
+    /*! Write a 32-bit register and return a future for the acknowledgment.
+     *
+     * Behaves like poke32() with \p ack set to true, except the call returns
+     * as soon as the request has been handed to the transport. The returned
+     * future becomes ready when the acknowledgment arrives, and
+     * std::future::get() rethrows any error that poke32() would have thrown
+     * for this transaction. This lets a caller issue many writes back to
+     * back and pay the control-plane round trip only once, at the point
+     * where the futures are collected.
+     *
+     * If the device never responds and no response can be fabricated, the
+     * future never becomes ready; callers that need to recover from that
+     * should wait with std::future::wait_for() rather than get().
+     *
+     * The default implementation performs the write synchronously and
+     * returns an already-satisfied future.
+     *
+     * \param addr The byte address of the register to write to (truncated to 20 bits).
+     * \param data New value of this register.
+     * \param time The time at which the transaction should be executed.
+     * \return a future that becomes ready when the write is acknowledged
+     */
+    virtual std::future<void> poke32_async(
+        uint32_t addr, uint32_t data, time_spec_t time = uhd::time_spec_t::ASAP)
+    {
+        std::promise<void> promise;
+        try {
+            poke32(addr, data, time, true);
+            promise.set_value();
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+        return promise.get_future();
+    }
+
+    /*! Read a 32-bit register and return a future for the response.
+     *
+     * Behaves like peek32(), except the call returns as soon as the request
+     * has been handed to the transport. The returned future becomes ready
+     * when the response arrives; std::future::get() returns the register
+     * value or rethrows any error that peek32() would have thrown. Issuing
+     * several reads before collecting their futures overlaps the round
+     * trips instead of serializing them.
+     *
+     * The same caveat as poke32_async() applies when the response is lost.
+     *
+     * The default implementation performs the read synchronously and
+     * returns an already-satisfied future.
+     *
+     * \param addr The byte address of the register to read from (truncated to 20 bits).
+     * \param time The time at which the transaction should be executed.
+     * \return a future that yields the register value
+     */
+    virtual std::future<uint32_t> peek32_async(
+        uint32_t addr, time_spec_t time = uhd::time_spec_t::ASAP)
+    {
+        std::promise<uint32_t> promise;
+        try {
+            promise.set_value(peek32(addr, time));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+        return promise.get_future();
+    }
+
     /*! Poll a 32-bit register until its value for all bits in mask match data&mask
      *
      * This will insert a command into the command queue to wait until a
@@ -341,6 +426,52 @@ public:
         std::function<void(uint32_t, uint32_t)> poke_fn,
         std::function<uint32_t(uint32_t)> peek_fn) = 0;
 
+    /*! Get the current occupancy of the downstream command buffer, in 32-bit
+     *  words.
+     *
+     *  This is the host-side flow control view: the number of words that have
+     *  been sent to the slave but not yet acknowledged as consumed. Reading it
+     *  requires no control transaction. Timed commands occupy the buffer until
+     *  their execution time has passed, so this can be used to throttle long
+     *  schedules of timed commands before writes start blocking.
+     *
+     *  The default implementation has no flow control state and returns 0.
+     *
+     * \return The occupied buffer space in 32-bit words
+     */
+    virtual size_t get_cmd_buff_occupancy()
+    {
+        return 0;
+    }
+
+    /*! Get the capacity of the downstream command buffer, in 32-bit words.
+     *
+     *  The default implementation has no flow control state and returns 0.
+     *
+     * \return The total buffer capacity in 32-bit words
+     */
+    virtual size_t get_cmd_buff_capacity() const
+    {
+        return 0;
+    }
+
+    /*! Return the accumulated control transaction latency statistics for this
+     *  register interface.
+     *
+     *  Reading the statistics is cheap and does not interfere with transactions
+     *  in flight, so this can be polled while streaming to tell host-side
+     *  control-plane latency apart from network or NoC slowdowns.
+     *
+     *  The default implementation has no instrumentation and returns an empty
+     *  histogram.
+     *
+     * \return The latency histogram recorded since this interface was created
+     */
+    virtual ctrl_latency_stats_t get_ctrl_latency_stats() const
+    {
+        return {};
+    }
+
 }; // class register_iface
 
 }} /* namespace uhd::rfnoc */
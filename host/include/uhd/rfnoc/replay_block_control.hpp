@@ -8,6 +8,8 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/stream.hpp>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -96,6 +98,11 @@ namespace uhd { namespace rfnoc {
  * To stop a continuous playback, either call stop(), or issue a stream command
  * with uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS.
  *
+ * For gapless back-to-back playback of different memory regions (e.g., a
+ * waveform sequencer), use play_queued(). It submits a whole sequence of
+ * playback regions into the block's on-device command queue, so region
+ * transitions happen in hardware without a host round-trip in between.
+ *
  * \section rfnoc_block_replay_actions Action Handling
  *
  * If this block receives TX or RX actions (uhd::rfnoc::tx_event_action_info o
@@ -179,6 +186,38 @@ public:
      */
     virtual void record_restart(const size_t port = 0) = 0;
 
+    /*! Upload a block of data into the Replay block's memory
+     *
+     * This is a convenience method that wraps the record-and-stream sequence:
+     * it configures recording on \p port (like record()), streams \p buff
+     * through \p tx_stream, and blocks until the Replay block reports that all
+     * bytes have been committed to memory. The record fullness is only polled
+     * after all data has been handed to the streamer, so the transfer is paced
+     * by transport flow control instead of being lock-stepped against
+     * control-plane register reads.
+     *
+     * The \p tx_stream must be a single-channel streamer that is connected
+     * (through the graph) to input port \p port of this block, and its wire
+     * format must match the record data type of the port.
+     *
+     * \param tx_stream The TX streamer connected to this block's input port
+     * \param buff Pointer to the data to upload
+     * \param size Size of the data in bytes. The same alignment requirements
+     *             as for the \p size argument of record() apply.
+     * \param offset Memory offset where to start recording the data. This
+     *               value must be aligned to the memory word size.
+     * \param port Which input port of the replay block to use
+     * \param timeout Timeout for the entire upload, in seconds
+     * \throws uhd::value_error if the size, offset, or streamer are invalid.
+     * \throws uhd::op_timeout if the data could not be uploaded in time.
+     */
+    virtual void upload(uhd::tx_streamer::sptr tx_stream,
+        const void* buff,
+        const uint64_t size,
+        const uint64_t offset,
+        const size_t port    = 0,
+        const double timeout = 10.0) = 0;
+
     /*! Play back data.
      *
      * The offset and size define what data is played back on an output port.
@@ -225,6 +264,54 @@ public:
         const uhd::time_spec_t time_spec = uhd::time_spec_t(0.0),
         const bool repeat                = false) = 0;
 
+    /*! A single entry of a queued playback sequence
+     *
+     * See play_queued() for a description of the fields. The same alignment
+     * requirements as for the corresponding arguments of play() apply.
+     */
+    struct play_command_t
+    {
+        //! Memory offset of the data to be played
+        uint64_t offset = 0;
+        //! Size of data to play back, in bytes
+        uint64_t size = 0;
+        //! Time for the first item of this entry (0.0 means stream immediately)
+        uhd::time_spec_t time_spec = uhd::time_spec_t(0.0);
+        //! Repeat this entry continuously until stop() is called. Only valid
+        //! on the final entry of a sequence.
+        bool repeat = false;
+    };
+
+    /*! Queue a sequence of playback regions for gapless playback
+     *
+     * Submits all entries of \p commands into the block's on-device play
+     * command queue in one go. The hardware latches the offset and size of
+     * each entry when its command is queued, so consecutive entries can play
+     * different memory regions back-to-back with no host interaction — and
+     * thus no gap — between them.
+     *
+     * All entries except the last are queued without an end-of-burst flag, so
+     * a downstream block (e.g., a radio) sees the whole sequence as one
+     * uninterrupted burst. The final entry either ends the burst, or, if its
+     * repeat flag is set, loops continuously until stop() is called.
+     *
+     * Command queue space is checked for the entire sequence before the first
+     * entry is queued, so a sequence is either queued completely or not at
+     * all. Use get_play_cmd_fifo_space() to query how many entries can
+     * currently be queued. This check requires FPGA version 1.1 or greater;
+     * on older images the sequence is queued unconditionally.
+     *
+     * \param commands The sequence of playback regions to queue
+     * \param port Which output port of the replay block to use
+     * \throws uhd::value_error if an entry's offset+size exceeds the available
+     *         memory, or if an entry other than the last has its repeat flag
+     *         set.
+     * \throws uhd::op_failed if the play command queue does not have space
+     *         for the entire sequence.
+     */
+    virtual void play_queued(
+        const std::vector<play_command_t>& commands, const size_t port = 0) = 0;
+
     /*! Stops playback
      *
      * Halts any currently executing play commands and cancels any other play commands
@@ -234,6 +321,36 @@ public:
      */
     virtual void stop(const size_t port = 0) = 0;
 
+    /*! Download a block of data from the Replay block's memory
+     *
+     * The counterpart of upload(): plays back \p size bytes of memory starting
+     * at \p offset (like play() without repeat) and receives them into \p buff
+     * through \p rx_stream. Together with upload(), this can be used to verify
+     * an uploaded waveform by reading it back and comparing.
+     *
+     * The \p rx_stream must be a single-channel streamer that is connected
+     * (through the graph) to output port \p port of this block, and its wire
+     * format must match the play data type of the port.
+     *
+     * \param rx_stream The RX streamer connected to this block's output port
+     * \param buff Pointer to the buffer to download into
+     * \param size Size of the data in bytes. The same alignment requirements
+     *             as for the \p size argument of play() apply.
+     * \param offset Memory offset of the data to download. This value must be
+     *               aligned to the memory word size.
+     * \param port Which output port of the replay block to use
+     * \param timeout Timeout for each receive call, in seconds
+     * \throws uhd::value_error if the size, offset, or streamer are invalid.
+     * \throws uhd::op_timeout if the data could not be downloaded in time.
+     * \throws uhd::op_failed on receive errors (e.g. overruns).
+     */
+    virtual void download(uhd::rx_streamer::sptr rx_stream,
+        void* buff,
+        const uint64_t size,
+        const uint64_t offset,
+        const size_t port    = 0,
+        const double timeout = 10.0) = 0;
+
     /*! Get the size of the memory
      *
      * Returns the size of the shared memory space. Any record or playback buffers must
@@ -337,6 +454,18 @@ public:
      */
     virtual uint64_t get_play_position(const size_t port = 0) = 0;
 
+    /*! Get the free space in the play command queue
+     *
+     * Returns the number of play commands that can currently be queued on the
+     * device before the queue is full. This can be used to size a sequence
+     * for play_queued().
+     *
+     * \param port Which output port of the replay block to use
+     * \returns the number of free entries in the play command queue
+     * \throws uhd::not_implemented_error if the FPGA version is less than 1.1.
+     */
+    virtual size_t get_play_cmd_fifo_space(const size_t port = 0) = 0;
+
     /*! Get the maximum number of items in a packet
      *
      * \param port Which output port of the replay block to use
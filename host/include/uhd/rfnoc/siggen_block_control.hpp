@@ -8,8 +8,11 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/types/time_spec.hpp>
 #include <uhd/utils/math.hpp>
+#include <boost/optional.hpp>
 #include <complex>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -179,6 +182,70 @@ public:
      */
     virtual size_t get_samples_per_packet(const size_t port) const = 0;
 
+    /*! A complete set of waveform parameters
+     *
+     * See apply_config() for a description of how this is used. The fields
+     * mirror the individual setters and default to the same values the block
+     * starts up with.
+     */
+    struct config_t
+    {
+        //! Waveform type (see set_waveform())
+        siggen_waveform waveform = siggen_waveform::CONSTANT;
+        //! Amplitude for noise and sine wave data (see set_amplitude())
+        double amplitude = 1.0;
+        //! Constant value for constant mode (see set_constant())
+        std::complex<double> constant = std::complex<double>(1.0, 1.0);
+        //! Phase increment between samples in sine wave mode (see
+        // set_sine_phase_increment())
+        double sine_phase_increment = 1.0;
+    };
+
+    /*! Atomically apply a complete set of waveform parameters
+     *
+     * Applies all parameters in \p config as one transaction. If a \p time is
+     * given, the underlying register writes are queued as timed commands, so
+     * the hardware commits the entire parameter set back-to-back at that time
+     * instead of spreading the update over multiple host round-trips. Since
+     * the sine generator's phase accumulator keeps running across the update,
+     * this switches parameters phase-continuously without glitching or
+     * re-arming the downstream streamer.
+     *
+     * \param config The waveform parameters to apply
+     * \param time When to commit the parameter set (uninitialized: commit
+     *             immediately)
+     * \param port The port on the block whose parameters to set
+     */
+    virtual void apply_config(const config_t& config,
+        const boost::optional<uhd::time_spec_t> time,
+        const size_t port) = 0;
+
+    /*! Queue a batched sweep of sine wave phase increments
+     *
+     * Queues one timed phase-increment update for every entry of
+     * \p phase_incs, with the first update committed at \p start_time and
+     * each subsequent update \p interval seconds after the previous one. All
+     * updates are pushed into the block's command queue up front, so the
+     * sweep runs entirely on-device: a calibration routine can step a tone
+     * at a thousand steps per second without any host interaction per step.
+     * Each step only changes the phase increment, so the generated sinusoid
+     * is phase-continuous across steps.
+     *
+     * The block must be configured for sine wave mode. Every entry must be
+     * in the range [-pi, pi], like set_sine_phase_increment().
+     *
+     * \param phase_incs The phase increments to step through
+     * \param start_time Time at which the first entry is committed
+     * \param interval Time between successive entries, in seconds
+     * \param port The port on the block whose phase increment to sweep
+     * \throws uhd::value_error if an entry is out of range or the interval
+     *         is not positive.
+     */
+    virtual void sweep_sine_phase_increments(const std::vector<double>& phase_incs,
+        const uhd::time_spec_t start_time,
+        const double interval,
+        const size_t port) = 0;
+
     /*! Configure the sinusoidal waveform generator given frequency and rate
      *
      * Convenience function to configure the current phase increment between
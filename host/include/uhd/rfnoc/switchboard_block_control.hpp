@@ -45,6 +45,26 @@ public:
      * \param output Index of the output port.
      */
     virtual void connect(const size_t input, const size_t output) = 0;
+
+    /*! Connects an input to an output without property propagation
+     *
+     * This is a fast path for dynamic source/sink switching: It pokes the two
+     * select registers, updates the block's internal forwarding maps, and
+     * returns. Unlike connect(), it does not trigger a property propagation
+     * through the graph, so a connected streamer stays intact and switching
+     * takes no longer than two register writes.
+     *
+     * To use this safely, connect all candidate paths through the switchboard
+     * up front and commit the graph, so that every path has already been
+     * resolved (e.g., all sources run at the same rate). Flow control
+     * downstream of the switchboard is unaffected by the switch, and data on
+     * the deselected input will stall until it is selected again.
+     *
+     * \param input Index of the input port.
+     * \param output Index of the output port.
+     * \throws uhd::value_error if an index is out of bounds.
+     */
+    virtual void switch_path(const size_t input, const size_t output) = 0;
 };
 
 }} // namespace uhd::rfnoc
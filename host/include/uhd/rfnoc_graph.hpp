@@ -16,6 +16,7 @@
 #include <uhd/types/time_spec.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <boost/units/detail/utility.hpp> // for demangle
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -23,6 +24,22 @@ namespace uhd { namespace rfnoc {
 
 class mb_controller;
 
+/*! Traffic error counters of a stream endpoint (SEP)
+ *
+ * All counters are free-running and reset when the device is initialized.
+ * See also rfnoc_graph::enumerate_sep_traffic_counters().
+ */
+struct sep_traffic_counters_t
+{
+    //! Number of sequence errors (dropped or reordered packets) seen by the
+    //  endpoint's output stream
+    size_t seq_err_count = 0;
+    //! Number of data integrity errors seen by the endpoint's output stream
+    size_t data_err_count = 0;
+    //! Number of routing errors seen by the endpoint's output stream
+    size_t route_err_count = 0;
+};
+
 /*! The core class for a UHD session with (an) RFNoC device(s)
  *
  * This class is a superset of uhd::device. It does not only hold a device
@@ -311,6 +328,21 @@ public:
      */
     virtual std::vector<graph_edge_t> enumerate_active_connections() = 0;
 
+    /*! Read the traffic counters of all stream endpoints in this graph
+     *
+     * The counters of each endpoint are read back in a single management
+     * transaction, and no control (AXIS-Ctrl) traffic is generated, so this
+     * call is cheap enough to poll periodically for telemetry without
+     * disturbing ongoing streams.
+     *
+     * Endpoints that are not reachable from the host (e.g., endpoints that
+     * only serve remote streams) are not included in the result.
+     *
+     * \return A map from SEP block ID (e.g. "0/SEP#0") to its counters.
+     */
+    virtual std::map<std::string, sep_traffic_counters_t>
+    enumerate_sep_traffic_counters() = 0;
+
     /*! Commit graph and run initial checks
      *
      * This method needs to be called when the graph is ready for action.
@@ -9,9 +9,12 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/actions.hpp>
+#include <uhd/transport/zero_copy.hpp>
 #include <uhd/types/device_addr.hpp>
+#include <uhd/types/time_spec.hpp>
 #include <uhd/types/ref_vector.hpp>
 #include <uhd/types/stream_cmd.hpp>
+#include <uhd/types/stream_health.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <cstddef>
 #include <memory>
@@ -91,6 +94,12 @@ struct UHD_API stream_args_t
      * range, and increases quantization noise. On the other hand, it reduces the load on
      * the data link and thus allows more bandwidth (a USRP N210 can work with 25 MHz
      * bandwidth for 16-Bit complex samples, and 50 MHz for 8-Bit complex samples).
+     *
+     * The special value `auto` selects the wire format from the link budget
+     * at streamer creation: when the link can carry the currently configured
+     * sample rates at 16 bits per component, sc16 is chosen, otherwise sc8.
+     * The decision is logged. On RFNoC devices, `auto` always resolves to
+     * sc16, since the RFNoC data interfaces negotiate sc16.
      */
     std::string otw_format;
 
@@ -120,6 +129,59 @@ struct UHD_API stream_args_t
      * Users should specify this option to request smaller than default
      * packets, probably with the intention of reducing packet latency.
      *
+     * - convert_threads: Number of threads to use for the sample format
+     * conversion, including the streamer thread itself. Defaults to 1
+     * (conversion runs inline on the streamer thread). Values greater than
+     * one spread the conversion of large buffers across a pool of worker
+     * threads, which helps when one core cannot keep up with the aggregate
+     * sample rate.
+     *
+     * - nt_stores: When set to a non-zero value, converters that support it
+     * write RX samples with non-temporal (cache-bypassing) stores. Useful
+     * when receiving into a buffer much larger than the CPU cache that will
+     * not be read back soon, e.g. a multi-GB disk-recording ring.
+     *
+     * - recv_prefetch: Number of packets to pre-stage per channel with a
+     * dedicated worker thread (second-generation link-layer devices only).
+     * With many synchronized channels, this keeps the time-alignment loop
+     * from serializing on the slowest link. Defaults to off; the value must
+     * stay well below the transport's number of receive frames.
+     *
+     * - recv_reorder: Number of out-of-order packets to absorb per channel
+     * in a timestamp-indexed reorder stage ahead of the time-alignment
+     * logic (second-generation link-layer devices only). A single
+     * out-of-order packet then costs one buffer slot instead of a
+     * multi-packet discard and re-sync. Defaults to off.
+     *
+     * - send_pipeline: When set to a non-zero value, the send call fetches
+     * the next link buffer (without blocking) right after committing the
+     * current one, overlapping the buffer turnaround with the caller
+     * producing the next packet (second-generation link-layer devices
+     * only). Defaults to off.
+     *
+     * - send_spin_wait: When set to a non-zero value, the send call
+     * busy-polls the link for a free buffer instead of parking on the
+     * transport's condition variable (second-generation link-layer
+     * devices only). This trades one spinning core for tighter timed
+     * burst jitter, since there is no scheduler wakeup between a buffer
+     * becoming free and the packet going out. Defaults to off.
+     *
+     * - overflow_fast_restart: When specified, a stream-now restart command
+     * is pre-staged in the radio's command registers whenever continuous
+     * streaming starts, and overflow recovery fires it with a single
+     * register write instead of a full stream command sequence
+     * (second-generation devices only). This shrinks the gap in the sample
+     * stream after an overrun.
+     *
+     * - fast_teardown: When set to a non-zero value, destroying an RX
+     * streamer detaches its transports from the I/O service synchronously
+     * but defers the link teardown (socket close, buffer reclaim) to a
+     * background task owned by the RFNoC graph (second-generation devices
+     * only). The destructor then returns in microseconds instead of
+     * blocking on transport teardown, which matters for applications that
+     * cycle streamers at a high rate. The graph completes all deferred
+     * teardown before it is itself destroyed. Defaults to off.
+     *
      * - noclear: Used by tx_dsp_core_200 and rx_dsp_core_200
      *
      * The following are not implemented, but are listed for conceptual purposes:
@@ -245,6 +307,131 @@ public:
         const double timeout  = 0.1,
         const bool one_packet = false) = 0;
 
+    //! Describes one packet's worth of samples delivered by recv_scatter()
+    struct scatter_info_t
+    {
+        size_t offset; //!< sample offset within the caller's buffers
+        size_t nsamps; //!< number of samples per channel in this record
+        time_spec_t time_spec; //!< time of the first sample in this record
+    };
+
+    /*!
+     * Receive into the given buffers like recv(), but additionally return
+     * one record per received packet describing where that packet's
+     * samples landed and the time of its first sample.
+     *
+     * This gives applications per-packet timestamps without having to
+     * call recv() once per packet: a single call fills the buffers from
+     * as many packets as fit and appends an (offset, nsamps, time_spec)
+     * record for each. Fragments of a packet split across calls produce
+     * records with interpolated time specs, like recv() does for its
+     * metadata. Error handling is identical to recv(); \p metadata
+     * carries the overall result and errors after the first packet are
+     * queued for the next call.
+     *
+     * Not all streamer implementations support this call; the default
+     * implementation throws uhd::not_implemented_error.
+     *
+     * \param buffs a vector of writable memory to fill with samples
+     * \param nsamps_per_buff the size of each buffer in number of samples
+     * \param infos cleared, then filled with one record per packet
+     * \param[out] metadata data to fill describing the buffer
+     * \param timeout the timeout in seconds to wait for a packet
+     * \return the total number of samples received or 0 on error
+     */
+    virtual size_t recv_scatter(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        std::vector<scatter_info_t>& infos,
+        rx_metadata_t& metadata,
+        const double timeout = 0.1);
+
+    //! Typedef for a collection of managed wire-format buffers, one per channel
+    typedef std::vector<uhd::transport::managed_recv_buffer::sptr> managed_buffs_type;
+
+    /*!
+     * Receive one time-aligned packet per channel without copying or
+     * converting the samples.
+     *
+     * On success, \p buffs holds one managed buffer per channel containing
+     * the entire packet as it arrived from the transport (headers
+     * included), and \p payload_offsets gives the byte offset of the
+     * sample payload within each buffer. The samples are in the
+     * over-the-wire format requested at streamer creation. The buffers
+     * remain valid until the caller drops its references, which returns
+     * them to the transport - holding many buffers for a long time can
+     * starve the transport of receive frames.
+     *
+     * On error, \p metadata carries the error code (as with recv()) and
+     * zero is returned. Do not interleave calls to recv() and
+     * recv_buffs() on the same streamer: a packet partially consumed by
+     * recv() is handed out here with the consumed part skipped via the
+     * payload offset.
+     *
+     * Not all streamer implementations support this call; the default
+     * implementation throws uhd::not_implemented_error.
+     *
+     * \param buffs filled with one wire-format buffer per channel
+     * \param payload_offsets filled with the payload byte offsets
+     * \param[out] metadata data to fill describing the buffers
+     * \param timeout the timeout in seconds to wait for a packet
+     * \return the number of over-the-wire samples per channel, 0 on error
+     */
+    virtual size_t recv_buffs(managed_buffs_type& buffs,
+        std::vector<size_t>& payload_offsets,
+        rx_metadata_t& metadata,
+        const double timeout = 0.1);
+
+    //! Describes one packet-boundary event recorded by the tag stream
+    struct rx_tag_t
+    {
+        //! The kind of event a tag marks
+        enum event_t {
+            //! The sample at \p offset is the final sample of a burst
+            EVENT_END_OF_BURST,
+            //! The packet starting at \p offset does not follow the
+            //! previous packet in time
+            EVENT_TIME_DISCONTINUITY,
+            //! Samples are missing before \p offset (dropped packets)
+            EVENT_SEQUENCE_GAP
+        };
+        event_t event; //!< the kind of event
+        size_t offset; //!< sample offset within the caller's buffers
+        time_spec_t time_spec; //!< time of the sample at \p offset
+    };
+
+    /*!
+     * Enable or disable the out-of-band receive tag stream.
+     *
+     * When enabled, every call to recv() additionally records one tag per
+     * packet-boundary event the packet handler observed while filling the
+     * buffers: end-of-burst flags, timestamp discontinuities, and sequence
+     * gaps. The tags are aligned to sample offsets within that call's
+     * buffers, so burst segmentation can consume the flags the transport
+     * already parsed instead of re-deriving them by scanning timestamps in
+     * a second pass over the data. Retrieve the tags with get_tags() after
+     * each recv() call.
+     *
+     * Not all streamer implementations support this call; the default
+     * implementation throws uhd::not_implemented_error.
+     *
+     * \param enable true to record tags, false to stop
+     */
+    virtual void enable_tags(const bool enable);
+
+    /*!
+     * Get the tags recorded during the most recent call to recv().
+     *
+     * The previous contents of \p tags are replaced. Tag recording must
+     * first be enabled with enable_tags(). A bounded number of tags is
+     * recorded per call; events beyond that bound are dropped, so size
+     * receive buffers such that a single call cannot span thousands of
+     * bursts.
+     *
+     * \param tags filled with the tags from the most recent receive
+     * \return the number of tags returned
+     */
+    virtual size_t get_tags(std::vector<rx_tag_t>& tags);
+
     /*!
      * Issue a stream command to the usrp device.
      * This tells the usrp to send samples into the host.
@@ -258,6 +445,18 @@ public:
      */
     virtual void issue_stream_cmd(const stream_cmd_t& stream_cmd) = 0;
 
+    /*!
+     * Get aggregated health statistics for this streamer.
+     *
+     * Returns counts and EWMA rates of overruns, sequence errors, late
+     * commands, and timeouts seen since the streamer was created. This
+     * call is cheap enough to poll periodically across many streamers.
+     *
+     * Streamers that do not track health statistics return an all-zero
+     * object.
+     */
+    virtual stream_health_t get_stream_health(void) const;
+
     /*!
      * Post an action to the input edge of the Streamer.
      * \param action shared pointer to the corresponding action_info request
@@ -321,6 +520,52 @@ public:
         const tx_metadata_t& metadata,
         const double timeout = 0.1) = 0;
 
+    /*!
+     * Register a waveform for repeated sends.
+     *
+     * The samples are run through the streamer's converter once and the
+     * resulting wire-format data is cached inside the streamer. The
+     * returned handle can then be passed to send_preconverted(), which
+     * copies the cached wire data straight into the link buffers and
+     * skips the converter entirely. Use this for waveforms that are
+     * resent many times (burst transmitters, pulse trains); for
+     * one-shot data the extra copy into the cache costs more than it
+     * saves.
+     *
+     * The cache snapshots the samples at registration time and uses the
+     * converter's current scale factor; re-register after changing
+     * either. Handles remain valid for the life of the streamer.
+     *
+     * The default implementation throws a uhd::not_implemented_error;
+     * only streamers for second-generation link-layer devices implement
+     * this call.
+     *
+     * \param buffs a vector of read-only memory containing samples
+     * \param nsamps_per_buff the number of samples to cache, per buffer
+     * \return a handle identifying the cached waveform
+     */
+    virtual size_t register_preconverted(
+        const buffs_type& buffs, const size_t nsamps_per_buff);
+
+    /*!
+     * Send a waveform previously registered with register_preconverted().
+     *
+     * Behaves like send() called with the registered samples: the same
+     * fragmentation rules and burst flag handling apply, and it blocks
+     * until the samples have been committed to the link or the timeout
+     * expires. The converter is bypassed; each packet's payload is
+     * copied from the preconverted cache.
+     *
+     * The default implementation throws a uhd::not_implemented_error.
+     *
+     * \param handle a handle from register_preconverted()
+     * \param metadata data describing the buffer's contents
+     * \param timeout the timeout in seconds to wait on a packet
+     * \return the number of samples sent
+     */
+    virtual size_t send_preconverted(
+        const size_t handle, const tx_metadata_t& metadata, const double timeout = 0.1);
+
     /*!
      * Receive an asynchronous message from this TX stream.
      * \param async_metadata the metadata to be filled in
@@ -330,6 +575,38 @@ public:
     virtual bool recv_async_msg(
         async_metadata_t& async_metadata, double timeout = 0.1) = 0;
 
+    /*!
+     * Get an OS-pollable notification handle for async messages.
+     *
+     * On Linux, RFNoC streamers return an eventfd that becomes readable
+     * whenever an async message is enqueued, so event-driven applications
+     * can integrate async metadata readiness with epoll/poll/select instead
+     * of dedicating a thread to polling recv_async_msg() with timeouts.
+     *
+     * After a wakeup, read the eventfd to clear it, then drain all pending
+     * messages with recv_async_msg() and a timeout of zero. A message that
+     * arrives while draining makes the handle readable again, so no wakeup
+     * is lost. The handle is owned by the streamer and stays valid for the
+     * streamer's lifetime; do not close it.
+     *
+     * \return the notification file descriptor, or -1 if this streamer (or
+     *         this platform) does not support event-driven notification
+     */
+    virtual int get_async_msg_fd(void) const;
+
+    /*!
+     * Get aggregated health statistics for this streamer.
+     *
+     * Returns counts and EWMA rates of underruns, sequence errors, and
+     * late bursts seen since the streamer was created. The counters
+     * advance as async messages are received from the device, so the
+     * caller must be draining async messages for them to be accurate.
+     *
+     * Streamers that do not track health statistics return an all-zero
+     * object.
+     */
+    virtual stream_health_t get_stream_health(void) const;
+
     /*!
      * Post an action to the output edge of the Streamer.
      * \param action shared pointer to the corresponding action_info request
@@ -12,7 +12,6 @@
 #include <boost/circular_buffer.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/utility.hpp>
-#include <functional>
 #include <mutex>
 
 namespace uhd { namespace transport {
@@ -23,8 +22,7 @@ class bounded_buffer_detail : uhd::noncopyable
 public:
     bounded_buffer_detail(size_t capacity) : _buffer(capacity)
     {
-        _not_full_fcn  = std::bind(&bounded_buffer_detail<elem_type>::not_full, this);
-        _not_empty_fcn = std::bind(&bounded_buffer_detail<elem_type>::not_empty, this);
+        /* NOP */
     }
 
     UHD_INLINE bool push_with_haste(const elem_type& elem)
@@ -34,21 +32,21 @@ public:
             return false;
         }
         _buffer.push_front(elem);
-        _empty_cond.notify_one();
+        notify_not_empty(lock);
         return true;
     }
 
     UHD_INLINE bool push_with_pop_on_full(const elem_type& elem)
     {
-        std::lock_guard<std::mutex> lock(_mutex);
+        std::unique_lock<std::mutex> lock(_mutex);
         if (_buffer.full()) {
             _buffer.pop_back();
             _buffer.push_front(elem);
-            _empty_cond.notify_one();
+            notify_not_empty(lock);
             return false;
         } else {
             _buffer.push_front(elem);
-            _empty_cond.notify_one();
+            notify_not_empty(lock);
             return true;
         }
     }
@@ -57,22 +55,28 @@ public:
     {
         std::unique_lock<std::mutex> lock(_mutex);
         if (_buffer.full()) {
-            _full_cond.wait(lock, _not_full_fcn);
+            _full_waiters++;
+            _full_cond.wait(lock, [this]() { return not _buffer.full(); });
+            _full_waiters--;
         }
         _buffer.push_front(elem);
-        _empty_cond.notify_one();
+        notify_not_empty(lock);
     }
 
     UHD_INLINE bool push_with_timed_wait(const elem_type& elem, double timeout)
     {
         std::unique_lock<std::mutex> lock(_mutex);
         if (_buffer.full()) {
-            if (not _full_cond.timed_wait(lock, to_time_dur(timeout), _not_full_fcn)) {
+            _full_waiters++;
+            const bool not_full = _full_cond.timed_wait(
+                lock, to_time_dur(timeout), [this]() { return not _buffer.full(); });
+            _full_waiters--;
+            if (not not_full) {
                 return false;
             }
         }
         _buffer.push_front(elem);
-        _empty_cond.notify_one();
+        notify_not_empty(lock);
         return true;
     }
 
@@ -83,7 +87,7 @@ public:
             return false;
         }
         this->pop_back(elem);
-        _full_cond.notify_one();
+        notify_not_full(lock);
         return true;
     }
 
@@ -91,22 +95,28 @@ public:
     {
         std::unique_lock<std::mutex> lock(_mutex);
         if (_buffer.empty()) {
-            _empty_cond.wait(lock, _not_empty_fcn);
+            _empty_waiters++;
+            _empty_cond.wait(lock, [this]() { return not _buffer.empty(); });
+            _empty_waiters--;
         }
         this->pop_back(elem);
-        _full_cond.notify_one();
+        notify_not_full(lock);
     }
 
     UHD_INLINE bool pop_with_timed_wait(elem_type& elem, double timeout)
     {
         std::unique_lock<std::mutex> lock(_mutex);
         if (_buffer.empty()) {
-            if (not _empty_cond.timed_wait(lock, to_time_dur(timeout), _not_empty_fcn)) {
+            _empty_waiters++;
+            const bool not_empty = _empty_cond.timed_wait(
+                lock, to_time_dur(timeout), [this]() { return not _buffer.empty(); });
+            _empty_waiters--;
+            if (not not_empty) {
                 return false;
             }
         }
         this->pop_back(elem);
-        _full_cond.notify_one();
+        notify_not_full(lock);
         return true;
     }
 
@@ -115,17 +125,37 @@ private:
     boost::condition _empty_cond, _full_cond;
     boost::circular_buffer<elem_type> _buffer;
 
-    bool not_full(void) const
+    /*!
+     * Number of threads currently blocked in a wait for the respective
+     * condition. Guarded by _mutex. Tracking these makes the common
+     * streaming case (buffer neither full nor empty, nobody waiting) a
+     * single lock/unlock: the condition variable is not touched at all.
+     */
+    size_t _empty_waiters = 0;
+    size_t _full_waiters  = 0;
+
+    /*!
+     * Wake up one consumer, but only when one is actually waiting, and
+     * only after dropping the lock so the woken thread does not
+     * immediately block on _mutex again.
+     */
+    UHD_INLINE void notify_not_empty(std::unique_lock<std::mutex>& lock)
     {
-        return not _buffer.full();
+        if (_empty_waiters != 0) {
+            lock.unlock();
+            _empty_cond.notify_one();
+        }
     }
-    bool not_empty(void) const
+
+    //! Wake up one producer; same rationale as notify_not_empty()
+    UHD_INLINE void notify_not_full(std::unique_lock<std::mutex>& lock)
     {
-        return not _buffer.empty();
+        if (_full_waiters != 0) {
+            lock.unlock();
+            _full_cond.notify_one();
+        }
     }
 
-    std::function<bool(void)> _not_full_fcn, _not_empty_fcn;
-
     /*!
      * Three part operation to pop an element:
      * 1) assign elem to the back element
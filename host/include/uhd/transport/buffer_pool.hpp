@@ -26,6 +26,50 @@ public:
 
     virtual ~buffer_pool(void) = 0;
 
+    /*! Memory provider for externally managed pool memory
+     *
+     * Implement this to back a buffer pool with memory owned by another
+     * subsystem, e.g., CUDA-registered host memory or a dmabuf export, so
+     * that frames can be delivered directly into memory a peer device (such
+     * as a GPU) can access without an extra host copy.
+     */
+    class UHD_API external_allocator
+    {
+    public:
+        using sptr = std::shared_ptr<external_allocator>;
+
+        virtual ~external_allocator() = default;
+
+        /*! Allocate \p size bytes aligned to at least \p alignment bytes
+         *
+         * Returning nullptr is treated as an allocation failure.
+         */
+        virtual void* allocate(const size_t size, const size_t alignment) = 0;
+
+        //! Release memory previously obtained from allocate()
+        virtual void deallocate(void* mem, const size_t size) = 0;
+    };
+
+    /*!
+     * Allocation policy for a buffer pool.
+     *
+     * The defaults reproduce the historic behavior: plain heap memory with
+     * no NUMA binding.
+     */
+    struct alloc_policy_t
+    {
+        //! NUMA node to bind the pool memory to, or -1 for no binding. Only
+        //! honored on Linux hosts with libnuma support; ignored (with a
+        //! warning) elsewhere.
+        int numa_node = -1;
+        //! If true, back the pool with hugepages to reduce TLB pressure.
+        //! Falls back to regular pages if no hugepages are available.
+        bool use_hugepages = false;
+        //! If set, the pool memory comes from this allocator and the other
+        //! placement fields are ignored. The allocator outlives the pool.
+        external_allocator::sptr ext_alloc;
+    };
+
     /*!
      * Make a new buffer pool.
      * \param num_buffs the number of buffers to allocate
@@ -36,6 +80,34 @@ public:
     static sptr make(
         const size_t num_buffs, const size_t buff_size, const size_t alignment = 16);
 
+    /*!
+     * Make a new buffer pool with an explicit allocation policy.
+     * \param num_buffs the number of buffers to allocate
+     * \param buff_size the size of each buffer in bytes
+     * \param policy memory placement policy for the pool
+     * \param alignment the alignment boundary in bytes
+     * \return a new buffer pool buff_size X num_buffs
+     */
+    static sptr make(const size_t num_buffs,
+        const size_t buff_size,
+        const alloc_policy_t& policy,
+        const size_t alignment = 16);
+
+    /*! Install a process-wide external allocator for frame memory
+     *
+     * Links allocate their frame pools from this allocator when they are
+     * created with the `ext_alloc=1` link argument, so that received frames
+     * land directly in the external memory (e.g., enabling NIC-to-GPU peer
+     * DMA). Install the allocator before creating any streamers; it must
+     * outlive all links created while it is installed.
+     *
+     * \param alloc The allocator, or nullptr to uninstall
+     */
+    static void set_external_allocator(external_allocator::sptr alloc);
+
+    //! Return the installed external allocator, or nullptr if none is set
+    static external_allocator::sptr get_external_allocator();
+
     //! Get a pointer to the buffer start at the specified index
     virtual ptr_type at(const size_t index) const = 0;
 
@@ -28,6 +28,15 @@ public:
 
     using uptr = std::unique_ptr<frame_buff, deleter>;
 
+    //! Type of memory backing the frame buffer
+    enum class mem_type_t {
+        //! Plain host memory
+        HOST,
+        //! Externally managed memory (e.g., CUDA-registered host memory or a
+        //! dmabuf export) that a peer device can access directly
+        EXTERNAL
+    };
+
     /*!
      * Get the raw data buffer contained within the frame buffer
      * \return a pointer to the buffer memory.
@@ -37,6 +46,26 @@ public:
         return _data;
     }
 
+    /*!
+     * Returns the type of memory backing this frame buffer. Consumers of
+     * zero-copy receive paths can use this to tell whether data() points into
+     * externally managed (e.g., GPU-accessible) memory.
+     */
+    mem_type_t mem_type() const
+    {
+        return _mem_type;
+    }
+
+    /*!
+     * Sets the type of memory backing this frame buffer. Called by links
+     * whose frame pools were placed in external memory.
+     * \param mem_type The memory type of the buffer
+     */
+    void set_mem_type(mem_type_t mem_type)
+    {
+        _mem_type = mem_type;
+    }
+
     /*!
      * Returns the size of the packet
      * \return the size of the packet contained in the frame buffer, in bytes.
@@ -61,6 +90,9 @@ protected:
 
     /*! Size of packet in current frame */
     size_t _packet_size = 0;
+
+    /*! Type of memory backing the current frame */
+    mem_type_t _mem_type = mem_type_t::HOST;
 };
 
 }} // namespace uhd::transport
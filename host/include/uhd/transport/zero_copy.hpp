@@ -17,6 +17,11 @@
 namespace uhd { namespace transport {
 
 //! Simple managed buffer with release interface
+//
+// Although the smart pointer type permits shared ownership, the packet
+// handlers treat buffers as single-owner and move the pointer instead of
+// copying it, so the atomic reference count is only touched when a buffer is
+// acquired from and released back to the transport.
 class UHD_API managed_buffer
 {
 public:
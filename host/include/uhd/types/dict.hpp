@@ -9,7 +9,6 @@
 
 #include <uhd/config.hpp>
 #include <cstddef>
-#include <list>
 #include <map>
 #include <utility>
 #include <vector>
@@ -18,6 +17,12 @@ namespace uhd {
 
 /*!
  * A templated dictionary class with a python-like interface.
+ *
+ * Storage is a flat, contiguous array of key/value pairs, which keeps
+ * lookups cache-friendly and makes copies a single allocation (plus the
+ * element copies) -- these objects get copied a lot on the device
+ * initialization paths. Note that references returned by get() or
+ * operator[] are invalidated by subsequent insertions or removals.
  */
 template <typename Key, typename Val>
 class UHD_API_HEADER dict
@@ -148,7 +153,7 @@ public:
 
 private:
     typedef std::pair<Key, Val> pair_t;
-    std::list<pair_t> _map; // private container
+    std::vector<pair_t> _map; // private container
 };
 
 } // namespace uhd
@@ -52,6 +52,7 @@ template <typename Key, typename Val>
 std::vector<Key> dict<Key, Val>::keys(void) const
 {
     std::vector<Key> keys;
+    keys.reserve(_map.size());
     for (const pair_t& p : _map) {
         keys.push_back(p.first);
     }
@@ -62,6 +63,7 @@ template <typename Key, typename Val>
 std::vector<Val> dict<Key, Val>::vals(void) const
 {
     std::vector<Val> vals;
+    vals.reserve(_map.size());
     for (const pair_t& p : _map) {
         vals.push_back(p.second);
     }
@@ -148,7 +150,7 @@ bool dict<Key, Val>::operator!=(const dict<Key, Val>& other) const
 template <typename Key, typename Val>
 Val dict<Key, Val>::pop(const Key& key)
 {
-    typename std::list<pair_t>::iterator it;
+    typename std::vector<pair_t>::iterator it;
     for (it = _map.begin(); it != _map.end(); it++) {
         if (it->first == key) {
             Val val = it->second;
@@ -234,6 +234,23 @@ struct UHD_API async_metadata_t
      * A special payload populated by custom FPGA fabric.
      */
     uint32_t user_payload[4];
+
+    /*!
+     * The number of back-to-back events this record represents.
+     *
+     * During an error storm (e.g., every packet of a burst arriving late),
+     * the transport coalesces homogeneous runs of error events into a
+     * single record instead of queueing one record per packet. A value
+     * greater than one means this record stands for that many consecutive
+     * events of the same code on the same channel; time_spec then holds the
+     * time of the first event in the run and last_time_spec the time of the
+     * last. Burst ACKs and user payloads are never coalesced.
+     */
+    size_t event_count = 1;
+
+    //! When the last event of a coalesced run occurred (only valid if
+    //! event_count > 1 and has_time_spec is true)
+    time_spec_t last_time_spec;
 };
 
 } // namespace uhd
@@ -125,6 +125,31 @@ struct UHD_API meta_range_t : public std::vector<range_t>
 
     //! Convert this meta-range to a printable string
     std::string to_pp_string(void) const;
+
+private:
+    /*! Acceleration index for clip() and the bounds queries.
+     *
+     * Tuning code calls clip() on every set_freq, and fine-grained range
+     * lists (e.g., TwinRX) can have hundreds of sub-ranges, so clip() uses a
+     * binary search over this sorted list of sub-range starts instead of
+     * iterating the full list. The index is built lazily on the first query
+     * and rebuilt whenever the vector's size, storage address, or first/last
+     * sub-range changes (because this class inherits std::vector, mutations
+     * cannot be intercepted directly).
+     */
+    struct range_index_t
+    {
+        std::vector<double> starts;
+        const range_t* keyed_data = nullptr;
+        size_t keyed_size         = 0;
+        range_t keyed_front;
+        range_t keyed_back;
+    };
+
+    //! Return the acceleration index, (re-)building it if it is stale
+    const range_index_t& _get_index(void) const;
+
+    mutable range_index_t _index;
 };
 
 typedef meta_range_t gain_range_t;
@@ -0,0 +1,57 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstdint>
+
+namespace uhd {
+
+/*!
+ * Aggregated health statistics for a streamer.
+ *
+ * While metadata error codes report streaming incidents one call at a
+ * time, this struct accumulates them so that an application (or a fleet
+ * monitor) can poll rates instead of tracking individual events. It is
+ * returned by rx_streamer::get_stream_health() and
+ * tx_streamer::get_stream_health().
+ */
+struct UHD_API stream_health_t
+{
+    //! Running statistics for one class of streaming event
+    struct counter_t
+    {
+        //! Number of events since the streamer was created
+        uint64_t count = 0;
+
+        //! Time of the most recent event in seconds on the monotonic
+        //! system clock (std::chrono::steady_clock), or 0.0 if no event
+        //! has occurred yet
+        double last_time = 0.0;
+
+        //! Exponentially-weighted moving average of the event rate in
+        //! events per second, decayed to the time the snapshot was taken
+        double rate = 0.0;
+    };
+
+    //! Overflows reported on the receive path ("O")
+    counter_t overruns;
+
+    //! Underflows reported on the transmit path ("U")
+    counter_t underruns;
+
+    //! Sequence errors, i.e. packets dropped in transit ("D"/"S")
+    counter_t seq_errors;
+
+    //! Late commands and late data packets ("L")
+    counter_t lates;
+
+    //! Timeouts waiting for data or buffers
+    counter_t timeouts;
+};
+
+} // namespace uhd
@@ -63,6 +63,33 @@ public:
      */
     static time_spec_t from_ticks(long long ticks, double tick_rate);
 
+    /*!
+     * Convert an array of 64-bit tick counts into time specs.
+     * Batch version of from_ticks() for timestamping loops: all counts are
+     * converted with the same tick rate, and integer tick rates take a fast
+     * path that the compiler can vectorize.
+     * \param ticks array of integer tick counts
+     * \param count number of elements in ticks and out
+     * \param tick_rate the number of ticks per second
+     * \param out array of at least count elements to fill with time specs
+     */
+    static void from_ticks(
+        const long long* ticks, size_t count, double tick_rate, time_spec_t* out);
+
+    /*!
+     * Convert an array of 64-bit tick counts into real-valued seconds.
+     * Like the batch version of from_ticks(), but skips the time_spec_t
+     * representation entirely for consumers that want doubles.
+     * Note: For absolute times, the precision of the fractional seconds
+     * may be lost (see also get_real_secs()).
+     * \param ticks array of integer tick counts
+     * \param count number of elements in ticks and out
+     * \param tick_rate the number of ticks per second
+     * \param out array of at least count elements to fill with seconds
+     */
+    static void ticks_to_secs(
+        const long long* ticks, size_t count, double tick_rate, double* out);
+
     /*!
      * Convert the fractional seconds to clock ticks.
      * Translation into clock-domain specific units.
@@ -79,6 +106,19 @@ public:
      */
     long long to_ticks(const double tick_rate) const;
 
+    /*!
+     * Convert an array of time specs into 64-bit tick counts.
+     * Batch version of to_ticks(): all time specs are converted with the
+     * same tick rate, and integer tick rates take a fast path that the
+     * compiler can vectorize.
+     * \param times array of time specs
+     * \param count number of elements in times and out
+     * \param tick_rate the number of ticks per second
+     * \param out array of at least count elements to fill with tick counts
+     */
+    static void to_ticks(
+        const time_spec_t* times, size_t count, double tick_rate, long long* out);
+
     /*!
      * Get the time as a real-valued seconds count.
      * Note: If this time_spec_t represents an absolute time,
@@ -43,6 +43,26 @@ public:
      */
     virtual bool gps_detected(void) = 0;
 
+    /*!
+     * Enable or disable background polling of the GPS device.
+     *
+     * When enabled, a background task continuously reads and parses the
+     * GPS output into a local cache, and all sensor getters become
+     * non-blocking lookups of the most recent data. This is useful for
+     * applications that query GPS sensors at a high rate (e.g., for
+     * position-stamping samples), which would otherwise pay the serial
+     * port latency on every query.
+     *
+     * Note: In this mode, the gps_time sensor returns the most recently
+     * received time sentence instead of waiting for the next one, and can
+     * thus lag the true GPS time by up to one sentence interval (typically
+     * one second). Disable background polling before using gps_time to set
+     * the device time.
+     *
+     * \param enable true to start background polling, false to stop it
+     */
+    virtual void set_background_polling(const bool enable) = 0;
+
     // TODO: other fun things you can do with a GPS.
 };
 
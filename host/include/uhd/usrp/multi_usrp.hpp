@@ -321,6 +321,31 @@ public:
      */
     virtual void set_time_unknown_pps(const time_spec_t& time_spec) = 0;
 
+    /*! Synchronize the times across all motherboards and report the skew.
+     *
+     * One-shot, faster variant of set_time_unknown_pps(). The sequence is
+     * the same - catch a PPS edge on motherboard 0, then latch \p time_spec
+     * on the following edge - but the time set is armed on all motherboards
+     * in parallel, the verification waits for the edge that actually latches
+     * the time instead of sleeping for a full second, and the time registers
+     * are read back from all motherboards concurrently. The total duration
+     * is therefore bounded by two PPS intervals regardless of the number of
+     * devices.
+     *
+     * \b Note: When changing clock sources, a previously set time will most
+     * likely be lost. It is recommended to set the time after changing the
+     * clock source. Otherwise, an unexpected time may line up with future PPS
+     * edges.
+     *
+     * \param time_spec the time to latch at the next pps after catching the edge
+     * \return the measured time offset of every motherboard relative to
+     *         motherboard 0, in seconds (entry 0 is always 0.0). The offsets
+     *         include the control round-trip jitter of the readback, so they
+     *         indicate skew on the order of the round-trip time and above.
+     * \throws uhd::runtime_error if no PPS edge is detected on motherboard 0
+     */
+    virtual std::vector<double> sync_time_unknown_pps(const time_spec_t& time_spec) = 0;
+
     /*!
      * Are the times across all motherboards in this configuration synchronized?
      * Checks that all time registers are approximately close but not exact,
@@ -349,6 +374,45 @@ public:
      */
     virtual void clear_command_time(size_t mboard = ALL_MBOARDS) = 0;
 
+    //! Operation type for one entry of a timed command batch
+    enum class batch_op_t { RX_FREQ, TX_FREQ, RX_GAIN, TX_GAIN, RX_ANTENNA, TX_ANTENNA };
+
+    /*! One entry of a timed command batch (see run_command_batch())
+     */
+    struct batch_entry_t
+    {
+        //! Time at which this command takes effect
+        time_spec_t time;
+        //! Channel index this command applies to
+        size_t chan = 0;
+        //! Which operation to run
+        batch_op_t op = batch_op_t::RX_FREQ;
+        //! Value for the numeric operations (frequency in Hz, gain in dB)
+        double value = 0.0;
+        //! Value for the string operations (antenna name)
+        std::string str_value;
+    };
+
+    /*! Run a batch of timed commands in one pass
+     *
+     * The batch is issued in time order with a single set_command_time() per
+     * distinct timestamp, and the command time is cleared once after the last
+     * entry. Compared to interleaving set_command_time()/setter/
+     * clear_command_time() per hop, this halves the command time round trips
+     * and lets commands sharing a timestamp ride the same command time, which
+     * matters for dense frequency hop plans. The commands queue up in the
+     * device's timed command queue and take effect at their respective times;
+     * this call returns once all commands have been issued, not when they
+     * take effect.
+     *
+     * Errors from the underlying setters propagate to the caller; the command
+     * time is cleared before re-throwing, and the remaining entries of the
+     * batch are not issued.
+     *
+     * \param batch the commands to run; sorted by time internally
+     */
+    void run_command_batch(std::vector<batch_entry_t> batch);
+
     /*!
      * Issue a stream command to the usrp device.
      * This tells the usrp to send samples into the host.
@@ -105,6 +105,25 @@ typedef struct uhd_rx_streamer* uhd_rx_streamer_handle;
  */
 typedef struct uhd_tx_streamer* uhd_tx_streamer_handle;
 
+struct uhd_rx_streamer_fast;
+struct uhd_tx_streamer_fast;
+
+//! Fast-path handle bound to an RX streamer
+/*!
+ * Binds the streamer pointer, channel count, and a caller-owned buffer array
+ * once at creation so that uhd_rx_streamer_recv_fast() can skip the per-call
+ * handle resolution, buffer re-marshaling, and success-path error-string
+ * formatting of uhd_rx_streamer_recv(). The parent streamer handle must
+ * outlive the fast handle.
+ */
+typedef struct uhd_rx_streamer_fast* uhd_rx_streamer_fast_handle;
+
+//! Fast-path handle bound to a TX streamer
+/*!
+ * See uhd_rx_streamer_fast_handle; this is the send-side equivalent.
+ */
+typedef struct uhd_tx_streamer_fast* uhd_tx_streamer_fast_handle;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -174,6 +193,41 @@ UHD_API uhd_error uhd_rx_streamer_issue_stream_cmd(
 UHD_API uhd_error uhd_rx_streamer_last_error(
     uhd_rx_streamer_handle h, char* error_out, size_t strbuffer_len);
 
+//! Create a fast-path handle bound to the given RX streamer
+/*!
+ * \param h RX streamer handle; must already be associated with a stream and
+ *          must outlive the fast handle
+ * \param buffs preallocated receive buffers, one per channel; the pointers
+ *              are captured at this call and reused on every recv
+ * \param fh_out pointer to output fast handle
+ */
+UHD_API uhd_error uhd_rx_streamer_fast_make(
+    uhd_rx_streamer_handle h, void** buffs, uhd_rx_streamer_fast_handle* fh_out);
+
+//! Free a fast-path RX streamer handle (does not free the parent streamer)
+UHD_API uhd_error uhd_rx_streamer_fast_free(uhd_rx_streamer_fast_handle* fh);
+
+//! Receive into the buffers registered with the fast handle
+/*!
+ * Identical semantics to uhd_rx_streamer_recv(), minus the per-call
+ * overheads: no handle table lookup, no buffer re-marshaling, and no error
+ * string writes on success. On error, the error string is saved to the
+ * parent streamer handle as usual.
+ *
+ * \param fh fast RX streamer handle
+ * \param samps_per_buff max number of samples per buffer
+ * \param md handle to RX metadata in which to receive results
+ * \param timeout timeout in seconds to wait for a packet
+ * \param one_packet recv a single packet
+ * \param items_recvd pointer to output variable for number of samples received
+ */
+UHD_API uhd_error uhd_rx_streamer_recv_fast(uhd_rx_streamer_fast_handle fh,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle* md,
+    double timeout,
+    bool one_packet,
+    size_t* items_recvd);
+
 /*
  * TX Streamer
  */
@@ -237,6 +291,39 @@ UHD_API uhd_error uhd_tx_streamer_recv_async_msg(
 UHD_API uhd_error uhd_tx_streamer_last_error(
     uhd_tx_streamer_handle h, char* error_out, size_t strbuffer_len);
 
+//! Create a fast-path handle bound to the given TX streamer
+/*!
+ * \param h TX streamer handle; must already be associated with a stream and
+ *          must outlive the fast handle
+ * \param buffs preallocated send buffers, one per channel; the pointers are
+ *              captured at this call and reused on every send
+ * \param fh_out pointer to output fast handle
+ */
+UHD_API uhd_error uhd_tx_streamer_fast_make(
+    uhd_tx_streamer_handle h, const void** buffs, uhd_tx_streamer_fast_handle* fh_out);
+
+//! Free a fast-path TX streamer handle (does not free the parent streamer)
+UHD_API uhd_error uhd_tx_streamer_fast_free(uhd_tx_streamer_fast_handle* fh);
+
+//! Send from the buffers registered with the fast handle
+/*!
+ * Identical semantics to uhd_tx_streamer_send(), minus the per-call
+ * overheads: no handle table lookup, no buffer re-marshaling, and no error
+ * string writes on success. On error, the error string is saved to the
+ * parent streamer handle as usual.
+ *
+ * \param fh fast TX streamer handle
+ * \param samps_per_buff max number of samples per buffer
+ * \param md handle to TX metadata
+ * \param timeout timeout in seconds to wait for a packet
+ * \param items_sent pointer to output variable for number of samples sent
+ */
+UHD_API uhd_error uhd_tx_streamer_send_fast(uhd_tx_streamer_fast_handle fh,
+    size_t samps_per_buff,
+    uhd_tx_metadata_handle* md,
+    double timeout,
+    size_t* items_sent);
+
 #ifdef __cplusplus
 }
 #endif
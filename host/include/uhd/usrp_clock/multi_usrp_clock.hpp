@@ -11,6 +11,7 @@
 #include <uhd/device.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/sensors.hpp>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -88,6 +89,23 @@ public:
      * \return a vector of sensor names
      */
     virtual std::vector<std::string> get_sensor_names(size_t board = 0) = 0;
+
+    /*!
+     * Get an aggregated status report for all USRP Clocks.
+     *
+     * Reads every sensor of every board and returns one name/value map per
+     * board. The boards are probed concurrently (one worker per board), so
+     * the wall-clock cost of a health check over a large distribution tree
+     * is roughly that of the slowest single device instead of the sum of
+     * all of them.
+     *
+     * A failure to read any sensor fails the whole call: a single failing
+     * board re-throws its error unmodified, and multiple failures are
+     * combined into a uhd::runtime_error listing the failing boards.
+     *
+     * \return a vector of sensor name/value maps, indexed by board
+     */
+    virtual std::vector<std::map<std::string, sensor_value_t>> get_status(void) = 0;
 };
 
 }} // namespace uhd::usrp_clock
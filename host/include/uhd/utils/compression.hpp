@@ -0,0 +1,72 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! Chunked stream compressor
+ *
+ * Compresses independent chunks of a byte stream into standalone LZ4 or zstd
+ * frames. Both formats define a concatenation of frames as a valid stream, so
+ * a file (or datagram sequence) assembled from the output of compress() can
+ * be decoded with the standard command-line tools (`lz4 -d`, `zstd -d`) or
+ * the corresponding libraries; no UHD-specific container is involved.
+ *
+ * Chunked framing is what makes the compression pipelineable: chunks can be
+ * compressed by multiple threads in parallel and written in order, and a
+ * corrupted chunk loses only itself.
+ *
+ * Instances are cheap but not thread-safe; create one per worker thread.
+ * Codec support is determined at build time by the presence of liblz4 and
+ * libzstd.
+ */
+class UHD_API chunk_compressor : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<chunk_compressor>;
+
+    /*! Create a compressor for the given codec
+     *
+     * \param codec the codec name, "lz4" or "zstd"
+     * \param level the compression level (0 = codec default). Higher levels
+     *              trade throughput for ratio; for real-time capture the
+     *              default is usually the right choice.
+     * \throws uhd::runtime_error if the codec is unknown or was not compiled
+     *         into this build
+     */
+    static sptr make(const std::string& codec, int level = 0);
+
+    //! Return the codecs compiled into this build (subset of {"lz4", "zstd"})
+    static std::vector<std::string> get_available_codecs(void);
+
+    virtual ~chunk_compressor(void) = default;
+
+    //! Return the worst-case compressed size of \p nbytes of input
+    virtual size_t bound(size_t nbytes) const = 0;
+
+    /*! Compress one chunk into a standalone frame
+     *
+     * \param dst destination buffer, at least bound(nbytes) bytes
+     * \param dst_capacity size of the destination buffer
+     * \param src source buffer
+     * \param nbytes number of input bytes to compress
+     * \return the size of the frame written to \p dst
+     * \throws uhd::runtime_error if compression fails (e.g. the destination
+     *         buffer is too small)
+     */
+    virtual size_t compress(
+        void* dst, size_t dst_capacity, const void* src, size_t nbytes) = 0;
+};
+
+} // namespace uhd
@@ -0,0 +1,111 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace uhd {
+
+/*! High-rate capture file writer
+ *
+ * Writes a sample byte stream to disk through a preallocated ring of aligned
+ * blocks serviced by a dedicated writer thread, so the receive thread never
+ * blocks on disk I/O. On Linux the file is opened with O_DIRECT (when the
+ * filesystem supports it), which bypasses the page cache and avoids the
+ * double-buffering that limits std::ofstream well below NVMe rates; the file
+ * extent can also be preallocated up front to avoid allocation stalls
+ * mid-capture.
+ *
+ * write() never blocks: if the disk cannot keep up and the ring fills, the
+ * excess bytes are dropped and accounted, mirroring how the device reports
+ * overflows when the host cannot keep up with the radio. Callers should
+ * report both get_bytes_dropped() and their rx_metadata overflow counts to
+ * characterize a capture.
+ *
+ * On platforms without O_DIRECT, the same ring and writer thread are used
+ * over regular buffered I/O.
+ */
+class UHD_API disk_writer : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<disk_writer>;
+
+    struct config_t
+    {
+        //! Path of the output file (created/truncated)
+        std::string path;
+        //! Bytes per ring block; also the size of each disk write. Must be a
+        //! multiple of 4096 for O_DIRECT. Larger blocks amortize per-write
+        //! syscall cost (default: 4 MiB).
+        size_t block_size = 4 * 1024 * 1024;
+        //! Ring depth in blocks; block_size * num_blocks bytes of buffering
+        //! absorb disk latency spikes (default: 64, i.e. 256 MiB)
+        size_t num_blocks = 64;
+        //! If non-zero, preallocate this many bytes of file extent up front
+        //! (Linux only); the file is trimmed to the true length on close()
+        uint64_t preallocate_bytes = 0;
+        //! Bypass the page cache with O_DIRECT where supported. Disable to
+        //! capture to filesystems that reject O_DIRECT (e.g. tmpfs).
+        bool direct_io = true;
+        //! Optional on-the-fly compression codec ("lz4" or "zstd"; empty
+        //! string disables compression). Ring blocks are compressed into
+        //! standalone frames by a pool of compressor threads before they hit
+        //! the disk, so the output file is a standard .lz4/.zst stream
+        //! decodable with the matching command-line tool. Compression implies
+        //! buffered I/O (frames are not sector-aligned); if the compressors
+        //! cannot keep up, the ring fills and write() drops as usual, it
+        //! never blocks. Codec availability is a build-time option, see
+        //! chunk_compressor.
+        std::string compression = "";
+        //! Compression level (0 = codec default)
+        int compression_level = 0;
+        //! Number of compressor threads (default: 2)
+        size_t compression_threads = 2;
+    };
+
+    /*! Create a disk writer and spawn its writer thread
+     *
+     * \throws uhd::io_error if the file cannot be opened or preallocated
+     */
+    static sptr make(const config_t& config);
+
+    virtual ~disk_writer(void) = default;
+
+    /*! Copy bytes into the ring for asynchronous writing
+     *
+     * Never blocks on disk I/O. If the ring is full, the remaining bytes are
+     * dropped and added to the drop counter.
+     *
+     * \param buff source buffer
+     * \param nbytes number of bytes to enqueue
+     * \return number of bytes accepted (== nbytes unless the ring was full)
+     */
+    virtual size_t write(const void* buff, size_t nbytes) = 0;
+
+    //! Number of bytes written to disk so far (post-compression when a
+    //! codec is configured)
+    virtual uint64_t get_bytes_written(void) const = 0;
+
+    //! Number of bytes dropped because the ring was full
+    virtual uint64_t get_bytes_dropped(void) const = 0;
+
+    /*! Flush remaining data, trim the file to its true length, and close it
+     *
+     * Blocks until the ring is drained. Called implicitly on destruction if
+     * not called explicitly; call explicitly to observe write errors.
+     *
+     * \throws uhd::io_error if a disk write failed during the capture
+     */
+    virtual void close(void) = 0;
+};
+
+} // namespace uhd
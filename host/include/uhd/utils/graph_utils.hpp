@@ -37,6 +37,10 @@ static const std::vector<block_port_def> TERMINATOR_BLOCKS{
  *  This function does not make the connections between blocks, it simply traverses the
  *  static connections.
  *
+ *  Because static connections are fixed for the lifetime of a graph, resolved
+ *  chains are cached per graph and repeat calls for the same route return the
+ *  cached result.
+ *
  *  \param graph The rfnoc_graph that is being examined
  *  \param start_block The block we begin to build the chain from
  *  \param port The block port of `src_port` that the path will begin at
@@ -50,6 +54,29 @@ std::vector<graph_edge_t> UHD_API get_block_chain(const rfnoc_graph::sptr graph,
     const size_t port,
     const bool source_chain);
 
+/*! Get a chain of blocks, preferring paths that avoid certain block types
+ *
+ * Like get_block_chain(), but when the chain reaches a switchboard, the
+ * branch whose downstream chain contains none of the block types listed in
+ * \p bypass_blocks is preferred over the straight-through branch. This is
+ * used, e.g., to route a radio directly to an SEP for full-rate capture,
+ * leaving the DDC out of the path where the image's static connections permit
+ * it. Note that this only selects the path; the switchboard must still be
+ * programmed to make it (see connect_through_blocks()).
+ *
+ *  \param graph The rfnoc_graph that is being examined
+ *  \param start_block The block we begin to build the chain from
+ *  \param port The block port of `src_port` that the path will begin at
+ *  \param source_chain Whether or not the `start_block` is a source
+ *  \param bypass_blocks Block names (e.g., "DDC") to route around if possible
+ *  \return The edge list representing the data path requested
+ */
+std::vector<graph_edge_t> UHD_API get_block_chain(const rfnoc_graph::sptr graph,
+    const block_id_t start_block,
+    const size_t port,
+    const bool source_chain,
+    const std::vector<std::string>& bypass_blocks);
+
 
 /*! Connect desired blocks by whatever path that can be found
  *
@@ -77,4 +104,92 @@ std::vector<graph_edge_t> UHD_API connect_through_blocks(rfnoc_graph::sptr graph
     const size_t dst_port,
     const bool skip_property_propagation = false);
 
+/*! Connect desired blocks, routing around certain block types where possible
+ *
+ * Like connect_through_blocks(), but the source chain is built with the
+ * bypass-aware get_block_chain() overload, and any switchboard on the chosen
+ * path is programmed to make the selected route. Block types that cannot be
+ * routed around (no switchboard branch avoids them) stay in the path as
+ * usual.
+ *
+ *  \param graph The rfnoc_graph that is being examined
+ *  \param src_blk Source block's ID
+ *  \param src_port Block port where the path starts
+ *  \param dst_blk Destination block's ID
+ *  \param dst_port Block port where the path ends
+ *  \param skip_property_propagation Declare back-edge
+ *  \param bypass_blocks Block names (e.g., "DDC") to route around if possible
+ *
+ *  \return The edge list representing the data path requested
+ */
+std::vector<graph_edge_t> UHD_API connect_through_blocks(rfnoc_graph::sptr graph,
+    const block_id_t src_blk,
+    const size_t src_port,
+    const block_id_t dst_blk,
+    const size_t dst_port,
+    const bool skip_property_propagation,
+    const std::vector<std::string>& bypass_blocks);
+
+/*! Description of a power-telemetry path
+ *
+ * A power-telemetry path is the standard decimating power-monitoring chain
+ * LogPwr -> MovingAverage -> KeepOneInN. This struct records which block
+ * instances (and channels) make up one such path, plus the edges that were
+ * connected to form it.
+ */
+struct power_telemetry_path_t
+{
+    //! The LogPwr block in this path
+    block_id_t logpwr_id;
+    size_t logpwr_port = 0;
+    //! The MovingAverage block in this path
+    block_id_t moving_average_id;
+    size_t moving_average_port = 0;
+    //! The KeepOneInN block in this path (its output is the decimated stats)
+    block_id_t keep_one_in_n_id;
+    size_t keep_one_in_n_port = 0;
+    //! All edges that were connected to form this path
+    std::vector<graph_edge_t> edges;
+};
+
+/*! Set up a power-telemetry path from a source block
+ *
+ * This finds unused LogPwr, MovingAverage, and KeepOneInN blocks on the same
+ * device as \p src_blk, configures all three up front (average length and
+ * divisor on the MovingAverage block, sample-mode decimation on the KeepOneInN
+ * block), and then connects src -> LogPwr -> MovingAverage -> KeepOneInN.
+ * Compared to configuring the three blocks individually, this runs the
+ * property cascade once per path instead of once per block, which matters when
+ * setting up many monitor channels.
+ *
+ *  \param graph The rfnoc_graph that is being configured
+ *  \param src_blk Source block's ID (e.g., a radio)
+ *  \param src_port Block port where the path starts
+ *  \param avg_len Number of power samples to average (also used as divisor)
+ *  \param decimation Keep one in \p decimation averaged samples
+ *
+ *  \return The blocks and edges making up this path
+ */
+power_telemetry_path_t UHD_API connect_power_telemetry_path(rfnoc_graph::sptr graph,
+    const block_id_t src_blk,
+    const size_t src_port,
+    const uint8_t avg_len,
+    const size_t decimation);
+
+/*! Create a single RX streamer serving multiple power-telemetry paths
+ *
+ * Creates an RX streamer with one channel per path and connects each path's
+ * KeepOneInN output to it, so all decimated power stats arrive through one
+ * streamer.
+ *
+ *  \param graph The rfnoc_graph that is being configured
+ *  \param paths The paths to stream from (see connect_power_telemetry_path())
+ *  \param args Stream arguments for the streamer
+ *
+ *  \return The RX streamer
+ */
+uhd::rx_streamer::sptr UHD_API create_power_telemetry_streamer(rfnoc_graph::sptr graph,
+    const std::vector<power_telemetry_path_t>& paths,
+    const uhd::stream_args_t& args);
+
 }} // namespace uhd::rfnoc
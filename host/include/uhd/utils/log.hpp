@@ -193,8 +193,15 @@ UHD_API void set_logger_level(const std::string& logger, uhd::log::severity_leve
 
 //! \cond
 //! Internal logging macro to be used in other macros
-#define _UHD_LOG_INTERNAL(component, level) \
-    uhd::_log::log(level, __FILE__, __LINE__, component, std::this_thread::get_id())
+//
+// The if/else dance makes runtime-dropped messages cost a single level
+// check: no stream object is constructed and the message expression is
+// never evaluated. The inner if always carries an else branch, so the
+// macro stays safe inside unbraced if/else statements at the call site.
+#define _UHD_LOG_INTERNAL(component, level)     \
+    if (!uhd::_log::log_level_enabled(level)) { \
+    } else                                      \
+        uhd::_log::log(level, __FILE__, __LINE__, component, std::this_thread::get_id())
 //! \endcond
 
 // macro-style logging (compile-time determined)
@@ -299,6 +306,13 @@ namespace _log {
 //! Fastpath logging
 void UHD_API log_fastpath(const std::string&);
 
+//! Returns true if \p level passes the global log level
+//
+// Called by the UHD_LOG* macros before any logging state is constructed,
+// so that messages below the runtime log level cost no more than this
+// check (a relaxed atomic load and a compare).
+bool UHD_API log_level_enabled(const uhd::log::severity_level level);
+
 //! Internal logging object (called by UHD_LOG* macros)
 class UHD_API log
 {
@@ -14,7 +14,10 @@
 #include <array>
 #include <ctime>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 CMRC_DECLARE(rc);
@@ -204,16 +207,47 @@ constexpr std::array<cal_data_fn_tuple, 3> data_fns{{
 // clang-format on
 
 
+/******************************************************************************
+ * In-process cache
+ *****************************************************************************/
+// Cal containers re-read their data through read_cal_data(), and on
+// multi-channel devices the same files get requested once per channel. The
+// data itself only changes when write_cal_data() is called, so we keep the
+// raw bytes around after the first lookup. Only source::ANY lookups are
+// cached: a request for a specific source must not be answered with data
+// that a previous lookup resolved from a different one.
+struct cal_data_cache_type
+{
+    std::mutex mutex;
+    //! Maps (key, serial) -> raw cal data
+    std::map<std::pair<std::string, std::string>, std::vector<uint8_t>> data;
+};
+UHD_SINGLETON_FCN(cal_data_cache_type, get_cal_data_cache);
+
 /******************************************************************************
  * cal::database implementation
  *****************************************************************************/
 std::vector<uint8_t> database::read_cal_data(
     const std::string& key, const std::string& serial, const source source_type)
 {
+    auto& cache = get_cal_data_cache();
+    if (source_type == source::ANY) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        const auto cache_it = cache.data.find({key, serial});
+        if (cache_it != cache.data.end()) {
+            return cache_it->second;
+        }
+    }
+
     for (auto& data_fn : data_fns) {
         if (source_type == source::ANY || source_type == std::get<0>(data_fn)) {
             if (std::get<1>(data_fn)(key, serial)) {
-                return std::get<2>(data_fn)(key, serial);
+                auto cal_data = std::get<2>(data_fn)(key, serial);
+                if (source_type == source::ANY) {
+                    std::lock_guard<std::mutex> lock(cache.mutex);
+                    cache.data[{key, serial}] = cal_data;
+                }
+                return cal_data;
             }
         }
     }
@@ -243,6 +277,13 @@ void database::write_cal_data(const std::string& key,
     const std::vector<uint8_t>& cal_data,
     const std::string& backup_ext)
 {
+    {
+        // Drop any cached data for this key so subsequent reads see the new file
+        auto& cache = get_cal_data_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.data.erase({key, serial});
+    }
+
     assert_cal_dir_exists();
 
     const auto cal_file_path =
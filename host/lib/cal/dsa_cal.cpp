@@ -9,9 +9,10 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
 #include <boost/range/adaptor/indexed.hpp>
+#include <algorithm>
 #include <array>
-#include <map>
 #include <string>
+#include <vector>
 
 using namespace uhd::usrp::cal;
 
@@ -58,7 +59,14 @@ public:
         const std::string& name,
         const std::array<std::array<uint32_t, num_dsa>, num_gain_stages> dsa_values)
     {
-        _data[max_freq] = name_dsas_pair(name, dsa_values);
+        const uint64_t freqi = static_cast<uint64_t>(max_freq);
+        const auto band_it   = _lower_bound_band(freqi);
+        if (band_it != _data.end() and band_it->max_freq == freqi) {
+            band_it->name = name;
+            band_it->dsas = dsa_values;
+        } else {
+            _data.insert(band_it, band_type{freqi, name, dsa_values});
+        }
     }
 
     const std::array<uint32_t, num_dsa> get_dsa_setting(
@@ -68,8 +76,7 @@ public:
             throw uhd::runtime_error("Cannot get DSA settings from an empty container.");
         }
         // find the lowest band with band_freq_max <= freq
-        const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto freq_it   = _data.lower_bound(freqi);
+        const auto freq_it = _lower_bound_band(static_cast<uint64_t>(freq));
         if (freq_it == _data.end()) {
             throw uhd::value_error("No DSA band found for freq " + std::to_string(freq));
         }
@@ -78,29 +85,26 @@ public:
             throw uhd::value_error(
                 "gain index " + std::to_string(gain_index) + " out of bounds.");
         }
-        return freq_it->second.second[gain_index];
+        return freq_it->dsas[gain_index];
     }
 
     bool is_same_band(double freq1, double freq2) const
     {
-        const uint64_t freqi1 = static_cast<uint64_t>(freq1);
-        const auto freq_it1   = _data.lower_bound(freqi1);
-        const uint64_t freqi2 = static_cast<uint64_t>(freq2);
-        const auto freq_it2   = _data.lower_bound(freqi2);
-        return freq_it1 == freq_it2;
+        return _lower_bound_band(static_cast<uint64_t>(freq1))
+               == _lower_bound_band(static_cast<uint64_t>(freq2));
     }
 
     std::vector<uint32_t> get_band_settings(double freq, uint8_t dsa) const
     {
         std::vector<uint32_t> result;
         // find the lowest band with band_freq_max <= freq
-        const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto freq_it   = _data.lower_bound(freqi);
+        const auto freq_it = _lower_bound_band(static_cast<uint64_t>(freq));
         if (freq_it == _data.end()) {
             throw uhd::value_error("No DSA band found for freq " + std::to_string(freq));
         }
         // select DSA setting using gain_index
-        for (auto item : freq_it->second.second) {
+        result.reserve(num_gain_stages);
+        for (const auto& item : freq_it->dsas) {
             result.push_back(item[dsa]);
         }
         return result;
@@ -123,18 +127,16 @@ public:
 
         std::vector<flatbuffers::Offset<BandDsaMap>> band_dsas;
         band_dsas.reserve(_data.size());
-        for (auto& band_dsas_pair : _data) {
-            const uint64_t freq = band_dsas_pair.first;
+        for (const auto& band : _data) {
             std::vector<flatbuffers::Offset<DsaStep>> dsa_steps;
-            auto name_dsas = band_dsas_pair.second;
-            for (auto const& values : name_dsas.second) // iterate over gain indizes
+            for (auto const& values : band.dsas) // iterate over gain indizes
             {
                 std::vector<uint32_t> steps(values.begin(), values.end());
                 dsa_steps.push_back(CreateDsaStepDirect(builder, &steps));
             }
 
             band_dsas.push_back(CreateBandDsaMapDirect(
-                builder, freq, &dsa_steps, name_dsas.first.c_str()));
+                builder, band.max_freq, &dsa_steps, band.name.c_str()));
         }
 
         // Now load it all into the FlatBuffer
@@ -209,10 +211,41 @@ private:
     std::string _serial;
     uint64_t _timestamp;
 
-    using dsa_steps      = std::array<std::array<uint32_t, num_dsa>, num_gain_stages>;
-    using name_dsas_pair = std::pair<std::string, dsa_steps>;
+    using dsa_steps = std::array<std::array<uint32_t, num_dsa>, num_gain_stages>;
+
+    //! One frequency band worth of DSA settings
+    struct band_type
+    {
+        uint64_t max_freq;
+        std::string name;
+        dsa_steps dsas;
+    };
+
+    //! Return an iterator to the lowest band with max_freq >= freq
+    typename std::vector<band_type>::iterator _lower_bound_band(const uint64_t freq)
+    {
+        return std::lower_bound(_data.begin(),
+            _data.end(),
+            freq,
+            [](const band_type& band, const uint64_t value) {
+                return band.max_freq < value;
+            });
+    }
+
+    typename std::vector<band_type>::const_iterator _lower_bound_band(
+        const uint64_t freq) const
+    {
+        return std::lower_bound(_data.begin(),
+            _data.end(),
+            freq,
+            [](const band_type& band, const uint64_t value) {
+                return band.max_freq < value;
+            });
+    }
 
-    std::map<uint64_t /* freq */, name_dsas_pair> _data;
+    //! The bands, as a flat array sorted by max_freq. Settings lookups run at
+    // gain-set time, so they binary-search this array instead of walking a map.
+    std::vector<band_type> _data;
 };
 
 } // namespace
@@ -10,8 +10,11 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/interpolation.hpp>
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace uhd::usrp::cal;
 using namespace uhd::math;
@@ -24,19 +27,77 @@ constexpr int NORMAL_TEMPERATURE = 20;
 constexpr size_t VERSION_MAJOR = 1;
 constexpr size_t VERSION_MINOR = 0;
 
-//! Return map with keys as values and vice versa
-template <typename map_type>
-map_type reverse_map(const map_type& map)
+//! A flat table of x/y points, sorted by x
+//
+// The gain/power curves are looked up on every gain or power setting, so we
+// keep them as sorted arrays: lookups are binary searches over contiguous
+// memory instead of tree walks, and never allocate.
+using flat_table_type = std::vector<std::pair<double, double>>;
+using flat_point_type = flat_table_type::value_type;
+
+//! Like get_bounding_iterators(), but on a flat table of pairs sorted by first
+//
+// If \p key is below the first or above the last x value, both returned
+// pointers reference the first or last point, respectively.
+template <typename flat_table>
+std::pair<const typename flat_table::value_type*, const typename flat_table::value_type*>
+get_bounding_points(
+    const flat_table& data, const typename flat_table::value_type::first_type key)
+{
+    using point_type = typename flat_table::value_type;
+    using key_type   = typename point_type::first_type;
+    auto next_it     = std::lower_bound(data.begin(),
+        data.end(),
+        key,
+        [](const point_type& point, const key_type value) { return point.first < value; });
+    if (next_it == data.end()) {
+        next_it--;
+        return {&*next_it, &*next_it};
+    }
+    auto prev_it = next_it;
+    if (prev_it != data.begin()) {
+        prev_it--;
+    }
+    return {&*prev_it, &*next_it};
+}
+
+//! Like at_lin_interp(), but on a flat sorted table
+double at_lin_interp_flat(const flat_table_type& data, const double key)
+{
+    const auto points = get_bounding_points(data, key);
+    if (points.first == points.second) {
+        return points.second->second;
+    }
+    return linear_interp(key,
+        points.first->first,
+        points.first->second,
+        points.second->first,
+        points.second->second);
+}
+
+//! Like at_nearest(), but on a flat sorted table
+double at_nearest_flat(const flat_table_type& data, const double key)
+{
+    const auto points = get_bounding_points(data, key);
+    if (points.first == points.second) {
+        return points.second->second;
+    }
+    return (points.second->first - key < key - points.first->first)
+               ? points.second->second
+               : points.first->second;
+}
+
+//! Exact lookup on a flat sorted table, like std::map::at()
+double at_key(const flat_table_type& data, const double key)
 {
-    map_type result;
-    std::transform(map.cbegin(),
-        map.cend(),
-        std::inserter(result, result.end()),
-        [](const typename map_type::value_type& entry) {
-            return std::pair<typename map_type::mapped_type, typename map_type::key_type>(
-                entry.second, entry.first);
+    const auto it = std::lower_bound(data.begin(),
+        data.end(),
+        key,
+        [](const flat_point_type& point, const double value) {
+            return point.first < value;
         });
-    return result;
+    UHD_ASSERT_THROW(it != data.end() and it->first == key);
+    return it->second;
 }
 
 } // namespace
@@ -87,8 +148,29 @@ public:
                             + std::to_string(max_power) + " dBm)"));
         }
         const int temp = bool(temperature) ? temperature.get() : _default_temp;
-        _data[temp][static_cast<uint64_t>(freq)] = {
-            gain_power_map, reverse_map(gain_power_map), min_power, max_power};
+        pwr_cal_table table;
+        table.g2p.assign(gain_power_map.begin(), gain_power_map.end());
+        table.p2g.reserve(table.g2p.size());
+        for (const auto& gain_power : table.g2p) {
+            table.p2g.emplace_back(gain_power.second, gain_power.first);
+        }
+        std::sort(table.p2g.begin(), table.p2g.end());
+        table.min_power = min_power;
+        table.max_power = max_power;
+
+        const uint64_t freqi = static_cast<uint64_t>(freq);
+        auto& freq_table     = _data[temp];
+        auto freq_it         = std::lower_bound(freq_table.begin(),
+            freq_table.end(),
+            freqi,
+            [](const freq_table_map::value_type& entry, const uint64_t value) {
+                return entry.first < value;
+            });
+        if (freq_it != freq_table.end() and freq_it->first == freqi) {
+            freq_it->second = std::move(table);
+        } else {
+            freq_table.emplace(freq_it, freqi, std::move(table));
+        }
     }
 
     // Note: This is very similar to at_bilin_interp(), but we can't use that
@@ -102,30 +184,32 @@ public:
         const uint64_t freqi = static_cast<uint64_t>(freq);
         const auto& table    = _get_table(temperature);
 
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
+        const auto f_iters          = get_bounding_points(table, freqi);
+        const uint64_t f1i          = f_iters.first->first;
+        const uint64_t f2i          = f_iters.second->first;
+        const flat_table_type& g2p1 = f_iters.first->second.g2p;
+        const flat_table_type& g2p2 = f_iters.second->second.g2p;
         // Frequency is out of bounds
         if (f1i == f2i) {
-            return at_lin_interp(table.at(f1i).g2p, gain);
+            return at_lin_interp_flat(g2p1, gain);
         }
-        const double f1       = static_cast<double>(f1i);
-        const double f2       = static_cast<double>(f2i);
-        const auto gain_iters = get_bounding_iterators(table.at(f1).g2p, gain);
-        const double gain1    = gain_iters.first->first;
-        const double gain2    = gain_iters.second->first;
+        const double f1        = static_cast<double>(f1i);
+        const double f2        = static_cast<double>(f2i);
+        const auto gain_points = get_bounding_points(g2p1, gain);
+        const double gain1     = gain_points.first->first;
+        const double gain2     = gain_points.second->first;
         // Gain is out of bounds
         if (gain1 == gain2) {
             return linear_interp(
-                freq, f1, table.at(f1i).g2p.at(gain1), f2, table.at(f2i).g2p.at(gain1));
+                freq, f1, gain_points.first->second, f2, at_key(g2p2, gain1));
         }
 
         // Both gain and freq are within bounds: Bi-Linear interpolation
         // Find power values
-        const auto power11 = table.at(f1i).g2p.at(gain1);
-        const auto power12 = table.at(f1i).g2p.at(gain2);
-        const auto power21 = table.at(f2i).g2p.at(gain1);
-        const auto power22 = table.at(f2i).g2p.at(gain2);
+        const double power11 = gain_points.first->second;
+        const double power12 = gain_points.second->second;
+        const double power21 = at_key(g2p2, gain1);
+        const double power22 = at_key(g2p2, gain2);
 
         return bilinear_interp(
             freq, gain, f1, gain1, f2, gain2, power11, power12, power21, power22);
@@ -159,7 +243,7 @@ public:
     uhd::meta_range_t get_power_limits(const double freq,
         const boost::optional<int> temperature = boost::none) const override
     {
-        const auto table = at_nearest(_get_table(temperature), uint64_t(freq));
+        const auto& table = _get_nearest_entry(_get_table(temperature), uint64_t(freq));
         return uhd::meta_range_t(table.min_power, table.max_power);
     }
 
@@ -172,12 +256,14 @@ public:
         const auto& table          = _get_table(temperature);
         const double power_coerced = get_power_limits(freq, temperature).clip(power_dbm);
 
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
+        const auto f_iters          = get_bounding_points(table, freqi);
+        const uint64_t f1i          = f_iters.first->first;
+        const uint64_t f2i          = f_iters.second->first;
+        const flat_table_type& p2g1 = f_iters.first->second.p2g;
+        const flat_table_type& p2g2 = f_iters.second->second.p2g;
         if (f1i == f2i) {
             // Frequency is out of bounds
-            return at_lin_interp(table.at(f1i).p2g, power_coerced);
+            return at_lin_interp_flat(p2g1, power_coerced);
         }
 
         // NOTE: bilinear_interp() does not interpolate on an arbitrary tetragon,
@@ -188,31 +274,31 @@ public:
         // nearest-neighbor-interpolate the grid coordinates for the power.
         // This snap-to-grid adds another error, which can be counteracted by
         // good choice of frequency and gain points on which to sample.
-        const auto f1pwr_iters = get_bounding_iterators(table.at(f1i).p2g, power_coerced);
-        const double f1pwr1    = f1pwr_iters.first->first;
-        const double f1pwr2    = f1pwr_iters.second->first;
-        const auto f2pwr_iters = get_bounding_iterators(table.at(f2i).p2g, power_coerced);
-        const double f2pwr1    = f2pwr_iters.first->first;
-        const double f2pwr2    = f2pwr_iters.second->first;
-        const double f1        = static_cast<double>(f1i);
-        const double f2        = static_cast<double>(f2i);
-        const double pwr1      = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
-        const double pwr2      = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
+        const auto f1pwr_points = get_bounding_points(p2g1, power_coerced);
+        const double f1pwr1     = f1pwr_points.first->first;
+        const double f1pwr2     = f1pwr_points.second->first;
+        const auto f2pwr_points = get_bounding_points(p2g2, power_coerced);
+        const double f2pwr1     = f2pwr_points.first->first;
+        const double f2pwr2     = f2pwr_points.second->first;
+        const double f1         = static_cast<double>(f1i);
+        const double f2         = static_cast<double>(f2i);
+        const double pwr1       = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
+        const double pwr2       = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
         // Power is out of bounds (this shouldn't happen after coercing, but this
         // is just another good sanity check on our data)
         if (pwr1 == pwr2) {
             return linear_interp(freq,
                 f1,
-                at_nearest(table.at(f1i).p2g, pwr1),
+                at_nearest_flat(p2g1, pwr1),
                 f2,
-                at_nearest(table.at(f2i).p2g, pwr2));
+                at_nearest_flat(p2g2, pwr2));
         }
         // Both gain and freq are within bounds => Bi-Linear interpolation
         // Find gain values:
-        const auto gain11 = table.at(f1i).p2g.at(f1pwr1);
-        const auto gain12 = table.at(f1i).p2g.at(f1pwr2);
-        const auto gain21 = table.at(f2i).p2g.at(f2pwr1);
-        const auto gain22 = table.at(f2i).p2g.at(f2pwr2);
+        const double gain11 = f1pwr_points.first->second;
+        const double gain12 = f1pwr_points.second->second;
+        const double gain21 = f2pwr_points.first->second;
+        const double gain22 = f2pwr_points.second->second;
         return bilinear_interp(
             freq, power_coerced, f1, pwr1, f2, pwr2, gain11, gain12, gain21, gain22);
     }
@@ -318,18 +404,43 @@ private:
     // the additional dependency.
     struct pwr_cal_table
     {
-        std::map<double, double> g2p; //!< Maps gain to power
-        std::map<double, double> p2g; //!< Maps power to gain
+        flat_table_type g2p; //!< Maps gain to power, sorted by gain
+        flat_table_type p2g; //!< Maps power to gain, sorted by power
         double min_power;
         double max_power;
     };
 
-    using freq_table_map = std::map<uint64_t /* freq */, pwr_cal_table>;
+    //! The per-frequency tables, as a flat array sorted by frequency
+    using freq_table_map = std::vector<std::pair<uint64_t /* freq */, pwr_cal_table>>;
 
-    freq_table_map _get_table(const boost::optional<int> temperature) const
+    //! Like at_nearest(), but returns a reference instead of copying the table
+    static const pwr_cal_table& _get_nearest_entry(
+        const freq_table_map& table, const uint64_t freq)
     {
+        const auto f_iters = get_bounding_points(table, freq);
+        if (f_iters.first->first == f_iters.second->first) {
+            return f_iters.second->second;
+        }
+        return (f_iters.second->first - freq < freq - f_iters.first->first)
+                   ? f_iters.second->second
+                   : f_iters.first->second;
+    }
+
+    const freq_table_map& _get_table(const boost::optional<int> temperature) const
+    {
+        UHD_ASSERT_THROW(!_data.empty());
         const int temp = bool(temperature) ? temperature.get() : _default_temp;
-        return at_nearest(_data, temp);
+        // Like at_nearest(), but without copying the nested tables
+        auto next_it = _data.lower_bound(temp);
+        if (next_it == _data.end()) {
+            return std::prev(next_it)->second;
+        }
+        if (next_it == _data.begin()) {
+            return next_it->second;
+        }
+        const auto prev_it = std::prev(next_it);
+        return (next_it->first - temp < temp - prev_it->first) ? next_it->second
+                                                               : prev_it->second;
     }
 
     std::string _name;
@@ -0,0 +1,115 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+DECLARE_CONVERTER_GUARDED(
+    sc16_item32_le, 1, fc64, 1, PRIORITY_AVX2, __builtin_cpu_supports("avx2"))
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor / (1 << 16));
+    const __m128i zeroi  = _mm_setzero_si128();
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration; AVX2-class CPUs handle unaligned
+    // loads at full speed, so there is no alignment dispatch as in the SSE2
+    // converters
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // unpack + swap 16-bit pairs
+        tmpi           = _mm_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi           = _mm_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i tmpilo = _mm_unpacklo_epi16(zeroi, tmpi); // value in upper 16 bits
+        __m128i tmpihi = _mm_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m256d tmplo = _mm256_mul_pd(_mm256_cvtepi32_pd(tmpilo), scalar);
+        __m256d tmphi = _mm256_mul_pd(_mm256_cvtepi32_pd(tmpihi), scalar);
+
+        // store to output
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 0), tmplo);
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 2), tmphi);
+    }
+
+    // convert remainder
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_GUARDED(
+    sc16_item32_be, 1, fc64, 1, PRIORITY_AVX2, __builtin_cpu_supports("avx2"))
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor / (1 << 16));
+    const __m128i zeroi  = _mm_setzero_si128();
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // byteswap + unpack -> byteswap 16 bit words
+        tmpi           = _mm_or_si128(_mm_srli_epi16(tmpi, 8), _mm_slli_epi16(tmpi, 8));
+        __m128i tmpilo = _mm_unpacklo_epi16(zeroi, tmpi); // value in upper 16 bits
+        __m128i tmpihi = _mm_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m256d tmplo = _mm256_mul_pd(_mm256_cvtepi32_pd(tmpilo), scalar);
+        __m256d tmphi = _mm256_mul_pd(_mm256_cvtepi32_pd(tmpihi), scalar);
+
+        // store to output
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 0), tmplo);
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 2), tmphi);
+    }
+
+    // convert remainder
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_GUARDED(
+    sc16_chdr, 1, fc64, 1, PRIORITY_AVX2, __builtin_cpu_supports("avx2"))
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc64_t* output      = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor / (1 << 16));
+    const __m128i zeroi  = _mm_setzero_si128();
+
+    size_t i = 0;
+
+    // convert 4 samples per iteration
+    for (; i + 3 < nsamps; i += 4) {
+        // load from input
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // unpack (value in upper 16 bits)
+        __m128i tmpilo = _mm_unpacklo_epi16(zeroi, tmpi);
+        __m128i tmpihi = _mm_unpackhi_epi16(zeroi, tmpi);
+
+        // convert and scale
+        __m256d tmplo = _mm256_mul_pd(_mm256_cvtepi32_pd(tmpilo), scalar);
+        __m256d tmphi = _mm256_mul_pd(_mm256_cvtepi32_pd(tmpihi), scalar);
+
+        // store to output
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 0), tmplo);
+        _mm256_storeu_pd(reinterpret_cast<double*>(output + i + 2), tmphi);
+    }
+
+    // convert remainder
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,144 @@
+//
+// Copyright 2025 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+// See ssse3_unpack_sc12.cpp for the derivation of these constants. The
+// byte shuffle operates per 128-bit lane, so both lanes use the same
+// indices and each lane processes one 3-line block independently.
+#define SC12_SHIFT_MASK 0x0fff0fff, 0x0fff0fff, 0xfff0fff0, 0xfff0fff0
+#define SC12_PACK_SHUFFLE1 5, 4, 8, 7, 11, 10, 14, 13, 6, 5, 9, 8, 12, 11, 15, 14
+
+/*
+ * Unpack two adjacent 3-line blocks (8 samples, 24 bytes) in one shot,
+ * going from packed 12-bit samples straight to scaled fc32 without the
+ * 16-byte load of the SSSE3 kernel wasting a quarter of its bandwidth.
+ * The dword permute drops one block into each 128-bit lane (reversing the
+ * line order the same way the SSSE3 kernel's epi32 shuffle does); the
+ * per-lane steps then mirror that kernel. The 32-byte load reaches 8
+ * bytes past the second block, so the caller must guarantee a third block
+ * of valid buffer exists.
+ */
+inline void convert_sc12_item32_3x2_to_fc32_8(
+    const item32_sc12_3x* input, fc32_t* out, const __m256 scalar)
+{
+    const __m256i perm = _mm256_setr_epi32(6, 2, 1, 0, 6, 5, 4, 3);
+    const __m256i mask = _mm256_set_epi32(SC12_SHIFT_MASK, SC12_SHIFT_MASK);
+    const __m256i shuf = _mm256_set_epi8(SC12_PACK_SHUFFLE1, SC12_PACK_SHUFFLE1);
+
+    __m256i m0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+    m0         = _mm256_permutevar8x32_epi32(m0, perm);
+    m0         = _mm256_shuffle_epi8(m0, shuf);
+    m0         = _mm256_and_si256(m0, mask);
+
+    // deinterleaved I (high bit aligned) and Q (4-bit offset) into the
+    // upper halves of int32 lanes, then re-interleave as I/Q pairs
+    const __m256i zeroi = _mm256_setzero_si256();
+    const __m256i mi    = _mm256_unpacklo_epi16(zeroi, m0);
+    __m256i mq          = _mm256_unpackhi_epi16(zeroi, m0);
+    mq                  = _mm256_slli_epi32(mq, 4);
+    const __m256i lo    = _mm256_unpacklo_epi32(mi, mq); // samples 0,1 / 4,5
+    const __m256i hi    = _mm256_unpackhi_epi32(mi, mq); // samples 2,3 / 6,7
+
+    const __m256i s0123 = _mm256_permute2x128_si256(lo, hi, 0x20);
+    const __m256i s4567 = _mm256_permute2x128_si256(lo, hi, 0x31);
+
+    _mm256_storeu_ps(reinterpret_cast<float*>(&out[0]),
+        _mm256_mul_ps(_mm256_cvtepi32_ps(s0123), scalar));
+    _mm256_storeu_ps(reinterpret_cast<float*>(&out[4]),
+        _mm256_mul_ps(_mm256_cvtepi32_ps(s4567), scalar));
+}
+
+DECLARE_CONVERTER_GUARDED(
+    sc12_item32_le, 1, fc32, 1, PRIORITY_AVX2, __builtin_cpu_supports("avx2"))
+{
+    // rewind to the head of a 3-line block, as in convert_unpack_sc12.cpp
+    const size_t head_samps = size_t(inputs[0]) & 0x3;
+    size_t rewind           = 0;
+    switch (head_samps) {
+        case 0:
+            break;
+        case 1:
+            rewind = 9;
+            break;
+        case 2:
+            rewind = 6;
+            break;
+        case 3:
+            rewind = 3;
+            break;
+    }
+
+    const item32_sc12_3x* input =
+        reinterpret_cast<const item32_sc12_3x*>(size_t(inputs[0]) - rewind);
+    fc32_t* output = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // the 12-bit fields grow by 16 when unpacked into int16, and by
+    // another 1 << 16 when moved into the upper half of each int32
+    const double scalar_d = scale_factor / 16;
+    const __m256 scalar   = _mm256_set1_ps(float(scalar_d) / (1 << 16));
+
+    fc32_t dummy;
+    size_t i = 0, o = 0;
+    switch (head_samps) {
+        case 0:
+            break; // no head
+        case 1:
+            convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(
+                input[i++], dummy, dummy, dummy, output[0], scalar_d);
+            break;
+        case 2:
+            convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(
+                input[i++], dummy, dummy, output[0], output[1], scalar_d);
+            break;
+        case 3:
+            convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(
+                input[i++], dummy, output[0], output[1], output[2], scalar_d);
+            break;
+    }
+    o += head_samps;
+
+    // convert the body two blocks at a time; stop early enough that the
+    // 32-byte load never reaches past blocks backed by real samples
+    while (o + 11 < nsamps) {
+        convert_sc12_item32_3x2_to_fc32_8(&input[i], &output[o], scalar);
+        i += 2;
+        o += 8;
+    }
+
+    // convert any remaining whole blocks one at a time
+    while (o + 3 < nsamps) {
+        convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(input[i],
+            output[o + 0],
+            output[o + 1],
+            output[o + 2],
+            output[o + 3],
+            scalar_d);
+        i++;
+        o += 4;
+    }
+
+    const size_t tail_samps = nsamps - o;
+    switch (tail_samps) {
+        case 0:
+            break; // no tail
+        case 1:
+            convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(
+                input[i], output[o + 0], dummy, dummy, dummy, scalar_d);
+            break;
+        case 2:
+            convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(
+                input[i], output[o + 0], output[o + 1], dummy, dummy, scalar_d);
+            break;
+        case 3:
+            convert_sc12_item32_3_to_star_4<float, uhd::wtohx>(
+                input[i], output[o + 0], output[o + 1], output[o + 2], dummy, scalar_d);
+            break;
+    }
+}
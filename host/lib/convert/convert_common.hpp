@@ -22,10 +22,15 @@
             return sptr(new name());                                          \
         }                                                                     \
         double scale_factor;                                                  \
+        bool nt_stores = false;                                               \
         void set_scalar(const double s)                                       \
         {                                                                     \
             scale_factor = s;                                                 \
         }                                                                     \
+        void set_nt_stores(const bool nt)                                     \
+        {                                                                     \
+            nt_stores = nt;                                                   \
+        }                                                                     \
         void operator()(const input_type&, const output_type&, const size_t); \
     };                                                                        \
     UHD_STATIC_BLOCK(__register_##name##_##prio)                              \
@@ -53,6 +58,8 @@
  * `num_out`
  * - `nsamps`: Number of items per input buffer to convert
  * - `scale_factor`: Scaling factor for float conversions
+ * - `nt_stores`: When true, the caller hinted that the output will not be
+ * read back soon; kernels that can should use non-temporal stores
  */
 #define DECLARE_CONVERTER(in_form, num_in, out_form, num_out, prio)                      \
     _DECLARE_CONVERTER(__convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio, \
@@ -62,6 +69,57 @@
         num_out,                                                                         \
         prio)
 
+#define _DECLARE_CONVERTER_GUARDED(                                           \
+    name, in_form, num_in, out_form, num_out, prio, guard)                    \
+    struct name : public uhd::convert::converter                              \
+    {                                                                         \
+        static sptr make(void)                                                \
+        {                                                                     \
+            return sptr(new name());                                          \
+        }                                                                     \
+        double scale_factor;                                                  \
+        bool nt_stores = false;                                               \
+        void set_scalar(const double s)                                       \
+        {                                                                     \
+            scale_factor = s;                                                 \
+        }                                                                     \
+        void set_nt_stores(const bool nt)                                     \
+        {                                                                     \
+            nt_stores = nt;                                                   \
+        }                                                                     \
+        void operator()(const input_type&, const output_type&, const size_t); \
+    };                                                                        \
+    UHD_STATIC_BLOCK(__register_##name##_##prio)                              \
+    {                                                                         \
+        if (!(guard)) {                                                       \
+            return;                                                           \
+        }                                                                     \
+        uhd::convert::id_type id;                                             \
+        id.input_format  = #in_form;                                          \
+        id.num_inputs    = num_in;                                            \
+        id.output_format = #out_form;                                         \
+        id.num_outputs   = num_out;                                           \
+        uhd::convert::register_converter(id, &name::make, prio);              \
+    }                                                                         \
+    void name::operator()(                                                    \
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+
+/*! Declare a single-function converter like DECLARE_CONVERTER, but only
+ * register it when \p guard evaluates to true at load time. This is used by
+ * SIMD converters built for instruction set extensions that have to be
+ * detected at runtime (e.g. AVX2), so that loading libuhd on an older CPU
+ * does not register kernels it cannot execute.
+ */
+#define DECLARE_CONVERTER_GUARDED(in_form, num_in, out_form, num_out, prio, guard)       \
+    _DECLARE_CONVERTER_GUARDED(                                                          \
+        __convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio,                \
+        in_form,                                                                         \
+        num_in,                                                                          \
+        out_form,                                                                        \
+        num_out,                                                                         \
+        prio,                                                                            \
+        guard)
+
 /***********************************************************************
  * Setup priorities
  **********************************************************************/
@@ -76,6 +134,9 @@ static const int PRIORITY_TABLE =
 // We used to have ORC, too, so SIMD is 3
 static const int PRIORITY_SIMD  = 3;
 static const int PRIORITY_TABLE = 1;
+// Wider-vector kernels (AVX2) outrank the baseline SIMD kernels; they are
+// only registered at load time on CPUs that support the instruction set
+static const int PRIORITY_AVX2 = 4;
 #endif
 
 /***********************************************************************
@@ -105,6 +166,17 @@ T clamp(const U v)
     return (v < min_t) ? min_t : (v > max_t) ? max_t : T(v);
 }
 
+/***********************************************************************
+ * Canonical scale factors
+ **********************************************************************/
+// The streamers use exactly these scale factors for the default sc16
+// wire format. The hot loops below compare against them and branch to a
+// kernel instantiated with the scale as a compile-time constant, so the
+// compiler can fold it into the vectorized loop instead of broadcasting
+// a runtime value.
+constexpr double sc16_full_scale    = 32767.0;
+constexpr double sc16_inverse_scale = 1.0 / 32767.0;
+
 /***********************************************************************
  * Convert xx to items32 sc16 buffer
  **********************************************************************/
@@ -125,12 +197,28 @@ UHD_INLINE item32_t xx_to_item32_sc16_x1(const sc16_t& num, const double)
     return (item32_t(real) << 16) | (item32_t(imag) << 0);
 }
 
+template <xtox_t to_wire, int scale_num, int scale_den, typename T>
+UHD_INLINE void xx_to_item32_sc16_fixed(
+    const std::complex<T>* input, item32_t* output, const size_t nsamps)
+{
+    constexpr double scale_factor = double(scale_num) / double(scale_den);
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item = xx_to_item32_sc16_x1(input[i], scale_factor);
+        output[i]           = to_wire(item);
+    }
+}
+
 template <xtox_t to_wire, typename T>
 UHD_INLINE void xx_to_item32_sc16(const std::complex<T>* input,
     item32_t* output,
     const size_t nsamps,
     const double scale_factor)
 {
+    // select a compile-time kernel for the canonical scale factor
+    if (scale_factor == sc16_full_scale) {
+        xx_to_item32_sc16_fixed<to_wire, 32767, 1>(input, output, nsamps);
+        return;
+    }
     for (size_t i = 0; i < nsamps; i++) {
         const item32_t item = xx_to_item32_sc16_x1(input[i], scale_factor);
         output[i]           = to_wire(item);
@@ -146,12 +234,27 @@ UHD_FORCE_INLINE sc16_t xx_to_sc16_x1(
     return sc16_t(real, imag);
 }
 
+template <int scale_num, int scale_den, typename T>
+UHD_FORCE_INLINE void xx_to_chdr_sc16_fixed(
+    const std::complex<T>* input, sc16_t* output, const size_t nsamps)
+{
+    constexpr double scale_factor = double(scale_num) / double(scale_den);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = xx_to_sc16_x1(input[i], scale_factor);
+    }
+}
+
 template <typename T>
 UHD_FORCE_INLINE void xx_to_chdr_sc16(const std::complex<T>* input,
     sc16_t* output,
     const size_t nsamps,
     const double scale_factor)
 {
+    // select a compile-time kernel for the canonical scale factor
+    if (scale_factor == sc16_full_scale) {
+        xx_to_chdr_sc16_fixed<32767, 1>(input, output, nsamps);
+        return;
+    }
     for (size_t i = 0; i < nsamps; i++) {
         output[i] = xx_to_sc16_x1(input[i], scale_factor);
     }
@@ -174,12 +277,28 @@ UHD_INLINE sc16_t item32_sc16_x1_to_xx(const item32_t item, const double)
     return sc16_t(int16_t(item >> 16), int16_t(item >> 0));
 }
 
+template <xtox_t to_host, int scale_num, int scale_den, typename T>
+UHD_INLINE void item32_sc16_to_xx_fixed(
+    const item32_t* input, std::complex<T>* output, const size_t nsamps)
+{
+    constexpr double scale_factor = double(scale_num) / double(scale_den);
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item_i = to_host(input[i]);
+        output[i]             = item32_sc16_x1_to_xx<T>(item_i, scale_factor);
+    }
+}
+
 template <xtox_t to_host, typename T>
 UHD_INLINE void item32_sc16_to_xx(const item32_t* input,
     std::complex<T>* output,
     const size_t nsamps,
     const double scale_factor)
 {
+    // select a compile-time kernel for the canonical scale factor
+    if (scale_factor == sc16_inverse_scale) {
+        item32_sc16_to_xx_fixed<to_host, 1, 32767>(input, output, nsamps);
+        return;
+    }
     for (size_t i = 0; i < nsamps; i++) {
         const item32_t item_i = to_host(input[i]);
         output[i]             = item32_sc16_x1_to_xx<T>(item_i, scale_factor);
@@ -194,12 +313,27 @@ UHD_FORCE_INLINE std::complex<T> chdr_sc16_x1_to_xx(
         T(item.real()) * T(scale_factor), T(item.imag()) * T(scale_factor));
 }
 
+template <int scale_num, int scale_den, typename T>
+UHD_FORCE_INLINE void chdr_sc16_to_xx_fixed(
+    const sc16_t* input, std::complex<T>* output, const size_t nsamps)
+{
+    constexpr double scale_factor = double(scale_num) / double(scale_den);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = chdr_sc16_x1_to_xx<T>(input[i], scale_factor);
+    }
+}
+
 template <typename T>
 UHD_FORCE_INLINE void chdr_sc16_to_xx(const sc16_t* input,
     std::complex<T>* output,
     const size_t nsamps,
     const double scale_factor)
 {
+    // select a compile-time kernel for the canonical scale factor
+    if (scale_factor == sc16_inverse_scale) {
+        chdr_sc16_to_xx_fixed<1, 32767>(input, output, nsamps);
+        return;
+    }
     for (size_t i = 0; i < nsamps; i++) {
         output[i] = chdr_sc16_x1_to_xx<T>(input[i], scale_factor);
     }
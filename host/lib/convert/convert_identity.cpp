@@ -0,0 +1,72 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/static.hpp>
+#include <cstring>
+
+using namespace uhd::convert;
+
+/*
+ * Identity converters for wire-format passthrough.
+ *
+ * Requesting the CPU format equal to the over-the-wire format (e.g. for
+ * recording raw sc16_item32_le data to disk) is a plain memcpy: the format
+ * name pins down the byte layout, so there is nothing to swap or scale.
+ * Without these registrations such a stream would fail converter lookup.
+ *
+ * The streamers additionally detect this case themselves and elide the
+ * converter dispatch, so these converters mostly serve to make the format
+ * pairing valid in the registry (and to serve any direct registry users).
+ */
+struct convert_identity : public converter
+{
+    convert_identity(const size_t bytes_per_item) : _bytes_per_item(bytes_per_item) {}
+
+    void set_scalar(const double) override
+    {
+        /* NOP */
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        std::memcpy(outputs[0], inputs[0], nsamps * _bytes_per_item);
+    }
+
+    const size_t _bytes_per_item;
+};
+
+UHD_STATIC_BLOCK(register_convert_identity)
+{
+    const char* formats[] = {
+        "sc8_item32_le",
+        "sc8_item32_be",
+        "sc12_item32_le",
+        "sc12_item32_be",
+        "sc16_item32_le",
+        "sc16_item32_be",
+        "fc32_item32_le",
+        "fc32_item32_be",
+    };
+
+    for (const char* format : formats) {
+        uhd::convert::id_type id;
+        id.num_inputs    = 1;
+        id.num_outputs   = 1;
+        id.input_format  = format;
+        id.output_format = format;
+        const std::string format_str(format);
+        uhd::convert::register_converter(
+            id,
+            [format_str](void) {
+                return converter::sptr(
+                    new convert_identity(uhd::convert::get_bytes_per_item(format_str)));
+            },
+            PRIORITY_GENERAL);
+    }
+}
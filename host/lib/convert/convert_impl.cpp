@@ -8,11 +8,26 @@
 #include <uhd/convert.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/types/dict.hpp>
+#include <uhd/utils/cast.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <uhdlib/utils/prefs.hpp>
 #include <stdint.h>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <complex>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    include <cpuid.h>
+#endif
 
 using namespace uhd;
 
@@ -68,6 +83,192 @@ void uhd::convert::register_converter(
     //----------------------------------------------------------------//
 }
 
+std::vector<convert::id_type> uhd::convert::get_ids(void)
+{
+    return get_table().keys();
+}
+
+std::vector<convert::priority_type> uhd::convert::get_priorities(const id_type& id)
+{
+    if (not get_table().has_key(id))
+        throw uhd::key_error("Cannot find a conversion routine for " + id.to_pp_string());
+    return get_table()[id].keys();
+}
+
+/***********************************************************************
+ * Optional converter micro-calibration
+ *
+ * With `calibrate=true` in the `[convert]` section of uhd.conf, the first
+ * best-priority lookup of a conversion ID times every registered candidate
+ * and picks the fastest one instead of trusting the static priorities.
+ * This catches builds where the nominally fastest kernel was compiled
+ * without its intended instruction set, or hardware where it simply loses.
+ * Winners are cached on disk per CPU model so the timing run only happens
+ * once per machine.
+ **********************************************************************/
+namespace {
+
+namespace fs = boost::filesystem;
+
+//! Number of samples per benchmark call; large enough to leave the
+// dispatch overhead in the noise, small enough to stay cache-resident
+constexpr size_t CAL_NUM_SAMPS = 16384;
+//! Number of timed calls per candidate
+constexpr size_t CAL_NUM_ITERS = 64;
+
+std::string cal_cpu_model(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    uint32_t brand[12] = {0};
+    if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004) {
+        __get_cpuid(0x80000002, &brand[0], &brand[1], &brand[2], &brand[3]);
+        __get_cpuid(0x80000003, &brand[4], &brand[5], &brand[6], &brand[7]);
+        __get_cpuid(0x80000004, &brand[8], &brand[9], &brand[10], &brand[11]);
+        std::string model(reinterpret_cast<const char*>(brand), sizeof(brand));
+        // the brand string is NUL-terminated and may be space-padded
+        model.erase(std::find(model.begin(), model.end(), '\0'), model.end());
+        while (not model.empty() and model.front() == ' ') {
+            model.erase(model.begin());
+        }
+        while (not model.empty() and model.back() == ' ') {
+            model.pop_back();
+        }
+        if (not model.empty()) {
+            return model;
+        }
+    }
+#endif
+    return "generic";
+}
+
+bool cal_enabled(void)
+{
+    return uhd::cast::from_str<bool>(uhd::prefs::get_uhd_config().get<std::string>(
+        "convert", "calibrate", "false"));
+}
+
+std::string cal_file_path(void)
+{
+    return (uhd::get_xdg_data_home() / "uhd" / "converter_cal.conf").string();
+}
+
+/*!
+ * Time one registered converter: average seconds per call over zero-filled
+ * buffers, or +inf if the item sizes are unknown and it cannot be timed.
+ */
+double cal_time_converter(const convert::id_type& id, const convert::priority_type prio)
+{
+    size_t bpi_in, bpi_out;
+    try {
+        bpi_in  = convert::get_bytes_per_item(id.input_format);
+        bpi_out = convert::get_bytes_per_item(id.output_format);
+    } catch (const uhd::key_error&) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    convert::converter::sptr conv = get_table()[id][prio]();
+    conv->set_scalar(32767.0);
+
+    std::vector<std::vector<char>> in_buffs(
+        id.num_inputs, std::vector<char>(CAL_NUM_SAMPS * bpi_in, 0));
+    std::vector<std::vector<char>> out_buffs(
+        id.num_outputs, std::vector<char>(CAL_NUM_SAMPS * bpi_out, 0));
+    std::vector<const void*> in_ptrs;
+    std::vector<void*> out_ptrs;
+    for (auto& buff : in_buffs) {
+        in_ptrs.push_back(buff.data());
+    }
+    for (auto& buff : out_buffs) {
+        out_ptrs.push_back(buff.data());
+    }
+
+    // one untimed call to warm caches and branch predictors
+    conv->conv(in_ptrs, out_ptrs, CAL_NUM_SAMPS);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < CAL_NUM_ITERS; i++) {
+        conv->conv(in_ptrs, out_ptrs, CAL_NUM_SAMPS);
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / CAL_NUM_ITERS;
+}
+
+/*!
+ * Return the calibrated priority for this ID: from the on-disk cache when
+ * an entry for this (ID, CPU model) exists, otherwise by timing every
+ * registered candidate and persisting the winner. Logs a warning whenever
+ * the winner is not the statically preferred priority.
+ */
+convert::priority_type cal_select_prio(
+    const convert::id_type& id, const convert::priority_type best_prio)
+{
+    static std::mutex mutex;
+    static bool cache_loaded = false;
+    static std::map<std::string, convert::priority_type> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (not cache_loaded) {
+        std::ifstream file(cal_file_path());
+        std::string line;
+        while (std::getline(file, line)) {
+            const size_t pos = line.rfind(" = ");
+            if (pos == std::string::npos) {
+                continue;
+            }
+            try {
+                cache[line.substr(0, pos)] = std::stoi(line.substr(pos + 3));
+            } catch (const std::exception&) {
+                // skip unparseable lines
+            }
+        }
+        cache_loaded = true;
+    }
+
+    const std::string key = cal_cpu_model() + " | " + id.to_string();
+    convert::priority_type winner;
+
+    if (cache.count(key) and get_table()[id].has_key(cache[key])) {
+        winner = cache[key];
+    } else {
+        // stale or missing entry: time every candidate
+        double best_time = std::numeric_limits<double>::infinity();
+        winner           = best_prio;
+        for (convert::priority_type prio_i : get_table()[id].keys()) {
+            const double time_i = cal_time_converter(id, prio_i);
+            UHD_LOGGER_DEBUG("CONVERT")
+                << boost::format("calibrate: %s prio %d: %.3f us/call") % id.to_string()
+                       % prio_i % (time_i * 1e6);
+            if (time_i < best_time) {
+                best_time = time_i;
+                winner    = prio_i;
+            }
+        }
+        if (std::isinf(best_time)) {
+            return best_prio; // could not benchmark this ID, keep the default
+        }
+        cache[key] = winner;
+        try {
+            fs::create_directories(fs::path(cal_file_path()).parent_path());
+            std::ofstream file(cal_file_path(), std::ios::app);
+            file << key << " = " << winner << std::endl;
+        } catch (const std::exception& e) {
+            UHD_LOGGER_WARNING("CONVERT")
+                << "calibrate: Cannot cache result: " << e.what();
+        }
+    }
+
+    if (winner != best_prio) {
+        UHD_LOGGER_WARNING("CONVERT")
+            << boost::format("calibrate: Default converter (prio %d) for %s "
+                             "underperforms on this CPU; using prio %d instead")
+                   % best_prio % id.to_string() % winner;
+    }
+    return winner;
+}
+
+} // namespace
+
 /***********************************************************************
  * The converter functions
  **********************************************************************/
@@ -102,6 +303,11 @@ convert::function_type convert::get_converter(const id_type& id, const priority_
         << " Using best available prio: " << best_prio;
     //----------------------------------------------------------------//
 
+    // opt-in: let measured timings override the static priorities
+    if (cal_enabled()) {
+        best_prio = cal_select_prio(id, best_prio);
+    }
+
     // otherwise, return best prio
     return get_table()[id][best_prio];
 }
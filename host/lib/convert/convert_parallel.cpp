@@ -0,0 +1,194 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/thread.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace uhd;
+
+namespace {
+
+// Chunk boundaries are rounded so that every per-channel byte offset is a
+// multiple of the cache line size; the worker threads then never touch the
+// same cache line and the split is invisible to the kernels.
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/*!
+ * A converter that splits the buffer across a pool of worker threads.
+ *
+ * Each thread owns its own instance of the underlying converter, created
+ * from the registry, and converts one contiguous chunk of the buffer. The
+ * calling thread converts the final chunk itself, so only num_threads - 1
+ * workers are spawned; they sleep on a condition variable between calls.
+ * Buffers too small to be worth the dispatch overhead are converted inline.
+ */
+class parallel_converter : public convert::converter
+{
+public:
+    parallel_converter(const convert::id_type& id,
+        const size_t num_threads,
+        const convert::priority_type prio)
+        : _num_threads(num_threads)
+        , _bpi_in(convert::get_bytes_per_item(id.input_format))
+        , _bpi_out(convert::get_bytes_per_item(id.output_format))
+        , _tasks(num_threads)
+    {
+        UHD_ASSERT_THROW(num_threads >= 2);
+
+        const auto factory = convert::get_converter(id, prio);
+        for (size_t i = 0; i < num_threads; i++) {
+            _converters.push_back(factory());
+        }
+
+        // Find the smallest sample count whose input and output byte sizes
+        // are both cache line multiples; chunk sizes are rounded to it
+        _samps_per_align = 1;
+        while ((_samps_per_align * _bpi_in) % CACHE_LINE_SIZE != 0
+               || (_samps_per_align * _bpi_out) % CACHE_LINE_SIZE != 0) {
+            _samps_per_align++;
+        }
+
+        for (size_t i = 0; i + 1 < num_threads; i++) {
+            _threads.emplace_back([this, i]() { this->_worker_loop(i); });
+            set_thread_name(&_threads.back(), "uhd_conv_" + std::to_string(i));
+        }
+    }
+
+    ~parallel_converter(void) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _start_cv.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void set_scalar(const double scalar) override
+    {
+        for (auto& converter : _converters) {
+            converter->set_scalar(scalar);
+        }
+    }
+
+    void set_nt_stores(const bool nt_stores) override
+    {
+        for (auto& converter : _converters) {
+            converter->set_nt_stores(nt_stores);
+        }
+    }
+
+private:
+    //! One thread's slice of the buffers for the current conversion
+    struct task_type
+    {
+        std::vector<const void*> inputs;
+        std::vector<void*> outputs;
+        size_t nsamps = 0;
+    };
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t chunk_samps =
+            ((nsamps / _num_threads) / _samps_per_align) * _samps_per_align;
+        if (chunk_samps == 0) {
+            _converters[0]->conv(inputs, outputs, nsamps);
+            return;
+        }
+
+        for (size_t i = 0; i < _num_threads; i++) {
+            task_type& task = _tasks[i];
+            task.inputs.clear();
+            task.outputs.clear();
+            for (size_t chan = 0; chan < inputs.size(); chan++) {
+                task.inputs.push_back(static_cast<const char*>(inputs[chan])
+                                      + i * chunk_samps * _bpi_in);
+            }
+            for (size_t chan = 0; chan < outputs.size(); chan++) {
+                task.outputs.push_back(static_cast<char*>(outputs[chan])
+                                       + i * chunk_samps * _bpi_out);
+            }
+            // The last chunk includes any samples left over from rounding
+            task.nsamps =
+                (i + 1 == _num_threads) ? nsamps - i * chunk_samps : chunk_samps;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pending = _num_threads - 1;
+            _generation++;
+        }
+        _start_cv.notify_all();
+
+        // The calling thread converts the last chunk itself
+        const task_type& task = _tasks[_num_threads - 1];
+        _converters[_num_threads - 1]->conv(task.inputs, task.outputs, task.nsamps);
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done_cv.wait(lock, [this]() { return _pending == 0; });
+    }
+
+    void _worker_loop(const size_t index)
+    {
+        uint64_t seen_generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _start_cv.wait(lock, [this, seen_generation]() {
+                    return _stop or _generation != seen_generation;
+                });
+                if (_stop) {
+                    return;
+                }
+                seen_generation = _generation;
+            }
+
+            const task_type& task = _tasks[index];
+            _converters[index]->conv(task.inputs, task.outputs, task.nsamps);
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _pending--;
+            }
+            _done_cv.notify_one();
+        }
+    }
+
+    const size_t _num_threads;
+    const size_t _bpi_in;
+    const size_t _bpi_out;
+    size_t _samps_per_align;
+    std::vector<sptr> _converters;
+    std::vector<task_type> _tasks;
+    std::vector<std::thread> _threads;
+
+    std::mutex _mutex;
+    std::condition_variable _start_cv;
+    std::condition_variable _done_cv;
+    uint64_t _generation = 0;
+    size_t _pending      = 0;
+    bool _stop           = false;
+};
+
+} // namespace
+
+convert::converter::sptr convert::get_parallel_converter(
+    const id_type& id, const size_t num_threads, const priority_type prio)
+{
+    if (num_threads < 2) {
+        return get_converter(id, prio)();
+    }
+    return converter::sptr(new parallel_converter(id, num_threads, prio));
+}
@@ -42,6 +42,16 @@ DECLARE_CONVERTER({fctype}, 1, sc16_chdr, 1, PRIORITY_GENERAL) {{
     const {fptype}* input = reinterpret_cast<const {fptype}*>(inputs[0]);
     int16_t* output = reinterpret_cast<int16_t*>(outputs[0]);
 
+    // select a compile-time kernel for the canonical scale factor
+    if (scale_factor == sc16_full_scale) {{
+        constexpr {fptype} scale = {fptype}(sc16_full_scale);
+        for (size_t i = 0; i < nsamps * 2; i += 2) {{
+            output[i]   = clamp<int16_t>(input[i] * scale);
+            output[i+1] = clamp<int16_t>(input[i + 1] * scale);
+        }}
+        return;
+    }}
+
     for (size_t i = 0; i < nsamps * 2; i += 2) {{
         output[i]   = clamp<int16_t>(input[i] * {fptype}(scale_factor));
         output[i+1] = clamp<int16_t>(input[i + 1] * {fptype}(scale_factor));
@@ -56,6 +66,16 @@ DECLARE_CONVERTER(sc16_chdr, 1, {fctype}, 1, PRIORITY_GENERAL) {{
     const int16_t* input = reinterpret_cast<const int16_t*>(inputs[0]);
     {fptype}* output = reinterpret_cast<{fptype}*>(outputs[0]);
 
+    // select a compile-time kernel for the canonical scale factor
+    if (scale_factor == sc16_inverse_scale) {{
+        constexpr {fptype} scale = {fptype}(sc16_inverse_scale);
+        for (size_t i = 0; i < nsamps * 2; i += 2) {{
+            output[i]   = static_cast<{fptype}>(input[i])   * scale;
+            output[i+1] = static_cast<{fptype}>(input[i+1]) * scale;
+        }}
+        return;
+    }}
+
     for (size_t i = 0; i < nsamps * 2; i += 2) {{
         output[i]   = static_cast<{fptype}>(input[i])   * {fptype}(scale_factor);
         output[i+1] = static_cast<{fptype}>(input[i+1]) * {fptype}(scale_factor);
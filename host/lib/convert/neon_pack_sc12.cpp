@@ -0,0 +1,194 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_pack_sc12.hpp"
+#include <arm_neon.h>
+
+/*
+ * Packing 4 samples into a 3 x 32-bit line block with NEON:
+ *
+ * The 8 I/Q values are first brought into a register where the I lanes hold
+ * the value high-bit-aligned (bits [15:4]) and the Q lanes hold the bare
+ * 12-bit field (bits [11:0]). In that layout every byte of the packed
+ * output is either a single byte of the register or the OR of two bytes, so
+ * two table lookups and an OR produce the complete 12-byte block, which is
+ * stored exactly (8 + 4 bytes) with no overwrite past the struct.
+ */
+static const int16_t sc12_pack_shift[8]  = {0, -4, 0, -4, 0, -4, 0, -4};
+static const uint8_t sc12_pack_table1[16] = {
+    5, 2, 0, 1, 8, 9, 6, 4, 14, 12, 13, 10, 255, 255, 255, 255};
+static const uint8_t sc12_pack_table2[16] = {
+    255, 255, 3, 255, 11, 255, 255, 7, 255, 15, 255, 255, 255, 255, 255, 255};
+
+static inline void pack_sc12_item32_3(const int16x8_t tmpi, item32_sc12_3x& output)
+{
+    // I lanes keep the high-aligned value, Q lanes become the 12-bit field
+    const uint16x8_t vals =
+        vshlq_u16(vreinterpretq_u16_s16(tmpi), vld1q_s16(sc12_pack_shift));
+
+    const uint8x16_t bytes  = vreinterpretq_u8_u16(vals);
+    const uint8x16_t packed = vorrq_u8(vqtbl1q_u8(bytes, vld1q_u8(sc12_pack_table1)),
+        vqtbl1q_u8(bytes, vld1q_u8(sc12_pack_table2)));
+
+    vst1_u8(reinterpret_cast<uint8_t*>(&output), vget_low_u8(packed));
+    vst1q_lane_u32(
+        reinterpret_cast<uint32_t*>(&output.line2), vreinterpretq_u32_u8(packed), 2);
+}
+
+template <typename type>
+inline void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
+    item32_sc12_3x& output,
+    const double scalar,
+    typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
+{
+    const float32x4_t tmplo =
+        vmulq_n_f32(vld1q_f32(reinterpret_cast<const float*>(&in[0])), float(scalar));
+    const float32x4_t tmphi =
+        vmulq_n_f32(vld1q_f32(reinterpret_cast<const float*>(&in[2])), float(scalar));
+
+    // convert and shift the values into the high 12 bits, with saturation
+    const int32x4_t tmpilo = vshlq_n_s32(vcvtq_s32_f32(tmplo), 4);
+    const int32x4_t tmpihi = vshlq_n_s32(vcvtq_s32_f32(tmphi), 4);
+    const int16x8_t tmpi =
+        vandq_s16(vcombine_s16(vqmovn_s32(tmpilo), vqmovn_s32(tmpihi)),
+            vdupq_n_s16(int16_t(0xfff0)));
+
+    pack_sc12_item32_3(tmpi, output);
+}
+
+template <typename type>
+inline void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
+    item32_sc12_3x& output,
+    const double,
+    typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
+{
+    const int16x8_t tmpi =
+        vandq_s16(vld1q_s16(reinterpret_cast<const int16_t*>(in)),
+            vdupq_n_s16(int16_t(0xfff0)));
+
+    pack_sc12_item32_3(tmpi, output);
+}
+
+template <typename type, towire32_type towire>
+struct convert_star_1_to_sc12_item32_3 : public converter
+{
+    convert_star_1_to_sc12_item32_3(void) : _scalar(0.0) {}
+
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const std::complex<type>* input =
+            reinterpret_cast<const std::complex<type>*>(inputs[0]);
+
+        const size_t head_samps = size_t(outputs[0]) & 0x3;
+        int enable;
+        size_t rewind = 0;
+        switch (head_samps) {
+            case 0:
+                break;
+            case 1:
+                rewind = 9;
+                break;
+            case 2:
+                rewind = 6;
+                break;
+            case 3:
+                rewind = 3;
+                break;
+        }
+        item32_sc12_3x* output =
+            reinterpret_cast<item32_sc12_3x*>(size_t(outputs[0]) - rewind);
+
+        // helper variables
+        size_t i = 0, o = 0;
+
+        // handle the head case
+        switch (head_samps) {
+            case 0:
+                break; // no head
+            case 1:
+                enable = CONVERT12_LINE2;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    0, 0, 0, input[0], enable, output[o++], _scalar);
+                break;
+            case 2:
+                enable = CONVERT12_LINE2 | CONVERT12_LINE1;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    0, 0, input[0], input[1], enable, output[o++], _scalar);
+                break;
+            case 3:
+                enable = CONVERT12_LINE2 | CONVERT12_LINE1 | CONVERT12_LINE0;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    0, input[0], input[1], input[2], enable, output[o++], _scalar);
+                break;
+        }
+        i += head_samps;
+
+        // The NEON kernel writes exactly 12 bytes per block, so the body
+        // loop can run up to the last full block of 4 samples.
+        while (i + 3 < nsamps) {
+            convert_star_4_to_sc12_item32_3<type>(&input[i], output[o], _scalar);
+            o++;
+            i += 4;
+        }
+
+        // handle the tail case
+        const size_t tail_samps = nsamps - i;
+        switch (tail_samps) {
+            case 0:
+                break; // no tail
+            case 1:
+                enable = CONVERT12_LINE0;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    input[i + 0], 0, 0, 0, enable, output[o], _scalar);
+                break;
+            case 2:
+                enable = CONVERT12_LINE0 | CONVERT12_LINE1;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    input[i + 0], input[i + 1], 0, 0, enable, output[o], _scalar);
+                break;
+            case 3:
+                enable = CONVERT12_LINE0 | CONVERT12_LINE1 | CONVERT12_LINE2;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    input[i + 0], input[i + 1], input[i + 2], 0, enable, output[o], _scalar);
+                break;
+        }
+    }
+
+    double _scalar;
+};
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(new convert_star_1_to_sc12_item32_3<float, uhd::htowx>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(new convert_star_1_to_sc12_item32_3<short, uhd::htowx>());
+}
+
+UHD_STATIC_BLOCK(register_neon_pack_sc12)
+{
+    uhd::convert::id_type id;
+    id.num_inputs    = 1;
+    id.num_outputs   = 1;
+    id.input_format  = "fc32";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD);
+
+    id.input_format  = "sc16";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD);
+}
@@ -0,0 +1,180 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <arm_neon.h>
+
+using namespace uhd::convert;
+
+/*
+ * Unpacking a 3 x 32-bit line block into 4 samples with NEON:
+ *
+ * The 12 packed bytes are loaded and a table lookup gathers, for each of the
+ * 8 I/Q values, the two bytes that contain its 12 bits into one 16-bit lane
+ * (a 16-byte load is used; reading up to 4 bytes past the block is safe
+ * within a managed buffer, as described in convert_unpack_sc12.cpp).
+ *
+ * After the gather, the I values sit in bits [15:4] of their lanes and the
+ * Q values in bits [11:0], so a per-lane left shift of {0, 4} followed by a
+ * 0xfff0 mask yields all values as high-bit-aligned int16, matching the
+ * scalar converter.
+ */
+static const uint8_t sc12_unpack_table[16] = {
+    2, 3, 1, 2, 7, 0, 6, 7, 4, 5, 11, 4, 9, 10, 8, 9};
+static const int16_t sc12_unpack_shift[8] = {0, 4, 0, 4, 0, 4, 0, 4};
+
+static inline int16x8_t unpack_sc12_item32_3(const item32_sc12_3x& input)
+{
+    const uint8x16_t raw = vld1q_u8(reinterpret_cast<const uint8_t*>(&input));
+    const uint8x16_t gathered = vqtbl1q_u8(raw, vld1q_u8(sc12_unpack_table));
+
+    int16x8_t tmpi = vreinterpretq_s16_u8(gathered);
+    tmpi           = vshlq_s16(tmpi, vld1q_s16(sc12_unpack_shift));
+    return vandq_s16(tmpi, vdupq_n_s16(int16_t(0xfff0)));
+}
+
+template <typename type, tohost32_type tohost>
+inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
+    std::complex<type>* out,
+    double scalar,
+    typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
+{
+    const int16x8_t tmpi = unpack_sc12_item32_3(input);
+
+    const int32x4_t tmpilo = vmovl_s16(vget_low_s16(tmpi));
+    const int32x4_t tmpihi = vmovl_s16(vget_high_s16(tmpi));
+
+    const float32x4_t tmplo = vmulq_n_f32(vcvtq_f32_s32(tmpilo), float(scalar));
+    const float32x4_t tmphi = vmulq_n_f32(vcvtq_f32_s32(tmpihi), float(scalar));
+
+    vst1q_f32(reinterpret_cast<float*>(&out[0]), tmplo);
+    vst1q_f32(reinterpret_cast<float*>(&out[2]), tmphi);
+}
+
+template <typename type, tohost32_type tohost>
+inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
+    std::complex<type>* out,
+    double,
+    typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
+{
+    vst1q_s16(reinterpret_cast<int16_t*>(out), unpack_sc12_item32_3(input));
+}
+
+template <typename type, tohost32_type tohost>
+struct convert_sc12_item32_1_to_star_3 : public converter
+{
+    convert_sc12_item32_1_to_star_3(void) : _scalar(0.0)
+    {
+        // NOP
+    }
+
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t head_samps = size_t(inputs[0]) & 0x3;
+        size_t rewind           = 0;
+        switch (head_samps) {
+            case 0:
+                break;
+            case 1:
+                rewind = 9;
+                break;
+            case 2:
+                rewind = 6;
+                break;
+            case 3:
+                rewind = 3;
+                break;
+        }
+
+        const item32_sc12_3x* input =
+            reinterpret_cast<const item32_sc12_3x*>(size_t(inputs[0]) - rewind);
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        std::complex<type> dummy;
+        size_t i = 0, o = 0;
+        switch (head_samps) {
+            case 0:
+                break; // no head
+            case 1:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, dummy, dummy, output[0], _scalar);
+                break;
+            case 2:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, dummy, output[0], output[1], _scalar);
+                break;
+            case 3:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, output[0], output[1], output[2], _scalar);
+                break;
+        }
+        o += head_samps;
+
+        // convert the body
+        while (o + 3 < nsamps) {
+            convert_sc12_item32_3_to_star_4<type, tohost>(input[i], &output[o], _scalar);
+            i += 1;
+            o += 4;
+        }
+
+        const size_t tail_samps = nsamps - o;
+        switch (tail_samps) {
+            case 0:
+                break; // no tail
+            case 1:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i], output[o + 0], dummy, dummy, dummy, _scalar);
+                break;
+            case 2:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i], output[o + 0], output[o + 1], dummy, dummy, _scalar);
+                break;
+            case 3:
+                convert_sc12_item32_3_to_star_4<type, tohost>(input[i],
+                    output[o + 0],
+                    output[o + 1],
+                    output[o + 2],
+                    dummy,
+                    _scalar);
+                break;
+        }
+    }
+
+    double _scalar;
+};
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_1(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_star_3<float, uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_star_3<short, uhd::wtohx>());
+}
+
+UHD_STATIC_BLOCK(register_neon_unpack_sc12)
+{
+    uhd::convert::id_type id;
+    id.num_inputs    = 1;
+    id.num_outputs   = 1;
+    id.output_format = "fc32";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD);
+
+    id.output_format = "sc16";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD);
+}
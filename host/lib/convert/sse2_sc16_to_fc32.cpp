@@ -11,6 +11,11 @@
 
 using namespace uhd::convert;
 
+// Conversions at least this large go through non-temporal stores even
+// without the caller's nt_stores hint; a single call of this size already
+// exceeds typical L2 and would only evict useful lines
+static const size_t nt_store_threshold = 1 << 20;
+
 DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
@@ -36,18 +41,25 @@ DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
         __m128 tmphi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);                    \
                                                                                        \
         /* store to output */                                                          \
-        _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);          \
-        _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 2), tmphi);          \
+        _mm_st##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);          \
+        _mm_st##_al_##ps(reinterpret_cast<float*>(output + i + 2), tmphi);          \
     }
 
     size_t i = 0;
 
+    const bool use_nt = nt_stores or (nsamps * sizeof(fc32_t) >= nt_store_threshold);
+
     // need to dispatch according to alignment for fastest conversion
     switch (size_t(output) & 0xf) {
         case 0x0:
             // the data is 16-byte aligned, so do the fast processing of the bulk of the
             // samples
-            convert_item32_1_to_fc32_1_nswap_guts(_) break;
+            if (use_nt) {
+                convert_item32_1_to_fc32_1_nswap_guts(ream_) _mm_sfence();
+            } else {
+                convert_item32_1_to_fc32_1_nswap_guts(ore_)
+            }
+            break;
         case 0x8:
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
@@ -55,11 +67,16 @@ DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
-            convert_item32_1_to_fc32_1_nswap_guts(_) break;
+            if (use_nt) {
+                convert_item32_1_to_fc32_1_nswap_guts(ream_) _mm_sfence();
+            } else {
+                convert_item32_1_to_fc32_1_nswap_guts(ore_)
+            }
+            break;
         default:
             // we are not 8 or 16-byte aligned, so do fast processing with the unaligned
             // load and store
-            convert_item32_1_to_fc32_1_nswap_guts(u_)
+            convert_item32_1_to_fc32_1_nswap_guts(oreu_)
     }
 
     // convert any remaining samples
@@ -90,18 +107,25 @@ DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
         __m128 tmphi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);                      \
                                                                                          \
         /* store to output */                                                            \
-        _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);            \
-        _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 2), tmphi);            \
+        _mm_st##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);            \
+        _mm_st##_al_##ps(reinterpret_cast<float*>(output + i + 2), tmphi);            \
     }
 
     size_t i = 0;
 
+    const bool use_nt = nt_stores or (nsamps * sizeof(fc32_t) >= nt_store_threshold);
+
     // need to dispatch according to alignment for fastest conversion
     switch (size_t(output) & 0xf) {
         case 0x0:
             // the data is 16-byte aligned, so do the fast processing of the bulk of the
             // samples
-            convert_item32_1_to_fc32_1_bswap_guts(_) break;
+            if (use_nt) {
+                convert_item32_1_to_fc32_1_bswap_guts(ream_) _mm_sfence();
+            } else {
+                convert_item32_1_to_fc32_1_bswap_guts(ore_)
+            }
+            break;
         case 0x8:
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
@@ -109,11 +133,16 @@ DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
-            convert_item32_1_to_fc32_1_bswap_guts(_) break;
+            if (use_nt) {
+                convert_item32_1_to_fc32_1_bswap_guts(ream_) _mm_sfence();
+            } else {
+                convert_item32_1_to_fc32_1_bswap_guts(ore_)
+            }
+            break;
         default:
             // we are not 8 or 16-byte aligned, so do fast processing with the unaligned
             // load and store
-            convert_item32_1_to_fc32_1_bswap_guts(u_)
+            convert_item32_1_to_fc32_1_bswap_guts(oreu_)
     }
 
     // convert any remaining samples
@@ -143,18 +172,25 @@ DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
         __m128 tmphi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);                    \
                                                                                        \
         /* store to output */                                                          \
-        _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);          \
-        _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 2), tmphi);          \
+        _mm_st##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);          \
+        _mm_st##_al_##ps(reinterpret_cast<float*>(output + i + 2), tmphi);          \
     }
 
     size_t i = 0;
 
+    const bool use_nt = nt_stores or (nsamps * sizeof(fc32_t) >= nt_store_threshold);
+
     // need to dispatch according to alignment for fastest conversion
     switch (size_t(output) & 0xf) {
         case 0x0:
             // the data is 16-byte aligned, so do the fast processing of the bulk of the
             // samples
-            convert_item32_1_to_fc32_1_guts(_) break;
+            if (use_nt) {
+                convert_item32_1_to_fc32_1_guts(ream_) _mm_sfence();
+            } else {
+                convert_item32_1_to_fc32_1_guts(ore_)
+            }
+            break;
         case 0x8:
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
@@ -162,11 +198,16 @@ DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
-            convert_item32_1_to_fc32_1_guts(_) break;
+            if (use_nt) {
+                convert_item32_1_to_fc32_1_guts(ream_) _mm_sfence();
+            } else {
+                convert_item32_1_to_fc32_1_guts(ore_)
+            }
+            break;
         default:
             // we are not 8 or 16-byte aligned, so do fast processing with the unaligned
             // load and store
-            convert_item32_1_to_fc32_1_guts(u_)
+            convert_item32_1_to_fc32_1_guts(oreu_)
     }
 
     // convert any remaining samples
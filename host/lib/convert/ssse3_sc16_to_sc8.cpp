@@ -0,0 +1,123 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <cmath>
+#include <tmmintrin.h>
+
+using namespace uhd::convert;
+
+static const __m128i zeroi = _mm_setzero_si128();
+
+/*
+ * SIMD replacement for the 64K-entry table converter for this pair (the
+ * table variant remains registered as fallback at PRIORITY_TABLE). The
+ * scaling runs through float to match the table's rounding, the packs
+ * saturate, and a byte shuffle produces the wire order in one step.
+ */
+
+//! Scalar tail helper, packs two samples into one item32 with scaling
+template <xtox_t to_wire>
+UHD_INLINE item32_t sc16_x2_to_item32_sc8(
+    const sc16_t& in0, const sc16_t& in1, const double scale)
+{
+    const uint8_t real1 = uint8_t(clamp<int8_t>(std::lround(in0.real() * scale)));
+    const uint8_t imag1 = uint8_t(clamp<int8_t>(std::lround(in0.imag() * scale)));
+    const uint8_t real0 = uint8_t(clamp<int8_t>(std::lround(in1.real() * scale)));
+    const uint8_t imag0 = uint8_t(clamp<int8_t>(std::lround(in1.imag() * scale)));
+    return to_wire((item32_t(real0) << 8) | (item32_t(imag0) << 0)
+                   | (item32_t(real1) << 24) | (item32_t(imag1) << 16));
+}
+
+//! Scale 4 samples of sc16 through float and return them as rounded,
+//! saturated int16 lanes
+UHD_INLINE __m128i scale_sc16_4x(const __m128i& in, const __m128& scalar)
+{
+    __m128i tmplo = _mm_unpacklo_epi16(zeroi, in); /* value in upper 16 bits */
+    __m128i tmphi = _mm_unpackhi_epi16(zeroi, in);
+
+    tmplo = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(tmplo), scalar));
+    tmphi = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(tmphi), scalar));
+
+    return _mm_packs_epi32(tmplo, tmphi);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    // the table converter scales by scalar / 32767; match it
+    const double scale  = scale_factor / 32767;
+    const __m128 scalar = _mm_set_ps1(float(scale) / (1 << 16));
+
+    size_t i = 0, o = 0;
+
+    // convert 8 samples (4 item32 outputs) per iteration; big-endian wire
+    // order is sample order in memory, so no shuffle is needed after packing
+    for (; i + 7 < nsamps; i += 8, o += 4) {
+        const __m128i in0 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 0));
+        const __m128i in1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4));
+
+        const __m128i tmpi =
+            _mm_packs_epi16(scale_sc16_4x(in0, scalar), scale_sc16_4x(in1, scalar));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + o), tmpi);
+    }
+
+    // convert remainder
+    const size_t num_pairs = nsamps / 2;
+    for (size_t j = i / 2; j < num_pairs; j++, i += 2) {
+        output[j] = sc16_x2_to_item32_sc8<uhd::htonx>(input[i], input[i + 1], scale);
+    }
+    if (nsamps != num_pairs * 2) {
+        output[num_pairs] =
+            sc16_x2_to_item32_sc8<uhd::htonx>(input[nsamps - 1], sc16_t(0, 0), scale);
+    }
+}
+
+DECLARE_CONVERTER(sc16, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    // the table converter scales by scalar / 32767; match it
+    const double scale  = scale_factor / 32767;
+    const __m128 scalar = _mm_set_ps1(float(scale) / (1 << 16));
+
+    // little-endian wire order reverses the bytes within each item32
+    const __m128i shuf =
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    size_t i = 0, o = 0;
+
+    // convert 8 samples (4 item32 outputs) per iteration
+    for (; i + 7 < nsamps; i += 8, o += 4) {
+        const __m128i in0 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 0));
+        const __m128i in1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4));
+
+        __m128i tmpi =
+            _mm_packs_epi16(scale_sc16_4x(in0, scalar), scale_sc16_4x(in1, scalar));
+        tmpi = _mm_shuffle_epi8(tmpi, shuf);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + o), tmpi);
+    }
+
+    // convert remainder
+    const size_t num_pairs = nsamps / 2;
+    for (size_t j = i / 2; j < num_pairs; j++, i += 2) {
+        output[j] = sc16_x2_to_item32_sc8<uhd::htowx>(input[i], input[i + 1], scale);
+    }
+    if (nsamps != num_pairs * 2) {
+        output[num_pairs] =
+            sc16_x2_to_item32_sc8<uhd::htowx>(input[nsamps - 1], sc16_t(0, 0), scale);
+    }
+}
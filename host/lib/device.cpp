@@ -11,12 +11,16 @@
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/transport/packet_tap.hpp>
+#include <uhdlib/usrp/common/transport_tune.hpp>
 #include <uhdlib/utils/prefs.hpp>
 #include <boost/functional/hash.hpp>
+#include <chrono>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <tuple>
 
 using namespace uhd;
@@ -57,6 +61,21 @@ static size_t hash_device_addr(const device_addr_t& dev_addr)
     return hash;
 }
 
+/*!
+ * Check if a discovered device address satisfies every key in the hint.
+ * If it does, the device the user asked for has been found and there is
+ * no point in waiting for the remaining discovery probes.
+ */
+static bool addr_matches_hint(const device_addr_t& hint, const device_addr_t& found)
+{
+    for (const std::string& key : hint.keys()) {
+        if (not found.has_key(key) or found[key] != hint[key]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /***********************************************************************
  * Registration
  **********************************************************************/
@@ -85,22 +104,72 @@ device_addrs_t device::find(const device_addr_t& hint, device_filter_t filter)
     std::lock_guard<std::mutex> lock(_device_mutex);
 
     device_addrs_t device_addrs;
-    std::vector<std::future<device_addrs_t>> find_tasks;
+    auto find_tasks = std::make_shared<std::vector<std::future<device_addrs_t>>>();
     for (const auto& fcn : get_dev_fcn_regs()) {
         if (filter == ANY or std::get<2>(fcn) == filter) {
-            find_tasks.emplace_back(std::async(
+            find_tasks->emplace_back(std::async(
                 std::launch::async, [fcn, hint]() { return std::get<0>(fcn)(hint); }));
         }
     }
-    for (auto& find_task : find_tasks) {
-        try {
-            device_addrs_t discovered_addrs = find_task.get();
-            device_addrs.insert(
-                device_addrs.begin(), discovered_addrs.begin(), discovered_addrs.end());
-        } catch (const std::exception& e) {
-            UHD_LOGGER_ERROR("UHD") << "Device discovery error: " << e.what();
+
+    // Collect the results as they come in. If a finder returns a device that
+    // satisfies every key in the hint, the device the user asked for has been
+    // found and we return early instead of waiting for the other finders to
+    // run out their full broadcast timeouts.
+    const bool can_exit_early = not hint.keys().empty();
+    std::vector<bool> collected(find_tasks->size(), false);
+    size_t num_collected = 0;
+    bool hint_matched    = false;
+    while (num_collected < find_tasks->size() and not hint_matched) {
+        for (size_t i = 0; i < find_tasks->size(); i++) {
+            if (collected[i]) {
+                continue;
+            }
+            auto& find_task = find_tasks->at(i);
+            if (find_task.wait_for(std::chrono::milliseconds(10))
+                != std::future_status::ready) {
+                continue;
+            }
+            collected[i] = true;
+            num_collected++;
+            try {
+                device_addrs_t discovered_addrs = find_task.get();
+                device_addrs.insert(device_addrs.begin(),
+                    discovered_addrs.begin(),
+                    discovered_addrs.end());
+                if (can_exit_early) {
+                    for (const device_addr_t& addr : discovered_addrs) {
+                        if (addr_matches_hint(hint, addr)) {
+                            hint_matched = true;
+                            break;
+                        }
+                    }
+                }
+            } catch (const std::exception& e) {
+                UHD_LOGGER_ERROR("UHD") << "Device discovery error: " << e.what();
+            }
+            if (hint_matched) {
+                break;
+            }
         }
     }
+    if (hint_matched and num_collected < find_tasks->size()) {
+        UHD_LOGGER_DEBUG("UHD")
+            << "Found device matching the full hint; draining the remaining "
+               "discovery probes in the background";
+        std::thread([find_tasks]() {
+            for (auto& find_task : *find_tasks) {
+                if (not find_task.valid()) {
+                    continue;
+                }
+                try {
+                    find_task.get();
+                } catch (...) {
+                    // Errors from probes we no longer care about
+                }
+            }
+        }).detach();
+    }
 
     // find might return duplicate entries if a device received a broadcast multiple
     // times. These entries needs to be removed from the result.
@@ -178,7 +247,13 @@ device::sptr device::make(const device_addr_t& hint, device_filter_t filter, siz
         // Add keys from the config files (note: the user-defined keys will
         // always be applied, see also get_usrp_args()
         // Then, create and register a new device.
-        device::sptr dev         = maker(prefs::get_usrp_args(dev_addr));
+        const device_addr_t usrp_args =
+            usrp::apply_transport_tune(prefs::get_usrp_args(dev_addr));
+        if (usrp_args.has_key("packet_tap")) {
+            transport::packet_tap::start(usrp_args.cast<size_t>("packet_tap", 1000),
+                usrp_args.get("packet_tap_file", ""));
+        }
+        device::sptr dev         = maker(usrp_args);
         hash_to_device[dev_hash] = dev;
         return dev;
     }
@@ -307,6 +307,7 @@ protected:
             EX_LOG(1, str(boost::format("added vertex %s") % data_node->get_name()));
             _datanode_map.insert(
                 vertex_map_t::value_type(data_node->get_name(), gr_node));
+            _sorted_nodes_valid = false;
 
             // Add resolve callbacks
             if (resolve_mode == AUTO_RESOLVE_ON_WRITE
@@ -355,6 +356,7 @@ protected:
                 boost::add_vertex(worker, _expert_dag);
             EX_LOG(1, str(boost::format("added vertex %s") % worker->get_name()));
             _worker_map.insert(vertex_map_t::value_type(worker->get_name(), gr_node));
+            _sorted_nodes_valid = false;
 
             // For each input, add an edge from the input to this node
             for (const std::string& node_name : worker->get_inputs()) {
@@ -427,31 +429,43 @@ protected:
         // Release all nodes in the map
         _worker_map.clear();
         _datanode_map.clear();
+
+        // Invalidate the cached resolution order
+        _sorted_nodes.clear();
+        _sorted_nodes_valid = false;
     }
 
 private:
     void _resolve_helper(std::string start, std::string stop, bool force)
     {
         // Sort the graph topologically. This ensures that for all dependencies, the
-        // dependant is always after all of its dependencies.
-        node_queue_t sorted_nodes;
-        try {
-            boost::topological_sort(_expert_dag, std::front_inserter(sorted_nodes));
-        } catch (boost::not_a_dag&) {
-            std::vector<std::string> back_edges;
-            cycle_det_visitor cdet_vis(back_edges);
-            boost::depth_first_search(_expert_dag, boost::visitor(cdet_vis));
-            if (not back_edges.empty()) {
-                std::string edges;
-                for (const std::string& e : back_edges) {
-                    edges += "* " + e + "";
+        // dependant is always after all of its dependencies. The order only depends
+        // on the graph structure, not on which nodes are dirty, so it is computed
+        // once and reused until the graph changes. Resolutions triggered per
+        // property write during a tune sequence then skip straight to the
+        // dirty-node walk below.
+        if (not _sorted_nodes_valid) {
+            _sorted_nodes.clear();
+            try {
+                boost::topological_sort(_expert_dag, std::front_inserter(_sorted_nodes));
+                _sorted_nodes_valid = true;
+            } catch (boost::not_a_dag&) {
+                std::vector<std::string> back_edges;
+                cycle_det_visitor cdet_vis(back_edges);
+                boost::depth_first_search(_expert_dag, boost::visitor(cdet_vis));
+                if (not back_edges.empty()) {
+                    std::string edges;
+                    for (const std::string& e : back_edges) {
+                        edges += "* " + e + "";
+                    }
+                    throw uhd::runtime_error(
+                        "Cannot resolve expert because it has at least one cycle!\n"
+                        "The following back-edges were found:"
+                        + edges);
                 }
-                throw uhd::runtime_error(
-                    "Cannot resolve expert because it has at least one cycle!\n"
-                    "The following back-edges were found:"
-                    + edges);
             }
         }
+        const node_queue_t& sorted_nodes = _sorted_nodes;
         if (sorted_nodes.empty())
             return;
 
@@ -467,7 +481,7 @@ private:
         // First Pass: Resolve all nodes if they are dirty, in a topological order
         std::list<dag_vertex_t*> resolved_workers;
         bool start_node_encountered = false;
-        for (node_queue_t::iterator node_iter = sorted_nodes.begin();
+        for (node_queue_t::const_iterator node_iter = sorted_nodes.begin();
              node_iter != sorted_nodes.end();
              ++node_iter) {
             // Determine if we are at or beyond the starting node
@@ -555,6 +569,10 @@ private:
         _datanode_map; // A map from vertex name to vertex descriptor for data nodes
     std::mutex _mutex;
     std::recursive_mutex _resolve_mutex;
+    // Cached topological order of the graph, invalidated whenever the graph
+    // structure changes (see _resolve_helper)
+    node_queue_t _sorted_nodes;
+    bool _sorted_nodes_valid = false;
 };
 
 expert_container::sptr expert_container::make(const std::string& name)
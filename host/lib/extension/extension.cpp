@@ -7,6 +7,7 @@
 #include <uhd/extension/extension.hpp>
 #include <uhd/utils/static.hpp>
 #include <uhdlib/extension/extension_factory.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <unordered_map>
 
 
@@ -35,6 +36,11 @@ void extension::register_extension(
 extension::factory_type extension_factory::get_extension_factory(
     const std::string& ext_name)
 {
+    if (!get_extension_registry().count(ext_name)) {
+        // Extensions usually live in modules whose loading is deferred until
+        // a factory is first requested; load them and look again
+        uhd::load_deferred_modules();
+    }
     if (!get_extension_registry().count(ext_name)) {
         UHD_LOG_WARNING(
             "EXTENSION_REGISTRY", "Could not find extension of name " << ext_name);
@@ -14,8 +14,10 @@ namespace uhd { namespace features {
 std::vector<std::string> discoverable_feature_registry::enumerate_features()
 {
     std::vector<std::string> features;
-    for (auto& entry : _features) {
-        features.push_back(entry.second->get_feature_name());
+    for (auto& feature : _features) {
+        if (feature) {
+            features.push_back(feature->get_feature_name());
+        }
     }
     return features;
 }
@@ -23,11 +25,11 @@ std::vector<std::string> discoverable_feature_registry::enumerate_features()
 discoverable_feature::sptr discoverable_feature_registry::get_feature_ptr(
     discoverable_feature::feature_id_t feature_id)
 {
-    auto it = _features.find(feature_id);
-    if (it == _features.end()) {
+    const size_t index = static_cast<size_t>(feature_id);
+    if (index >= _features.size()) {
         return discoverable_feature::sptr();
     }
-    return it->second;
+    return _features[index];
 }
 
 }} // namespace uhd::features
@@ -9,13 +9,17 @@
 #include <uhd/exception.hpp>
 #include <uhd/features/discoverable_feature.hpp>
 #include <uhd/features/discoverable_feature_getter_iface.hpp>
-#include <map>
 #include <memory>
 #include <vector>
 
 namespace uhd { namespace features {
 
-/*! Map-based registry to implement discoverable_feature_getter_iface
+/*! Registry to implement discoverable_feature_getter_iface
+ *
+ * Features are stored in a flat vector indexed directly by feature ID, so a
+ * lookup is a bounds check plus an array access. The registry is populated
+ * during device initialization and treated as immutable afterwards; entries
+ * are never removed.
  */
 class discoverable_feature_registry : public virtual discoverable_feature_getter_iface
 {
@@ -27,16 +31,19 @@ public:
     template <typename T>
     void register_feature(std::shared_ptr<T> feature)
     {
-        if (!_features.emplace(T::get_feature_id(), feature).second) {
-            UHD_ASSERT_THROW(false);
+        const size_t index = static_cast<size_t>(T::get_feature_id());
+        if (_features.size() <= index) {
+            _features.resize(index + 1);
         }
+        UHD_ASSERT_THROW(!_features[index]);
+        _features[index] = std::move(feature);
     }
 
 private:
     discoverable_feature::sptr get_feature_ptr(
         discoverable_feature::feature_id_t feature_id) override;
 
-    std::map<discoverable_feature::feature_id_t, discoverable_feature::sptr> _features;
+    std::vector<discoverable_feature::sptr> _features;
 };
 
 }} // namespace uhd::features
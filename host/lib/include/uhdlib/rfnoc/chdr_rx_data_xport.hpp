@@ -10,15 +10,24 @@
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/types/device_addr.hpp>
+#include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/rfnoc/rx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
+#include <atomic>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
+class chdr_ctrl_xport;
+
 namespace mgmt {
 class mgmt_portal;
 }
@@ -41,6 +50,11 @@ public:
     void set_capacity(const stream_buff_params_t& recv_capacity);
 
     /*! Send a flow control response packet
+     *
+     * The response is copied from the template packet serialized in
+     * set_capacity(); only the header sequence number and the payload
+     * transfer counts are rewritten, keeping this path cheap enough to sit
+     * in the RX hot loop.
      *
      * \param send_link the link to use to send the packet
      * \counts transfer counts for packet contents
@@ -52,18 +66,19 @@ public:
             throw uhd::runtime_error("rx_flowctrl timed out getting a send buffer");
         }
 
-        chdr::chdr_header header;
-        header.set_seq_num(_fc_seq_num++);
-        header.set_dst_epid(_dst_epid);
+        uint64_t* pkt = static_cast<uint64_t*>(buff->data());
+        std::memcpy(pkt, _fc_template.data(), _fc_packet_size);
 
-        chdr::strs_payload fc_payload(_fc_strs_pyld);
-        fc_payload.xfer_count_bytes = counts.bytes;
-        fc_payload.xfer_count_pkts  = counts.packets;
+        _fc_header.set_seq_num(_fc_seq_num++);
+        pkt[0] = _conv_from_host(_fc_header.pack());
 
-        _fc_packet->refresh(buff->data(), header, fc_payload);
-        const size_t size = header.get_length();
+        _fc_strs_pyld.xfer_count_bytes = counts.bytes;
+        _fc_strs_pyld.xfer_count_pkts  = counts.packets;
+        _fc_strs_pyld.serialize(pkt + _fc_pyld_offset_words,
+            _fc_packet_size - _fc_pyld_offset_words * sizeof(uint64_t),
+            _conv_from_host);
 
-        buff->set_packet_size(size);
+        buff->set_packet_size(_fc_packet_size);
         send_link->release_send_buff(std::move(buff));
     }
 
@@ -71,12 +86,27 @@ private:
     // Endpoint ID for recipient of flow control response
     const sep_id_t _dst_epid;
 
-    // Packet for writing flow control info
+    // Packet for serializing the flow control response template
     chdr::chdr_strs_packet::uptr _fc_packet;
 
     // Pre-configured strs payload to hold values that don't change
     chdr::strs_payload _fc_strs_pyld;
 
+    // Pre-serialized response packet, in wire byte order
+    std::vector<uint64_t> _fc_template;
+
+    // Size of the serialized response packet in bytes
+    size_t _fc_packet_size = 0;
+
+    // Offset of the strs payload within the packet, in 64-bit words
+    size_t _fc_pyld_offset_words = 0;
+
+    // Header of the response packet, with all fields but seq_num fixed
+    chdr::chdr_header _fc_header;
+
+    // Converter from host to wire byte order
+    std::function<uint64_t(uint64_t)> _conv_from_host;
+
     // Sequence number for flow control packets
     uint16_t _fc_seq_num = 0;
 };
@@ -121,6 +151,13 @@ public:
     {
         stream_buff_params_t buff_capacity;
         stream_buff_params_t freq;
+
+        // Handlers to re-arm the remote SEP in place after a link disruption
+        // (see reconnect()). They are populated by configure_sep() and hold a
+        // reference to the management portal, which is owned by the link
+        // stream manager and outlives the transport.
+        std::function<void(chdr_ctrl_xport&)> reconnect_start;
+        std::function<void(chdr_ctrl_xport&)> reconnect_commit;
     };
 
     /*! Configure stream endpoint route and flow control
@@ -165,6 +202,9 @@ public:
      * \param epids Source and destination endpoint IDs
      * \param num_recv_frames Num frames to reserve from the recv link
      * \param fc_params Parameters for flow control
+     * \param fc_poller Whether to register a dedicated poller with the I/O
+     *                  service that keeps flow control responses flowing while
+     *                  the consumer of this xport is stalled
      * \param disconnect Callback function to disconnect the links
      */
     chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
@@ -174,12 +214,25 @@ public:
         const uhd::rfnoc::sep_id_pair_t& epids,
         const size_t num_recv_frames,
         const fc_params_t& fc_params,
+        const bool fc_poller,
         disconnect_callback_t disconnect);
 
     /*! Destructor
      */
     ~chdr_rx_data_xport();
 
+    /*! Detach this transport from the I/O service
+     *
+     * Synchronously returns all held frame buffers and unregisters the
+     * receive clients, so that a successor stream (possibly reusing the
+     * same EPID) can be set up without this transport claiming its
+     * packets. The expensive part of teardown -- disconnecting the links
+     * -- still happens on destruction, which allows the destructor to be
+     * run from a background task (see the fast_teardown stream arg). The
+     * transport must not be used for streaming after this call.
+     */
+    void shutdown();
+
     /*! Returns MTU for this transport in bytes
      *
      * MTU is the max size for CHDR packets, including headers. For most
@@ -229,7 +282,19 @@ public:
     std::tuple<typename buff_t::uptr, packet_info_t, bool> get_recv_buff(
         const int32_t timeout_ms)
     {
-        buff_t::uptr buff = _recv_io->get_recv_buff(timeout_ms);
+        if (_recv_io2) {
+            return _get_recv_buff_striped(timeout_ms);
+        }
+
+        buff_t::uptr buff = _recv_io->get_recv_buff(0);
+
+        if (!buff) {
+            // Before waiting, hand any batched releases back to the I/O
+            // service: the device may be stalled on the flow control credit
+            // they carry (see release_recv_buff())
+            _flush_pending_releases();
+            buff = _recv_io->get_recv_buff(timeout_ms);
+        }
 
         if (!buff) {
             return std::make_tuple(typename buff_t::uptr(), packet_info_t(), false);
@@ -244,14 +309,164 @@ public:
     /*!
      * Releases an RX frame buffer
      *
+     * Releases are batched: buffers accumulate here and go back to the I/O
+     * service in groups bounded by the flow control update window, so that in
+     * offload mode the group costs a single cross-thread queue transaction
+     * instead of one per packet. Pending releases are flushed whenever
+     * get_recv_buff() runs out of packets, so a paused stream never sits on
+     * the flow control credit the device is waiting for.
+     *
      * \param buff the frame buffer to release
      */
     void release_recv_buff(typename buff_t::uptr buff)
     {
-        _recv_io->release_recv_buff(std::move(buff));
+        if (_recv_io2) {
+            // Striped streams release per-origin, without batching
+            auto it = _buff_origin.find(buff.get());
+            if (it != _buff_origin.end()) {
+                const size_t origin = it->second;
+                _buff_origin.erase(it);
+                if (origin == 1) {
+                    _recv_io2->release_recv_buff(std::move(buff));
+                    return;
+                }
+            }
+            _recv_io->release_recv_buff(std::move(buff));
+            return;
+        }
+        _release_pending.push_back(std::move(buff));
+        if (_release_pending.size() >= _release_batch_size) {
+            _flush_pending_releases();
+        }
+    }
+
+    /*! Add a second set of links carrying a stripe of this stream
+     *
+     * For streams whose rate exceeds a single link, the device may distribute
+     * the stream's packets across two links (the packets still carry this
+     * transport's EPID and one contiguous sequence number space). This method
+     * attaches the second link pair and enables a reorder stage that merges
+     * the stripes back into sequence order in get_recv_buff(). Both link
+     * pairs must be serviced by the same I/O service context so the shared
+     * flow control state is not accessed concurrently.
+     *
+     * \param io_srv The service that will schedule the second link pair's I/O
+     * \param recv_link The second recv link, already attached to the service
+     * \param send_link The second send link, already attached to the service
+     * \param num_recv_frames Num frames to reserve from the second recv link
+     * \param disconnect Callback function to disconnect the second link pair
+     */
+    void add_striped_link(uhd::transport::io_service::sptr io_srv,
+        uhd::transport::recv_link_if::sptr recv_link,
+        uhd::transport::send_link_if::sptr send_link,
+        const size_t num_recv_frames,
+        disconnect_callback_t disconnect);
+
+    /*! Re-arm the stream endpoint in place after a link disruption
+     *
+     * Re-programs the route to the remote SEP and re-runs the flow control
+     * handshake over the given control transport, without tearing down this
+     * transport or the graph it belongs to. Stale packets from before the
+     * disruption are discarded, and sequence tracking restarts at zero, so
+     * samples lost during the outage surface through the streamer's regular
+     * sequence error (overrun) reporting.
+     *
+     * \param ctrl_xport Control transport to run the management handshake on
+     * \param timeout_ms Time to drive the receive path waiting for the
+     *                   re-armed SEP's flow control init
+     * \throws uhd::runtime_error if this transport was created without
+     *         reconnect support or the handshake fails
+     */
+    void reconnect(chdr_ctrl_xport& ctrl_xport, const int32_t timeout_ms = 100);
+
+    /*! Returns whether this transport has detected that it needs a reconnect
+     *
+     * This is set when the remote SEP re-initializes outside of a reconnect,
+     * which indicates the stream state was lost (e.g., the device end was
+     * re-armed after a link disruption).
+     */
+    bool needs_reconnect() const
+    {
+        return _needs_reconnect;
+    }
+
+    /*! Re-point this transport at a different set of links
+     *
+     * Unbinds from the current links (invoking their disconnect callback) and
+     * rebinds to the given ones, resetting flow control and sequence state.
+     * The remote SEP still routes to the old link afterwards: the caller must
+     * re-arm it via reconnect() (or
+     * link_stream_manager::reconnect_data_stream()) before data flows again.
+     *
+     * \param io_srv The service that will schedule the new xport I/O
+     * \param recv_link The new recv link, already attached to the I/O service
+     * \param send_link The new send link, already attached to the I/O service
+     * \param num_recv_frames Num frames to reserve from the new recv link
+     * \param fc_poller Whether to register a flow control poller (see ctor)
+     * \param disconnect Callback function to disconnect the new links
+     */
+    void switch_links(uhd::transport::io_service::sptr io_srv,
+        uhd::transport::recv_link_if::sptr recv_link,
+        uhd::transport::send_link_if::sptr send_link,
+        const size_t num_recv_frames,
+        const bool fc_poller,
+        disconnect_callback_t disconnect);
+
+    //! Handler that re-points this transport at a hot-standby link
+    using failover_fn_t = std::function<void(chdr_rx_data_xport&)>;
+
+    /*! Configure a handler for failing over to a hot-standby link
+     *
+     * The handler is expected to attach a pre-opened set of standby links to
+     * an I/O service and call switch_links(). It is installed by the mb_iface
+     * when the stream was created with standby-link support.
+     */
+    void set_failover_handler(failover_fn_t handler)
+    {
+        _failover = handler;
+    }
+
+    //! Returns whether a hot-standby link was configured for this transport
+    bool has_standby_link() const
+    {
+        return bool(_failover);
     }
 
+    /*! Fail over to the hot-standby link
+     *
+     * Re-points this transport at the standby links that were opened when the
+     * stream was created. Follow up with reconnect() (or
+     * link_stream_manager::reconnect_data_stream()) to re-arm the SEP over
+     * the new path.
+     *
+     * \throws uhd::runtime_error if no standby link was configured
+     */
+    void failover();
+
 private:
+    /*!
+     * Binds this transport to a set of links
+     *
+     * Creates the recv client (and optionally the flow control poller) on the
+     * given I/O service. Used by the constructor and by switch_links().
+     */
+    void _connect_links(uhd::transport::io_service::sptr io_srv,
+        uhd::transport::recv_link_if::sptr recv_link,
+        uhd::transport::send_link_if::sptr send_link,
+        const size_t num_recv_frames,
+        const bool fc_poller);
+
+    /*!
+     * get_recv_buff() for striped streams (see add_striped_link())
+     *
+     * Polls both link pairs and returns packets in sequence order, stashing
+     * out-of-order arrivals. If a gap does not fill up within the reorder
+     * depth, the oldest stashed packet is returned and the gap surfaces as a
+     * regular sequence error.
+     */
+    std::tuple<typename buff_t::uptr, packet_info_t, bool> _get_recv_buff_striped(
+        const int32_t timeout_ms);
+
     /*!
      * Recv callback for I/O service
      *
@@ -292,6 +507,8 @@ private:
             if (strc.op_code == chdr::STRC_RESYNC) {
                 // Resynchronize before updating fc_state, the strc payload
                 // contains counts before the strc packet itself
+                UHD_TRACEPOINT(
+                    rx_fc_resync, _epid, strc_counts.bytes, strc_counts.packets);
                 _fc_state.resynchronize(strc_counts);
 
                 // Update state that we received a packet
@@ -301,6 +518,19 @@ private:
                 buff = buff_t::uptr();
                 _fc_state.xfer_done(packet_size_rounded);
                 _send_fc_response(send_link);
+            } else if (strc.op_code == chdr::STRC_INIT) {
+                // The remote SEP (re-)initialized, e.g. for an in-place
+                // reconnect. Start the transfer counts from scratch and send
+                // a strs response so the SEP can arm flow control.
+                if (!_reconnecting) {
+                    UHD_LOG_WARNING("XPORT::RX_DATA_XPORT",
+                        "Stream endpoint re-initialized outside of a reconnect");
+                    _needs_reconnect = true;
+                }
+                _fc_state.reset();
+                recv_link->release_recv_buff(std::move(buff));
+                buff = buff_t::uptr();
+                _fc_sender.send_strs(send_link, {0, 0});
             } else {
                 throw uhd::value_error("Unexpected opcode value in STRC packet.");
             }
@@ -346,6 +576,20 @@ private:
         _send_fc_response(send_link);
     }
 
+    /*!
+     * Hands all batched buffer releases back to the I/O service
+     *
+     * See release_recv_buff() for the batching rationale.
+     */
+    void _flush_pending_releases()
+    {
+        if (!_release_pending.empty()) {
+            _recv_io->release_recv_buffs(
+                _release_pending.data(), _release_pending.size());
+            _release_pending.clear();
+        }
+    }
+
     /*!
      * Sends a flow control response packet if necessary.
      *
@@ -354,7 +598,9 @@ private:
     void _send_fc_response(transport::send_link_if* send_link)
     {
         if (_fc_state.fc_resp_due()) {
-            _fc_sender.send_strs(send_link, _fc_state.get_xfer_counts());
+            const auto counts = _fc_state.get_xfer_counts();
+            UHD_TRACEPOINT(rx_fc_resp, _epid, counts.bytes, counts.packets);
+            _fc_sender.send_strs(send_link, counts);
             _fc_state.fc_resp_sent();
         }
     }
@@ -417,9 +663,39 @@ private:
     // Interface to the I/O service
     transport::recv_io_if::sptr _recv_io;
 
+    // Second link pair for striped streams, unset otherwise (see
+    // add_striped_link())
+    transport::recv_io_if::sptr _recv_io2;
+
+    // Disconnect callback for the second link pair
+    disconnect_callback_t _disconnect2;
+
+    // Reorder stage for striped streams: out-of-order packets keyed by their
+    // sequence number, and the recv client each outstanding buffer came from
+    // so release_recv_buff() can return it to the right link
+    std::unordered_map<uint16_t, buff_t::uptr> _reorder_stash;
+    std::unordered_map<transport::frame_buff*, size_t> _buff_origin;
+
+    // Max out-of-order packets to hold before giving up on a gap
+    size_t _reorder_depth = 0;
+
+    // Optional flow control poller. Its callback never claims a packet; it
+    // exists so that an offload I/O service keeps reading the recv link (and
+    // thus servicing stream commands via _recv_callback) while the consumer
+    // of this xport is stalled and _recv_io's frame quota is exhausted.
+    transport::recv_io_if::sptr _fc_poller_io;
+
     // Flow control state
     rx_flow_ctrl_state _fc_state;
 
+    // Released buffers batched up for return to the I/O service in one
+    // transaction (see release_recv_buff())
+    std::vector<buff_t::uptr> _release_pending;
+
+    // Number of released buffers to accumulate before handing them back,
+    // bounded by the flow control update window
+    size_t _release_batch_size = 1;
+
     // MTU in bytes
     size_t _mtu = 0;
 
@@ -446,6 +722,21 @@ private:
 
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Handlers to re-arm the remote SEP in place (see fc_params_t)
+    std::function<void(chdr_ctrl_xport&)> _reconnect_start;
+    std::function<void(chdr_ctrl_xport&)> _reconnect_commit;
+
+    // True while reconnect() runs, so the recv callback can tell an expected
+    // SEP re-initialization from an unexpected one
+    std::atomic<bool> _reconnecting{false};
+
+    // Set when the remote SEP re-initialized outside of a reconnect
+    std::atomic<bool> _needs_reconnect{false};
+
+    // Handler to re-point this transport at a hot-standby link, if one was
+    // configured at stream creation time (see set_failover_handler())
+    failover_fn_t _failover;
 };
 
 }} // namespace uhd::rfnoc
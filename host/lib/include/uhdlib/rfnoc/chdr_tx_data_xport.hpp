@@ -8,6 +8,7 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/types/device_addr.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
@@ -15,10 +16,13 @@
 #include <uhdlib/rfnoc/tx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <atomic>
 #include <memory>
 
 namespace uhd { namespace rfnoc {
 
+class chdr_ctrl_xport;
+
 namespace mgmt {
 class mgmt_portal;
 }
@@ -122,6 +126,12 @@ public:
     struct fc_params_t
     {
         stream_buff_params_t buff_capacity;
+
+        // Handler to re-arm the remote SEP in place after a link disruption
+        // (see reconnect()). It is populated by configure_sep() and holds a
+        // reference to the management portal, which is owned by the link
+        // stream manager and outlives the transport.
+        std::function<void(chdr_ctrl_xport&)> reconnect_sep;
     };
 
     /*! Configure route to the sep and flow control
@@ -134,8 +144,16 @@ public:
      * \param epids Source and destination endpoint IDs
      * \param pyld_buff_fmt Datatype of SW buffer that holds the data payload
      * \param mdata_buff_fmt Datatype of SW buffer that holds the data metadata
-     * \param fc_freq_ratio Ratio to use to configure the device fc frequency
-     * \param fc_headroom_ratio Ratio to use to configure the device fc headroom
+     * \param fc_freq_ratio Ratio to use to configure the device fc frequency.
+     *                      This is only a starting point: the setup handshake
+     *                      measures the link round-trip time and lowers the
+     *                      ratio on long-RTT links so that credit updates
+     *                      arrive often enough to keep the window usable. The
+     *                      "fc_freq_ratio" transport arg overrides both.
+     * \param fc_headroom_ratio Ratio to use to configure the device fc headroom.
+     *                      Can be overridden with the "fc_headroom_ratio"
+     *                      transport arg.
+     * \param xport_args The transport arguments
      * \param disconnect Callback function to disconnect the links
      * \return Parameters for xport flow control
      */
@@ -149,6 +167,7 @@ public:
         const uhd::rfnoc::sw_buff_t mdata_buff_fmt,
         const double fc_freq_ratio,
         const double fc_headroom_ratio,
+        const uhd::device_addr_t& xport_args,
         disconnect_callback_t disconnect);
 
     /*! Constructor
@@ -258,23 +277,58 @@ public:
         buff_t::uptr& buff, const packet_info_t& info)
     {
         uint64_t tsf = 0;
+        size_t payload_offset;
 
         if (info.has_tsf) {
             _send_header.set_pkt_type(chdr::PKT_TYPE_DATA_WITH_TS);
-            tsf = info.tsf;
+            tsf            = info.tsf;
+            payload_offset = _payload_offset_ts;
         } else {
             _send_header.set_pkt_type(chdr::PKT_TYPE_DATA_NO_TS);
+            payload_offset = _payload_offset_no_ts;
         }
 
         _send_header.set_eob(info.eob);
         _send_header.set_eov(info.eov);
         _send_header.set_seq_num(_data_seq_num++);
-
+        // Stage the complete header, including the final packet length, and
+        // write it into the frame with a single refresh(). The payload
+        // offsets are cached at construction, so the hot path avoids the
+        // virtual calls for patching the length in afterwards and reading
+        // back the payload pointer. This matters most for wide CHDR widths,
+        // where the payload offset is a full CHDR word into the frame.
+        _send_header.set_length(payload_offset + info.payload_bytes);
         _send_packet->refresh(buff->data(), _send_header, tsf);
-        _send_packet->update_payload_size(info.payload_bytes);
 
-        return std::make_pair(_send_packet->get_payload_ptr(),
-            _send_packet->get_chdr_header().get_length());
+        return std::make_pair(
+            static_cast<void*>(static_cast<uint8_t*>(buff->data()) + payload_offset),
+            payload_offset + info.payload_bytes);
+    }
+
+    /*! Re-arm the stream endpoint in place after a link disruption
+     *
+     * Re-programs the route to the remote SEP and its stream configuration
+     * over the given control transport, without tearing down this transport
+     * or the graph it belongs to. Data that was in flight when the link went
+     * down is written off; a flow control resync realigning the SEP's
+     * transfer counts goes out with the next data packet. Sequence tracking
+     * restarts at zero, matching the re-armed SEP, so the outage is visible
+     * as a regular SEQ_ERROR async message rather than a stuck stream.
+     *
+     * \param ctrl_xport Control transport to run the management handshake on
+     * \throws uhd::runtime_error if this transport was created without
+     *         reconnect support or the handshake fails
+     */
+    void reconnect(chdr_ctrl_xport& ctrl_xport);
+
+    /*! Returns whether this transport has detected that it needs a reconnect
+     *
+     * This is set when the device reports a routing error, which indicates
+     * the route to the SEP was lost (e.g., after a link disruption).
+     */
+    bool needs_reconnect() const
+    {
+        return _needs_reconnect;
     }
 
 private:
@@ -326,6 +380,7 @@ private:
                     case chdr::STRS_RTERR:
                         UHD_LOG_WARNING("XPORT::TX_DATA_XPORT",
                             "Received routing error in tx stream!");
+                        _needs_reconnect = true;
                         break;
                     case chdr::STRS_CMDERR:
                         UHD_LOG_WARNING("XPORT::TX_DATA_XPORT",
@@ -407,6 +462,11 @@ private:
     // Size of CHDR headers
     size_t _hdr_len = 0;
 
+    // Payload offsets for data packets with and without timestamps, cached
+    // here so write_packet_header() need not query the packet writer
+    size_t _payload_offset_no_ts = 0;
+    size_t _payload_offset_ts    = 0;
+
     // Sequence number for data packets
     uint16_t _data_seq_num = 0;
 
@@ -436,6 +496,12 @@ private:
 
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Handler to re-arm the remote SEP in place (see fc_params_t)
+    std::function<void(chdr_ctrl_xport&)> _reconnect_sep;
+
+    // Set when the device reported a routing error for this stream
+    std::atomic<bool> _needs_reconnect{false};
 };
 
 }} // namespace uhd::rfnoc
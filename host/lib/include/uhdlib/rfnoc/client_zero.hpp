@@ -13,6 +13,8 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace uhd { namespace rfnoc { namespace detail {
@@ -207,6 +209,11 @@ private:
     bool _has_chdr_crossbar;
     uint16_t _num_edges;
     std::vector<edge_def_t> _adjacency_list;
+    //! Static per-block registers (NOC ID, block info, MTU info), pre-fetched
+    // at construction with all reads in flight so enumeration does not pay a
+    // control round trip per block
+    std::unordered_map<uint16_t, uint32_t> _noc_id_cache;
+    std::unordered_map<uint16_t, std::pair<uint32_t, uint32_t>> _block_info_cache;
 
     std::vector<client_zero::edge_def_t> _get_adjacency_list();
 
@@ -11,7 +11,8 @@
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <map>
 #include <memory>
-#include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -61,16 +62,39 @@ public:
     sep_addr_t lookup_addr(const sep_id_t& epid) const;
 
     /*! \brief Deallocate the specified EPID.
+     *
+     * The EPID's slot is returned to the free list and may be handed out
+     * again by a later allocation. Deallocating an EPID that is not currently
+     * allocated is a no-op.
      *
      * \param epid The EPID to deallocate
      */
     void deallocate_epid(sep_id_t epid);
 
 private:
+    //! A slot in the preallocated EPID pool. The EPID of a slot is its index
+    // plus the start EPID.
+    struct sep_slot_t
+    {
+        sep_addr_t addr = NULL_DEVICE_ADDR;
+        bool allocated  = false;
+    };
+
+    //! Allocate a slot from the free list (or grow the pool) and bind it to
+    // \p addr. Requires the caller to hold \p _mutex exclusively.
+    sep_id_t _allocate_slot(const sep_addr_t& addr);
+
     std::map<sep_addr_t, sep_id_t> _epid_map;
-    std::map<sep_id_t, sep_addr_t> _addr_map;
-    sep_id_t _next_epid;
-    mutable std::mutex _mutex;
+    //! Slot pool, indexed by (EPID - start EPID). Grown in chunks so that
+    // streamer churn does not cause allocation churn, and EPID lookups are
+    // an index operation instead of a map traversal.
+    std::vector<sep_slot_t> _slots;
+    //! Indices of previously deallocated slots, reused before growing the pool
+    std::vector<size_t> _free_slots;
+    const sep_id_t _start_epid;
+    //! Reader/writer lock: lookups on active paths only take shared
+    // ownership, so they don't contend with each other
+    mutable std::shared_mutex _mutex;
 };
 
 }} /* namespace uhd::rfnoc */
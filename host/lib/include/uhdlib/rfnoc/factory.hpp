@@ -28,10 +28,15 @@ class factory
 public:
     /*! Return a factory function for an RFNoC block based on the Noc-ID
      *
-     * \returns a block_factory_info_t object
-     * \throws uhd::lookup_error if no block is found
+     * The lookup is tiered: first an exact (Noc-ID, device) match, then the
+     * device-agnostic registration for the Noc-ID, then the default block.
+     * Each tier is a single hash probe, and the returned reference points
+     * into the registry (valid for the lifetime of the process), so
+     * instantiating a block does not copy the factory info.
+     *
+     * \returns a reference to the block's block_factory_info_t
      */
-    static block_factory_info_t get_block_factory(
+    static const block_factory_info_t& get_block_factory(
         noc_id_t noc_id, device_type_t device_id);
 };
 
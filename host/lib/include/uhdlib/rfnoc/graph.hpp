@@ -14,6 +14,7 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <tuple>
 
 namespace uhd { namespace rfnoc { namespace detail {
@@ -64,6 +65,11 @@ public:
      * the graph has been committed. It will run checks on the graph and run a
      * property propagation.
      *
+     * The first time the graph is committed, a full property resolution is
+     * run across all nodes. Subsequent commits only re-resolve the subgraph
+     * affected by connections added or removed since the last commit, which
+     * makes re-committing after a dynamic reconnection cheap on large graphs.
+     *
      * \throws uhd::resolve_error if the properties fail to resolve.
      */
     void commit();
@@ -229,6 +235,37 @@ private:
     void enqueue_action(
         node_ref_t src_node, res_source_info src_edge, action_info::sptr action);
 
+    /*! Entrypoint for batched action delivery
+     *
+     * This is the equivalent of calling enqueue_action() once per (edge,
+     * action) pair in \p actions, but the graph mutex is taken only once and
+     * all actions are delivered in a single run of the delivery loop. This is
+     * what node_t::post_actions() lands on, and is meant for fan-out
+     * operations such as issuing a stream command to many channels.
+     *
+     * \param src_node Reference to the node where the post_actions() call is
+     *                 originating from
+     * \param actions The (edge, action) pairs to deliver, in order. The edges
+     *                are from the source node's point of view, as with
+     *                enqueue_action().
+     *
+     * \throws uhd::runtime_error if it has to terminate a infinite cascade of
+     *         actions
+     */
+    void enqueue_actions(node_ref_t src_node,
+        const std::vector<std::pair<res_source_info, action_info::sptr>>& actions);
+
+    /*! Deliver all actions currently in the action queue
+     *
+     * Must be called with the graph mutex held and the action handling flag
+     * set by the caller. Delivering an action may cause nodes to push more
+     * actions onto the queue; those are delivered in the same run.
+     *
+     * \throws uhd::runtime_error if it has to terminate a infinite cascade of
+     *         actions
+     */
+    void _process_action_queue();
+
     /**************************************************************************
      * Private graph helpers
      *************************************************************************/
@@ -331,6 +368,16 @@ private:
     // the graph is committed.
     size_t _release_count{1};
 
+    //! Flag if the graph has gone through an initial, full property
+    // resolution. Once it has, subsequent commits only re-resolve the
+    // subgraph affected by edge changes (see _reconnected_nodes).
+    bool _initialized = false;
+
+    //! Nodes whose edges were added or removed since the last commit. On the
+    // next commit, their edge properties get forcibly marked dirty so that
+    // property resolution is re-run across the changed edges.
+    std::set<node_ref_t> _reconnected_nodes;
+
     //! A flag if the graph has shut down. Is protected by _release_mutex
     bool _shutdown{false};
 };
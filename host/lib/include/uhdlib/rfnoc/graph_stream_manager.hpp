@@ -15,11 +15,13 @@
 #include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
 #include <uhdlib/rfnoc/epid_allocator.hpp>
 #include <uhdlib/rfnoc/mb_iface.hpp>
+#include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <functional>
 #include <memory>
 #include <set>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -40,6 +42,16 @@ public:
      */
     virtual std::vector<device_id_t> get_local_devices() const = 0;
 
+    /*! \brief Read the traffic error counters of a reachable stream endpoint
+     *
+     * \param dst_addr The physical address of the stream endpoint to query
+     * \param adapter The preferred local adapter to use for reaching the endpoint
+     * \return The endpoint's traffic counters
+     */
+    virtual mgmt::mgmt_portal::sep_traffic_counters_t get_traffic_counters(
+        sep_addr_t dst_addr,
+        uhd::transport::adapter_id_t adapter = uhd::transport::NULL_ADAPTER_ID) = 0;
+
     /*! \brief Connect the host to the specified destination and create a control stream
      *
      * \param dst_addr The physical address of the destination endpoint
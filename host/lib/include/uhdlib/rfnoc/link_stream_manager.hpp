@@ -12,6 +12,7 @@
 #include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
 #include <uhdlib/rfnoc/epid_allocator.hpp>
 #include <uhdlib/rfnoc/mb_iface.hpp>
+#include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/topo_graph.hpp>
 #include <functional>
 #include <memory>
@@ -84,6 +85,14 @@ public:
      */
     virtual std::set<sep_addr_t> get_reachable_endpoints() const = 0;
 
+    /*! \brief Read the traffic error counters of a reachable stream endpoint
+     *
+     * \param addr The physical address of the stream endpoint to query
+     * \return The endpoint's traffic counters
+     */
+    virtual mgmt::mgmt_portal::sep_traffic_counters_t get_traffic_counters(
+        const sep_addr_t& addr) = 0;
+
     /*! \brief Connect the host to the specified destination and init a control endpoint
      *
      * \param dst_addr The physical address of the destination endpoint
@@ -184,6 +193,48 @@ public:
         const device_addr_t& xport_args,
         const std::string& streamer_id) = 0;
 
+    /*! \brief Re-arm an existing device-to-host data stream after a link
+     *         disruption
+     *
+     * Re-programs the route to the remote SEP and re-runs the flow control
+     * handshake over this link manager's management transport, without
+     * tearing down the transport or the graph. Samples lost during the
+     * outage are reported through the streamer's regular sequence error
+     * (overrun) reporting.
+     *
+     * \param xport The transport to reconnect; it must have been created by
+     *              this link stream manager instance
+     */
+    virtual void reconnect_data_stream(chdr_rx_data_xport& xport) = 0;
+
+    /*! \brief Re-arm an existing host-to-device data stream after a link
+     *         disruption
+     *
+     * Like the RX overload, but for TX streams: the route and the SEP's
+     * stream configuration are re-programmed, and a flow control resync
+     * realigning the device's transfer counts goes out with the next data
+     * packet. The outage is visible as a regular SEQ_ERROR async message.
+     *
+     * \param xport The transport to reconnect; it must have been created by
+     *              this link stream manager instance
+     */
+    virtual void reconnect_data_stream(chdr_tx_data_xport& xport) = 0;
+
+    /*! \brief Fail a device-to-host data stream over to its hot-standby link
+     *
+     * Re-points the transport at the standby links that were pre-opened at
+     * stream creation time (xport arg `standby_link') and re-arms the SEP
+     * over this link manager's management transport, teaching the device's
+     * transport adapters the new return route. No RPC calls or link setup
+     * happen on this path, so the switchover completes within milliseconds.
+     * The management link must remain reachable; only the data path moves.
+     *
+     * \param xport The transport to fail over; it must have been created by
+     *              this link stream manager instance with a standby link
+     * \throws uhd::runtime_error if no standby link was configured
+     */
+    virtual void failover_data_stream(chdr_rx_data_xport& xport) = 0;
+
     static uptr make(const chdr::chdr_packet_factory& pkt_factory,
         mb_iface& mb_if,
         const epid_allocator::sptr& epid_alloc,
@@ -49,6 +49,19 @@ public:
         sep_addr_t addr;
     };
 
+    //! Traffic error counters of a stream endpoint
+    struct sep_traffic_counters_t
+    {
+        //! Number of sequence errors (dropped or reordered packets) seen by
+        // the endpoint's output stream
+        uint32_t seq_err_count = 0;
+        //! Number of data integrity errors seen by the endpoint's output
+        // stream
+        uint32_t data_err_count = 0;
+        //! Number of routing errors seen by the endpoint's output stream
+        uint32_t route_err_count = 0;
+    };
+
     virtual ~mgmt_portal() = 0;
 
     //! Get addresses for all stream endpoints reachable from this SW mgmt portal
@@ -89,6 +102,17 @@ public:
     //
     virtual sep_info_t get_endpoint_info(const sep_id_t& epid) const = 0;
 
+    //! Read the traffic error counters of a discovered (reachable) stream endpoint
+    //
+    //  All counters are read back in a single management transaction, which
+    //  makes this call cheap enough to poll periodically while streaming.
+    //
+    // \param xport The host stream endpoint's CTRL transport
+    // \param addr The physical address of the stream endpoint to query
+    //
+    virtual sep_traffic_counters_t get_traffic_counters(
+        chdr_ctrl_xport& xport, const sep_addr_t& addr) = 0;
+
     //! Setup a route from this SW mgmt portal to the specified destination endpoint
     //
     //  After a route is established, it should be possible to send packets to the
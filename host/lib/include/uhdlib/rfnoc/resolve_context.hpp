@@ -17,7 +17,11 @@ enum class resolve_context {
     INIT,
     //! Property propagation was called because a property on a node was
     // updated
-    NODE_PROP
+    NODE_PROP,
+    //! Property propagation was called because an already-initialized graph
+    // was committed again (e.g., after a dynamic reconnection). Only the
+    // affected subgraph needs re-resolving.
+    RECOMMIT
 };
 
 }} // namespace uhd::rfnoc
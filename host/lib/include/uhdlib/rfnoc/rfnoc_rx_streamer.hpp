@@ -11,6 +11,7 @@
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <atomic>
 #include <string>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -23,6 +24,8 @@ class rfnoc_rx_streamer : public node_t,
                           public transport::rx_streamer_impl<chdr_rx_data_xport>
 {
     using disconnect_fn_t = std::function<void(const std::string&)>;
+    using async_reclaim_fn_t =
+        std::function<void(std::vector<chdr_rx_data_xport::uptr>&&)>;
 
 public:
     /*! Constructor
@@ -31,10 +34,16 @@ public:
      * \param stream_args Arguments to aid the construction of the streamer
      * \param disconnect_cb Callback function to disconnect the streamer when
      *                      the object is destroyed
+     * \param reclaim_cb Optional callback that takes ownership of the
+     *                   streamer's transports on destruction so their
+     *                   teardown can run in the background. Only used when
+     *                   the fast_teardown stream arg is set; when empty,
+     *                   transports are torn down in the destructor.
      */
     rfnoc_rx_streamer(const size_t num_ports,
         const uhd::stream_args_t stream_args,
-        disconnect_fn_t disconnect_cb);
+        disconnect_fn_t disconnect_cb,
+        async_reclaim_fn_t reclaim_cb = nullptr);
 
     /*! Destructor
      */
@@ -129,6 +138,9 @@ private:
     // Callback function to disconnect
     const disconnect_fn_t _disconnect_cb;
 
+    // Callback for handing off the transports for background teardown
+    const async_reclaim_fn_t _reclaim_cb;
+
     //! True if we're in overrun handling mode. In overrun handling mode, we are
     // not doing regular streaming, but we are trying to get the streaming back
     // up and running after a previous overrun. This flag helps us to catch
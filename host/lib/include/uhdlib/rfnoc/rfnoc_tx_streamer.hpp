@@ -106,6 +106,14 @@ public:
      */
     bool recv_async_msg(uhd::async_metadata_t& async_metadata, double timeout) override;
 
+    /*! Get the pollable notification handle of the async message queue
+     *
+     *  Implementation of tx_streamer API method.
+     *
+     * \return the notification file descriptor, or -1 where unsupported
+     */
+    int get_async_msg_fd() const override;
+
 private:
     void _register_props(const size_t chan, const std::string& otw_format);
 
@@ -49,6 +49,16 @@ public:
         }
     }
 
+    //! Reset all transfer counts, e.g. after the stream endpoint was
+    // re-initialized following a link disruption. The flow control frequency
+    // is retained.
+    void reset()
+    {
+        _recv_counts         = {0, 0};
+        _xfer_counts         = {0, 0};
+        _last_fc_resp_counts = {0, 0};
+    }
+
     //! Update state when data is received
     void data_received(const size_t bytes)
     {
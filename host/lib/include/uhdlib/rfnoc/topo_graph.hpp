@@ -13,6 +13,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace uhd { namespace rfnoc { namespace detail {
 
@@ -384,6 +385,13 @@ private:
     node_map_t _node_map;
 
     std::vector<topo_edge_t> _edge_info;
+
+    //! Serializes access to the graph. All link stream managers of a session
+    // share this graph, and they may set up streams on different devices
+    // concurrently. Note that references handed out by access_node() are not
+    // protected by this; they remain valid, but the caller must not hold
+    // them across concurrent topology changes.
+    mutable std::recursive_mutex _graph_mutex;
 };
 
 }}} // namespace uhd::rfnoc::detail
@@ -8,12 +8,24 @@
 
 #include <uhd/types/metadata.hpp>
 #include <boost/lockfree/queue.hpp>
+#include <chrono>
+#include <mutex>
 
 namespace uhd { namespace rfnoc {
 
 /*!
  *  Implements queue of async messages originating from the tx data transport
  *  and from the rfnoc graph.
+ *
+ *  All event records are preallocated at construction time; enqueuing never
+ *  touches the heap or blocks, so producers on the data path (e.g. the
+ *  transport reporting sequence errors) stay allocation- and futex-free even
+ *  at high event rates.
+ *
+ *  Homogeneous runs of error events (e.g. one time error per packet of a
+ *  late burst) are coalesced into summary records so that an error storm
+ *  costs the consumer O(1) work per reporting interval instead of one
+ *  record per packet (see enqueue()).
  */
 class tx_async_msg_queue
 {
@@ -23,6 +35,8 @@ public:
     //! Constructor
     tx_async_msg_queue(size_t capacity);
 
+    ~tx_async_msg_queue();
+
     /*!
      *  Retrieve async message from queue
      *
@@ -35,12 +49,71 @@ public:
     /*!
      *  Push an async message onto the queue
      *
+     *  Error events are subject to storm aggregation: The first event of a
+     *  run is always queued immediately, but while further events of the
+     *  same code arrive back-to-back on the same channel, they are folded
+     *  into a single summary record (async_metadata_t::event_count, with
+     *  time_spec/last_time_spec bracketing the run) which is released at
+     *  most once per reporting interval, or as soon as the consumer has
+     *  drained the queue, whichever comes first. When the consumer keeps
+     *  up, every event is therefore still delivered individually; only
+     *  when it falls behind do events coalesce. Burst ACKs and user
+     *  payloads are never aggregated, and always flush any pending run
+     *  first so that ordering is preserved.
+     *
+     *  If the queue is full because the client is not draining events, the
+     *  oldest message is dropped to make room for the new one.
+     *
      * \param async_metadata the metadata to be pushed
      */
     void enqueue(const async_metadata_t& async_metadata);
 
+    /*!
+     *  Get an OS-pollable notification handle for this queue
+     *
+     *  On Linux, this is an eventfd whose counter is bumped on every
+     *  enqueue, so it can be registered with epoll/poll/select to wait for
+     *  async messages without a polling thread. After a wakeup, the consumer
+     *  must read the eventfd to clear it and then drain the queue with
+     *  recv_async_msg(..., 0); an enqueue that races the drain bumps the
+     *  counter again, so no wakeup is ever lost.
+     *
+     * \return the notification file descriptor, or -1 where unsupported
+     */
+    int get_notify_fd() const
+    {
+        return _notify_fd;
+    }
+
 private:
-    boost::lockfree::queue<async_metadata_t> _queue;
+    //! Minimum spacing between summary records of an ongoing error run
+    static constexpr std::chrono::milliseconds AGG_REPORT_INTERVAL{10};
+
+    //! Whether events of this code may be folded into a summary record
+    static bool is_aggregatable(async_metadata_t::event_code_t event_code);
+
+    //! Push a record onto the lockfree queue and ring the doorbell
+    void push(const async_metadata_t& async_metadata);
+
+    //! Queue the pending summary record, if any (_agg_mutex must be held)
+    void flush_run_locked();
+
+    // fixed_sized so that push() can never fall back to allocating nodes
+    // from the heap when the preallocated pool is exhausted
+    boost::lockfree::queue<async_metadata_t, boost::lockfree::fixed_sized<true>> _queue;
+
+    // Enqueue doorbell for event-driven consumers (-1 where unsupported)
+    int _notify_fd = -1;
+
+    // Error run aggregation state, guarded by _agg_mutex. _run_md's code
+    // and channel identify the current run; _run_count is the number of
+    // events folded into _run_md that have not been reported yet (zero
+    // right after a flush, while the run itself remains open).
+    std::mutex _agg_mutex;
+    bool _run_valid   = false;
+    size_t _run_count = 0;
+    async_metadata_t _run_md;
+    std::chrono::steady_clock::time_point _next_report;
 };
 
 }} // namespace uhd::rfnoc
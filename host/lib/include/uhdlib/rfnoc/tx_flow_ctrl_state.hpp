@@ -17,6 +17,19 @@ public:
     //! Constructor
     tx_flow_ctrl_state(const stream_buff_params_t& capacity) : _dest_capacity(capacity) {}
 
+    /*! Reset all transfer state, e.g. after the stream endpoint was re-armed
+     * following a link disruption. The destination capacity is retained. A
+     * flow control resync is left pending so the destination's counts are
+     * realigned with ours when the next packet is sent.
+     */
+    void reset()
+    {
+        _xfer_counts          = {0, 0};
+        _recv_counts          = {0, 0};
+        _last_fc_resync_bytes = 0;
+        _fc_resync_req        = true;
+    }
+
     //! Updates destination received count
     void update_dest_recv_count(const stream_buff_params_t& recv_count)
     {
@@ -37,6 +37,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 /* NOTE: There are changes to all the network standard fields in 19.x */
 
@@ -301,6 +302,29 @@ public:
      */
     uint16_t alloc_udp_port(uint16_t udp_port);
 
+    /*!
+     * Allocate a dedicated RX DMA queue for a receive flow and install a
+     * hardware flow rule that steers matching UDP traffic to it
+     *
+     * Queue 0 is the shared default queue and receives all traffic that is
+     * not claimed by a flow rule (including ARP and broadcast traffic).
+     *
+     * \param udp_dst_port The flow's destination UDP port (in network order)
+     * \return The dedicated queue ID, or 0 if no dedicated queue is
+     *         available or the NIC does not support the flow rule.
+     */
+    queue_id_t alloc_rx_flow(uint16_t udp_dst_port);
+
+    /*!
+     * Remove the flow rule installed by alloc_rx_flow() and return the
+     * queue to the free pool
+     *
+     * Calling this with queue 0 (the shared default queue) is a no-op.
+     *
+     * \param queue_id The queue ID returned by alloc_rx_flow()
+     */
+    void free_rx_flow(queue_id_t queue_id);
+
 private:
     friend uhd::transport::dpdk_io_service;
 
@@ -322,6 +346,10 @@ private:
     std::mutex _mutex;
     std::set<uint16_t> _udp_ports;
     uint16_t _next_udp_port = 0xffff;
+    //! Dedicated RX queues (i.e., all but queue 0) not yet claimed by a flow
+    std::vector<queue_id_t> _free_rx_queues;
+    //! Installed flow rules, keyed by the queue they steer to
+    std::unordered_map<queue_id_t, struct rte_flow*> _rx_flows;
 
     // Structures protected by spin lock
     rte_spinlock_t _spinlock = RTE_SPINLOCK_INITIALIZER;
@@ -412,23 +440,38 @@ private:
      */
     void _eal_init(const device_addr_t& eal_args);
 
+    /*! Resolve the mempool cache size to use for a pool of num_bufs buffers
+     *
+     * Uses the user-provided dpdk_mbuf_cache_size if one was given (warning
+     * if it does not divide the pool size evenly), and auto-sizes the cache
+     * from the pool size otherwise.
+     *
+     * \param num_bufs Number of buffers in the pool
+     * \return The per-lcore cache size to pass to rte_pktmbuf_pool_create()
+     */
+    int _resolve_mbuf_cache_size(size_t num_bufs) const;
+
     /*! Either allocate or return a pointer to the RX packet buffer pool for the
      * given CPU socket
      *
-     * \param cpu_socket The CPU socket ID
+     * \param pool_index Index of the pool (one pool per CPU socket)
      * \param num_bufs Number of buffers to allocate to the pool
+     * \param socket_id The CPU socket to allocate on, or SOCKET_ID_ANY
      * \return A pointer to the memory pool
      */
-    struct rte_mempool* _get_rx_pktbuf_pool(unsigned int cpu_socket, size_t num_bufs);
+    struct rte_mempool* _get_rx_pktbuf_pool(
+        unsigned int pool_index, size_t num_bufs, int socket_id);
 
     /*! Either allocate or return a pointer to the TX packet buffer pool for the
      * given CPU socket
      *
-     * \param cpu_socket The CPU socket ID
+     * \param pool_index Index of the pool (one pool per CPU socket)
      * \param num_bufs Number of buffers to allocate to the pool
+     * \param socket_id The CPU socket to allocate on, or SOCKET_ID_ANY
      * \return A pointer to the memory pool
      */
-    struct rte_mempool* _get_tx_pktbuf_pool(unsigned int cpu_socket, size_t num_bufs);
+    struct rte_mempool* _get_tx_pktbuf_pool(
+        unsigned int pool_index, size_t num_bufs, int socket_id);
 
     size_t _mtu;
     int _num_mbufs;
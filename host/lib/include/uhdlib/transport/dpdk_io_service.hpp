@@ -19,6 +19,7 @@ namespace uhd { namespace transport {
 
 class dpdk_send_io;
 class dpdk_recv_io;
+class udp_dpdk_link;
 struct dpdk_io_if;
 
 class dpdk_io_service : public virtual io_service,
@@ -220,6 +221,12 @@ private:
     std::unordered_map<dpdk::port_id_t, std::list<dpdk_recv_io*>> _recv_xport_map;
     //! The RX table, which provides lists of dpdk_recv_io for an IPv4 tuple
     struct rte_hash* _rx_table;
+    //! The dedicated RX queue assigned to each link's flow, if it has one
+    // (links whose packets arrive on the shared queue 0 are not recorded)
+    std::unordered_map<udp_dpdk_link*, dpdk::queue_id_t> _rx_flow_queues;
+    //! Per port, the RX queues polled directly by run-to-completion clients,
+    // which this service's worker must not touch
+    std::unordered_map<dpdk::port_id_t, std::set<dpdk::queue_id_t>> _direct_rx_queues;
     //! Service queue for clients to make requests
     dpdk::service_queue _servq;
     //! Retry list for waking clients
@@ -240,7 +247,7 @@ private:
     static constexpr int MAX_FLOWS                = 128;
     static constexpr int MAX_CLIENTS              = 2048;
     static constexpr int RX_BURST_SIZE            = 16;
-    static constexpr int TX_BURST_SIZE            = 16;
+    static constexpr int TX_BURST_SIZE            = 32;
 };
 
 }} // namespace uhd::transport
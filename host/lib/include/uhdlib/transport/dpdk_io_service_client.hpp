@@ -191,6 +191,15 @@ public:
         , _servq(io_srv->_servq)
         , _fc_cb(fc_cb) // Call on release
     {
+        // Run-to-completion is only possible if flow steering gave this
+        // link its own NIC queue (the flow was opened when the link was
+        // attached, before this client was created)
+        _direct_poll = link->get_rx_run_to_completion() && link->get_queue_id() != 0;
+        if (link->get_rx_run_to_completion() && !_direct_poll) {
+            UHD_LOG_WARNING("DPDK::RECV_IO",
+                "Run-to-completion requested, but no dedicated RX queue is "
+                "available. Falling back to the I/O service worker.");
+        }
         // Get reference to DPDK context, since this owns some DPDK memory
         _ctx             = dpdk::dpdk_ctx::get();
         _num_send_frames = num_send_frames;
@@ -232,6 +241,9 @@ public:
 
     frame_buff::uptr get_recv_buff(int32_t timeout_ms)
     {
+        if (_direct_poll) {
+            return _get_recv_buff_direct(timeout_ms);
+        }
         frame_buff* buff_ptr;
         if (rte_ring_dequeue(_recv_queue, (void**)&buff_ptr)) {
             if (!timeout_ms) {
@@ -264,6 +276,12 @@ public:
 
     void release_recv_buff(frame_buff::uptr buff)
     {
+        if (_direct_poll) {
+            // Run the flow control callback right here: this thread owns
+            // the link's NIC queue, so there is no cross-thread handoff
+            _fc_cb(std::move(buff), _dpdk_io_if.link, _dpdk_io_if.link);
+            return;
+        }
         frame_buff* buff_ptr = buff.release();
         int status           = rte_ring_enqueue(_release_queue, buff_ptr);
         if (status != 0) {
@@ -274,6 +292,41 @@ public:
 private:
     friend class dpdk_io_service;
 
+    /*! Poll the link's dedicated NIC queue directly from the caller's thread
+     *
+     * The flow rule installed for this link steers only its own 5-tuple to
+     * the queue, so every received mbuf belongs to this flow and can go
+     * straight into the link's buffer list without demuxing.
+     */
+    frame_buff::uptr _get_recv_buff_direct(int32_t timeout_ms)
+    {
+        udp_dpdk_link* link = _dpdk_io_if.link;
+        // Packets may be left over from an earlier burst
+        auto buff = link->get_recv_buff(0);
+        if (buff) {
+            return buff;
+        }
+        const auto port_id  = link->get_port()->get_port_id();
+        const auto queue_id = link->get_queue_id();
+        const auto timeout_point =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        do {
+            struct rte_mbuf* bufs[DIRECT_RX_BURST_SIZE];
+            const uint16_t num_rx =
+                rte_eth_rx_burst(port_id, queue_id, bufs, DIRECT_RX_BURST_SIZE);
+            for (uint16_t i = 0; i < num_rx; i++) {
+                link->enqueue_recv_mbuf(bufs[i]);
+            }
+            if (num_rx) {
+                return link->get_recv_buff(0);
+            }
+        } while (timeout_ms < 0
+                 || (timeout_ms > 0 && std::chrono::steady_clock::now() < timeout_point));
+        return frame_buff::uptr();
+    }
+
+    static constexpr uint16_t DIRECT_RX_BURST_SIZE = 16;
+
     dpdk_io_if _dpdk_io_if;
     size_t _num_frames_in_use = 0;
 
@@ -283,6 +336,8 @@ private:
     struct rte_ring* _release_queue;
     dpdk::wait_req* _waiter;
     fc_callback_t _fc_cb;
+    //! True if this client polls the NIC directly (run-to-completion mode)
+    bool _direct_poll = false;
 };
 
 
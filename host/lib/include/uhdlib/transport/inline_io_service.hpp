@@ -26,11 +26,41 @@ class inline_io_service : public virtual io_service,
 {
 public:
     using sptr = std::shared_ptr<inline_io_service>;
+
+    //! Strategy used while waiting for a packet on a recv link
+    enum class recv_wait_mode_t {
+        //! Block in the link (default historic behavior)
+        BLOCK,
+        //! Spin on the link without yielding for the entire timeout
+        SPIN,
+        //! Spin for the configured duration, then poll with yields in between
+        SPIN_YIELD,
+        //! Spin for the configured duration, then block in the link
+        SPIN_BLOCK
+    };
+
+    /*!
+     * Parameters controlling the receive wait strategy. The spinning modes
+     * trade a busy core for deterministic sub-microsecond packet pickup by
+     * avoiding the wakeup latency of a kernel block.
+     */
+    struct recv_wait_params_t
+    {
+        recv_wait_mode_t mode = recv_wait_mode_t::BLOCK;
+        //! Duration to spin before yielding/blocking (SPIN_YIELD/SPIN_BLOCK)
+        size_t spin_duration_us = 100;
+    };
+
     static sptr make(void)
     {
         return sptr(new inline_io_service());
     }
 
+    static sptr make(const recv_wait_params_t& wait_params)
+    {
+        return sptr(new inline_io_service(wait_params));
+    }
+
     virtual ~inline_io_service();
 
     void attach_recv_link(recv_link_if::sptr link) override;
@@ -58,7 +88,10 @@ private:
     friend class inline_recv_io;
     friend class inline_send_io;
 
-    inline_io_service()                         = default;
+    inline_io_service() = default;
+    inline_io_service(const recv_wait_params_t& wait_params) : _wait_params(wait_params)
+    {
+    }
     inline_io_service(const inline_io_service&) = delete;
 
     /*!
@@ -125,6 +158,9 @@ private:
     /* Shared ptr kept to avoid untimely release */
     std::list<send_link_if::sptr> _send_links;
     std::list<recv_link_if::sptr> _recv_links;
+
+    /* Wait strategy applied when receiving from links */
+    recv_wait_params_t _wait_params;
 };
 
 }} // namespace uhd::transport
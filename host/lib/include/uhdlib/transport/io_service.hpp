@@ -143,6 +143,23 @@ public:
      */
     virtual void release_recv_buff(frame_buff::uptr buff) = 0;
 
+    /*!
+     * Release a batch of buffers back to the I/O service.
+     *
+     * Equivalent to releasing each buffer in order via release_recv_buff(),
+     * but implementations may hand the whole group back to the I/O thread in
+     * a single queue transaction. The default implementation simply loops.
+     *
+     * \param buffs pointer to the first buffer of the batch
+     * \param num_buffs number of buffers in the batch
+     */
+    virtual void release_recv_buffs(frame_buff::uptr* buffs, const size_t num_buffs)
+    {
+        for (size_t i = 0; i < num_buffs; i++) {
+            release_recv_buff(std::move(buffs[i]));
+        }
+    }
+
     /*!
      * Get number of send frames reserved by this I/O interface.
      *
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/packet_tap.hpp>
+#include <atomic>
 #include <cassert>
 #include <vector>
 
@@ -44,6 +46,44 @@ private:
     std::vector<frame_buff*> _buffs;
 };
 
+/*!
+ * Always-on statistics counters for one link direction. The counters are
+ * written by the single thread driving the link using relaxed stores (no
+ * read-modify-write), and snapshotted with relaxed loads, so polling them
+ * from another thread does not perturb the hot path.
+ */
+class link_stats_counters
+{
+public:
+    inline void record_packet(const size_t num_bytes)
+    {
+        _num_packets.store(
+            _num_packets.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        _num_bytes.store(_num_bytes.load(std::memory_order_relaxed) + num_bytes,
+            std::memory_order_relaxed);
+    }
+
+    inline void record_timeout()
+    {
+        _num_timeouts.store(
+            _num_timeouts.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    link_stats_t snapshot() const
+    {
+        link_stats_t stats;
+        stats.num_packets  = _num_packets.load(std::memory_order_relaxed);
+        stats.num_bytes    = _num_bytes.load(std::memory_order_relaxed);
+        stats.num_timeouts = _num_timeouts.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    std::atomic<uint64_t> _num_packets{0};
+    std::atomic<uint64_t> _num_bytes{0};
+    std::atomic<uint64_t> _num_timeouts{0};
+};
+
 } // namespace detail
 
 /*!
@@ -86,6 +126,11 @@ public:
         return _send_frame_size;
     }
 
+    link_stats_t get_send_stats() const override
+    {
+        return _send_stats.snapshot();
+    }
+
     frame_buff::uptr get_send_buff(int32_t timeout_ms) override
     {
         frame_buff* buff = _free_send_buffs.pop();
@@ -95,6 +140,7 @@ public:
 
         if (!derived->get_send_buff_derived(*buff, timeout_ms)) {
             _free_send_buffs.push(buff);
+            _send_stats.record_timeout();
             return frame_buff::uptr();
         }
 
@@ -109,7 +155,12 @@ public:
         if (buff_ptr->packet_size() != 0) {
             // Call the derived class for link-specific implementation
             auto* derived = static_cast<derived_t*>(this);
+            if (packet_tap::enabled()) {
+                packet_tap::sample(
+                    packet_tap::DIR_TX, buff_ptr->data(), buff_ptr->packet_size());
+            }
             derived->release_send_buff_derived(*buff_ptr);
+            _send_stats.record_packet(buff_ptr->packet_size());
         }
 
         // Reset buff and re-add to free pool
@@ -131,10 +182,17 @@ protected:
         _free_send_buffs.push(buff);
     }
 
+    //! Counters for derived classes that bypass the base class methods
+    detail::link_stats_counters& send_stats_counters()
+    {
+        return _send_stats;
+    }
+
 private:
     size_t _send_frame_size;
     size_t _num_send_frames;
     detail::free_buff_pool _free_send_buffs;
+    detail::link_stats_counters _send_stats;
 };
 
 /*!
@@ -178,6 +236,11 @@ public:
         return _recv_frame_size;
     }
 
+    link_stats_t get_recv_stats() const override
+    {
+        return _recv_stats.snapshot();
+    }
+
     frame_buff::uptr get_recv_buff(int32_t timeout_ms) override
     {
         frame_buff* buff = _free_recv_buffs.pop();
@@ -189,9 +252,14 @@ public:
 
         if (len == 0) {
             _free_recv_buffs.push(buff);
+            _recv_stats.record_timeout();
             return frame_buff::uptr();
         } else {
             buff->set_packet_size(len);
+            _recv_stats.record_packet(len);
+            if (packet_tap::enabled()) {
+                packet_tap::sample(packet_tap::DIR_RX, buff->data(), len);
+            }
             return frame_buff::uptr(buff);
         }
     }
@@ -225,10 +293,17 @@ protected:
         _free_recv_buffs.push(buff);
     }
 
+    //! Counters for derived classes that bypass the base class methods
+    detail::link_stats_counters& recv_stats_counters()
+    {
+        return _recv_stats;
+    }
+
 private:
     size_t _recv_frame_size;
     size_t _num_recv_frames;
     detail::free_buff_pool _free_recv_buffs;
+    detail::link_stats_counters _recv_stats;
 };
 
 }} // namespace uhd::transport
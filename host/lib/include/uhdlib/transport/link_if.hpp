@@ -8,10 +8,27 @@
 
 #include <uhd/transport/adapter_id.hpp>
 #include <uhd/transport/frame_buff.hpp>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 
 namespace uhd { namespace transport {
 
+/*!
+ * Snapshot of the always-on counters kept by a link for one direction.
+ * The counters are maintained by the single thread driving the link and can
+ * be polled from any thread without perturbing the hot path.
+ */
+struct link_stats_t
+{
+    //! Number of packets successfully sent or received
+    uint64_t num_packets = 0;
+    //! Number of payload bytes successfully sent or received
+    uint64_t num_bytes = 0;
+    //! Number of buffer requests that returned no buffer within the timeout
+    uint64_t num_timeouts = 0;
+};
+
 /*!
  * Link interface for transmitting packets.
  */
@@ -51,6 +68,42 @@ public:
      */
     virtual void release_send_buff(frame_buff::uptr buff) = 0;
 
+    /*!
+     * Send a packet assembled from the contents of the frame buffer
+     * (typically the packet header) followed by an external payload buffer,
+     * then release the frame buffer. The payload only needs to remain valid
+     * for the duration of the call.
+     *
+     * The default implementation copies the payload into the frame buffer.
+     * Links that support scatter-gather I/O override this method to hand
+     * both regions to the kernel directly, avoiding the payload copy (see
+     * supports_scatter_gather_send()).
+     *
+     * \param buff frame buffer containing the packet header
+     * \param payload pointer to the payload data to send after the header
+     * \param payload_size size of the payload in bytes
+     *
+     * Throws an exception if an I/O error occurs while sending
+     */
+    virtual void release_send_buff_sg(
+        frame_buff::uptr buff, const void* payload, const size_t payload_size)
+    {
+        std::memcpy(static_cast<uint8_t*>(buff->data()) + buff->packet_size(),
+            payload,
+            payload_size);
+        buff->set_packet_size(buff->packet_size() + payload_size);
+        release_send_buff(std::move(buff));
+    }
+
+    /*!
+     * Returns whether release_send_buff_sg() sends the payload without
+     * copying it into the frame buffer.
+     */
+    virtual bool supports_scatter_gather_send() const
+    {
+        return false;
+    }
+
     /*!
      * Get the physical adapter id used for this link
      */
@@ -65,6 +118,15 @@ public:
         return true;
     }
 
+    /*!
+     * Get a snapshot of the send-side statistics counters. Links that do not
+     * implement counters return all zeros.
+     */
+    virtual link_stats_t get_send_stats() const
+    {
+        return {};
+    }
+
     send_link_if()                               = default;
     send_link_if(const send_link_if&)            = delete;
     send_link_if& operator=(const send_link_if&) = delete;
@@ -119,6 +181,15 @@ public:
         return true;
     }
 
+    /*!
+     * Get a snapshot of the receive-side statistics counters. Links that do
+     * not implement counters return all zeros.
+     */
+    virtual link_stats_t get_recv_stats() const
+    {
+        return {};
+    }
+
     recv_link_if()                               = default;
     recv_link_if(const recv_link_if&)            = delete;
     recv_link_if& operator=(const recv_link_if&) = delete;
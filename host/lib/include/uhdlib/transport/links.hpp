@@ -23,6 +23,10 @@ using both_links_t = std::tuple<uhd::transport::send_link_if::sptr,
     bool, // packet flow control
     bool>; // enable flow control
 
+//! Special NUMA node value requesting that the link discover the node of its
+//! network adapter and bind frame memory to it
+constexpr int LINK_NUMA_NODE_AUTO = -2;
+
 /*!
  * Parameters for link creation.
  */
@@ -34,6 +38,19 @@ struct link_params_t
     size_t num_send_frames = 0;
     size_t recv_buff_size  = 0;
     size_t send_buff_size  = 0;
+    //! NUMA node to bind frame memory to: a node number, -1 for no binding,
+    //! or LINK_NUMA_NODE_AUTO to use the node of the network adapter
+    int numa_node = -1;
+    //! Back frame memory with hugepages where supported
+    bool use_hugepages = false;
+    //! Allocate frame memory from the process-wide external allocator, e.g.,
+    //! CUDA-registered memory for NIC-to-GPU peer DMA (see
+    //! buffer_pool::set_external_allocator())
+    bool use_ext_alloc = false;
+    //! IP TOS byte (DSCP marking) to set on the link's socket, or -1 to use
+    //! the OS default. Control links default to DSCP EF so that control
+    //! traffic is prioritized over bulk data on shared network paths.
+    int ip_tos = -1;
 };
 
 
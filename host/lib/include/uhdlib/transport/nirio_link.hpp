@@ -15,6 +15,7 @@
 #include <uhdlib/transport/adapter_info.hpp>
 #include <uhdlib/transport/link_base.hpp>
 #include <uhdlib/transport/links.hpp>
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -79,6 +80,11 @@ public:
      * \param addr a string representing the destination address
      * \param port a string representing the destination port
      * \param params Values for frame sizes, num frames, and buffer sizes
+     * \param hints Transport hints; in addition to the usual frame size and
+     *              buffer size hints, `dma_ring_size' sets the depth of the
+     *              kernel DMA rings in bytes (per direction), which may be
+     *              larger than the transport's circular buffer to absorb
+     *              bursts
      * \param[out] recv_buff_size Returns the recv buffer size
      * \param[out] send_buff_size Returns the send buffer size
      */
@@ -133,7 +139,8 @@ private:
 
     nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
         uint32_t instance,
-        const link_params_t& params);
+        const link_params_t& params,
+        const size_t dma_ring_size);
 
     /**************************************************************************
      * NI-RIO specific helpers
@@ -149,25 +156,56 @@ private:
     UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
     {
         using namespace uhd::niusrprio;
-        nirio_status status    = 0;
-        size_t elems_acquired  = 0;
-        size_t elems_remaining = 0;
         // This will modify the data pointer in buff if successful:
         fifo_data_t** data_ptr = static_cast<nirio_frame_buff&>(buff).get_fifo_ptr_ref();
-        nirio_status_chain(_recv_fifo->acquire(*data_ptr,
-                               _link_params.recv_frame_size / sizeof(fifo_data_t),
-                               static_cast<uint32_t>(timeout_ms),
-                               elems_acquired,
-                               elems_remaining),
-            status);
-        const size_t length = elems_acquired * sizeof(fifo_data_t);
 
-        if (nirio_status_not_fatal(status)) {
-            return length;
-        } else if (status == NiRio_Status_CommunicationTimeout) {
+        // Adaptive wait: spin briefly with non-blocking acquires to pick up
+        // data that is already in the DMA ring with minimal latency, then
+        // fall back to kernel-event waits with exponentially growing
+        // timeouts so an idle channel does not hammer the bus. A timeout of
+        // zero keeps the old single non-blocking check for polling callers.
+        const size_t num_spin_tries = (timeout_ms == 0) ? 1 : RECV_NUM_SPIN_TRIES;
+        int32_t remaining_ms        = timeout_ms;
+        int32_t backoff_ms          = RECV_BACKOFF_START_MS;
+        size_t attempt              = 0;
+        nirio_status status         = 0;
+
+        while (true) {
+            int32_t wait_ms = 0;
+            if (attempt >= num_spin_tries) {
+                wait_ms    = std::min(backoff_ms, remaining_ms);
+                backoff_ms = std::min(backoff_ms * 2, RECV_BACKOFF_MAX_MS);
+            }
+
+            status                 = 0;
+            size_t elems_acquired  = 0;
+            size_t elems_remaining = 0;
+            nirio_status_chain(_recv_fifo->acquire(*data_ptr,
+                                   _link_params.recv_frame_size / sizeof(fifo_data_t),
+                                   static_cast<uint32_t>(wait_ms),
+                                   elems_acquired,
+                                   elems_remaining),
+                status);
+
+            if (nirio_status_not_fatal(status)) {
+                if (elems_acquired > 0) {
+                    return elems_acquired * sizeof(fifo_data_t);
+                }
+            } else if (status != NiRio_Status_CommunicationTimeout) {
+                return 0; // zero for error
+            }
+
+            remaining_ms -= wait_ms;
+            attempt++;
+            if (attempt >= num_spin_tries && remaining_ms <= 0) {
+                break;
+            }
+        }
+
+        if (status == NiRio_Status_CommunicationTimeout) {
             nirio_status_to_exception(status, "NI-RIO PCIe data transfer failed.");
         }
-        return 0; // zero for timeout or error.
+        return 0; // zero for timeout
     }
 
     UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& /*buff*/)
@@ -208,6 +246,14 @@ private:
     /**************************************************************************
      * Private attributes
      *************************************************************************/
+    //! Number of non-blocking acquire attempts before falling back to
+    // kernel-event waits
+    static constexpr size_t RECV_NUM_SPIN_TRIES = 8;
+    //! Initial kernel wait duration once the spin phase is exhausted
+    static constexpr int32_t RECV_BACKOFF_START_MS = 1;
+    //! Cap for the exponentially growing kernel wait duration
+    static constexpr int32_t RECV_BACKOFF_MAX_MS = 16;
+
     //! Reference to the NI-RIO session
     niusrprio::niusrprio_session::sptr _fpga_session;
     //! DMA channel index
@@ -217,6 +263,9 @@ private:
 
     const link_params_t _link_params;
 
+    //! Depth of the kernel DMA rings in bytes (per direction)
+    const size_t _dma_ring_size;
+
     std::vector<nirio_frame_buff> _recv_buffs;
     std::vector<nirio_frame_buff> _send_buffs;
 
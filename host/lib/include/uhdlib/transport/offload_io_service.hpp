@@ -37,6 +37,11 @@ public:
         //! The thread behavior when waiting for incoming packets If set to
         //! BLOCK, the client type must be set to either RECV_ONLY or SEND_ONLY.
         wait_mode_t wait_mode = POLL;
+        //! Number of worker threads servicing this I/O service. When greater
+        //! than one, the workers share all clients as a pool, stealing work
+        //! from each other at batch granularity, so bursty streams can share
+        //! fewer cores than streams. Requires the POLL wait mode.
+        size_t num_worker_threads = 1;
     };
 
     /*!
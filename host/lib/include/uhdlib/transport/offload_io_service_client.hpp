@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/transport/frame_buff.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <cassert>
 #include <chrono>
 #include <thread>
@@ -86,6 +87,7 @@ public:
         } else {
             frame_buff* buff = _port->client_pop(timeout_ms);
             _num_frames_in_use += buff ? 1 : 0;
+            UHD_TRACEPOINT(io_recv_buff_get, _port.get(), _num_frames_in_use);
             return frame_buff::uptr(buff);
         }
     }
@@ -95,6 +97,16 @@ public:
         assert(buff);
         _port->client_push(buff.release());
         _num_frames_in_use--;
+        UHD_TRACEPOINT(io_recv_buff_release, _port.get(), _num_frames_in_use);
+    }
+
+    void release_recv_buffs(frame_buff::uptr* buffs, const size_t num_buffs)
+    {
+        // The whole batch goes to the offload thread in a single queue
+        // transaction, instead of one per buffer
+        _port->client_push(buffs, num_buffs);
+        _num_frames_in_use -= num_buffs;
+        UHD_TRACEPOINT(io_recv_buff_release, _port.get(), _num_frames_in_use);
     }
 
 private:
@@ -153,6 +165,7 @@ public:
         } else {
             frame_buff* buff = _port->client_pop(timeout_ms);
             _num_frames_in_use += buff ? 1 : 0;
+            UHD_TRACEPOINT(io_send_buff_get, _port.get(), _num_frames_in_use);
             return frame_buff::uptr(buff);
         }
     }
@@ -162,6 +175,7 @@ public:
         assert(buff);
         _port->client_push(buff.release());
         _num_frames_in_use--;
+        UHD_TRACEPOINT(io_send_buff_release, _port.get(), _num_frames_in_use);
     }
 
 private:
@@ -0,0 +1,88 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace uhd { namespace transport {
+
+/*! Sampled packet tap for production diagnostics
+ *
+ * Captures the headers of 1-in-N packets passing through the link layer into
+ * a bounded lock-free ring, which a background diagnostics thread drains to a
+ * trace file. This provides representative CHDR header traces during live
+ * incidents on hosts where full capture (e.g. tcpdump at 10GbE line rate) is
+ * not an option.
+ *
+ * The tap is disabled by default. While disabled, the only per-packet cost is
+ * a relaxed atomic load and a predictable branch in enabled(). It is enabled
+ * at runtime via the device args, e.g.:
+ *
+ *     addr=..., packet_tap=1000, packet_tap_file=/tmp/trace.log
+ *
+ * where the value of packet_tap is the sampling interval N (sample one packet
+ * header out of every N per thread). If the ring fills faster than the
+ * diagnostics thread drains it, samples are dropped and counted rather than
+ * blocking the hot path.
+ */
+class packet_tap
+{
+public:
+    enum direction_t : uint8_t { DIR_RX = 0, DIR_TX = 1 };
+
+    //! Number of leading packet bytes captured per sample (CHDR header plus
+    // timestamp word)
+    static constexpr size_t MAX_HDR_BYTES = 16;
+
+    /*! Start sampling
+     *
+     * Opens the trace file, starts the diagnostics thread, and enables the
+     * per-packet sampling sites. Has no effect if the tap is already running.
+     *
+     * \param sample_interval Sample one packet out of every sample_interval
+     * \param trace_file Path of the trace file to write; if empty, a file
+     *                   named after the current monotonic clock count is
+     *                   created in the UHD temp directory
+     */
+    static void start(const size_t sample_interval, const std::string& trace_file = "");
+
+    /*! Stop sampling
+     *
+     * Disables the sampling sites, drains any remaining records to the trace
+     * file, and joins the diagnostics thread. Has no effect if the tap is not
+     * running.
+     */
+    static void stop();
+
+    //! Returns whether sampling is enabled. Cheap enough to call per packet.
+    static UHD_FORCE_INLINE bool enabled()
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /*! Offer a packet to the tap
+     *
+     * Callers should gate this behind enabled(). Applies 1-in-N decimation
+     * using a per-thread counter, then copies the first MAX_HDR_BYTES of the
+     * packet plus metadata into the ring. Never blocks: if the ring is full,
+     * the sample is dropped and counted.
+     *
+     * \param dir Direction the packet is traveling
+     * \param data Pointer to the start of the packet
+     * \param packet_size Size of the packet in bytes
+     */
+    static void sample(const direction_t dir, const void* data, const size_t packet_size);
+
+private:
+    static std::atomic<bool> _enabled;
+};
+
+}} // namespace uhd::transport
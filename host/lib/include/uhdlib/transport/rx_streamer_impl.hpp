@@ -113,6 +113,18 @@ public:
         }
     }
 
+    /*! Release ownership of all connected transports
+     *
+     * Returns the transports so their (potentially slow) teardown can be
+     * run independently of this streamer's destruction. The streamer must
+     * not be used for receiving afterwards; this is intended to be called
+     * from a subclass destructor only.
+     */
+    std::vector<typename transport_t::uptr> release_xports()
+    {
+        return _zero_copy_streamer.release_xports();
+    }
+
     //! Implementation of rx_streamer API method
     size_t get_num_channels() const override
     {
@@ -400,9 +412,21 @@ private:
 
         _convert_info = info;
 
+        // Optionally spread the conversion across multiple threads. This
+        // helps at very high rates, where one core cannot keep up with the
+        // conversion of multiple channels.
+        const size_t convert_threads =
+            stream_args.args.cast<size_t>("convert_threads", 1);
+
+        // Optionally bypass the cache when writing converted samples, for
+        // callers that stream into huge buffers they won't read back soon
+        const bool nt_stores = stream_args.args.has_key("nt_stores")
+                               and stream_args.args.cast<size_t>("nt_stores", 0) != 0;
+
         for (size_t i = 0; i < num_ports; i++) {
-            _converters.push_back(convert::get_converter(id)());
+            _converters.push_back(convert::get_parallel_converter(id, convert_threads));
             _converters.back()->set_scalar(1 / 32767.0);
+            _converters.back()->set_nt_stores(nt_stores);
         }
     }
 
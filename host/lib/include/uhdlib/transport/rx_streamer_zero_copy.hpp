@@ -11,6 +11,7 @@
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/get_aligned_buffs.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <boost/format.hpp>
 #include <atomic>
 #include <vector>
@@ -128,6 +129,28 @@ public:
         return _xports.size();
     }
 
+    /*! Release ownership of all transports
+     *
+     * Held frame buffers are returned to their transports first. The
+     * streamer keeps its channel count but is unusable for receiving
+     * afterwards; this exists only so teardown of the transports can be
+     * decoupled from destruction of the streamer.
+     */
+    std::vector<typename transport_t::uptr> release_xports()
+    {
+        for (size_t i = 0; i < _frame_buffs.size(); i++) {
+            if (_frame_buffs[i]) {
+                _xports[i]->release_recv_buff(std::move(_frame_buffs[i]));
+                _frame_buffs[i] = typename transport_t::buff_t::uptr();
+            }
+        }
+        // Leave a same-sized vector of empty pointers behind so the
+        // destructor and get_num_channels() stay well-defined
+        std::vector<typename transport_t::uptr> xports(_xports.size());
+        std::swap(xports, _xports);
+        return xports;
+    }
+
     //! Configures tick rate for conversion of timestamp
     void set_tick_rate(const double rate)
     {
@@ -195,6 +218,7 @@ public:
                         break;
 
                     case get_aligned_buffs_t::SEQUENCE_ERROR:
+                        UHD_TRACEPOINT(rx_seq_error, this);
                         std::tie(metadata.has_time_spec, metadata.time_spec) =
                             _last_read_time_info.get_next_packet_time(_samp_rate);
                         metadata.out_of_sequence = true;
@@ -223,6 +247,7 @@ public:
                     // An overrun occurred and the user has read all the packets
                     // that were buffered prior to the overrun. Call the overrun
                     // handler and return overrun error.
+                    UHD_TRACEPOINT(rx_overrun, this);
                     _handle_overrun();
                     std::tie(metadata.has_time_spec, metadata.time_spec) =
                         _last_read_time_info.get_next_packet_time(_samp_rate);
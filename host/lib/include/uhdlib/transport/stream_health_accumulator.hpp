@@ -0,0 +1,105 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/stream_health.hpp>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Accumulates stream_health_t statistics for a streamer.
+ *
+ * The recording calls are intended for the packet handlers' error paths:
+ * they take a mutex, but streaming incidents are rare enough that this
+ * never shows up on the fast path. get_health() returns a snapshot with
+ * the EWMA rates decayed to the current time, and is cheap enough to poll
+ * at 1 Hz across many streamers.
+ */
+class stream_health_accumulator
+{
+public:
+    void record_overrun()
+    {
+        _record(_health.overruns);
+    }
+
+    void record_underrun()
+    {
+        _record(_health.underruns);
+    }
+
+    void record_seq_error()
+    {
+        _record(_health.seq_errors);
+    }
+
+    void record_late()
+    {
+        _record(_health.lates);
+    }
+
+    void record_timeout()
+    {
+        _record(_health.timeouts);
+    }
+
+    //! Returns a snapshot of the health counters with rates decayed to now
+    stream_health_t get_health() const
+    {
+        const double now = _steady_time();
+        std::lock_guard<std::mutex> lock(_mutex);
+        stream_health_t health = _health;
+        _decay_rate(health.overruns, now);
+        _decay_rate(health.underruns, now);
+        _decay_rate(health.seq_errors, now);
+        _decay_rate(health.lates, now);
+        _decay_rate(health.timeouts, now);
+        return health;
+    }
+
+private:
+    //! Averaging time constant for the EWMA rates, in seconds
+    static constexpr double EWMA_TAU = 10.0;
+
+    static double _steady_time()
+    {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static void _decay_rate(stream_health_t::counter_t& counter, const double now)
+    {
+        if (counter.count > 0) {
+            counter.rate *= std::exp((counter.last_time - now) / EWMA_TAU);
+        }
+    }
+
+    void _record(stream_health_t::counter_t& counter)
+    {
+        const double now = _steady_time();
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Each event contributes 1/tau to the rate, and prior contributions
+        // decay exponentially with the time since the last event
+        if (counter.count > 0) {
+            counter.rate = counter.rate * std::exp((counter.last_time - now) / EWMA_TAU)
+                           + 1.0 / EWMA_TAU;
+        } else {
+            counter.rate = 1.0 / EWMA_TAU;
+        }
+        counter.count++;
+        counter.last_time = now;
+    }
+
+    mutable std::mutex _mutex;
+    stream_health_t _health;
+};
+
+}} // namespace uhd::transport
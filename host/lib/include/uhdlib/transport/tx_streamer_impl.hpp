@@ -437,8 +437,14 @@ private:
 
         _convert_info = info;
 
+        // Optionally spread the conversion across multiple threads. This
+        // helps at very high rates, where one core cannot keep up with the
+        // conversion of multiple channels.
+        const size_t convert_threads =
+            stream_args.args.cast<size_t>("convert_threads", 1);
+
         for (size_t i = 0; i < num_chans; i++) {
-            _converters.push_back(convert::get_converter(id)());
+            _converters.push_back(convert::get_parallel_converter(id, convert_threads));
             _converters.back()->set_scalar(32767.0);
         }
     }
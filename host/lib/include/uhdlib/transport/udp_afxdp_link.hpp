@@ -0,0 +1,264 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <xdp/xsk.h>
+#include <boost/asio.hpp>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * A frame buffer backed by a UMEM chunk shared with the kernel's AF_XDP
+ * socket. The chunk address is needed to hand the chunk back to the fill
+ * ring (recv) or to build a TX descriptor (send).
+ */
+class udp_afxdp_frame_buff : public frame_buff
+{
+public:
+    udp_afxdp_frame_buff(void* mem, const uint64_t umem_addr, const bool is_send)
+        : _umem_addr(umem_addr), _is_send(is_send)
+    {
+        _data = mem;
+    }
+
+    //! Address of this buffer's chunk within the UMEM region
+    uint64_t umem_addr() const
+    {
+        return _umem_addr;
+    }
+
+    //! Point this buffer at the payload of a newly received frame
+    void set_data(void* mem)
+    {
+        _data = mem;
+    }
+
+    //! Returns true if this buffer belongs to the send half of the link
+    bool is_send() const
+    {
+        return _is_send;
+    }
+
+private:
+    const uint64_t _umem_addr;
+    const bool _is_send;
+};
+
+/*!
+ * A zero-copy UDP link using an AF_XDP socket.
+ *
+ * The NIC DMAs received frames directly into a UMEM region shared with this
+ * process, and TX frames are handed to the driver the same way, so the
+ * kernel's UDP stack is bypassed while the NIC itself stays under kernel
+ * control (no device unbinding, unlike DPDK). The link binds to one NIC
+ * queue and relies on flow steering to direct its stream there; frames on
+ * that queue which do not belong to the stream are dropped.
+ *
+ * Since the kernel stack never sees the stream's packets, this link builds
+ * and parses the Ethernet/IPv4/UDP headers itself. A regular connected UDP
+ * socket is kept open on the same local port to reserve the port and to
+ * resolve the peer's MAC address through the kernel's neighbor table.
+ *
+ * Like udp_dpdk_link and udp_iouring_link, this class implements
+ * recv_link_if and send_link_if directly rather than deriving from the
+ * link_base templates, because receive buffers complete in NIC order rather
+ * than free-pool order.
+ */
+class udp_afxdp_link : public virtual recv_link_if, public virtual send_link_if
+{
+public:
+    using sptr = std::shared_ptr<udp_afxdp_link>;
+
+    //! Size of a UMEM chunk; one frame must fit along with its headers and
+    // the XDP headroom
+    static constexpr size_t UMEM_CHUNK_SIZE = XSK_UMEM__DEFAULT_FRAME_SIZE;
+
+    //! Largest CHDR frame this link can carry (the rest of the chunk is
+    // taken up by XDP headroom and the Ethernet/IPv4/UDP headers)
+    static constexpr size_t MAX_FRAME_SIZE = 3000;
+
+    /*!
+     * Make a new AF_XDP UDP link.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param queue_id the NIC queue to bind to; the caller must steer the
+     *                 stream's flow to this queue (see
+     *                 program_udp_flow_steering())
+     * \param params Values for frame sizes, num frames, and buffer sizes
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const size_t queue_id,
+        const link_params_t& params);
+
+    virtual ~udp_afxdp_link();
+
+    /*!
+     * Get an empty frame buffer in which to write packet contents.
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+                         of ms to wait, a negative value specifies to block
+                         until successful, and a value of 0 specifies no wait.
+     * \return a frame buffer, or null uptr if timeout occurs
+     */
+    frame_buff::uptr get_send_buff(int32_t timeout_ms) override;
+
+    /*!
+     * Send a packet with the contents of the frame buffer and release the
+     * buffer, allowing the link driver to reuse it. If the size of the frame
+     * buffer is 0, the buffer is released with no packet being sent.
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_send_buff(frame_buff::uptr buff) override;
+
+    /*!
+     * Attempt to get a frame buffer with data from the receive link.
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+                         of ms to wait, a negative value specifies to block
+                         until successful, and a value of 0 specifies no wait.
+     * \return a frame buffer, or null uptr if timeout occurs
+     */
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override;
+
+    /*!
+     * Release a frame buffer, handing its chunk back to the fill ring for
+     * the NIC to reuse.
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_recv_buff(frame_buff::uptr buff) override;
+
+    size_t get_num_recv_frames() const override
+    {
+        return _num_recv_frames;
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _recv_frame_size;
+    }
+
+    size_t get_num_send_frames() const override
+    {
+        return _num_send_frames;
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _send_frame_size;
+    }
+
+    /*! Return the local port of the UDP connection. Port is in host byte order.
+     *
+     * \returns Port number or 0 if port number couldn't be identified.
+     */
+    uint16_t get_local_port() const;
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    link_stats_t get_recv_stats() const override
+    {
+        return _recv_stats.snapshot();
+    }
+
+    link_stats_t get_send_stats() const override
+    {
+        return _send_stats.snapshot();
+    }
+
+private:
+    udp_afxdp_link(const std::string& addr,
+        const std::string& port,
+        const size_t queue_id,
+        const link_params_t& params);
+
+    //! Push a chunk back onto the fill ring so the NIC can receive into it
+    void _refill(const uint64_t umem_addr);
+
+    //! Move completed RX descriptors into the ready queue, dropping frames
+    // that do not belong to this link's flow
+    void _reap_rx();
+
+    //! Harvest TX completions, returning their chunks to the free list
+    void _reap_tx_completions();
+
+    //! Wake the kernel if the fill or TX rings request it
+    void _kick_rings();
+
+    //! Block up to timeout_ms for RX traffic on the XDP socket
+    bool _poll_rx(int32_t timeout_ms);
+
+    const size_t _recv_frame_size;
+    const size_t _num_recv_frames;
+    const size_t _send_frame_size;
+    const size_t _num_send_frames;
+
+    //! The UMEM region shared with the kernel
+    void* _umem_area = nullptr;
+    size_t _umem_size;
+
+    struct xsk_umem* _umem     = nullptr;
+    struct xsk_socket* _socket = nullptr;
+    struct xsk_ring_prod _fill_ring;
+    struct xsk_ring_cons _comp_ring;
+    struct xsk_ring_cons _rx_ring;
+    struct xsk_ring_prod _tx_ring;
+
+    //! One frame buff per UMEM chunk, indexed by chunk
+    std::vector<udp_afxdp_frame_buff> _buffs;
+
+    //! Completed recv frames that have not yet been handed to the caller
+    std::deque<frame_buff*> _recv_ready;
+    //! TX chunks available for get_send_buff()
+    std::vector<frame_buff*> _send_free;
+
+    detail::link_stats_counters _recv_stats;
+    detail::link_stats_counters _send_stats;
+
+    //! Interface the XDP socket is bound to
+    std::string _ifname;
+    size_t _queue_id;
+
+    //! Header fields for the frames this link builds and parses
+    uint8_t _local_mac[6];
+    uint8_t _remote_mac[6];
+    uint32_t _local_ipv4;
+    uint32_t _remote_ipv4;
+    uint16_t _local_udp_port;
+    uint16_t _remote_udp_port;
+    uint16_t _ip_ident = 0;
+
+    //! Shadow kernel socket holding the local UDP port
+    boost::asio::io_context _io_context;
+    std::shared_ptr<boost::asio::ip::udp::socket> _shadow_socket;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
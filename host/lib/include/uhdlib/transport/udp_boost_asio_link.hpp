@@ -14,9 +14,14 @@
 #include <uhdlib/transport/links.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <boost/asio.hpp>
+#include <deque>
 #include <memory>
 #include <vector>
 
+#ifdef UHD_PLATFORM_LINUX
+#    include <sys/socket.h>
+#endif
+
 namespace uhd { namespace transport {
 
 class udp_boost_asio_frame_buff : public frame_buff
@@ -67,12 +72,43 @@ public:
      * \param params Values for frame sizes, num frames, and buffer sizes
      * \param[out] recv_socket_buff_size Returns the recv socket buffer size
      * \param[out] send_socket_buff_size Returns the send socket buffer size
+     * \param recv_batching if true, pull up to num_recv_frames packets per
+     *                      kernel crossing using recvmmsg() and hand them out
+     *                      from an internal ready queue (Linux only, ignored
+     *                      elsewhere)
      */
     static sptr make(const std::string& addr,
         const std::string& port,
         const link_params_t& params,
         size_t& recv_socket_buff_size,
-        size_t& send_socket_buff_size);
+        size_t& send_socket_buff_size,
+        const bool recv_batching = false);
+
+#ifndef UHD_PLATFORM_WIN32
+    /*! Send header and payload from separate memory regions with a single
+     * sendmsg() call, avoiding the payload copy into the frame buffer.
+     */
+    void release_send_buff_sg(frame_buff::uptr buff,
+        const void* payload,
+        const size_t payload_size) override;
+
+    bool supports_scatter_gather_send() const override
+    {
+        return true;
+    }
+#endif
+
+#ifdef UHD_PLATFORM_LINUX
+    /*! In batched mode, pop a received frame from the ready queue, refilling
+     * the queue with a single recvmmsg() call when it runs dry.
+     */
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override;
+
+    /*! In batched mode, return the frame to the pool used to post buffers to
+     * the next recvmmsg() call.
+     */
+    void release_recv_buff(frame_buff::uptr buff) override;
+#endif
 
     /*! Return the local port of the UDP connection. Port is in host byte order.
      *
@@ -111,8 +147,15 @@ private:
     friend recv_link_base_t;
     friend send_link_base_t;
 
-    udp_boost_asio_link(
-        const std::string& addr, const std::string& port, const link_params_t& params);
+    udp_boost_asio_link(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const bool recv_batching);
+
+#ifdef UHD_PLATFORM_LINUX
+    //! Post all free buffers to the kernel in one recvmmsg() call
+    size_t _refill_ready_queue(int32_t timeout_ms);
+#endif
 
     size_t resize_recv_socket_buffer(size_t num_bytes);
     size_t resize_send_socket_buffer(size_t num_bytes);
@@ -150,6 +193,18 @@ private:
     std::shared_ptr<boost::asio::ip::udp::socket> _socket;
     int _sock_fd;
     adapter_id_t _adapter_id;
+
+    const bool _recv_batching;
+
+#ifdef UHD_PLATFORM_LINUX
+    // State for batched (recvmmsg) mode. Buffers cycle between the free pool
+    // (available to post to the kernel) and the ready queue (received packets
+    // not yet handed to the caller).
+    std::vector<frame_buff*> _batch_free_buffs;
+    std::deque<frame_buff*> _batch_ready_buffs;
+    std::vector<::mmsghdr> _batch_msgs;
+    std::vector<::iovec> _batch_iovecs;
+#endif
 };
 
 }} // namespace uhd::transport
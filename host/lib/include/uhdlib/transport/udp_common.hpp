@@ -12,6 +12,7 @@
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/constants.hpp>
 #include <uhd/types/device_addr.hpp>
+#include <uhd/utils/cast.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/links.hpp>
 #include <uhdlib/utils/narrow.hpp>
@@ -19,6 +20,24 @@
 #include <boost/format.hpp>
 #include <thread>
 
+#ifdef UHD_PLATFORM_LINUX
+#    include <arpa/inet.h>
+#    include <ifaddrs.h>
+#    include <linux/ethtool.h>
+#    include <linux/sockios.h>
+#    include <net/if.h>
+#    include <sys/ioctl.h>
+#    include <unistd.h>
+#    include <cstring>
+#    include <fstream>
+#endif
+#ifndef UHD_PLATFORM_WIN32
+#    include <netinet/in.h>
+#    include <netinet/ip.h>
+#    include <sys/socket.h>
+#    include <sys/uio.h>
+#endif
+
 namespace uhd { namespace transport {
 
 // Jumbo frames can be up to 9600 bytes;
@@ -40,6 +59,11 @@ static const size_t MAX_BUFF_SIZE_ETH_MACOS = 0x100000; // 1Mib
 
 typedef std::shared_ptr<boost::asio::ip::udp::socket> socket_sptr;
 
+//! Default IP TOS byte for control links: DSCP EF (expedited forwarding), so
+//! that control transactions are not queued behind bulk data in NIC and
+//! switch queues on shared network paths
+constexpr int UDP_CTRL_DEFAULT_TOS = 0xB8;
+
 /*!
  * Wait for the socket to become ready for a receive operation.
  * \param sock_fd the open socket file descriptor
@@ -97,6 +121,140 @@ UHD_INLINE socket_sptr open_udp_socket(
     return socket;
 }
 
+/*!
+ * Set the IP TOS byte (DSCP marking) on an open UDP socket.
+ *
+ * \param socket the socket to mark
+ * \param tos the full TOS byte value (e.g., 0xB8 for DSCP EF), or -1 for a
+ *            no-op
+ */
+UHD_INLINE void set_udp_socket_tos(socket_sptr& socket, const int tos)
+{
+    if (tos < 0) {
+        return;
+    }
+#ifdef UHD_PLATFORM_WIN32
+    // Windows ignores IP_TOS set via setsockopt (QoS is policy-driven there)
+    UHD_LOG_DEBUG("UDP", "IP TOS marking is not supported on Windows, ignoring");
+#else
+    const int tos_val = tos;
+    if (::setsockopt(socket->native_handle(),
+            IPPROTO_IP,
+            IP_TOS,
+            &tos_val,
+            sizeof(tos_val))
+        != 0) {
+        UHD_LOG_WARNING("UDP",
+            "Could not set IP TOS to " << std::hex << "0x" << tos << std::dec
+                                       << " on UDP socket");
+    }
+#endif
+}
+
+#ifdef UHD_PLATFORM_LINUX
+/*!
+ * Look up the name of the local network interface that carries traffic to
+ * the given destination address, by finding the interface on the same subnet.
+ *
+ * \param addr the destination IPv4 address as a dotted string
+ * \return the interface name, or an empty string if it could not be found
+ */
+UHD_INLINE std::string get_iface_for_udp_dest(const std::string& addr)
+{
+    std::string iface;
+    ifaddrs* ifap;
+    if (::getifaddrs(&ifap) != 0) {
+        return iface;
+    }
+    const in_addr_t dest = ::inet_addr(addr.c_str());
+    for (ifaddrs* it = ifap; it != nullptr; it = it->ifa_next) {
+        if (it->ifa_addr == nullptr || it->ifa_addr->sa_family != AF_INET
+            || it->ifa_netmask == nullptr) {
+            continue;
+        }
+        const in_addr_t if_addr =
+            reinterpret_cast<sockaddr_in*>(it->ifa_addr)->sin_addr.s_addr;
+        const in_addr_t netmask =
+            reinterpret_cast<sockaddr_in*>(it->ifa_netmask)->sin_addr.s_addr;
+        if ((if_addr & netmask) == (dest & netmask)) {
+            iface = it->ifa_name;
+            break;
+        }
+    }
+    ::freeifaddrs(ifap);
+    return iface;
+}
+
+/*!
+ * Look up the NUMA node of the network adapter that carries traffic to the
+ * given destination address, by finding the local interface on the same
+ * subnet and reading its node from sysfs.
+ *
+ * \param addr the destination IPv4 address as a dotted string
+ * \return the NUMA node number, or -1 if it could not be determined
+ */
+UHD_INLINE int get_numa_node_for_udp_dest(const std::string& addr)
+{
+    const std::string iface = get_iface_for_udp_dest(addr);
+    if (iface.empty()) {
+        return -1;
+    }
+    int node = -1;
+    std::ifstream numa_file("/sys/class/net/" + iface + "/device/numa_node");
+    if (numa_file) {
+        numa_file >> node;
+    }
+    return node;
+}
+
+/*!
+ * Program an ntuple flow steering rule into the NIC that carries traffic to
+ * the given destination address, directing packets sent by the device to
+ * this stream's local UDP port onto the requested RX queue. This keeps
+ * multiple streams from hashing onto the same queue/core pair.
+ *
+ * Requires CAP_NET_ADMIN and a NIC with ntuple filter support; callers
+ * should treat failure as non-fatal and fall back to the default RSS
+ * hashing.
+ *
+ * \param addr the destination (device) IPv4 address as a dotted string
+ * \param local_port the local UDP port of the stream's socket, in host order
+ * \param queue the NIC RX queue to steer the flow to
+ * \return true if the rule was programmed successfully
+ */
+UHD_INLINE bool program_udp_flow_steering(
+    const std::string& addr, const uint16_t local_port, const uint32_t queue)
+{
+    const std::string iface = get_iface_for_udp_dest(addr);
+    if (iface.empty() || iface.length() >= IFNAMSIZ) {
+        return false;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+
+    ethtool_rxnfc nfc               = {};
+    nfc.cmd                         = ETHTOOL_SRXCLSRLINS;
+    nfc.fs.flow_type                = UDP_V4_FLOW;
+    nfc.fs.h_u.udp_ip4_spec.ip4src  = ::inet_addr(addr.c_str());
+    nfc.fs.m_u.udp_ip4_spec.ip4src  = 0xFFFFFFFF;
+    nfc.fs.h_u.udp_ip4_spec.pdst    = htons(local_port);
+    nfc.fs.m_u.udp_ip4_spec.pdst    = 0xFFFF;
+    nfc.fs.ring_cookie              = queue;
+    nfc.fs.location                 = RX_CLS_LOC_ANY;
+
+    ifreq ifr = {};
+    std::strncpy(ifr.ifr_name, iface.c_str(), IFNAMSIZ - 1);
+    ifr.ifr_data = reinterpret_cast<char*>(&nfc);
+
+    const int ret = ::ioctl(fd, SIOCETHTOOL, &ifr);
+    ::close(fd);
+    return ret == 0;
+}
+#endif /* UHD_PLATFORM_LINUX */
+
 UHD_INLINE size_t recv_udp_packet(
     int sock_fd, void* mem, size_t frame_size, int32_t timeout_ms)
 {
@@ -146,6 +304,41 @@ UHD_INLINE void send_udp_packet(int sock_fd, void* mem, size_t len)
     }
 }
 
+#ifndef UHD_PLATFORM_WIN32
+/*!
+ * Send a single UDP packet gathered from multiple memory regions with one
+ * sendmsg() call, so the regions do not have to be copied into a contiguous
+ * buffer first. Uses the same ENOBUFS retry logic as send_udp_packet().
+ *
+ * \param sock_fd the open socket file descriptor
+ * \param iov array of memory regions making up the packet
+ * \param num_iov number of entries in iov
+ * \param total_len total packet length in bytes (sum of the iov lengths)
+ */
+UHD_INLINE void send_udp_packet_sg(
+    int sock_fd, const iovec* iov, const size_t num_iov, const size_t total_len)
+{
+    msghdr msg     = {};
+    msg.msg_iov    = const_cast<iovec*>(iov);
+    msg.msg_iovlen = num_iov;
+
+    while (true) {
+        const ssize_t ret = uhd::narrow_cast<ssize_t>(::sendmsg(sock_fd, &msg, 0));
+        if (ret == ssize_t(total_len))
+            break;
+        if (ret == -1 and errno == ENOBUFS) {
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            continue; // try to send again
+        }
+        if (ret == -1) {
+            throw uhd::io_error(
+                str(boost::format("sendmsg error on socket: %s") % strerror(errno)));
+        }
+        UHD_ASSERT_THROW(ret == ssize_t(total_len));
+    }
+}
+#endif /* !UHD_PLATFORM_WIN32 */
+
 template <typename Opt>
 size_t get_udp_socket_buffer_size(socket_sptr socket)
 {
@@ -252,6 +445,9 @@ inline link_params_t calculate_udp_link_params(
         link_params.num_recv_frames =
             std::max(uhd::rfnoc::CMD_FIFO_SIZE / uhd::rfnoc::MAX_CMD_PKT_SIZE,
                 link_params.num_recv_frames);
+        // Mark control traffic so it is prioritized over bulk data on shared
+        // network paths (can be overridden with the ip_tos argument below)
+        link_params.ip_tos = UDP_CTRL_DEFAULT_TOS;
     } else if (link_type == link_type_t::TX_DATA) {
         // Note that the send frame size will be capped to the Tx MTU.
         link_params.send_frame_size = link_args.cast<size_t>("send_frame_size",
@@ -270,6 +466,27 @@ inline link_params_t calculate_udp_link_params(
             link_args.cast<size_t>("recv_buff_size", link_params.recv_buff_size);
     }
 
+    // Memory placement overrides. numa_node may be a node number or "auto"
+    // to bind frame memory to the node of the network adapter.
+    const std::string numa_node_arg =
+        link_args.get("numa_node", device_args.get("numa_node", ""));
+    if (!numa_node_arg.empty()) {
+        link_params.numa_node = (numa_node_arg == "auto")
+                                    ? LINK_NUMA_NODE_AUTO
+                                    : uhd::cast::from_str<int>(numa_node_arg);
+    }
+    link_params.use_hugepages = uhd::cast::from_str<bool>(
+        link_args.get("hugepages", device_args.get("hugepages", "0")));
+    link_params.use_ext_alloc = uhd::cast::from_str<bool>(
+        link_args.get("ext_alloc", device_args.get("ext_alloc", "0")));
+
+    // IP TOS (DSCP) override, e.g. ip_tos=184 for DSCP EF
+    const std::string ip_tos_arg =
+        link_args.get("ip_tos", device_args.get("ip_tos", ""));
+    if (!ip_tos_arg.empty()) {
+        link_params.ip_tos = uhd::cast::from_str<int>(ip_tos_arg);
+    }
+
 #if defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
     // limit buffer size on OSX to avoid the warning issued by
     // resize_buff_helper
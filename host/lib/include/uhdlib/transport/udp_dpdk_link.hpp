@@ -83,6 +83,41 @@ public:
         return _queue;
     }
 
+    /*!
+     * Set the DMA queue associated with this link
+     *
+     * This is called by the I/O service when flow steering assigns the link
+     * a dedicated NIC queue (see dpdk_port::alloc_rx_flow()). Both RX and
+     * TX then use this queue. Must only be called while the link is not yet
+     * streaming.
+     *
+     * \param queue the queue ID for this link's DMA queue
+     */
+    inline void set_queue_id(dpdk::queue_id_t queue)
+    {
+        _queue = queue;
+    }
+
+    /*!
+     * Request run-to-completion RX for this link
+     *
+     * When set, and when flow steering succeeds in giving this link a
+     * dedicated RX queue, the I/O service stops polling that queue and the
+     * receiving client polls the NIC directly from its own thread, skipping
+     * the cross-thread handoff. Must be set before the link is attached to
+     * the I/O service.
+     */
+    inline void set_rx_run_to_completion(bool enable)
+    {
+        _rx_run_to_completion = enable;
+    }
+
+    //! Returns whether run-to-completion RX was requested for this link
+    inline bool get_rx_run_to_completion() const
+    {
+        return _rx_run_to_completion;
+    }
+
     /*!
      * Get the local UDP port used by this link
      *
@@ -232,7 +267,33 @@ public:
      */
     void release_send_buff(frame_buff::uptr buff);
 
+    /*!
+     * Begin coalescing outgoing packets into a TX batch.
+     *
+     * While a batch is open, release_send_buff() stages packets instead of
+     * transmitting them one at a time, and tx_batch_flush() hands the whole
+     * batch to rte_eth_tx_burst() in a single call. A full batch
+     * (MAX_TX_BATCH_SIZE packets) is flushed automatically.
+     *
+     * Must only be used by the I/O service thread servicing this link.
+     */
+    void tx_batch_begin();
+
+    /*!
+     * Transmit all staged packets in a single burst and close the batch.
+     *
+     * Subsequent calls to release_send_buff() transmit immediately again,
+     * until the next tx_batch_begin().
+     */
+    void tx_batch_flush();
+
+    //! Maximum number of packets staged before a TX batch is flushed
+    static constexpr uint16_t MAX_TX_BATCH_SIZE = 32;
+
 private:
+    //! Prepare and transmit all staged mbufs in a single rte_eth_tx_burst()
+    void _flush_tx_batch();
+
     //! A reference to the DPDK context
     dpdk::dpdk_ctx::sptr _ctx;
     //! The DPDK NIC port used by this link
@@ -257,7 +318,16 @@ private:
     adapter_id_t _adapter_id;
     //! The RX frame buff list head
     dpdk::dpdk_frame_buff* _recv_buff_head = nullptr;
-    // TODO: Implement ability to use multiple queues
+    //! Staged mbufs awaiting transmission in a single burst
+    struct rte_mbuf* _tx_batch[MAX_TX_BATCH_SIZE];
+    //! Number of mbufs currently staged in _tx_batch
+    uint16_t _tx_batch_count = 0;
+    //! Whether release_send_buff() stages packets instead of sending them
+    bool _tx_batching = false;
+    //! Whether the receiving client wants to poll the NIC directly
+    bool _rx_run_to_completion = false;
+    //! The DMA queue used by this link (0 unless flow steering assigned a
+    // dedicated queue)
     dpdk::queue_id_t _queue = 0;
 };
 
@@ -0,0 +1,227 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <liburing.h>
+#include <boost/asio.hpp>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * A frame buffer that is backed by a buffer registered with the kernel via
+ * io_uring_register_buffers(). The buffer index is needed to submit fixed
+ * read/write SQEs that reference the registered buffer.
+ */
+class udp_iouring_frame_buff : public frame_buff
+{
+public:
+    udp_iouring_frame_buff(void* mem, const uint16_t index, const bool is_send)
+        : _index(index), _is_send(is_send)
+    {
+        _data = mem;
+    }
+
+    //! Index of this buffer in the io_uring registered buffer table
+    uint16_t index() const
+    {
+        return _index;
+    }
+
+    //! Returns true if this buffer belongs to the send half of the link
+    bool is_send() const
+    {
+        return _is_send;
+    }
+
+private:
+    const uint16_t _index;
+    const bool _is_send;
+};
+
+/*!
+ * A zero-copy UDP link using io_uring.
+ *
+ * Unlike udp_boost_asio_link, which performs one recv()/send() syscall per
+ * CHDR frame, this link keeps one fixed-buffer read SQE in flight per receive
+ * frame and harvests completed frames from the completion queue. Re-armed
+ * read SQEs are batched and only flushed to the kernel when the completion
+ * queue runs dry, so the per-packet syscall cost is amortized over a burst of
+ * frames. Send frames are submitted as fixed-buffer write SQEs.
+ *
+ * All frame memory is registered with the kernel up front, which allows the
+ * kernel to skip the per-operation page pinning that read()/write() incur.
+ *
+ * This link implements recv_link_if and send_link_if directly (like
+ * udp_dpdk_link) rather than deriving from the link_base templates, because
+ * receive buffers complete in submission order of the kernel, not in the
+ * order the free buffer pool would hand them out.
+ */
+class udp_iouring_link : public virtual recv_link_if, public virtual send_link_if
+{
+public:
+    using sptr = std::shared_ptr<udp_iouring_link>;
+
+    /*!
+     * Make a new io_uring UDP link.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes, num frames, and buffer sizes
+     * \param[out] recv_socket_buff_size Returns the recv socket buffer size
+     * \param[out] send_socket_buff_size Returns the send socket buffer size
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        size_t& recv_socket_buff_size,
+        size_t& send_socket_buff_size);
+
+    virtual ~udp_iouring_link();
+
+    /*!
+     * Get an empty frame buffer in which to write packet contents.
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+                         of ms to wait, a negative value specifies to block
+                         until successful, and a value of 0 specifies no wait.
+     * \return a frame buffer, or null uptr if timeout occurs
+     */
+    frame_buff::uptr get_send_buff(int32_t timeout_ms) override;
+
+    /*!
+     * Send a packet with the contents of the frame buffer and release the
+     * buffer, allowing the link driver to reuse it. If the size of the frame
+     * buffer is 0, the buffer is released with no packet being sent.
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_send_buff(frame_buff::uptr buff) override;
+
+    /*!
+     * Attempt to get a frame buffer with data from the receive link.
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+                         of ms to wait, a negative value specifies to block
+                         until successful, and a value of 0 specifies no wait.
+     * \return a frame buffer, or null uptr if timeout occurs
+     */
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override;
+
+    /*!
+     * Release a frame buffer, allowing the link driver to reuse it. The
+     * buffer is re-armed as a fixed read SQE; submission to the kernel is
+     * deferred until the completion queue is empty.
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_recv_buff(frame_buff::uptr buff) override;
+
+    size_t get_num_recv_frames() const override
+    {
+        return _num_recv_frames;
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _recv_frame_size;
+    }
+
+    size_t get_num_send_frames() const override
+    {
+        return _num_send_frames;
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _send_frame_size;
+    }
+
+    /*! Return the local port of the UDP connection. Port is in host byte order.
+     *
+     * \returns Port number or 0 if port number couldn't be identified.
+     */
+    uint16_t get_local_port() const;
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    link_stats_t get_recv_stats() const override
+    {
+        return _recv_stats.snapshot();
+    }
+
+    link_stats_t get_send_stats() const override
+    {
+        return _send_stats.snapshot();
+    }
+
+private:
+    udp_iouring_link(
+        const std::string& addr, const std::string& port, const link_params_t& params);
+
+    size_t resize_recv_socket_buffer(size_t num_bytes);
+    size_t resize_send_socket_buffer(size_t num_bytes);
+
+    //! Queue a fixed read SQE for the given recv buffer (does not submit)
+    void _arm_recv_buff(udp_iouring_frame_buff& buff);
+
+    //! Drain the completion queue into the recv/send ready queues
+    void _reap_completions();
+
+    //! Flush queued SQEs and wait up to timeout_ms for a completion
+    bool _submit_and_wait(int32_t timeout_ms);
+
+    const size_t _recv_frame_size;
+    const size_t _num_recv_frames;
+    const size_t _send_frame_size;
+    const size_t _num_send_frames;
+
+    buffer_pool::sptr _recv_memory_pool;
+    buffer_pool::sptr _send_memory_pool;
+
+    std::vector<udp_iouring_frame_buff> _recv_buffs;
+    std::vector<udp_iouring_frame_buff> _send_buffs;
+
+    //! Completed recv frames that have not yet been handed to the caller
+    std::deque<frame_buff*> _recv_ready;
+    //! Send frames whose write SQEs have completed
+    std::vector<frame_buff*> _send_free;
+
+    detail::link_stats_counters _recv_stats;
+    detail::link_stats_counters _send_stats;
+
+    //! Number of re-armed recv SQEs not yet submitted to the kernel
+    size_t _pending_sqes = 0;
+
+    struct io_uring _ring;
+    bool _ring_initialized = false;
+
+    boost::asio::io_context _io_context;
+    std::shared_ptr<boost::asio::ip::udp::socket> _socket;
+    int _sock_fd;
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
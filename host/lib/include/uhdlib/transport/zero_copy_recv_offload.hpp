@@ -0,0 +1,39 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/transport/zero_copy.hpp>
+#include <memory>
+
+namespace uhd { namespace transport {
+
+/*!
+ * A zero copy transport wrapper that moves the receive side onto its own
+ * thread. The offload thread eagerly pulls buffers out of the underlying
+ * transport into a queue, so transfers are resubmitted to the hardware as
+ * soon as they complete instead of waiting for the application thread to
+ * call in. This is the legacy-transport counterpart of the offload
+ * io_service used by the CHDR devices, and keeps slow or bursty consumers
+ * from stalling transports with small buffer windows (e.g. USB 2.0).
+ *
+ * The send side passes straight through to the underlying transport.
+ */
+class zero_copy_recv_offload : public virtual zero_copy_if
+{
+public:
+    typedef std::shared_ptr<zero_copy_recv_offload> sptr;
+
+    /*! Make a transport with a receive offload thread
+     *
+     * \param transport The transport to wrap
+     * \param timeout The timeout the offload thread uses when polling the
+     *                underlying transport for received buffers
+     */
+    static sptr make(zero_copy_if::sptr transport, const double timeout);
+};
+
+}} // namespace uhd::transport
@@ -23,11 +23,18 @@ public:
 
     transport::io_service::sptr connect_links(transport::recv_link_if::sptr recv_link,
         transport::send_link_if::sptr send_link,
-        const transport::link_type_t /*link_type*/,
+        const transport::link_type_t link_type,
         const io_service_args_t& /*default_args*/,
-        const uhd::device_addr_t& /*stream_args*/,
+        const uhd::device_addr_t& stream_args,
         const std::string& /*streamer_id*/)
     {
+        // Run-to-completion mode must be requested before the link is
+        // attached, since the receive flow is opened during attachment
+        if (link_type == transport::link_type_t::RX_DATA
+            && stream_args.has_key("dpdk_run_to_completion")) {
+            auto link = std::dynamic_pointer_cast<transport::udp_dpdk_link>(recv_link);
+            link->set_rx_run_to_completion(true);
+        }
         auto io_srv = _get_io_service(recv_link, send_link);
         io_srv->attach_recv_link(recv_link);
         io_srv->attach_send_link(send_link);
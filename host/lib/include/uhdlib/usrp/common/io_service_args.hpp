@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/types/device_addr.hpp>
+#include <boost/optional.hpp>
 #include <map>
 
 namespace uhd { namespace usrp {
@@ -28,6 +29,13 @@ namespace uhd { namespace usrp {
  *                           always go to the offload thread containing the fewest
  *                           connections, with lowest numbered thread as a second
  *                           criterion. The default is 1.
+ * poll_offload_shared_pool: set to "true" to service all connections with a shared
+ *                           pool of num_poll_offload_threads worker threads that
+ *                           steal work from each other at batch granularity,
+ *                           instead of statically assigning each connection to one
+ *                           polling thread. This lets many bursty streams share
+ *                           fewer cores without per-stream overruns. Only used if
+ *                           the I/O service is configured to poll.
  * recv_offload_thread_<N>_cpu: an integer to specify cpu affinity of the offload
  *                              thread. N indicates the thread instance, starting
  *                              with 0 for each streamer and ending with the number
@@ -42,11 +50,27 @@ namespace uhd { namespace usrp {
  *                              thread. N indicates the thread instance, starting
  *                              with 0 and up to num_poll_offload_threads minus 1.
  *                              Only used if the I/O service is configured to poll.
+ * recv_cpu: an integer to specify cpu affinity of every RX offload thread that
+ *           has no recv_offload_thread_<N>_cpu entry. Shorthand for pinning all
+ *           receive offload threads without enumerating thread instances.
+ * send_cpu: like recv_cpu, but for TX offload threads.
+ * offload_cpu: like recv_cpu, but for polling offload threads (which serve both
+ *              directions).
+ * recv_wait_strategy: wait strategy used by inline (non-offload) I/O services
+ *                     while waiting for packets. One of "block" (default),
+ *                     "spin", "spin_yield", or "spin_block". The spinning
+ *                     strategies trade a busy core for lower and more
+ *                     deterministic packet pickup latency.
+ * recv_spin_duration_us: duration in microseconds to spin before yielding or
+ *                        blocking, for the "spin_yield" and "spin_block"
+ *                        strategies. The default is 100.
  */
 struct io_service_args_t
 {
     enum wait_mode_t { POLL, BLOCK };
 
+    enum recv_wait_strategy_t { WAIT_BLOCK, WAIT_SPIN, WAIT_SPIN_YIELD, WAIT_SPIN_BLOCK };
+
     //! Whether to offload streaming I/O to a worker thread
     bool recv_offload = false;
 
@@ -62,6 +86,10 @@ struct io_service_args_t
     //! Number of polling threads to use, if wait_mode is set to POLL
     size_t num_poll_offload_threads = 1;
 
+    //! Whether the polling threads form a shared work-stealing pool instead
+    //! of each servicing a fixed set of connections
+    bool poll_offload_shared_pool = false;
+
     //! CPU affinity of offload threads, if wait_mode is set to BLOCK
     std::map<size_t, size_t> recv_offload_thread_cpu;
 
@@ -70,6 +98,21 @@ struct io_service_args_t
 
     //! CPU affinity of offload threads, if wait_mode is set to POLL
     std::map<size_t, size_t> poll_offload_thread_cpu;
+
+    //! Fallback CPU affinity for RX offload threads without a per-thread entry
+    boost::optional<size_t> recv_cpu;
+
+    //! Fallback CPU affinity for TX offload threads without a per-thread entry
+    boost::optional<size_t> send_cpu;
+
+    //! Fallback CPU affinity for polling offload threads without a per-thread entry
+    boost::optional<size_t> offload_cpu;
+
+    //! Wait strategy for inline I/O services while waiting for packets
+    recv_wait_strategy_t recv_wait_strategy = WAIT_BLOCK;
+
+    //! Spin duration in us for the WAIT_SPIN_YIELD and WAIT_SPIN_BLOCK strategies
+    size_t recv_spin_duration_us = 100;
 };
 
 /*! Reads I/O service args from provided dictionary
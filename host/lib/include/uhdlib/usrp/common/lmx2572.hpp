@@ -9,6 +9,8 @@
 #include <uhd/types/time_spec.hpp>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 //! Control interface for an LMX2572 synthesizer
 class lmx2572_iface
@@ -30,6 +32,13 @@ public:
     //! Write functor: Take address / data pair, craft SPI transaction
     using write_fn_t = std::function<void(uint8_t, uint16_t)>;
 
+    //! Burst write functor: Take an ordered list of address / data pairs
+    // and write them in order. Must be equivalent to one write functor call
+    // per pair; a backend with a batched SPI engine may coalesce the
+    // transactions, but is not required to.
+    using write_seq_fn_t =
+        std::function<void(const std::vector<std::pair<uint8_t, uint16_t>>&)>;
+
     //! Read functor: Return value given address
     using read_fn_t = std::function<uint16_t(uint8_t)>;
 
@@ -43,6 +52,23 @@ public:
     // \param sleep sleep function object
     static sptr make(write_fn_t&& poke16, read_fn_t&& peek16, sleep_fn_t&& sleep);
 
+    //! Factory with burst programming support
+    //
+    // Like the three-functor factory, but commit() hands all changed
+    // registers to \p poke16_seq in a single call instead of one write
+    // functor call per register. A backend that can batch SPI transactions
+    // can use this to keep an LO retune from being dominated by serialized
+    // SPI round trips; for other backends the behavior is unchanged.
+    //
+    // \param write SPI write function object (used for single-register pokes)
+    // \param write_seq SPI burst write function object
+    // \param read SPI read function object
+    // \param sleep sleep function object
+    static sptr make(write_fn_t&& poke16,
+        write_seq_fn_t&& poke16_seq,
+        read_fn_t&& peek16,
+        sleep_fn_t&& sleep);
+
     //! Save state to chip
     virtual void commit() = 0;
 
@@ -25,11 +25,23 @@ public:
     //! SPI write functor: Can take a SPI transaction and clock it out
     using write_spi_t = std::function<void(uint32_t)>;
 
+    //! SPI burst write functor: Take an ordered list of SPI transactions
+    // and clock them out in order. Must be equivalent to one write functor
+    // call per transaction; a backend with a batched SPI engine may
+    // coalesce them, but is not required to.
+    using write_seq_spi_t = std::function<void(const std::vector<uint32_t>&)>;
+
     //! SPI read functor: Return SPI
     using read_spi_t = std::function<uint32_t(uint32_t)>;
 
     static sptr make(write_spi_t write, read_spi_t read);
 
+    //! Factory with burst programming support: commit() hands all changed
+    // registers to \p write_seq in a single call instead of one write
+    // functor call per register, so backends that can batch SPI
+    // transactions may coalesce them
+    static sptr make(write_spi_t write, write_seq_spi_t write_seq, read_spi_t read);
+
     virtual ~lmx2592_iface() = default;
 
     enum output_t { RF_OUTPUT_A, RF_OUTPUT_B };
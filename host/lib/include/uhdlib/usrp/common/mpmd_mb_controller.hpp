@@ -12,10 +12,16 @@
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhdlib/features/discoverable_feature_registry.hpp>
 #include <uhdlib/features/fpga_load_notification_iface.hpp>
+#include <uhd/utils/tasks.hpp>
 #include <uhdlib/usrp/common/rpc.hpp>
 #include <uhdlib/utils/rpc.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 
 namespace uhd { namespace rfnoc {
 
@@ -34,6 +40,8 @@ public:
     mpmd_mb_controller(
         uhd::usrp::mpmd_rpc_iface::sptr rpcc, uhd::device_addr_t device_info);
 
+    ~mpmd_mb_controller() override;
+
     //! Return reference to the RPC client
     uhd::rpc_client::sptr get_rpc_client()
     {
@@ -99,6 +107,7 @@ public:
     void set_time_source_out(const bool enb) override;
     uhd::sensor_value_t get_sensor(const std::string& name) override;
     std::vector<std::string> get_sensor_names() override;
+    std::map<std::string, uhd::sensor_value_t> get_sensors() override;
     uhd::usrp::mboard_eeprom_t get_eeprom() override;
     bool synchronize(std::vector<mb_controller::sptr>& mb_controllers,
         const uhd::time_spec_t& time_spec = uhd::time_spec_t(0.0),
@@ -129,6 +138,9 @@ private:
     std::map<std::string, std::string> _aggregate_sync_info(
         const std::list<std::map<std::string, std::string>>& collated_sync_args);
 
+    //! Read all sensors (bulk RPC if available) into the sensor cache
+    void _refresh_sensor_cache();
+
 
     /**************************************************************************
      * Attributes
@@ -141,6 +153,19 @@ private:
     //! List of MB sensor names
     std::unordered_set<std::string> _sensor_names;
 
+    //! False once the bulk sensor RPC was seen to be unavailable (older MPM)
+    std::atomic<bool> _bulk_sensors_supported{true};
+
+    //! Background sensor refresh cache (see the sensor_cache_ms device arg).
+    // While enabled, sensor reads are served from this cache, which a
+    // background task refreshes via the bulk RPC every _sensor_cache_staleness
+    mutable std::mutex _sensor_cache_mutex;
+    std::map<std::string, sensor_value_t::sensor_map_t> _sensor_cache;
+    std::chrono::milliseconds _sensor_cache_staleness{0};
+    std::condition_variable _sensor_cache_cv;
+    bool _sensor_cache_stop = false;
+    uhd::task::sptr _sensor_cache_task;
+
     //! Cache of available GPIO sources
     std::vector<std::string> _gpio_banks;
     std::unordered_map<std::string, std::vector<std::string>> _gpio_srcs;
@@ -0,0 +1,99 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/exception.hpp>
+#include <exception>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uhd { namespace usrp {
+
+/*! Run an indexed operation for all indices [0, count) in parallel
+ *
+ * Used to fan out ALL_CHANS/ALL_MBOARDS API calls whose cost is dominated by
+ * per-device I/O (tune, gain, rate, antenna): the channels live on
+ * independent devices, so running the per-channel calls concurrently turns
+ * an O(num_chans) sequence of round trips into roughly one. The index counts
+ * are small (number of channels or motherboards), so one short-lived task
+ * per index is cheap next to the millisecond-scale I/O it overlaps.
+ *
+ * The call returns once all indices have completed. Per-index error
+ * reporting is preserved: a single failure is re-thrown unmodified, and
+ * multiple failures are combined into a uhd::runtime_error that lists the
+ * failing indices and their messages.
+ *
+ * \param count number of indices to run; index 0 runs on the calling thread
+ * \param fn the per-index operation
+ * \param index_name name of the index used in error messages ("channel")
+ */
+inline void parallel_fan_out(const size_t count,
+    const std::function<void(size_t)>& fn,
+    const std::string& index_name = "channel")
+{
+    if (count <= 1) {
+        if (count == 1) {
+            fn(0);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> tasks;
+    tasks.reserve(count - 1);
+    for (size_t i = 1; i < count; i++) {
+        tasks.emplace_back([i, &fn, &errors]() {
+            try {
+                fn(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    try {
+        fn(0);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto& task : tasks) {
+        task.join();
+    }
+
+    size_t num_errors = 0;
+    std::exception_ptr first_error;
+    std::string error_msg;
+    for (size_t i = 0; i < count; i++) {
+        if (!errors[i]) {
+            continue;
+        }
+        num_errors++;
+        if (!first_error) {
+            first_error = errors[i];
+        }
+        try {
+            std::rethrow_exception(errors[i]);
+        } catch (const std::exception& ex) {
+            error_msg += (error_msg.empty() ? "" : "; ") + index_name + " "
+                         + std::to_string(i) + ": " + ex.what();
+        } catch (...) {
+            error_msg += (error_msg.empty() ? "" : "; ") + index_name + " "
+                         + std::to_string(i) + ": unknown error";
+        }
+    }
+    if (num_errors == 1) {
+        // Preserve the original exception type for single failures
+        std::rethrow_exception(first_error);
+    }
+    if (num_errors > 1) {
+        throw uhd::runtime_error(
+            "Operation failed on multiple " + index_name + "s: " + error_msg);
+    }
+}
+
+}} // namespace uhd::usrp
@@ -47,6 +47,7 @@ IFACES = [
         fn_from_string("size_t get_num_timekeepers()"),
         fn_from_string("std::vector<std::string> get_mb_sensors()"),
         fn_from_string("sensor_value_t::sensor_map_t get_mb_sensor(const std::string& sensor)"),
+        fn_from_string("std::map<std::string, sensor_value_t::sensor_map_t> get_mb_sensors_bulk()"),
         fn_from_string("std::vector<std::string> get_gpio_banks()"),
         fn_from_string("std::vector<std::string> get_gpio_srcs(const std::string& bank)"),
         fn_from_string("bool supports_feature(const std::string& feature)"),
@@ -0,0 +1,37 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/device_addr.hpp>
+
+namespace uhd { namespace usrp {
+
+/*! Opt-in transport self-tuning
+ *
+ * When the device args contain auto_tune_transport=1, this runs a short
+ * host-side benchmark that measures the achievable packet rate of the
+ * transport stack for candidate (frame size, number of frames, I/O service)
+ * combinations, persists the winner per (host, device) in the user's
+ * uhd.conf, and merges the winning transport hints into the returned args.
+ * On subsequent sessions the persisted result is applied without re-running
+ * the benchmark; set auto_tune_transport=force to discard a persisted result
+ * and measure again.
+ *
+ * The benchmark exercises the host side of the transport stack (I/O
+ * services, frame handling, and payload access) against a synthetic link, so
+ * it captures per-machine differences in memory and scheduling behavior, not
+ * the capabilities of the device or the network.
+ *
+ * Keys the user provided explicitly are never overridden. Without the
+ * auto_tune_transport arg this is a no-op.
+ *
+ * \param args The device args provided at initialization
+ * \return The args with the tuned transport hints merged in
+ */
+uhd::device_addr_t apply_transport_tune(const uhd::device_addr_t& args);
+
+}} // namespace uhd::usrp
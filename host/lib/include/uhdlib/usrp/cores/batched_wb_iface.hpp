@@ -0,0 +1,78 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/wb_iface.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace uhd { namespace usrp {
+
+/*! Transaction-buffering wb_iface decorator
+ *
+ * Wraps another wb_iface and, while a batch is open, collects poke32() calls
+ * instead of writing them out one at a time. When the batch is committed, the
+ * collected writes are released in order: through a single block-write
+ * callback if the underlying transport supports one, otherwise as
+ * back-to-back pokes. This cuts one transport round trip per register down to
+ * one per configure sequence.
+ *
+ * Outside a batch, all accesses pass straight through. Peeks (and pokes of
+ * other widths) flush any pending writes first so ordering is preserved.
+ * Batches may be nested; the writes are released when the outermost batch
+ * commits.
+ */
+class batched_wb_iface : public wb_iface
+{
+public:
+    typedef std::shared_ptr<batched_wb_iface> sptr;
+
+    //! One buffered 32-bit write
+    using poke32_op_t = std::pair<wb_addr_type, uint32_t>;
+
+    //! Callback that writes a list of pokes as one transport transaction
+    using block_poke32_fn_t = std::function<void(const std::vector<poke32_op_t>&)>;
+
+    /*!
+     * Make a batching decorator around an existing wb_iface.
+     *
+     * \param iface the underlying register interface
+     * \param block_poke32 optional block-write callback; when empty, commits
+     *                     fall back to sequential pokes on \p iface
+     */
+    static sptr make(wb_iface::sptr iface, block_poke32_fn_t block_poke32 = nullptr);
+
+    //! Start collecting pokes instead of writing them through
+    virtual void start_batch(void) = 0;
+
+    //! Release all collected pokes (closes the outermost batch)
+    virtual void commit_batch(void) = 0;
+
+    /*! Scoped batch helper: starts a batch on construction and commits it on
+     * destruction, so a configure sequence stays batched across early returns.
+     */
+    class batch
+    {
+    public:
+        batch(batched_wb_iface::sptr iface) : _iface(iface)
+        {
+            _iface->start_batch();
+        }
+        ~batch(void)
+        {
+            UHD_SAFE_CALL(_iface->commit_batch();)
+        }
+
+    private:
+        batched_wb_iface::sptr _iface;
+    };
+};
+
+}} // namespace uhd::usrp
@@ -50,6 +50,9 @@ public:
 
     using poke_fn_type =
         std::function<void(const uint32_t, const uint32_t, const chan_t)>;
+    //! Write consecutive registers, starting at the first argument's address
+    using block_poke_fn_type =
+        std::function<void(const uint32_t, const std::vector<uint32_t>&, const chan_t)>;
     using peek_fn_type  = std::function<uint32_t(const uint32_t)>;
     using sleep_fn_type = std::function<void(const uhd::time_spec_t&)>;
 
@@ -61,6 +64,16 @@ public:
         sleep_fn_type&& sleep_fn,
         const std::string& log_id);
 
+    /*! Like the other ctor, but also takes a block-write function, which
+     * commit() uses to merge writes to contiguous addresses into a single
+     * transaction. Without it, commit() falls back to one poke per register.
+     */
+    zbx_cpld_ctrl(poke_fn_type&& poke_fn,
+        block_poke_fn_type&& block_poke_fn,
+        peek_fn_type&& peek_fn,
+        sleep_fn_type&& sleep_fn,
+        const std::string& log_id);
+
     ~zbx_cpld_ctrl(void) = default;
 
     //! Write a value to the scratch register
@@ -321,6 +334,22 @@ public:
     // \param data The data to write to the LO register (see the LMX2572 datasheet)
     void lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint16_t data);
 
+    //! Write a sequence of registers to an LO
+    //
+    // Equivalent to calling lo_poke16() once per (address, data) pair in
+    // \p writes, in order. On ZBX this issues the same per-register SPI
+    // transaction requests (each with its throttle sleep) as the loop
+    // would; there is no batched SPI engine here to coalesce them into a
+    // single control transaction. This entry point exists so callers hand
+    // over the whole sequence in one call, which a backend with a batched
+    // SPI path could exploit without touching the call sites. The notes on
+    // lo_poke16() about timing and the ready bit apply here as well.
+    //
+    // \param lo Which LO to write to.
+    // \param writes Ordered (address, data) pairs to write
+    void lo_poke16_seq(
+        const zbx_lo_t lo, const std::vector<std::pair<uint8_t, uint16_t>>& writes);
+
     //! Read back from the LO
     //
     // Note: The LMX2572 has a MUXout pin, not just an SDO pin. This means the
@@ -460,6 +489,9 @@ private:
     //! Poker object
     poke_fn_type _poke32;
 
+    //! Block poker object, used by commit() for contiguous address runs
+    block_poke_fn_type _block_poke32;
+
     //! Peeker object
     peek_fn_type _peek32;
 
@@ -19,6 +19,7 @@ public:
     // Pass in our lo selection and poke/peek functions
     zbx_lo_ctrl(zbx_lo_t lo,
         lmx2572_iface::write_fn_t&& poke16,
+        lmx2572_iface::write_seq_fn_t&& poke16_seq,
         lmx2572_iface::read_fn_t&& peek16,
         lmx2572_iface::sleep_fn_t&& sleep,
         const double default_frequency,
@@ -0,0 +1,53 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+/*! \file alloc_sentinel.hpp
+ *
+ * Allocation tripwire for zero-allocation code paths.
+ *
+ * The streaming fast path (packet handlers, I/O services) must not
+ * allocate in steady state; regressions there have historically gone
+ * unnoticed until someone profiled by accident. UHD_ALLOC_SENTINEL_SCOPE()
+ * arms a per-thread sentinel for the enclosing scope: any operator new
+ * reaching the armed thread is logged as a violation, including a
+ * backtrace where the platform supports it. Allocations still succeed,
+ * so a violation is diagnostic output, not a behavior change.
+ *
+ * The sentinel is compiled out by default. Configuring with
+ * -DENABLE_ALLOC_SENTINEL=ON hooks the global allocation operators, which
+ * is intended for debug builds only.
+ */
+
+namespace uhd { namespace alloc_sentinel {
+
+#ifdef UHD_ALLOC_SENTINEL
+//! Arms the allocation sentinel on the calling thread for its lifetime
+class scope_guard
+{
+public:
+    //! \param context label included in violation reports; must outlive
+    //!                the guard (pass a string literal)
+    explicit scope_guard(const char* context);
+    ~scope_guard();
+
+    scope_guard(const scope_guard&)            = delete;
+    scope_guard& operator=(const scope_guard&) = delete;
+
+private:
+    const char* _prev_context;
+};
+#endif
+
+}} // namespace uhd::alloc_sentinel
+
+#ifdef UHD_ALLOC_SENTINEL
+#    define UHD_ALLOC_SENTINEL_SCOPE(context) \
+        const uhd::alloc_sentinel::scope_guard _uhd_alloc_sentinel_guard{context}
+#else
+#    define UHD_ALLOC_SENTINEL_SCOPE(context)
+#endif
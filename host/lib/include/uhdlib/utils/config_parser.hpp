@@ -91,6 +91,14 @@ public:
         _pt.put<T>(section + "." + key, value);
     }
 
+    /*! Write the current state out as an INI file
+     *
+     * \param path Path to the INI file
+     *
+     * \throws uhd::runtime_error if writing failed.
+     */
+    void save_file(const std::string& path);
+
 private:
     template <typename T>
     static std::vector<std::string> _options(T key_bearing_iterable)
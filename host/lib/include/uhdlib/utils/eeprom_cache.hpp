@@ -0,0 +1,43 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/dict.hpp>
+#include <string>
+
+namespace uhd { namespace eeprom_cache {
+
+/*! Persistent host-side cache for EEPROM contents
+ *
+ * EEPROM contents change approximately never, but reading them over the
+ * slow I2C/SPI buses costs a noticeable chunk of session setup time. Devices
+ * can opt into caching the parsed key/value contents on the host (one file
+ * per device under the UHD data directory), so a warm restart skips the
+ * serial bus reads.
+ *
+ * Callers are responsible for invalidating the cache whenever they write to
+ * the actual EEPROM. All operations are best-effort: a failure to read or
+ * write the cache file is logged and treated as a cache miss, never as an
+ * error.
+ */
+
+//! Try loading cached EEPROM contents for the given label
+//
+// \param label Identifies the device, e.g. "b2xx_" plus the serial number.
+//              Characters that are unsuitable for filenames are replaced.
+// \param eeprom Filled with the cached key/value pairs on a hit
+// \return true if the cache had an entry for \p label
+bool load(const std::string& label, uhd::dict<std::string, std::string>& eeprom);
+
+//! Store EEPROM contents for the given label, replacing any previous entry
+void store(
+    const std::string& label, const uhd::dict<std::string, std::string>& eeprom);
+
+//! Drop the cache entry for the given label, if any
+void invalidate(const std::string& label);
+
+}} // namespace uhd::eeprom_cache
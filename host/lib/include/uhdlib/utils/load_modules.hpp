@@ -0,0 +1,27 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+namespace uhd {
+
+/*! Load all modules whose loading was deferred at static initialization
+ *
+ * Modules found in the module paths are indexed, but not loaded, when UHD
+ * initializes; loading them is deferred until a factory lookup can be
+ * satisfied by a module (see the extension framework and the RFNoC block
+ * registry). This keeps processes that never touch module-provided factories
+ * (e.g., pure device discovery) from paying the dlopen cost of heavyweight
+ * extension modules.
+ *
+ * This function loads every still-pending module. It is thread-safe and
+ * idempotent; load failures are reported to stderr exactly as they were
+ * under eager loading. Setting the environment variable UHD_MODULE_PRELOAD
+ * to anything but "0" restores eager loading at static initialization.
+ */
+void load_deferred_modules();
+
+} // namespace uhd
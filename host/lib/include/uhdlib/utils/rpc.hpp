@@ -13,6 +13,7 @@
 #include <rpc/rpc_error.h>
 #include <boost/format.hpp>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -223,6 +224,48 @@ public:
         }
     };
 
+    /*! Perform a pipelined RPC request.
+     *
+     * The request is dispatched immediately, but this function does not wait
+     * for the response. Multiple outstanding requests share the underlying
+     * connection, and the RPC layer correlates responses to requests, so the
+     * round trips of independent calls can overlap. Calling get() on the
+     * returned future blocks until the response arrives, and throws
+     * uhd::runtime_error on failure, like request() does.
+     *
+     * \param func_name The function name that is called via RPC
+     * \param args All these arguments are passed to the RPC call
+     */
+    template <typename return_type, typename... Args>
+    std::future<return_type> request_async(std::string const& func_name, Args&&... args)
+    {
+        auto response = [&]() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _client->async_call(func_name, std::forward<Args>(args)...);
+        }();
+        return std::async(std::launch::deferred,
+            [this, func_name, response = std::move(response)]() mutable -> return_type {
+                try {
+                    return response.get().template as<return_type>();
+                } catch (const ::rpc::rpc_error& ex) {
+                    const std::string error = [&]() {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        return _get_last_error_safe();
+                    }();
+                    if (not error.empty()) {
+                        UHD_LOG_ERROR("RPC", error);
+                    }
+                    throw uhd::runtime_error(str(
+                        boost::format("Error during RPC call to `%s'. Error message: %s")
+                        % func_name % (error.empty() ? ex.what() : error)));
+                } catch (const std::bad_cast& ex) {
+                    throw uhd::runtime_error(str(
+                        boost::format("Error during RPC call to `%s'. Error message: %s")
+                        % func_name % ex.what()));
+                }
+            });
+    };
+
     /*! Like request(), also provides a token.
      *
      * This is a convenience wrapper to directly call a function that requires
@@ -244,6 +287,16 @@ public:
             timeout_ms, func_name, _token, std::forward<Args>(args)...);
     };
 
+    /*! Like request_async(), also provides a token.
+     */
+    template <typename return_type, typename... Args>
+    std::future<return_type> request_with_token_async(
+        std::string const& func_name, Args&&... args)
+    {
+        return request_async<return_type>(
+            func_name, _token, std::forward<Args>(args)...);
+    };
+
     /*! Like notify(), also provides a token.
      *
      * This is a convenience wrapper to directly call a function that requires
@@ -0,0 +1,67 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! Scheduling policy for one class (role) of internal UHD threads
+ *
+ * Policies are configured once per process via the [threads] section of
+ * uhd.conf and applied at every internal thread creation point. Each role
+ * reads the keys <role>_realtime, <role>_priority, and <role>_cpu_affinity:
+ *
+ *     [threads]
+ *     offload_realtime = 1       ; schedule offload threads SCHED_RR
+ *     offload_priority = 0.9     ; -1.0 to 1.0, see set_thread_priority()
+ *     offload_cpu_affinity = 2,3 ; comma-separated list of CPU numbers
+ *     task_priority = -0.5       ; keep housekeeping tasks below normal
+ *     watchdog_interval_ms = 1000
+ *
+ * Roles currently in use:
+ *  - "task": housekeeping loops spawned through uhd::task / uhd::msg_task
+ *  - "offload": streaming offload threads (offload_io_service). The
+ *    per-stream offload thread options in io_service_args_t take precedence
+ *    over the role's affinity list where both are given.
+ *  - "dpdk": DPDK I/O worker lcores. Leave the affinity key unset for this
+ *    role; lcore pinning is owned by the EAL (see the dpdk_driver args).
+ */
+struct thread_policy_t
+{
+    //! Thread priority in [-1.0, 1.0], or unset to leave the priority alone
+    std::optional<float> priority;
+    //! Use realtime scheduling (SCHED_RR where available)
+    bool realtime = false;
+    //! CPUs to pin the thread to (empty list = no pinning)
+    std::vector<size_t> cpu_affinity_list;
+};
+
+/*! Return the configured scheduling policy for a thread role
+ *
+ * Policies are parsed from uhd.conf on first use and cached for the process
+ * lifetime. Roles without any [threads] keys return an empty policy.
+ */
+thread_policy_t get_thread_policy(const std::string& role);
+
+/*! Apply the configured policy for \p role to the calling thread
+ *
+ * Affinity and priority failures are logged, not thrown, so thread bodies
+ * can call this unconditionally. When a realtime policy was applied, the
+ * thread is also registered with the priority watchdog (Linux only), which
+ * periodically verifies the scheduling class has not been reverted and warns
+ * when the thread spends a significant share of an interval runnable but not
+ * running -- the signature of RT throttling or a priority inversion. The
+ * watchdog interval defaults to one second and can be changed with the
+ * watchdog_interval_ms key (0 disables the watchdog).
+ */
+void apply_thread_policy(const std::string& role);
+
+} // namespace uhd
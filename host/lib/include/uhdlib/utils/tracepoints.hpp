@@ -0,0 +1,33 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+/*! \file tracepoints.hpp
+ *
+ * Static tracepoints for profiling UHD internals.
+ *
+ * UHD_TRACEPOINT() places a USDT (user statically-defined tracing) probe
+ * under the "uhd" provider at the call site. The probes compile to a single
+ * nop unless a tracer (perf, bpftrace, SystemTap, ...) attaches to them, so
+ * they are cheap enough for per-packet code paths. Example:
+ *
+ *     sudo bpftrace -e 'usdt:libuhd.so:uhd:rx_overrun { @[pid] = count(); }'
+ *
+ * The probes are compiled out entirely unless UHD was configured with
+ * -DENABLE_TRACE=ON (which requires sys/sdt.h from systemtap-sdt-dev or
+ * equivalent). Probe arguments must be scalar expressions; avoid arguments
+ * with side effects, since they disappear in non-traced builds.
+ */
+
+#ifdef UHD_TRACE_USDT
+#    include <sys/sdt.h>
+// STAP_PROBEV dispatches to the DTRACE_PROBEn() macro matching the number of
+// arguments provided
+#    define UHD_TRACEPOINT(name, ...) STAP_PROBEV(uhd, name, ##__VA_ARGS__)
+#else
+#    define UHD_TRACEPOINT(name, ...)
+#endif
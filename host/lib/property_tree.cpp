@@ -7,18 +7,38 @@
 //
 
 #include <uhd/property_tree.hpp>
-#include <uhd/types/dict.hpp>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 using namespace uhd;
 
 /***********************************************************************
  * Helper function to iterate through paths
  **********************************************************************/
-#include <boost/tokenizer.hpp>
-#define path_tokenizer(path) \
-    boost::tokenizer<boost::char_separator<char>>(path, boost::char_separator<char>("/"))
+namespace {
+//! Split a path into its "/"-separated segments, as views into the
+// original string. Tree walks happen on every property access, so the
+// segments are deliberately not materialized as strings.
+std::vector<std::string_view> split_path(std::string_view path)
+{
+    std::vector<std::string_view> segments;
+    while (true) {
+        const size_t begin = path.find_first_not_of('/');
+        if (begin == std::string_view::npos) {
+            break;
+        }
+        path.remove_prefix(begin);
+        const size_t end = path.find('/');
+        segments.push_back(path.substr(0, end));
+        path.remove_prefix(std::min(end, path.size()));
+    }
+    return segments;
+}
+} // namespace
 
 /***********************************************************************
  * Property path implementation wrapper
@@ -66,6 +86,70 @@ fs_path uhd::operator/(const fs_path& lhs, size_t rhs)
     return lhs / rhs_str;
 }
 
+/***********************************************************************
+ * Update transactions (coalesced subscriber notification)
+ **********************************************************************/
+namespace {
+
+struct update_transaction_state
+{
+    //! Nesting depth; notifications fire when it drops back to zero
+    size_t depth = 0;
+    //! Pending notifications in first-trigger order, coalesced by subscriber
+    std::vector<std::pair<const void*, std::function<void(void)>>> pending;
+};
+
+update_transaction_state& get_transaction_state(void)
+{
+    // The transaction is per-thread: set() calls from other threads are
+    // unaffected by a transaction opened on this one
+    static thread_local update_transaction_state state;
+    return state;
+}
+
+} // namespace
+
+bool uhd::prop_detail::in_update_transaction(void)
+{
+    return get_transaction_state().depth > 0;
+}
+
+void uhd::prop_detail::defer_notification(
+    const void* subscriber_id, std::function<void(void)> notify)
+{
+    update_transaction_state& state = get_transaction_state();
+    for (auto& entry : state.pending) {
+        if (entry.first == subscriber_id) {
+            entry.second = std::move(notify);
+            return;
+        }
+    }
+    state.pending.emplace_back(subscriber_id, std::move(notify));
+}
+
+void property_tree::begin_update(void)
+{
+    get_transaction_state().depth++;
+}
+
+void property_tree::commit(void)
+{
+    update_transaction_state& state = get_transaction_state();
+    if (state.depth == 0) {
+        throw uhd::runtime_error("Cannot commit() without a begin_update()");
+    }
+    if (--state.depth > 0) {
+        return;
+    }
+    // Move the queue aside so it is cleared even if a subscriber throws, and
+    // so subscribers that set() further properties notify synchronously
+    auto pending = std::move(state.pending);
+    state.pending.clear();
+    for (auto& entry : pending) {
+        entry.second(); // let errors propagate
+    }
+}
+
 /***********************************************************************
  * Property tree implementation
  **********************************************************************/
@@ -80,7 +164,7 @@ public:
     sptr subtree(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
         property_tree_impl* subtree = new property_tree_impl(path);
         subtree->_guts              = this->_guts; // copy the guts sptr
@@ -90,34 +174,35 @@ public:
     void remove(const fs_path& path_) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::unique_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
         node_type* node   = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
+        for (const std::string_view name : split_path(path)) {
+            node_type* child = node->find(name);
+            if (child == nullptr) {
                 throw_path_not_found(path);
             }
             parent = node;
-            node   = &(*node)[name];
+            node   = child;
         }
         if (parent == NULL) {
             throw uhd::runtime_error("Cannot uproot");
         }
-        parent->pop(fs_path(path.leaf()));
+        parent->pop(path.leaf());
     }
 
     bool exists(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
+        for (const std::string_view name : split_path(path)) {
+            node = node->find(name);
+            if (node == nullptr) {
                 return false;
             }
-            node = &(*node)[name];
         }
         return true;
     }
@@ -125,14 +210,14 @@ public:
     std::vector<std::string> list(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
+        for (const std::string_view name : split_path(path)) {
+            node = node->find(name);
+            if (node == nullptr) {
                 throw_path_not_found(path);
             }
-            node = &(*node)[name];
         }
 
         return node->keys();
@@ -141,16 +226,17 @@ public:
     std::shared_ptr<property_iface> _pop(const fs_path& path_) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::unique_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
         node_type* node   = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
+        for (const std::string_view name : split_path(path)) {
+            node_type* child = node->find(name);
+            if (child == nullptr) {
                 throw_path_not_found(path);
             }
             parent = node;
-            node   = &(*node)[name];
+            node   = child;
         }
 
         if (node->prop.get() == NULL) {
@@ -160,7 +246,7 @@ public:
             throw uhd::runtime_error("Cannot pop");
         }
         auto prop = node->prop;
-        parent->pop(fs_path(path.leaf()));
+        parent->pop(path.leaf());
         return prop;
     }
 
@@ -168,14 +254,12 @@ public:
         const fs_path& path_, const std::shared_ptr<property_iface>& prop) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::unique_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                (*node)[name] = node_type();
-            }
-            node = &(*node)[name];
+        for (const std::string_view name : split_path(path)) {
+            node_type* child = node->find(name);
+            node             = (child != nullptr) ? child : &node->insert(name);
         }
         if (node->prop.get() != NULL) {
             throw uhd::runtime_error(
@@ -187,14 +271,14 @@ public:
     std::shared_ptr<property_iface>& _access(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
+        for (const std::string_view name : split_path(path)) {
+            node = node->find(name);
+            if (node == nullptr) {
                 throw_path_not_found(path);
             }
-            node = &(*node)[name];
         }
         if (node->prop.get() == NULL) {
             throw uhd::runtime_error("Cannot access! Property uninitialized at: " + path);
@@ -208,17 +292,61 @@ private:
         throw uhd::lookup_error("Path not found in tree: " + path);
     }
 
-    // basic structural node element
-    struct node_type : uhd::dict<std::string, node_type>
+    // basic structural node element. Children are kept in insertion order
+    // (list() exposes that order) in a flat vector, and are looked up by
+    // string_view so tree walks don't allocate per path segment.
+    struct node_type
     {
+        node_type* find(std::string_view name)
+        {
+            for (auto& child : children) {
+                if (child.first == name) {
+                    return &child.second;
+                }
+            }
+            return nullptr;
+        }
+
+        node_type& insert(std::string_view name)
+        {
+            children.emplace_back(std::string(name), node_type());
+            return children.back().second;
+        }
+
+        void pop(std::string_view name)
+        {
+            for (auto it = children.begin(); it != children.end(); ++it) {
+                if (it->first == name) {
+                    children.erase(it);
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::string> keys() const
+        {
+            std::vector<std::string> keys;
+            keys.reserve(children.size());
+            for (const auto& child : children) {
+                keys.push_back(child.first);
+            }
+            return keys;
+        }
+
+        std::vector<std::pair<std::string, node_type>> children;
         std::shared_ptr<property_iface> prop;
     };
 
     // tree guts which may be referenced in a subtree
+    // Structure lookups (exists, list, access) take the mutex shared so
+    // readers on multiple threads don't serialize each other; operations
+    // that change the tree structure (create, remove, pop) take it
+    // exclusively. Note that the property values themselves are not
+    // protected by this mutex, only the tree structure.
     struct tree_guts_type
     {
         node_type root;
-        std::mutex mutex;
+        std::shared_mutex mutex;
     };
 
     // members, the tree and root prefix
@@ -7,12 +7,122 @@
 #include <uhd/rfnoc/actions.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
 
 using namespace uhd::rfnoc;
 
 namespace {
 // A static counter, which we use to uniquely label actions
 std::atomic<size_t> action_counter{0};
+
+// Actions fire constantly during streaming (e.g., one tx_event action per
+// EOB, plus one per underrun), and each one used to cost a heap allocation
+// for the object and shared_ptr control block. The factories below instead
+// allocate through a per-type freelist that recycles blocks when the last
+// reference is dropped, so steady-state streaming causes no allocator
+// traffic from the action subsystem.
+constexpr size_t MAX_POOLED_ACTIONS = 64;
+
+template <typename T>
+class action_freelist
+{
+public:
+    // The pool is intentionally leaked: Actions may be released during
+    // static destruction, after a function-local static pool would already
+    // have been torn down.
+    static action_freelist& instance()
+    {
+        static action_freelist* pool = new action_freelist();
+        return *pool;
+    }
+
+    void* allocate()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_free_blocks.empty()) {
+                void* block = _free_blocks.back();
+                _free_blocks.pop_back();
+                return block;
+            }
+        }
+        return ::operator new(sizeof(T));
+    }
+
+    void deallocate(void* block)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_free_blocks.size() < MAX_POOLED_ACTIONS) {
+                _free_blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+private:
+    action_freelist()
+    {
+        _free_blocks.reserve(MAX_POOLED_ACTIONS);
+    }
+
+    std::mutex _mutex;
+    std::vector<void*> _free_blocks;
+};
+
+// Minimal allocator front-end to the freelist, for std::allocate_shared.
+// Note that allocate_shared rebinds this to its internal combined
+// object-plus-control-block type, so the object and the control block come
+// out of the pool in a single allocation.
+template <typename T>
+struct action_pool_alloc
+{
+    using value_type = T;
+
+    action_pool_alloc() = default;
+    template <typename U>
+    action_pool_alloc(const action_pool_alloc<U>&)
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(action_freelist<T>::instance().allocate());
+    }
+
+    void deallocate(T* ptr, size_t n)
+    {
+        if (n != 1) {
+            ::operator delete(ptr);
+            return;
+        }
+        action_freelist<T>::instance().deallocate(ptr);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const action_pool_alloc<T>&, const action_pool_alloc<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const action_pool_alloc<T>&, const action_pool_alloc<U>&)
+{
+    return false;
+}
+
+template <typename T, typename... Args>
+std::shared_ptr<T> make_pooled_action(Args&&... args)
+{
+    return std::allocate_shared<T>(action_pool_alloc<T>{}, std::forward<Args>(args)...);
+}
 } // namespace
 
 action_info::action_info(const std::string& key, const uhd::device_addr_t& args)
@@ -27,13 +137,16 @@ action_info::sptr action_info::make(
 {
     struct action_info_make_shared : public action_info
     {
+        action_info_make_shared(const std::string& key, const uhd::device_addr_t& args)
+            : action_info(key, args)
+        {
+        }
     };
     if (key == ACTION_KEY_STREAM_CMD) {
         return stream_cmd_action_info::make(
             uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
     }
-    // return std::make_shared<action_info_make_shared>(key, args);
-    return sptr(new action_info(key, args));
+    return make_pooled_action<action_info_make_shared>(key, args);
 }
 
 /*** Stream Command Action Info **********************************************/
@@ -47,7 +160,15 @@ stream_cmd_action_info::stream_cmd_action_info(
 stream_cmd_action_info::sptr stream_cmd_action_info::make(
     const uhd::stream_cmd_t::stream_mode_t stream_mode)
 {
-    return sptr(new stream_cmd_action_info(stream_mode));
+    struct stream_cmd_action_info_make_shared : public stream_cmd_action_info
+    {
+        stream_cmd_action_info_make_shared(
+            const uhd::stream_cmd_t::stream_mode_t stream_mode)
+            : stream_cmd_action_info(stream_mode)
+        {
+        }
+    };
+    return make_pooled_action<stream_cmd_action_info_make_shared>(stream_mode);
 }
 
 /*** RX Metadata Action Info *************************************************/
@@ -67,7 +188,7 @@ rx_event_action_info::sptr rx_event_action_info::make(
         {
         }
     };
-    return std::make_shared<rx_event_action_info_make_shared>(error_code);
+    return make_pooled_action<rx_event_action_info_make_shared>(error_code);
 }
 
 /*** TX Metadata Action Info *************************************************/
@@ -92,7 +213,7 @@ tx_event_action_info::sptr tx_event_action_info::make(
         {
         }
     };
-    return std::make_shared<tx_event_action_info_make_shared>(event_code, tsf);
+    return make_pooled_action<tx_event_action_info_make_shared>(event_code, tsf);
 }
 
 /*** Tune Request Metadata Action Info *************************************************/
@@ -106,5 +227,12 @@ tune_request_action_info::tune_request_action_info(
 tune_request_action_info::sptr tune_request_action_info::make(
     const uhd::tune_request_t tune_request)
 {
-    return sptr(new tune_request_action_info(tune_request));
+    struct tune_request_action_info_make_shared : public tune_request_action_info
+    {
+        tune_request_action_info_make_shared(const uhd::tune_request_t tune_request)
+            : tune_request_action_info(tune_request)
+        {
+        }
+    };
+    return make_pooled_action<tune_request_action_info_make_shared>(tune_request);
 }
@@ -134,7 +134,8 @@ private:
                 // std::lock_guard<std::mutex> lock(_mutex);
                 try {
                     _recv_pkt->refresh(buff->data());
-                    const ctrl_payload payload = _recv_pkt->get_payload();
+                    _recv_pkt->fill_payload(_recv_payload);
+                    const ctrl_payload& payload = _recv_payload;
                     ep_map_key_t key{payload.src_epid, payload.dst_port};
                     auto ep_iter = _endpoint_map.find(key);
                     if (ep_iter != _endpoint_map.end()) {
@@ -189,6 +190,10 @@ private:
     // Packet containers
     chdr_ctrl_packet::uptr _send_pkt;
     chdr_ctrl_packet::cuptr _recv_pkt;
+    // Deserialized payload of the current receive packet. Only touched by the
+    // recv thread, and reused across packets so that its data vector keeps its
+    // capacity and steady-state message handling stays allocation-free.
+    ctrl_payload _recv_payload;
     // A collection of ctrlport endpoints (keyed by the port number)
     std::map<ep_map_key_t, ctrlport_endpoint::sptr> _endpoint_map;
     // Mutex that protects all state in this class except for _send_pkt
@@ -31,26 +31,30 @@ public:
     {
         assert(pkt_buff);
         _pkt_buff = const_cast<uint64_t*>(reinterpret_cast<const uint64_t*>(pkt_buff));
-        _mdata_offset = _compute_mdata_offset(get_chdr_header());
+        _header   = chdr_header(u64_to_host(_pkt_buff[0]));
+        _mdata_offset = _compute_mdata_offset(_header);
     }
 
     void refresh(void* pkt_buff, chdr_header& header, uint64_t timestamp = 0) override
     {
         assert(pkt_buff);
+        // Pack the header with a single 8-byte store and keep a host-order
+        // copy so none of the accessors have to read it back from the buffer
+        // and undo the link byte order
         _pkt_buff    = reinterpret_cast<uint64_t*>(pkt_buff);
         _pkt_buff[0] = u64_from_host(header);
         if (_has_timestamp(header)) {
             _pkt_buff[1] = u64_from_host(timestamp);
         }
-        _mdata_offset = _compute_mdata_offset(get_chdr_header());
+        _header       = header;
+        _mdata_offset = _compute_mdata_offset(header);
     }
 
     void update_payload_size(size_t payload_size_bytes) override
     {
-        chdr_header header = get_chdr_header();
-        header.set_length(((_mdata_offset + header.get_num_mdata()) * chdr_w_bytes)
-                          + payload_size_bytes);
-        _pkt_buff[0] = u64_from_host(header);
+        _header.set_length(((_mdata_offset + _header.get_num_mdata()) * chdr_w_bytes)
+                           + payload_size_bytes);
+        _pkt_buff[0] = u64_from_host(_header);
     }
 
     endianness_t get_byte_order() const override
@@ -66,7 +70,9 @@ public:
     chdr_header get_chdr_header() const override
     {
         assert(_pkt_buff);
-        return chdr_header(u64_to_host(_pkt_buff[0]));
+        // Served from the host-order copy made in refresh(); the buffer
+        // itself holds the header in link byte order
+        return _header;
     }
 
     boost::optional<uint64_t> get_timestamp() const override
@@ -157,6 +163,8 @@ private:
     // Packet state
     const size_t _mtu_bytes      = 0;
     mutable uint64_t* _pkt_buff  = nullptr;
+    //! Host-order copy of the header at _pkt_buff[0], valid after refresh()
+    mutable chdr_header _header;
     mutable size_t _mdata_offset = 0;
 };
 
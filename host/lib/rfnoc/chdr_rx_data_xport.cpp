@@ -6,11 +6,14 @@
 
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/chdr_ctrl_xport.hpp>
 #include <uhdlib/rfnoc/chdr_rx_data_xport.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <algorithm>
+#include <chrono>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -23,12 +26,28 @@ rx_flow_ctrl_sender::rx_flow_ctrl_sender(
 {
     _fc_packet             = pkt_factory.make_strs();
     _fc_strs_pyld.src_epid = sep_ids.second;
+    _conv_from_host        = pkt_factory.make_generic()->conv_from_host<uint64_t>();
 }
 
 void rx_flow_ctrl_sender::set_capacity(const stream_buff_params_t& recv_capacity)
 {
     _fc_strs_pyld.capacity_bytes = recv_capacity.bytes;
     _fc_strs_pyld.capacity_pkts  = recv_capacity.packets;
+
+    // Serialize a complete response packet into the template. send_strs()
+    // copies the template and rewrites only the sequence number and the
+    // transfer counts, avoiding a full header serialization per response.
+    _fc_header = chdr::chdr_header();
+    _fc_header.set_dst_epid(_dst_epid);
+
+    // Large enough for the widest CHDR header plus the 4-word strs payload
+    _fc_template.assign(16, 0);
+    _fc_packet->refresh(_fc_template.data(), _fc_header, _fc_strs_pyld);
+
+    _fc_packet_size = _fc_header.get_length();
+    UHD_ASSERT_THROW(_fc_packet_size <= _fc_template.size() * sizeof(uint64_t));
+    _fc_pyld_offset_words =
+        _fc_packet_size / sizeof(uint64_t) - _fc_strs_pyld.get_length();
 }
 
 chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
@@ -38,6 +57,7 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     const uhd::rfnoc::sep_id_pair_t& epids,
     const size_t num_recv_frames,
     const fc_params_t& fc_params,
+    const bool fc_poller,
     disconnect_callback_t disconnect)
     : _fc_state(epids, fc_params.freq)
     , _mtu(recv_link->get_recv_frame_size())
@@ -45,6 +65,8 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     , _epid(epids.second)
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
     , _disconnect(disconnect)
+    , _reconnect_start(fc_params.reconnect_start)
+    , _reconnect_commit(fc_params.reconnect_commit)
 {
     UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
         "Creating rx xport with local epid=" << epids.second
@@ -58,6 +80,36 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     _hdr_len = _recv_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     UHD_ASSERT_THROW(_hdr_len);
 
+    // Size the release batch against the flow control update window, so
+    // batching never delays a flow control response past its natural cadence,
+    // and cap it so a stalled consumer cannot sit on too many frames
+    constexpr size_t max_release_batch = 16;
+    size_t release_batch =
+        std::min(max_release_batch, std::max<size_t>(1, num_recv_frames / 2));
+    if (fc_params.freq.packets > 0) {
+        release_batch =
+            std::min(release_batch, static_cast<size_t>(fc_params.freq.packets));
+    }
+    _release_batch_size = release_batch;
+    _release_pending.reserve(_release_batch_size);
+
+    _connect_links(io_srv, recv_link, send_link, num_recv_frames, fc_poller);
+
+    UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
+        "Stream endpoint was configured with:"
+            << std::endl
+            << "capacity bytes=" << fc_params.buff_capacity.bytes
+            << ", packets=" << fc_params.buff_capacity.packets << std::endl
+            << "fc frequency bytes=" << fc_params.freq.bytes
+            << ", packets=" << fc_params.freq.packets);
+}
+
+void chdr_rx_data_xport::_connect_links(uhd::transport::io_service::sptr io_srv,
+    uhd::transport::recv_link_if::sptr recv_link,
+    uhd::transport::send_link_if::sptr send_link,
+    const size_t num_recv_frames,
+    const bool fc_poller)
+{
     // Make data transport
     auto recv_cb =
         [this](buff_t::uptr& buff, recv_link_if* recv_link, send_link_if* send_link) {
@@ -69,29 +121,272 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
             this->_fc_callback(std::move(buff), recv_link, send_link);
         };
 
+    // If the flow control poller is enabled, reserve one recv frame for it
+    // so the combined reservation still fits the link
+    const bool use_fc_poller = fc_poller && num_recv_frames > 1;
+    const size_t num_data_frames =
+        use_fc_poller ? num_recv_frames - 1 : num_recv_frames;
+
     // Needs just a single send frame for responses
     _recv_io = io_srv->make_recv_client(recv_link,
+        num_data_frames,
+        recv_cb,
+        send_link,
+        /* num_send_frames*/ 1,
+        fc_cb);
+
+    if (use_fc_poller) {
+        // The poller never claims packets. Polling it drives the I/O
+        // service's receive path, which invokes this xport's recv callback
+        // (registered first) on incoming packets: stream commands are
+        // consumed and flow control responses sent even while _recv_io has
+        // all its frames in use. Data packets are queued towards _recv_io as
+        // usual. This only has an effect with an offload I/O service, which
+        // polls all of its clients from its worker threads; with an inline
+        // I/O service the poller is never polled and is benign.
+        auto poller_cb = [](buff_t::uptr& /*buff*/,
+                             recv_link_if* /*recv_link*/,
+                             send_link_if* /*send_link*/) { return false; };
+
+        _fc_poller_io = io_srv->make_recv_client(recv_link,
+            /* num_recv_frames*/ 1,
+            poller_cb,
+            nullptr,
+            /* num_send_frames*/ 0,
+            nullptr);
+    }
+}
+
+void chdr_rx_data_xport::add_striped_link(uhd::transport::io_service::sptr io_srv,
+    uhd::transport::recv_link_if::sptr recv_link,
+    uhd::transport::send_link_if::sptr send_link,
+    const size_t num_recv_frames,
+    disconnect_callback_t disconnect)
+{
+    UHD_ASSERT_THROW(!_recv_io2);
+    UHD_ASSERT_THROW(recv_link->get_recv_frame_size() >= _mtu);
+
+    // Striped streams release per-origin without batching, so return any
+    // batched releases before enabling the second link
+    _flush_pending_releases();
+
+    auto recv_cb =
+        [this](buff_t::uptr& buff, recv_link_if* recv_link, send_link_if* send_link) {
+            return this->_recv_callback(buff, recv_link, send_link);
+        };
+
+    auto fc_cb =
+        [this](buff_t::uptr buff, recv_link_if* recv_link, send_link_if* send_link) {
+            this->_fc_callback(std::move(buff), recv_link, send_link);
+        };
+
+    _recv_io2 = io_srv->make_recv_client(recv_link,
         num_recv_frames,
         recv_cb,
         send_link,
         /* num_send_frames*/ 1,
         fc_cb);
 
-    UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
-        "Stream endpoint was configured with:"
-            << std::endl
-            << "capacity bytes=" << fc_params.buff_capacity.bytes
-            << ", packets=" << fc_params.buff_capacity.packets << std::endl
-            << "fc frequency bytes=" << fc_params.freq.bytes
-            << ", packets=" << fc_params.freq.packets);
+    _disconnect2 = disconnect;
+
+    // Don't let the stash starve one link's recv client of frames while we
+    // wait for a gap to fill
+    _reorder_depth = std::max<size_t>(1, num_recv_frames / 2);
+
+    UHD_LOG_DEBUG("XPORT::RX_DATA_XPORT",
+        "Added striped link to rx stream with local epid="
+            << _epid << ", reorder depth=" << _reorder_depth);
+}
+
+std::tuple<chdr_rx_data_xport::buff_t::uptr, chdr_rx_data_xport::packet_info_t, bool>
+chdr_rx_data_xport::_get_recv_buff_striped(const int32_t timeout_ms)
+{
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    auto finish = [this](buff_t::uptr buff) {
+        auto info            = _read_data_packet_info(buff);
+        const bool seq_error = _is_out_of_sequence(std::get<1>(info));
+        return std::make_tuple(std::move(buff), std::get<0>(info), seq_error);
+    };
+
+    while (true) {
+        // Serve the next in-order packet from the stash, if we have it
+        auto it = _reorder_stash.find(_data_seq_num);
+        if (it != _reorder_stash.end()) {
+            buff_t::uptr buff = std::move(it->second);
+            _reorder_stash.erase(it);
+            return finish(std::move(buff));
+        }
+
+        // Poll both links; the short slice on the primary avoids busy-waiting
+        buff_t::uptr buff = _recv_io->get_recv_buff(1);
+        size_t origin     = 0;
+        if (!buff) {
+            buff   = _recv_io2->get_recv_buff(0);
+            origin = 1;
+        }
+
+        if (buff) {
+            _recv_packet->refresh(buff->data());
+            const uint16_t seq_num   = _recv_packet->get_chdr_header().get_seq_num();
+            _buff_origin[buff.get()] = origin;
+
+            if (seq_num == _data_seq_num) {
+                return finish(std::move(buff));
+            }
+
+            // A packet behind the expected sequence number is a late arrival
+            // for a gap we already gave up on. It can never become the next
+            // expected packet, so stashing it would leak its frame for the
+            // stream's lifetime; release it back to its link instead.
+            if (static_cast<uint16_t>(seq_num - _data_seq_num) >= 0x8000) {
+                release_recv_buff(std::move(buff));
+                continue;
+            }
+
+            auto stash_it = _reorder_stash.find(seq_num);
+            if (stash_it != _reorder_stash.end()) {
+                // The sequence numbers wrapped all the way around to a key
+                // that is still stashed, so the stashed frame is 65536
+                // packets old. Release it and keep the fresh one; emplace on
+                // a duplicate key would silently drop the new frame.
+                release_recv_buff(std::move(stash_it->second));
+                stash_it->second = std::move(buff);
+            } else {
+                _reorder_stash.emplace(seq_num, std::move(buff));
+            }
+
+            if (_reorder_stash.size() > _reorder_depth) {
+                // The gap is not going to fill: packets were dropped on one
+                // of the links. Give up on it and serve the stashed packet
+                // closest to the expected sequence number; _is_out_of_sequence
+                // flags the jump as a regular sequence error (overrun).
+                auto best = _reorder_stash.begin();
+                for (auto jt = _reorder_stash.begin(); jt != _reorder_stash.end();
+                     ++jt) {
+                    if (static_cast<uint16_t>(jt->first - _data_seq_num)
+                        < static_cast<uint16_t>(best->first - _data_seq_num)) {
+                        best = jt;
+                    }
+                }
+                buff_t::uptr best_buff = std::move(best->second);
+                _reorder_stash.erase(best);
+                return finish(std::move(best_buff));
+            }
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() > deadline) {
+            return std::make_tuple(buff_t::uptr(), packet_info_t(), false);
+        }
+    }
+}
+
+void chdr_rx_data_xport::switch_links(uhd::transport::io_service::sptr io_srv,
+    uhd::transport::recv_link_if::sptr recv_link,
+    uhd::transport::send_link_if::sptr send_link,
+    const size_t num_recv_frames,
+    const bool fc_poller,
+    disconnect_callback_t disconnect)
+{
+    // The streamer sized its buffers against the MTU reported at creation
+    // time, so the new link must be able to carry frames at least that big
+    UHD_ASSERT_THROW(recv_link->get_recv_frame_size() >= _mtu);
+
+    UHD_LOG_DEBUG("XPORT::RX_DATA_XPORT",
+        "Re-pointing rx stream with local epid=" << _epid << " to new links");
+
+    // Unbind from the old links before touching their disconnect callback
+    _flush_pending_releases();
+    _fc_poller_io.reset();
+    _recv_io.reset();
+    _disconnect();
+    _disconnect = disconnect;
+
+    _connect_links(io_srv, recv_link, send_link, num_recv_frames, fc_poller);
+
+    // The remote SEP still routes to the old link and its counts refer to
+    // packets we never saw; restart from scratch. The caller must re-arm the
+    // SEP via reconnect() before data flows on the new path.
+    _fc_state.reset();
+    _data_seq_num = 0;
+}
+
+void chdr_rx_data_xport::failover()
+{
+    if (!_failover) {
+        throw uhd::runtime_error("rx xport has no standby link configured");
+    }
+    UHD_LOG_INFO("XPORT::RX_DATA_XPORT",
+        "Failing over rx stream with local epid=" << _epid << " to standby link");
+    _failover(*this);
+}
+
+void chdr_rx_data_xport::reconnect(chdr_ctrl_xport& ctrl_xport, const int32_t timeout_ms)
+{
+    if (!_reconnect_start || !_reconnect_commit) {
+        throw uhd::runtime_error(
+            "rx xport does not support in-place reconnection");
+    }
+    UHD_LOG_DEBUG("XPORT::RX_DATA_XPORT",
+        "Reconnecting rx stream with local epid=" << _epid);
+
+    _reconnecting = true;
+
+    // Restart sequence tracking: the re-armed SEP numbers packets from zero
+    // again. Samples lost during the outage surface through the streamer's
+    // regular sequence error (overrun) reporting.
+    _data_seq_num = 0;
+
+    // Re-program the route and request a stream restart
+    _reconnect_start(ctrl_xport);
+
+    // Drive the receive path so the STRC_INIT from the re-armed SEP is
+    // consumed and acknowledged even with an inline I/O service. Stale data
+    // packets from before the disruption are discarded here.
+    _flush_pending_releases();
+    int32_t poll_timeout_ms = timeout_ms;
+    while (auto buff = _recv_io->get_recv_buff(poll_timeout_ms)) {
+        _recv_io->release_recv_buff(std::move(buff));
+        poll_timeout_ms = 0;
+    }
+
+    // Let the SEP know the setup is complete; this also verifies the stream
+    // came back up and throws if it did not
+    _reconnect_commit(ctrl_xport);
+
+    _needs_reconnect = false;
+    _reconnecting    = false;
+}
+
+void chdr_rx_data_xport::shutdown()
+{
+    // Return stashed buffers and unregister from the I/O service; after
+    // this, incoming packets for our EPID are no longer claimed by this
+    // transport. The links are disconnected by the destructor.
+    _flush_pending_releases();
+    _reorder_stash.clear();
+    _fc_poller_io.reset();
+    _recv_io2.reset();
+    _recv_io.reset();
 }
 
 chdr_rx_data_xport::~chdr_rx_data_xport()
 {
     // Release recv_io before allowing members needed by callbacks be destroyed
+    if (_recv_io) {
+        _flush_pending_releases();
+    }
+    _reorder_stash.clear();
+    _fc_poller_io.reset();
+    _recv_io2.reset();
     _recv_io.reset();
 
     // Disconnect the links
+    if (_disconnect2) {
+        _disconnect2();
+    }
     _disconnect();
 }
 
@@ -217,6 +512,35 @@ chdr_rx_data_xport::fc_params_t chdr_rx_data_xport::configure_sep(io_service::sp
     fc_params.buff_capacity = recv_capacity;
     fc_params.freq          = {strc.num_bytes, static_cast<uint32_t>(strc.num_pkts)};
 
+    // Stash handlers that can re-run this setup over a management transport,
+    // so the xport can be re-armed in place after a link disruption (see
+    // chdr_rx_data_xport::reconnect()). The mgmt portal is owned by the link
+    // stream manager and outlives the transport.
+    fc_params.reconnect_start = [&mgmt_portal,
+                                    remote_epid,
+                                    lossy_xport,
+                                    pyld_buff_fmt,
+                                    mdata_buff_fmt,
+                                    fc_freq,
+                                    fc_headroom,
+                                    throttle = xport_args.get("throttle", "1.0")](
+                                    chdr_ctrl_xport& reconnect_ctrl_xport) {
+        mgmt_portal.setup_local_route(reconnect_ctrl_xport, remote_epid);
+        mgmt_portal.config_local_rx_stream_start(reconnect_ctrl_xport,
+            remote_epid,
+            lossy_xport,
+            pyld_buff_fmt,
+            mdata_buff_fmt,
+            fc_freq,
+            fc_headroom,
+            throttle);
+    };
+    fc_params.reconnect_commit = [&mgmt_portal, remote_epid, fc_enabled](
+                                     chdr_ctrl_xport& reconnect_ctrl_xport) {
+        mgmt_portal.config_local_rx_stream_commit(
+            reconnect_ctrl_xport, remote_epid, 0.2 /*default timeout*/, fc_enabled);
+    };
+
     recv_io.reset();
     ctrl_xport.reset();
 
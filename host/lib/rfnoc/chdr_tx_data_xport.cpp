@@ -6,17 +6,27 @@
 
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/chdr_ctrl_xport.hpp>
 #include <uhdlib/rfnoc/chdr_tx_data_xport.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <chrono>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
 using namespace uhd::rfnoc::detail;
 using namespace uhd::transport;
 
+namespace {
+//! Round-trip time we consider typical for a local link; only links that are
+// measurably slower get their flow control frequency auto-tuned
+constexpr double LOCAL_LINK_RTT_US = 100.0;
+//! Lower bound for the auto-tuned flow control frequency ratio
+constexpr double MIN_FC_FREQ_RATIO = 1.0 / 64;
+} // namespace
+
 tx_flow_ctrl_sender::tx_flow_ctrl_sender(
     const chdr::chdr_packet_factory& pkt_factory, const sep_id_pair_t sep_ids)
     : _dst_epid(sep_ids.second)
@@ -41,6 +51,7 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
     , _frame_size(send_link->get_send_frame_size())
     , _disconnect(disconnect)
+    , _reconnect_sep(fc_params.reconnect_sep)
 {
     UHD_LOG_TRACE("XPORT::TX_DATA_XPORT",
         "Creating tx xport with local epid=" << epids.first
@@ -54,6 +65,13 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     _hdr_len = _send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     UHD_ASSERT_THROW(_hdr_len);
 
+    // Cache the payload offsets for both data packet types so the send hot
+    // path can assemble headers without calling back into the packet writer
+    _payload_offset_ts = _hdr_len;
+    _payload_offset_no_ts =
+        _send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_NO_TS);
+    UHD_ASSERT_THROW(_payload_offset_no_ts);
+
     // Now create the send I/O we will use for data
     auto send_cb = [this](buff_t::uptr buff, transport::send_link_if* send_link) {
         this->_send_callback(std::move(buff), send_link);
@@ -77,6 +95,28 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
         fc_cb);
 }
 
+void chdr_tx_data_xport::reconnect(chdr_ctrl_xport& ctrl_xport)
+{
+    if (!_reconnect_sep) {
+        throw uhd::runtime_error(
+            "tx xport does not support in-place reconnection");
+    }
+    UHD_LOG_DEBUG("XPORT::TX_DATA_XPORT",
+        "Reconnecting tx stream with local epid=" << _epid);
+
+    // Re-program the route and the SEP's stream configuration
+    _reconnect_sep(ctrl_xport);
+
+    // Write off anything that was in flight when the link went down. The
+    // reset leaves a flow control resync pending, which realigns the SEP's
+    // transfer counts with ours when the next packet goes out. The buffer
+    // capacity is unchanged, so the full init handshake is not repeated.
+    _fc_state.reset();
+    _data_seq_num = 0;
+
+    _needs_reconnect = false;
+}
+
 chdr_tx_data_xport::~chdr_tx_data_xport()
 {
     // Release send_io before allowing members needed by callbacks be destroyed
@@ -100,7 +140,8 @@ static chdr_tx_data_xport::fc_params_t configure_flow_ctrl(io_service::sptr io_s
     const chdr::chdr_packet_factory& pkt_factory,
     const sep_id_pair_t epids,
     const double fc_freq_ratio,
-    const double fc_headroom_ratio)
+    const double fc_headroom_ratio,
+    const uhd::device_addr_t& xport_args)
 {
     chdr::chdr_strc_packet::uptr strc_packet   = pkt_factory.make_strc();
     chdr::chdr_packet_writer::uptr recv_packet = pkt_factory.make_generic();
@@ -192,22 +233,55 @@ static chdr_tx_data_xport::fc_params_t configure_flow_ctrl(io_service::sptr io_s
         return {strs.capacity_bytes, static_cast<uint32_t>(strs.capacity_pkts)};
     };
 
-    // Send a strc init to get the buffer size
+    // Send a strc init to get the buffer size. This exchange makes a full
+    // round trip through the stream endpoint over the data links, so it
+    // doubles as a ping to measure the link round-trip time.
+    const auto strc_send_time = std::chrono::steady_clock::now();
     send_strc_init();
     stream_buff_params_t capacity = recv_strs();
+    const double link_rtt_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - strc_send_time)
+            .count();
 
     UHD_LOG_TRACE("XPORT::TX_DATA_XPORT",
         "Received strs initializing buffer capacity to " << capacity.bytes << " bytes");
+    UHD_LOG_DEBUG("XPORT::TX_DATA_XPORT",
+        "Measured a link round-trip time of " << link_rtt_us << " us");
+
+    // The device reports its transfer counts every (freq_ratio * capacity)
+    // bytes, and while a report is in flight the host must assume those bytes
+    // are still in the buffer. The usable window is thus roughly the buffer
+    // capacity minus the bandwidth-delay product minus the report interval.
+    // On long-RTT links the bandwidth-delay product eats most of the buffer,
+    // so halve the report interval for every doubling of the RTT beyond what
+    // we expect on a local link, trading a little strs overhead for a usable
+    // window. A transport arg always wins over the auto-tuned value.
+    double freq_ratio = fc_freq_ratio;
+    for (double rtt_us = LOCAL_LINK_RTT_US;
+         rtt_us < link_rtt_us && freq_ratio > MIN_FC_FREQ_RATIO;
+         rtt_us *= 2) {
+        freq_ratio /= 2;
+    }
+    if (freq_ratio != fc_freq_ratio) {
+        UHD_LOG_DEBUG("XPORT::TX_DATA_XPORT",
+            "Lowering flow control frequency ratio from "
+                << fc_freq_ratio << " to " << freq_ratio
+                << " to compensate for the link round-trip time");
+    }
+    freq_ratio = xport_args.cast<double>("fc_freq_ratio", freq_ratio);
+    const double headroom_ratio =
+        xport_args.cast<double>("fc_headroom_ratio", fc_headroom_ratio);
 
     // Calculate the requested fc_freq parameters
     stream_buff_params_t fc_freq = {
-        static_cast<uint64_t>(std::ceil(double(capacity.bytes) * fc_freq_ratio)),
-        static_cast<uint32_t>(std::ceil(double(capacity.packets) * fc_freq_ratio))};
+        static_cast<uint64_t>(std::ceil(double(capacity.bytes) * freq_ratio)),
+        static_cast<uint32_t>(std::ceil(double(capacity.packets) * freq_ratio))};
 
     const size_t headroom_bytes =
-        static_cast<uint64_t>(std::ceil(double(capacity.bytes) * fc_headroom_ratio));
+        static_cast<uint64_t>(std::ceil(double(capacity.bytes) * headroom_ratio));
     const size_t headroom_packets =
-        static_cast<uint32_t>(std::ceil(double(capacity.packets) * fc_headroom_ratio));
+        static_cast<uint32_t>(std::ceil(double(capacity.packets) * headroom_ratio));
 
     fc_freq.bytes -= headroom_bytes;
     fc_freq.packets -= headroom_packets;
@@ -233,6 +307,7 @@ chdr_tx_data_xport::fc_params_t chdr_tx_data_xport::configure_sep(io_service::sp
     const sw_buff_t mdata_buff_fmt,
     const double fc_freq_ratio,
     const double fc_headroom_ratio,
+    const uhd::device_addr_t& xport_args,
     disconnect_callback_t disconnect)
 {
     const sep_id_t remote_epid = epids.second;
@@ -255,11 +330,25 @@ chdr_tx_data_xport::fc_params_t chdr_tx_data_xport::configure_sep(io_service::sp
     mgmt_portal.config_local_tx_stream(
         *ctrl_xport, remote_epid, pyld_buff_fmt, mdata_buff_fmt);
 
-    return configure_flow_ctrl(io_srv,
+    auto fc_params = configure_flow_ctrl(io_srv,
         recv_link,
         send_link,
         pkt_factory,
         epids,
         fc_freq_ratio,
-        fc_headroom_ratio);
+        fc_headroom_ratio,
+        xport_args);
+
+    // Stash a handler that can re-run this setup over a management transport,
+    // so the xport can be re-armed in place after a link disruption (see
+    // chdr_tx_data_xport::reconnect()). The mgmt portal is owned by the link
+    // stream manager and outlives the transport.
+    fc_params.reconnect_sep = [&mgmt_portal, remote_epid, pyld_buff_fmt, mdata_buff_fmt](
+                                  chdr_ctrl_xport& reconnect_ctrl_xport) {
+        mgmt_portal.setup_local_route(reconnect_ctrl_xport, remote_epid);
+        mgmt_portal.config_local_tx_stream(
+            reconnect_ctrl_xport, remote_epid, pyld_buff_fmt, mdata_buff_fmt);
+    };
+
+    return fc_params;
 }
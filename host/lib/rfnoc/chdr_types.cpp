@@ -419,25 +419,28 @@ std::string mgmt_op_t::to_string() const
     return stream.str();
 }
 
-//! Serialize this hop into a list of 64-bit words
-size_t mgmt_hop_t::serialize(std::vector<uint64_t>& target,
+//! Serialize this hop into a flat buffer of 64-bit words
+size_t mgmt_hop_t::serialize(uint64_t* target,
+    size_t& index,
     const std::function<uint64_t(uint64_t)>& conv_byte_order,
     const size_t padding_size) const
 {
     for (size_t i = 0; i < get_num_ops(); i++) {
-        target.push_back(
+        target[index++] =
             conv_byte_order((static_cast<uint64_t>(_ops.at(i).get_op_payload()) << 16)
                             | (static_cast<uint64_t>(_ops.at(i).get_op_code()) << 8)
-                            | (static_cast<uint64_t>(get_num_ops() - i - 1) << 0)));
+                            | (static_cast<uint64_t>(get_num_ops() - i - 1) << 0));
         for (size_t j = 0; j < padding_size; j++) {
-            target.push_back(uint64_t(0));
+            target[index++] = uint64_t(0);
         }
     }
     return get_num_ops();
 }
 
-//! Deserialize this hop into from list of 64-bit words
-void mgmt_hop_t::deserialize(std::list<uint64_t>& src,
+//! Deserialize this hop from a flat buffer of 64-bit words
+void mgmt_hop_t::deserialize(const uint64_t* src,
+    size_t& index,
+    const size_t num_words,
     const std::function<uint64_t(uint64_t)>& conv_byte_order,
     const size_t padding_size)
 {
@@ -445,19 +448,19 @@ void mgmt_hop_t::deserialize(std::list<uint64_t>& src,
     size_t ops_remaining = 0;
     do {
         // TODO: Change this to a legit exception
-        UHD_ASSERT_THROW(!src.empty());
+        UHD_ASSERT_THROW(index < num_words);
 
-        uint64_t op_word = conv_byte_order(src.front());
+        uint64_t op_word = conv_byte_order(src[index]);
         ops_remaining    = static_cast<size_t>(op_word & 0xFF);
+        if (_ops.empty()) {
+            // The first word tells us how many ops this hop carries
+            _ops.reserve(ops_remaining + 1);
+        }
         mgmt_op_t op(static_cast<mgmt_op_t::op_code_t>((op_word >> 8) & 0xFF),
             static_cast<uint64_t>((op_word >> 16)),
             static_cast<uint8_t>(op_word & 0xFF));
         _ops.push_back(op);
-        src.pop_front();
-        for (size_t i = 0; i < padding_size; i++) {
-            src.pop_front();
-        }
-
+        index += 1 + padding_size;
     } while (ops_remaining > 0);
 }
 
@@ -490,29 +493,28 @@ size_t mgmt_payload::serialize(uint64_t* buff,
     size_t max_size_bytes,
     const std::function<uint64_t(uint64_t)>& conv_byte_order) const
 {
-    std::vector<uint64_t> target;
+    // Check the size up front so we can serialize straight into the packet
+    // buffer without intermediate storage
+    UHD_ASSERT_THROW(get_length() * sizeof(uint64_t) <= max_size_bytes);
+
+    size_t index = 0;
     // Insert header
-    target.push_back(conv_byte_order(
+    buff[index++] = conv_byte_order(
         (static_cast<uint64_t>(_protover) << 48)
         | (static_cast<uint64_t>(static_cast<uint8_t>(_chdr_w) & 0x7) << 45)
         | (static_cast<uint64_t>(get_num_hops() & 0x3FF) << 16)
-        | (static_cast<uint64_t>(_src_epid) << 0)));
+        | (static_cast<uint64_t>(_src_epid) << 0));
     // According to the RFNoC specification section 2.2.6, the MSBs are 0 for
     // all widths greater than 64. This logic adds the padding.
     for (size_t i = 0; i < _padding_size; i++) {
-        target.push_back(uint64_t(0));
+        buff[index++] = uint64_t(0);
     }
 
     // Insert data from each hop
     for (const auto& hop : _hops) {
-        hop.serialize(target, conv_byte_order, _padding_size);
+        hop.serialize(buff, index, conv_byte_order, _padding_size);
     }
-    UHD_ASSERT_THROW(target.size() <= max_size_bytes);
-
-    // We use a vector and copy just for ease of implementation
-    // These transactions are not performance critical
-    std::copy(target.begin(), target.end(), buff);
-    return (target.size() * sizeof(uint64_t));
+    return (index * sizeof(uint64_t));
 }
 
 void mgmt_payload::deserialize(const uint64_t* buff,
@@ -521,29 +523,27 @@ void mgmt_payload::deserialize(const uint64_t* buff,
 {
     UHD_ASSERT_THROW(buff_size > 1);
 
-    // We use a list and copy just for ease of implementation
-    // These transactions are not performance critical
-    std::list<uint64_t> src_list(buff, buff + (buff_size * (_padding_size + 1)));
+    // Parse straight out of the flat packet buffer; a cursor into the buffer
+    // takes the place of the word list this used to copy into
+    const size_t num_words = buff_size * (_padding_size + 1);
+    size_t index           = 0;
 
     _hops.clear();
 
     // Deframe the header
-    uint64_t hdr = conv_byte_order(src_list.front());
+    uint64_t hdr = conv_byte_order(buff[index++]);
     _hops.resize(static_cast<size_t>((hdr >> 16) & 0x3FF));
     _src_epid     = static_cast<sep_id_t>(hdr & 0xFFFF);
     _chdr_w       = static_cast<chdr_w_t>((hdr >> 45) & 0x7);
     _protover     = static_cast<uint16_t>((hdr >> 48) & 0xFFFF);
     _padding_size = (chdr_w_to_bits(_chdr_w) / 64) - 1;
-    src_list.pop_front();
     // According to the RFNoC specification section 2.2.6, the MSBs are 0 for
     // all widths greater than 64. This logic removes the padding.
-    for (size_t i = 0; i < _padding_size; i++) {
-        src_list.pop_front();
-    }
+    index += _padding_size;
 
     // Populate all hops
     for (size_t i = 0; i < get_num_hops(); i++) {
-        _hops[i].deserialize(src_list, conv_byte_order, _padding_size);
+        _hops[i].deserialize(buff, index, num_words, conv_byte_order, _padding_size);
     }
 }
 
@@ -551,7 +551,8 @@ size_t mgmt_payload::get_length() const
 {
     size_t length = 1 + _padding_size; /* header */
     for (const auto& hop : this->_hops) {
-        length += hop.get_num_ops() + _padding_size;
+        // Each op word is followed by the padding for widths greater than 64
+        length += hop.get_num_ops() * (1 + _padding_size);
     }
     return length;
 }
@@ -7,8 +7,10 @@
 #include <uhd/types/time_spec.hpp>
 #include <uhdlib/rfnoc/client_zero.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <future>
 #include <string>
 #include <thread>
+#include <tuple>
 
 using namespace uhd::rfnoc;
 using namespace uhd::rfnoc::detail;
@@ -52,12 +54,18 @@ client_zero::client_zero(register_iface::sptr reg)
     : uhd::rfnoc::register_iface_holder(reg)
 {
     // The info we need is static, so we can read it all up front, and store the
-    // parsed information.
-    const uint32_t proto_reg_val       = regs().peek32(PROTOVER_ADDR);
-    const uint32_t port_reg_val        = regs().peek32(PORT_CNT_ADDR);
-    const uint32_t edge_reg_val        = regs().peek32(EDGE_CNT_ADDR);
-    const uint32_t device_info_reg_val = regs().peek32(DEVICE_INFO_ADDR);
+    // parsed information. The reads are issued back to back and collected
+    // afterwards, so they overlap on the wire instead of paying one control
+    // round trip each.
+    auto proto_fut                     = regs().peek32_async(PROTOVER_ADDR);
+    auto port_fut                      = regs().peek32_async(PORT_CNT_ADDR);
+    auto edge_fut                      = regs().peek32_async(EDGE_CNT_ADDR);
+    auto device_info_fut               = regs().peek32_async(DEVICE_INFO_ADDR);
     const uint32_t cport_info_reg_val  = regs().peek32(CTRLPORT_CNT_ADDR);
+    const uint32_t proto_reg_val       = proto_fut.get();
+    const uint32_t port_reg_val        = port_fut.get();
+    const uint32_t edge_reg_val        = edge_fut.get();
+    const uint32_t device_info_reg_val = device_info_fut.get();
 
     // Parse the PROTOVER_ADDR register
     _proto_ver = proto_reg_val & 0xFFFF;
@@ -79,6 +87,30 @@ client_zero::client_zero(register_iface::sptr reg)
     // Read the adjacency list
     _adjacency_list = _get_adjacency_list();
 
+    // Pre-fetch the static per-block registers (block info, NOC ID, MTU)
+    // with all reads in flight; get_noc_id() and get_block_info() serve
+    // from this cache, so block enumeration scales with the round-trip
+    // latency and not with the block count
+    std::vector<
+        std::tuple<uint16_t, std::future<uint32_t>, std::future<uint32_t>,
+            std::future<uint32_t>>>
+        port_futs;
+    for (uint16_t portno = 1 + get_num_stream_endpoints();
+         portno < (1 + get_num_blocks() + get_num_stream_endpoints());
+         ++portno) {
+        const uint32_t base_addr = _get_port_base_addr(portno);
+        port_futs.emplace_back(portno,
+            regs().peek32_async(base_addr + BES_BLOCK_INFO_OFFSET),
+            regs().peek32_async(base_addr + BES_NOC_ID_OFFSET),
+            regs().peek32_async(base_addr + BES_MTU_INFO_OFFSET));
+    }
+    for (auto& futs : port_futs) {
+        const uint16_t portno    = std::get<0>(futs);
+        const uint32_t info_val  = std::get<1>(futs).get();
+        _noc_id_cache[portno]    = std::get<2>(futs).get();
+        _block_info_cache[portno] = {info_val, std::get<3>(futs).get()};
+    }
+
     // Set the default flushing timeout for each block
     for (uint16_t portno = 1 + get_num_stream_endpoints();
          portno < (1 + get_num_blocks() + get_num_stream_endpoints());
@@ -97,13 +129,20 @@ std::vector<client_zero::edge_def_t> client_zero::_get_adjacency_list()
     std::vector<edge_def_t> adj_list;
     adj_list.reserve(num_entries);
 
-    // The first entry is at offset 1
-    auto edge_reg_vals = regs().block_peek32(ADJACENCY_BASE_ADDR + 4, num_entries);
+    // The first entry is at offset 1; issue all entry reads in flight and
+    // gather them in order
+    std::vector<std::future<uint32_t>> edge_futs;
+    edge_futs.reserve(num_entries);
+    for (size_t i = 0; i < num_entries; i++) {
+        edge_futs.push_back(
+            regs().peek32_async(ADJACENCY_BASE_ADDR + 4 + (i * sizeof(uint32_t))));
+    }
 
     // Unpack the struct
     // Note: we construct the adjacency list with empty block IDs. We'll fill them in
     //       when we make the block controllers
-    for (uint32_t edge_reg_val : edge_reg_vals) {
+    for (auto& edge_fut : edge_futs) {
+        const uint32_t edge_reg_val = edge_fut.get();
         adj_list.push_back({uhd::narrow_cast<uint16_t>((edge_reg_val & 0xFFC00000) >> 22),
             uhd::narrow_cast<uint8_t>((edge_reg_val & 0x003F0000) >> 16),
             uhd::narrow_cast<uint16_t>((edge_reg_val & 0x0000FFC0) >> 6),
@@ -115,6 +154,11 @@ std::vector<client_zero::edge_def_t> client_zero::_get_adjacency_list()
 uint32_t client_zero::get_noc_id(uint16_t portno)
 {
     _check_port_number(portno);
+    // NOC IDs are static and pre-fetched at construction
+    const auto cache_it = _noc_id_cache.find(portno);
+    if (cache_it != _noc_id_cache.end()) {
+        return cache_it->second;
+    }
     // The NOC ID is the second entry in the port's register space
     return regs().peek32(_get_port_base_addr(portno) + BES_NOC_ID_OFFSET);
 }
@@ -213,12 +257,19 @@ void client_zero::reset_chdr(uint16_t portno)
 client_zero::block_config_info client_zero::get_block_info(uint16_t portno)
 {
     _check_port_number(portno);
-    // Most of the block info comes from the first register
-    const uint32_t config_reg_val =
-        regs().peek32(_get_port_base_addr(portno) + BES_BLOCK_INFO_OFFSET);
-    // MTU info is on a separate register
-    const uint32_t data_reg_val =
-        regs().peek32(_get_port_base_addr(portno) + BES_MTU_INFO_OFFSET);
+    uint32_t config_reg_val;
+    uint32_t data_reg_val;
+    // The fields we parse here are static and pre-fetched at construction
+    const auto cache_it = _block_info_cache.find(portno);
+    if (cache_it != _block_info_cache.end()) {
+        std::tie(config_reg_val, data_reg_val) = cache_it->second;
+    } else {
+        // Most of the block info comes from the first register
+        config_reg_val =
+            regs().peek32(_get_port_base_addr(portno) + BES_BLOCK_INFO_OFFSET);
+        // MTU info is on a separate register
+        data_reg_val = regs().peek32(_get_port_base_addr(portno) + BES_MTU_INFO_OFFSET);
+    }
     return {
         uhd::narrow_cast<uint8_t>((config_reg_val & 0x0000003F) >> 0),
         uhd::narrow_cast<uint8_t>((config_reg_val & 0x00000FC0) >> 6),
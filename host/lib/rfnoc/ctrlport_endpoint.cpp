@@ -7,14 +7,21 @@
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
 #include <condition_variable>
 #include <boost/optional.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <deque>
+#include <future>
 #include <mutex>
 #include <numeric>
 #include <set>
+#include <thread>
+#include <vector>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -32,6 +39,29 @@ constexpr double DEFAULT_TIMEOUT = 1.0;
 constexpr double MASSIVE_TIMEOUT = 10.0;
 //! Default value for whether ACKs are always required
 constexpr bool DEFAULT_FORCE_ACKS = false;
+//! Granularity of one slot of the transaction timer wheel. This bounds how
+// late a timeout can fire, not how early: entries keep their exact deadline
+// and are only expired once it has passed.
+constexpr auto TIMER_WHEEL_TICK = 100ms;
+//! Number of slots in the transaction timer wheel. One rotation (slots x
+// tick) exceeds MASSIVE_TIMEOUT, so in practice every entry expires on the
+// first visit of its slot; entries further out simply stay for another
+// rotation.
+constexpr size_t TIMER_WHEEL_SLOTS = 128;
+
+//! Compute the given percentile (in [0.0, 1.0]) from a latency histogram and
+// return the upper bound, in microseconds, of the bucket that contains it
+uint64_t latency_percentile(const uhd::rfnoc::ctrl_latency_stats_t& stats, double pct)
+{
+    uint64_t accum = 0;
+    for (size_t i = 0; i < stats.buckets.size(); i++) {
+        accum += stats.buckets[i];
+        if (double(accum) >= pct * double(stats.num_transactions)) {
+            return uint64_t(1) << (i + 1);
+        }
+    }
+    return 0;
+}
 } // namespace
 
 ctrlport_endpoint::~ctrlport_endpoint() = default;
@@ -56,7 +86,30 @@ public:
     {
     }
 
-    ~ctrlport_endpoint_impl() override = default;
+    ~ctrlport_endpoint_impl() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _wheel_stop = true;
+        }
+        _wheel_cond.notify_all();
+        if (_wheel_thread.joinable()) {
+            _wheel_thread.join();
+        }
+        // Fail any async transactions that are still in flight so their
+        // futures surface a timeout instead of a broken promise
+        for (auto& completer_pair : _async_completers) {
+            complete_with_timeout(completer_pair.first, completer_pair.second);
+        }
+        const auto stats = get_ctrl_latency_stats();
+        if (stats.num_transactions > 0) {
+            UHD_LOG_DEBUG("CTRLEP",
+                "Port " << _local_port << ": Completed " << stats.num_transactions
+                        << " acked control transactions (send-to-ack latency: p50 < "
+                        << latency_percentile(stats, 0.5) << " us, p99 < "
+                        << latency_percentile(stats, 0.99) << " us)");
+        }
+    }
 
     void poke32(uint32_t addr,
         uint32_t data,
@@ -111,6 +164,63 @@ public:
         */
     }
 
+    std::future<void> poke32_async(uint32_t addr,
+        uint32_t data,
+        uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
+    {
+        for (auto it = _custom_register_spaces.begin();
+             it != _custom_register_spaces.end() && addr >= it->first;
+             ++it) {
+            if (addr >= it->first && addr < it->second.end_addr) {
+                std::promise<void> promise;
+                it->second.poke_fn(addr, data);
+                promise.set_value();
+                return promise.get_future();
+            }
+        }
+        auto promise = std::make_shared<std::promise<void>>();
+        send_request_packet_async(OP_WRITE,
+            addr,
+            {data},
+            timestamp,
+            [this, promise](const ctrl_payload& resp, response_status_t resp_status) {
+                try {
+                    validate_ack(resp, resp_status);
+                    promise->set_value();
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            });
+        return promise->get_future();
+    }
+
+    std::future<uint32_t> peek32_async(
+        uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
+    {
+        for (auto it = _custom_register_spaces.begin();
+             it != _custom_register_spaces.end() && addr >= it->first;
+             ++it) {
+            if (addr >= it->first && addr < it->second.end_addr) {
+                std::promise<uint32_t> promise;
+                promise.set_value(it->second.peek_fn(addr));
+                return promise.get_future();
+            }
+        }
+        auto promise = std::make_shared<std::promise<uint32_t>>();
+        send_request_packet_async(OP_READ,
+            addr,
+            {uint32_t(0)},
+            timestamp,
+            [this, promise](const ctrl_payload& resp, response_status_t resp_status) {
+                try {
+                    promise->set_value(validate_ack(resp, resp_status).data_vtr.at(0));
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            });
+        return promise->get_future();
+    }
+
     uint32_t peek32(
         uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
     {
@@ -124,8 +234,7 @@ public:
             }
         }
         // Send request and wait for an ACK
-        boost::optional<ctrl_payload> response;
-        std::tie(std::ignore, response) =
+        const boost::optional<ctrl_payload> response =
             send_request_packet(OP_READ, addr, {uint32_t(0)}, timestamp);
         UHD_ASSERT_THROW(bool(response));
         UHD_ASSERT_THROW(!response.get().data_vtr.empty());
@@ -145,8 +254,7 @@ public:
 
         /* TODO: Uncomment when the atomic block peek is implemented in the FPGA
         // Send request and wait for an ACK
-        boost::optional<ctrl_payload> response;
-        std::tie(std::ignore, response) = send_request_packet(OP_READ,
+        const boost::optional<ctrl_payload> response = send_request_packet(OP_READ,
             first_addr,
             std::vector<uint32_t>(length, 0),
             timestamp);
@@ -221,7 +329,12 @@ public:
                 if (get_payload_size(_req_queue.front()) != get_payload_size(rx_ctrl)) {
                     resp_status = RESP_SIZEERR;
                 }
-                // Pop the request from the queue
+                // Record the send-to-ack latency and pop the request from the
+                // queue
+                if (!_req_send_times.empty()) {
+                    record_ctrl_latency(_req_send_times.front());
+                    _req_send_times.pop_front();
+                }
                 _req_queue.pop_front();
                 // Push the response into the response queue if and only if
                 // the client wanted an ACK for this packet
@@ -229,8 +342,17 @@ public:
                     rx_ctrl.seq_num, rx_ctrl.op_code, rx_ctrl.address};
                 if (_wanted_acks.count(request_key)) {
                     _wanted_acks.erase(request_key);
-                    _resp_queue.push_back(std::make_tuple(rx_ctrl, resp_status));
-                    _resp_ready_cond.notify_all();
+                    auto completer_it = _async_completers.find(request_key);
+                    if (completer_it != _async_completers.end()) {
+                        // Async transaction: fulfill the caller's future
+                        // instead of queueing the response
+                        auto completer = std::move(completer_it->second);
+                        _async_completers.erase(completer_it);
+                        completer(rx_ctrl, resp_status);
+                    } else {
+                        _resp_queue.push_back(std::make_tuple(rx_ctrl, resp_status));
+                        _resp_ready_cond.notify_all();
+                    }
                 } else {
                     // If the client didn't want an ACK for this request, but
                     // the response indicated an error, then provide some
@@ -252,16 +374,29 @@ public:
                 wanted_ack_key request_key{resp.seq_num, resp.op_code, resp.address};
                 if (_wanted_acks.count(request_key)) {
                     _wanted_acks.erase(request_key);
-                    resp.is_ack = true;
-                    _resp_queue.push_back(std::make_tuple(resp, RESP_DROPPED));
-                    _resp_ready_cond.notify_all();
+                    resp.is_ack       = true;
+                    auto completer_it = _async_completers.find(request_key);
+                    if (completer_it != _async_completers.end()) {
+                        // Async transaction: fulfill the caller's future with
+                        // the fabricated response
+                        auto completer = std::move(completer_it->second);
+                        _async_completers.erase(completer_it);
+                        completer(resp, RESP_DROPPED);
+                    } else {
+                        _resp_queue.push_back(std::make_tuple(resp, RESP_DROPPED));
+                        _resp_ready_cond.notify_all();
+                    }
                 } else {
                     // If the client did not want an ACK for this request, but
                     // we fabricated a response due to a sequence error, then
                     // provide feedback
                     log_dropped_packet(resp);
                 }
-                // Pop the request from the queue
+                // Pop the request from the queue. Its response was dropped,
+                // so no latency is recorded for it.
+                if (!_req_send_times.empty()) {
+                    _req_send_times.pop_front();
+                }
                 _req_queue.pop_front();
             };
 
@@ -309,15 +444,15 @@ public:
                 // Respond with an ACK packet
                 // Flow control not needed because we have allocated special room in the
                 // buffer for async message responses
-                ctrl_payload tx_ctrl(rx_ctrl);
-                tx_ctrl.is_ack     = true;
-                tx_ctrl.src_epid   = _my_epid;
-                tx_ctrl.status     = status;
-                const auto timeout = [&]() {
+                _async_ack_pl          = rx_ctrl;
+                _async_ack_pl.is_ack   = true;
+                _async_ack_pl.src_epid = _my_epid;
+                _async_ack_pl.status   = status;
+                const auto timeout     = [&]() {
                     std::unique_lock<std::mutex> lock(_mutex);
                     return _policy.timeout;
                 }();
-                _handle_send(tx_ctrl, timeout);
+                _handle_send(_async_ack_pl, timeout);
             } catch (...) {
                 UHD_LOG_ERROR("CTRLEP",
                     "Encountered an error sending a response for an async message");
@@ -350,6 +485,30 @@ public:
         return _local_port;
     }
 
+    size_t get_cmd_buff_occupancy() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return static_cast<size_t>(std::max<ssize_t>(_buff_occupied, 0));
+    }
+
+    size_t get_cmd_buff_capacity() const override
+    {
+        // Is const, does not require a mutex
+        return _buff_capacity;
+    }
+
+    ctrl_latency_stats_t get_ctrl_latency_stats() const override
+    {
+        // The counters are atomic, so reading does not require the mutex and
+        // does not stall transactions in flight
+        ctrl_latency_stats_t stats;
+        stats.num_transactions = _num_latency_samples.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < stats.buckets.size(); i++) {
+            stats.buckets[i] = _latency_buckets[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
     void define_custom_register_space(uint32_t start_addr,
         uint32_t length,
         std::function<void(uint32_t, uint32_t)> poke_fn,
@@ -382,7 +541,21 @@ public:
 
 private:
     //! The software status (different from the transaction status) of the response
-    enum response_status_t { RESP_VALID, RESP_DROPPED, RESP_RTERR, RESP_SIZEERR };
+    enum response_status_t {
+        RESP_VALID,
+        RESP_DROPPED,
+        RESP_RTERR,
+        RESP_SIZEERR,
+        RESP_TIMEOUT
+    };
+
+    //! Completion function for async transactions, called from handle_recv()
+    using async_completer_t =
+        std::function<void(const chdr::ctrl_payload&, response_status_t)>;
+
+    //! An {opcode, address, sequence number} triple identifying a request
+    // packet, used to match responses to requests
+    using wanted_ack_key = std::tuple<uint8_t, ctrl_opcode_t, uint32_t>;
 
     //! Returns the length of the control payload in 32-bit words
     inline static size_t get_payload_size(const ctrl_payload& payload)
@@ -408,9 +581,8 @@ private:
     }
 
     //! Sends a request control packet to a remote device, optionally waiting
-    // for an ACK, and returns any response if applicable
-    const std::pair<ctrl_payload, boost::optional<ctrl_payload>> send_request_packet(
-        ctrl_opcode_t op_code,
+    // for an ACK, and returns the response if one was requested
+    const boost::optional<ctrl_payload> send_request_packet(ctrl_opcode_t op_code,
         uint32_t address,
         const std::vector<uint32_t>& data_vtr,
         const uhd::time_spec_t& time_spec,
@@ -431,23 +603,12 @@ private:
 
         std::unique_lock<std::mutex> lock(_mutex);
 
-        // Assemble the control payload
-        ctrl_payload tx_ctrl;
-        tx_ctrl.dst_port    = _local_port;
-        tx_ctrl.src_port    = _local_port;
-        tx_ctrl.seq_num     = _tx_seq_num;
-        tx_ctrl.timestamp   = timestamp;
-        tx_ctrl.is_ack      = false;
-        tx_ctrl.src_epid    = _my_epid;
-        tx_ctrl.address     = address;
-        tx_ctrl.data_vtr    = data_vtr;
-        tx_ctrl.byte_enable = 0xF;
-        tx_ctrl.op_code     = op_code;
-        tx_ctrl.status      = CMD_OKAY;
-
         // Perform flow control
-        // If there is no room in the downstream buffer, then wait until the timeout
-        size_t pyld_size   = get_payload_size(tx_ctrl);
+        // If there is no room in the downstream buffer, then wait until the
+        // timeout (size computed to match get_payload_size() for the payload
+        // assembled below)
+        const size_t pyld_size =
+            2 + (timestamp.is_initialized() ? 2 : 0) + data_vtr.size();
         auto buff_not_full = [this, pyld_size]() -> bool {
             // Allocate room in the queue for one async response packet
             // If we can fit the current request in the queue then we can proceed
@@ -466,14 +627,36 @@ private:
                     "Control operation timed out waiting for space in command buffer");
             }
         }
+
+        // Assemble the control payload into the scratch object. This keeps
+        // payload assembly allocation-free once the reused data vector has
+        // grown to its (15-word) maximum capacity. The scratch object must
+        // not be referenced across a condition wait: another transaction may
+        // start assembling into it as soon as _mutex is dropped.
+        ctrl_payload& tx_ctrl = _req_pl;
+        tx_ctrl.dst_port      = _local_port;
+        tx_ctrl.src_port      = _local_port;
+        tx_ctrl.seq_num       = _tx_seq_num;
+        tx_ctrl.timestamp     = timestamp;
+        tx_ctrl.is_ack        = false;
+        tx_ctrl.src_epid      = _my_epid;
+        tx_ctrl.address       = address;
+        tx_ctrl.data_vtr      = data_vtr;
+        tx_ctrl.byte_enable   = 0xF;
+        tx_ctrl.op_code       = op_code;
+        tx_ctrl.status        = CMD_OKAY;
+
         _buff_occupied += pyld_size;
         _req_queue.push_back(tx_ctrl);
+        _req_send_times.push_back(steady_clock::now());
 
+        // The request details used for ACK matching; kept in a local since
+        // wait_for_ack() drops the lock while waiting
+        const wanted_ack_key ack_key{tx_ctrl.seq_num, tx_ctrl.op_code, tx_ctrl.address};
         if (require_ack || _policy.force_acks) {
             // If the client wants an ACK for this request, make note of its
             // details in a set. This set will be consulted when responses are
             // received.
-            wanted_ack_key ack_key{tx_ctrl.seq_num, tx_ctrl.op_code, tx_ctrl.address};
             _wanted_acks.insert(ack_key);
         }
 
@@ -483,23 +666,117 @@ private:
             _tx_seq_num = (_tx_seq_num + 1) % 64;
 
             if (require_ack || _policy.force_acks) {
-                auto response = wait_for_ack(tx_ctrl, lock);
-                return {tx_ctrl, response};
+                return wait_for_ack(ack_key, lock);
             } else {
-                return {tx_ctrl, {}};
+                return boost::none;
             }
         } catch (...) {
             // Something went wrong while trying to send the request.
             // Remove the entry from the ACK tracking set.
-            wanted_ack_key ack_key{tx_ctrl.seq_num, tx_ctrl.op_code, tx_ctrl.address};
             _wanted_acks.erase(ack_key);
             throw;
         }
     }
 
-    //! Waits for and returns the ACK for the specified request
+    //! Sends a request control packet like send_request_packet(), but instead
+    // of waiting for the ACK, registers a completion function that handle_recv()
+    // invokes when the matching response (or a fabricated one) arrives
+    void send_request_packet_async(ctrl_opcode_t op_code,
+        uint32_t address,
+        const std::vector<uint32_t>& data_vtr,
+        const uhd::time_spec_t& time_spec,
+        async_completer_t completer)
+    {
+        if (!_client_clk.is_running()) {
+            throw uhd::system_error("Ctrlport client clock is not running");
+        }
+
+        // Convert from uhd::time_spec to timestamp
+        boost::optional<uint64_t> timestamp;
+        if (time_spec != time_spec_t::ASAP) {
+            if (!_timebase_clk.is_running()) {
+                throw uhd::system_error("Timebase clock is not running");
+            }
+            timestamp = time_spec.to_ticks(_timebase_clk.get_freq());
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        // Perform flow control
+        // If there is no room in the downstream buffer, then wait until the
+        // timeout (size computed to match get_payload_size() for the payload
+        // assembled below)
+        const size_t pyld_size =
+            2 + (timestamp.is_initialized() ? 2 : 0) + data_vtr.size();
+        auto buff_not_full = [this, pyld_size]() -> bool {
+            // Allocate room in the queue for one async response packet
+            // If we can fit the current request in the queue then we can proceed
+            return (_buff_occupied + pyld_size)
+                   <= (_buff_capacity
+                       - (ASYNC_MESSAGE_SIZE * _max_outstanding_async_msgs));
+        };
+        if (!buff_not_full()) {
+            // If there is a timed command in the queue, use the
+            // MASSIVE_TIMEOUT instead
+            auto timeout_time =
+                start_timeout(check_timed_in_queue() ? MASSIVE_TIMEOUT : _policy.timeout);
+
+            if (not _buff_free_cond.wait_until(lock, timeout_time, buff_not_full)) {
+                throw uhd::op_timeout(
+                    "Control operation timed out waiting for space in command buffer");
+            }
+        }
+
+        // Assemble the control payload into the scratch object (see
+        // send_request_packet()); the lock is held from here to the end of
+        // the function, so it cannot be clobbered by another transaction
+        ctrl_payload& tx_ctrl = _req_pl;
+        tx_ctrl.dst_port      = _local_port;
+        tx_ctrl.src_port      = _local_port;
+        tx_ctrl.seq_num       = _tx_seq_num;
+        tx_ctrl.timestamp     = timestamp;
+        tx_ctrl.is_ack        = false;
+        tx_ctrl.src_epid      = _my_epid;
+        tx_ctrl.address       = address;
+        tx_ctrl.data_vtr      = data_vtr;
+        tx_ctrl.byte_enable   = 0xF;
+        tx_ctrl.op_code       = op_code;
+        tx_ctrl.status        = CMD_OKAY;
+
+        _buff_occupied += pyld_size;
+        _req_queue.push_back(tx_ctrl);
+        _req_send_times.push_back(steady_clock::now());
+
+        // Track the request like a wanted ACK, and additionally register the
+        // completion function so handle_recv() can fulfill the caller's future
+        wanted_ack_key ack_key{tx_ctrl.seq_num, tx_ctrl.op_code, tx_ctrl.address};
+        _wanted_acks.insert(ack_key);
+        _async_completers[ack_key] = std::move(completer);
+
+        try {
+            // Send the payload as soon as there is room in the buffer
+            _handle_send(tx_ctrl, _policy.timeout);
+            _tx_seq_num = (_tx_seq_num + 1) % 64;
+            // Arm the transaction's timeout on the timer wheel. If the
+            // response never arrives (and no later response implies it was
+            // dropped), the wheel service thread fails the caller's future
+            // instead of leaving it blocked forever.
+            arm_transaction_timeout(ack_key,
+                start_timeout(check_timed_in_queue() ? MASSIVE_TIMEOUT
+                                                     : _policy.timeout));
+        } catch (...) {
+            // Something went wrong while trying to send the request.
+            // Remove the tracking entries; the caller gets the exception
+            // instead of a future.
+            _wanted_acks.erase(ack_key);
+            _async_completers.erase(ack_key);
+            throw;
+        }
+    }
+
+    //! Waits for and returns the ACK for the request with the given key
     const ctrl_payload wait_for_ack(
-        const ctrl_payload& request, std::unique_lock<std::mutex>& lock)
+        const wanted_ack_key& request_key, std::unique_lock<std::mutex>& lock)
     {
         // Determine the timepoint (now plus some offset, depending on
         // whether we're waiting for a timed command or if we have a
@@ -522,9 +799,8 @@ private:
                 std::tie(rx_ctrl, resp_status) = *q_iterator;
                 // Check if this is the response meant for the request
                 // Filter by op_code, address and seq_num
-                if (rx_ctrl.seq_num == request.seq_num
-                    && rx_ctrl.op_code == request.op_code
-                    && rx_ctrl.address == request.address) {
+                if (wanted_ack_key{rx_ctrl.seq_num, rx_ctrl.op_code, rx_ctrl.address}
+                    == request_key) {
                     // Remove the response from the queue
                     _resp_queue.erase(q_iterator);
 
@@ -551,6 +827,9 @@ private:
     const ctrl_payload validate_ack(
         const ctrl_payload& rx_ctrl, response_status_t resp_status) const
     {
+        if (resp_status == RESP_TIMEOUT) {
+            throw uhd::op_timeout("Control operation timed out waiting for ACK");
+        }
         if (rx_ctrl.status == CMD_CMDERR) {
             throw uhd::op_failed("Control operation returned a failing status");
         } else if (rx_ctrl.status == CMD_TSERR) {
@@ -578,6 +857,24 @@ private:
                 << packet);
     }
 
+    //! Record the send-to-ack latency of a completed transaction into the
+    // histogram. Only called from the receiver thread, so the counters have a
+    // single writer and plain relaxed increments suffice.
+    void record_ctrl_latency(const steady_clock::time_point& send_time)
+    {
+        const int64_t elapsed_us =
+            duration_cast<microseconds>(steady_clock::now() - send_time).count();
+        // Bucket i counts latencies in [2^i, 2^(i+1)) microseconds; the last
+        // bucket also absorbs everything beyond the histogram range
+        size_t bucket = 0;
+        while (bucket < _latency_buckets.size() - 1
+               && (int64_t(1) << (bucket + 1)) <= elapsed_us) {
+            bucket++;
+        }
+        _latency_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        _num_latency_samples.fetch_add(1, std::memory_order_relaxed);
+    }
+
     void log_dropped_packet(const ctrl_payload& resp)
     {
         std::string packet = resp.to_string();
@@ -586,6 +883,100 @@ private:
             "CTRLEP", "Control response for ack-less request was dropped: " << packet);
     }
 
+    //! Arm the timeout for an outstanding async transaction on the timer
+    // wheel: an O(1) push into the slot covering the deadline. There is no
+    // explicit disarm; when the transaction completes normally, handle_recv()
+    // removes its completer and the stale wheel entry is discarded the next
+    // time its slot is visited. Requires _mutex to be held.
+    void arm_transaction_timeout(
+        const wanted_ack_key& key, const steady_clock::time_point& deadline)
+    {
+        // The wheel service thread only exists if the async API is in use
+        if (!_wheel_thread.joinable()) {
+            _wheel_thread = std::thread([this]() { wheel_service_loop(); });
+            uhd::set_thread_name(&_wheel_thread, "uhd_ctrlep_tmr");
+        }
+        if (_wheel_num_entries == 0) {
+            // Rebase an empty wheel on the current time so the cursor does
+            // not have to catch up over idle periods, and wake the service
+            // thread from its idle wait
+            _wheel_next_tick = steady_clock::now() + TIMER_WHEEL_TICK;
+            _wheel_cond.notify_one();
+        }
+        // Round up to the first slot visited after the deadline. Placement
+        // only affects when the entry is examined; expiry is decided by the
+        // deadline stored with it, so entries further out than one rotation
+        // simply survive until a later visit.
+        const auto time_left = deadline - (_wheel_next_tick - TIMER_WHEEL_TICK);
+        const size_t ticks_ahead =
+            std::max<int64_t>(1, time_left / TIMER_WHEEL_TICK + 1);
+        _wheel_slots[(_wheel_cursor + ticks_ahead) % TIMER_WHEEL_SLOTS].push_back(
+            {deadline, key});
+        _wheel_num_entries++;
+    }
+
+    //! Expire or discard the entries of the slot under the wheel cursor whose
+    // deadline has passed. Requires _mutex to be held.
+    void expire_wheel_slot(const steady_clock::time_point& now)
+    {
+        auto& slot = _wheel_slots[_wheel_cursor];
+        for (size_t i = 0; i < slot.size();) {
+            if (slot[i].deadline > now) {
+                i++;
+                continue;
+            }
+            const wanted_ack_key key = slot[i].key;
+            slot[i]                  = slot.back();
+            slot.pop_back();
+            _wheel_num_entries--;
+            auto completer_it = _async_completers.find(key);
+            if (completer_it == _async_completers.end()) {
+                // The transaction already completed; this is a stale entry
+                continue;
+            }
+            complete_with_timeout(key, completer_it->second);
+            _async_completers.erase(completer_it);
+            _wanted_acks.erase(key);
+        }
+    }
+
+    //! Invoke an async completer with a fabricated response carrying the
+    // timeout status, so the caller's future throws uhd::op_timeout
+    void complete_with_timeout(const wanted_ack_key& key, async_completer_t& completer)
+    {
+        ctrl_payload resp;
+        resp.seq_num = std::get<0>(key);
+        resp.op_code = std::get<1>(key);
+        resp.address = std::get<2>(key);
+        resp.is_ack  = true;
+        completer(resp, RESP_TIMEOUT);
+    }
+
+    //! Entry point of the wheel service thread: advance the cursor one slot
+    // per tick, expiring overdue transactions along the way. A single thread
+    // and a single wait per tick serve all outstanding transactions of this
+    // endpoint, however many are in flight.
+    void wheel_service_loop()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_wheel_stop) {
+            if (_wheel_num_entries == 0) {
+                _wheel_cond.wait(
+                    lock, [this]() { return _wheel_stop || _wheel_num_entries > 0; });
+                continue;
+            }
+            const auto now = steady_clock::now();
+            while (_wheel_num_entries > 0 && _wheel_next_tick <= now) {
+                expire_wheel_slot(now);
+                _wheel_cursor = (_wheel_cursor + 1) % TIMER_WHEEL_SLOTS;
+                _wheel_next_tick += TIMER_WHEEL_TICK;
+            }
+            if (_wheel_num_entries > 0) {
+                _wheel_cond.wait_until(lock, _wheel_next_tick);
+            }
+        }
+    }
+
     //! The parameters associated with the policy that governs this object
     struct policy_args
     {
@@ -614,6 +1005,14 @@ private:
         [](uint32_t, const std::vector<uint32_t>&) { return true; };
     //! The function to call to handle an async message
     async_msg_callback_t _handle_async_msg = async_msg_callback_t();
+    //! Reusable payload for acking async messages. Only touched from the
+    // receive thread; reusing it keeps the ack's data vector from being
+    // reallocated on every event (e.g. during underflow storms).
+    ctrl_payload _async_ack_pl;
+    //! Scratch payload for request assembly, reused across transactions so
+    // its data vector keeps its capacity. Guarded by _mutex; must never be
+    // referenced across a condition wait (see send_request_packet())
+    ctrl_payload _req_pl;
     //! The current control sequence number of outgoing packets
     uint8_t _tx_seq_num = 0;
     //! The number of occupied words in the downstream buffer
@@ -624,16 +1023,50 @@ private:
     std::condition_variable _buff_free_cond;
     //! A queue that holds all outstanding requests
     std::deque<ctrl_payload> _req_queue;
+    //! The times at which the outstanding requests were sent, kept in
+    // lockstep with _req_queue (used for latency instrumentation)
+    std::deque<steady_clock::time_point> _req_send_times;
+    //! Send-to-ack latency histogram; bucket i counts transactions that
+    // completed in [2^i, 2^(i+1)) microseconds
+    std::array<std::atomic<uint64_t>, ctrl_latency_stats_t::NUM_BUCKETS>
+        _latency_buckets{};
+    //! Total number of latencies recorded in the histogram
+    std::atomic<uint64_t> _num_latency_samples{0};
     //! A queue that holds all outstanding responses and their status
     std::deque<std::tuple<ctrl_payload, response_status_t>> _resp_queue;
     //! A condition variable that hold the "response is available" condition
     std::condition_variable _resp_ready_cond;
     //! A mutex to protect all state in this class
     std::mutex _mutex;
-    //! A set of {opcode, address, sequence numbers} triples associated with
-    // request packets for which the client cares about receiving ACKs
-    using wanted_ack_key = std::tuple<uint8_t, ctrl_opcode_t, uint32_t>;
+    //! The keys of request packets for which the client cares about
+    // receiving ACKs
     std::set<wanted_ack_key> _wanted_acks;
+    //! Completion functions for outstanding async transactions, keyed like
+    // the wanted ACKs above
+    std::map<wanted_ack_key, async_completer_t> _async_completers;
+    //! One entry of the transaction timer wheel
+    struct timer_wheel_entry
+    {
+        steady_clock::time_point deadline;
+        wanted_ack_key key;
+    };
+    //! The slots of the transaction timer wheel. Slot i holds the entries
+    // that fall due when the cursor visits it (or, for deadlines beyond one
+    // rotation, on a later visit).
+    std::array<std::vector<timer_wheel_entry>, TIMER_WHEEL_SLOTS> _wheel_slots;
+    //! Index of the slot the wheel cursor is on
+    size_t _wheel_cursor = 0;
+    //! The time at which the cursor advances past its current slot
+    steady_clock::time_point _wheel_next_tick;
+    //! Total number of entries across all wheel slots (including stale ones)
+    size_t _wheel_num_entries = 0;
+    //! Signals the wheel service thread when the wheel becomes non-empty or
+    // the endpoint shuts down
+    std::condition_variable _wheel_cond;
+    //! Tells the wheel service thread to exit
+    bool _wheel_stop = false;
+    //! The wheel service thread; started on the first async transaction
+    std::thread _wheel_thread;
     //! Map of custom defined peek/poke functions with end address for custom register
     // space starting address
     std::map<uint32_t, custom_register_space> _custom_register_spaces;
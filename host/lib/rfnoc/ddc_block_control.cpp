@@ -59,7 +59,10 @@ public:
         _fpga_compat(regs().peek32(RB_COMPAT_NUM)),
         _num_halfbands(regs().peek32(RB_NUM_HB)),
         _cic_max_decim(regs().peek32(RB_CIC_MAX_DECIM)),
-        _residual_scaling(get_num_input_ports(), DEFAULT_SCALING)
+        _residual_scaling(get_num_input_ports(), DEFAULT_SCALING),
+        _programmed_decim(get_num_input_ports(), -1),
+        _programmed_time_incr(get_num_input_ports(), -1),
+        _programmed_freq_word(get_num_input_ports(), -1)
     {
         UHD_ASSERT_THROW(get_num_input_ports() == get_num_output_ports());
         UHD_ASSERT_THROW(_cic_max_decim > 0 && _cic_max_decim <= 0xFF);
@@ -197,6 +200,32 @@ public:
         issue_stream_cmd_action_handler(dst_edge, new_action);
     }
 
+    // The batched variant skips the message-to-ourselves detour: the stream
+    // command always travels upstream, so we can build the per-port actions
+    // (including the num_samps scaling the action handler would apply) right
+    // here and hand them to the graph in one post_actions() call.
+    void issue_stream_cmd(
+        const uhd::stream_cmd_t& stream_cmd, const std::vector<size_t>& ports) override
+    {
+        RFNOC_LOG_TRACE("issue_stream_cmd(stream_mode="
+                        << char(stream_cmd.stream_mode) << ", num_ports="
+                        << ports.size() << ") [batched]");
+        node_t::action_batch_t batch;
+        batch.reserve(ports.size());
+        for (const size_t port : ports) {
+            auto new_action        = stream_cmd_action_info::make(stream_cmd.stream_mode);
+            new_action->stream_cmd = stream_cmd;
+            if (stream_cmd.stream_mode == uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE
+                || stream_cmd.stream_mode
+                       == uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_MORE) {
+                new_action->stream_cmd.num_samps *= _decim.at(port).get();
+            }
+            batch.emplace_back(
+                res_source_info{res_source_info::INPUT_EDGE, port}, new_action);
+        }
+        post_actions(batch);
+    }
+
 protected:
     //! Block-specific register interface
     multichan_register_iface _ddc_reg_iface;
@@ -574,6 +603,17 @@ private:
      */
     void set_decim(int decim, const size_t chan)
     {
+        const uint32_t time_incr_word =
+            uint32_t(get_tick_rate() / get_output_rate(chan));
+        // Skip the register writes if this exact state is already programmed.
+        // Re-asserting the current rate (as frequency hoppers tend to do on
+        // every hop) would otherwise pay several control transactions for a
+        // no-op.
+        if (int64_t(decim) == _programmed_decim[chan]
+            && int64_t(time_incr_word) == _programmed_time_incr[chan]) {
+            RFNOC_LOG_TRACE("Decim " << decim << " already programmed, skipping");
+            return;
+        }
         RFNOC_LOG_TRACE("Set decim to " << decim);
         // Step 1: Calculate number of halfbands
         uint32_t hb_enable = 0;
@@ -593,8 +633,10 @@ private:
         _ddc_reg_iface.poke32(SR_M_ADDR, 1, chan);
 
         // Configure time increment in ticks per M output samples
-        _ddc_reg_iface.poke32(
-            SR_TIME_INCR_ADDR, uint32_t(get_tick_rate() / get_output_rate(chan)), chan);
+        _ddc_reg_iface.poke32(SR_TIME_INCR_ADDR, time_incr_word, chan);
+
+        _programmed_decim[chan]     = decim;
+        _programmed_time_incr[chan] = time_incr_word;
 
         if (cic_decim > 1 and hb_enable == 0) {
             RFNOC_LOG_WARNING(
@@ -658,8 +700,14 @@ private:
         std::tie(actual_freq, freq_word) =
             get_freq_and_freq_word(requested_freq, dds_rate);
 
-        _ddc_reg_iface.poke32(
-            SR_FREQ_ADDR, uint32_t(freq_word), chan, get_command_time(chan));
+        // Writing the word that is already programmed would be a no-op
+        // whenever it executes, so skip the control transaction (even for
+        // timed tunes)
+        if (int64_t(freq_word) != _programmed_freq_word[chan]) {
+            _ddc_reg_iface.poke32(
+                SR_FREQ_ADDR, uint32_t(freq_word), chan, get_command_time(chan));
+            _programmed_freq_word[chan] = freq_word;
+        }
         return actual_freq;
     }
 
@@ -679,6 +727,13 @@ private:
     //! Cache the current residual scaling
     std::vector<double> _residual_scaling;
 
+    //! Last decimation programmed into the FPGA (one per port, -1 = none yet)
+    std::vector<int64_t> _programmed_decim;
+    //! Last time increment word programmed into the FPGA (one per port)
+    std::vector<int64_t> _programmed_time_incr;
+    //! Last DDS frequency word programmed into the FPGA (one per port)
+    std::vector<int64_t> _programmed_freq_word;
+
     //! Properties for type_in (one per port)
     std::vector<property_t<std::string>> _type_in;
     //! Properties for type_out (one per port)
@@ -63,6 +63,12 @@ public:
         return _fifo_cores.at(chan)->get_packet_count();
     }
 
+    uint64_t get_fifo_fullness(const size_t chan) override
+    {
+        UHD_ASSERT_THROW(chan < _fifo_cores.size());
+        return _fifo_cores.at(chan)->get_fifo_fullness();
+    }
+
 private:
     //! One FIFO core object per FIFO
     std::vector<dma_fifo_core_3000::sptr> _fifo_cores;
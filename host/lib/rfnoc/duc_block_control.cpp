@@ -58,7 +58,10 @@ public:
         _fpga_compat(regs().peek32(RB_COMPAT_NUM)),
         _num_halfbands(regs().peek32(RB_NUM_HB)),
         _cic_max_interp(regs().peek32(RB_CIC_MAX_INTERP)),
-        _residual_scaling(get_num_input_ports(), DEFAULT_SCALING)
+        _residual_scaling(get_num_input_ports(), DEFAULT_SCALING),
+        _programmed_interp(get_num_input_ports(), -1),
+        _programmed_time_incr(get_num_input_ports(), -1),
+        _programmed_freq_word(get_num_input_ports(), -1)
     {
         UHD_ASSERT_THROW(get_num_input_ports() == get_num_output_ports());
         UHD_ASSERT_THROW(_cic_max_interp > 0 && _cic_max_interp <= 0xFF);
@@ -570,6 +573,17 @@ private:
      */
     void set_interp(int interp, const size_t chan)
     {
+        const uint32_t time_incr_word =
+            uint32_t(get_tick_rate() / get_output_rate(chan));
+        // Skip the register writes if this exact state is already programmed.
+        // Re-asserting the current rate (as frequency hoppers tend to do on
+        // every hop) would otherwise pay several control transactions for a
+        // no-op.
+        if (int64_t(interp) == _programmed_interp[chan]
+            && int64_t(time_incr_word) == _programmed_time_incr[chan]) {
+            RFNOC_LOG_TRACE("Interp " << interp << " already programmed, skipping");
+            return;
+        }
         RFNOC_LOG_TRACE("Set interp to " << interp);
         // Step 1: Calculate number of halfbands
         uint32_t hb_enable  = 0;
@@ -589,8 +603,10 @@ private:
         _duc_reg_iface.poke32(SR_N_ADDR, 1, chan);
 
         // Configure time increment in ticks per M output samples
-        _duc_reg_iface.poke32(
-            SR_TIME_INCR_ADDR, uint32_t(get_tick_rate() / get_output_rate(chan)), chan);
+        _duc_reg_iface.poke32(SR_TIME_INCR_ADDR, time_incr_word, chan);
+
+        _programmed_interp[chan]    = interp;
+        _programmed_time_incr[chan] = time_incr_word;
 
         if (cic_interp > 1 and hb_enable == 0) {
             RFNOC_LOG_WARNING(
@@ -650,8 +666,14 @@ private:
         std::tie(actual_freq, freq_word) =
             get_freq_and_freq_word(requested_freq, dds_rate);
 
-        _duc_reg_iface.poke32(
-            SR_FREQ_ADDR, uint32_t(freq_word), chan, get_command_time(chan));
+        // Writing the word that is already programmed would be a no-op
+        // whenever it executes, so skip the control transaction (even for
+        // timed tunes)
+        if (int64_t(freq_word) != _programmed_freq_word[chan]) {
+            _duc_reg_iface.poke32(
+                SR_FREQ_ADDR, uint32_t(freq_word), chan, get_command_time(chan));
+            _programmed_freq_word[chan] = freq_word;
+        }
         return actual_freq;
     }
 
@@ -671,6 +693,13 @@ private:
     //! Cache the current residual scaling
     std::vector<double> _residual_scaling;
 
+    //! Last interpolation programmed into the FPGA (one per port, -1 = none yet)
+    std::vector<int64_t> _programmed_interp;
+    //! Last time increment word programmed into the FPGA (one per port)
+    std::vector<int64_t> _programmed_time_incr;
+    //! Last DDS frequency word programmed into the FPGA (one per port)
+    std::vector<int64_t> _programmed_freq_word;
+
     //! Properties for type_in (one per port)
     std::vector<property_t<std::string>> _type_in;
     //! Properties for type_out (one per port)
@@ -10,17 +10,43 @@
 using namespace uhd;
 using namespace uhd::rfnoc;
 
-epid_allocator::epid_allocator(sep_id_t start_epid) : _next_epid(start_epid) {}
+namespace {
+//! Number of EPID slots to grow the pool by at a time
+constexpr size_t SLOT_CHUNK_SIZE = 64;
+} // namespace
+
+epid_allocator::epid_allocator(sep_id_t start_epid) : _start_epid(start_epid)
+{
+    _slots.reserve(SLOT_CHUNK_SIZE);
+}
+
+sep_id_t epid_allocator::_allocate_slot(const sep_addr_t& addr)
+{
+    size_t slot_idx;
+    if (!_free_slots.empty()) {
+        slot_idx = _free_slots.back();
+        _free_slots.pop_back();
+    } else {
+        if (_slots.size() == _slots.capacity()) {
+            _slots.reserve(_slots.capacity() + SLOT_CHUNK_SIZE);
+        }
+        slot_idx = _slots.size();
+        _slots.emplace_back();
+    }
+    _slots[slot_idx].addr      = addr;
+    _slots[slot_idx].allocated = true;
+
+    const sep_id_t new_epid = _start_epid + static_cast<sep_id_t>(slot_idx);
+    _epid_map[addr]         = new_epid;
+    return new_epid;
+}
 
 sep_id_t epid_allocator::allocate_epid(const sep_addr_t& addr)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    std::lock_guard<std::shared_mutex> lock(_mutex);
 
     if (_epid_map.count(addr) == 0) {
-        sep_id_t new_epid   = _next_epid++;
-        _epid_map[addr]     = new_epid;
-        _addr_map[new_epid] = addr;
-        return new_epid;
+        return _allocate_slot(addr);
     } else {
         return _epid_map.at(addr);
     }
@@ -29,12 +55,10 @@ sep_id_t epid_allocator::allocate_epid(const sep_addr_t& addr)
 sep_id_t epid_allocator::allocate_epid(
     const sep_addr_t& addr, mgmt::mgmt_portal& mgmt_portal, chdr_ctrl_xport& xport)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    std::lock_guard<std::shared_mutex> lock(_mutex);
 
     if (_epid_map.count(addr) == 0) {
-        sep_id_t new_epid   = _next_epid++;
-        _epid_map[addr]     = new_epid;
-        _addr_map[new_epid] = addr;
+        sep_id_t new_epid = _allocate_slot(addr);
         mgmt_portal.initialize_endpoint(xport, addr, new_epid);
         return new_epid;
     } else {
@@ -46,7 +70,7 @@ sep_id_t epid_allocator::allocate_epid(
 
 sep_id_t epid_allocator::get_epid(const sep_addr_t& addr)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_lock<std::shared_mutex> lock(_mutex);
 
     if (_epid_map.count(addr) != 0) {
         return _epid_map.at(addr);
@@ -58,18 +82,29 @@ sep_id_t epid_allocator::get_epid(const sep_addr_t& addr)
 
 sep_addr_t epid_allocator::lookup_addr(const sep_id_t& epid) const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_lock<std::shared_mutex> lock(_mutex);
 
-    if (_addr_map.count(epid) > 0) {
-        return _addr_map.at(epid);
+    const size_t slot_idx = static_cast<size_t>(epid - _start_epid);
+    if (epid >= _start_epid && slot_idx < _slots.size()
+        && _slots[slot_idx].allocated) {
+        return _slots[slot_idx].addr;
     } else {
         throw uhd::lookup_error("The specified EPID has not been allocated");
     }
 }
 
-void epid_allocator::deallocate_epid(sep_id_t)
+void epid_allocator::deallocate_epid(sep_id_t epid)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    // TODO: Nothing to do for deallocate.
-    //      With the current counter approach we assume that we will not run out of EPIDs
+    std::lock_guard<std::shared_mutex> lock(_mutex);
+
+    const size_t slot_idx = static_cast<size_t>(epid - _start_epid);
+    if (epid < _start_epid || slot_idx >= _slots.size()
+        || !_slots[slot_idx].allocated) {
+        // Tolerate stray deallocations, like the counter-based
+        // implementation did
+        return;
+    }
+    _epid_map.erase(_slots[slot_idx].addr);
+    _slots[slot_idx].allocated = false;
+    _free_slots.push_back(slot_idx);
 }
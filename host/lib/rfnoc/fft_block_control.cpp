@@ -8,7 +8,15 @@
 #include <uhd/rfnoc/defaults.hpp>
 #include <uhd/rfnoc/fft_block_control.hpp>
 #include <uhd/rfnoc/registry.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace uhd::rfnoc;
 
@@ -101,8 +109,124 @@ public:
         return static_cast<size_t>(_length.get());
     }
 
+    ~fft_block_control_impl() override
+    {
+        stop_capture();
+    }
+
+    /**************************************************************************
+     * Spectral Capture API
+     *************************************************************************/
+    void start_capture(
+        uhd::rx_streamer::sptr rx_stream, const size_t num_spectra) override
+    {
+        if (!rx_stream || rx_stream->get_num_channels() != 1) {
+            throw uhd::value_error(
+                "start_capture() requires a single-channel RX streamer");
+        }
+        if (num_spectra == 0) {
+            throw uhd::value_error("start_capture() ring size must be non-zero");
+        }
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        if (_capture_running) {
+            throw uhd::runtime_error("[FFT] A capture is already running");
+        }
+        _capture_stream = rx_stream;
+        _capture_length = get_length();
+        _capture_ring.resize(num_spectra * _capture_length);
+        _capture_count   = 0;
+        _capture_running = true;
+        _capture_thread  = std::thread([this]() { _capture_loop(); });
+        uhd::set_thread_name(&_capture_thread, "uhd_fft_cap");
+    }
+
+    void stop_capture() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_capture_mutex);
+            if (!_capture_running) {
+                return;
+            }
+            _capture_running = false;
+        }
+        _capture_thread.join();
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        _capture_stream.reset();
+        _capture_ring.clear();
+        _capture_ring.shrink_to_fit();
+    }
+
+    size_t get_spectra(std::complex<int16_t>* buff,
+        const size_t num_spectra,
+        const double timeout) override
+    {
+        std::unique_lock<std::mutex> lock(_capture_mutex);
+        if (!_capture_running) {
+            throw uhd::runtime_error("[FFT] No capture is running");
+        }
+        // Wait for the requested number of transforms to become available,
+        // then hand out as many of the most recent ones as we have
+        const size_t ring_spectra = _capture_ring.size() / _capture_length;
+        const size_t wanted       = std::min(num_spectra, ring_spectra);
+        _capture_cv.wait_for(lock,
+            std::chrono::microseconds(int64_t(timeout * 1e6)),
+            [this, wanted]() { return _capture_count >= wanted; });
+        const size_t available =
+            std::min<uint64_t>(wanted, std::min<uint64_t>(_capture_count, ring_spectra));
+        // Copy oldest-first, ending with the most recent transform
+        for (size_t i = 0; i < available; i++) {
+            const uint64_t seq = _capture_count - available + i;
+            std::memcpy(buff + i * _capture_length,
+                _capture_ring.data() + (seq % ring_spectra) * _capture_length,
+                _capture_length * BYTES_PER_SAMPLE);
+        }
+        return available;
+    }
+
+    uint64_t get_capture_count() const override
+    {
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        return _capture_count;
+    }
 
 private:
+    void _capture_loop()
+    {
+        const size_t ring_spectra = _capture_ring.size() / _capture_length;
+        std::vector<std::complex<int16_t>> buff(_capture_length);
+        uhd::rx_metadata_t md;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(_capture_mutex);
+                if (!_capture_running) {
+                    break;
+                }
+            }
+            // The block's atomic item size pins packet boundaries to transform
+            // boundaries, so receiving exactly one FFT length yields exactly
+            // one transform
+            const size_t num_rcvd =
+                _capture_stream->recv(buff.data(), _capture_length, md, 0.1);
+            if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                continue;
+            }
+            if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+                RFNOC_LOG_DEBUG("Capture receive error: " << md.strerror());
+                continue;
+            }
+            if (num_rcvd != _capture_length) {
+                continue; // partial transform, drop it
+            }
+            std::lock_guard<std::mutex> lock(_capture_mutex);
+            std::memcpy(
+                _capture_ring.data() + (_capture_count % ring_spectra) * _capture_length,
+                buff.data(),
+                _capture_length * BYTES_PER_SAMPLE);
+            _capture_count++;
+            _capture_cv.notify_all();
+        }
+    }
+
     void _reset()
     {
         regs().poke32(REG_RESET_ADDR, uint32_t(1));
@@ -224,6 +348,16 @@ private:
         PROP_KEY_TYPE, IO_TYPE_SC16, {res_source_info::INPUT_EDGE}};
     property_t<std::string> _type_out = property_t<std::string>{
         PROP_KEY_TYPE, IO_TYPE_SC16, {res_source_info::OUTPUT_EDGE}};
+
+    // Spectral capture state
+    mutable std::mutex _capture_mutex;
+    std::condition_variable _capture_cv;
+    std::thread _capture_thread;
+    uhd::rx_streamer::sptr _capture_stream;
+    std::vector<std::complex<int16_t>> _capture_ring;
+    size_t _capture_length  = 0;
+    uint64_t _capture_count = 0;
+    bool _capture_running   = false;
 };
 
 UHD_RFNOC_BLOCK_REGISTER_DIRECT(
@@ -9,7 +9,11 @@
 #include <uhd/rfnoc/fosphor_block_control.hpp>
 #include <uhd/rfnoc/property.hpp>
 #include <uhd/rfnoc/registry.hpp>
+#include <uhd/utils/thread.hpp>
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <thread>
 
 using namespace uhd::rfnoc;
 
@@ -228,10 +232,111 @@ public:
         return _prop_wf_decim.get();
     }
 
+    ~fosphor_block_control_impl() override
+    {
+        stop_capture();
+    }
+
+    /**************************************************************************
+     * Managed Capture API
+     *************************************************************************/
+    void start_capture(uhd::rx_streamer::sptr rx_stream,
+        void* ring_buff,
+        const size_t num_rows,
+        const size_t row_size,
+        const size_t row_pitch,
+        capture_row_cb_t&& row_cb) override
+    {
+        if (!rx_stream || rx_stream->get_num_channels() != 1) {
+            throw uhd::value_error(
+                "start_capture() requires a single-channel RX streamer");
+        }
+        if (!ring_buff || num_rows == 0 || row_size == 0) {
+            throw uhd::value_error("start_capture() ring geometry is invalid");
+        }
+        if (row_pitch != 0 && row_pitch < row_size) {
+            throw uhd::value_error(
+                "start_capture() row pitch is smaller than the row size");
+        }
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        if (_capture_running) {
+            throw uhd::runtime_error("[Fosphor] A capture is already running");
+        }
+        _capture_stream  = rx_stream;
+        _capture_ring    = static_cast<uint8_t*>(ring_buff);
+        _capture_rows    = num_rows;
+        _capture_size    = row_size;
+        _capture_pitch   = (row_pitch == 0) ? row_size : row_pitch;
+        _capture_cb      = std::move(row_cb);
+        _capture_count   = 0;
+        _capture_running = true;
+        _capture_thread  = std::thread([this]() { _capture_loop(); });
+        uhd::set_thread_name(&_capture_thread, "uhd_fosphor_cap");
+    }
+
+    void stop_capture() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_capture_mutex);
+            if (!_capture_running) {
+                return;
+            }
+            _capture_running = false;
+        }
+        _capture_thread.join();
+        std::lock_guard<std::mutex> lock(_capture_mutex);
+        _capture_stream.reset();
+        _capture_ring = nullptr;
+        _capture_cb   = nullptr;
+    }
+
+    uint64_t get_capture_count() const override
+    {
+        return _capture_count;
+    }
+
     /**************************************************************************
      * Initialization
      *************************************************************************/
 private:
+    void _capture_loop()
+    {
+        uhd::rx_metadata_t md;
+        size_t row_fill = 0; // bytes of the current row received so far
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(_capture_mutex);
+                if (!_capture_running) {
+                    break;
+                }
+            }
+            // Receive straight into the caller's ring slot; a row may span
+            // several packets, so keep filling until the row is complete
+            uint8_t* row =
+                _capture_ring + (_capture_count % _capture_rows) * _capture_pitch;
+            const size_t num_rcvd = _capture_stream->recv(
+                row + row_fill, _capture_size - row_fill, md, 0.1);
+            if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                continue;
+            }
+            if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+                RFNOC_LOG_DEBUG("Capture receive error: " << md.strerror());
+                row_fill = 0; // drop the partial row, restart on a boundary
+                continue;
+            }
+            row_fill += num_rcvd;
+            if (row_fill < _capture_size) {
+                continue;
+            }
+            row_fill                = 0;
+            const size_t row_index  = _capture_count % _capture_rows;
+            const uint64_t row_count = ++_capture_count;
+            if (_capture_cb) {
+                _capture_cb(row_index, row_count);
+            }
+        }
+    }
+
     void _register_props()
     {
         // register user properties
@@ -410,6 +515,18 @@ private:
                 {res_source_info::USER}};
     property_t<int> _prop_wf_decim =
         property_t<int>{PROP_KEY_WF_DECIMATION, 8, {res_source_info::USER}};
+
+    // Managed capture state
+    mutable std::mutex _capture_mutex;
+    std::thread _capture_thread;
+    uhd::rx_streamer::sptr _capture_stream;
+    capture_row_cb_t _capture_cb;
+    uint8_t* _capture_ring = nullptr;
+    size_t _capture_rows   = 0;
+    size_t _capture_size   = 0;
+    size_t _capture_pitch  = 0;
+    std::atomic<uint64_t> _capture_count{0};
+    bool _capture_running = false;
 };
 
 UHD_RFNOC_BLOCK_REGISTER_DIRECT(
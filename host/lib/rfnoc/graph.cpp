@@ -9,6 +9,7 @@
 #include <uhd/utils/scope_exit.hpp>
 #include <uhdlib/rfnoc/graph.hpp>
 #include <uhdlib/rfnoc/node_accessor.hpp>
+#include <uhdlib/rfnoc/prop_accessor.hpp>
 #include <boost/graph/filtered_graph.hpp>
 #include <boost/graph/topological_sort.hpp>
 #include <limits>
@@ -110,6 +111,14 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
         dst_node, [this, dst_node](const res_source_info& src, action_info::sptr action) {
             this->enqueue_action(dst_node, src, action);
         });
+    node_accessor.set_post_actions_callback(
+        src_node, [this, src_node](const node_t::action_batch_t& actions) {
+            this->enqueue_actions(src_node, actions);
+        });
+    node_accessor.set_post_actions_callback(
+        dst_node, [this, dst_node](const node_t::action_batch_t& actions) {
+            this->enqueue_actions(dst_node, actions);
+        });
 
     // Check if edge exists
     auto out_edge_range = boost::out_edges(src_vertex_desc, _graph);
@@ -182,6 +191,11 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
         throw uhd::rfnoc_error("Adding edge without disabling is_forward_edge will lead "
                                "to unresolvable graph!");
     }
+
+    // Remember the endpoints so the next commit() re-resolves properties
+    // across this new edge
+    _reconnected_nodes.insert(src_node);
+    _reconnected_nodes.insert(dst_node);
 }
 
 void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edge_info)
@@ -222,6 +236,7 @@ void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t
         node_accessor.clear_graph_mutex_callback(src_node);
         node_accessor.set_post_action_callback(
             src_node, [](const res_source_info&, action_info::sptr) {});
+        node_accessor.set_post_actions_callback(src_node, nullptr);
     }
 
     // Re-look up the vertex descriptor for dst_node, as the act of removing
@@ -235,6 +250,16 @@ void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t
         node_accessor.clear_graph_mutex_callback(dst_node);
         node_accessor.set_post_action_callback(
             dst_node, [](const res_source_info&, action_info::sptr) {});
+        node_accessor.set_post_actions_callback(dst_node, nullptr);
+    }
+
+    // Remember any endpoints still in the graph so the next commit()
+    // re-resolves properties around the removed edge
+    if (_node_map.count(src_node)) {
+        _reconnected_nodes.insert(src_node);
+    }
+    if (_node_map.count(dst_node)) {
+        _reconnected_nodes.insert(dst_node);
     }
 }
 
@@ -253,7 +278,39 @@ void graph_t::commit()
     if (_release_count == 0) {
         _check_topology();
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        resolve_all_properties(resolve_context::INIT, *boost::vertices(_graph).first);
+        if (!_initialized) {
+            // First commit: Run a full property resolution across all nodes
+            resolve_all_properties(resolve_context::INIT, *boost::vertices(_graph).first);
+            _initialized = true;
+            _reconnected_nodes.clear();
+            return;
+        }
+        // Re-commit: Only the subgraph affected by edge changes (or by
+        // properties that were modified while the graph was released) needs
+        // re-resolving. Nodes whose edges changed don't necessarily have
+        // dirty properties, so we forcibly mark their edge properties dirty
+        // to make sure they get re-propagated across the changed edges.
+        node_accessor_t node_accessor{};
+        prop_accessor_t prop_accessor{};
+        for (auto node : _reconnected_nodes) {
+            auto edge_props = node_accessor.filter_props(node, [](property_base_t* prop) {
+                return (prop->get_src_info().type == res_source_info::INPUT_EDGE
+                        || prop->get_src_info().type == res_source_info::OUTPUT_EDGE);
+            });
+            for (auto prop : edge_props) {
+                auto access = prop_accessor.get_scoped_prop_access(
+                    *prop, property_base_t::RW, prop->get_access_mode());
+                prop->force_dirty();
+            }
+        }
+        _reconnected_nodes.clear();
+        auto dirty_nodes = _find_dirty_nodes();
+        if (dirty_nodes.empty()) {
+            UHD_LOG_TRACE(
+                LOG_ID, "Skipping property resolution on re-commit, graph is clean.");
+            return;
+        }
+        resolve_all_properties(resolve_context::RECOMMIT, dirty_nodes.front());
     }
 }
 
@@ -376,6 +433,9 @@ void graph_t::resolve_all_properties(
         node_accessor.resolve_props(current_node);
         // Now mark all properties on this node as clean
         node_accessor.clean_props(current_node);
+        // The new values were not propagated to the neighbours, so remember
+        // this node for re-resolution on the next commit()
+        _reconnected_nodes.insert(current_node);
         return;
     }
 
@@ -394,7 +454,7 @@ void graph_t::_resolve_all_properties(resolve_context context,
 
     // First, find the node on which we'll start.
     auto initial_dirty_nodes = _find_dirty_nodes();
-    if (initial_dirty_nodes.size() > 1) {
+    if (initial_dirty_nodes.size() > 1 && context != resolve_context::RECOMMIT) {
         UHD_LOGGER_WARNING(LOG_ID)
             << "Found " << initial_dirty_nodes.size()
             << " dirty nodes in initial search (expected one or zero). "
@@ -454,8 +514,11 @@ void graph_t::_resolve_all_properties(resolve_context context,
         node_accessor.clean_props(current_node);
 
         // If the property resolution was triggered by a node updating one of
-        // its properties, we can stop anytime there are no more dirty nodes.
-        if (context == resolve_context::NODE_PROP && _find_dirty_nodes().empty()) {
+        // its properties, or by a re-commit of an already-initialized graph,
+        // we can stop anytime there are no more dirty nodes.
+        if ((context == resolve_context::NODE_PROP
+                || context == resolve_context::RECOMMIT)
+            && _find_dirty_nodes().empty()) {
             UHD_LOG_TRACE(LOG_ID,
                 "Terminating graph resolution early during iteration " << num_iterations);
             break;
@@ -561,6 +624,48 @@ void graph_t::enqueue_action(
     auto reset_handling_flag =
         uhd::utils::scope_exit::make([&]() { _action_handling_ongoing.clear(); });
 
+    _process_action_queue();
+
+    // Now, the _graph_mutex and _action_handling_ongoing are released, and
+    // someone else can start sending actions.
+}
+
+void graph_t::enqueue_actions(node_ref_t src_node,
+    const std::vector<std::pair<res_source_info, action_info::sptr>>& actions)
+{
+    // Like enqueue_action(), we hold the graph mutex for the entirety of the
+    // delivery, but we only take it once for the whole batch.
+    std::lock_guard<std::recursive_mutex> release_lock(_graph_mutex);
+    if (_shutdown) {
+        return;
+    }
+    if (_release_count) {
+        UHD_LOG_WARNING(LOG_ID,
+            "Action propagation is not enabled, graph is not committed! Will not "
+            "propagate batch of "
+                << actions.size() << " actions!");
+        return;
+    }
+
+    const bool handling_ongoing = _action_handling_ongoing.test_and_set();
+    for (const auto& action : actions) {
+        _action_queue.emplace_back(
+            std::make_tuple(src_node, action.first, action.second));
+    }
+    if (handling_ongoing) {
+        UHD_LOG_TRACE(LOG_ID,
+            "Action handling ongoing, deferring delivery of " << actions.size()
+                                                              << " batched actions");
+        return;
+    }
+    auto reset_handling_flag =
+        uhd::utils::scope_exit::make([&]() { _action_handling_ongoing.clear(); });
+
+    _process_action_queue();
+}
+
+void graph_t::_process_action_queue()
+{
     unsigned iteration_count = 0;
     while (!_action_queue.empty()) {
         if (iteration_count++ == MAX_ACTION_ITERATIONS) {
@@ -591,8 +696,9 @@ void graph_t::enqueue_action(
             if (recipient_node == nullptr) {
                 UHD_LOG_WARNING(LOG_ID,
                     "Cannot forward action "
-                        << action->key << " from " << src_node->get_unique_id() << ":"
-                        << src_edge.to_string() << ", no neighbour found!");
+                        << next_action_sptr->key << " from "
+                        << action_src_node->get_unique_id() << ":"
+                        << action_src_port.to_string() << ", no neighbour found!");
                 continue;
             }
             recipient_port = {res_source_info::invert_edge(action_src_port.type),
@@ -609,9 +715,6 @@ void graph_t::enqueue_action(
         node_accessor_t{}.send_action(recipient_node, recipient_port, next_action_sptr);
     }
     UHD_LOG_TRACE(LOG_ID, "Delivered all actions, terminating action handling.");
-
-    // Now, the _graph_mutex and _action_handling_ongoing are released, and
-    // someone else can start sending actions.
 }
 
 /******************************************************************************
@@ -664,6 +767,7 @@ void graph_t::_remove_node(node_ref_t node)
         // Remove the vertex
         boost::remove_vertex(vertex_desc, _graph);
         _node_map.erase(node);
+        _reconnected_nodes.erase(node);
 
         // Removing the vertex changes the vertex descriptors,
         // so update the node map
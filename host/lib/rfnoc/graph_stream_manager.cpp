@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -66,6 +67,14 @@ public:
         return retval;
     }
 
+    mgmt::mgmt_portal::sep_traffic_counters_t get_traffic_counters(sep_addr_t dst_addr,
+        uhd::transport::adapter_id_t adapter = uhd::transport::NULL_ADAPTER_ID) override
+    {
+        auto dev =
+            _check_dst_and_find_src(dst_addr, adapter, uhd::transport::link_type_t::CTRL);
+        return _link_mgrs.at(dev)->get_traffic_counters(dst_addr);
+    }
+
     sep_id_pair_t connect_host_to_device(sep_addr_t dst_addr,
         uhd::transport::adapter_id_t adapter = uhd::transport::NULL_ADAPTER_ID) override
     {
@@ -0,0 +1,337 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_block.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace uhd;
+using namespace uhd::rfnoc;
+
+namespace {
+
+//! Alignment of the inter-stage scratch buffers (one cache line, and wide
+// enough for any current SIMD load)
+constexpr size_t SIMD_ALIGNMENT = 64;
+
+/*! A byte buffer whose data pointer is SIMD_ALIGNMENT-aligned
+ *
+ * Over-allocates a plain vector and aligns the pointer manually, which is
+ * portable (std::aligned_alloc is not available everywhere we build).
+ */
+class aligned_buff_t
+{
+public:
+    //! Grow the buffer to hold at least \p nbytes; existing contents are
+    // discarded (the engine always refills from the start)
+    void resize(const size_t nbytes)
+    {
+        if (nbytes <= _capacity) {
+            return;
+        }
+        _storage.resize(nbytes + SIMD_ALIGNMENT - 1);
+        void* ptr    = _storage.data();
+        size_t space = _storage.size();
+        _data        = static_cast<char*>(
+            std::align(SIMD_ALIGNMENT, nbytes, ptr, space));
+        _capacity = nbytes;
+    }
+
+    char* data()
+    {
+        return _data;
+    }
+
+private:
+    std::vector<char> _storage;
+    char* _data      = nullptr;
+    size_t _capacity = 0;
+};
+
+/*! A small worker pool for per-channel processing tasks
+ *
+ * run() fans a task function out over [0, num_tasks) and blocks until all
+ * tasks have completed. The calling thread participates in draining the
+ * task queue, so a pool of N threads plus the recv() caller processes
+ * N + 1 channels concurrently, and a pool of zero threads degenerates to
+ * an inline loop with no synchronization overhead beyond the mutex.
+ */
+class worker_pool_t
+{
+public:
+    worker_pool_t(const size_t num_threads)
+    {
+        for (size_t i = 0; i < num_threads; i++) {
+            _threads.emplace_back([this]() { worker_loop(); });
+            uhd::set_thread_name(&_threads.back(), "uhd_host_block");
+        }
+    }
+
+    ~worker_pool_t()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv_work.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    //! Run \p task for every index in [0, num_tasks) and wait for
+    // completion. The first exception thrown by a task is rethrown here.
+    void run(const size_t num_tasks, const std::function<void(size_t)>& task)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _task        = &task;
+        _next_task   = 0;
+        _num_tasks   = num_tasks;
+        _outstanding = num_tasks;
+        _eptr        = nullptr;
+        if (!_threads.empty()) {
+            _cv_work.notify_all();
+        }
+        // The caller drains tasks alongside the pool
+        while (_next_task < _num_tasks) {
+            run_one_task(lock);
+        }
+        _cv_done.wait(lock, [this]() { return _outstanding == 0; });
+        _task = nullptr;
+        if (_eptr) {
+            std::rethrow_exception(_eptr);
+        }
+    }
+
+private:
+    void worker_loop()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _cv_work.wait(
+                lock, [this]() { return _stop || _next_task < _num_tasks; });
+            if (_stop) {
+                return;
+            }
+            run_one_task(lock);
+        }
+    }
+
+    //! Claim and run one task; must be called with the lock held, which is
+    // dropped for the duration of the task
+    void run_one_task(std::unique_lock<std::mutex>& lock)
+    {
+        const size_t index = _next_task++;
+        const auto* task   = _task;
+        lock.unlock();
+        std::exception_ptr eptr = nullptr;
+        try {
+            (*task)(index);
+        } catch (...) {
+            eptr = std::current_exception();
+        }
+        lock.lock();
+        if (eptr && !_eptr) {
+            _eptr = eptr;
+        }
+        if (--_outstanding == 0) {
+            _cv_done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _cv_work;
+    std::condition_variable _cv_done;
+    const std::function<void(size_t)>* _task = nullptr;
+    size_t _next_task                        = 0;
+    size_t _num_tasks                        = 0;
+    size_t _outstanding                      = 0;
+    std::exception_ptr _eptr                 = nullptr;
+    bool _stop                               = false;
+};
+
+class host_block_streamer_impl : public host_block_streamer
+{
+public:
+    host_block_streamer_impl(uhd::rx_streamer::sptr source,
+        std::vector<std::vector<host_block::sptr>> chains,
+        const size_t item_size,
+        const size_t num_threads)
+        : _source(std::move(source))
+        , _chains(std::move(chains))
+        , _item_size(item_size)
+        , _pool(num_threads)
+    {
+        if (_chains.size() != _source->get_num_channels()) {
+            throw uhd::value_error(
+                "host_block_streamer: Expected one chain per channel ("
+                + std::to_string(_source->get_num_channels()) + "), got "
+                + std::to_string(_chains.size()));
+        }
+        if (_item_size == 0) {
+            throw uhd::value_error("host_block_streamer: item_size must be non-zero");
+        }
+        _in_buffs.resize(_chains.size());
+        _pong_buffs.resize(_chains.size());
+        _out_nitems.resize(_chains.size());
+        _recv_ptrs.resize(_chains.size());
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _source->get_num_channels();
+    }
+
+    size_t get_max_num_samps() const override
+    {
+        return max_output_bound(_source->get_max_num_samps());
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        rx_metadata_t& metadata,
+        const double timeout  = 0.1,
+        const bool one_packet = false) override
+    {
+        // Pull no more input than the worst-case chain expansion still
+        // fits into the caller's buffers
+        const size_t in_nitems = max_input_nitems(nsamps_per_buff);
+        for (size_t chan = 0; chan < _chains.size(); chan++) {
+            if (_chains[chan].empty()) {
+                // Pass-through channels receive straight into the user
+                // buffer, no extra copy
+                _recv_ptrs[chan] = buffs[chan];
+            } else {
+                _in_buffs[chan].resize(in_nitems * _item_size);
+                _recv_ptrs[chan] = _in_buffs[chan].data();
+            }
+        }
+        const size_t num_recvd =
+            _source->recv(_recv_ptrs, in_nitems, metadata, timeout, one_packet);
+        if (num_recvd == 0) {
+            return 0;
+        }
+
+        // One task per channel; channels are independent by contract
+        _pool.run(_chains.size(), [this, &buffs, num_recvd](const size_t chan) {
+            _out_nitems[chan] = _chains[chan].empty()
+                                    ? num_recvd
+                                    : process_chain(chan, num_recvd, buffs[chan]);
+        });
+
+        // The chains must keep the channels sample-aligned
+        for (size_t chan = 1; chan < _chains.size(); chan++) {
+            if (_out_nitems[chan] != _out_nitems[0]) {
+                throw uhd::runtime_error(
+                    "host_block_streamer: Chains produced misaligned channels ("
+                    + std::to_string(_out_nitems[0]) + " vs. "
+                    + std::to_string(_out_nitems[chan]) + " items)");
+            }
+        }
+        return _out_nitems[0];
+    }
+
+    void issue_stream_cmd(const stream_cmd_t& stream_cmd) override
+    {
+        _source->issue_stream_cmd(stream_cmd);
+    }
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>& action,
+        const size_t port) override
+    {
+        _source->post_input_action(action, port);
+    }
+
+private:
+    //! Run channel \p chan's chain over \p in_nitems received items,
+    // copying the final result into \p user_buff. Returns the number of
+    // items produced.
+    size_t process_chain(const size_t chan, const size_t in_nitems, void* user_buff)
+    {
+        char* in        = _in_buffs[chan].data();
+        size_t nitems   = in_nitems;
+        size_t in_bound = in_nitems;
+        for (const auto& block : _chains[chan]) {
+            const size_t out_bound = block->get_output_bound(in_bound);
+            auto& pong             = _pong_buffs[chan];
+            pong.resize(out_bound * _item_size);
+            nitems = block->process(in, nitems, pong.data());
+            // The next stage reads from this stage's output; the freed
+            // input buffer becomes the next stage's output scratch
+            std::swap(_in_buffs[chan], pong);
+            in       = _in_buffs[chan].data();
+            in_bound = out_bound;
+        }
+        std::memcpy(user_buff, in, nitems * _item_size);
+        return nitems;
+    }
+
+    //! Worst-case output items over all chains for \p in_nitems input items
+    size_t max_output_bound(const size_t in_nitems) const
+    {
+        size_t max_bound = in_nitems;
+        for (const auto& chain : _chains) {
+            size_t bound = in_nitems;
+            for (const auto& block : chain) {
+                bound = block->get_output_bound(bound);
+            }
+            max_bound = std::max(max_bound, bound);
+        }
+        return max_bound;
+    }
+
+    //! Largest input item count whose worst-case output still fits into
+    // \p out_nitems; bounds are monotonic, so binary search
+    size_t max_input_nitems(const size_t out_nitems) const
+    {
+        if (max_output_bound(out_nitems) <= out_nitems) {
+            return out_nitems;
+        }
+        size_t lo = 0, hi = out_nitems;
+        while (lo < hi) {
+            const size_t mid = (lo + hi + 1) / 2;
+            if (max_output_bound(mid) <= out_nitems) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        return lo;
+    }
+
+    const uhd::rx_streamer::sptr _source;
+    const std::vector<std::vector<host_block::sptr>> _chains;
+    const size_t _item_size;
+    worker_pool_t _pool;
+    //! Per-channel stage input buffers; recv() fills them, then they
+    // ping-pong with _pong_buffs between stages
+    std::vector<aligned_buff_t> _in_buffs;
+    std::vector<aligned_buff_t> _pong_buffs;
+    std::vector<size_t> _out_nitems;
+    std::vector<void*> _recv_ptrs;
+};
+
+} // namespace
+
+host_block_streamer::sptr host_block_streamer::make(uhd::rx_streamer::sptr source,
+    std::vector<std::vector<host_block::sptr>> chains,
+    const size_t item_size,
+    const size_t num_threads)
+{
+    return std::make_shared<host_block_streamer_impl>(
+        std::move(source), std::move(chains), item_size, num_threads);
+}
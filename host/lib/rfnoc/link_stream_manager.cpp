@@ -148,6 +148,12 @@ public:
         return _mgmt_portal->get_reachable_endpoints();
     }
 
+    mgmt::mgmt_portal::sep_traffic_counters_t get_traffic_counters(
+        const sep_addr_t& addr) override
+    {
+        return _mgmt_portal->get_traffic_counters(*_ctrl_xport, addr);
+    }
+
     bool can_connect_device_to_device(
         sep_addr_t dst_addr, sep_addr_t src_addr) const override
     {
@@ -368,6 +374,25 @@ public:
         return data_xport;
     }
 
+    void reconnect_data_stream(chdr_rx_data_xport& xport) override
+    {
+        xport.reconnect(*_ctrl_xport);
+    }
+
+    void reconnect_data_stream(chdr_tx_data_xport& xport) override
+    {
+        xport.reconnect(*_ctrl_xport);
+    }
+
+    void failover_data_stream(chdr_rx_data_xport& xport) override
+    {
+        // Re-point the transport at its pre-opened standby links, then re-arm
+        // the SEP over the management link; the mgmt handshake teaches the
+        // device's transport adapters the new return route for the stream
+        xport.failover();
+        xport.reconnect(*_ctrl_xport);
+    }
+
 private:
     void _ensure_ep_is_reachable(const sep_addr_t& ep_addr_)
     {
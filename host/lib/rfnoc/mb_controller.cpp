@@ -11,7 +11,10 @@
 #include <boost/format.hpp>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <future>
+#include <list>
+#include <mutex>
 #include <thread>
 #include <tuple>
 
@@ -241,6 +244,79 @@ void mb_controller::timekeeper::set_tick_rate(const double tick_rate)
     set_period(period_ns);
 }
 
+void mb_controller::timekeeper::update_clock_model()
+{
+    const auto t0        = std::chrono::steady_clock::now();
+    const uint64_t ticks = get_ticks_now();
+    const auto t1        = std::chrono::steady_clock::now();
+    // Pair the reading with the midpoint of the round trip, which is the
+    // best available estimate of when the device sampled its counter
+    _fold_clock_observation(t0 + (t1 - t0) / 2,
+        std::chrono::system_clock::now(),
+        time_spec_t::from_ticks(ticks, _tick_rate).get_real_secs());
+}
+
+void mb_controller::timekeeper::observe_device_time(const uhd::time_spec_t& device_time)
+{
+    _fold_clock_observation(std::chrono::steady_clock::now(),
+        std::chrono::system_clock::now(),
+        device_time.get_real_secs());
+}
+
+void mb_controller::timekeeper::_fold_clock_observation(
+    const std::chrono::steady_clock::time_point host_time,
+    const std::chrono::system_clock::time_point system_time,
+    const double device_secs)
+{
+    // Minimum baseline before the drift quotient is meaningful
+    constexpr double MIN_DRIFT_BASELINE = 0.1;
+    // Larger apparent drifts than this mean the device time jumped (e.g.,
+    // set_time_now() was called), not that the reference drifted
+    constexpr double MAX_DRIFT_PPM = 100.0;
+
+    std::lock_guard<std::mutex> lock(_clock_model_mutex);
+    if (_clock_model_obs == 0) {
+        _host_first   = host_time;
+        _device_first = device_secs;
+    } else {
+        const double baseline =
+            std::chrono::duration<double>(host_time - _host_first).count();
+        if (baseline >= MIN_DRIFT_BASELINE) {
+            const double drift = (device_secs - _device_first) / baseline;
+            if (std::abs(drift - 1.0) * 1e6 > MAX_DRIFT_PPM) {
+                // The device time is discontinuous w.r.t. the model; restart
+                // from this observation
+                _clock_model_obs = 0;
+                _host_first      = host_time;
+                _device_first    = device_secs;
+                _clock_drift     = 1.0;
+            } else {
+                _clock_drift = drift;
+            }
+        }
+    }
+    _host_latest   = host_time;
+    _system_latest = system_time;
+    _device_latest = device_secs;
+    _clock_model_obs++;
+}
+
+std::chrono::system_clock::time_point mb_controller::timekeeper::device_time_to_host_time(
+    const uhd::time_spec_t& device_time)
+{
+    std::lock_guard<std::mutex> lock(_clock_model_mutex);
+    if (_clock_model_obs == 0) {
+        throw uhd::runtime_error(
+            "device_time_to_host_time(): clock model has no observations, call "
+            "update_clock_model() first");
+    }
+    const double host_delta =
+        (device_time.get_real_secs() - _device_latest) / _clock_drift;
+    return _system_latest
+           + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+               std::chrono::duration<double>(host_delta));
+}
+
 size_t mb_controller::get_num_timekeepers() const
 {
     return _timekeepers.size();
@@ -261,6 +337,15 @@ void mb_controller::register_timekeeper(const size_t idx, timekeeper::sptr tk)
     _timekeepers.emplace(idx, std::move(tk));
 }
 
+std::map<std::string, uhd::sensor_value_t> mb_controller::get_sensors()
+{
+    std::map<std::string, uhd::sensor_value_t> sensors;
+    for (const auto& name : get_sensor_names()) {
+        sensors.emplace(name, get_sensor(name));
+    }
+    return sensors;
+}
+
 std::vector<std::string> mb_controller::get_gpio_banks() const
 {
     return {};
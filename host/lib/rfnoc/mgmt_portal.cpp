@@ -12,12 +12,19 @@
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <uhdlib/utils/prefs.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <fstream>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -48,9 +55,9 @@ constexpr uint16_t REG_OSTRM_FC_HEADROOM       = 0x1C; // W
 constexpr uint16_t REG_OSTRM_BUFF_CAP_BYTES_LO = 0x20; // R
 constexpr uint16_t REG_OSTRM_BUFF_CAP_BYTES_HI = 0x24; // R
 constexpr uint16_t REG_OSTRM_BUFF_CAP_PKTS     = 0x28; // R
-// constexpr uint16_t REG_OSTRM_SEQ_ERR_CNT       = 0x2C; // R
-// constexpr uint16_t REG_OSTRM_DATA_ERR_CNT      = 0x30; // R
-// constexpr uint16_t REG_OSTRM_ROUTE_ERR_CNT     = 0x34; // R
+constexpr uint16_t REG_OSTRM_SEQ_ERR_CNT       = 0x2C; // R
+constexpr uint16_t REG_OSTRM_DATA_ERR_CNT      = 0x30; // R
+constexpr uint16_t REG_OSTRM_ROUTE_ERR_CNT     = 0x34; // R
 constexpr uint16_t REG_ISTRM_CTRL_STATUS = 0x38; // RW
 constexpr uint16_t REG_OSTRM_THROTTLE    = 0x3C; // W
 
@@ -84,6 +91,88 @@ constexpr uint32_t STRM_STATUS_FC_ENABLED    = 0x80000000;
 constexpr uint32_t STRM_STATUS_SETUP_ERR     = 0x40000000;
 constexpr uint32_t STRM_STATUS_SETUP_PENDING = 0x20000000;
 
+//! Return true if the user opted into the persisted topology cache
+bool topo_cache_enabled()
+{
+    return uhd::cast::from_str<bool>(
+        uhd::prefs::get_uhd_config().get<std::string>("rfnoc", "topology_cache", "0"));
+}
+
+//! Location of the persisted topology cache for this protocol/CHDR width
+boost::filesystem::path topo_cache_path(const uint16_t protover, const chdr_w_t chdr_w)
+{
+    const std::string filename = "topo_cache_" + std::to_string(protover) + "_"
+                                 + std::to_string(chdr_w_to_bits(chdr_w)) + ".conf";
+    return uhd::get_xdg_data_home() / "uhd" / filename;
+}
+
+//! Device-ID independent signature of a discovered node. Device IDs are
+// assigned at runtime and thus cannot be part of a value that persists
+// across sessions.
+std::string topo_node_signature(const topo_node_t& node)
+{
+    return std::to_string(static_cast<int>(node.type)) + "."
+           + std::to_string(node.inst) + "." + std::to_string(node.extended_info);
+}
+
+//! Signature of a probed discovery path (source node plus output port)
+std::string topo_path_signature(const topo_node_t& node, const topo_edge_t::port_t port)
+{
+    return topo_node_signature(node) + ":" + std::to_string(port);
+}
+
+//! Load the persisted topology cache. Returns false if there is no usable
+// cache file.
+bool load_topo_cache(const uint16_t protover,
+    const chdr_w_t chdr_w,
+    std::set<std::string>& empty_paths,
+    std::string& fingerprint)
+{
+    std::ifstream file(topo_cache_path(protover, chdr_w).string());
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.rfind("fingerprint=", 0) == 0) {
+            fingerprint = line.substr(std::string("fingerprint=").length());
+        } else if (line.rfind("empty=", 0) == 0) {
+            empty_paths.insert(line.substr(std::string("empty=").length()));
+        }
+    }
+    return !fingerprint.empty();
+}
+
+//! Persist the topology cache. Failure to write is not an error; the cache
+// is purely an optimization.
+void save_topo_cache(const uint16_t protover,
+    const chdr_w_t chdr_w,
+    const std::set<std::string>& empty_paths,
+    const std::string& fingerprint)
+{
+    try {
+        const auto path = topo_cache_path(protover, chdr_w);
+        boost::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path.string(), std::ios::trunc);
+        file << "fingerprint=" << fingerprint << std::endl;
+        for (const auto& path_sig : empty_paths) {
+            file << "empty=" << path_sig << std::endl;
+        }
+    } catch (...) {
+        UHD_LOG_DEBUG(LOG_ID, "Unable to write topology cache. Ignoring.");
+    }
+}
+
+//! Remove the persisted topology cache. Failure to remove is not an error.
+void remove_topo_cache(const uint16_t protover, const chdr_w_t chdr_w)
+{
+    try {
+        boost::filesystem::remove(topo_cache_path(protover, chdr_w));
+    } catch (...) {
+        UHD_LOG_DEBUG(LOG_ID, "Unable to remove topology cache.");
+    }
+}
+
 } // namespace
 
 
@@ -183,6 +272,7 @@ public:
         // Create a node ID from lookup info
         topo_node_t lookup_node(addr);
         if (!_tgraph->has_route(_my_node_id, lookup_node)) {
+            _invalidate_topo_cache();
             throw uhd::lookup_error(
                 "register_endpoint(): Cannot reach node with specified address: "
                 + std::to_string(addr.first) + ":" + std::to_string(addr.second));
@@ -236,6 +326,59 @@ public:
         return retval;
     }
 
+    sep_traffic_counters_t get_traffic_counters(
+        chdr_ctrl_xport& xport, const sep_addr_t& addr) override
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        auto my_epid        = xport.get_epid();
+        const auto dst_node = _get_sep_node(addr);
+
+        // Build a management transaction to first get to the node
+        mgmt_payload status_xact;
+        status_xact.set_header(my_epid, _protover, _chdr_w);
+        _traverse_to_node(status_xact, dst_node, my_epid);
+
+        // Read all the counter registers in one sweep
+        mgmt_hop_t cfg_hop;
+        cfg_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_CFG_RD_REQ,
+            mgmt_op_t::cfg_payload(REG_OSTRM_SEQ_ERR_CNT)));
+        cfg_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_CFG_RD_REQ,
+            mgmt_op_t::cfg_payload(REG_OSTRM_DATA_ERR_CNT)));
+        cfg_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_CFG_RD_REQ,
+            mgmt_op_t::cfg_payload(REG_OSTRM_ROUTE_ERR_CNT)));
+        cfg_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
+        status_xact.add_hop(cfg_hop);
+
+        // Send the transaction, receive a response and validate it
+        const mgmt_payload resp_xact = _send_recv_mgmt_transaction(xport, status_xact);
+        if (resp_xact.get_num_hops() != 1) {
+            throw uhd::op_failed("Management operation failed. Incorrect format (hops).");
+        }
+        const mgmt_hop_t& rhop = resp_xact.get_hop(0);
+        if (rhop.get_num_ops() < 2
+            || rhop.get_op(0).get_op_code() != mgmt_op_t::MGMT_OP_NOP) {
+            throw uhd::op_failed(
+                "Management operation failed. Incorrect format (operations).");
+        }
+        for (size_t i = 1; i < rhop.get_num_ops(); i++) {
+            if (rhop.get_op(i).get_op_code() != mgmt_op_t::MGMT_OP_CFG_RD_RESP) {
+                throw uhd::op_failed(
+                    "Management operation failed. Incorrect format (operations).");
+            }
+        }
+
+        // Extract peek data from transaction
+        mgmt_op_t::cfg_payload seq_err_pl   = rhop.get_op(1).get_op_payload();
+        mgmt_op_t::cfg_payload data_err_pl  = rhop.get_op(2).get_op_payload();
+        mgmt_op_t::cfg_payload route_err_pl = rhop.get_op(3).get_op_payload();
+
+        sep_traffic_counters_t counters;
+        counters.seq_err_count   = static_cast<uint32_t>(seq_err_pl.data);
+        counters.data_err_count  = static_cast<uint32_t>(data_err_pl.data);
+        counters.route_err_count = static_cast<uint32_t>(route_err_pl.data);
+        return counters;
+    }
+
     void setup_local_route(chdr_ctrl_xport& xport, const sep_id_t& dst_epid) override
     {
         using node_type = topo_node_t::node_type;
@@ -638,6 +781,29 @@ private: // Functions
         std::queue<std::pair<topo_node_t, port_t>> pending_paths;
         const auto my_epid = xport.get_epid();
 
+        // The topology cache remembers which optional paths turned out to be
+        // empty in a previous session so we don't have to pay a full receive
+        // timeout re-probing each of them. Every node that does exist is
+        // still probed and initialized; only known-dead-end probes are
+        // skipped. A fingerprint over the discovered nodes invalidates the
+        // cache when the topology changes (e.g. a new FPGA image). Note that
+        // the fingerprint cannot see a node that appears on a path the cache
+        // skipped (it never gets discovered), so a later lookup failure also
+        // invalidates the cache; see _invalidate_topo_cache().
+        const bool use_cache = topo_cache_enabled();
+        std::set<std::string> cached_empty_paths;
+        std::string cached_fingerprint;
+        if (use_cache) {
+            if (load_topo_cache(
+                    _protover, _chdr_w, cached_empty_paths, cached_fingerprint)) {
+                UHD_LOG_DEBUG(LOG_ID,
+                    "Loaded topology cache with " << cached_empty_paths.size()
+                                                  << " known-empty paths");
+            }
+        }
+        std::set<std::string> empty_paths;
+        std::vector<std::string> node_sigs;
+
         // Add ourselves to the the pending queue to kick off the search
         UHD_LOG_DEBUG(
             LOG_ID, "Starting topology discovery from " << _my_node_id.to_string());
@@ -649,6 +815,20 @@ private: // Functions
             pending_paths.pop();
             const auto& next_node = next_path.first;
 
+            // Skip paths the cache recorded as empty (probing one costs a
+            // full receive timeout). Mandatory paths (port < 0) are always
+            // probed.
+            const std::string path_sig =
+                topo_path_signature(next_node, next_path.second);
+            if (next_path.second >= 0 && cached_empty_paths.count(path_sig)) {
+                UHD_LOG_TRACE(LOG_ID,
+                    "Topology cache: Skipping known-empty path "
+                        << next_node.to_string() << "->" << next_path.second);
+                empty_paths.insert(path_sig);
+                _topo_cache_paths_skipped = true;
+                continue;
+            }
+
             // Build a management transaction to first get to our destination so that we
             // can ask it to identify itself
             mgmt_payload route_xact;
@@ -689,6 +869,7 @@ private: // Functions
                         "Nothing connected on " << next_path.first.to_string() << "->"
                                                 << next_path.second
                                                 << ". Ignoring that path.");
+                    empty_paths.insert(path_sig);
                     continue;
                 }
             }
@@ -722,6 +903,7 @@ private: // Functions
                 continue;
             }
             UHD_LOG_DEBUG(LOG_ID, "Discovered node " << new_node.to_string());
+            node_sigs.push_back(topo_node_signature(new_node));
 
             // Initialize the node (first time config)
             mgmt_payload init_req_xact(route_xact);
@@ -773,6 +955,33 @@ private: // Functions
             }
             // That's it! Now go check the next path.
         }
+
+        if (use_cache) {
+            // Fingerprint the topology we just discovered. The sort makes the
+            // fingerprint independent of discovery order.
+            std::sort(node_sigs.begin(), node_sigs.end());
+            std::string all_sigs;
+            for (const auto& sig : node_sigs) {
+                all_sigs += sig + ";";
+            }
+            const std::string fingerprint =
+                std::to_string(std::hash<std::string>{}(all_sigs));
+            if (cached_fingerprint.empty()) {
+                save_topo_cache(_protover, _chdr_w, empty_paths, fingerprint);
+                UHD_LOG_DEBUG(LOG_ID,
+                    "Saved topology cache with " << empty_paths.size()
+                                                 << " known-empty paths");
+            } else if (fingerprint != cached_fingerprint) {
+                // The topology changed since the cache was written. The
+                // skipped paths from this session may have been stale, so
+                // drop the cache; the next session will probe all paths.
+                UHD_LOG_WARNING(LOG_ID,
+                    "The discovered topology does not match the cached one. "
+                    "Invalidating the topology cache; the next session will "
+                    "probe all paths.");
+                remove_topo_cache(_protover, _chdr_w);
+            }
+        }
     }
 
     //! Add hops to the management transaction to reach the specified node
@@ -1056,6 +1265,26 @@ private: // Functions
         transaction.add_hop(init_hop);
     }
 
+    //! Invalidate the topology cache after a lookup failed against a graph
+    // that was discovered with cached paths skipped.
+    //
+    // A node that appeared on a previously-empty path is invisible to the
+    // node fingerprint: its probe was skipped, so it was never discovered
+    // and the fingerprint still matches the cache. A failed lookup is the
+    // first signal that this happened. Dropping the cache file makes the
+    // next session probe all paths again.
+    void _invalidate_topo_cache() const
+    {
+        if (!_topo_cache_paths_skipped) {
+            return;
+        }
+        UHD_LOG_WARNING(LOG_ID,
+            "A node lookup failed on a topology that was discovered with "
+            "cached paths skipped. Invalidating the topology cache; the next "
+            "session will probe all paths.");
+        remove_topo_cache(_protover, _chdr_w);
+    }
+
     //! Returns the node object for a given stream endpoint ID (virtual or non-virtual)
     topo_node_t _get_sep_node(const sep_id_t& epid) const
     {
@@ -1072,6 +1301,7 @@ private: // Functions
                                     + std::to_string(epid));
         }
         if (nodes.empty()) {
+            _invalidate_topo_cache();
             throw uhd::lookup_error("mgmt_portal::_get_sep_node(): Could not find a "
                                     "stream endpoint with specified EPID "
                                     + std::to_string(epid));
@@ -1095,6 +1325,7 @@ private: // Functions
                 + std::to_string(addr.first) + ":" + std::to_string(addr.second));
         }
         if (nodes.empty()) {
+            _invalidate_topo_cache();
             throw uhd::lookup_error("mgmt_portal::_get_sep_node(): Could not find a "
                                     "stream endpoint with address "
                                     + std::to_string(addr.first) + ":"
@@ -1174,6 +1405,8 @@ private: // Members
     std::map<uint8_t, xport_cfg_fn_t> _rtcfg_cfg_fns;
     // Reference to the topology graph
     topo_graph_t::sptr _tgraph;
+    // True if topology discovery skipped any paths based on the cache
+    bool _topo_cache_paths_skipped = false;
     // Mutex that protects all state in this class
     mutable std::recursive_mutex _mutex;
 }; // class mgmt_portal_impl
@@ -23,7 +23,7 @@ uhd::rfnoc::mock_block_container uhd::rfnoc::get_mock_block(const noc_id_t noc_i
     std::shared_ptr<mock_reg_iface_t> client_reg_iface,
     mb_controller::sptr mbc)
 {
-    block_factory_info_t fac_info = factory::get_block_factory(noc_id, device_id);
+    const block_factory_info_t& fac_info = factory::get_block_factory(noc_id, device_id);
 
     mock_block_container ret_val;
     ret_val.factory   = fac_info.factory_fn;
@@ -84,6 +84,74 @@ void node_t::set_properties(const uhd::device_addr_t& props, const size_t instan
     resolve_all();
 }
 
+node_t::prop_snapshot_t node_t::snapshot_props()
+{
+    std::lock_guard<std::mutex> _l(_prop_mutex);
+    prop_snapshot_t snapshot;
+    if (_props.count(res_source_info::USER) == 0) {
+        return snapshot;
+    }
+    for (auto prop : _props.at(res_source_info::USER)) {
+        if (!prop->is_valid()) {
+            continue;
+        }
+        snapshot.push_back(prop->clone(prop->get_src_info()));
+    }
+    return snapshot;
+}
+
+void node_t::restore_props(const prop_snapshot_t& snapshot)
+{
+    prop_accessor_t prop_accessor{};
+    {
+        std::lock_guard<std::mutex> _l(_prop_mutex);
+        for (const auto& src_prop : snapshot) {
+            property_base_t* dst_prop =
+                _find_property(src_prop->get_src_info(), src_prop->get_id());
+            if (!dst_prop) {
+                RFNOC_LOG_WARNING("restore_props() cannot restore property `"
+                                  << src_prop->get_id() << "': No such property.");
+                continue;
+            }
+            if (src_prop->equal(dst_prop)) {
+                // Already in the desired state, don't mark it dirty
+                continue;
+            }
+            prop_accessor.forward<false>(src_prop.get(), dst_prop);
+        }
+    }
+
+    // Now trigger a single property resolution. If other properties depend on
+    // modified properties, they will be updated.
+    resolve_all();
+}
+
+void node_t::set_fast_property(
+    const std::string& id, const double val, const size_t instance)
+{
+    const auto slot_it = _fast_props.find(_fast_prop_key(id, instance));
+    if (slot_it == _fast_props.end()) {
+        throw uhd::lookup_error(str(
+            boost::format("[%s] Unknown fast property: `%s'") % get_unique_id() % id));
+    }
+    auto& slot = *slot_it->second;
+    slot.value.store(val);
+    slot.pending.store(true);
+    if (slot.apply_fn) {
+        slot.apply_fn(val);
+    }
+}
+
+double node_t::get_fast_property(const std::string& id, const size_t instance) const
+{
+    const auto slot_it = _fast_props.find(_fast_prop_key(id, instance));
+    if (slot_it == _fast_props.end()) {
+        throw uhd::lookup_error(str(
+            boost::format("[%s] Unknown fast property: `%s'") % get_unique_id() % id));
+    }
+    return slot_it->second->value.load();
+}
+
 void node_t::set_command_time(uhd::time_spec_t time, const size_t instance)
 {
     if (_cmd_timespecs.size() <= instance) {
@@ -137,6 +205,24 @@ void node_t::register_property(property_base_t* prop, resolve_callback_t&& clean
     prop_accessor_t{}.set_access(prop, property_base_t::RW);
 }
 
+void node_t::register_property(property_t<double>* prop,
+    fast_prop_fn_t&& apply_fn,
+    resolve_callback_t&& clean_callback)
+{
+    register_property(prop, std::move(clean_callback));
+
+    auto slot      = std::make_unique<fast_prop_slot_t>();
+    slot->prop     = prop;
+    slot->apply_fn = std::move(apply_fn);
+    if (prop->is_valid()) {
+        slot->value.store(prop->get());
+    }
+
+    std::lock_guard<std::mutex> _l(_prop_mutex);
+    _fast_props[_fast_prop_key(prop->get_id(), prop->get_src_info().instance)] =
+        std::move(slot);
+}
+
 void node_t::add_property_resolver(
     prop_ptrs_t&& inputs, prop_ptrs_t&& outputs, resolver_fn_t&& resolver_fn)
 {
@@ -203,6 +289,19 @@ void node_t::post_action(const res_source_info& edge_info, action_info::sptr act
     _post_action_cb(edge_info, action);
 }
 
+void node_t::post_actions(const action_batch_t& actions)
+{
+    if (_post_actions_cb) {
+        _post_actions_cb(actions);
+        return;
+    }
+    // No batch callback available (e.g., node not connected to a graph):
+    // Fall back to posting one action at a time
+    for (const auto& action : actions) {
+        _post_action_cb(action.first, action.second);
+    }
+}
+
 bool node_t::check_topology(const std::vector<size_t>& connected_inputs,
     const std::vector<size_t>& connected_outputs)
 {
@@ -429,6 +528,10 @@ void node_t::init_props()
 
 void node_t::resolve_props()
 {
+    // Pick up any lock-free fast-property updates before collecting the
+    // dirty properties, so their dependents resolve in this pass
+    _reconcile_fast_props();
+
     prop_accessor_t prop_accessor{};
     const prop_ptrs_t initial_dirty_props =
         filter_props([](property_base_t* prop) { return prop->is_dirty(); });
@@ -504,6 +607,26 @@ void node_t::clean_props()
 }
 
 
+void node_t::_reconcile_fast_props()
+{
+    prop_accessor_t prop_accessor{};
+    for (auto& slot_pair : _fast_props) {
+        auto& slot = *slot_pair.second;
+        if (slot.pending.exchange(false)) {
+            // A lock-free update happened since the last resolution: Copy it
+            // into the backing property so it becomes dirty and dependent
+            // properties get resolved
+            auto prop_access =
+                prop_accessor.get_scoped_prop_access(*slot.prop, property_base_t::RW);
+            slot.prop->set(slot.value.load());
+        } else if (slot.prop->is_valid()) {
+            // Keep the shadow value in sync with slow-path updates
+            slot.value.store(slot.prop->get());
+        }
+    }
+}
+
+
 void node_t::forward_edge_property(
     property_base_t* incoming_prop, const size_t incoming_port)
 {
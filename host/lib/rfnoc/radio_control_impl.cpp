@@ -5,6 +5,7 @@
 //
 
 #include <uhd/exception.hpp>
+#include <uhd/features/cmd_queue_status_iface.hpp>
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhd/rfnoc/multichan_register_iface.hpp>
 #include <uhd/rfnoc/register_iface.hpp>
@@ -32,6 +33,38 @@ static constexpr double OVERRUN_RESTART_DELAY = 0.05;
 // conservatively set to to ensure compatibility with most blocks by default.
 static constexpr uint32_t DEFAULT_MULT = 64;
 
+namespace {
+//! Command queue status feature, backed by the flow control state of the
+// radio's register interface
+class cmd_queue_status_impl : public uhd::features::cmd_queue_status_iface
+{
+public:
+    cmd_queue_status_impl(uhd::rfnoc::register_iface_holder& reg_iface_holder)
+        : _reg_iface_holder(reg_iface_holder)
+    {
+    }
+
+    size_t get_cmd_queue_occupancy() override
+    {
+        return _reg_iface_holder.regs().get_cmd_buff_occupancy();
+    }
+
+    size_t get_cmd_queue_capacity() override
+    {
+        return _reg_iface_holder.regs().get_cmd_buff_capacity();
+    }
+
+    void set_enqueue_timeout(const double timeout) override
+    {
+        _reg_iface_holder.regs().set_policy(
+            "default", uhd::device_addr_t("timeout=" + std::to_string(timeout)));
+    }
+
+private:
+    uhd::rfnoc::register_iface_holder& _reg_iface_holder;
+};
+} // namespace
+
 /****************************************************************************
  * Structors
  ***************************************************************************/
@@ -60,6 +93,8 @@ radio_control_impl::radio_control_impl(make_args_ptr make_args)
     set_prop_forwarding_policy(forwarding_policy_t::DROP);
     set_action_forwarding_policy(forwarding_policy_t::DROP);
     set_mtu_forwarding_policy(forwarding_policy_t::DROP);
+    register_feature(std::make_shared<cmd_queue_status_impl>(
+        static_cast<uhd::rfnoc::register_iface_holder&>(*this)));
     register_action_handler(ACTION_KEY_STREAM_CMD,
         [this](const res_source_info& src, action_info::sptr action) {
             stream_cmd_action_info::sptr stream_cmd_action =
@@ -11,6 +11,7 @@
 #include <uhd/rfnoc/registry.hpp>
 #include <uhd/utils/static.hpp>
 #include <uhdlib/rfnoc/factory.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
 #include <iomanip>
@@ -106,22 +107,37 @@ void registry::register_block_descriptor(
 /******************************************************************************
  * Factory functions
  *****************************************************************************/
-block_factory_info_t factory::get_block_factory(noc_id_t noc_id, device_type_t device_id)
+const block_factory_info_t& factory::get_block_factory(
+    noc_id_t noc_id, device_type_t device_id)
 {
     // First, check the descriptor registry
     // FIXME TODO
 
-    // Second, check the direct registry
-    block_device_pair_t key{noc_id, device_id};
+    // Second, check the direct registry. The lookup is tiered, one hash
+    // probe each: exact (noc_id, device_id) match first, then the
+    // device-agnostic registration for this noc_id, then the default block.
+    auto& reg = get_direct_block_registry();
 
-    if (!get_direct_block_registry().count(key)) {
-        key = block_device_pair_t(noc_id, ANY_DEVICE);
+    auto it = reg.find(block_device_pair_t(noc_id, device_id));
+    if (it != reg.end()) {
+        return it->second;
+    }
+    it = reg.find(block_device_pair_t(noc_id, ANY_DEVICE));
+    if (it != reg.end()) {
+        return it->second;
+    }
+    // The block may come from a module whose loading is deferred until a
+    // factory from it is first requested; load them and look again
+    uhd::load_deferred_modules();
+    it = reg.find(block_device_pair_t(noc_id, device_id));
+    if (it == reg.end()) {
+        it = reg.find(block_device_pair_t(noc_id, ANY_DEVICE));
     }
-    if (!get_direct_block_registry().count(key)) {
-        UHD_LOG_WARNING("RFNOC::BLOCK_FACTORY",
-            "Could not find block with Noc-ID " << std::hex << "0x" << key.first << ", 0x"
-                                                << key.second << std::dec);
-        key = block_device_pair_t(DEFAULT_NOC_ID, ANY_DEVICE);
+    if (it != reg.end()) {
+        return it->second;
     }
-    return get_direct_block_registry().at(key);
+    UHD_LOG_WARNING("RFNOC::BLOCK_FACTORY",
+        "Could not find block with Noc-ID " << std::hex << "0x" << noc_id << ", 0x"
+                                            << device_id << std::dec);
+    return reg.at(block_device_pair_t(DEFAULT_NOC_ID, ANY_DEVICE));
 }
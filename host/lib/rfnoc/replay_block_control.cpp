@@ -16,7 +16,10 @@
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/compat_check.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <algorithm>
+#include <chrono>
 #include <string>
+#include <thread>
 
 using namespace uhd::rfnoc;
 
@@ -233,6 +236,58 @@ public:
         _replay_reg_iface.poke32(REG_REC_RESTART_ADDR, 0, port);
     }
 
+    void upload(uhd::tx_streamer::sptr tx_stream,
+        const void* buff,
+        const uint64_t size,
+        const uint64_t offset,
+        const size_t port,
+        const double timeout) override
+    {
+        UHD_ASSERT_THROW(tx_stream);
+        if (tx_stream->get_num_channels() != 1) {
+            throw uhd::value_error("upload() requires a single-channel TX streamer");
+        }
+        const size_t item_size = get_record_item_size(port);
+        if (size % item_size != 0) {
+            throw uhd::value_error("upload() size must be a multiple of the item size");
+        }
+        const auto end_time = std::chrono::steady_clock::now()
+                              + std::chrono::microseconds(int64_t(timeout * 1e6));
+
+        // Arm the record buffer
+        record(offset, size, port);
+
+        // Stream the data in MTU-sized chunks. Fullness is deliberately not
+        // polled in this loop; transport flow control paces the sends, and the
+        // final fullness is verified once everything has been handed to the
+        // transport.
+        const size_t max_samps = tx_stream->get_max_num_samps();
+        const char* data       = static_cast<const char*>(buff);
+        size_t items_left      = size / item_size;
+        uhd::tx_metadata_t md;
+        md.start_of_burst = true;
+        while (items_left > 0) {
+            const size_t num_samps = std::min(items_left, max_samps);
+            md.end_of_burst        = (num_samps == items_left);
+            const size_t num_sent  = tx_stream->send(data, num_samps, md, timeout);
+            if (num_sent == 0) {
+                throw uhd::op_timeout("upload() timed out sending data");
+            }
+            md.start_of_burst = false;
+            data += num_sent * item_size;
+            items_left -= num_sent;
+        }
+
+        // Wait for the final bytes to drain into the memory
+        while (get_record_fullness(port) < size) {
+            if (std::chrono::steady_clock::now() > end_time) {
+                throw uhd::op_timeout(
+                    "upload() timed out waiting for data to be committed to memory");
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
     void play(const uint64_t offset,
         const uint64_t size,
         const size_t port,
@@ -249,6 +304,50 @@ public:
         issue_stream_cmd(play_cmd, port);
     }
 
+    void play_queued(
+        const std::vector<play_command_t>& commands, const size_t port) override
+    {
+        if (commands.empty()) {
+            return;
+        }
+        // A repeating entry never completes on its own, so anything queued
+        // behind it would only execute after a stop
+        for (size_t i = 0; i + 1 < commands.size(); i++) {
+            if (commands[i].repeat) {
+                throw uhd::value_error(
+                    "[Replay] Only the final entry of a queued play sequence may "
+                    "repeat");
+            }
+        }
+        // Reserve command queue space for the entire sequence up front so we
+        // never queue a partial sequence
+        if (_fpga_compat >= 0x00010001
+            and get_play_cmd_fifo_space(port) < commands.size()) {
+            throw uhd::op_failed(
+                "[Replay] Play command queue does not have space for the "
+                "requested sequence");
+        }
+        for (size_t i = 0; i < commands.size(); i++) {
+            const auto& command = commands[i];
+            const bool last     = (i + 1 == commands.size());
+            config_play(command.offset, command.size, port);
+            // The hardware latches the playback region when the command is
+            // queued, so the next entry's config_play() does not disturb
+            // commands that are already in the queue. Intermediate entries
+            // suppress the end-of-burst flag so that the downstream block
+            // sees the sequence as one uninterrupted burst.
+            uhd::stream_cmd_t play_cmd = uhd::stream_cmd_t(
+                last ? (command.repeat
+                            ? uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS
+                            : uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE)
+                     : uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_MORE);
+            play_cmd.num_samps  = command.size / get_play_item_size(port);
+            play_cmd.time_spec  = command.time_spec;
+            play_cmd.stream_now = (command.time_spec == 0.0);
+            issue_stream_cmd(play_cmd, port);
+        }
+    }
+
     void stop(const size_t port) override
     {
         uhd::stream_cmd_t stop_cmd =
@@ -256,6 +355,41 @@ public:
         issue_stream_cmd(stop_cmd, port);
     }
 
+    void download(uhd::rx_streamer::sptr rx_stream,
+        void* buff,
+        const uint64_t size,
+        const uint64_t offset,
+        const size_t port,
+        const double timeout) override
+    {
+        UHD_ASSERT_THROW(rx_stream);
+        if (rx_stream->get_num_channels() != 1) {
+            throw uhd::value_error("download() requires a single-channel RX streamer");
+        }
+        const size_t item_size = get_play_item_size(port);
+        if (size % item_size != 0) {
+            throw uhd::value_error(
+                "download() size must be a multiple of the item size");
+        }
+
+        // Play back the requested region once
+        play(offset, size, port, uhd::time_spec_t(0.0), false);
+
+        char* data        = static_cast<char*>(buff);
+        size_t items_left = size / item_size;
+        uhd::rx_metadata_t md;
+        while (items_left > 0) {
+            const size_t num_rcvd = rx_stream->recv(data, items_left, md, timeout);
+            if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                throw uhd::op_timeout("download() timed out receiving data");
+            } else if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+                throw uhd::op_failed("download() receive error: " + md.strerror());
+            }
+            data += num_rcvd * item_size;
+            items_left -= num_rcvd;
+        }
+    }
+
     uint64_t get_mem_size() const override
     {
         return _mem_size;
@@ -334,6 +468,19 @@ public:
         return _replay_reg_iface.peek64(REG_PLAY_POS_LO_ADDR, port);
     }
 
+    size_t get_play_cmd_fifo_space(const size_t port) override
+    {
+        if (_fpga_compat < 0x00010001) {
+            throw uhd::not_implemented_error(
+                "Replay block version 1.1 or greater required to get the play "
+                "command queue space.  "
+                "Update the FPGA image to get this feature.");
+        }
+        _cmd_fifo_spaces[port] =
+            _replay_reg_iface.peek32(REG_PLAY_CMD_FIFO_SPACE_ADDR, port);
+        return _cmd_fifo_spaces[port];
+    }
+
     uint32_t get_max_items_per_packet(const size_t port) const override
     {
         return _payload_size.at(port).get() / get_play_item_size(port);
@@ -10,7 +10,10 @@
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhd/rfnoc/noc_block_make_args.hpp>
 #include <uhd/rfnoc/node.hpp>
+#include <uhd/rfnoc/radio_control.hpp>
+#include <uhd/rfnoc/switchboard_block_control.hpp>
 #include <uhd/rfnoc_graph.hpp>
+#include <uhd/utils/thread.hpp>
 #include <uhdlib/rfnoc/block_container.hpp>
 #include <uhdlib/rfnoc/factory.hpp>
 #include <uhdlib/rfnoc/graph.hpp>
@@ -20,7 +23,12 @@
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -59,6 +67,28 @@ struct route_info_t
     graph_edge_t dst_static_edge;
 };
 
+//! Resolve otw_format=auto before the streamer fixes its converters
+//
+// The streamers choose their converters at construction time, so 'auto' must
+// be replaced with a concrete format here. RFNoC radio blocks only advertise
+// sc16 on their data edges, so any other choice would fail property
+// resolution when the graph is committed; 'auto' therefore always resolves to
+// sc16 on this path. Multi-USRP performs the link-rate check separately when
+// it creates streamers.
+uhd::stream_args_t resolve_auto_otw_format(const uhd::stream_args_t& args_)
+{
+    if (args_.otw_format != "auto") {
+        return args_;
+    }
+    uhd::stream_args_t args = args_;
+    args.otw_format         = "sc16";
+    UHD_LOG_INFO(LOG_ID,
+        "otw_format=auto: Selecting sc16 (RFNoC data interfaces negotiate "
+        "sc16). Reduce the sample rate or channel count if the transport "
+        "link saturates.");
+    return args;
+}
+
 } // namespace
 
 // Define an attorney to limit access to noc_block_base internals
@@ -121,6 +151,9 @@ public:
 
     ~rfnoc_graph_impl() override
     {
+        // Finish any deferred transport teardown while the I/O services and
+        // links it depends on are still alive
+        _stop_reclaim_worker();
         UHD_LOG_TRACE(LOG_ID, "Shutting down detail::graph...");
         _graph->shutdown();
         UHD_LOG_TRACE(LOG_ID, "Shutting down all blocks ...");
@@ -351,16 +384,68 @@ public:
                 + src_blk.to_string());
         }
 
-        // Verify src_blk has an SEP downstream
+        // Optionally route the stream through an on-device DRAM FIFO so that
+        // brief host stalls are absorbed in DRAM instead of causing overruns.
+        // The FIFO is inserted between the source block and the SEP facing the
+        // host (src -> SEP -> DmaFIFO -> SEP -> host). Monitor the buffer
+        // watermark via dmafifo_block_control::get_fifo_fullness().
+        block_id_t eff_src_blk = src_blk;
+        size_t eff_src_port    = src_port;
+        if (rfnoc_streamer->get_stream_args().args.has_key("rx_dram_buff")
+            && rfnoc_streamer->get_stream_args().args.cast<bool>("rx_dram_buff", true)) {
+            const auto dram_fifo = _find_rx_dram_fifo(src_blk, src_port);
+            connect(src_blk, src_port, dram_fifo.first, dram_fifo.second, false);
+            UHD_LOG_INFO(LOG_ID,
+                "Buffering RX stream from " << src_blk.to_string() << ":" << src_port
+                                            << " through DRAM FIFO "
+                                            << dram_fifo.first.to_string() << ":"
+                                            << dram_fifo.second);
+            eff_src_blk  = dram_fifo.first;
+            eff_src_port = dram_fifo.second;
+        }
+
+        // Verify the (possibly substituted) source has an SEP downstream
         graph_edge_t src_static_edge = _assert_edge(
-            _get_static_edge(
-                [src_blk_id = src_blk.to_string(), src_port](const graph_edge_t& edge) {
-                    return edge.src_blockid == src_blk_id && edge.src_port == src_port;
-                }),
-            src_blk.to_string());
+            _get_static_edge([src_blk_id = eff_src_blk.to_string(), eff_src_port](
+                                 const graph_edge_t& edge) {
+                return edge.src_blockid == src_blk_id && edge.src_port == eff_src_port;
+            }),
+            eff_src_blk.to_string());
+        // Full-rate DSP bypass: when a radio samples at the tick rate, the
+        // DDC in its static path would do nothing but add a resampling stage
+        // to the property cascade. If the image routes the radio through a
+        // switchboard that has a branch going straight to an SEP, negotiate
+        // that direct route instead, leaving the DSP chain out of the path
+        // (and out of the property graph) entirely.
+        if (block_id_t(src_static_edge.dst_blockid).get_block_name() == "Switchboard"
+            && eff_src_blk.get_block_name() == "Radio") {
+            auto radio = rfnoc_graph::get_block<radio_control>(eff_src_blk);
+            if (radio->get_rate() == radio->get_tick_rate()) {
+                const block_id_t sb_id(src_static_edge.dst_blockid);
+                const size_t sb_input = src_static_edge.dst_port;
+                auto sb_out_edge = _get_static_edge([sb_id_str = sb_id.to_string()](
+                                                        const graph_edge_t& edge) {
+                    return edge.src_blockid == sb_id_str
+                           && block_id_t(edge.dst_blockid).get_block_name()
+                                  == NODE_ID_SEP;
+                });
+                if (sb_out_edge) {
+                    rfnoc_graph::get_block<switchboard_block_control>(sb_id)->connect(
+                        sb_input, sb_out_edge.get().src_port);
+                    src_static_edge = sb_out_edge.get();
+                    UHD_LOG_DEBUG(LOG_ID,
+                        "Full-rate capture: Routing "
+                            << eff_src_blk.to_string() << ":" << eff_src_port
+                            << " directly to " << src_static_edge.dst_blockid
+                            << " through " << sb_id.to_string()
+                            << ", bypassing the DSP chain");
+                }
+            }
+        }
+
         if (block_id_t(src_static_edge.dst_blockid).get_block_name() != NODE_ID_SEP) {
             const std::string err_msg =
-                src_blk.to_string() + ":" + std::to_string(src_port)
+                eff_src_blk.to_string() + ":" + std::to_string(eff_src_port)
                 + " is not connected to an SEP! Routing impossible.";
             UHD_LOG_ERROR(LOG_ID, err_msg);
             throw uhd::routing_error(err_msg);
@@ -384,8 +469,8 @@ public:
         rfnoc_streamer->connect_channel(strm_port, std::move(xport));
 
         // If this worked, then also connect the streamer in the BGL graph
-        auto src = get_block(src_blk);
-        graph_edge_t edge_info(src_port, strm_port, graph_edge_t::RX_STREAM, true);
+        auto src = get_block(eff_src_blk);
+        graph_edge_t edge_info(eff_src_port, strm_port, graph_edge_t::RX_STREAM, true);
         _graph->connect(src.get(), rfnoc_streamer.get(), edge_info);
 
         _rx_streamers[rfnoc_streamer->get_unique_id()].node = rfnoc_streamer.get();
@@ -450,9 +535,15 @@ public:
         const size_t num_ports, const uhd::stream_args_t& args) override
     {
         auto this_graph = shared_from_this();
-        return std::make_shared<rfnoc_rx_streamer>(num_ports,
-            args,
-            [this_graph](const std::string& id) { this_graph->disconnect(id); });
+        return std::make_shared<rfnoc_rx_streamer>(
+            num_ports,
+            resolve_auto_otw_format(args),
+            [this_graph](const std::string& id) { this_graph->disconnect(id); },
+            // The captured graph reference keeps this object alive until the
+            // last streamer is destroyed, so the worker can always run
+            [this_graph, this](std::vector<chdr_rx_data_xport::uptr>&& xports) {
+                this->_enqueue_reclaim(std::move(xports));
+            });
     }
 
     uhd::tx_streamer::sptr create_tx_streamer(
@@ -460,7 +551,7 @@ public:
     {
         auto this_graph = shared_from_this();
         return std::make_shared<rfnoc_tx_streamer>(num_ports,
-            args,
+            resolve_auto_otw_format(args),
             [this_graph](const std::string& id) { this_graph->disconnect(id); });
     }
 
@@ -575,14 +666,35 @@ public:
         return _static_edges;
     }
 
+    std::map<std::string, sep_traffic_counters_t> enumerate_sep_traffic_counters()
+        override
+    {
+        std::map<std::string, sep_traffic_counters_t> result;
+        for (const auto& sep : _sep_map) {
+            try {
+                const auto counters = _gsm->get_traffic_counters(sep.second);
+                result[sep.first]   = {counters.seq_err_count,
+                      counters.data_err_count,
+                      counters.route_err_count};
+            } catch (const uhd::exception&) {
+                // Endpoint is not reachable from the host (e.g., it only
+                // serves remote streams), skip it
+                continue;
+            }
+        }
+        return result;
+    }
+
     void commit() override
     {
+        UHD_TRACEPOINT(graph_commit, this);
         _graph->commit();
         UHD_LOG_TRACE(LOG_ID, "new graph committed" << std::endl << _graph->to_dot());
     }
 
     void release() override
     {
+        UHD_TRACEPOINT(graph_release, this);
         _graph->release();
     }
 
@@ -709,7 +821,8 @@ private:
         for (size_t portno = 0; portno < num_blocks; ++portno) {
             const auto noc_id       = mb_cz->get_noc_id(portno + first_block_port);
             const auto device_type  = mb_cz->get_device_type();
-            auto block_factory_info = factory::get_block_factory(noc_id, device_type);
+            const auto& block_factory_info =
+                factory::get_block_factory(noc_id, device_type);
             auto block_info         = mb_cz->get_block_info(portno + first_block_port);
             block_id_t block_id(mb_idx,
                 block_factory_info.block_name,
@@ -1005,6 +1118,66 @@ private:
         return edge_o.get();
     }
 
+    /*! Find an unused DRAM FIFO port that can buffer an RX stream
+     *
+     * The FIFO must live on the same device as the source block, and the
+     * candidate port must be statically connected to an SEP on both its input
+     * (so the source can be routed into it) and its output (so the host can
+     * stream out of it). Ports that are already part of an active connection
+     * are skipped.
+     *
+     * \throws uhd::routing_error if no suitable FIFO port is available
+     */
+    std::pair<block_id_t, size_t> _find_rx_dram_fifo(
+        const block_id_t& src_blk, const size_t src_port)
+    {
+        for (const auto& fifo_id : find_blocks("DmaFIFO")) {
+            if (fifo_id.get_device_no() != src_blk.get_device_no()) {
+                continue;
+            }
+            auto fifo_blk = get_block(fifo_id);
+            for (size_t port = 0; port < fifo_blk->get_num_input_ports(); port++) {
+                auto in_edge_o = _get_static_edge(
+                    [blk_id = fifo_id.to_string(), port](const graph_edge_t& edge) {
+                        return edge.dst_blockid == blk_id && edge.dst_port == port;
+                    });
+                if (!in_edge_o
+                    || block_id_t(in_edge_o.get().src_blockid).get_block_name()
+                           != NODE_ID_SEP) {
+                    continue;
+                }
+                auto out_edge_o = _get_static_edge(
+                    [blk_id = fifo_id.to_string(), port](const graph_edge_t& edge) {
+                        return edge.src_blockid == blk_id && edge.src_port == port;
+                    });
+                if (!out_edge_o
+                    || block_id_t(out_edge_o.get().dst_blockid).get_block_name()
+                           != NODE_ID_SEP) {
+                    continue;
+                }
+                // Don't steal a port that's already part of an active route
+                bool in_use = false;
+                for (const auto& edge : enumerate_active_connections()) {
+                    if ((edge.src_blockid == fifo_id.to_string()
+                            && edge.src_port == port)
+                        || (edge.dst_blockid == fifo_id.to_string()
+                            && edge.dst_port == port)) {
+                        in_use = true;
+                        break;
+                    }
+                }
+                if (!in_use) {
+                    return {fifo_id, port};
+                }
+            }
+        }
+        const std::string err_msg =
+            std::string("No available DRAM FIFO to buffer RX stream from ")
+            + src_blk.to_string() + ":" + std::to_string(src_port) + "!";
+        UHD_LOG_ERROR(LOG_ID, err_msg);
+        throw uhd::routing_error(err_msg);
+    }
+
     /**************************************************************************
      * Attributes
      *************************************************************************/
@@ -1068,6 +1241,72 @@ private:
 
     //! Map from RX streamer ID to streamer info
     std::map<std::string, streamer_info_t> _rx_streamers;
+
+    /**************************************************************************
+     * Background transport reclaim (see the fast_teardown stream arg)
+     *************************************************************************/
+    //! Queue transports for teardown on the reclaim worker thread
+    //
+    // Called from the destructor of streamers created with fast_teardown.
+    // The graph outlives all streamers (their disconnect callbacks hold a
+    // shared_ptr to it), and the graph destructor drains this queue before
+    // any subsystem the transports depend on is shut down.
+    void _enqueue_reclaim(std::vector<chdr_rx_data_xport::uptr>&& xports)
+    {
+        std::lock_guard<std::mutex> lock(_reclaim_mutex);
+        if (!_reclaim_thread.joinable()) {
+            _reclaim_thread = std::thread([this]() { this->_reclaim_worker(); });
+            uhd::set_thread_name(&_reclaim_thread, "uhd_reclaim");
+        }
+        for (auto& xport : xports) {
+            if (xport) {
+                _reclaim_queue.push_back(std::move(xport));
+            }
+        }
+        _reclaim_cv.notify_one();
+    }
+
+    //! Tear down queued transports, one at a time, off the caller's thread
+    void _reclaim_worker()
+    {
+        std::unique_lock<std::mutex> lock(_reclaim_mutex);
+        while (true) {
+            _reclaim_cv.wait(
+                lock, [this]() { return _reclaim_stop || !_reclaim_queue.empty(); });
+            if (_reclaim_queue.empty()) {
+                if (_reclaim_stop) {
+                    return;
+                }
+                continue;
+            }
+            auto xport = std::move(_reclaim_queue.front());
+            _reclaim_queue.pop_front();
+            // Destroy outside the lock; this is the potentially slow link
+            // disconnect we took off the streamer destructor's back
+            lock.unlock();
+            xport.reset();
+            lock.lock();
+        }
+    }
+
+    //! Stop the reclaim worker after it has drained the queue
+    void _stop_reclaim_worker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_reclaim_mutex);
+            _reclaim_stop = true;
+        }
+        _reclaim_cv.notify_one();
+        if (_reclaim_thread.joinable()) {
+            _reclaim_thread.join();
+        }
+    }
+
+    std::mutex _reclaim_mutex;
+    std::condition_variable _reclaim_cv;
+    std::deque<chdr_rx_data_xport::uptr> _reclaim_queue;
+    bool _reclaim_stop = false;
+    std::thread _reclaim_thread;
 }; /* class rfnoc_graph_impl */
 
 
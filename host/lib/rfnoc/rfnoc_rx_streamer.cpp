@@ -21,11 +21,13 @@ static std::atomic<uint64_t> streamer_inst_ctr;
 
 rfnoc_rx_streamer::rfnoc_rx_streamer(const size_t num_chans,
     const uhd::stream_args_t stream_args,
-    disconnect_fn_t disconnect_cb)
+    disconnect_fn_t disconnect_cb,
+    async_reclaim_fn_t reclaim_cb)
     : rx_streamer_impl<chdr_rx_data_xport>(num_chans, stream_args)
     , _unique_id(STREAMER_ID + "#" + std::to_string(streamer_inst_ctr++))
     , _stream_args(stream_args)
     , _disconnect_cb(disconnect_cb)
+    , _reclaim_cb(reclaim_cb)
 {
     set_overrun_handler([this]() { this->_handle_overrun(); });
 
@@ -108,6 +110,20 @@ rfnoc_rx_streamer::rfnoc_rx_streamer(const size_t num_chans,
 
 rfnoc_rx_streamer::~rfnoc_rx_streamer()
 {
+    if (_reclaim_cb && _stream_args.args.cast<bool>("fast_teardown", false)) {
+        // Detach the transports from the I/O service now -- that part must
+        // be synchronous so a successor streamer on the same endpoints does
+        // not race us for packets -- then hand them off so the slow link
+        // teardown runs in the background instead of blocking this
+        // destructor.
+        auto xports = release_xports();
+        for (auto& xport : xports) {
+            if (xport) {
+                xport->shutdown();
+            }
+        }
+        _reclaim_cb(std::move(xports));
+    }
     if (_disconnect_cb) {
         _disconnect_cb(_unique_id);
     }
@@ -143,10 +159,13 @@ void rfnoc_rx_streamer::issue_stream_cmd(const stream_cmd_t& stream_cmd)
     auto cmd        = stream_cmd_action_info::make(stream_cmd.stream_mode);
     cmd->stream_cmd = stream_cmd;
 
+    // Post all channels as a single batch so the graph is traversed only once
+    action_batch_t actions;
+    actions.reserve(get_num_channels());
     for (size_t i = 0; i < get_num_channels(); i++) {
-        const res_source_info info(res_source_info::INPUT_EDGE, i);
-        post_action(info, cmd);
+        actions.emplace_back(res_source_info(res_source_info::INPUT_EDGE, i), cmd);
     }
+    post_actions(actions);
 }
 
 void rfnoc_rx_streamer::post_input_action(
@@ -301,9 +320,13 @@ void rfnoc_rx_streamer::_handle_rx_event_action(
             stream_cmd_action_info::make(uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
         // Reminder: Delivery of all of these actions is deferred until this
         // action handler is complete.
+        action_batch_t stop_actions;
+        stop_actions.reserve(get_num_input_ports());
         for (size_t i = 0; i < get_num_input_ports(); ++i) {
-            post_action({res_source_info::INPUT_EDGE, i}, stop_action);
+            stop_actions.emplace_back(
+                res_source_info(res_source_info::INPUT_EDGE, i), stop_action);
         }
+        post_actions(stop_actions);
         if (!rx_event_action->args.cast<bool>("cont_mode", false)
             || _last_stream_cmd_stop) {
             // If we don't need to restart, that's all we need to do. Clear this
@@ -329,9 +352,13 @@ void rfnoc_rx_streamer::_handle_stream_cmd_action(
     auto start_action =
         stream_cmd_action_info::make(stream_cmd_action->stream_cmd.stream_mode);
     start_action->stream_cmd = stream_cmd_action->stream_cmd;
+    action_batch_t start_actions;
+    start_actions.reserve(get_num_input_ports());
     for (size_t i = 0; i < get_num_input_ports(); ++i) {
-        post_action({res_source_info::INPUT_EDGE, i}, start_action);
+        start_actions.emplace_back(
+            res_source_info(res_source_info::INPUT_EDGE, i), start_action);
     }
+    post_actions(start_actions);
     if (_overrun_handling_mode.exchange(false)) {
         RFNOC_LOG_TRACE("Leaving overrun handling mode.");
     }
@@ -8,6 +8,7 @@
 #include <uhd/utils/math.hpp>
 #include <uhdlib/rfnoc/node_accessor.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <atomic>
 
 using namespace uhd;
@@ -164,6 +165,7 @@ void rfnoc_tx_streamer::connect_channel(
                 md.time_spec = time_spec_t::from_ticks(tsf, get_tick_rate());
             }
 
+            UHD_TRACEPOINT(tx_async_event, channel, event_code);
             this->_async_msg_queue->enqueue(md);
         });
 
@@ -182,6 +184,11 @@ bool rfnoc_tx_streamer::recv_async_msg(
     return _async_msg_queue->recv_async_msg(async_metadata, timeout_ms);
 }
 
+int rfnoc_tx_streamer::get_async_msg_fd() const
+{
+    return _async_msg_queue->get_notify_fd();
+}
+
 void rfnoc_tx_streamer::_register_props(const size_t chan, const std::string& otw_format)
 {
     // Create actual properties and store them
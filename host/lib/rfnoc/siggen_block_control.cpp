@@ -118,6 +118,64 @@ public:
         return _prop_spp.at(port).get();
     }
 
+    void apply_config(const config_t& config,
+        const boost::optional<uhd::time_spec_t> time,
+        const size_t port) override
+    {
+        // Store the current command time so we can restore it later. All
+        // register writes triggered by the setters below then carry the same
+        // timestamp, so the hardware commits the whole parameter set
+        // back-to-back at the requested time.
+        auto prev_cmd_time = get_command_time(port);
+        if (time) {
+            set_command_time(time.get(), port);
+        }
+        set_waveform(config.waveform, port);
+        set_amplitude(config.amplitude, port);
+        set_constant(config.constant, port);
+        set_sine_phase_increment(config.sine_phase_increment, port);
+        set_command_time(prev_cmd_time, port);
+    }
+
+    void sweep_sine_phase_increments(const std::vector<double>& phase_incs,
+        const uhd::time_spec_t start_time,
+        const double interval,
+        const size_t port) override
+    {
+        if (phase_incs.empty()) {
+            return;
+        }
+        if (interval <= 0.0) {
+            throw uhd::value_error("Sweep interval must be > 0.0");
+        }
+        // Validate the whole table before anything is queued
+        for (const double phase_inc : phase_incs) {
+            if (phase_inc < (-uhd::math::PI) || phase_inc > (uhd::math::PI)) {
+                throw uhd::value_error("Phase increment value must be in [-pi, pi]");
+            }
+        }
+        // Push all steps into the command queue as timed writes. Only the
+        // phase increment register changes, so the sine generator's phase
+        // accumulator runs through the sweep without a discontinuity.
+        for (size_t i = 0; i < phase_incs.size(); i++) {
+            const int16_t phase_inc_scaled_rads_fp =
+                clamp<int16_t>((phase_incs[i] / uhd::math::PI) * 8192.0);
+            _siggen_reg_iface.poke32(REG_PHASE_INC_OFFSET,
+                phase_inc_scaled_rads_fp & 0xffff,
+                port,
+                start_time + uhd::time_spec_t(i * interval));
+        }
+        // Update the cached property to the final value so it matches the
+        // hardware state after the sweep completes. If this triggers another
+        // register write, it is a duplicate of the final step at the same
+        // time, which is harmless.
+        auto prev_cmd_time = get_command_time(port);
+        set_command_time(
+            start_time + uhd::time_spec_t((phase_incs.size() - 1) * interval), port);
+        set_property<double>(PROP_KEY_SINE_PHASE_INC, phase_incs.back(), port);
+        set_command_time(prev_cmd_time, port);
+    }
+
     /**************************************************************************
      * Initialization
      *************************************************************************/
@@ -189,8 +247,10 @@ private:
                 }
                 const int16_t phase_inc_scaled_rads_fp =
                     clamp<int16_t>((phase_inc / uhd::math::PI) * 8192.0);
-                _siggen_reg_iface.poke32(
-                    REG_PHASE_INC_OFFSET, phase_inc_scaled_rads_fp & 0xffff, port);
+                _siggen_reg_iface.poke32(REG_PHASE_INC_OFFSET,
+                    phase_inc_scaled_rads_fp & 0xffff,
+                    port,
+                    get_command_time(port));
             });
             register_property(&_prop_spp.back(), [this, port]() {
                 const uint32_t spp = _prop_spp.at(port).get();
@@ -219,7 +279,8 @@ private:
                     }
 
                     // Set the waveform register appropriately.
-                    _siggen_reg_iface.poke32(REG_WAVEFORM_OFFSET, waveform_val, port);
+                    _siggen_reg_iface.poke32(
+                        REG_WAVEFORM_OFFSET, waveform_val, port, get_command_time(port));
 
                     // Now set the other registers based on the waveform and
                     // the desired amplitude.
@@ -294,13 +355,14 @@ private:
         const uint32_t constant_reg_value = (uint32_t(constant_i_fp) << 16)
                                             | (uint32_t(constant_q_fp) & 0xffff);
 
-        _siggen_reg_iface.poke32(REG_CONSTANT_OFFSET, constant_reg_value, port);
+        _siggen_reg_iface.poke32(
+            REG_CONSTANT_OFFSET, constant_reg_value, port, get_command_time(port));
     }
 
     void _set_gain_register(const double gain, const size_t port)
     {
         const int16_t gain_fp = clamp<int16_t>(gain * 32768.0);
-        _siggen_reg_iface.poke32(REG_GAIN_OFFSET, gain_fp, port);
+        _siggen_reg_iface.poke32(REG_GAIN_OFFSET, gain_fp, port, get_command_time(port));
     }
 
     void _set_cartesian_register(const double amplitude, const size_t port)
@@ -318,7 +380,8 @@ private:
         // amplitude), while bits 15:0 represent the imaginary component (which
         // is zeroed).
         const uint32_t cartesian_reg_value = (uint32_t(cartesian_x_fp) << 16);
-        _siggen_reg_iface.poke32(REG_CARTESIAN_OFFSET, cartesian_reg_value, port);
+        _siggen_reg_iface.poke32(
+            REG_CARTESIAN_OFFSET, cartesian_reg_value, port, get_command_time(port));
     }
 
     /**************************************************************************
@@ -9,6 +9,7 @@
 #include <uhd/rfnoc/property.hpp>
 #include <uhd/rfnoc/registry.hpp>
 #include <uhd/rfnoc/switchboard_block_control.hpp>
+#include <uhdlib/rfnoc/prop_accessor.hpp>
 
 using namespace uhd::rfnoc;
 
@@ -61,6 +62,34 @@ public:
         _connect_call = false;
     }
 
+    void switch_path(const size_t input, const size_t output) override
+    {
+        if (input >= _num_input_ports || output >= _num_output_ports) {
+            throw uhd::value_error("Index out of bounds");
+        }
+        // Poke the select registers directly; this is all the hardware needs
+        // to re-route the path.
+        _switchboard_reg_iface.poke32(REG_MUX_SELECT_ADDR, input, output);
+        _switchboard_reg_iface.poke32(REG_DEMUX_SELECT_ADDR, output, input);
+        // Mirror the new routing into the select properties without
+        // triggering a property resolution: All candidate paths must already
+        // be resolved for this call to be valid, so there is nothing to
+        // propagate.
+        prop_accessor_t prop_accessor{};
+        auto set_prop_quietly = [&prop_accessor](
+                                    property_t<int>& prop, const int value) {
+            auto access = prop_accessor.get_scoped_prop_access(
+                prop, property_base_t::RW, prop.get_access_mode());
+            prop.set(value);
+            prop_accessor.mark_clean(prop);
+        };
+        set_prop_quietly(_input_select.at(output), static_cast<int>(input));
+        set_prop_quietly(_output_select.at(input), static_cast<int>(output));
+        // Keep actions (e.g., overrun notifications) flowing along the new
+        // path.
+        _update_forwarding_map();
+    }
+
 private:
     const size_t _num_input_ports;
     const size_t _num_output_ports;
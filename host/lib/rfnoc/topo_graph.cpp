@@ -117,6 +117,7 @@ public:
 
 bool topo_graph_t::add_node(const topo_node_t& node)
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     if (_node_map.count(node.unique_id())) {
         return false;
     }
@@ -127,6 +128,7 @@ bool topo_graph_t::add_node(const topo_node_t& node)
 
 std::list<topo_node_t> topo_graph_t::get_nodes(node_filter_type&& filter_predicate) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     std::list<topo_node_t> result;
     auto vertices = _get_vertices(std::move(filter_predicate));
     for (auto& vertex : vertices) {
@@ -139,6 +141,7 @@ std::list<topo_node_t> topo_graph_t::get_nodes(node_filter_type&& filter_predica
 std::list<topo_node_t> topo_graph_t::get_connected_nodes(
     const topo_node_t& src, node_filter_type&& filter_predicate) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     std::list<topo_node_t> result;
     std::map<topo_node_t::node_hash_type, topo_node_t> found_nodes;
     // Create a visitor. Surely there's a built-in way to do this with BGL,
@@ -160,6 +163,7 @@ std::list<topo_node_t> topo_graph_t::get_connected_nodes(
 bool topo_graph_t::add_edge(
     const topo_node_t& src, const topo_node_t& dst, const topo_edge_t& edge)
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     // Check source node is registered
     if (!_node_map.count(src.unique_id())) {
         const std::string err_msg =
@@ -230,6 +234,7 @@ bool topo_graph_t::add_edge(
 bool topo_graph_t::add_biedge(
     const topo_node_t& src, const topo_node_t& dst, const topo_edge_t& edge)
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     topo_edge_t rev_edge = edge;
     std::swap(rev_edge.src_port, rev_edge.dst_port);
 
@@ -258,6 +263,7 @@ void topo_graph_t::_assert_route(
 
 bool topo_graph_t::has_route(const topo_node_t& src, const topo_node_t& dst) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     _assert_route(src, dst, "check");
 
     // Create a visitor
@@ -276,6 +282,7 @@ bool topo_graph_t::has_route(const topo_node_t& src, const topo_node_t& dst) con
 
 route_type topo_graph_t::get_route(const topo_node_t& src, const topo_node_t& dst) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     _assert_route(src, dst, "get");
     auto src_vertex_desc = _node_map.at(src.unique_id());
 
@@ -342,6 +349,7 @@ route_type topo_graph_t::get_route(const topo_node_t& src, const topo_node_t& ds
 route_type topo_graph_t::get_best_route(
     topo_graph_t::node_filter_type&& src_filter, const topo_node_t& dst) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     auto vertices = _get_vertices(std::move(src_filter));
     route_type best_route{};
     int shortest_distance = std::numeric_limits<int>::max();
@@ -363,12 +371,14 @@ route_type topo_graph_t::get_best_route(
 
 int topo_graph_t::get_distance(const topo_node_t& src, const topo_node_t& dst) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     return get_route_distance(get_route(src, dst));
 }
 
 
 topo_edge_t topo_graph_t::get_edge(const topo_node_t& src, const topo_node_t& dst) const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     auto edge_result =
         boost::edge(_node_map.at(src.unique_id()), _node_map.at(dst.unique_id()), _graph);
     if (!edge_result.second) {
@@ -384,12 +394,14 @@ topo_edge_t topo_graph_t::get_edge(const topo_node_t& src, const topo_node_t& ds
 
 topo_node_t& topo_graph_t::access_node(const topo_node_t& node_id)
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     return boost::get(vertex_property_t(), _graph, _node_map.at(node_id.unique_id()));
 }
 
 void topo_graph_t::update_weight(
     const topo_node_t& src, const topo_edge_t::port_t src_port, const int new_weight)
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     auto src_vertex_desc = _node_map.at(src.unique_id());
     auto out_edge_range  = boost::out_edges(src_vertex_desc, _graph);
     for (auto edge_it = out_edge_range.first; edge_it != out_edge_range.second;
@@ -413,6 +425,7 @@ void topo_graph_t::update_weight(
 
 std::string topo_graph_t::to_dot() const
 {
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
     static const std::map<topo_node_t::node_type, std::string> SHAPE_MAP{
         {topo_node_t::node_type::INVALID, "circle"},
         {topo_node_t::node_type::XBAR, "hexagon"},
@@ -4,14 +4,34 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/config.hpp>
 #include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
 #include <chrono>
 #include <thread>
 
+#ifdef UHD_PLATFORM_LINUX
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#endif
+
 using namespace uhd;
 using namespace uhd::rfnoc;
 
-tx_async_msg_queue::tx_async_msg_queue(size_t capacity) : _queue(capacity) {}
+tx_async_msg_queue::tx_async_msg_queue(size_t capacity) : _queue(capacity)
+{
+#ifdef UHD_PLATFORM_LINUX
+    _notify_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+}
+
+tx_async_msg_queue::~tx_async_msg_queue()
+{
+#ifdef UHD_PLATFORM_LINUX
+    if (_notify_fd >= 0) {
+        ::close(_notify_fd);
+    }
+#endif
+}
 
 bool tx_async_msg_queue::recv_async_msg(
     uhd::async_metadata_t& async_metadata, int32_t timeout_ms)
@@ -19,6 +39,13 @@ bool tx_async_msg_queue::recv_async_msg(
     using namespace std::chrono;
 
     if (timeout_ms == 0.0) {
+        if (_queue.pop(async_metadata)) {
+            return true;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_agg_mutex);
+            flush_run_locked();
+        }
         return _queue.pop(async_metadata);
     }
 
@@ -31,6 +58,14 @@ bool tx_async_msg_queue::recv_async_msg(
             return true;
         }
 
+        // The queue is empty, so the consumer has caught up: release any
+        // pending error run summary right away rather than holding it back
+        // for the rest of the reporting interval.
+        {
+            std::lock_guard<std::mutex> lock(_agg_mutex);
+            flush_run_locked();
+        }
+
         if (steady_clock::now() > end_time) {
             if (last_check) {
                 return false;
@@ -45,5 +80,93 @@ bool tx_async_msg_queue::recv_async_msg(
 
 void tx_async_msg_queue::enqueue(const async_metadata_t& async_metadata)
 {
-    _queue.push(async_metadata);
+    using namespace std::chrono;
+
+    std::lock_guard<std::mutex> lock(_agg_mutex);
+
+    if (!is_aggregatable(async_metadata.event_code)) {
+        // Burst ACKs and user payloads are always delivered individually.
+        // Flush the pending run first so records stay in order.
+        flush_run_locked();
+        _run_valid = false;
+        push(async_metadata);
+        return;
+    }
+
+    const auto now = steady_clock::now();
+
+    if (_run_valid && _run_md.event_code == async_metadata.event_code
+        && _run_md.channel == async_metadata.channel) {
+        // Same run as the previous error: fold into the pending summary
+        if (_run_count == 0) {
+            _run_md    = async_metadata;
+            _run_count = 1;
+        } else {
+            _run_count++;
+            if (async_metadata.has_time_spec) {
+                _run_md.last_time_spec = async_metadata.time_spec;
+            }
+        }
+        if (now >= _next_report) {
+            flush_run_locked();
+            _next_report = now + AGG_REPORT_INTERVAL;
+        }
+        return;
+    }
+
+    // Different code or channel: close the old run, report this event
+    // immediately (the first error of a storm must not be delayed), and
+    // open a new run for any followers.
+    flush_run_locked();
+    push(async_metadata);
+    _run_valid   = true;
+    _run_md      = async_metadata;
+    _run_count   = 0;
+    _next_report = now + AGG_REPORT_INTERVAL;
+}
+
+bool tx_async_msg_queue::is_aggregatable(async_metadata_t::event_code_t event_code)
+{
+    switch (event_code) {
+        case async_metadata_t::EVENT_CODE_UNDERFLOW:
+        case async_metadata_t::EVENT_CODE_SEQ_ERROR:
+        case async_metadata_t::EVENT_CODE_TIME_ERROR:
+        case async_metadata_t::EVENT_CODE_UNDERFLOW_IN_PACKET:
+        case async_metadata_t::EVENT_CODE_SEQ_ERROR_IN_BURST:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void tx_async_msg_queue::flush_run_locked()
+{
+    if (_run_count == 0) {
+        return;
+    }
+    _run_md.event_count = _run_count;
+    _run_count          = 0;
+    push(_run_md);
+}
+
+void tx_async_msg_queue::push(const async_metadata_t& async_metadata)
+{
+    // The queue is fixed-size, so pushing never touches the allocator. If it
+    // has filled up because nobody is draining events, drop the oldest
+    // message so that the caller always sees the most recent events.
+    while (!_queue.bounded_push(async_metadata)) {
+        async_metadata_t dropped;
+        _queue.pop(dropped);
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    if (_notify_fd >= 0) {
+        // Ring the doorbell for event-driven consumers. The eventfd counter
+        // saturates long before it overflows, and a failed write (counter at
+        // max) still leaves the fd readable, so the result can be ignored.
+        const uint64_t one = 1;
+        ssize_t unused     = ::write(_notify_fd, &one, sizeof(one));
+        (void)unused;
+    }
+#endif
 }
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
 
 using namespace uhd;
@@ -14,7 +15,63 @@ rx_streamer::~rx_streamer(void)
     // empty
 }
 
+stream_health_t rx_streamer::get_stream_health(void) const
+{
+    // Default for streamers that do not track health statistics
+    return stream_health_t();
+}
+
+size_t rx_streamer::recv_scatter(const buffs_type&,
+    const size_t,
+    std::vector<scatter_info_t>&,
+    rx_metadata_t&,
+    const double)
+{
+    throw uhd::not_implemented_error(
+        "recv_scatter is not implemented for this streamer");
+}
+
+size_t rx_streamer::recv_buffs(
+    managed_buffs_type&, std::vector<size_t>&, rx_metadata_t&, const double)
+{
+    throw uhd::not_implemented_error("recv_buffs is not implemented for this streamer");
+}
+
+void rx_streamer::enable_tags(const bool)
+{
+    throw uhd::not_implemented_error("enable_tags is not implemented for this streamer");
+}
+
+size_t rx_streamer::get_tags(std::vector<rx_tag_t>&)
+{
+    throw uhd::not_implemented_error("get_tags is not implemented for this streamer");
+}
+
 tx_streamer::~tx_streamer(void)
 {
     // empty
 }
+
+stream_health_t tx_streamer::get_stream_health(void) const
+{
+    // Default for streamers that do not track health statistics
+    return stream_health_t();
+}
+
+int tx_streamer::get_async_msg_fd(void) const
+{
+    // Default for streamers without an event-driven async message queue
+    return -1;
+}
+
+size_t tx_streamer::register_preconverted(const buffs_type&, const size_t)
+{
+    throw uhd::not_implemented_error(
+        "register_preconverted is not implemented for this streamer");
+}
+
+size_t tx_streamer::send_preconverted(const size_t, const tx_metadata_t&, const double)
+{
+    throw uhd::not_implemented_error(
+        "send_preconverted is not implemented for this streamer");
+}
@@ -8,9 +8,92 @@
 #ifndef INCLUDED_UHD_STREAM_PYTHON_HPP
 #define INCLUDED_UHD_STREAM_PYTHON_HPP
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
+#include <uhd/utils/thread.hpp>
 #include <boost/format.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifndef UHD_PLATFORM_WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+/*! Self-pipe used to make ring buffer readiness visible to select()-style
+ * event loops (e.g. Python's asyncio via loop.add_reader()). Not available on
+ * Windows, where get_fd() returns -1 and callers fall back to polling.
+ */
+class ring_notify_pipe
+{
+public:
+    ring_notify_pipe()
+    {
+#ifndef UHD_PLATFORM_WIN32
+        int fds[2];
+        if (::pipe(fds) == 0) {
+            _rd = fds[0];
+            _wr = fds[1];
+            ::fcntl(_rd, F_SETFL, ::fcntl(_rd, F_GETFL) | O_NONBLOCK);
+            ::fcntl(_wr, F_SETFL, ::fcntl(_wr, F_GETFL) | O_NONBLOCK);
+        }
+#endif
+    }
+
+    ~ring_notify_pipe()
+    {
+#ifndef UHD_PLATFORM_WIN32
+        if (_rd != -1) {
+            ::close(_rd);
+        }
+        if (_wr != -1) {
+            ::close(_wr);
+        }
+#endif
+    }
+
+    ring_notify_pipe(const ring_notify_pipe&) = delete;
+    ring_notify_pipe& operator=(const ring_notify_pipe&) = delete;
+
+    //! Make the read end readable (no-op if the pipe is full, since
+    // readability is already pending in that case)
+    void signal()
+    {
+#ifndef UHD_PLATFORM_WIN32
+        if (_wr != -1) {
+            const char token = 0;
+            const ssize_t ret = ::write(_wr, &token, 1);
+            (void)ret;
+        }
+#endif
+    }
+
+    //! Drain pending tokens; call before re-checking ring state
+    void clear()
+    {
+#ifndef UHD_PLATFORM_WIN32
+        if (_rd != -1) {
+            char buf[64];
+            while (::read(_rd, buf, sizeof(buf)) > 0) {
+            }
+        }
+#endif
+    }
+
+    int get_fd() const
+    {
+        return _rd;
+    }
+
+private:
+    int _rd = -1;
+    int _wr = -1;
+};
 
 static size_t wrap_recv(uhd::rx_streamer* rx_stream,
     py::object& np_array,
@@ -125,6 +208,446 @@ static size_t wrap_send(uhd::tx_streamer* tx_stream,
     return result;
 }
 
+/*! Continuous receive into a preallocated NumPy ring buffer
+ *
+ * A C++ worker thread calls rx_streamer::recv() into successive segments of a
+ * NumPy array that the caller registers once at construction, so the Python
+ * consumer only pays a cheap index handshake per segment instead of one
+ * Python/C++ crossing (plus array parsing) per recv() call.
+ *
+ * The ring is divided into num_segments equal segments. The worker fills one
+ * segment at a time and publishes it; the consumer claims the oldest filled
+ * segment with acquire(), processes it in place, and returns it to the ring
+ * with release(). If the consumer falls behind until the ring is full, the
+ * worker stops pulling from the transport and the resulting device overflow
+ * is counted and visible in the overflow counter.
+ *
+ * The array must be C-contiguous, shaped [channels][samples] (or 1D for a
+ * single channel), with the sample count a multiple of num_segments. The
+ * dtype must match the streamer's CPU format; the worker treats the storage
+ * as raw bytes. The array is kept referenced for the lifetime of this object.
+ */
+class rx_ring_buffer
+{
+public:
+    rx_ring_buffer(
+        uhd::rx_streamer::sptr rx_stream, py::object& np_array, const size_t num_segments)
+        : _rx_stream(rx_stream), _num_segments(num_segments)
+    {
+        PyObject* array_obj = PyArray_FROM_OF(np_array.ptr(), NPY_ARRAY_CARRAY);
+        PyArrayObject* array_type_obj = reinterpret_cast<PyArrayObject*>(array_obj);
+        // Hold a reference so the storage outlives the worker
+        _array = py::reinterpret_steal<py::object>(array_obj);
+
+        const size_t dims       = PyArray_NDIM(array_type_obj);
+        const npy_intp* shape   = PyArray_SHAPE(array_type_obj);
+        const npy_intp* strides = PyArray_STRIDES(array_type_obj);
+        _num_channels           = rx_stream->get_num_channels();
+
+        if (((_num_channels > 1) && (dims != 2)) or ((size_t)shape[0] < _num_channels)) {
+            const size_t input_channels = (dims != 2) ? 1 : shape[0];
+            throw uhd::runtime_error(
+                str(boost::format("Number of RX channels (%d) does not match the "
+                                  "dimensions of the data array (%d)")
+                    % _num_channels % input_channels));
+        }
+
+        const size_t ring_samps = (dims > 1) ? (size_t)shape[1]
+                                             : PyArray_SIZE(array_type_obj);
+        if (num_segments == 0 or ring_samps % num_segments != 0) {
+            throw uhd::value_error(
+                str(boost::format("Ring size (%d samples) must be a non-zero multiple "
+                                  "of num_segments (%d)")
+                    % ring_samps % num_segments));
+        }
+
+        _segment_samps  = ring_samps / num_segments;
+        _bytes_per_item = PyArray_ITEMSIZE(array_type_obj);
+        _channel_stride = (dims > 1) ? (size_t)strides[0] : 0;
+        _data           = PyArray_BYTES(array_type_obj);
+    }
+
+    ~rx_ring_buffer()
+    {
+        stop();
+    }
+
+    //! Spawn the worker thread; streaming is started separately via
+    // issue_stream_cmd() on the streamer.
+    void start()
+    {
+        if (_worker.joinable()) {
+            throw uhd::runtime_error("rx_ring_buffer worker already started");
+        }
+        _stop   = false;
+        _worker = std::thread([this]() { this->_run(); });
+        uhd::set_thread_name(&_worker, "uhd_py_ring");
+    }
+
+    //! Stop and join the worker thread
+    void stop()
+    {
+        if (not _worker.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv_space.notify_all();
+        _worker.join();
+    }
+
+    /*! Claim the oldest filled segment
+     *
+     * Returns the segment index (multiply by get_segment_size() for the
+     * sample offset into the ring), or -1 if no segment fills up within the
+     * timeout. The segment stays owned by the caller until release().
+     */
+    int64_t acquire(const double timeout = 0.1)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (not _cv_data.wait_for(lock,
+                std::chrono::duration<double>(timeout),
+                [this]() { return _write_count > _read_count; })) {
+            return -1;
+        }
+        return static_cast<int64_t>(_read_count % _num_segments);
+    }
+
+    //! Return the oldest claimed segment to the ring
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_read_count < _write_count) {
+                _read_count++;
+            }
+        }
+        _cv_space.notify_one();
+    }
+
+    size_t get_num_segments() const
+    {
+        return _num_segments;
+    }
+
+    size_t get_segment_size() const
+    {
+        return _segment_samps;
+    }
+
+    uint64_t get_overflow_count() const
+    {
+        return _overflow_count;
+    }
+
+    uint64_t get_error_count() const
+    {
+        return _error_count;
+    }
+
+    /*! File descriptor that becomes readable when a segment fills up
+     *
+     * Register this with an event loop (e.g. asyncio's loop.add_reader()) to
+     * await data without polling. Call clear_notify() after wakeup, then
+     * re-check acquire(). Returns -1 on platforms without pipe support.
+     */
+    int get_notify_fd() const
+    {
+        return _notify.get_fd();
+    }
+
+    //! Drain the readiness notification before re-checking acquire()
+    void clear_notify()
+    {
+        _notify.clear();
+    }
+
+private:
+    void _run()
+    {
+        uhd::rx_metadata_t md;
+        std::vector<void*> buffs(_num_channels);
+
+        while (true) {
+            // Wait for a free segment; while we wait, the transport backs up
+            // and the device eventually reports the overflow
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv_space.wait(lock, [this]() {
+                    return _stop or (_write_count - _read_count) < _num_segments;
+                });
+                if (_stop) {
+                    return;
+                }
+            }
+
+            const size_t segment = _write_count % _num_segments;
+            size_t filled        = 0;
+            while (filled < _segment_samps and not _stop) {
+                const size_t offset_bytes =
+                    (segment * _segment_samps + filled) * _bytes_per_item;
+                for (size_t ch = 0; ch < _num_channels; ch++) {
+                    buffs[ch] = _data + ch * _channel_stride + offset_bytes;
+                }
+                const size_t num_rx =
+                    _rx_stream->recv(buffs, _segment_samps - filled, md, 0.1);
+
+                if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) {
+                    _overflow_count++;
+                } else if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                    // Keep polling until stop() is called
+                } else if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+                    _error_count++;
+                }
+                filled += num_rx;
+            }
+            if (_stop) {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _write_count++;
+            }
+            _cv_data.notify_one();
+            _notify.signal();
+        }
+    }
+
+    uhd::rx_streamer::sptr _rx_stream;
+    py::object _array;
+    size_t _num_segments;
+    size_t _num_channels;
+    size_t _segment_samps;
+    size_t _bytes_per_item;
+    size_t _channel_stride;
+    char* _data;
+
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _cv_data;
+    std::condition_variable _cv_space;
+    bool _stop           = false;
+    uint64_t _write_count = 0;
+    uint64_t _read_count  = 0;
+    std::atomic<uint64_t> _overflow_count{0};
+    std::atomic<uint64_t> _error_count{0};
+    ring_notify_pipe _notify;
+};
+
+/*! Continuous send from a preallocated NumPy ring buffer
+ *
+ * The transmit counterpart of rx_ring_buffer: the producer claims a free
+ * segment with acquire(), fills it in place, and publishes it with commit();
+ * a C++ worker thread streams published segments through
+ * tx_streamer::send(). The notify fd becomes readable whenever a segment
+ * finishes sending, i.e. when ring space frees up.
+ *
+ * The worker sends a continuous stream (no per-segment burst framing). On
+ * stop(), any unsent segments are dropped and a zero-sample end-of-burst
+ * packet is sent to close the stream.
+ */
+class tx_ring_buffer
+{
+public:
+    tx_ring_buffer(
+        uhd::tx_streamer::sptr tx_stream, py::object& np_array, const size_t num_segments)
+        : _tx_stream(tx_stream), _num_segments(num_segments)
+    {
+        PyObject* array_obj = PyArray_FROM_OF(np_array.ptr(), NPY_ARRAY_CARRAY);
+        PyArrayObject* array_type_obj = reinterpret_cast<PyArrayObject*>(array_obj);
+        // Hold a reference so the storage outlives the worker
+        _array = py::reinterpret_steal<py::object>(array_obj);
+
+        const size_t dims       = PyArray_NDIM(array_type_obj);
+        const npy_intp* shape   = PyArray_SHAPE(array_type_obj);
+        const npy_intp* strides = PyArray_STRIDES(array_type_obj);
+        _num_channels           = tx_stream->get_num_channels();
+
+        if (((_num_channels > 1) && (dims != 2)) or ((size_t)shape[0] < _num_channels)) {
+            const size_t input_channels = (dims != 2) ? 1 : shape[0];
+            throw uhd::runtime_error(
+                str(boost::format("Number of TX channels (%d) does not match the "
+                                  "dimensions of the data array (%d)")
+                    % _num_channels % input_channels));
+        }
+
+        const size_t ring_samps = (dims > 1) ? (size_t)shape[1]
+                                             : PyArray_SIZE(array_type_obj);
+        if (num_segments == 0 or ring_samps % num_segments != 0) {
+            throw uhd::value_error(
+                str(boost::format("Ring size (%d samples) must be a non-zero multiple "
+                                  "of num_segments (%d)")
+                    % ring_samps % num_segments));
+        }
+
+        _segment_samps  = ring_samps / num_segments;
+        _bytes_per_item = PyArray_ITEMSIZE(array_type_obj);
+        _channel_stride = (dims > 1) ? (size_t)strides[0] : 0;
+        _data           = PyArray_BYTES(array_type_obj);
+    }
+
+    ~tx_ring_buffer()
+    {
+        stop();
+    }
+
+    //! Spawn the worker thread
+    void start()
+    {
+        if (_worker.joinable()) {
+            throw uhd::runtime_error("tx_ring_buffer worker already started");
+        }
+        _stop   = false;
+        _worker = std::thread([this]() { this->_run(); });
+        uhd::set_thread_name(&_worker, "uhd_py_ring");
+    }
+
+    //! Stop and join the worker thread
+    void stop()
+    {
+        if (not _worker.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv_data.notify_all();
+        _worker.join();
+    }
+
+    /*! Claim the next free segment for filling
+     *
+     * Returns the segment index (multiply by get_segment_size() for the
+     * sample offset into the ring), or -1 if no segment frees up within the
+     * timeout. The segment is published with commit().
+     */
+    int64_t acquire(const double timeout = 0.1)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (not _cv_space.wait_for(lock,
+                std::chrono::duration<double>(timeout),
+                [this]() { return (_write_count - _send_count) < _num_segments; })) {
+            return -1;
+        }
+        return static_cast<int64_t>(_write_count % _num_segments);
+    }
+
+    //! Publish the claimed segment for sending
+    void commit()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if ((_write_count - _send_count) < _num_segments) {
+                _write_count++;
+            }
+        }
+        _cv_data.notify_one();
+    }
+
+    size_t get_num_segments() const
+    {
+        return _num_segments;
+    }
+
+    size_t get_segment_size() const
+    {
+        return _segment_samps;
+    }
+
+    uint64_t get_timeout_count() const
+    {
+        return _timeout_count;
+    }
+
+    /*! File descriptor that becomes readable when ring space frees up
+     *
+     * Register this with an event loop (e.g. asyncio's loop.add_reader()) to
+     * await space without polling. Call clear_notify() after wakeup, then
+     * re-check acquire(). Returns -1 on platforms without pipe support.
+     */
+    int get_notify_fd() const
+    {
+        return _notify.get_fd();
+    }
+
+    //! Drain the readiness notification before re-checking acquire()
+    void clear_notify()
+    {
+        _notify.clear();
+    }
+
+private:
+    void _run()
+    {
+        uhd::tx_metadata_t md;
+        std::vector<void*> buffs(_num_channels);
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv_data.wait(
+                    lock, [this]() { return _stop or _write_count > _send_count; });
+                if (_stop) {
+                    break;
+                }
+            }
+
+            const size_t segment = _send_count % _num_segments;
+            size_t sent          = 0;
+            while (sent < _segment_samps and not _stop) {
+                const size_t offset_bytes =
+                    (segment * _segment_samps + sent) * _bytes_per_item;
+                for (size_t ch = 0; ch < _num_channels; ch++) {
+                    buffs[ch] = _data + ch * _channel_stride + offset_bytes;
+                }
+                const size_t num_tx =
+                    _tx_stream->send(buffs, _segment_samps - sent, md, 0.1);
+                if (num_tx == 0) {
+                    _timeout_count++;
+                }
+                sent += num_tx;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _send_count++;
+            }
+            _cv_space.notify_one();
+            _notify.signal();
+        }
+
+        // Close the stream with a zero-sample end-of-burst packet
+        for (size_t ch = 0; ch < _num_channels; ch++) {
+            buffs[ch] = _data + ch * _channel_stride;
+        }
+        md.end_of_burst = true;
+        _tx_stream->send(buffs, 0, md, 0.1);
+    }
+
+    uhd::tx_streamer::sptr _tx_stream;
+    py::object _array;
+    size_t _num_segments;
+    size_t _num_channels;
+    size_t _segment_samps;
+    size_t _bytes_per_item;
+    size_t _channel_stride;
+    char* _data;
+
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _cv_data;
+    std::condition_variable _cv_space;
+    bool _stop            = false;
+    uint64_t _write_count = 0;
+    uint64_t _send_count  = 0;
+    std::atomic<uint64_t> _timeout_count{0};
+    ring_notify_pipe _notify;
+};
+
 static bool wrap_recv_async_msg(uhd::tx_streamer* tx_stream,
     uhd::async_metadata_t& async_metadata,
     double timeout = 0.1)
@@ -159,6 +682,47 @@ void export_stream(py::module& m)
         .def("get_max_num_samps", &uhd::rx_streamer::get_max_num_samps)
         .def("issue_stream_cmd", &uhd::rx_streamer::issue_stream_cmd);
 
+    py::class_<rx_ring_buffer>(
+        m, "rx_ring_buffer", "GIL-free bulk receive into a preallocated NumPy ring")
+        // Methods
+        .def(py::init<uhd::rx_streamer::sptr, py::object&, size_t>(),
+            py::arg("rx_streamer"),
+            py::arg("np_array"),
+            py::arg("num_segments"))
+        .def("start", &rx_ring_buffer::start)
+        .def("stop", &rx_ring_buffer::stop, py::call_guard<py::gil_scoped_release>())
+        .def("acquire",
+            &rx_ring_buffer::acquire,
+            py::arg("timeout") = 0.1,
+            py::call_guard<py::gil_scoped_release>())
+        .def("release", &rx_ring_buffer::release)
+        .def("get_num_segments", &rx_ring_buffer::get_num_segments)
+        .def("get_segment_size", &rx_ring_buffer::get_segment_size)
+        .def("get_overflow_count", &rx_ring_buffer::get_overflow_count)
+        .def("get_error_count", &rx_ring_buffer::get_error_count)
+        .def("get_notify_fd", &rx_ring_buffer::get_notify_fd)
+        .def("clear_notify", &rx_ring_buffer::clear_notify);
+
+    py::class_<tx_ring_buffer>(
+        m, "tx_ring_buffer", "GIL-free bulk send from a preallocated NumPy ring")
+        // Methods
+        .def(py::init<uhd::tx_streamer::sptr, py::object&, size_t>(),
+            py::arg("tx_streamer"),
+            py::arg("np_array"),
+            py::arg("num_segments"))
+        .def("start", &tx_ring_buffer::start)
+        .def("stop", &tx_ring_buffer::stop, py::call_guard<py::gil_scoped_release>())
+        .def("acquire",
+            &tx_ring_buffer::acquire,
+            py::arg("timeout") = 0.1,
+            py::call_guard<py::gil_scoped_release>())
+        .def("commit", &tx_ring_buffer::commit)
+        .def("get_num_segments", &tx_ring_buffer::get_num_segments)
+        .def("get_segment_size", &tx_ring_buffer::get_segment_size)
+        .def("get_timeout_count", &tx_ring_buffer::get_timeout_count)
+        .def("get_notify_fd", &tx_ring_buffer::get_notify_fd)
+        .def("clear_notify", &tx_ring_buffer::clear_notify);
+
     py::class_<tx_streamer, tx_streamer::sptr>(m, "tx_streamer", "See: uhd::tx_streamer")
         // Methods
         .def("send",
@@ -181,7 +745,11 @@ void export_stream(py::module& m)
                 }
                 return py::cast(nullptr);
             },
-            py::arg("timeout") = 0.1);
+            py::arg("timeout") = 0.1)
+        .def("get_async_msg_fd",
+            &tx_streamer::get_async_msg_fd,
+            "Get a pollable fd for async message readiness (-1 if unsupported). "
+            "See: uhd::tx_streamer::get_async_msg_fd");
 }
 
 #endif /* INCLUDED_UHD_STREAM_PYTHON_HPP */
@@ -7,9 +7,18 @@
 
 #include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/zero_copy.hpp>
+#include <uhd/utils/log.hpp>
 #include <boost/shared_array.hpp>
+#include <cstring>
 #include <vector>
 
+#ifdef UHD_PLATFORM_LINUX
+#    include <sys/mman.h>
+#endif
+#ifdef HAVE_LIBNUMA
+#    include <numa.h>
+#endif
+
 using namespace uhd::transport;
 
 //! pad the byte count to a multiple of alignment
@@ -23,6 +32,21 @@ buffer_pool::~buffer_pool(void)
     /* NOP */
 }
 
+/***********************************************************************
+ * Process-wide external allocator registration
+ **********************************************************************/
+static buffer_pool::external_allocator::sptr ext_frame_allocator;
+
+void buffer_pool::set_external_allocator(external_allocator::sptr alloc)
+{
+    ext_frame_allocator = alloc;
+}
+
+buffer_pool::external_allocator::sptr buffer_pool::get_external_allocator()
+{
+    return ext_frame_allocator;
+}
+
 /***********************************************************************
  * Buffer pool implementation
  **********************************************************************/
@@ -50,6 +74,79 @@ private:
     boost::shared_array<char> _mem;
 };
 
+#ifdef UHD_PLATFORM_LINUX
+/***********************************************************************
+ * mmap-backed buffer pool implementation (hugepages and NUMA binding)
+ **********************************************************************/
+class buffer_pool_mmap_impl : public buffer_pool
+{
+public:
+    buffer_pool_mmap_impl(
+        const std::vector<ptr_type>& ptrs, void* mem, const size_t mem_size)
+        : _ptrs(ptrs), _mem(mem), _mem_size(mem_size)
+    {
+        /* NOP */
+    }
+
+    ~buffer_pool_mmap_impl() override
+    {
+        ::munmap(_mem, _mem_size);
+    }
+
+    ptr_type at(const size_t index) const override
+    {
+        return _ptrs.at(index);
+    }
+
+    size_t size(void) const override
+    {
+        return _ptrs.size();
+    }
+
+private:
+    std::vector<ptr_type> _ptrs;
+    void* _mem;
+    const size_t _mem_size;
+};
+#endif /* UHD_PLATFORM_LINUX */
+
+/***********************************************************************
+ * Externally allocated buffer pool implementation
+ **********************************************************************/
+class buffer_pool_ext_impl : public buffer_pool
+{
+public:
+    buffer_pool_ext_impl(const std::vector<ptr_type>& ptrs,
+        external_allocator::sptr alloc,
+        void* mem,
+        const size_t mem_size)
+        : _ptrs(ptrs), _alloc(alloc), _mem(mem), _mem_size(mem_size)
+    {
+        /* NOP */
+    }
+
+    ~buffer_pool_ext_impl() override
+    {
+        _alloc->deallocate(_mem, _mem_size);
+    }
+
+    ptr_type at(const size_t index) const override
+    {
+        return _ptrs.at(index);
+    }
+
+    size_t size(void) const override
+    {
+        return _ptrs.size();
+    }
+
+private:
+    std::vector<ptr_type> _ptrs;
+    external_allocator::sptr _alloc;
+    void* _mem;
+    const size_t _mem_size;
+};
+
 /***********************************************************************
  * Buffer pool factor function
  **********************************************************************/
@@ -74,3 +171,99 @@ buffer_pool::sptr buffer_pool::make(
     // - the reference to allocated memory.
     return sptr(new buffer_pool_impl(ptrs, mem));
 }
+
+buffer_pool::sptr buffer_pool::make(const size_t num_buffs,
+    const size_t buff_size,
+    const alloc_policy_t& policy,
+    const size_t alignment)
+{
+    if (policy.ext_alloc) {
+        const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
+        const size_t mem_size         = padded_buff_size * num_buffs + alignment - 1;
+
+        void* mem = policy.ext_alloc->allocate(mem_size, alignment);
+        if (!mem) {
+            UHD_LOG_ERROR(
+                "POOL", "External allocator failed to provide buffer pool memory");
+            throw std::bad_alloc();
+        }
+
+        const size_t mem_start = pad_to_boundary(size_t(mem), alignment);
+        std::vector<ptr_type> ptrs(num_buffs);
+        for (size_t i = 0; i < num_buffs; i++) {
+            ptrs[i] = ptr_type(mem_start + padded_buff_size * i);
+        }
+
+        return sptr(new buffer_pool_ext_impl(ptrs, policy.ext_alloc, mem, mem_size));
+    }
+
+    if (policy.numa_node < 0 && !policy.use_hugepages) {
+        return make(num_buffs, buff_size, alignment);
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
+    const size_t mem_size         = padded_buff_size * num_buffs + alignment - 1;
+
+    void* mem = MAP_FAILED;
+    if (policy.use_hugepages) {
+        mem = ::mmap(nullptr,
+            mem_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+            -1,
+            0);
+        if (mem == MAP_FAILED) {
+            UHD_LOG_WARNING("POOL",
+                "Could not allocate buffer pool from hugepages, falling back "
+                "to regular pages (check /proc/sys/vm/nr_hugepages)");
+        }
+    }
+    if (mem == MAP_FAILED) {
+        mem = ::mmap(nullptr,
+            mem_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0);
+    }
+    if (mem == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+
+    if (policy.numa_node >= 0) {
+#    ifdef HAVE_LIBNUMA
+        if (numa_available() >= 0 && policy.numa_node <= numa_max_node()) {
+            // Set the preferred node for the (not yet faulted-in) pages so
+            // they are allocated there when touched below
+            numa_tonode_memory(mem, mem_size, policy.numa_node);
+        } else {
+            UHD_LOG_WARNING("POOL",
+                "Cannot bind buffer pool to NUMA node " << policy.numa_node
+                                                        << ", node not available");
+        }
+#    else
+        UHD_LOG_WARNING("POOL",
+            "Cannot bind buffer pool to NUMA node "
+                << policy.numa_node << ", UHD was built without libnuma");
+#    endif
+    }
+
+    // Fault the pages in now (and on the bound node) rather than taking page
+    // faults on the streaming fast path
+    std::memset(mem, 0, mem_size);
+
+    const size_t mem_start = pad_to_boundary(size_t(mem), alignment);
+    std::vector<ptr_type> ptrs(num_buffs);
+    for (size_t i = 0; i < num_buffs; i++) {
+        ptrs[i] = ptr_type(mem_start + padded_buff_size * i);
+    }
+
+    return sptr(new buffer_pool_mmap_impl(ptrs, mem, mem_size));
+#else
+    UHD_LOG_WARNING("POOL",
+        "NUMA binding and hugepage backing are only supported on Linux, "
+        "using the default allocator");
+    return make(num_buffs, buff_size, alignment);
+#endif
+}
@@ -19,7 +19,13 @@ namespace uhd { namespace transport {
 
 namespace {
 constexpr double SEND_TIMEOUT_MS = 500; // seconds
-}
+
+// Number of frame buffers pooled per direction. With a single buffer, each
+// transaction must complete before the next can start; a small pool lets
+// callers pipeline outstanding requests (e.g. device discovery probing many
+// addresses) instead of serializing on buffer reuse.
+constexpr size_t DPDK_SIMPLE_NUM_FRAMES = 16;
+} // namespace
 
 class dpdk_simple_impl : public dpdk_simple
 {
@@ -164,10 +170,10 @@ private:
         link_params_t link_params;
         link_params.recv_frame_size = 8016;
         link_params.send_frame_size = 8016;
-        link_params.num_recv_frames = 1;
-        link_params.num_send_frames = 1;
-        link_params.recv_buff_size  = 8016;
-        link_params.send_buff_size  = 8016;
+        link_params.num_recv_frames = DPDK_SIMPLE_NUM_FRAMES;
+        link_params.num_send_frames = DPDK_SIMPLE_NUM_FRAMES;
+        link_params.recv_buff_size  = 8016 * DPDK_SIMPLE_NUM_FRAMES;
+        link_params.send_buff_size  = 8016 * DPDK_SIMPLE_NUM_FRAMES;
         return link_params;
     }
 
@@ -40,26 +40,52 @@ using namespace uhd::transport;
 using namespace uhd::transport::vrt;
 
 typedef size_t pred_type;
-typedef std::vector<pred_type> pred_table_type;
 #define pred_table_index(hdr) ((hdr >> 20) & 0x1ff)
 
-static pred_table_type get_pred_unpack_table(void)
+//layout descriptor for unpacking, precomputed per possible header word
+//word offsets point at the header word (0) when the field is absent,
+//so the unpack can load unconditionally and select branch-free
+struct unpack_layout_type
 {
-    pred_table_type table(1 << 9, 0); //only 9 bits useful here (20-28)
+    uint8_t sid_off;
+    uint8_t tsi_off;
+    uint8_t tsf_hi_off;
+    uint8_t tsf_lo_off;
+    uint8_t num_header_words;
+    uint8_t num_trailer_words;
+    bool has_sid, has_cid, has_tsi, has_tsf, has_tlr, eob, sob;
+};
+
+typedef std::vector<unpack_layout_type> unpack_layout_table_type;
+
+static unpack_layout_table_type get_unpack_layout_table(void)
+{
+    unpack_layout_table_type table(1 << 9); //only 9 bits useful here (20-28)
     for (size_t i = 0; i < table.size(); i++){
-        uint32_t vrt_hdr_word = i << 20;
-        if(vrt_hdr_word & ${hex(0x1 << 28)}) table[i] |= ${hex(sid_p)};
-        if(vrt_hdr_word & ${hex(0x1 << 27)}) table[i] |= ${hex(cid_p)};
-        if(vrt_hdr_word & ${hex(0x3 << 22)}) table[i] |= ${hex(tsi_p)};
-        if(vrt_hdr_word & ${hex(0x3 << 20)}) table[i] |= ${hex(tsf_p)};
-        if(vrt_hdr_word & ${hex(0x1 << 26)}) table[i] |= ${hex(tlr_p)};
-        if(vrt_hdr_word & ${hex(0x1 << 24)}) table[i] |= ${hex(eob_p)};
-        if(vrt_hdr_word & ${hex(0x1 << 25)}) table[i] |= ${hex(sob_p)};
+        const uint32_t vrt_hdr_word = uint32_t(i) << 20;
+        unpack_layout_type &layout = table[i];
+        uint8_t off = 1;
+        layout.has_sid = (vrt_hdr_word & ${hex(0x1 << 28)}) != 0;
+        if (layout.has_sid) layout.sid_off = off++;
+        layout.has_cid = (vrt_hdr_word & ${hex(0x1 << 27)}) != 0;
+        if (layout.has_cid) off += 2; //class ID not implemented, skip words
+        layout.has_tsi = (vrt_hdr_word & ${hex(0x3 << 22)}) != 0;
+        if (layout.has_tsi) layout.tsi_off = off++;
+        layout.has_tsf = (vrt_hdr_word & ${hex(0x3 << 20)}) != 0;
+        if (layout.has_tsf){
+            layout.tsf_hi_off = off++;
+            layout.tsf_lo_off = off++;
+        }
+        layout.has_tlr = (vrt_hdr_word & ${hex(0x1 << 26)}) != 0;
+        layout.num_trailer_words = layout.has_tlr? 1 : 0;
+        layout.eob = (vrt_hdr_word & ${hex(0x1 << 24)}) != 0;
+        layout.sob = (vrt_hdr_word & ${hex(0x1 << 25)}) != 0;
+        layout.num_header_words = off;
     }
     return table;
 }
 
-static const pred_table_type pred_unpack_table(get_pred_unpack_table());
+static const unpack_layout_table_type unpack_layout_table(get_unpack_layout_table());
 
 //maps trailer bits to num empty bytes
 //maps num empty bytes to trailer bits
@@ -183,77 +209,40 @@ UHD_INLINE void __if_hdr_unpack_${suffix}(
     if_packet_info.packet_type = if_packet_info_t::packet_type_t(vrt_hdr_word32 >> 29);
     if_packet_info.packet_count = (vrt_hdr_word32 >> 16) & 0xf;
 
-    const pred_type pred = pred_unpack_table[pred_table_index(vrt_hdr_word32)];
+    const unpack_layout_type &layout = unpack_layout_table[pred_table_index(vrt_hdr_word32)];
+
+    //another failure case
+    if (packet_words32 < size_t(layout.num_header_words) + layout.num_trailer_words)
+        throw uhd::value_error("bad vrt header or invalid packet length");
+
+    //absent fields have offset 0, so every load below hits the header word
+    //and stays in bounds; the selects compile to conditional moves
+    if_packet_info.has_sid = layout.has_sid;
+    if_packet_info.sid = layout.has_sid? ${XE_MACRO}(packet_buff[layout.sid_off]) : 0;
+    if_packet_info.has_cid = layout.has_cid;
+    if_packet_info.cid = 0; //not implemented
+    if_packet_info.has_tsi = layout.has_tsi;
+    if_packet_info.tsi = layout.has_tsi? ${XE_MACRO}(packet_buff[layout.tsi_off]) : 0;
+    if_packet_info.has_tsf = layout.has_tsf;
+    const uint64_t tsf = (uint64_t(${XE_MACRO}(packet_buff[layout.tsf_hi_off])) << 32)
+        | ${XE_MACRO}(packet_buff[layout.tsf_lo_off]);
+    if_packet_info.tsf = layout.has_tsf? tsf : 0;
+    if_packet_info.eob = layout.eob;
+    if_packet_info.sob = layout.sob;
 
     size_t empty_bytes = 0;
-
-    switch(pred){
-    % for pred in range(2**7):
-    case ${pred}:<% has_time_spec = False %><% num_header_words = 1 %>
-        ########## Stream ID ##########
-        % if pred & sid_p:
-            if_packet_info.has_sid = true;
-            if_packet_info.sid = ${XE_MACRO}(packet_buff[${num_header_words}]);<% num_header_words += 1 %>
-        % else:
-            if_packet_info.has_sid = false;
-        % endif
-        ########## Class ID ##########
-        % if pred & cid_p:
-            if_packet_info.has_cid = true;
-            if_packet_info.cid = 0; //not implemented<% num_header_words += 2 %>
-        % else:
-            if_packet_info.has_cid = false;
-        % endif
-        ########## Integer Time ##########
-        % if pred & tsi_p:
-            if_packet_info.has_tsi = true;
-            if_packet_info.tsi = ${XE_MACRO}(packet_buff[${num_header_words}]);
-<% num_header_words += 1 %>
-        % else:
-            if_packet_info.has_tsi = false;
-        % endif
-        ########## Fractional Time ##########
-        % if pred & tsf_p:
-            if_packet_info.has_tsf = true;
-            if_packet_info.tsf = uint64_t(${XE_MACRO}(packet_buff[${num_header_words}])) << 32;<% num_header_words += 1 %>
-            if_packet_info.tsf |= ${XE_MACRO}(packet_buff[${num_header_words}]);<% num_header_words += 1 %>
-        % else:
-            if_packet_info.has_tsf = false;
-        % endif
-        ########## Burst Flags ##########
-        % if pred & eob_p:
-            if_packet_info.eob = true;
-        % else:
-            if_packet_info.eob = false;
-        % endif
-        % if pred & sob_p:
-            if_packet_info.sob = true;
-        % else:
-            if_packet_info.sob = false;
-        % endif
-        ########## Trailer ##########
-        % if pred & tlr_p:
-            if_packet_info.has_tlr = true;
-            if_packet_info.tlr = ${XE_MACRO}(packet_buff[packet_words32-1]);<% num_trailer_words = 1 %>
-            {
-                const int indicators = (if_packet_info.tlr >> 20) & (if_packet_info.tlr >> 8);
-                if ((indicators & (1 << 0)) != 0) if_packet_info.eob = true;
-                if ((indicators & (1 << 1)) != 0) if_packet_info.sob = true;
-                empty_bytes = occ_table[(indicators >> 2) & 0x3];
-            }
-        % else:
-            if_packet_info.has_tlr = false;<% num_trailer_words = 0 %>
-        % endif
-        ########## Variables ##########
-            //another failure case
-            if (packet_words32 < ${num_header_words + num_trailer_words})
-                throw uhd::value_error("bad vrt header or invalid packet length");
-            if_packet_info.num_header_words32 = ${num_header_words};
-            if_packet_info.num_payload_words32 = packet_words32 - ${num_header_words + num_trailer_words};
-            if_packet_info.num_payload_bytes = if_packet_info.num_payload_words32*sizeof(uint32_t) - empty_bytes;
-        break;
-    % endfor
+    if_packet_info.has_tlr = layout.has_tlr;
+    if (layout.has_tlr){
+        if_packet_info.tlr = ${XE_MACRO}(packet_buff[packet_words32-1]);
+        const int indicators = (if_packet_info.tlr >> 20) & (if_packet_info.tlr >> 8);
+        if ((indicators & (1 << 0)) != 0) if_packet_info.eob = true;
+        if ((indicators & (1 << 1)) != 0) if_packet_info.sob = true;
+        empty_bytes = occ_table[(indicators >> 2) & 0x3];
     }
+    if_packet_info.num_header_words32 = layout.num_header_words;
+    if_packet_info.num_payload_words32 =
+        packet_words32 - layout.num_header_words - layout.num_trailer_words;
+    if_packet_info.num_payload_bytes = if_packet_info.num_payload_words32*sizeof(uint32_t) - empty_bytes;
 }
 
 /***********************************************************************
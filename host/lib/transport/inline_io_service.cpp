@@ -8,11 +8,88 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/utils/alloc_sentinel.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <boost/circular_buffer.hpp>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 namespace uhd { namespace transport {
 
+namespace {
+
+/*!
+ * Wait for a buffer on the link using the configured wait strategy. The
+ * spinning modes poll the link with a zero timeout instead of blocking in
+ * the link, to avoid kernel wakeup latency.
+ */
+frame_buff::uptr get_recv_buff_with_wait(recv_link_if* recv_link,
+    int32_t timeout_ms,
+    const inline_io_service::recv_wait_params_t& params)
+{
+    using recv_wait_mode_t = inline_io_service::recv_wait_mode_t;
+
+    if (params.mode == recv_wait_mode_t::BLOCK) {
+        return recv_link->get_recv_buff(timeout_ms);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    // A negative timeout means block until successful
+    const auto deadline = (timeout_ms < 0) ? start + std::chrono::hours(1)
+                                           : start + std::chrono::milliseconds(timeout_ms);
+    const auto spin_end = start + std::chrono::microseconds(params.spin_duration_us);
+
+    // Reading the clock costs tens of nanoseconds, which is on the order of a
+    // failed zero-timeout poll and would otherwise dominate the spin loop. The
+    // deadline is therefore only re-checked every CLOCK_CHECK_INTERVAL polls;
+    // timeouts are bookkeeping, so the coarser granularity (a few microseconds)
+    // does not matter.
+    constexpr uint32_t CLOCK_CHECK_INTERVAL = 64;
+
+    // Hot spin phase (the entire timeout for pure SPIN mode)
+    uint32_t polls = 0;
+    while (true) {
+        frame_buff::uptr buff = recv_link->get_recv_buff(0);
+        if (buff) {
+            return buff;
+        }
+        // Check on the first failed poll (so a zero timeout still returns
+        // immediately), then once per interval.
+        if (polls++ % CLOCK_CHECK_INTERVAL != 0) {
+            continue;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return frame_buff::uptr();
+        }
+        if (params.mode != recv_wait_mode_t::SPIN && now >= spin_end) {
+            break;
+        }
+    }
+
+    if (params.mode == recv_wait_mode_t::SPIN_BLOCK) {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        return recv_link->get_recv_buff(
+            std::max<int32_t>(0, static_cast<int32_t>(remaining.count())));
+    }
+
+    // SPIN_YIELD: keep polling, but let other threads run in between
+    while (std::chrono::steady_clock::now() < deadline) {
+        frame_buff::uptr buff = recv_link->get_recv_buff(0);
+        if (buff) {
+            return buff;
+        }
+        std::this_thread::yield();
+    }
+    return recv_link->get_recv_buff(0);
+}
+
+} // namespace
+
 /*!
  * Interface class for unifying callback processing between both inline_send_io
  * and inline_recv_io
@@ -50,7 +127,9 @@ protected:
 class inline_recv_mux
 {
 public:
-    inline_recv_mux(recv_link_if* link) : _link(link){};
+    inline_recv_mux(
+        recv_link_if* link, const inline_io_service::recv_wait_params_t& wait_params)
+        : _link(link), _wait_params(wait_params){};
 
     ~inline_recv_mux(){};
 
@@ -86,6 +165,11 @@ public:
         delete queue;
         _queues.erase(cb);
         _callbacks.remove(cb);
+        for (auto& entry : _epid_table) {
+            if (entry == cb) {
+                entry = nullptr;
+            }
+        }
     }
 
     /*!
@@ -113,28 +197,24 @@ public:
             return frame_buff::uptr(buff);
         }
         while (true) {
-            frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+            frame_buff::uptr buff =
+                get_recv_buff_with_wait(recv_link, timeout_ms, _wait_params);
             /* Process buffer */
             if (buff) {
-                bool rcvr_found = false;
-                for (auto& rcvr : _callbacks) {
-                    if (rcvr->callback(buff, recv_link)) {
-                        rcvr_found = true;
-                        if (buff) {
-                            if (rcvr == cb) {
-                                return frame_buff::uptr(std::move(buff));
-                            } else {
-                                /* NOTE: Should not overflow, by construction
-                                 * Every queue can hold link->get_num_recv_frames()
-                                 */
-                                _queues[rcvr]->push_back(buff.release());
-                            }
+                inline_recv_cb* rcvr = match_packet(buff, recv_link);
+                if (rcvr) {
+                    if (buff) {
+                        if (rcvr == cb) {
+                            return frame_buff::uptr(std::move(buff));
+                        } else {
+                            /* NOTE: Should not overflow, by construction
+                             * Every queue can hold link->get_num_recv_frames()
+                             */
+                            _queues[rcvr]->push_back(buff.release());
                         }
-                        /* Continue looping if buffer was consumed */
-                        break;
                     }
-                }
-                if (not rcvr_found) {
+                    /* Continue looping if buffer was consumed */
+                } else {
                     UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
                     recv_link->release_recv_buff(std::move(buff));
                 }
@@ -147,29 +227,24 @@ public:
     bool recv_flow_ctrl(inline_recv_cb* cb, recv_link_if* recv_link, int32_t timeout_ms)
     {
         while (true) {
-            frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+            frame_buff::uptr buff =
+                get_recv_buff_with_wait(recv_link, timeout_ms, _wait_params);
             /* Process buffer */
             if (buff) {
-                bool rcvr_found = false;
-                for (auto& rcvr : _callbacks) {
-                    if (rcvr->callback(buff, recv_link)) {
-                        rcvr_found = true;
-                        if (rcvr == cb) {
-                            assert(!buff);
-                            return true;
-                        } else if (buff) {
-                            /* NOTE: Should not overflow, by construction
-                             * Every queue can hold link->get_num_recv_frames()
-                             */
-                            _queues[rcvr]->push_back(buff.release());
-                        } else {
-                            /* Continue looping if buffer was consumed and
-                               receiver is not the requested one */
-                            break;
-                        }
+                inline_recv_cb* rcvr = match_packet(buff, recv_link);
+                if (rcvr) {
+                    if (rcvr == cb) {
+                        assert(!buff);
+                        return true;
+                    } else if (buff) {
+                        /* NOTE: Should not overflow, by construction
+                         * Every queue can hold link->get_num_recv_frames()
+                         */
+                        _queues[rcvr]->push_back(buff.release());
                     }
-                }
-                if (not rcvr_found) {
+                    /* Continue looping if buffer was consumed and
+                       receiver is not the requested one */
+                } else {
                     UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
                     recv_link->release_recv_buff(std::move(buff));
                 }
@@ -180,9 +255,78 @@ public:
     }
 
 private:
+    /*!
+     * Extract the CHDR dst_epid from a packet buffer
+     *
+     * The CHDR header is the first 64-bit word of the packet and carries the
+     * destination EPID in its least significant 16 bits; every link in UHD
+     * uses little-endian CHDR on the wire, so the EPID is simply the first
+     * two bytes. Packets too short for a CHDR header yield no EPID.
+     *
+     * \param buff the packet buffer
+     * \param[out] epid the destination EPID
+     * \return whether an EPID could be extracted
+     */
+    static UHD_FORCE_INLINE bool extract_dst_epid(
+        const frame_buff::uptr& buff, uint16_t& epid)
+    {
+        if (buff->packet_size() < sizeof(uint64_t)) {
+            return false;
+        }
+        const uint8_t* bytes = static_cast<const uint8_t*>(buff->data());
+        epid                 = uint16_t(bytes[0]) | (uint16_t(bytes[1]) << 8);
+        return true;
+    }
+
+    /*!
+     * Find the receiver a packet is destined for
+     *
+     * Dispatch is a direct-indexed lookup in a flat EPID -> receiver table
+     * (EPIDs are small integers from the EPID allocator), learned from the
+     * first packet each endpoint claims, so steady-state demux cost does not
+     * grow with the number of endpoints sharing the link. On a table miss,
+     * or when the table's receiver declines the packet (e.g., control and
+     * management callbacks share an EPID and match on packet type), fall
+     * back to the linear callback walk and update the table with whichever
+     * receiver claims the packet.
+     *
+     * \param buff the packet buffer (consumed or released per the callback)
+     * \param recv_link the link the packet arrived on
+     * \return the receiver that claimed the packet, or nullptr
+     */
+    UHD_FORCE_INLINE inline_recv_cb* match_packet(
+        frame_buff::uptr& buff, recv_link_if* recv_link)
+    {
+        uint16_t epid        = 0;
+        const bool have_epid = extract_dst_epid(buff, epid);
+        inline_recv_cb* hint =
+            (have_epid && epid < _epid_table.size()) ? _epid_table[epid] : nullptr;
+        if (hint && hint->callback(buff, recv_link)) {
+            return hint;
+        }
+        for (auto& rcvr : _callbacks) {
+            if (rcvr == hint) {
+                continue;
+            }
+            if (rcvr->callback(buff, recv_link)) {
+                if (have_epid) {
+                    if (epid >= _epid_table.size()) {
+                        _epid_table.resize(epid + 1, nullptr);
+                    }
+                    _epid_table[epid] = rcvr;
+                }
+                return rcvr;
+            }
+        }
+        return nullptr;
+    }
+
     recv_link_if* _link;
     std::list<inline_recv_cb*> _callbacks;
     std::unordered_map<inline_recv_cb*, boost::circular_buffer<frame_buff*>*> _queues;
+    //! Flat demux table indexed by CHDR dst_epid (see match_packet())
+    std::vector<inline_recv_cb*> _epid_table;
+    const inline_io_service::recv_wait_params_t _wait_params;
 };
 
 class inline_recv_io : public virtual recv_io_if, public virtual inline_recv_cb
@@ -217,18 +361,22 @@ public:
 
     frame_buff::uptr get_recv_buff(int32_t timeout_ms) override
     {
+        UHD_ALLOC_SENTINEL_SCOPE("inline_io::get_recv_buff");
         auto buff = _io_srv->recv(this, _data_link.get(), timeout_ms);
         if (buff) {
             _num_frames_in_use++;
             assert(_num_frames_in_use <= _num_recv_frames);
         }
+        UHD_TRACEPOINT(io_recv_buff_get, _data_link.get(), _num_frames_in_use);
         return buff;
     }
 
     void release_recv_buff(frame_buff::uptr buff) override
     {
+        UHD_ALLOC_SENTINEL_SCOPE("inline_io::release_recv_buff");
         _fc_cb(frame_buff::uptr(std::move(buff)), _data_link.get(), _fc_link.get());
         _num_frames_in_use--;
+        UHD_TRACEPOINT(io_recv_buff_release, _data_link.get(), _num_frames_in_use);
     }
 
 private:
@@ -292,20 +440,23 @@ public:
 
     frame_buff::uptr get_send_buff(int32_t timeout_ms) override
     {
+        UHD_ALLOC_SENTINEL_SCOPE("inline_io::get_send_buff");
         frame_buff::uptr buff = _send_link->get_send_buff(timeout_ms);
         if (buff) {
             _num_frames_in_use++;
             assert(_num_frames_in_use <= _num_send_frames);
-            return frame_buff::uptr(std::move(buff));
         }
-        return frame_buff::uptr();
+        UHD_TRACEPOINT(io_send_buff_get, _send_link.get(), _num_frames_in_use);
+        return buff;
     }
 
     void release_send_buff(frame_buff::uptr buff) override
     {
+        UHD_ALLOC_SENTINEL_SCOPE("inline_io::release_send_buff");
         // Send the packet using callback
         _send_cb(std::move(buff), _send_link.get());
         _num_frames_in_use--;
+        UHD_TRACEPOINT(io_send_buff_release, _send_link.get(), _num_frames_in_use);
     }
 
 private:
@@ -432,7 +583,7 @@ void inline_io_service::connect_receiver(
     if (mux) {
         mux->connect(cb);
     } else if (rcvr) {
-        mux = new inline_recv_mux(link);
+        mux = new inline_recv_mux(link, _wait_params);
         mux->connect(rcvr);
         mux->connect(cb);
         rcvr = nullptr;
@@ -474,7 +625,8 @@ frame_buff::uptr inline_io_service::recv(
     }
 
     while (true) {
-        frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+        frame_buff::uptr buff =
+            get_recv_buff_with_wait(recv_link, timeout_ms, _wait_params);
         /* Process buffer */
         if (buff) {
             if (rcvr->callback(buff, recv_link)) {
@@ -507,7 +659,8 @@ bool inline_io_service::recv_flow_ctrl(
     }
 
     while (true) {
-        frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
+        frame_buff::uptr buff =
+            get_recv_buff_with_wait(recv_link, timeout_ms, _wait_params);
         /* Process buffer */
         if (buff) {
             if (rcvr->callback(buff, recv_link)) {
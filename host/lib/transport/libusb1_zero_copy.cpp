@@ -19,6 +19,14 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
+
+// libusb_dev_mem_alloc() is only available in libusb 1.0.21 and later; at
+// runtime it returns NULL on kernels without usbfs mmap support, which we
+// handle by falling back to heap buffers.
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+#    define HAVE_LIBUSB_DEV_MEM_ALLOC
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -221,7 +229,6 @@ public:
         : _handle(handle)
         , _num_frames(num_frames)
         , _frame_size(frame_size)
-        , _buffer_pool(buffer_pool::make(_num_frames, _frame_size))
         , _enqueued(_num_frames)
         , _released(_num_frames)
         , _status(STATUS_RUNNING)
@@ -248,6 +255,45 @@ public:
                     break;
             }
 
+        // Try to allocate the frames from usbfs zero-copy device memory
+        // first. These pages are mmap'd from the kernel and are directly
+        // DMA-visible, so the kernel skips the bounce-buffer memcpy on every
+        // transfer. Fall back to regular heap memory if the kernel or libusb
+        // lacks support.
+        std::vector<unsigned char*> frame_mem(get_num_frames(), nullptr);
+#ifdef HAVE_LIBUSB_DEV_MEM_ALLOC
+        _using_dev_mem = true;
+        for (size_t i = 0; i < get_num_frames(); i++) {
+            unsigned char* mem =
+                libusb_dev_mem_alloc(_handle->get(), this->get_frame_size());
+            if (mem == nullptr) {
+                _using_dev_mem = false;
+                break;
+            }
+            _dev_mem_buffs.push_back(mem);
+        }
+        if (_using_dev_mem) {
+            for (size_t i = 0; i < get_num_frames(); i++) {
+                frame_mem[i] = _dev_mem_buffs[i];
+            }
+            UHD_LOGGER_DEBUG("USB")
+                << "Using usbfs zero-copy device memory for " << name << " frames";
+        } else {
+            for (unsigned char* mem : _dev_mem_buffs) {
+                libusb_dev_mem_free(_handle->get(), mem, this->get_frame_size());
+            }
+            _dev_mem_buffs.clear();
+            UHD_LOGGER_DEBUG("USB")
+                << "usbfs zero-copy memory not available, using heap buffers";
+        }
+#endif
+        if (!_using_dev_mem) {
+            _buffer_pool = buffer_pool::make(_num_frames, _frame_size);
+            for (size_t i = 0; i < get_num_frames(); i++) {
+                frame_mem[i] = static_cast<unsigned char*>(_buffer_pool->at(i));
+            }
+        }
+
         // allocate libusb transfer structs and managed buffers
         for (size_t i = 0; i < get_num_frames(); i++) {
             libusb_transfer* lut = libusb_alloc_transfer(0);
@@ -264,7 +310,7 @@ public:
             libusb_fill_bulk_transfer(lut, // transfer
                 _handle->get(), // dev_handle
                 endpoint, // endpoint
-                static_cast<unsigned char*>(_buffer_pool->at(i)), // buffer
+                frame_mem[i], // buffer
                 int(this->get_frame_size()), // length
                 libusb_transfer_cb_fn(&libusb_async_cb), // callback
                 static_cast<void*>(&_mb_pool.back()->result), // user_data
@@ -302,6 +348,12 @@ public:
         for (libusb_transfer* lut : _all_luts) {
             libusb_free_transfer(lut);
         }
+
+#ifdef HAVE_LIBUSB_DEV_MEM_ALLOC
+        for (unsigned char* mem : _dev_mem_buffs) {
+            libusb_dev_mem_free(_handle->get(), mem, this->get_frame_size());
+        }
+#endif
     }
 
     template <typename buffer_type>
@@ -349,6 +401,9 @@ private:
 
     //! Storage for transfer related objects
     buffer_pool::sptr _buffer_pool;
+    //! Frames allocated from usbfs zero-copy device memory, if supported
+    std::vector<unsigned char*> _dev_mem_buffs;
+    bool _using_dev_mem = false;
     std::vector<std::shared_ptr<libusb_zero_copy_mb>> _mb_pool;
 
     std::mutex _queue_mutex;
@@ -50,12 +50,14 @@ const size_t page_size = get_page_size();
  *****************************************************************************/
 nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
     uint32_t instance,
-    const link_params_t& params)
+    const link_params_t& params,
+    const size_t dma_ring_size)
     : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
     , send_link_base_t(params.num_send_frames, params.send_frame_size)
     , _fpga_session(fpga_session)
     , _fifo_instance(instance)
     , _link_params(params)
+    , _dma_ring_size(dma_ring_size)
 {
     UHD_LOG_TRACE("NIRIO", "Creating PCIe transport for channel " << instance);
     UHD_LOGGER_TRACE("NIRIO")
@@ -102,21 +104,30 @@ nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
     nirio_status_chain(_fpga_session->create_tx_fifo(_fifo_instance, _send_fifo), status);
 
     if ((_recv_fifo.get() != NULL) && (_send_fifo.get() != NULL)) {
-        // Initialize FIFOs
-        nirio_status_chain(_recv_fifo->initialize((_link_params.recv_frame_size
-                                                      * _link_params.num_recv_frames)
-                                                      / sizeof(fifo_data_t),
-                               _link_params.recv_frame_size / sizeof(fifo_data_t),
-                               actual_depth,
-                               actual_size),
+        // Initialize FIFOs. The DMA rings may be deeper than the transport's
+        // circular buffer so the DMA engine can keep transferring while the
+        // host catches up on a burst.
+        const size_t recv_ring_bytes = std::max(
+            _dma_ring_size, _link_params.recv_frame_size * _link_params.num_recv_frames);
+        const size_t send_ring_bytes = std::max(
+            _dma_ring_size, _link_params.send_frame_size * _link_params.num_send_frames);
+
+        nirio_status_chain(
+            _recv_fifo->initialize(recv_ring_bytes / sizeof(fifo_data_t),
+                _link_params.recv_frame_size / sizeof(fifo_data_t),
+                actual_depth,
+                actual_size),
             status);
-        nirio_status_chain(_send_fifo->initialize((_link_params.send_frame_size
-                                                      * _link_params.num_send_frames)
-                                                      / sizeof(fifo_data_t),
-                               _link_params.send_frame_size / sizeof(fifo_data_t),
-                               actual_depth,
-                               actual_size),
+        UHD_LOGGER_TRACE("NIRIO")
+            << boost::format("RX DMA ring depth = %u elements") % actual_depth;
+        nirio_status_chain(
+            _send_fifo->initialize(send_ring_bytes / sizeof(fifo_data_t),
+                _link_params.send_frame_size / sizeof(fifo_data_t),
+                actual_depth,
+                actual_size),
             status);
+        UHD_LOGGER_TRACE("NIRIO")
+            << boost::format("TX DMA ring depth = %u elements") % actual_depth;
 
         PROXY->get_rio_quirks().add_tx_fifo(_fifo_instance);
 
@@ -154,6 +165,15 @@ nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
 
 nirio_link::~nirio_link()
 {
+    // Report poll-miss rates so the adaptive wait can be tuned per machine
+    const auto rx_stats = get_recv_stats();
+    const auto tx_stats = get_send_stats();
+    UHD_LOGGER_DEBUG("NIRIO")
+        << boost::format("DMA channel %u RX: %u packets, %u poll misses; "
+                         "TX: %u packets, %u poll misses")
+               % _fifo_instance % rx_stats.num_packets % rx_stats.num_timeouts
+               % tx_stats.num_packets % tx_stats.num_timeouts;
+
     PROXY->get_rio_quirks().remove_tx_fifo(_fifo_instance);
 
     // Disable DMA streams (cleanup, so don't status chain)
@@ -298,7 +318,26 @@ nirio_link::sptr nirio_link::make(uhd::niusrprio::niusrprio_session::sptr fpga_s
     recv_buff_size = link_params.num_recv_frames * link_params.recv_frame_size;
     send_buff_size = link_params.num_send_frames * link_params.send_frame_size;
 
-    return nirio_link::sptr(new nirio_link(fpga_session, instance, link_params));
+    // Kernel DMA ring depth. Unlike the frame/buffer hints above, this only
+    // affects how much memory the kernel driver sets aside for the DMA
+    // engine, not the size of the transport's circular buffer.
+    const size_t dma_ring_size =
+        static_cast<size_t>(hints.cast<double>("dma_ring_size", 0.0));
+
+    if (hints.has_key("dma_ring_size")) {
+        if (dma_ring_size % page_size != 0) {
+            throw uhd::value_error(
+                (boost::format("dma_ring_size must be multiple of %d") % page_size)
+                    .str());
+        }
+        if (dma_ring_size < std::max(recv_buff_size, send_buff_size)) {
+            throw uhd::value_error("dma_ring_size must be equal to or greater than "
+                                   "the recv and send buffer sizes");
+        }
+    }
+
+    return nirio_link::sptr(
+        new nirio_link(fpga_session, instance, link_params, dma_ring_size));
 }
 
 
@@ -10,7 +10,7 @@
 #include <uhdlib/transport/frame_reservation_mgr.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <uhdlib/transport/offload_io_service_client.hpp>
-#include <uhdlib/utils/semaphore.hpp>
+#include <uhdlib/utils/thread_policy.hpp>
 #include <condition_variable>
 #include <boost/lockfree/queue.hpp>
 #include <atomic>
@@ -18,6 +18,8 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <thread>
 
 namespace uhd { namespace transport {
@@ -26,12 +28,31 @@ namespace {
 
 constexpr int32_t blocking_timeout_ms = 10;
 
-// Fixed-size queue that supports blocking semantics
+// Assumed size of a cache line, used to pad the queue indices so that
+// producer and consumer do not false-share a cache line
+constexpr size_t cache_line_size = 64;
+
+// Number of spin iterations before a blocking pop falls back to a futex wait
+constexpr size_t blocking_spin_iterations = 1000;
+
+// Number of buffers serviced per client claim in the shared worker pool.
+// Stealing only at batch granularity keeps a burst of packets for one client
+// on a single core, preserving cache locality.
+constexpr size_t pool_batch_size = 8;
+
+// Fixed-size lock-free SPSC queue that supports blocking semantics
+//
+// The producer and consumer communicate only through a pair of monotonic
+// counters on separate cache lines, so neither side takes a lock on the
+// per-packet path. The condition variable is only touched when a consumer
+// configured for BLOCK mode has exhausted its spin budget; in POLL mode the
+// queue never takes a futex.
 template <typename queue_item_t>
 class offload_thread_queue
 {
 public:
-    offload_thread_queue(size_t size) : _buffer(new queue_item_t[size]), _capacity(size)
+    offload_thread_queue(size_t size, offload_io_service::wait_mode_t wait_mode)
+        : _buffer(new queue_item_t[size]), _capacity(size), _wait_mode(wait_mode)
     {
     }
 
@@ -42,57 +63,111 @@ public:
 
     void push(const queue_item_t& item)
     {
-        _buffer[_write_index++] = item;
-        _write_index %= _capacity;
-        _item_sem.notify();
+        const size_t write_count          = _write_count.load(std::memory_order_relaxed);
+        _buffer[write_count % _capacity] = item;
+        _write_count.store(write_count + 1, std::memory_order_release);
+
+        if (_wait_mode == offload_io_service::BLOCK
+            && _num_waiters.load(std::memory_order_acquire) != 0) {
+            // Synchronize with the waiter registration in pop() to avoid a
+            // lost wakeup, then wake the consumer
+            std::lock_guard<std::mutex> lock(_cv_mutex);
+            _cv.notify_one();
+        }
+    }
+
+    // Push a group of items with a single counter publication and at most one
+    // wakeup. make_item(i) provides the i-th item of the batch.
+    template <typename make_item_t>
+    void push_batch(make_item_t make_item, const size_t count)
+    {
+        const size_t write_count = _write_count.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; i++) {
+            _buffer[(write_count + i) % _capacity] = make_item(i);
+        }
+        _write_count.store(write_count + count, std::memory_order_release);
+
+        if (_wait_mode == offload_io_service::BLOCK
+            && _num_waiters.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(_cv_mutex);
+            _cv.notify_one();
+        }
     }
 
     bool peek(queue_item_t& item)
     {
-        if (_item_sem.count()) {
-            item = _buffer[_read_index];
-            return true;
-        } else {
+        const size_t read_count = _read_count.load(std::memory_order_relaxed);
+        if (_write_count.load(std::memory_order_acquire) == read_count) {
             return false;
         }
+        item = _buffer[read_count % _capacity];
+        return true;
     }
 
     bool pop(queue_item_t& item)
     {
-        if (_item_sem.try_wait()) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
+        const size_t read_count = _read_count.load(std::memory_order_relaxed);
+        if (_write_count.load(std::memory_order_acquire) == read_count) {
             return false;
         }
+        item = _buffer[read_count % _capacity];
+        _read_count.store(read_count + 1, std::memory_order_release);
+        return true;
     }
 
     bool pop(queue_item_t& item, int32_t timeout_ms)
     {
-        if (_item_sem.wait_for(timeout_ms)) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
-            return false;
+        // Spin for a bounded number of iterations before sleeping, since at
+        // high packet rates the next item usually arrives within the spin
+        // budget
+        for (size_t i = 0; i < blocking_spin_iterations; i++) {
+            if (pop(item)) {
+                return true;
+            }
         }
+
+        if (_wait_mode == offload_io_service::POLL) {
+            const auto deadline = std::chrono::steady_clock::now()
+                                  + std::chrono::milliseconds(timeout_ms);
+            while (std::chrono::steady_clock::now() < deadline) {
+                if (pop(item)) {
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+            return pop(item);
+        }
+
+        std::unique_lock<std::mutex> lock(_cv_mutex);
+        _num_waiters.fetch_add(1, std::memory_order_release);
+        const bool success =
+            _cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this, &item]() {
+                return pop(item);
+            });
+        _num_waiters.fetch_sub(1, std::memory_order_release);
+        return success;
     }
 
     size_t read_available()
     {
-        return _item_sem.count();
+        return _write_count.load(std::memory_order_acquire)
+               - _read_count.load(std::memory_order_acquire);
     }
 
 private:
     queue_item_t* _buffer;
     const size_t _capacity;
+    const offload_io_service::wait_mode_t _wait_mode;
 
-    size_t _read_index  = 0;
-    size_t _write_index = 0;
+    // Monotonic producer and consumer counters, padded to separate cache
+    // lines. An entry is readable when read count < write count.
+    alignas(cache_line_size) std::atomic<size_t> _write_count{0};
+    alignas(cache_line_size) std::atomic<size_t> _read_count{0};
 
-    // Semaphore gating number of items available to read
-    semaphore _item_sem;
+    // Mutex and condition variable for the blocking slow path only
+    alignas(cache_line_size) std::atomic<size_t> _num_waiters{0};
+    std::mutex _cv_mutex;
+    std::condition_variable _cv;
 };
 
 // Object that implements the communication between client and offload thread
@@ -101,9 +176,9 @@ struct client_port_impl_t
 public:
     using sptr = std::shared_ptr<client_port_impl_t>;
 
-    client_port_impl_t(size_t size)
-        : _from_offload_thread(size)
-        , _to_offload_thread(size + 1) // add one for disconnect command
+    client_port_impl_t(size_t size, offload_io_service::wait_mode_t wait_mode)
+        : _from_offload_thread(size, wait_mode)
+        , _to_offload_thread(size + 1, wait_mode) // add one for disconnect command
     {
     }
 
@@ -135,6 +210,17 @@ public:
         _to_offload_thread.push(queue_element);
     }
 
+    // Push a batch of buffers in one queue transaction. Ownership of all
+    // buffers transfers to the offload thread.
+    void client_push(frame_buff::uptr* buffs, const size_t count)
+    {
+        _to_offload_thread.push_batch(
+            [buffs](const size_t i) {
+                return to_offload_thread_t{buffs[i].release(), false};
+            },
+            count);
+    }
+
     void client_wait_until_connected()
     {
         std::unique_lock<std::mutex> lock(_connect_cv_mutex);
@@ -294,13 +380,29 @@ private:
     };
     using client_req_queue_t = boost::lockfree::queue<client_req_t>;
 
-    // Values used by offload thread for each client
+    // Claim token for the shared worker pool: a worker owns all the clients
+    // sharing the token for one batch at a time. Clients that touch the same
+    // links (muxed links, or the RX data and TX flow control clients of a
+    // full-duplex channel) share one token, since neither the links nor the
+    // inline I/O service tolerate concurrent access.
+    struct pool_claim_t
+    {
+        std::atomic_flag claimed = ATOMIC_FLAG_INIT;
+    };
+
+    // Values used by offload thread for each client. Clients are held via
+    // shared_ptr since the atomic disconnect flag makes the struct
+    // non-copyable.
     struct recv_client_info_t
     {
         client_port_t::sptr port;
         recv_io_if::sptr inline_io;
         size_t num_frames_in_use = 0;
         frame_reservation_t frames_reserved;
+        std::shared_ptr<pool_claim_t> claim;
+        // Set when a disconnect request was received, so other workers skip
+        // the client until it is removed from the list
+        std::atomic<bool> disconnecting{false};
     };
     struct send_client_info_t
     {
@@ -308,9 +410,12 @@ private:
         send_io_if::sptr inline_io;
         size_t num_frames_in_use = 0;
         frame_reservation_t frames_reserved;
+        std::shared_ptr<pool_claim_t> claim;
+        std::atomic<bool> disconnecting{false};
     };
 
     void _queue_client_req(std::function<void()> fn);
+    std::shared_ptr<pool_claim_t> _get_pool_claim(void* link_key);
     void _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
     void _get_send_buff(send_client_info_t& info);
     void _release_recv_buff(recv_client_info_t& info, frame_buff* buff);
@@ -324,17 +429,28 @@ private:
     template <bool allow_recv, bool allow_send>
     void _do_work_blocking();
 
+    void _do_work_pool();
+
     // The I/O service that executes within the offload thread
     io_service::sptr _io_srv;
 
-    // Offload thread, its stop flag, and thread-related parameters
-    std::unique_ptr<std::thread> _offload_thread;
+    // Offload threads, their stop flag, and thread-related parameters
+    std::vector<std::thread> _offload_threads;
     std::atomic<bool> _stop_offload_thread{false};
     offload_io_service::params_t _offload_thread_params;
 
     // Lists of clients and their respective queues
-    std::list<recv_client_info_t> _recv_clients;
-    std::list<send_client_info_t> _send_clients;
+    std::list<std::shared_ptr<recv_client_info_t>> _recv_clients;
+    std::list<std::shared_ptr<send_client_info_t>> _send_clients;
+
+    // Guards client list membership in the shared worker pool: workers hold
+    // it shared while servicing clients, and exclusively to execute connect
+    // and disconnect requests. Uncontended with a single worker thread.
+    std::shared_mutex _pool_mutex;
+
+    // Claim tokens by link, so clients sharing a link share a token. Only
+    // accessed while connecting clients.
+    std::map<void*, std::weak_ptr<pool_claim_t>> _pool_claims;
 
     // Queue for connect and disconnect client requests
     client_req_queue_t _client_connect_queue;
@@ -368,6 +484,19 @@ offload_io_service_impl::offload_io_service_impl(
             "the other");
     }
 
+    if (params.num_worker_threads > 1) {
+        if (params.wait_mode != POLL) {
+            throw uhd::value_error(
+                "An I/O service with a shared worker pool must be configured "
+                "to poll, since blocking in one client would stall the other "
+                "clients serviced by the same worker");
+        }
+        for (size_t i = 0; i < params.num_worker_threads; i++) {
+            _offload_threads.emplace_back([this]() { _do_work_pool(); });
+        }
+        return;
+    }
+
     std::function<void()> thread_fn;
 
     if (params.wait_mode == BLOCK) {
@@ -392,15 +521,15 @@ offload_io_service_impl::offload_io_service_impl(
         UHD_THROW_INVALID_CODE_PATH();
     }
 
-    _offload_thread = std::make_unique<std::thread>(thread_fn);
+    _offload_threads.emplace_back(thread_fn);
 }
 
 offload_io_service_impl::~offload_io_service_impl()
 {
     _stop_offload_thread = true;
 
-    if (_offload_thread) {
-        _offload_thread->join();
+    for (auto& thread : _offload_threads) {
+        thread.join();
     }
 
     assert(_recv_clients.empty());
@@ -463,13 +592,14 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
     size_t num_send_frames,
     recv_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(!_offload_threads.empty());
 
     if (_offload_thread_params.client_type == SEND_ONLY) {
         throw uhd::runtime_error("Recv client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_recv_frames);
+    auto port = std::make_shared<client_port_t>(
+        num_recv_frames, _offload_thread_params.wait_mode);
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn =
@@ -481,10 +611,11 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
             auto inline_recv_io = _io_srv->make_recv_client(
                 recv_link, num_recv_frames, cb, fc_link, num_send_frames, fc_cb);
 
-            recv_client_info_t client_info;
-            client_info.inline_io       = inline_recv_io;
-            client_info.port            = port;
-            client_info.frames_reserved = frames;
+            auto client_info             = std::make_shared<recv_client_info_t>();
+            client_info->inline_io       = inline_recv_io;
+            client_info->port            = port;
+            client_info->frames_reserved = frames;
+            client_info->claim           = _get_pool_claim(recv_link.get());
 
             _recv_clients.push_back(client_info);
 
@@ -513,13 +644,14 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     recv_callback_t recv_cb,
     send_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(!_offload_threads.empty());
 
     if (_offload_thread_params.client_type == RECV_ONLY) {
         throw uhd::runtime_error("Send client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_send_frames);
+    auto port = std::make_shared<client_port_t>(
+        num_send_frames, _offload_thread_params.wait_mode);
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn = [this,
@@ -543,10 +675,14 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
             recv_cb,
             fc_cb);
 
-        send_client_info_t client_info;
-        client_info.inline_io       = inline_send_io;
-        client_info.port            = port;
-        client_info.frames_reserved = frames;
+        auto client_info             = std::make_shared<send_client_info_t>();
+        client_info->inline_io       = inline_send_io;
+        client_info->port            = port;
+        client_info->frames_reserved = frames;
+        // Flow control responses arrive on recv_link, so key the claim on it
+        // to serialize with the RX data client of the same link
+        client_info->claim =
+            _get_pool_claim(recv_link ? (void*)recv_link.get() : (void*)send_link.get());
 
         _send_clients.push_back(client_info);
 
@@ -582,6 +718,27 @@ void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
     }
 }
 
+// Look up or create the claim token for a link. Runs in the offload thread
+// while connecting a client (under the exclusive pool lock in pool mode).
+std::shared_ptr<offload_io_service_impl::pool_claim_t>
+offload_io_service_impl::_get_pool_claim(void* link_key)
+{
+    auto it = _pool_claims.find(link_key);
+    if (it != _pool_claims.end()) {
+        if (auto claim = it->second.lock()) {
+            return claim;
+        }
+    }
+    auto claim             = std::make_shared<pool_claim_t>();
+    _pool_claims[link_key] = claim;
+
+    // Prune tokens whose clients have all disconnected
+    for (auto jt = _pool_claims.begin(); jt != _pool_claims.end();) {
+        jt = jt->second.expired() ? _pool_claims.erase(jt) : std::next(jt);
+    }
+    return claim;
+}
+
 // Get a single receive buffer if available and update client info
 void offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
 {
@@ -654,6 +811,8 @@ void offload_io_service_impl::_disconnect_send_client(send_client_info_t& info)
 template <bool allow_recv, bool allow_send>
 void offload_io_service_impl::_do_work_polling()
 {
+    // Global role policy first; the per-stream affinity arg takes precedence
+    uhd::apply_thread_policy("offload");
     uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
 
     client_req_t client_req;
@@ -662,18 +821,18 @@ void offload_io_service_impl::_do_work_polling()
         if (allow_recv) {
             // Get recv buffers
             for (auto& recv_info : _recv_clients) {
-                _get_recv_buff(recv_info, 0);
+                _get_recv_buff(*recv_info, 0);
             }
 
             // Release recv buffers
             for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
                 frame_buff* buff;
                 bool disconnect;
-                std::tie(buff, disconnect) = it->port->offload_thread_pop();
+                std::tie(buff, disconnect) = (*it)->port->offload_thread_pop();
                 if (buff) {
-                    _release_recv_buff(*it, buff);
+                    _release_recv_buff(**it, buff);
                 } else if (disconnect) {
-                    _disconnect_recv_client(*it);
+                    _disconnect_recv_client(**it);
                     it = _recv_clients.erase(it); // increments it
                     continue;
                 }
@@ -684,22 +843,22 @@ void offload_io_service_impl::_do_work_polling()
         if (allow_send) {
             // Get send buffers
             for (auto& send_info : _send_clients) {
-                _get_send_buff(send_info);
+                _get_send_buff(*send_info);
             }
 
             // Release send buffers
             for (auto it = _send_clients.begin(); it != _send_clients.end();) {
                 frame_buff* buff;
                 bool disconnect;
-                std::tie(buff, disconnect) = it->port->offload_thread_peek();
+                std::tie(buff, disconnect) = (*it)->port->offload_thread_peek();
                 if (buff) {
-                    if (it->inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
-                        _release_send_buff(*it, buff);
-                        it->port->offload_thread_pop();
+                    if ((*it)->inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
+                        _release_send_buff(**it, buff);
+                        (*it)->port->offload_thread_pop();
                     }
                 } else if (disconnect) {
-                    it->port->offload_thread_pop();
-                    _disconnect_send_client(*it);
+                    (*it)->port->offload_thread_pop();
+                    _disconnect_send_client(**it);
                     it = _send_clients.erase(it); // increments it
                     continue;
                 }
@@ -718,6 +877,7 @@ void offload_io_service_impl::_do_work_polling()
 template <bool allow_recv, bool allow_send>
 void offload_io_service_impl::_do_work_blocking()
 {
+    uhd::apply_thread_policy("offload");
     uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
 
     client_req_t client_req;
@@ -726,7 +886,7 @@ void offload_io_service_impl::_do_work_blocking()
         if (allow_recv) {
             // Get recv buffers
             for (auto& recv_info : _recv_clients) {
-                _get_recv_buff(recv_info, blocking_timeout_ms);
+                _get_recv_buff(*recv_info, blocking_timeout_ms);
             }
 
             // Release recv buffers
@@ -734,19 +894,19 @@ void offload_io_service_impl::_do_work_blocking()
                 frame_buff* buff;
                 bool disconnect;
 
-                if (it->num_frames_in_use == it->frames_reserved.num_recv_frames) {
+                if ((*it)->num_frames_in_use == (*it)->frames_reserved.num_recv_frames) {
                     // If all buffers are in use, block to avoid excessive CPU usage
                     std::tie(buff, disconnect) =
-                        it->port->offload_thread_pop(blocking_timeout_ms);
+                        (*it)->port->offload_thread_pop(blocking_timeout_ms);
                 } else {
                     // Otherwise, just check current status
-                    std::tie(buff, disconnect) = it->port->offload_thread_pop();
+                    std::tie(buff, disconnect) = (*it)->port->offload_thread_pop();
                 }
 
                 if (buff) {
-                    _release_recv_buff(*it, buff);
+                    _release_recv_buff(**it, buff);
                 } else if (disconnect) {
-                    _disconnect_recv_client(*it);
+                    _disconnect_recv_client(**it);
                     it = _recv_clients.erase(it); // increments it
                     continue;
                 }
@@ -757,24 +917,24 @@ void offload_io_service_impl::_do_work_blocking()
         if (allow_send) {
             // Get send buffers
             for (auto& send_info : _send_clients) {
-                _get_send_buff(send_info);
+                _get_send_buff(*send_info);
             }
 
             // Release send buffers
             for (auto it = _send_clients.begin(); it != _send_clients.end();) {
-                if (it->num_frames_in_use > 0) {
+                if ((*it)->num_frames_in_use > 0) {
                     frame_buff* buff;
                     bool disconnect;
-                    std::tie(buff, disconnect) = it->port->offload_thread_peek();
+                    std::tie(buff, disconnect) = (*it)->port->offload_thread_peek();
                     if (buff) {
-                        if (it->inline_io->wait_for_dest_ready(
+                        if ((*it)->inline_io->wait_for_dest_ready(
                                 buff->packet_size(), blocking_timeout_ms)) {
-                            _release_send_buff(*it, buff);
-                            it->port->offload_thread_pop();
+                            _release_send_buff(**it, buff);
+                            (*it)->port->offload_thread_pop();
                         }
                     } else if (disconnect) {
-                        it->port->offload_thread_pop();
-                        _disconnect_send_client(*it);
+                        (*it)->port->offload_thread_pop();
+                        _disconnect_send_client(**it);
                         it = _send_clients.erase(it); // increments it
                         continue;
                     }
@@ -794,4 +954,110 @@ void offload_io_service_impl::_do_work_blocking()
     }
 }
 
+// Worker body for the shared pool: every worker runs this loop, claiming
+// clients one batch at a time via the per-client atomic flag. A worker that
+// finds a client already claimed simply moves on to the next one, so idle
+// workers naturally steal the clients that busy workers have not gotten to.
+void offload_io_service_impl::_do_work_pool()
+{
+    uhd::apply_thread_policy("offload");
+    uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
+
+    client_req_t client_req;
+    bool membership_change = false;
+
+    while (!_stop_offload_thread) {
+        {
+            // Hold the membership lock shared while servicing, so connect
+            // and disconnect requests cannot mutate the lists mid-sweep
+            std::shared_lock<std::shared_mutex> lock(_pool_mutex);
+
+            for (auto& info : _recv_clients) {
+                if (info->disconnecting.load(std::memory_order_relaxed)
+                    || info->claim->claimed.test_and_set(std::memory_order_acquire)) {
+                    continue;
+                }
+                for (size_t i = 0; i < pool_batch_size; i++) {
+                    _get_recv_buff(*info, 0);
+                }
+                for (size_t i = 0; i < pool_batch_size; i++) {
+                    frame_buff* buff;
+                    bool disconnect;
+                    std::tie(buff, disconnect) = info->port->offload_thread_pop();
+                    if (buff) {
+                        _release_recv_buff(*info, buff);
+                    } else {
+                        if (disconnect) {
+                            info->disconnecting = true;
+                            membership_change   = true;
+                        }
+                        break;
+                    }
+                }
+                info->claim->claimed.clear(std::memory_order_release);
+            }
+
+            for (auto& info : _send_clients) {
+                if (info->disconnecting.load(std::memory_order_relaxed)
+                    || info->claim->claimed.test_and_set(std::memory_order_acquire)) {
+                    continue;
+                }
+                for (size_t i = 0; i < pool_batch_size; i++) {
+                    _get_send_buff(*info);
+                }
+                for (size_t i = 0; i < pool_batch_size; i++) {
+                    frame_buff* buff;
+                    bool disconnect;
+                    std::tie(buff, disconnect) = info->port->offload_thread_peek();
+                    if (buff) {
+                        if (!info->inline_io->wait_for_dest_ready(
+                                buff->packet_size(), 0)) {
+                            break;
+                        }
+                        _release_send_buff(*info, buff);
+                        info->port->offload_thread_pop();
+                    } else {
+                        if (disconnect) {
+                            info->port->offload_thread_pop();
+                            info->disconnecting = true;
+                            membership_change   = true;
+                        }
+                        break;
+                    }
+                }
+                info->claim->claimed.clear(std::memory_order_release);
+            }
+        }
+
+        // Connect and disconnect requests mutate the client lists, so they
+        // execute under the exclusive lock, while no worker is servicing
+        if (membership_change || !_client_connect_queue.empty()) {
+            std::unique_lock<std::shared_mutex> lock(_pool_mutex);
+
+            if (_client_connect_queue.pop(client_req)) {
+                (*client_req.req)();
+                delete client_req.req;
+            }
+
+            for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
+                if ((*it)->disconnecting) {
+                    _disconnect_recv_client(**it);
+                    it = _recv_clients.erase(it); // increments it
+                } else {
+                    ++it;
+                }
+            }
+            for (auto it = _send_clients.begin(); it != _send_clients.end();) {
+                if ((*it)->disconnecting) {
+                    _disconnect_send_client(**it);
+                    it = _send_clients.erase(it); // increments it
+                } else {
+                    ++it;
+                }
+            }
+            membership_change = false;
+        }
+    }
+}
+
 }} // namespace uhd::transport
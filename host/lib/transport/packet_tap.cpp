@@ -0,0 +1,252 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/paths.hpp>
+#include <uhdlib/transport/packet_tap.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace uhd { namespace transport {
+
+namespace {
+
+constexpr char LOG_ID[] = "PACKET_TAP";
+
+//! Number of records the ring can hold; must be a power of two. At 32 bytes
+// per record this is a fixed 128 KiB footprint.
+constexpr size_t RING_SIZE = 4096;
+
+struct tap_record_t
+{
+    uint64_t timestamp_ns;
+    uint32_t packet_size;
+    uint8_t direction;
+    uint8_t num_hdr_bytes;
+    uint8_t header[packet_tap::MAX_HDR_BYTES];
+};
+
+/*! Bounded lock-free multi-producer ring (Vyukov-style)
+ *
+ * Each cell carries a sequence number that tells producers and the consumer
+ * whether the cell is free or occupied, so producers from multiple link
+ * threads can claim cells with a single CAS and never block. The consumer is
+ * the single diagnostics thread.
+ */
+class tap_ring_t
+{
+public:
+    tap_ring_t()
+    {
+        for (size_t i = 0; i < RING_SIZE; i++) {
+            _cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool try_push(const tap_record_t& record)
+    {
+        cell_t* cell;
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            cell                   = &_cells[pos & (RING_SIZE - 1)];
+            const size_t seq       = cell->seq.load(std::memory_order_acquire);
+            const intptr_t dif     = intptr_t(seq) - intptr_t(pos);
+            if (dif == 0) {
+                if (_enqueue_pos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                // Ring is full: drop rather than block the hot path
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->record = record;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(tap_record_t& record)
+    {
+        const size_t pos   = _dequeue_pos;
+        cell_t* cell       = &_cells[pos & (RING_SIZE - 1)];
+        const size_t seq   = cell->seq.load(std::memory_order_acquire);
+        const intptr_t dif = intptr_t(seq) - intptr_t(pos + 1);
+        if (dif < 0) {
+            return false;
+        }
+        record = cell->record;
+        cell->seq.store(pos + RING_SIZE, std::memory_order_release);
+        _dequeue_pos = pos + 1;
+        return true;
+    }
+
+private:
+    struct cell_t
+    {
+        std::atomic<size_t> seq;
+        tap_record_t record;
+    };
+
+    alignas(64) std::atomic<size_t> _enqueue_pos{0};
+    alignas(64) size_t _dequeue_pos = 0;
+    cell_t _cells[RING_SIZE];
+};
+
+struct tap_state_t
+{
+    std::mutex control_mutex;
+    bool running           = false;
+    bool atexit_registered = false;
+    size_t sample_interval = 0;
+    tap_ring_t ring;
+    std::atomic<uint64_t> num_sampled{0};
+    std::atomic<uint64_t> num_dropped{0};
+    std::ofstream trace_file;
+    std::thread drain_thread;
+};
+
+tap_state_t& get_tap_state()
+{
+    static tap_state_t state;
+    return state;
+}
+
+void write_record(std::ofstream& file, const tap_record_t& record)
+{
+    char line[128];
+    int len = std::snprintf(line,
+        sizeof(line),
+        "%llu %s %u ",
+        static_cast<unsigned long long>(record.timestamp_ns),
+        record.direction == packet_tap::DIR_RX ? "RX" : "TX",
+        record.packet_size);
+    for (size_t i = 0; i < record.num_hdr_bytes; i++) {
+        len += std::snprintf(line + len, sizeof(line) - len, "%02x", record.header[i]);
+    }
+    file << line << "\n";
+}
+
+void drain_loop()
+{
+    auto& state = get_tap_state();
+    tap_record_t record;
+    while (packet_tap::enabled()) {
+        size_t num_drained = 0;
+        while (state.ring.try_pop(record)) {
+            write_record(state.trace_file, record);
+            num_drained++;
+        }
+        if (num_drained == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        } else {
+            state.trace_file.flush();
+        }
+    }
+    // Final drain after the sampling sites were disabled
+    while (state.ring.try_pop(record)) {
+        write_record(state.trace_file, record);
+    }
+    state.trace_file.flush();
+}
+
+} // namespace
+
+std::atomic<bool> packet_tap::_enabled{false};
+
+void packet_tap::start(const size_t sample_interval, const std::string& trace_file)
+{
+    auto& state = get_tap_state();
+    std::lock_guard<std::mutex> lock(state.control_mutex);
+    if (state.running) {
+        UHD_LOG_WARNING(LOG_ID, "Packet tap is already running");
+        return;
+    }
+
+    std::string path = trace_file;
+    if (path.empty()) {
+        path = uhd::get_tmp_path() + "/uhd_packet_tap_"
+               + std::to_string(
+                   std::chrono::steady_clock::now().time_since_epoch().count())
+               + ".log";
+    }
+    state.trace_file.open(path, std::ios::out | std::ios::trunc);
+    if (!state.trace_file) {
+        UHD_LOG_ERROR(
+            LOG_ID, "Cannot open packet tap trace file " << path << "; tap disabled");
+        return;
+    }
+
+    // The tap is typically started from device::make and nothing stops it
+    // explicitly, so join the diagnostics thread at process exit; a joinable
+    // std::thread destructor would call std::terminate() otherwise. stop() is
+    // idempotent, so an explicit stop before exit remains fine.
+    if (!state.atexit_registered) {
+        std::atexit(&packet_tap::stop);
+        state.atexit_registered = true;
+    }
+
+    state.sample_interval = std::max<size_t>(1, sample_interval);
+    state.num_sampled     = 0;
+    state.num_dropped     = 0;
+    state.running         = true;
+    _enabled.store(true, std::memory_order_release);
+    state.drain_thread = std::thread(&drain_loop);
+    UHD_LOG_INFO(LOG_ID,
+        "Sampling 1-in-" << state.sample_interval << " packet headers to " << path);
+}
+
+void packet_tap::stop()
+{
+    auto& state = get_tap_state();
+    std::lock_guard<std::mutex> lock(state.control_mutex);
+    if (!state.running) {
+        return;
+    }
+    _enabled.store(false, std::memory_order_release);
+    state.drain_thread.join();
+    state.trace_file.close();
+    state.running = false;
+    UHD_LOG_INFO(LOG_ID,
+        "Packet tap stopped; sampled " << state.num_sampled.load() << " packets, dropped "
+                                       << state.num_dropped.load());
+}
+
+void packet_tap::sample(const direction_t dir, const void* data, const size_t packet_size)
+{
+    auto& state = get_tap_state();
+
+    // 1-in-N decimation with a per-thread counter, so sampling adds no
+    // cross-thread contention on the packets we skip
+    thread_local size_t countdown = 0;
+    if (countdown++ % state.sample_interval != 0) {
+        return;
+    }
+
+    tap_record_t record;
+    record.timestamp_ns = static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+    record.packet_size   = static_cast<uint32_t>(packet_size);
+    record.direction     = dir;
+    record.num_hdr_bytes = static_cast<uint8_t>(std::min(MAX_HDR_BYTES, packet_size));
+    std::memcpy(record.header, data, record.num_hdr_bytes);
+
+    if (state.ring.try_push(record)) {
+        state.num_sampled.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        state.num_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+}} // namespace uhd::transport
@@ -18,11 +18,20 @@
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
+#include <uhdlib/transport/stream_health_accumulator.hpp>
+#include <uhdlib/utils/alloc_sentinel.hpp>
+#include <uhdlib/utils/tracepoints.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <thread>
 #include <vector>
 
 namespace uhd { namespace transport { namespace sph {
@@ -99,6 +108,31 @@ public:
     {
         _vrt_unpacker          = vrt_unpacker;
         _header_offset_words32 = header_offset_words32;
+        // Recognize the standard unpackers so the per-packet header parse
+        // dispatches as a direct, predictable call instead of through the
+        // function pointer. Device-specific unpackers stay indirect.
+        if (vrt_unpacker == &vrt::if_hdr_unpack_be) {
+            _unpacker_kind = UNPACKER_VRT_BE;
+        } else if (vrt_unpacker == &vrt::if_hdr_unpack_le) {
+            _unpacker_kind = UNPACKER_VRT_LE;
+        } else {
+            _unpacker_kind = UNPACKER_CUSTOM;
+        }
+    }
+
+    /*!
+     * Use the built-in CHDR header parser (little-endian links).
+     *
+     * CHDR streams always use the same header layout, so the per-packet
+     * parse can preset the link type and call the unpacker directly
+     * rather than bouncing through a device-supplied function pointer for
+     * every packet.
+     */
+    void set_chdr_unpacker(const size_t header_offset_words32 = 0)
+    {
+        _vrt_unpacker          = &vrt::if_hdr_unpack_le; // not used on this path
+        _header_offset_words32 = header_offset_words32;
+        _unpacker_kind         = UNPACKER_CHDR_LE;
     }
 
     /*!
@@ -141,6 +175,11 @@ public:
     /*!
      * Flush all transports in the streamer:
      * The packet payload is discarded.
+     *
+     * The timeout bounds the entire flush, not the wait for a single
+     * packet: even if the device is still producing data, this call
+     * returns once the deadline has passed. A timeout of zero drains each
+     * channel until its first empty poll.
      */
     void flush_all(const double timeout = 0.0)
     {
@@ -179,6 +218,72 @@ public:
         this->set_scale_factor(1 / 32767.); // update after setting converter
         _bytes_per_otw_item = uhd::convert::get_bytes_per_item(id.input_format);
         _bytes_per_cpu_item = uhd::convert::get_bytes_per_item(id.output_format);
+        // Identical in/out formats (raw wire-format capture) need no
+        // conversion at all; collapse to a straight memcpy
+        _passthrough = (id.input_format == id.output_format) and (id.num_outputs == 1);
+    }
+
+    /*!
+     * Enable or disable per-channel prefetch workers.
+     *
+     * With a non-zero depth, every transport channel gets a worker thread
+     * that pulls packets from its link and pre-stages them into a bounded
+     * lock-free queue. The caller of recv() then only pops pre-staged
+     * buffers and runs the alignment check, so many-channel receive no
+     * longer serializes on the slowest link. Packet processing and flow
+     * control still run on the caller's thread.
+     *
+     * Call this after all get-buffer callbacks have been set. The depth
+     * counts packets held per channel and must stay well below the
+     * transport's number of receive frames, or the workers will starve
+     * the link of buffers.
+     *
+     * \param depth number of packets to pre-stage per channel, 0 disables
+     */
+    void set_channel_prefetch(const size_t depth)
+    {
+        for (size_t i = 0; i < _props.size(); i++) {
+            _props[i].prefetch_task.reset();
+            _props[i].prefetch_queue.reset();
+            if (depth == 0 or not _props[i].get_buff)
+                continue;
+            auto queue                   = std::make_shared<prefetch_queue_type>(depth);
+            const get_buff_type get_buff = _props[i].get_buff;
+            _props[i].prefetch_queue     = queue;
+            _props[i].prefetch_task      = task::make(
+                [queue, get_buff](void) {
+                    if (queue->full()) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(10));
+                        return;
+                    }
+                    managed_recv_buffer::sptr buff = get_buff(0.1);
+                    if (buff)
+                        queue->push(std::move(buff));
+                },
+                "uhd_prefetch" + std::to_string(i));
+        }
+    }
+
+    /*!
+     * Set the depth of the timestamp-indexed packet reorder stage.
+     *
+     * With a non-zero depth, a packet whose sequence count jumps ahead of
+     * the expected count is staged in a small preallocated ring instead of
+     * being declared dropped immediately. If the missing packet then
+     * arrives (i.e. the link reordered packets rather than losing them),
+     * it is processed in order and the staged packets drain afterwards in
+     * timestamp order, so a single out-of-order packet costs one buffer
+     * slot instead of a multi-packet discard and re-sync. Only a full
+     * ring is treated as a real drop.
+     *
+     * \param depth staged packets per channel, 0 disables
+     */
+    void set_reorder_depth(const size_t depth)
+    {
+        for (size_t i = 0; i < _props.size(); i++) {
+            _props[i].reorder_slots = std::vector<per_buffer_info_type>(depth);
+            _props[i].reorder_count = 0;
+        }
     }
 
     //! Set the transport channel's overflow handler
@@ -188,6 +293,39 @@ public:
         _props.at(xport_chan).handle_overflow = handle_overflow;
     }
 
+    //! Get aggregated health statistics for this handler
+    uhd::stream_health_t get_stream_health(void) const
+    {
+        return _health_acc.get_health();
+    }
+
+    /*!
+     * Enable or disable the out-of-band tag stream.
+     *
+     * When enabled, recv() records one tag per packet-boundary event
+     * (end of burst, timestamp discontinuity, sequence gap) at the
+     * sample offset where the event occurred. The tag buffer is
+     * preallocated here so the receive fast path stays allocation-free;
+     * events beyond its capacity within one call are dropped.
+     */
+    void enable_tags(const bool enable)
+    {
+        _tags_enabled = enable;
+        _tags.clear();
+        _tags.shrink_to_fit();
+        if (enable) {
+            _tags.reserve(MAX_TAGS_PER_CALL);
+        }
+        _tag_time_valid = false;
+    }
+
+    //! Copy out the tags recorded during the most recent receive call
+    size_t get_tags(std::vector<rx_streamer::rx_tag_t>& tags)
+    {
+        tags = _tags;
+        return tags.size();
+    }
+
     //! Set the scale factor used in float conversion
     void set_scale_factor(const double scale_factor)
     {
@@ -228,6 +366,14 @@ public:
         const double timeout,
         const bool one_packet)
     {
+        // Steady-state receive must not allocate
+        UHD_ALLOC_SENTINEL_SCOPE("sph::recv");
+
+        // tags describe offsets within this call's buffers
+        if (_tags_enabled) {
+            _tags.clear();
+        }
+
         // handle metadata queued from a previous receive
         if (_queue_error_for_next_call) {
             _queue_error_for_next_call = false;
@@ -276,13 +422,207 @@ public:
         return accum_num_samps;
     }
 
+    /*******************************************************************
+     * Scatter receive:
+     * Same loop as recv(), but record where each packet's samples
+     * landed and the time of its first sample.
+     ******************************************************************/
+    UHD_INLINE size_t recv_scatter(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        std::vector<rx_streamer::scatter_info_t>& infos,
+        uhd::rx_metadata_t& metadata,
+        const double timeout)
+    {
+        infos.clear();
+
+        // tags describe offsets within this call's buffers
+        if (_tags_enabled) {
+            _tags.clear();
+        }
+
+        // handle metadata queued from a previous receive
+        if (_queue_error_for_next_call) {
+            _queue_error_for_next_call = false;
+            metadata                   = _queue_metadata;
+            if (_queue_metadata.error_code != rx_metadata_t::ERROR_CODE_TIMEOUT)
+                return 0;
+        }
+
+        size_t accum_num_samps =
+            recv_one_packet(buffs, nsamps_per_buff, metadata, timeout);
+        if (accum_num_samps != 0) {
+            infos.push_back({0, accum_num_samps, metadata.time_spec});
+        }
+
+        if (metadata.end_of_burst
+            or metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
+            return accum_num_samps;
+        }
+
+        // loop until buffer is filled or error code
+        while (accum_num_samps < nsamps_per_buff) {
+            size_t num_samps = recv_one_packet(buffs,
+                nsamps_per_buff - accum_num_samps,
+                _queue_metadata,
+                timeout,
+                accum_num_samps * _bytes_per_cpu_item);
+
+            metadata.end_of_burst = _queue_metadata.end_of_burst;
+
+            // metadata had an error code set, store for next call and return
+            if (_queue_metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
+                _queue_error_for_next_call = true;
+                break;
+            }
+
+            if (num_samps != 0) {
+                infos.push_back({accum_num_samps, num_samps, _queue_metadata.time_spec});
+            }
+            accum_num_samps += num_samps;
+
+            // return immediately if end of burst
+            if (_queue_metadata.end_of_burst) {
+                break;
+            }
+        }
+        return accum_num_samps;
+    }
+
+    /*******************************************************************
+     * Zero-copy receive:
+     * Hand the caller the aligned wire-format buffers for one packet
+     * per channel, deferring release until the caller drops them.
+     ******************************************************************/
+    UHD_INLINE size_t recv_buffs(rx_streamer::managed_buffs_type& buffs,
+        std::vector<size_t>& payload_offsets,
+        uhd::rx_metadata_t& metadata,
+        const double timeout)
+    {
+        // handle metadata queued from a previous receive
+        if (_queue_error_for_next_call) {
+            _queue_error_for_next_call = false;
+            metadata                   = _queue_metadata;
+            if (_queue_metadata.error_code != rx_metadata_t::ERROR_CODE_TIMEOUT)
+                return 0;
+        }
+
+        // get the next aligned set if the current one has been consumed
+        if (get_curr_buffer_info().data_bytes_to_copy == 0) {
+            get_aligned_buffs(timeout);
+        }
+
+        buffers_info_type& info = get_curr_buffer_info();
+        metadata                = info.metadata;
+
+        // interpolate the time spec (in case recv() left a fragment)
+        metadata.time_spec +=
+            time_spec_t::from_ticks(info.fragment_offset_in_samps, _samp_rate);
+        metadata.fragment_offset = info.fragment_offset_in_samps;
+        metadata.more_fragments  = false;
+
+        if (metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
+            return 0;
+        }
+
+        const size_t nsamps = info.data_bytes_to_copy / _bytes_per_otw_item;
+        buffs.resize(this->size());
+        payload_offsets.resize(this->size());
+        for (size_t i = 0; i < this->size(); i++) {
+            // move ownership to the caller (no refcount traffic); the payload
+            // offset skips the packet header (and any part consumed by recv())
+            payload_offsets[i] = info[i].copy_buff - info[i].buff->cast<const char*>();
+            buffs[i]           = std::move(info[i].buff);
+            info[i].copy_buff  = nullptr;
+        }
+        info.data_bytes_to_copy = 0; // mark the set fully consumed
+        return nsamps;
+    }
+
 private:
+    //! dispatch kinds for the per-packet header parse
+    enum unpacker_kind_type {
+        UNPACKER_CUSTOM,
+        UNPACKER_VRT_BE,
+        UNPACKER_VRT_LE,
+        UNPACKER_CHDR_LE
+    };
+
     vrt_unpacker_type _vrt_unpacker;
+    unpacker_kind_type _unpacker_kind = UNPACKER_CUSTOM;
     size_t _header_offset_words32;
     double _tick_rate, _samp_rate;
     bool _queue_error_for_next_call;
     size_t _alignment_failure_threshold;
     rx_metadata_t _queue_metadata;
+
+    //! information stored for a received buffer
+    struct per_buffer_info_type
+    {
+        void reset()
+        {
+            buff.reset();
+            vrt_hdr   = nullptr;
+            time      = 0;
+            copy_buff = nullptr;
+        }
+        managed_recv_buffer::sptr buff;
+        const uint32_t* vrt_hdr;
+        vrt::if_packet_info_t ifpi;
+        uint64_t time;
+        const char* copy_buff;
+    };
+
+    /*!
+     * A bounded, preallocated single-producer/single-consumer queue of
+     * received buffers. One prefetch worker pushes, only the caller of
+     * recv() pops, so a ring with atomic read/write indexes suffices and
+     * neither side ever takes a lock. One slot is sacrificed to tell the
+     * full ring from the empty one.
+     */
+    class prefetch_queue_type
+    {
+    public:
+        prefetch_queue_type(const size_t depth) : _ring(depth + 1), _read(0), _write(0)
+        {
+        }
+
+        bool full(void) const
+        {
+            return _next(_write.load(std::memory_order_relaxed))
+                   == _read.load(std::memory_order_acquire);
+        }
+
+        bool push(managed_recv_buffer::sptr buff)
+        {
+            const size_t write = _write.load(std::memory_order_relaxed);
+            const size_t next  = _next(write);
+            if (next == _read.load(std::memory_order_acquire))
+                return false;
+            _ring[write] = std::move(buff);
+            _write.store(next, std::memory_order_release);
+            return true;
+        }
+
+        managed_recv_buffer::sptr pop(void)
+        {
+            const size_t read = _read.load(std::memory_order_relaxed);
+            if (read == _write.load(std::memory_order_acquire))
+                return managed_recv_buffer::sptr();
+            managed_recv_buffer::sptr buff = std::move(_ring[read]);
+            _read.store(_next(read), std::memory_order_release);
+            return buff;
+        }
+
+    private:
+        size_t _next(const size_t pos) const
+        {
+            return (pos + 1) % _ring.size();
+        }
+
+        std::vector<managed_recv_buffer::sptr> _ring;
+        std::atomic<size_t> _read, _write;
+    };
+
     struct xport_chan_props_type
     {
         xport_chan_props_type(void)
@@ -296,29 +636,25 @@ private:
         handle_flowctrl_type handle_flowctrl;
         handle_flowctrl_ack_type handle_flowctrl_ack;
         size_t fc_update_window;
+        std::shared_ptr<prefetch_queue_type> prefetch_queue;
+        task::sptr prefetch_task;
+        std::vector<per_buffer_info_type> reorder_slots; // staged o-o-o packets
+        size_t reorder_count = 0;
     };
     std::vector<xport_chan_props_type> _props;
+    stream_health_accumulator _health_acc;
+
+    //! cap on tags recorded per receive call (preallocated, see enable_tags)
+    static const size_t MAX_TAGS_PER_CALL = 256;
+    bool _tags_enabled = false;
+    std::vector<rx_streamer::rx_tag_t> _tags;
+    time_spec_t _tag_expected_time; //!< where the next packet should start
+    bool _tag_time_valid = false;
     size_t _num_outputs;
     size_t _bytes_per_otw_item; // used in conversion
     size_t _bytes_per_cpu_item; // used in conversion
     uhd::convert::converter::sptr _converter; // used in conversion
-
-    //! information stored for a received buffer
-    struct per_buffer_info_type
-    {
-        void reset()
-        {
-            buff.reset();
-            vrt_hdr   = nullptr;
-            time      = 0;
-            copy_buff = nullptr;
-        }
-        managed_recv_buffer::sptr buff;
-        const uint32_t* vrt_hdr;
-        vrt::if_packet_info_t ifpi;
-        uint64_t time;
-        const char* copy_buff;
-    };
+    bool _passthrough = false; // in/out formats identical, conversion is a memcpy
 
     //! information stored for a set of aligned buffers
     struct buffers_info_type : std::vector<per_buffer_info_type>
@@ -384,13 +720,55 @@ private:
     int recvd_packets;
 #endif
 
+    //! Get a packet buffer for this channel: from the prefetch queue when a
+    // worker is staging packets, directly from the transport otherwise
+    UHD_INLINE managed_recv_buffer::sptr get_buff_for_chan(
+        const size_t index, const double timeout)
+    {
+        if (not _props[index].prefetch_queue)
+            return _props[index].get_buff(timeout);
+
+        managed_recv_buffer::sptr buff = _props[index].prefetch_queue->pop();
+        if (buff)
+            return buff;
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+        while (std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            buff = _props[index].prefetch_queue->pop();
+            if (buff)
+                return buff;
+        }
+        return buff; // empty => timeout
+    }
+
+    //! Index of the staged packet with the earliest timestamp
+    UHD_INLINE size_t reorder_min_slot(const xport_chan_props_type& props)
+    {
+        size_t min_slot   = 0;
+        uint64_t min_time = 0;
+        bool first        = true;
+        for (size_t i = 0; i < props.reorder_slots.size(); i++) {
+            if (not props.reorder_slots[i].buff)
+                continue;
+            if (first or props.reorder_slots[i].time < min_time) {
+                min_slot = i;
+                min_time = props.reorder_slots[i].time;
+                first    = false;
+            }
+        }
+        return min_slot;
+    }
+
     /*******************************************************************
      * Get and process a single packet from the transport:
      * Receive a single packet at the given index.
      * Extract all the relevant info and store.
      * Check the info to determine the return code.
      ******************************************************************/
-    UHD_INLINE packet_type get_and_process_single_packet(const size_t index,
+    // Note: not UHD_INLINE; the staged-packet path makes this function
+    // self-recursive, which always_inline cannot accommodate
+    inline packet_type get_and_process_single_packet(const size_t index,
         per_buffer_info_type& prev_buffer_info,
         per_buffer_info_type& curr_buffer_info,
         double timeout)
@@ -398,16 +776,44 @@ private:
         managed_recv_buffer::sptr& buff = curr_buffer_info.buff;
         per_buffer_info_type& info      = curr_buffer_info;
         while (1) {
+            // deliver the staged packet with the earliest timestamp when it
+            // is the one the sequence check expects
+            if (_props[index].reorder_count != 0) {
+                const size_t slot = reorder_min_slot(_props[index]);
+                if (_props[index].reorder_slots[slot].ifpi.packet_count
+                    == _props[index].packet_count) {
+                    info = std::move(_props[index].reorder_slots[slot]);
+                    _props[index].reorder_slots[slot].reset();
+                    _props[index].reorder_count--;
+                    break;
+                }
+            }
+
             // get a single packet from the transport layer
-            buff = _props[index].get_buff(timeout);
-            if (buff.get() == nullptr)
+            buff = get_buff_for_chan(index, timeout);
+            if (buff.get() == nullptr) {
+                // a timeout with staged packets outstanding means the gap
+                // packet is not coming: resume from the earliest staged one
+                if (_props[index].reorder_count != 0) {
+                    const size_t slot = reorder_min_slot(_props[index]);
+                    info              = std::move(_props[index].reorder_slots[slot]);
+                    _props[index].reorder_slots[slot].reset();
+                    _props[index].reorder_count--;
+                    const size_t seq_mask =
+                        (info.ifpi.link_type == vrt::if_packet_info_t::LINK_TYPE_NONE)
+                            ? 0xf
+                            : 0xfff;
+                    _props[index].packet_count = (info.ifpi.packet_count + 1) & seq_mask;
+                    return PACKET_SEQUENCE_ERROR;
+                }
                 return PACKET_TIMEOUT_ERROR;
+            }
 
 #ifdef ERROR_INJECT_DROPPED_PACKETS
             if (++recvd_packets > 1000) {
                 recvd_packets = 0;
                 buff.reset();
-                buff = _props[index].get_buff(timeout);
+                buff = get_buff_for_chan(index, timeout);
                 if (buff.get() == nullptr)
                     return PACKET_TIMEOUT_ERROR;
             }
@@ -423,7 +829,22 @@ private:
             info.ifpi                    = {};
             info.ifpi.num_packet_words32 = num_packet_words32 - _header_offset_words32;
             info.vrt_hdr = buff->cast<const uint32_t*>() + _header_offset_words32;
-            _vrt_unpacker(info.vrt_hdr, info.ifpi);
+            switch (_unpacker_kind) {
+                case UNPACKER_VRT_BE:
+                    vrt::if_hdr_unpack_be(info.vrt_hdr, info.ifpi);
+                    break;
+                case UNPACKER_VRT_LE:
+                    vrt::if_hdr_unpack_le(info.vrt_hdr, info.ifpi);
+                    break;
+                case UNPACKER_CHDR_LE:
+                    // CHDR link: fixed layout, preset the link type and
+                    // parse with a direct call
+                    info.ifpi.link_type = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+                    vrt::if_hdr_unpack_le(info.vrt_hdr, info.ifpi);
+                    break;
+                default:
+                    _vrt_unpacker(info.vrt_hdr, info.ifpi);
+            }
             info.time      = info.ifpi.tsf; // assumes has_tsf is true
             info.copy_buff = reinterpret_cast<const char*>(
                 info.vrt_hdr + info.ifpi.num_header_words32);
@@ -475,6 +896,38 @@ private:
                 // flow control is in.
                 _props[index].handle_flowctrl(info.ifpi.packet_count);
             }
+            // A count that jumped ahead may be link reordering rather than
+            // loss: stage the packet in the reorder ring and keep receiving
+            // while the expected packet may still arrive. It drains through
+            // the staged-delivery check at the top of the receive loop.
+            const bool count_is_ahead =
+                ((info.ifpi.packet_count - expected_packet_count) & seq_mask)
+                <= seq_mask / 2;
+            if (count_is_ahead and not _props[index].reorder_slots.empty()) {
+                if (_props[index].reorder_count < _props[index].reorder_slots.size()) {
+                    for (auto& slot : _props[index].reorder_slots) {
+                        if (not slot.buff) {
+                            slot = std::move(info);
+                            break;
+                        }
+                    }
+                    _props[index].reorder_count++;
+                    _props[index].packet_count = expected_packet_count;
+                    info.reset();
+                    // go receive the next packet; recursion depth is
+                    // bounded by the size of the reorder ring
+                    return get_and_process_single_packet(
+                        index, prev_buffer_info, curr_buffer_info, timeout);
+                }
+                // ring full, so this is a real drop: resume from the
+                // earliest packet on hand; later staged packets drain
+                // through the staged-delivery check on subsequent calls
+                const size_t slot = reorder_min_slot(_props[index]);
+                if (_props[index].reorder_slots[slot].time < info.time) {
+                    std::swap(info, _props[index].reorder_slots[slot]);
+                }
+                _props[index].packet_count = (info.ifpi.packet_count + 1) & seq_mask;
+            }
             return PACKET_SEQUENCE_ERROR;
         }
 #endif
@@ -494,17 +947,33 @@ private:
         get_curr_buffer_info().reset();
         get_next_buffer_info().reset();
 
+        // The timeout is a deadline for the entire flush: a device that is
+        // still streaming can otherwise feed this loop indefinitely.
+        const auto exit_time = std::chrono::steady_clock::now()
+                               + std::chrono::microseconds(long(timeout * 1e6));
+
         for (size_t i = 0; i < _props.size(); i++) {
+            // drop any staged out-of-order packets
+            for (auto& slot : _props[i].reorder_slots) {
+                slot.reset();
+            }
+            _props[i].reorder_count = 0;
+
             per_buffer_info_type prev_buffer_info, curr_buffer_info;
             prev_buffer_info.reset();
             curr_buffer_info.reset();
             while (true) {
+                // remaining time until the deadline, as the per-packet wait
+                const double wait = std::max(0.0,
+                    std::chrono::duration<double>(
+                        exit_time - std::chrono::steady_clock::now())
+                        .count());
                 // receive a single packet from the transport
                 try {
                     // call into get_and_process_single_packet()
                     // to make sure flow control is handled
                     if (get_and_process_single_packet(
-                            i, prev_buffer_info, curr_buffer_info, timeout)
+                            i, prev_buffer_info, curr_buffer_info, wait)
                         == PACKET_TIMEOUT_ERROR)
                         break;
                 } catch (...) {
@@ -512,6 +981,10 @@ private:
                 curr_buffer_info.buff.reset(); // Let my buffer go!
                 prev_buffer_info = curr_buffer_info;
                 curr_buffer_info.reset();
+                if (timeout != 0.0
+                    && std::chrono::steady_clock::now() > exit_time) {
+                    break;
+                }
             }
         }
     }
@@ -646,9 +1119,14 @@ private:
                         }
 
                         rx_metadata_t metadata = curr_info.metadata;
+                        UHD_TRACEPOINT(rx_overrun, index);
+                        _health_acc.record_overrun();
                         _props[index].handle_overflow();
                         curr_info.metadata = metadata;
                         UHD_LOG_FASTPATH("O");
+                    } else if (curr_info.metadata.error_code
+                               == rx_metadata_t::ERROR_CODE_LATE_COMMAND) {
+                        _health_acc.record_late();
                     }
                     next_info[index].buff.reset(); // No data, so release the buffer
                     next_info[index].copy_buff = nullptr;
@@ -661,6 +1139,7 @@ private:
                         _props[index].handle_flowctrl(next_info[index].ifpi.packet_count);
                     }
                     curr_info.metadata.error_code = rx_metadata_t::ERROR_CODE_TIMEOUT;
+                    _health_acc.record_timeout();
                     return;
 
                 case PACKET_SEQUENCE_ERROR:
@@ -675,6 +1154,8 @@ private:
                             _samp_rate);
                     curr_info.metadata.out_of_sequence = true;
                     curr_info.metadata.error_code = rx_metadata_t::ERROR_CODE_OVERFLOW;
+                    UHD_TRACEPOINT(rx_seq_error, index);
+                    _health_acc.record_seq_error();
                     UHD_LOG_FASTPATH("D");
                     return;
             }
@@ -755,9 +1236,75 @@ private:
         metadata.fragment_offset = info.fragment_offset_in_samps;
         info.fragment_offset_in_samps += nsamps_to_copy; // set for next call
 
+        // record packet-boundary events for the optional tag stream
+        if (_tags_enabled) {
+            record_tags(metadata,
+                buffer_offset_bytes / _bytes_per_cpu_item,
+                nsamps_to_copy_per_io_buff);
+        }
+
         return nsamps_to_copy_per_io_buff;
     }
 
+    /*! Record packet-boundary events as tags at their sample offsets.
+     *
+     * Called once per processed chunk (packet or fragment) with the
+     * chunk's metadata, its sample offset within the caller's buffers,
+     * and the number of samples delivered. The tag buffer is
+     * preallocated and the receive fast path must not allocate, so
+     * events beyond its capacity are dropped.
+     */
+    UHD_INLINE void record_tags(
+        const rx_metadata_t& metadata, const size_t offset, const size_t nsamps)
+    {
+        // a sequence gap means samples are missing before this offset
+        if (metadata.error_code == rx_metadata_t::ERROR_CODE_OVERFLOW
+            and metadata.out_of_sequence) {
+            if (_tags.size() < _tags.capacity()) {
+                _tags.push_back({rx_streamer::rx_tag_t::EVENT_SEQUENCE_GAP,
+                    offset,
+                    metadata.time_spec});
+            }
+            _tag_time_valid = false;
+            return;
+        }
+        if (metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
+            _tag_time_valid = false;
+            return;
+        }
+        if (nsamps == 0) {
+            return;
+        }
+        // a packet more than half a sample period off from where the
+        // previous packet left off marks a timestamp discontinuity
+        if (metadata.has_time_spec) {
+            if (_tag_time_valid
+                and std::abs((metadata.time_spec - _tag_expected_time).get_real_secs())
+                        * _samp_rate
+                        > 0.5
+                and _tags.size() < _tags.capacity()) {
+                _tags.push_back({rx_streamer::rx_tag_t::EVENT_TIME_DISCONTINUITY,
+                    offset,
+                    metadata.time_spec});
+            }
+            _tag_expected_time =
+                metadata.time_spec + time_spec_t::from_ticks(nsamps, _samp_rate);
+            _tag_time_valid = true;
+        } else {
+            _tag_time_valid = false;
+        }
+        // only the final fragment of a packet carries the burst's last sample
+        if (metadata.end_of_burst and not metadata.more_fragments) {
+            if (_tags.size() < _tags.capacity()) {
+                _tags.push_back({rx_streamer::rx_tag_t::EVENT_END_OF_BURST,
+                    offset + nsamps - 1,
+                    metadata.time_spec
+                        + time_spec_t::from_ticks(nsamps - 1, _samp_rate)});
+            }
+            _tag_time_valid = false;
+        }
+    }
+
     /*! Run the conversion from the internal buffers to the user's output
      *  buffer.
      *
@@ -781,7 +1328,12 @@ private:
         const ref_vector<void*> out_buffs(io_buffs, _num_outputs);
 
         // perform the conversion operation
-        _converter->conv(info.copy_buff, out_buffs, _convert_nsamps);
+        if (_passthrough) {
+            // wire-format passthrough: a single memcpy, no converter dispatch
+            std::memcpy(io_buffs[0], info.copy_buff, _convert_bytes_to_copy);
+        } else {
+            _converter->conv(info.copy_buff, out_buffs, _convert_nsamps);
+        }
 
         // advance the pointer for the source buffer
         info.copy_buff += _convert_bytes_to_copy;
@@ -827,11 +1379,44 @@ public:
             buffs, nsamps_per_buff, metadata, timeout, one_packet);
     }
 
+    size_t recv_scatter(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        std::vector<scatter_info_t>& infos,
+        uhd::rx_metadata_t& metadata,
+        const double timeout) override
+    {
+        return recv_packet_handler::recv_scatter(
+            buffs, nsamps_per_buff, infos, metadata, timeout);
+    }
+
+    size_t recv_buffs(managed_buffs_type& buffs,
+        std::vector<size_t>& payload_offsets,
+        uhd::rx_metadata_t& metadata,
+        const double timeout) override
+    {
+        return recv_packet_handler::recv_buffs(buffs, payload_offsets, metadata, timeout);
+    }
+
     void issue_stream_cmd(const stream_cmd_t& stream_cmd) override
     {
         return recv_packet_handler::issue_stream_cmd(stream_cmd);
     }
 
+    stream_health_t get_stream_health(void) const override
+    {
+        return recv_packet_handler::get_stream_health();
+    }
+
+    void enable_tags(const bool enable) override
+    {
+        recv_packet_handler::enable_tags(enable);
+    }
+
+    size_t get_tags(std::vector<rx_tag_t>& tags) override
+    {
+        return recv_packet_handler::get_tags(tags);
+    }
+
     // Post an action to the input edge.
     void post_input_action(
         const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
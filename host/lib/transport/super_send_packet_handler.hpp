@@ -18,7 +18,11 @@
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/tasks.hpp>
 #include <uhd/utils/thread.hpp>
+#include <uhdlib/transport/stream_health_accumulator.hpp>
+#include <uhdlib/utils/alloc_sentinel.hpp>
+#include <atomic>
 #include <chrono>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <thread>
@@ -153,6 +157,58 @@ public:
         _converter->set_scalar(scale_factor);
     }
 
+    /*!
+     * Enable or disable pipelined sends.
+     *
+     * When enabled, the next send buffer for a channel is fetched from
+     * the link right after the current one is committed, while the caller
+     * is still producing the next packet's samples. send_one_packet()
+     * then finds a buffer already on hand instead of stalling on the
+     * link, which removes the fetch from the per-packet dependency
+     * chain. The prefetch never blocks; when the link has no free buffer
+     * at commit time, the next send falls back to the normal blocking
+     * fetch.
+     */
+    void set_pipelined_sends(const bool enable)
+    {
+        _pipelined_sends = enable;
+    }
+
+    /*!
+     * Enable or disable spin-wait sends.
+     *
+     * When enabled, send buffers are acquired by busy-polling the link
+     * with a zero timeout instead of one blocking call. The transport's
+     * internal wait parks the thread on a condition variable, and the
+     * scheduler wakeup adds tens of microseconds of jitter right before
+     * a timed burst; the busy-poll keeps the thread runnable so a buffer
+     * is picked up within a few microseconds of becoming free. This
+     * burns a CPU core while waiting and should only be enabled for
+     * latency-critical timed sends.
+     */
+    void set_spin_wait_send(const bool enable)
+    {
+        _spin_wait_send = enable;
+    }
+
+    /*!
+     * Get the number of late bursts reported by the device.
+     *
+     * Counts the async messages with EVENT_CODE_TIME_ERROR seen by
+     * recv_async_msg() since the streamer was created. The caller must
+     * be draining async messages for this to advance.
+     */
+    size_t get_late_burst_count(void) const
+    {
+        return _late_burst_count;
+    }
+
+    //! Get aggregated health statistics for this handler
+    uhd::stream_health_t get_stream_health(void) const
+    {
+        return _health_acc.get_health();
+    }
+
     //! Set the callback to get async messages
     void set_async_receiver(const async_receiver_type& async_receiver)
     {
@@ -162,8 +218,28 @@ public:
     //! Overload call to get async metadata
     bool recv_async_msg(uhd::async_metadata_t& async_metadata, double timeout = 0.1)
     {
-        if (_async_receiver)
-            return _async_receiver(async_metadata, timeout);
+        if (_async_receiver) {
+            const bool got_msg = _async_receiver(async_metadata, timeout);
+            if (got_msg) {
+                switch (async_metadata.event_code) {
+                    case uhd::async_metadata_t::EVENT_CODE_TIME_ERROR:
+                        _late_burst_count++;
+                        _health_acc.record_late();
+                        break;
+                    case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW:
+                    case uhd::async_metadata_t::EVENT_CODE_UNDERFLOW_IN_PACKET:
+                        _health_acc.record_underrun();
+                        break;
+                    case uhd::async_metadata_t::EVENT_CODE_SEQ_ERROR:
+                    case uhd::async_metadata_t::EVENT_CODE_SEQ_ERROR_IN_BURST:
+                        _health_acc.record_seq_error();
+                        break;
+                    default:
+                        break;
+                }
+            }
+            return got_msg;
+        }
         std::this_thread::sleep_for(std::chrono::microseconds(long(timeout * 1e6)));
         return false;
     }
@@ -178,6 +254,9 @@ public:
         const uhd::tx_metadata_t& metadata,
         const double timeout)
     {
+        // Steady-state send must not allocate
+        UHD_ALLOC_SENTINEL_SCOPE("sph::send");
+
         // translate the metadata to vrt if packet info
         vrt::if_packet_info_t if_packet_info;
         if_packet_info.packet_type = vrt::if_packet_info_t::PACKET_TYPE_DATA;
@@ -271,6 +350,113 @@ public:
         return nsamps_sent;
     }
 
+    /*******************************************************************
+     * Preconverted waveform cache:
+     * Convert a waveform once and resend its wire-format data many
+     * times without touching the converter again.
+     ******************************************************************/
+    size_t register_preconverted(
+        const uhd::tx_streamer::buffs_type& buffs, const size_t nsamps_per_buff)
+    {
+        if (nsamps_per_buff == 0) {
+            throw uhd::value_error("register_preconverted: cannot cache zero samples");
+        }
+        preconverted_entry_type entry;
+        entry.nsamps = nsamps_per_buff;
+        entry.otw_data.resize(this->size());
+        for (size_t index = 0; index < this->size(); index++) {
+            // fill IO buffs with pointers into the caller's buffers
+            const void* io_buffs[4 /*max interleave*/];
+            for (size_t i = 0; i < _num_inputs; i++) {
+                io_buffs[i] = buffs[index * _num_inputs + i];
+            }
+            const ref_vector<const void*> in_buffs(io_buffs, _num_inputs);
+
+            // run the converter once into the cache
+            entry.otw_data[index].resize(
+                nsamps_per_buff * _num_inputs * _bytes_per_otw_item);
+            void* otw_mem = entry.otw_data[index].data();
+            _converter->conv(in_buffs, otw_mem, nsamps_per_buff);
+        }
+        _preconverted.push_back(std::move(entry));
+        return _preconverted.size() - 1;
+    }
+
+    //! Send a registered waveform; same framing as send(), no conversion
+    size_t send_preconverted(
+        const size_t handle, const uhd::tx_metadata_t& metadata, const double timeout)
+    {
+        if (handle >= _preconverted.size()) {
+            throw uhd::index_error("send_preconverted: invalid waveform handle");
+        }
+        const preconverted_entry_type& entry = _preconverted[handle];
+        const size_t nsamps_per_buff         = entry.nsamps;
+
+        // translate the metadata to vrt if packet info
+        vrt::if_packet_info_t if_packet_info;
+        if_packet_info.packet_type = vrt::if_packet_info_t::PACKET_TYPE_DATA;
+        if_packet_info.has_cid     = false;
+        if_packet_info.has_tlr     = _has_tlr;
+        if_packet_info.has_tsi     = false;
+        if_packet_info.has_tsf     = metadata.has_time_spec;
+        if_packet_info.tsf         = metadata.time_spec.to_ticks(_tick_rate);
+        if_packet_info.sob         = metadata.start_of_burst;
+        if_packet_info.eob         = metadata.end_of_burst;
+        if_packet_info.fc_ack      = false; // This is a data packet
+
+        // apply metadata cached by a zero-sample start-of-burst send()
+        if (_cached_metadata) {
+            if (!metadata.has_time_spec) {
+                if_packet_info.has_tsf = _metadata_cache.has_time_spec;
+                if_packet_info.tsf     = _metadata_cache.time_spec.to_ticks(_tick_rate);
+            }
+            if_packet_info.sob = _metadata_cache.start_of_burst;
+            if_packet_info.eob = _metadata_cache.end_of_burst;
+            _cached_metadata   = false;
+        }
+
+        if (nsamps_per_buff <= _max_samples_per_packet) {
+            return send_one_packet_preconverted(
+                entry, nsamps_per_buff, if_packet_info, timeout);
+        }
+        size_t total_num_samps_sent = 0;
+
+        // false until final fragment
+        if_packet_info.eob = false;
+
+        const size_t num_fragments = (nsamps_per_buff - 1) / _max_samples_per_packet;
+        const size_t final_length = ((nsamps_per_buff - 1) % _max_samples_per_packet) + 1;
+
+        // loop through the following fragment indexes
+        for (size_t i = 0; i < num_fragments; i++) {
+            // send a fragment with the helper function
+            const size_t num_samps_sent = send_one_packet_preconverted(entry,
+                _max_samples_per_packet,
+                if_packet_info,
+                timeout,
+                total_num_samps_sent * _num_inputs * _bytes_per_otw_item);
+            total_num_samps_sent += num_samps_sent;
+            if (num_samps_sent == 0)
+                return total_num_samps_sent;
+
+            // setup metadata for the next fragment
+            const time_spec_t time_spec =
+                metadata.time_spec
+                + time_spec_t::from_ticks(total_num_samps_sent, _samp_rate);
+            if_packet_info.tsf = time_spec.to_ticks(_tick_rate);
+            if_packet_info.sob = false;
+        }
+
+        // send the final fragment with the helper function
+        if_packet_info.eob = metadata.end_of_burst;
+        return total_num_samps_sent
+               + send_one_packet_preconverted(entry,
+                   final_length,
+                   if_packet_info,
+                   timeout,
+                   total_num_samps_sent * _num_inputs * _bytes_per_otw_item);
+    }
+
 private:
     vrt_packer_type _vrt_packer;
     size_t _header_offset_words32;
@@ -285,6 +471,7 @@ private:
         managed_send_buffer::sptr buff;
     };
     std::vector<xport_chan_props_type> _props;
+    stream_health_accumulator _health_acc;
     size_t _num_inputs;
     size_t _bytes_per_otw_item; // used in conversion
     size_t _bytes_per_cpu_item; // used in conversion
@@ -296,6 +483,15 @@ private:
     async_receiver_type _async_receiver;
     bool _cached_metadata;
     uhd::tx_metadata_t _metadata_cache;
+    bool _pipelined_sends = false;
+    bool _spin_wait_send  = false;
+    std::atomic<size_t> _late_burst_count{0};
+    struct preconverted_entry_type
+    {
+        size_t nsamps;
+        std::vector<std::vector<char>> otw_data; // per channel, wire format
+    };
+    std::vector<preconverted_entry_type> _preconverted;
 
 
     /*******************************************************************
@@ -317,9 +513,12 @@ private:
         // get a buffer for each channel or timeout
         for (xport_chan_props_type& props : _props) {
             if (not props.buff)
-                props.buff = props.get_buff(timeout);
-            if (not props.buff)
+                props.buff = _spin_wait_send ? spin_get_buff(props, timeout)
+                                             : props.get_buff(timeout);
+            if (not props.buff) {
+                _health_acc.record_timeout();
                 return 0; // timeout
+            }
         }
 
         // setup the data to share with converter threads
@@ -337,6 +536,19 @@ private:
         return nsamps_per_buff;
     }
 
+    //! Busy-wait for a send buffer until the timeout expires
+    UHD_INLINE managed_send_buffer::sptr spin_get_buff(
+        xport_chan_props_type& props, const double timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now()
+                              + std::chrono::microseconds(long(timeout * 1e6));
+        while (true) {
+            managed_send_buffer::sptr buff = props.get_buff(0.0);
+            if (buff or std::chrono::steady_clock::now() > deadline)
+                return buff;
+        }
+    }
+
     /*! Run the conversion from the user's buffers to the internal buffer.
      *
      * - Calls the converter
@@ -377,6 +589,80 @@ private:
         if (_props[index].go_postal) {
             _props[index].go_postal();
         }
+
+        // pipelined mode: grab the next buffer now (without blocking),
+        // overlapping the link's buffer turnaround with the caller
+        // producing the next packet's samples
+        if (_pipelined_sends) {
+            _props[index].buff = _props[index].get_buff(0.0);
+        }
+    }
+
+    /*******************************************************************
+     * Send a single packet from the preconverted cache:
+     * Same framing and commit path as send_one_packet(), but the
+     * payload is copied from the cached wire data instead of running
+     * the converter.
+     ******************************************************************/
+    UHD_INLINE size_t send_one_packet_preconverted(const preconverted_entry_type& entry,
+        const size_t nsamps_per_buff,
+        vrt::if_packet_info_t& if_packet_info,
+        const double timeout,
+        const size_t buffer_offset_bytes = 0)
+    {
+        // load the rest of the if_packet_info in here
+        if_packet_info.num_payload_bytes =
+            nsamps_per_buff * _num_inputs * _bytes_per_otw_item;
+        if_packet_info.num_payload_words32 =
+            (if_packet_info.num_payload_bytes + 3 /*round up*/) / sizeof(uint32_t);
+        if_packet_info.packet_count = _next_packet_seq;
+
+        // get a buffer for each channel or timeout
+        for (xport_chan_props_type& props : _props) {
+            if (not props.buff)
+                props.buff = _spin_wait_send ? spin_get_buff(props, timeout)
+                                             : props.get_buff(timeout);
+            if (not props.buff) {
+                _health_acc.record_timeout();
+                return 0; // timeout
+            }
+        }
+
+        // pack a header and copy the cached wire data for each channel
+        for (size_t index = 0; index < this->size(); index++) {
+            managed_send_buffer::sptr& buff = _props[index].buff;
+            vrt::if_packet_info_t info      = if_packet_info;
+
+            // pack metadata into a vrt header
+            uint32_t* otw_mem = buff->cast<uint32_t*>() + _header_offset_words32;
+            info.has_sid      = _props[index].has_sid;
+            info.sid          = _props[index].sid;
+            _vrt_packer(otw_mem, info);
+            otw_mem += info.num_header_words32;
+
+            // the payload comes straight from the cache
+            std::memcpy(otw_mem,
+                entry.otw_data[index].data() + buffer_offset_bytes,
+                info.num_payload_bytes);
+
+            // commit the samples to the zero-copy interface
+            const size_t num_vita_words32 =
+                _header_offset_words32 + info.num_packet_words32;
+            buff->commit(num_vita_words32 * sizeof(uint32_t));
+            buff.reset(); // effectively a release
+
+            if (_props[index].go_postal) {
+                _props[index].go_postal();
+            }
+
+            // pipelined mode: see convert_to_in_buff()
+            if (_pipelined_sends) {
+                _props[index].buff = _props[index].get_buff(0.0);
+            }
+        }
+
+        _next_packet_seq++; // increment sequence after commits
+        return nsamps_per_buff;
     }
 
     //! Shared variables for the worker threads
@@ -413,11 +699,29 @@ public:
         return send_packet_handler::send(buffs, nsamps_per_buff, metadata, timeout);
     }
 
+    size_t register_preconverted(
+        const tx_streamer::buffs_type& buffs, const size_t nsamps_per_buff) override
+    {
+        return send_packet_handler::register_preconverted(buffs, nsamps_per_buff);
+    }
+
+    size_t send_preconverted(const size_t handle,
+        const uhd::tx_metadata_t& metadata,
+        const double timeout) override
+    {
+        return send_packet_handler::send_preconverted(handle, metadata, timeout);
+    }
+
     bool recv_async_msg(
         uhd::async_metadata_t& async_metadata, double timeout = 0.1) override
     {
         return send_packet_handler::recv_async_msg(async_metadata, timeout);
     }
+
+    stream_health_t get_stream_health(void) const override
+    {
+        return send_packet_handler::get_stream_health();
+    }
     // Post an action to the output edge
     void post_output_action(
         const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
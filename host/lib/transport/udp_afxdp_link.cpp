@@ -0,0 +1,434 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_afxdp_link.hpp>
+#include <ifaddrs.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace asio = boost::asio;
+
+namespace {
+
+//! Bytes of Ethernet + IPv4 + UDP headers prepended to every frame
+constexpr size_t PKT_HDR_SIZE = sizeof(struct ethhdr) + sizeof(struct iphdr)
+                                + sizeof(struct udphdr);
+
+//! How long to wait for the kernel's neighbor table to resolve the peer
+constexpr int ARP_TIMEOUT_MS  = 1000;
+constexpr int ARP_INTERVAL_MS = 20;
+
+//! Standard one's-complement IPv4 header checksum
+uint16_t ipv4_hdr_checksum(const struct iphdr* hdr)
+{
+    const uint16_t* words = reinterpret_cast<const uint16_t*>(hdr);
+    uint32_t sum          = 0;
+    for (size_t i = 0; i < sizeof(struct iphdr) / 2; i++) {
+        sum += words[i];
+    }
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    return static_cast<uint16_t>(~sum);
+}
+
+//! Read the MAC address of a local interface
+void get_local_mac(const int sock_fd, const std::string& ifname, uint8_t* mac)
+{
+    struct ifreq req = {};
+    strncpy(req.ifr_name, ifname.c_str(), sizeof(req.ifr_name) - 1);
+    if (::ioctl(sock_fd, SIOCGIFHWADDR, &req) < 0) {
+        throw uhd::runtime_error(
+            "AF_XDP: Could not read MAC address of interface " + ifname);
+    }
+    memcpy(mac, req.ifr_hwaddr.sa_data, 6);
+}
+
+} // namespace
+
+udp_afxdp_link::udp_afxdp_link(const std::string& addr,
+    const std::string& port,
+    const size_t queue_id,
+    const link_params_t& params)
+    : _recv_frame_size(params.recv_frame_size)
+    , _num_recv_frames(params.num_recv_frames)
+    , _send_frame_size(params.send_frame_size)
+    , _num_send_frames(params.num_send_frames)
+    , _queue_id(queue_id)
+{
+    if (params.recv_frame_size > MAX_FRAME_SIZE
+        || params.send_frame_size > MAX_FRAME_SIZE) {
+        throw uhd::value_error(
+            str(boost::format("AF_XDP: Frame sizes must not exceed %d bytes "
+                              "(recv_frame_size=%d, send_frame_size=%d)")
+                % MAX_FRAME_SIZE % params.recv_frame_size % params.send_frame_size));
+    }
+
+    // The shadow socket reserves the local UDP port in the kernel, gives us
+    // the local endpoint, and is used to resolve the peer's MAC below
+    _shadow_socket = open_udp_socket(addr, port, _io_context);
+    const int sock_fd = _shadow_socket->native_handle();
+    _local_ipv4 =
+        ::htonl(_shadow_socket->local_endpoint().address().to_v4().to_uint());
+    _remote_ipv4 =
+        ::htonl(_shadow_socket->remote_endpoint().address().to_v4().to_uint());
+    _local_udp_port  = ::htons(_shadow_socket->local_endpoint().port());
+    _remote_udp_port = ::htons(_shadow_socket->remote_endpoint().port());
+
+    _ifname = get_iface_for_udp_dest(addr);
+    if (_ifname.empty()) {
+        throw uhd::runtime_error(
+            "AF_XDP: Could not find local interface with a route to " + addr);
+    }
+    get_local_mac(sock_fd, _ifname, _local_mac);
+
+    // Resolve the peer's MAC through the kernel's neighbor table. This must
+    // happen before the XDP socket is created: once it is bound, traffic on
+    // the bound queue (possibly including the ARP reply) bypasses the
+    // kernel. Sending a zero-length datagram triggers the ARP exchange.
+    bool resolved = false;
+    for (int waited = 0; waited < ARP_TIMEOUT_MS; waited += ARP_INTERVAL_MS) {
+        _shadow_socket->send(asio::buffer("", 0));
+        struct arpreq req        = {};
+        struct sockaddr_in* addr_in = reinterpret_cast<struct sockaddr_in*>(&req.arp_pa);
+        addr_in->sin_family      = AF_INET;
+        addr_in->sin_addr.s_addr = _remote_ipv4;
+        strncpy(req.arp_dev, _ifname.c_str(), sizeof(req.arp_dev) - 1);
+        if (::ioctl(sock_fd, SIOCGARP, &req) == 0 && (req.arp_flags & ATF_COM)) {
+            memcpy(_remote_mac, req.arp_ha.sa_data, 6);
+            resolved = true;
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(ARP_INTERVAL_MS));
+    }
+    if (!resolved) {
+        throw uhd::runtime_error(
+            "AF_XDP: Could not resolve MAC address of " + addr
+            + " (note: routing via gateways is not supported)");
+    }
+
+    // Create the UMEM region: each frame gets a chunk, with twice the
+    // number of recv frames so the fill ring stays stocked while buffers
+    // are held by the caller
+    const size_t num_rx_chunks = params.num_recv_frames * 2;
+    const size_t num_chunks    = num_rx_chunks + params.num_send_frames;
+    _umem_size                 = num_chunks * UMEM_CHUNK_SIZE;
+    _umem_area                 = ::mmap(nullptr,
+        _umem_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    if (_umem_area == MAP_FAILED) {
+        _umem_area = nullptr;
+        throw uhd::runtime_error("AF_XDP: Could not allocate UMEM region");
+    }
+
+    struct xsk_umem_config umem_cfg = {};
+    umem_cfg.fill_size              = XSK_RING_PROD__DEFAULT_NUM_DESCS;
+    umem_cfg.comp_size              = XSK_RING_CONS__DEFAULT_NUM_DESCS;
+    while (umem_cfg.fill_size < num_rx_chunks) {
+        umem_cfg.fill_size *= 2;
+    }
+    umem_cfg.frame_size      = UMEM_CHUNK_SIZE;
+    umem_cfg.frame_headroom  = 0;
+    int err = xsk_umem__create(
+        &_umem, _umem_area, _umem_size, &_fill_ring, &_comp_ring, &umem_cfg);
+    if (err) {
+        ::munmap(_umem_area, _umem_size);
+        _umem_area = nullptr;
+        throw uhd::runtime_error(str(
+            boost::format("AF_XDP: xsk_umem__create() failed: %s") % strerror(-err)));
+    }
+
+    // Bind the XDP socket to the NIC queue. Leaving bind_flags at 0 lets
+    // the library try zero-copy mode first and fall back to copy mode on
+    // drivers without native XDP support.
+    struct xsk_socket_config xsk_cfg = {};
+    xsk_cfg.rx_size                  = XSK_RING_CONS__DEFAULT_NUM_DESCS;
+    xsk_cfg.tx_size                  = XSK_RING_PROD__DEFAULT_NUM_DESCS;
+    err = xsk_socket__create(&_socket,
+        _ifname.c_str(),
+        uhd::narrow_cast<uint32_t>(queue_id),
+        _umem,
+        &_rx_ring,
+        &_tx_ring,
+        &xsk_cfg);
+    if (err) {
+        xsk_umem__delete(_umem);
+        _umem = nullptr;
+        ::munmap(_umem_area, _umem_size);
+        _umem_area = nullptr;
+        throw uhd::runtime_error(
+            str(boost::format("AF_XDP: Could not bind XDP socket to %s queue %d: %s "
+                              "(this requires CAP_NET_ADMIN/CAP_BPF)")
+                % _ifname % queue_id % strerror(-err)));
+    }
+
+    // Set up the frame buffs and hand all RX chunks to the fill ring
+    _buffs.reserve(num_chunks);
+    for (size_t i = 0; i < num_chunks; i++) {
+        const uint64_t chunk_addr = i * UMEM_CHUNK_SIZE;
+        const bool is_send        = (i >= num_rx_chunks);
+        // Send buffers always point past the headers this link prepends;
+        // recv buffer pointers are filled in per packet
+        void* mem = is_send ? static_cast<char*>(_umem_area) + chunk_addr + PKT_HDR_SIZE
+                            : nullptr;
+        _buffs.push_back(udp_afxdp_frame_buff(mem, chunk_addr, is_send));
+    }
+    for (size_t i = 0; i < num_rx_chunks; i++) {
+        _refill(i * UMEM_CHUNK_SIZE);
+    }
+    _send_free.reserve(params.num_send_frames);
+    for (size_t i = num_rx_chunks; i < num_chunks; i++) {
+        _send_free.push_back(&_buffs[i]);
+    }
+
+    auto info   = udp_boost_asio_adapter_info(*_shadow_socket);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("UDP") << boost::format(
+                                   "Created AF_XDP UDP link to %s:%s (%s queue %d)")
+                                   % addr % port % _ifname % queue_id;
+}
+
+udp_afxdp_link::~udp_afxdp_link()
+{
+    if (_socket) {
+        xsk_socket__delete(_socket);
+    }
+    if (_umem) {
+        xsk_umem__delete(_umem);
+    }
+    if (_umem_area) {
+        ::munmap(_umem_area, _umem_size);
+    }
+}
+
+udp_afxdp_link::sptr udp_afxdp_link::make(const std::string& addr,
+    const std::string& port,
+    const size_t queue_id,
+    const link_params_t& params)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+
+    return udp_afxdp_link::sptr(new udp_afxdp_link(addr, port, queue_id, params));
+}
+
+uint16_t udp_afxdp_link::get_local_port() const
+{
+    return ::ntohs(_local_udp_port);
+}
+
+void udp_afxdp_link::_refill(const uint64_t umem_addr)
+{
+    uint32_t idx;
+    // The fill ring is sized to hold every RX chunk, so this can only fail
+    // on a double-release
+    UHD_ASSERT_THROW(xsk_ring_prod__reserve(&_fill_ring, 1, &idx) == 1);
+    *xsk_ring_prod__fill_addr(&_fill_ring, idx) = umem_addr;
+    xsk_ring_prod__submit(&_fill_ring, 1);
+}
+
+void udp_afxdp_link::_reap_rx()
+{
+    uint32_t idx;
+    const uint32_t num_rx = xsk_ring_cons__peek(&_rx_ring, _num_recv_frames, &idx);
+    for (uint32_t i = 0; i < num_rx; i++, idx++) {
+        const struct xdp_desc* desc = xsk_ring_cons__rx_desc(&_rx_ring, idx);
+        char* pkt = static_cast<char*>(xsk_umem__get_data(_umem_area, desc->addr));
+        const uint64_t chunk_addr = desc->addr & ~(uint64_t(UMEM_CHUNK_SIZE) - 1);
+
+        // Frames that do not belong to this link's flow (e.g. RSS spillover
+        // onto the bound queue) are dropped
+        const struct ethhdr* eth = reinterpret_cast<const struct ethhdr*>(pkt);
+        const struct iphdr* ip = reinterpret_cast<const struct iphdr*>(pkt + sizeof(*eth));
+        const struct udphdr* udp =
+            reinterpret_cast<const struct udphdr*>(pkt + sizeof(*eth) + sizeof(*ip));
+        if (desc->len < PKT_HDR_SIZE || eth->h_proto != ::htons(ETH_P_IP)
+            || ip->ihl != 5 || ip->protocol != IPPROTO_UDP
+            || ip->saddr != _remote_ipv4 || ip->daddr != _local_ipv4
+            || udp->source != _remote_udp_port || udp->dest != _local_udp_port) {
+            _refill(chunk_addr);
+            continue;
+        }
+
+        udp_afxdp_frame_buff* buff = &_buffs[chunk_addr / UMEM_CHUNK_SIZE];
+        buff->set_data(pkt + PKT_HDR_SIZE);
+        buff->set_packet_size(::ntohs(udp->len) - sizeof(*udp));
+        _recv_ready.push_back(buff);
+    }
+    xsk_ring_cons__release(&_rx_ring, num_rx);
+}
+
+void udp_afxdp_link::_reap_tx_completions()
+{
+    uint32_t idx;
+    const uint32_t num_done = xsk_ring_cons__peek(&_comp_ring, _num_send_frames, &idx);
+    for (uint32_t i = 0; i < num_done; i++, idx++) {
+        const uint64_t addr = *xsk_ring_cons__comp_addr(&_comp_ring, idx);
+        _send_free.push_back(&_buffs[addr / UMEM_CHUNK_SIZE]);
+    }
+    xsk_ring_cons__release(&_comp_ring, num_done);
+}
+
+void udp_afxdp_link::_kick_rings()
+{
+    const int fd = xsk_socket__fd(_socket);
+    if (xsk_ring_prod__needs_wakeup(&_fill_ring)) {
+        ::recvfrom(fd, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+    }
+    if (xsk_ring_prod__needs_wakeup(&_tx_ring)) {
+        ::sendto(fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0);
+    }
+}
+
+bool udp_afxdp_link::_poll_rx(int32_t timeout_ms)
+{
+    struct pollfd pfd = {};
+    pfd.fd            = xsk_socket__fd(_socket);
+    pfd.events        = POLLIN;
+    return ::poll(&pfd, 1, timeout_ms) > 0;
+}
+
+frame_buff::uptr udp_afxdp_link::get_recv_buff(int32_t timeout_ms)
+{
+    if (_recv_ready.empty()) {
+        _reap_rx();
+    }
+    if (_recv_ready.empty()) {
+        _kick_rings();
+        if (!timeout_ms || !_poll_rx(timeout_ms)) {
+            if (timeout_ms) {
+                _recv_stats.record_timeout();
+            }
+            return frame_buff::uptr();
+        }
+        _reap_rx();
+        if (_recv_ready.empty()) {
+            // Whatever woke the poll was dropped as not ours
+            return frame_buff::uptr();
+        }
+    }
+    frame_buff* buff = _recv_ready.front();
+    _recv_ready.pop_front();
+    _recv_stats.record_packet(buff->packet_size());
+    return frame_buff::uptr(buff);
+}
+
+void udp_afxdp_link::release_recv_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+    buff_ptr->set_packet_size(0);
+    _refill(static_cast<udp_afxdp_frame_buff*>(buff_ptr)->umem_addr());
+}
+
+frame_buff::uptr udp_afxdp_link::get_send_buff(int32_t timeout_ms)
+{
+    if (_send_free.empty()) {
+        _reap_tx_completions();
+    }
+    if (_send_free.empty() && !timeout_ms) {
+        _kick_rings();
+        _send_stats.record_timeout();
+        return frame_buff::uptr();
+    }
+    // TX completions have no pollable event, so yield and re-check, bounded
+    // by the caller's timeout. A negative timeout blocks until a frame
+    // completes, matching get_recv_buff().
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (_send_free.empty()) {
+        _kick_rings();
+        std::this_thread::yield();
+        _reap_tx_completions();
+        if (_send_free.empty() && timeout_ms > 0
+            && std::chrono::steady_clock::now() >= deadline) {
+            _send_stats.record_timeout();
+            return frame_buff::uptr();
+        }
+    }
+    frame_buff* buff = _send_free.back();
+    _send_free.pop_back();
+    return frame_buff::uptr(buff);
+}
+
+void udp_afxdp_link::release_send_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    if (buff_ptr->packet_size() == 0) {
+        _send_free.push_back(buff_ptr);
+        return;
+    }
+
+    auto& xdp_buff     = static_cast<udp_afxdp_frame_buff&>(*buff_ptr);
+    const size_t psize = xdp_buff.packet_size();
+    char* pkt = static_cast<char*>(xsk_umem__get_data(_umem_area, xdp_buff.umem_addr()));
+
+    // Build the Ethernet/IPv4/UDP headers in front of the payload
+    struct ethhdr* eth = reinterpret_cast<struct ethhdr*>(pkt);
+    memcpy(eth->h_dest, _remote_mac, 6);
+    memcpy(eth->h_source, _local_mac, 6);
+    eth->h_proto = ::htons(ETH_P_IP);
+
+    struct iphdr* ip = reinterpret_cast<struct iphdr*>(pkt + sizeof(*eth));
+    ip->version      = 4;
+    ip->ihl          = 5;
+    ip->tos          = 0;
+    ip->tot_len      = ::htons(sizeof(*ip) + sizeof(struct udphdr) + psize);
+    ip->id           = ::htons(_ip_ident++);
+    ip->frag_off     = 0;
+    ip->ttl          = 64;
+    ip->protocol     = IPPROTO_UDP;
+    ip->check        = 0;
+    ip->saddr        = _local_ipv4;
+    ip->daddr        = _remote_ipv4;
+    ip->check        = ipv4_hdr_checksum(ip);
+
+    struct udphdr* udp = reinterpret_cast<struct udphdr*>(pkt + sizeof(*eth) + sizeof(*ip));
+    udp->source        = _local_udp_port;
+    udp->dest          = _remote_udp_port;
+    udp->len           = ::htons(sizeof(*udp) + psize);
+    udp->check         = 0; // Optional for IPv4
+
+    uint32_t idx;
+    while (xsk_ring_prod__reserve(&_tx_ring, 1, &idx) != 1) {
+        // TX ring full: harvest completions and kick the kernel
+        _reap_tx_completions();
+        _kick_rings();
+    }
+    struct xdp_desc* desc = xsk_ring_prod__tx_desc(&_tx_ring, idx);
+    desc->addr            = xdp_buff.umem_addr();
+    desc->len             = uhd::narrow_cast<uint32_t>(PKT_HDR_SIZE + psize);
+    desc->options         = 0;
+    xsk_ring_prod__submit(&_tx_ring, 1);
+    if (xsk_ring_prod__needs_wakeup(&_tx_ring)) {
+        ::sendto(xsk_socket__fd(_socket), nullptr, 0, MSG_DONTWAIT, nullptr, 0);
+    }
+    _send_stats.record_packet(psize);
+}
@@ -13,13 +13,62 @@ using namespace uhd::transport;
 
 namespace asio = boost::asio;
 
-udp_boost_asio_link::udp_boost_asio_link(
-    const std::string& addr, const std::string& port, const link_params_t& params)
+namespace {
+
+// Build the pool allocation policy from the link parameters, resolving the
+// "auto" NUMA node to the node of the adapter that routes to addr
+buffer_pool::alloc_policy_t make_pool_policy(
+    const link_params_t& params, const std::string& addr)
+{
+    buffer_pool::alloc_policy_t policy;
+    policy.use_hugepages = params.use_hugepages;
+    policy.numa_node     = params.numa_node;
+#ifdef UHD_PLATFORM_LINUX
+    if (params.numa_node == LINK_NUMA_NODE_AUTO) {
+        policy.numa_node = get_numa_node_for_udp_dest(addr);
+    }
+#else
+    if (params.numa_node == LINK_NUMA_NODE_AUTO) {
+        policy.numa_node = -1;
+    }
+#endif
+    if (params.use_ext_alloc) {
+        policy.ext_alloc = buffer_pool::get_external_allocator();
+        if (!policy.ext_alloc) {
+            UHD_LOG_WARNING("UDP",
+                "ext_alloc was requested, but no external allocator is "
+                "installed (see buffer_pool::set_external_allocator()); "
+                "using host memory");
+        }
+    }
+    return policy;
+}
+
+} // namespace
+
+udp_boost_asio_link::udp_boost_asio_link(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const bool recv_batching)
     : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
     , send_link_base_t(params.num_send_frames, params.send_frame_size)
-    , _recv_memory_pool(buffer_pool::make(params.num_recv_frames, params.recv_frame_size))
-    , _send_memory_pool(buffer_pool::make(params.num_send_frames, params.send_frame_size))
+    , _recv_memory_pool(buffer_pool::make(
+          params.num_recv_frames, params.recv_frame_size, make_pool_policy(params, addr)))
+    , _send_memory_pool(buffer_pool::make(
+          params.num_send_frames, params.send_frame_size, make_pool_policy(params, addr)))
+#ifdef UHD_PLATFORM_LINUX
+    , _recv_batching(recv_batching)
+#else
+    , _recv_batching(false)
+#endif
 {
+#ifndef UHD_PLATFORM_LINUX
+    if (recv_batching) {
+        UHD_LOG_WARNING(
+            "UDP", "Batched receive (recvmmsg) is only available on Linux, ignoring");
+    }
+#endif
+
     for (size_t i = 0; i < params.num_recv_frames; i++) {
         _recv_buffs.push_back(udp_boost_asio_frame_buff(_recv_memory_pool->at(i)));
     }
@@ -28,8 +77,34 @@ udp_boost_asio_link::udp_boost_asio_link(
         _send_buffs.push_back(udp_boost_asio_frame_buff(_send_memory_pool->at(i)));
     }
 
-    for (auto& buff : _recv_buffs) {
-        recv_link_base_t::preload_free_buff(&buff);
+    if (params.use_ext_alloc && buffer_pool::get_external_allocator()) {
+        // Let consumers of the zero-copy path know the frame memory is
+        // externally managed (e.g., GPU-accessible)
+        for (auto& buff : _recv_buffs) {
+            buff.set_mem_type(frame_buff::mem_type_t::EXTERNAL);
+        }
+        for (auto& buff : _send_buffs) {
+            buff.set_mem_type(frame_buff::mem_type_t::EXTERNAL);
+        }
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    if (_recv_batching) {
+        // In batched mode the buffers cycle through our own free pool and
+        // ready queue instead of the base class free buffer pool.
+        _batch_free_buffs.reserve(params.num_recv_frames);
+        for (auto& buff : _recv_buffs) {
+            _batch_free_buffs.push_back(&buff);
+        }
+        _batch_msgs.resize(params.num_recv_frames);
+        _batch_iovecs.resize(params.num_recv_frames);
+    }
+#endif
+
+    if (!_recv_batching) {
+        for (auto& buff : _recv_buffs) {
+            recv_link_base_t::preload_free_buff(&buff);
+        }
     }
 
     for (auto& buff : _send_buffs) {
@@ -39,6 +114,7 @@ udp_boost_asio_link::udp_boost_asio_link(
     // create, open, and connect the socket
     _socket  = open_udp_socket(addr, port, _io_context);
     _sock_fd = _socket->native_handle();
+    set_udp_socket_tos(_socket, params.ip_tos);
 
     auto info   = udp_boost_asio_adapter_info(*_socket);
     auto& ctx   = adapter_ctx::get();
@@ -75,7 +151,8 @@ udp_boost_asio_link::sptr udp_boost_asio_link::make(const std::string& addr,
     const std::string& port,
     const link_params_t& params,
     size_t& recv_socket_buff_size,
-    size_t& send_socket_buff_size)
+    size_t& send_socket_buff_size,
+    const bool recv_batching)
 {
     UHD_ASSERT_THROW(params.num_recv_frames != 0);
     UHD_ASSERT_THROW(params.num_send_frames != 0);
@@ -84,7 +161,8 @@ udp_boost_asio_link::sptr udp_boost_asio_link::make(const std::string& addr,
     UHD_ASSERT_THROW(params.recv_buff_size != 0);
     UHD_ASSERT_THROW(params.send_buff_size != 0);
 
-    udp_boost_asio_link::sptr link(new udp_boost_asio_link(addr, port, params));
+    udp_boost_asio_link::sptr link(
+        new udp_boost_asio_link(addr, port, params, recv_batching));
 
     // call the helper to resize send and recv buffers
 
@@ -116,3 +194,105 @@ udp_boost_asio_link::sptr udp_boost_asio_link::make(const std::string& addr,
 
     return link;
 }
+
+#ifndef UHD_PLATFORM_WIN32
+void udp_boost_asio_link::release_send_buff_sg(
+    frame_buff::uptr buff, const void* payload, const size_t payload_size)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    iovec iov[2];
+    iov[0] = {buff_ptr->data(), buff_ptr->packet_size()};
+    iov[1] = {const_cast<void*>(payload), payload_size};
+    send_udp_packet_sg(_sock_fd, iov, 2, buff_ptr->packet_size() + payload_size);
+    send_stats_counters().record_packet(buff_ptr->packet_size() + payload_size);
+
+    // Return the frame to the pool without sending it again
+    buff_ptr->set_packet_size(0);
+    send_link_base_t::release_send_buff(frame_buff::uptr(buff_ptr));
+}
+#endif /* !UHD_PLATFORM_WIN32 */
+
+#ifdef UHD_PLATFORM_LINUX
+
+size_t udp_boost_asio_link::_refill_ready_queue(int32_t timeout_ms)
+{
+    const unsigned num_buffs = uhd::narrow_cast<unsigned>(_batch_free_buffs.size());
+    if (num_buffs == 0) {
+        return 0;
+    }
+
+    for (unsigned i = 0; i < num_buffs; i++) {
+        frame_buff* buff        = _batch_free_buffs[i];
+        _batch_iovecs[i]        = {buff->data(), get_recv_frame_size()};
+        _batch_msgs[i].msg_hdr  = {};
+        _batch_msgs[i].msg_hdr.msg_iov    = &_batch_iovecs[i];
+        _batch_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // Try a non-blocking batch first, then wait for the socket to become
+    // ready and pull whatever has arrived in one kernel crossing.
+    int num_rcvd =
+        ::recvmmsg(_sock_fd, _batch_msgs.data(), num_buffs, MSG_DONTWAIT, nullptr);
+
+    if (num_rcvd < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            throw uhd::io_error(
+                str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+        }
+        if (!wait_for_recv_ready(_sock_fd, timeout_ms)) {
+            return 0; // timeout
+        }
+        num_rcvd =
+            ::recvmmsg(_sock_fd, _batch_msgs.data(), num_buffs, MSG_DONTWAIT, nullptr);
+        if (num_rcvd < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return 0;
+            }
+            throw uhd::io_error(
+                str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+        }
+    }
+
+    for (int i = 0; i < num_rcvd; i++) {
+        frame_buff* buff = _batch_free_buffs[i];
+        buff->set_packet_size(_batch_msgs[i].msg_len);
+        _batch_ready_buffs.push_back(buff);
+    }
+    _batch_free_buffs.erase(_batch_free_buffs.begin(), _batch_free_buffs.begin() + num_rcvd);
+
+    return num_rcvd;
+}
+
+frame_buff::uptr udp_boost_asio_link::get_recv_buff(int32_t timeout_ms)
+{
+    if (!_recv_batching) {
+        return recv_link_base_t::get_recv_buff(timeout_ms);
+    }
+
+    if (_batch_ready_buffs.empty() && _refill_ready_queue(timeout_ms) == 0) {
+        recv_stats_counters().record_timeout();
+        return frame_buff::uptr();
+    }
+
+    frame_buff* buff = _batch_ready_buffs.front();
+    _batch_ready_buffs.pop_front();
+    recv_stats_counters().record_packet(buff->packet_size());
+    return frame_buff::uptr(buff);
+}
+
+void udp_boost_asio_link::release_recv_buff(frame_buff::uptr buff)
+{
+    if (!_recv_batching) {
+        recv_link_base_t::release_recv_buff(std::move(buff));
+        return;
+    }
+
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+    buff_ptr->set_packet_size(0);
+    _batch_free_buffs.push_back(buff_ptr);
+}
+
+#endif /* UHD_PLATFORM_LINUX */
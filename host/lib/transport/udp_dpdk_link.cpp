@@ -197,20 +197,46 @@ void udp_dpdk_link::release_send_buff(frame_buff::uptr buff)
             _local_port,
             _remote_port,
             buff_ptr->packet_size());
-        // Prepare the packet buffer and send it out
-        int status = rte_eth_tx_prepare(_port->get_port_id(), _queue, &mbuf, 1);
-        if (status != 1) {
-            throw uhd::runtime_error("DPDK: Failed to prepare TX buffer for send");
-        }
-        status = rte_eth_tx_burst(_port->get_port_id(), _queue, &mbuf, 1);
-        while (status != 1) {
-            status = rte_eth_tx_burst(_port->get_port_id(), _queue, &mbuf, 1);
-            // FIXME: Should we make available retrying?
-            // throw uhd::runtime_error("DPDK: Failed to send TX buffer");
+        // Stage the packet buffer; unless we are coalescing a TX batch, it
+        // goes out immediately
+        _tx_batch[_tx_batch_count++] = mbuf;
+        if (!_tx_batching || _tx_batch_count == MAX_TX_BATCH_SIZE) {
+            _flush_tx_batch();
         }
     } else {
         // Release the buffer if there is nothing in it
         rte_pktmbuf_free(mbuf);
     }
 }
+
+void udp_dpdk_link::tx_batch_begin()
+{
+    _tx_batching = true;
+}
+
+void udp_dpdk_link::tx_batch_flush()
+{
+    if (_tx_batch_count) {
+        _flush_tx_batch();
+    }
+    _tx_batching = false;
+}
+
+void udp_dpdk_link::_flush_tx_batch()
+{
+    // Prepare the packet buffers and send them out in one burst
+    const uint16_t num_tx = _tx_batch_count;
+    _tx_batch_count       = 0;
+    if (rte_eth_tx_prepare(_port->get_port_id(), _queue, _tx_batch, num_tx) != num_tx) {
+        throw uhd::runtime_error("DPDK: Failed to prepare TX buffer for send");
+    }
+    uint16_t num_sent = rte_eth_tx_burst(_port->get_port_id(), _queue, _tx_batch, num_tx);
+    while (num_sent != num_tx) {
+        // The descriptor ring is full: keep retrying the unsent tail
+        // FIXME: Should we make available retrying?
+        // throw uhd::runtime_error("DPDK: Failed to send TX buffer");
+        num_sent += rte_eth_tx_burst(
+            _port->get_port_id(), _queue, &_tx_batch[num_sent], num_tx - num_sent);
+    }
+}
 #pragma GCC diagnostic pop
@@ -0,0 +1,344 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_iouring_link.hpp>
+#include <boost/format.hpp>
+#include <cstring>
+
+using namespace uhd::transport;
+
+namespace asio = boost::asio;
+
+namespace {
+
+// Tag for send completions in the CQE user_data field. The low bits hold a
+// pointer to the frame buffer, which is at least 8-byte aligned, so bit 0 is
+// always free.
+constexpr uint64_t SEND_COMPLETION_FLAG = 0x1;
+
+uint64_t buff_to_user_data(udp_iouring_frame_buff& buff)
+{
+    return reinterpret_cast<uint64_t>(&buff)
+           | (buff.is_send() ? SEND_COMPLETION_FLAG : 0);
+}
+
+udp_iouring_frame_buff* user_data_to_buff(const uint64_t user_data)
+{
+    return reinterpret_cast<udp_iouring_frame_buff*>(
+        user_data & ~SEND_COMPLETION_FLAG);
+}
+
+buffer_pool::alloc_policy_t make_pool_policy(
+    const link_params_t& params, const std::string& addr)
+{
+    buffer_pool::alloc_policy_t policy;
+    policy.use_hugepages = params.use_hugepages;
+    policy.numa_node     = (params.numa_node == LINK_NUMA_NODE_AUTO)
+                               ? get_numa_node_for_udp_dest(addr)
+                               : params.numa_node;
+    if (params.use_ext_alloc) {
+        policy.ext_alloc = buffer_pool::get_external_allocator();
+        if (!policy.ext_alloc) {
+            UHD_LOG_WARNING("UDP",
+                "ext_alloc was requested, but no external allocator is "
+                "installed (see buffer_pool::set_external_allocator()); "
+                "using host memory");
+        }
+    }
+    return policy;
+}
+
+} // namespace
+
+udp_iouring_link::udp_iouring_link(
+    const std::string& addr, const std::string& port, const link_params_t& params)
+    : _recv_frame_size(params.recv_frame_size)
+    , _num_recv_frames(params.num_recv_frames)
+    , _send_frame_size(params.send_frame_size)
+    , _num_send_frames(params.num_send_frames)
+    , _recv_memory_pool(buffer_pool::make(
+          params.num_recv_frames, params.recv_frame_size, make_pool_policy(params, addr)))
+    , _send_memory_pool(buffer_pool::make(
+          params.num_send_frames, params.send_frame_size, make_pool_policy(params, addr)))
+{
+    // create, open, and connect the socket
+    _socket  = open_udp_socket(addr, port, _io_context);
+    _sock_fd = _socket->native_handle();
+    set_udp_socket_tos(_socket, params.ip_tos);
+
+    const unsigned ring_depth =
+        uhd::narrow_cast<unsigned>(params.num_recv_frames + params.num_send_frames);
+    const int err = io_uring_queue_init(ring_depth, &_ring, 0);
+    if (err < 0) {
+        throw uhd::runtime_error(
+            str(boost::format("io_uring_queue_init() failed: %s") % strerror(-err)));
+    }
+    _ring_initialized = true;
+
+    // Register all frame memory with the kernel so the SQEs can reference
+    // buffers by index and the kernel can skip per-operation page pinning.
+    std::vector<iovec> iovecs(params.num_recv_frames + params.num_send_frames);
+    uint16_t index = 0;
+    for (size_t i = 0; i < params.num_recv_frames; i++, index++) {
+        iovecs[index].iov_base = _recv_memory_pool->at(i);
+        iovecs[index].iov_len  = params.recv_frame_size;
+        _recv_buffs.push_back(
+            udp_iouring_frame_buff(_recv_memory_pool->at(i), index, false));
+    }
+    for (size_t i = 0; i < params.num_send_frames; i++, index++) {
+        iovecs[index].iov_base = _send_memory_pool->at(i);
+        iovecs[index].iov_len  = params.send_frame_size;
+        _send_buffs.push_back(
+            udp_iouring_frame_buff(_send_memory_pool->at(i), index, true));
+    }
+
+    if (params.use_ext_alloc && buffer_pool::get_external_allocator()) {
+        // Let consumers of the zero-copy path know the frame memory is
+        // externally managed (e.g., GPU-accessible)
+        for (auto& buff : _recv_buffs) {
+            buff.set_mem_type(frame_buff::mem_type_t::EXTERNAL);
+        }
+        for (auto& buff : _send_buffs) {
+            buff.set_mem_type(frame_buff::mem_type_t::EXTERNAL);
+        }
+    }
+
+    const int reg_err = io_uring_register_buffers(
+        &_ring, iovecs.data(), uhd::narrow_cast<unsigned>(iovecs.size()));
+    if (reg_err < 0) {
+        io_uring_queue_exit(&_ring);
+        _ring_initialized = false;
+        throw uhd::runtime_error(str(
+            boost::format("io_uring_register_buffers() failed: %s (check "
+                          "RLIMIT_MEMLOCK or reduce num_recv_frames/num_send_frames)")
+            % strerror(-reg_err)));
+    }
+
+    // Arm one read SQE per receive frame and flush them in a single submit
+    for (auto& buff : _recv_buffs) {
+        _arm_recv_buff(buff);
+    }
+    io_uring_submit(&_ring);
+    _pending_sqes = 0;
+
+    _send_free.reserve(params.num_send_frames);
+    for (auto& buff : _send_buffs) {
+        _send_free.push_back(&buff);
+    }
+
+    auto info   = udp_boost_asio_adapter_info(*_socket);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("UDP") << boost::format(
+                                   "Created io_uring UDP link to %s:%s (ring depth %u)")
+                                   % addr % port % ring_depth;
+}
+
+udp_iouring_link::~udp_iouring_link()
+{
+    if (_ring_initialized) {
+        io_uring_unregister_buffers(&_ring);
+        io_uring_queue_exit(&_ring);
+    }
+}
+
+udp_iouring_link::sptr udp_iouring_link::make(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    size_t& recv_socket_buff_size,
+    size_t& send_socket_buff_size)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+    UHD_ASSERT_THROW(params.recv_buff_size != 0);
+    UHD_ASSERT_THROW(params.send_buff_size != 0);
+
+    udp_iouring_link::sptr link(new udp_iouring_link(addr, port, params));
+
+    // call the helper to resize send and recv buffers
+    recv_socket_buff_size = resize_udp_socket_buffer_with_warning(
+        [link](size_t size) { return link->resize_recv_socket_buffer(size); },
+        params.recv_buff_size,
+        "recv");
+    send_socket_buff_size = resize_udp_socket_buffer_with_warning(
+        [link](size_t size) { return link->resize_send_socket_buffer(size); },
+        params.send_buff_size,
+        "send");
+
+    return link;
+}
+
+uint16_t udp_iouring_link::get_local_port() const
+{
+    return _socket->local_endpoint().port();
+}
+
+size_t udp_iouring_link::resize_recv_socket_buffer(size_t num_bytes)
+{
+    return resize_udp_socket_buffer<asio::socket_base::receive_buffer_size>(
+        _socket, num_bytes);
+}
+
+size_t udp_iouring_link::resize_send_socket_buffer(size_t num_bytes)
+{
+    return resize_udp_socket_buffer<asio::socket_base::send_buffer_size>(
+        _socket, num_bytes);
+}
+
+void udp_iouring_link::_arm_recv_buff(udp_iouring_frame_buff& buff)
+{
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&_ring);
+    // The ring is sized for one SQE per frame, so this cannot run dry unless
+    // a buffer is double-released.
+    UHD_ASSERT_THROW(sqe != nullptr);
+    io_uring_prep_read_fixed(
+        sqe, _sock_fd, buff.data(), _recv_frame_size, 0, buff.index());
+    io_uring_sqe_set_data64(sqe, buff_to_user_data(buff));
+    _pending_sqes++;
+}
+
+void udp_iouring_link::_reap_completions()
+{
+    struct io_uring_cqe* cqe;
+    unsigned head;
+    unsigned count = 0;
+    io_uring_for_each_cqe(&_ring, head, cqe)
+    {
+        udp_iouring_frame_buff* buff = user_data_to_buff(cqe->user_data);
+        if (cqe->user_data & SEND_COMPLETION_FLAG) {
+            if (cqe->res < 0) {
+                UHD_LOG_ERROR("UDP",
+                    "io_uring send completed with error: " << strerror(-cqe->res));
+            }
+            buff->set_packet_size(0);
+            _send_free.push_back(buff);
+        } else {
+            if (cqe->res < 0) {
+                // Receive error (e.g. ECONNREFUSED after an ICMP error):
+                // log and re-arm the buffer rather than leaking it.
+                UHD_LOG_ERROR("UDP",
+                    "io_uring recv completed with error: " << strerror(-cqe->res));
+                _arm_recv_buff(*buff);
+            } else {
+                buff->set_packet_size(cqe->res);
+                _recv_ready.push_back(buff);
+            }
+        }
+        count++;
+    }
+    io_uring_cq_advance(&_ring, count);
+}
+
+bool udp_iouring_link::_submit_and_wait(int32_t timeout_ms)
+{
+    struct io_uring_cqe* cqe = nullptr;
+    if (timeout_ms < 0) {
+        // Block until a completion arrives
+        const int err = io_uring_submit_and_wait(&_ring, 1);
+        if (err < 0) {
+            return false;
+        }
+        _pending_sqes = 0;
+        return io_uring_peek_cqe(&_ring, &cqe) == 0;
+    }
+
+    struct __kernel_timespec ts;
+    ts.tv_sec  = timeout_ms / 1000;
+    ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+
+    if (_pending_sqes > 0) {
+        io_uring_submit(&_ring);
+        _pending_sqes = 0;
+    }
+    return io_uring_wait_cqe_timeout(&_ring, &cqe, &ts) == 0;
+}
+
+frame_buff::uptr udp_iouring_link::get_recv_buff(int32_t timeout_ms)
+{
+    if (_recv_ready.empty()) {
+        _reap_completions();
+    }
+    if (_recv_ready.empty()) {
+        // Completion queue ran dry: flush any re-armed SQEs in one syscall
+        // and wait for the next completion.
+        if (!_submit_and_wait(timeout_ms)) {
+            _recv_stats.record_timeout();
+            return frame_buff::uptr();
+        }
+        _reap_completions();
+        if (_recv_ready.empty()) {
+            // The completion was a send completion
+            return frame_buff::uptr();
+        }
+    }
+    frame_buff* buff = _recv_ready.front();
+    _recv_ready.pop_front();
+    _recv_stats.record_packet(buff->packet_size());
+    return frame_buff::uptr(buff);
+}
+
+void udp_iouring_link::release_recv_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+    buff_ptr->set_packet_size(0);
+    // Re-arm without submitting; the SQE is flushed the next time the
+    // completion queue runs dry, amortizing the submit syscall over a burst.
+    _arm_recv_buff(static_cast<udp_iouring_frame_buff&>(*buff_ptr));
+}
+
+frame_buff::uptr udp_iouring_link::get_send_buff(int32_t timeout_ms)
+{
+    if (_send_free.empty()) {
+        _reap_completions();
+    }
+    while (_send_free.empty()) {
+        if (!_submit_and_wait(timeout_ms)) {
+            _send_stats.record_timeout();
+            return frame_buff::uptr();
+        }
+        _reap_completions();
+    }
+    frame_buff* buff = _send_free.back();
+    _send_free.pop_back();
+    return frame_buff::uptr(buff);
+}
+
+void udp_iouring_link::release_send_buff(frame_buff::uptr buff)
+{
+    frame_buff* buff_ptr = buff.release();
+    assert(buff_ptr);
+
+    if (buff_ptr->packet_size() == 0) {
+        _send_free.push_back(buff_ptr);
+        return;
+    }
+
+    auto& iouring_buff = static_cast<udp_iouring_frame_buff&>(*buff_ptr);
+
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&_ring);
+    UHD_ASSERT_THROW(sqe != nullptr);
+    io_uring_prep_write_fixed(sqe,
+        _sock_fd,
+        iouring_buff.data(),
+        iouring_buff.packet_size(),
+        0,
+        iouring_buff.index());
+    io_uring_sqe_set_data64(sqe, buff_to_user_data(iouring_buff));
+
+    // Submit immediately: TX frames are latency-sensitive (flow control
+    // responses, timed commands), and any re-armed recv SQEs ride along in
+    // the same submit.
+    io_uring_submit(&_ring);
+    _pending_sqes = 0;
+    _send_stats.record_packet(iouring_buff.packet_size());
+}
@@ -19,9 +19,26 @@ namespace uhd { namespace transport { namespace dpdk {
 
 namespace {
 
-constexpr size_t DEFAULT_FRAME_SIZE   = 8000;
-constexpr int DEFAULT_NUM_MBUFS       = 1024;
-constexpr int DEFAULT_MBUF_CACHE_SIZE = 315;
+constexpr size_t DEFAULT_FRAME_SIZE = 8000;
+constexpr int DEFAULT_NUM_MBUFS     = 1024;
+
+/*! Pick a per-lcore mempool cache size for a pool of num_bufs buffers
+ *
+ * The best cache size is the largest divisor of the pool size that does not
+ * exceed RTE_MEMPOOL_CACHE_MAX_SIZE: mempool get/put then stay core-local
+ * under load, and the pool never ends up fragmented across caches in a way
+ * that starves other lcores.
+ */
+int compute_mbuf_cache_size(size_t num_bufs)
+{
+    const size_t max_cache = std::min<size_t>(RTE_MEMPOOL_CACHE_MAX_SIZE, num_bufs / 2);
+    for (size_t cache = max_cache; cache > 0; cache--) {
+        if (num_bufs % cache == 0) {
+            return static_cast<int>(cache);
+        }
+    }
+    return 0;
+}
 // constexpr size_t DPDK_HEADERS_SIZE           = 14 + 20 + 8; // Ethernet + IPv4 + UDP
 constexpr uint16_t DPDK_DEFAULT_RING_SIZE    = 512;
 constexpr int DEFAULT_DPDK_LINK_INIT_TIMEOUT = 1000;
@@ -210,7 +227,12 @@ dpdk_port::dpdk_port(port_id_t port,
         }
     }
 
-    /* TODO: Enable multiple queues (only support 1 right now) */
+    /* Queue 0 is the shared default queue; all other queues are available
+     * for dedicated assignment to receive flows (see alloc_rx_flow()) */
+    _free_rx_queues.reserve(_num_queues - 1);
+    for (uint16_t i = _num_queues - 1; i > 0; i--) {
+        _free_rx_queues.push_back(i);
+    }
 
     /* Start the Ethernet device */
     retval = rte_eth_dev_start(_port);
@@ -228,6 +250,7 @@ dpdk_port::dpdk_port(port_id_t port,
 
 dpdk_port::~dpdk_port()
 {
+    rte_flow_flush(_port, NULL);
     rte_eth_dev_stop(_port);
     rte_spinlock_lock(&_spinlock);
     for (auto kv : _arp_table) {
@@ -273,6 +296,91 @@ uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
     return rte_cpu_to_be_16(port_selected);
 }
 
+queue_id_t dpdk_port::alloc_rx_flow(uint16_t udp_dst_port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_free_rx_queues.empty()) {
+        return 0;
+    }
+    const queue_id_t queue_id = _free_rx_queues.back();
+
+    /* Match ingress UDP packets to this port's IPv4 address and the flow's
+     * destination UDP port, and steer them to the dedicated queue */
+    struct rte_flow_attr attr = {};
+    attr.ingress              = 1;
+
+    struct rte_flow_item_ipv4 ip_spec = {};
+    struct rte_flow_item_ipv4 ip_mask = {};
+    ip_spec.hdr.dst_addr              = _ipv4;
+    ip_mask.hdr.dst_addr              = 0xffffffff;
+
+    struct rte_flow_item_udp udp_spec = {};
+    struct rte_flow_item_udp udp_mask = {};
+    udp_spec.hdr.dst_port             = udp_dst_port;
+    udp_mask.hdr.dst_port             = 0xffff;
+
+    struct rte_flow_item pattern[4] = {};
+    pattern[0].type                 = RTE_FLOW_ITEM_TYPE_ETH;
+    pattern[1].type                 = RTE_FLOW_ITEM_TYPE_IPV4;
+    pattern[1].spec                 = &ip_spec;
+    pattern[1].mask                 = &ip_mask;
+    pattern[2].type                 = RTE_FLOW_ITEM_TYPE_UDP;
+    pattern[2].spec                 = &udp_spec;
+    pattern[2].mask                 = &udp_mask;
+    pattern[3].type                 = RTE_FLOW_ITEM_TYPE_END;
+
+    struct rte_flow_action_queue queue_action = {};
+    queue_action.index                        = queue_id;
+    struct rte_flow_action actions[2]         = {};
+    actions[0].type                           = RTE_FLOW_ACTION_TYPE_QUEUE;
+    actions[0].conf                           = &queue_action;
+    actions[1].type                           = RTE_FLOW_ACTION_TYPE_END;
+
+    struct rte_flow_error error = {};
+    if (rte_flow_validate(_port, &attr, pattern, actions, &error)) {
+        UHD_LOGGER_DEBUG("DPDK")
+            << boost::format("Port %d: NIC rejected flow rule for UDP port %d (%s), "
+                             "keeping flow on shared queue 0")
+                   % _port % rte_be_to_cpu_16(udp_dst_port)
+                   % (error.message ? error.message : "unknown error");
+        return 0;
+    }
+    struct rte_flow* flow = rte_flow_create(_port, &attr, pattern, actions, &error);
+    if (!flow) {
+        UHD_LOGGER_WARNING("DPDK")
+            << boost::format("Port %d: Failed to create flow rule for UDP port %d (%s)")
+                   % _port % rte_be_to_cpu_16(udp_dst_port)
+                   % (error.message ? error.message : "unknown error");
+        return 0;
+    }
+    _free_rx_queues.pop_back();
+    _rx_flows[queue_id] = flow;
+    UHD_LOGGER_TRACE("DPDK")
+        << boost::format("Port %d: Steering UDP port %d to dedicated RX queue %d") % _port
+               % rte_be_to_cpu_16(udp_dst_port) % queue_id;
+    return queue_id;
+}
+
+void dpdk_port::free_rx_flow(queue_id_t queue_id)
+{
+    if (queue_id == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto flow_it = _rx_flows.find(queue_id);
+    if (flow_it == _rx_flows.end()) {
+        return;
+    }
+    struct rte_flow_error error = {};
+    if (rte_flow_destroy(_port, flow_it->second, &error)) {
+        UHD_LOGGER_WARNING("DPDK")
+            << boost::format("Port %d: Failed to destroy flow rule for RX queue %d (%s)")
+                   % _port % queue_id % (error.message ? error.message : "unknown error");
+    }
+    _rx_flows.erase(flow_it);
+    _free_rx_queues.push_back(queue_id);
+}
+
 int dpdk_port::_arp_reply(queue_id_t queue_id, struct rte_arp_hdr* arp_req)
 {
     struct rte_mbuf* mbuf;
@@ -457,11 +565,25 @@ void dpdk_ctx::init(const device_addr_t& user_args)
         _mtu = dpdk_args.cast<size_t>("dpdk_mtu", DEFAULT_FRAME_SIZE);
         /* This is per queue */
         _num_mbufs = dpdk_args.cast<int>("dpdk_num_mbufs", DEFAULT_NUM_MBUFS);
-        _mbuf_cache_size =
-            dpdk_args.cast<int>("dpdk_mbuf_cache_size", DEFAULT_MBUF_CACHE_SIZE);
+        if (_num_mbufs <= 0) {
+            throw uhd::value_error("DPDK: dpdk_num_mbufs must be positive");
+        }
+        /* A cache size of 0 requests auto-sizing from the pool size when the
+         * pool is created */
+        _mbuf_cache_size = dpdk_args.cast<int>("dpdk_mbuf_cache_size", 0);
+        if (_mbuf_cache_size < 0) {
+            throw uhd::value_error("DPDK: dpdk_mbuf_cache_size must not be negative");
+        }
+        if (_mbuf_cache_size > RTE_MEMPOOL_CACHE_MAX_SIZE) {
+            UHD_LOG_WARNING("DPDK",
+                "dpdk_mbuf_cache_size "
+                    << _mbuf_cache_size << " exceeds the maximum of "
+                    << RTE_MEMPOOL_CACHE_MAX_SIZE << " and will be clamped");
+            _mbuf_cache_size = RTE_MEMPOOL_CACHE_MAX_SIZE;
+        }
         UHD_LOG_TRACE("DPDK",
-            "mtu: " << _mtu << " num_mbufs: " << _num_mbufs
-                    << " mbuf_cache_size: " << _mbuf_cache_size);
+            "mtu: " << _mtu << " num_mbufs: " << _num_mbufs << " mbuf_cache_size: "
+                    << (_mbuf_cache_size ? std::to_string(_mbuf_cache_size) : "auto"));
 
         _link_init_timeout =
             dpdk_args.cast<int>("dpdk_link_timeout", DEFAULT_DPDK_LINK_INIT_TIMEOUT);
@@ -496,8 +618,6 @@ void dpdk_ctx::init(const device_addr_t& user_args)
             }
             /* Now combine user args with conf file */
             auto conf = uhd::prefs::get_dpdk_nic_args(nic);
-            // TODO: Enable the use of multiple DMA queues
-            conf["dpdk_num_queues"] = "1";
 
             /* Update config, and remove ports that aren't fully configured */
             if (conf.has_key("dpdk_ipv4")) {
@@ -526,6 +646,18 @@ void dpdk_ctx::init(const device_addr_t& user_args)
                 // - This is a bit inefficient for larger systems, since NICs may not
                 //   all be on one socket
                 int cpu_socket = rte_eth_dev_socket_id(i);
+                if (conf.has_key("dpdk_socket_id")) {
+                    /* Per-port override of the detected NUMA node */
+                    const int user_socket = conf.cast<int>("dpdk_socket_id", cpu_socket);
+                    if (user_socket != SOCKET_ID_ANY
+                        && user_socket >= static_cast<int>(rte_socket_count())) {
+                        UHD_LOG_WARNING("DPDK",
+                            "NIC(" << i << "): Ignoring invalid dpdk_socket_id "
+                                   << user_socket);
+                    } else {
+                        cpu_socket = user_socket;
+                    }
+                }
                 unsigned int pool_index;
                 if (cpu_socket == SOCKET_ID_ANY) {
                     UHD_LOG_TRACE("DPDK",
@@ -539,8 +671,10 @@ void dpdk_ctx::init(const device_addr_t& user_args)
                 UHD_LOG_TRACE("DPDK",
                     "Creating packet buffers for NIC("
                         << i << ") with pool_index=" << pool_index);
-                auto rx_pool = _get_rx_pktbuf_pool(pool_index, _num_mbufs * queue_count);
-                auto tx_pool = _get_tx_pktbuf_pool(pool_index, _num_mbufs * queue_count);
+                auto rx_pool = _get_rx_pktbuf_pool(
+                    pool_index, _num_mbufs * queue_count, cpu_socket);
+                auto tx_pool = _get_tx_pktbuf_pool(
+                    pool_index, _num_mbufs * queue_count, cpu_socket);
                 UHD_LOG_DEBUG("DPDK",
                     "Initializing NIC(" << i << "):" << std::endl
                                         << conf.to_pp_string());
@@ -687,23 +821,38 @@ uhd::transport::dpdk_io_service::sptr dpdk_ctx::get_io_service(const size_t port
     throw uhd::lookup_error(err_msg);
 }
 
+int dpdk_ctx::_resolve_mbuf_cache_size(size_t num_bufs) const
+{
+    int cache_size = _mbuf_cache_size ? _mbuf_cache_size : compute_mbuf_cache_size(num_bufs);
+    if (cache_size && num_bufs % cache_size != 0) {
+        UHD_LOG_WARNING("DPDK",
+            "dpdk_mbuf_cache_size " << cache_size << " does not divide the pool size "
+                                    << num_bufs
+                                    << " evenly; expect reduced mempool performance");
+    }
+    return cache_size;
+}
+
 struct rte_mempool* dpdk_ctx::_get_rx_pktbuf_pool(
-    unsigned int pool_index, size_t num_bufs)
+    unsigned int pool_index, size_t num_bufs, int socket_id)
 {
     if (!_rx_pktbuf_pools.at(pool_index)) {
         const int mbuf_size =
             _mtu + RTE_PKTMBUF_HEADROOM + RTE_ETHER_HDR_LEN + RTE_ETHER_CRC_LEN;
+        const int cache_size = _resolve_mbuf_cache_size(num_bufs);
         char name[32];
         snprintf(name, sizeof(name), "rx_mbuf_pool_%u", pool_index);
-        UHD_LOG_TRACE("DPDK",
-            str(boost::format("Creating %s with %d x %d bytes") % name % num_bufs
-                % mbuf_size));
+        UHD_LOG_DEBUG("DPDK",
+            str(boost::format("Creating %s: %d x %d bytes (%d KiB), per-lcore cache %d "
+                              "mbufs, socket %d")
+                % name % num_bufs % mbuf_size % (num_bufs * mbuf_size / 1024)
+                % cache_size % socket_id));
         _rx_pktbuf_pools[pool_index] = rte_pktmbuf_pool_create(name,
             num_bufs,
-            _mbuf_cache_size,
+            cache_size,
             DPDK_MBUF_PRIV_SIZE,
             mbuf_size,
-            SOCKET_ID_ANY);
+            socket_id);
         if (!_rx_pktbuf_pools.at(pool_index)) {
             UHD_LOG_ERROR("DPDK", "Could not allocate RX pktbuf pool");
             throw uhd::runtime_error("DPDK: Could not allocate RX pktbuf pool");
@@ -713,17 +862,20 @@ struct rte_mempool* dpdk_ctx::_get_rx_pktbuf_pool(
 }
 
 struct rte_mempool* dpdk_ctx::_get_tx_pktbuf_pool(
-    unsigned int pool_index, size_t num_bufs)
+    unsigned int pool_index, size_t num_bufs, int socket_id)
 {
     if (!_tx_pktbuf_pools.at(pool_index)) {
-        const int mbuf_size = _mtu + RTE_PKTMBUF_HEADROOM;
+        const int mbuf_size  = _mtu + RTE_PKTMBUF_HEADROOM;
+        const int cache_size = _resolve_mbuf_cache_size(num_bufs);
         char name[32];
         snprintf(name, sizeof(name), "tx_mbuf_pool_%u", pool_index);
-        UHD_LOG_TRACE("DPDK",
-            str(boost::format("Creating %s with %d x %d bytes") % name % num_bufs
-                % mbuf_size));
+        UHD_LOG_DEBUG("DPDK",
+            str(boost::format("Creating %s: %d x %d bytes (%d KiB), per-lcore cache %d "
+                              "mbufs, socket %d")
+                % name % num_bufs % mbuf_size % (num_bufs * mbuf_size / 1024)
+                % cache_size % socket_id));
         _tx_pktbuf_pools[pool_index] = rte_pktmbuf_pool_create(
-            name, num_bufs, _mbuf_cache_size, 0, mbuf_size, SOCKET_ID_ANY);
+            name, num_bufs, cache_size, 0, mbuf_size, socket_id);
         if (!_tx_pktbuf_pools.at(pool_index)) {
             UHD_LOG_ERROR("DPDK", "Could not allocate TX pktbuf pool");
             throw uhd::runtime_error("DPDK: Could not allocate TX pktbuf pool");
@@ -10,6 +10,7 @@
 #include <uhdlib/transport/dpdk/udp.hpp>
 #include <uhdlib/transport/dpdk_io_service_client.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/thread_policy.hpp>
 #include <cmath>
 
 /*
@@ -275,7 +276,10 @@ int dpdk_io_service::_io_worker(void* arg)
     UHD_LOG_TRACE("DPDK::IO_SERVICE",
         "I/O service thread '" << name << "' started on lcore " << lcore_id);
 
+    // Default to realtime scheduling; a [threads] dpdk_* policy in uhd.conf
+    // overrides it (affinity stays with the EAL's lcore pinning)
     uhd::set_thread_priority_safe();
+    uhd::apply_thread_policy("dpdk");
 
     snprintf(name, sizeof(name), "rx-tbl_%hu", (uint16_t)lcore_id);
     struct rte_hash_parameters hash_params = {.name = name,
@@ -293,9 +297,18 @@ int dpdk_io_service::_io_worker(void* arg)
 
     int status = 0;
     while (!status) {
-        /* For each port, attempt to receive packets and process */
+        /* For each port's RX queues, attempt to receive packets and process.
+         * Queues polled directly by a run-to-completion client are skipped.
+         */
         for (auto port : srv->_ports) {
-            srv->_rx_burst(port, 0);
+            const auto num_queues =
+                uhd::narrow_cast<dpdk::queue_id_t>(port->get_queue_count());
+            const auto& direct_queues = srv->_direct_rx_queues[port->get_port_id()];
+            for (dpdk::queue_id_t queue = 0; queue < num_queues; queue++) {
+                if (!direct_queues.count(queue)) {
+                    srv->_rx_burst(port, queue);
+                }
+            }
         }
         /* For each port's TX queues, do TX */
         for (auto port : srv->_ports) {
@@ -414,6 +427,23 @@ void dpdk_io_service::_service_flow_open(dpdk::wait_req* req)
                 ;
             return;
         }
+        // Steer this flow to a dedicated RX queue, if the port has one to
+        // spare. Packets land on the shared queue 0 otherwise, which is
+        // also where they go if the NIC rejects the flow rule.
+        auto port = flow_req_data->link->get_port();
+        if (port->get_queue_count() > 1) {
+            const auto queue_id =
+                port->alloc_rx_flow(flow_req_data->link->get_local_port());
+            if (queue_id != 0) {
+                _rx_flow_queues[flow_req_data->link] = queue_id;
+                flow_req_data->link->set_queue_id(queue_id);
+                if (flow_req_data->link->get_rx_run_to_completion()) {
+                    // The receiving client polls this queue directly, so
+                    // this worker must stay off of it
+                    _direct_rx_queues[port->get_port_id()].insert(queue_id);
+                }
+            }
+        }
     }
     while (_servq.complete(req) == -ENOBUFS)
         ;
@@ -436,6 +466,16 @@ void dpdk_io_service::_service_flow_close(dpdk::wait_req* req)
             UHD_ASSERT_THROW(xport_list->empty());
             delete xport_list;
             rte_hash_del_key(_rx_table, &ht_key);
+            // Tear down the flow rule and return the dedicated RX queue to
+            // the port's pool, if this flow had one
+            auto flow_it = _rx_flow_queues.find(flow_req_data->link);
+            if (flow_it != _rx_flow_queues.end()) {
+                auto port = flow_req_data->link->get_port();
+                _direct_rx_queues[port->get_port_id()].erase(flow_it->second);
+                port->free_rx_flow(flow_it->second);
+                flow_req_data->link->set_queue_id(0);
+                _rx_flow_queues.erase(flow_it);
+            }
             while (_servq.complete(req) == -ENOBUFS)
                 ;
             return;
@@ -835,6 +875,10 @@ int dpdk_io_service::_tx_burst(dpdk::dpdk_port* port)
         unsigned int num_tx   = rte_ring_count(send_io->_send_queue);
         num_tx                = (num_tx < TX_BURST_SIZE) ? num_tx : TX_BURST_SIZE;
         bool replaced_buffers = false;
+        // Coalesce this queue's ready packets into a single rte_eth_tx_burst
+        // call; the batch size adapts to however many frames the client has
+        // queued up, capped at TX_BURST_SIZE
+        send_io->_dpdk_io_if.link->tx_batch_begin();
         for (unsigned int i = 0; i < num_tx; i++) {
             size_t frame_size = send_io->_dpdk_io_if.link->get_send_frame_size();
             if (send_io->_fc_cb && !send_io->_fc_cb(frame_size)) {
@@ -861,6 +905,7 @@ int dpdk_io_service::_tx_burst(dpdk::dpdk_port* port)
                 replaced_buffers = true;
             }
         }
+        send_io->_dpdk_io_if.link->tx_batch_flush();
         if (replaced_buffers) {
             _wake_client(&send_io->_dpdk_io_if);
         }
@@ -0,0 +1,111 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/transport/bounded_buffer.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/tasks.hpp>
+#include <uhdlib/transport/zero_copy_recv_offload.hpp>
+#include <functional>
+
+using namespace uhd;
+using namespace uhd::transport;
+
+/***********************************************************************
+ * Zero copy offload transport:
+ * An intermediate transport that utilizes threading to free up the
+ * main thread.
+ **********************************************************************/
+class zero_copy_recv_offload_impl : public zero_copy_recv_offload
+{
+public:
+    typedef std::shared_ptr<zero_copy_recv_offload_impl> sptr;
+
+    zero_copy_recv_offload_impl(zero_copy_if::sptr transport, const double timeout)
+        : _transport(transport)
+        , _timeout(timeout)
+        // The queue is never full in practice: every entry holds one of the
+        // underlying transport's frames, so the producer runs dry before
+        // the queue runs out of room
+        , _inbox(transport->get_num_recv_frames())
+    {
+        UHD_LOGGER_TRACE("XPORT") << "Created receive offload transport";
+
+        // Create a receive task
+        _recv_task =
+            task::make(std::bind(&zero_copy_recv_offload_impl::enqueue_recv, this));
+    }
+
+    ~zero_copy_recv_offload_impl() override
+    {
+        // Ensure the offload thread is gone before the transport it polls
+        _recv_task.reset();
+    }
+
+    /*******************************************************************
+     * Receive implementation:
+     * Pop a buffer received by the offload thread.
+     ******************************************************************/
+    managed_recv_buffer::sptr get_recv_buff(double timeout) override
+    {
+        managed_recv_buffer::sptr buff;
+        _inbox.pop_with_timed_wait(buff, timeout);
+        return buff;
+    }
+
+    size_t get_num_recv_frames() const override
+    {
+        return _transport->get_num_recv_frames();
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _transport->get_recv_frame_size();
+    }
+
+    /*******************************************************************
+     * Send implementation:
+     * Pass the call straight through to the underlying transport.
+     ******************************************************************/
+    managed_send_buffer::sptr get_send_buff(double timeout) override
+    {
+        return _transport->get_send_buff(timeout);
+    }
+
+    size_t get_num_send_frames() const override
+    {
+        return _transport->get_num_send_frames();
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _transport->get_send_frame_size();
+    }
+
+private:
+    //! Body of the offload thread, run repeatedly by the task
+    void enqueue_recv()
+    {
+        managed_recv_buffer::sptr buff = _transport->get_recv_buff(_timeout);
+        if (buff) {
+            _inbox.push_with_wait(buff);
+        }
+    }
+
+    // The underlying transport
+    zero_copy_if::sptr _transport;
+    const double _timeout;
+
+    // Completed receive buffers, in arrival order
+    bounded_buffer<managed_recv_buffer::sptr> _inbox;
+
+    task::sptr _recv_task;
+};
+
+zero_copy_recv_offload::sptr zero_copy_recv_offload::make(
+    zero_copy_if::sptr transport, const double timeout)
+{
+    return std::make_shared<zero_copy_recv_offload_impl>(transport, timeout);
+}
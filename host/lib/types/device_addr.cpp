@@ -9,37 +9,60 @@
 #include <uhd/types/device_addr.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
-#include <boost/tokenizer.hpp>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 
 using namespace uhd;
 
-static const char* arg_delim  = ",";
-static const char* pair_delim = "=";
+static const char arg_delim  = ',';
+static const char pair_delim = '=';
 
-static std::string trim(const std::string& in)
+static std::string_view trim(std::string_view in)
 {
-    return boost::algorithm::trim_copy(in);
+    const size_t begin = in.find_first_not_of(" \t\n\v\f\r");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const size_t end = in.find_last_not_of(" \t\n\v\f\r");
+    return in.substr(begin, end - begin + 1);
 }
 
-#define tokenizer(inp, sep) \
-    boost::tokenizer<boost::char_separator<char>>(inp, boost::char_separator<char>(sep))
+//! Chop the next delim-separated token off the front of a view. Empty tokens
+// (consecutive delimiters) are skipped, matching the old boost::tokenizer
+// behaviour. Returns false when the input is exhausted.
+static bool next_token(std::string_view& in, const char delim, std::string_view& token)
+{
+    while (not in.empty()) {
+        const size_t end = in.find(delim);
+        token            = in.substr(0, end);
+        in.remove_prefix(end == std::string_view::npos ? in.size() : end + 1);
+        if (not token.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
 
 device_addr_t::device_addr_t(const std::string& args)
 {
-    for (const std::string& pair : tokenizer(args, arg_delim)) {
+    // Tokenize with views into the args string; only the final trimmed key
+    // and value of each pair are materialized as strings
+    std::string_view remaining(args);
+    std::string_view pair;
+    while (next_token(remaining, arg_delim, pair)) {
         if (trim(pair).empty())
             continue;
-        std::vector<std::string> toks;
-        for (const std::string& tok : tokenizer(pair, pair_delim)) {
-            toks.push_back(tok);
+        std::string_view toks[3];
+        size_t num_toks = 0;
+        while (num_toks < 3 and next_token(pair, pair_delim, toks[num_toks])) {
+            num_toks++;
         }
-        if (toks.size() == 1)
-            toks.push_back(""); // pad empty value
-        if (toks.size() == 2 and not trim(toks[0]).empty()) { // only valid combination
-            this->set(trim(toks[0]), trim(toks[1]));
+        if (num_toks == 1)
+            toks[num_toks++] = {}; // pad empty value
+        if (num_toks == 2 and not trim(toks[0]).empty()) { // only valid combination
+            this->set(std::string(trim(toks[0])), std::string(trim(toks[1])));
         } else
             throw uhd::value_error("invalid args string: " + args); // otherwise error
     }
@@ -75,7 +98,9 @@ std::string device_addr_t::to_string(void) const
     std::string args_str;
     size_t count = 0;
     for (const std::string& key : this->keys()) {
-        args_str += ((count++) ? arg_delim : "") + key + pair_delim + this->get(key);
+        if (count++)
+            args_str += arg_delim;
+        args_str += key + pair_delim + this->get(key);
     }
     return args_str;
 }
@@ -98,6 +98,8 @@ void export_metadata(py::module& m)
         .def_readonly("has_time_spec", &async_metadata_t::has_time_spec)
         .def_readonly("time_spec", &async_metadata_t::time_spec)
         .def_readonly("event_code", &async_metadata_t::event_code)
+        .def_readonly("event_count", &async_metadata_t::event_count)
+        .def_readonly("last_time_spec", &async_metadata_t::last_time_spec)
         // TODO: Expose user payloads
         //.def_readonly("user_payload" , &async_metadata_t::user_payload )
         ;
@@ -126,24 +126,41 @@ meta_range_t meta_range_t::as_monotonic() const
     return *this;
 }
 
-double meta_range_t::start(void) const
+const meta_range_t::range_index_t& meta_range_t::_get_index(void) const
 {
+    if (_index.keyed_data == this->data() and _index.keyed_size == this->size()
+        and not this->empty() and _index.keyed_front == this->front()
+        and _index.keyed_back == this->back()) {
+        return _index;
+    }
+
+    // (Re-)build: this also performs the monotonicity check once, which
+    // guarantees the sub-range starts are sorted for the binary search
     check_meta_range_monotonic(*this);
-    double min_start = this->front().start();
+    _index.starts.clear();
+    _index.starts.reserve(this->size());
     for (const range_t& r : (*this)) {
-        min_start = std::min(min_start, r.start());
+        _index.starts.push_back(r.start());
     }
-    return min_start;
+    _index.keyed_data  = this->data();
+    _index.keyed_size  = this->size();
+    _index.keyed_front = this->front();
+    _index.keyed_back  = this->back();
+    return _index;
+}
+
+double meta_range_t::start(void) const
+{
+    // Monotonicity (checked on index build) implies the first sub-range
+    // holds the minimum
+    _get_index();
+    return this->front().start();
 }
 
 double meta_range_t::stop(void) const
 {
-    check_meta_range_monotonic(*this);
-    double max_stop = this->front().stop();
-    for (const range_t& r : (*this)) {
-        max_stop = std::max(max_stop, r.stop());
-    }
-    return max_stop;
+    _get_index();
+    return this->back().stop();
 }
 
 double meta_range_t::step(void) const
@@ -169,25 +186,34 @@ double meta_range_t::step(void) const
 
 double meta_range_t::clip(double value, bool clip_step) const
 {
-    check_meta_range_monotonic(*this);
-    double last_stop = this->front().stop();
-    for (const range_t& r : (*this)) {
-        // in-between ranges, clip to nearest
-        if (value < r.start()) {
-            return (std::abs(value - r.start()) < std::abs(value - last_stop))
-                       ? r.start()
-                       : last_stop;
-        }
-        // in this range, clip here
-        if (value <= r.stop()) {
-            if (not clip_step or r.step() == 0)
-                return value;
-            return std::round((value - r.start()) / r.step()) * r.step() + r.start();
-        }
-        // continue on to the next range
-        last_stop = r.stop();
+    const range_index_t& index = _get_index();
+
+    // find the first sub-range whose start is above the value; the value
+    // can then only lie in or just after the sub-range before it
+    const size_t next =
+        std::upper_bound(index.starts.begin(), index.starts.end(), value)
+        - index.starts.begin();
+
+    // below all ranges, clip to the lowest start
+    if (next == 0) {
+        return this->front().start();
+    }
+
+    const range_t& r = (*this)[next - 1];
+
+    // in this range, clip here
+    if (value <= r.stop()) {
+        if (not clip_step or r.step() == 0)
+            return value;
+        return std::round((value - r.start()) / r.step()) * r.step() + r.start();
+    }
+
+    // in-between ranges, clip to nearest
+    if (next < this->size()
+        and std::abs(value - index.starts[next]) < std::abs(value - r.stop())) {
+        return index.starts[next];
     }
-    return last_stop;
+    return r.stop();
 }
 
 std::string meta_range_t::to_pp_string(void) const
@@ -57,6 +57,53 @@ time_spec_t time_spec_t::from_ticks(long long ticks, double tick_rate)
     return time_spec_t(secs_full, ticks_frac / tick_rate);
 }
 
+void time_spec_t::from_ticks(
+    const long long* ticks, size_t count, double tick_rate, time_spec_t* out)
+{
+    const long long rate_i = (long long)(tick_rate);
+    const double rate_f    = tick_rate - rate_i;
+    if (rate_f == 0.0) {
+        // Integer tick rate: the error term vanishes and the remaining
+        // integer-only splitting has no cross-iteration dependency, so the
+        // compiler is free to vectorize this loop
+        for (size_t i = 0; i < count; i++) {
+            const int64_t secs_full     = int64_t(ticks[i] / rate_i);
+            const long long ticks_error = ticks[i] - (secs_full * rate_i);
+            out[i] = time_spec_t(secs_full, ticks_error / tick_rate);
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = from_ticks(ticks[i], tick_rate);
+    }
+}
+
+void time_spec_t::ticks_to_secs(
+    const long long* ticks, size_t count, double tick_rate, double* out)
+{
+    const long long rate_i = (long long)(tick_rate);
+    const double rate_f    = tick_rate - rate_i;
+    if (rate_f == 0.0) {
+        for (size_t i = 0; i < count; i++) {
+            int64_t secs_full           = int64_t(ticks[i] / rate_i);
+            const long long ticks_error = ticks[i] - (secs_full * rate_i);
+            double frac_secs            = ticks_error / tick_rate;
+            // Same normalization as time_spec_init, so the sum is
+            // bit-identical to from_ticks(...).get_real_secs() for negative
+            // tick values as well
+            if (frac_secs < 0) {
+                secs_full -= 1;
+                frac_secs += 1;
+            }
+            out[i] = secs_full + frac_secs;
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = from_ticks(ticks[i], tick_rate).get_real_secs();
+    }
+}
+
 /***********************************************************************
  * Time spec accessors
  **********************************************************************/
@@ -75,6 +122,24 @@ long long time_spec_t::to_ticks(double tick_rate) const
     return ticks_full + fast_llround(ticks_error + ticks_frac);
 }
 
+void time_spec_t::to_ticks(
+    const time_spec_t* times, size_t count, double tick_rate, long long* out)
+{
+    const long long rate_i = (long long)(tick_rate);
+    const double rate_f    = tick_rate - rate_i;
+    if (rate_f == 0.0) {
+        // Integer tick rate: no error term to accumulate, vectorizable
+        for (size_t i = 0; i < count; i++) {
+            out[i] = times[i].get_full_secs() * rate_i
+                     + fast_llround(times[i].get_frac_secs() * tick_rate);
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = times[i].to_ticks(tick_rate);
+    }
+}
+
 double time_spec_t::get_real_secs(void) const
 {
     return this->get_full_secs() + this->get_frac_secs();
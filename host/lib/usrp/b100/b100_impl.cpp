@@ -14,6 +14,7 @@
 #include <uhd/utils/paths.hpp>
 #include <uhd/utils/safe_call.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/transport/zero_copy_recv_offload.hpp>
 #include <uhdlib/usrp/common/apply_corrections.hpp>
 #include <boost/format.hpp>
 #include <chrono>
@@ -265,14 +266,20 @@ b100_impl_constructor_begin:
         size_t(data_xport_args.cast<double>("recv_frame_size", 0.0));
     _fifo_ctrl->poke32(TOREG(SR_PADDER + 0), rx_lut_size / sizeof(uint32_t));
 
-    _data_transport = usb_zero_copy_make_wrapper(usb_zero_copy::make(handle, // identifier
-                                                     2,
-                                                     6, // IN interface, endpoint
-                                                     1,
-                                                     2, // OUT interface, endpoint
-                                                     data_xport_args // param hints
-                                                     ),
-        B100_MAX_PKT_BYTE_LIMIT);
+    zero_copy_if::sptr usb_xport = usb_zero_copy::make(handle, // identifier
+        2,
+        6, // IN interface, endpoint
+        1,
+        2, // OUT interface, endpoint
+        data_xport_args // param hints
+    );
+    // The offload thread resubmits USB transfers as soon as they complete,
+    // so a late caller doesn't stall the small USB 2.0 buffer window and
+    // drop samples. Disable with recv_offload=0.
+    if (device_addr.cast<bool>("recv_offload", true)) {
+        usb_xport = zero_copy_recv_offload::make(usb_xport, 0.1);
+    }
+    _data_transport = usb_zero_copy_make_wrapper(usb_xport, B100_MAX_PKT_BYTE_LIMIT);
 
     ////////////////////////////////////////////////////////////////////
     // Initialize the properties tree
@@ -19,6 +19,7 @@
 #include <uhd/utils/paths.hpp>
 #include <uhd/utils/safe_call.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/eeprom_cache.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/functional/hash.hpp>
@@ -390,7 +391,20 @@ b200_impl::b200_impl(
     ////////////////////////////////////////////////////////////////////
     // setup the mboard eeprom
     ////////////////////////////////////////////////////////////////////
-    const mboard_eeprom_t mb_eeprom = get_mb_eeprom(_iface);
+    // With eeprom_cache=1 in the device args, the EEPROM contents are kept in
+    // a host-side cache keyed by the USB serial, so warm restarts skip the
+    // slow serial bus read. Writing to the EEPROM drops the cache entry (see
+    // set_mb_eeprom()).
+    _eeprom_cache_label = "b2xx_" + handle->get_serial();
+    const bool use_eeprom_cache = device_addr.cast<bool>("eeprom_cache", false);
+    mboard_eeprom_t mb_eeprom;
+    if (not use_eeprom_cache
+        or not uhd::eeprom_cache::load(_eeprom_cache_label, mb_eeprom)) {
+        mb_eeprom = get_mb_eeprom(_iface);
+        if (use_eeprom_cache) {
+            uhd::eeprom_cache::store(_eeprom_cache_label, mb_eeprom);
+        }
+    }
     _tree->create<mboard_eeprom_t>(mb_path / "eeprom")
         .set(mb_eeprom)
         .add_coerced_subscriber(
@@ -555,8 +569,38 @@ b200_impl::b200_impl(
     ////////////////////////////////////////////////////////////////////
     device_addr_t data_xport_args;
     const int max_transfer = usb_speed == 3 ? 1024 : 512;
+
+    // The usb_auto_params arg picks transfer sizings to match the host
+    // controller generation: USB 3.0 (xHCI) hosts sustain full rate with
+    // larger transfers and deeper queues than the conservative defaults,
+    // which were chosen for USB 2.0. Explicitly given frame args always win.
+    // Note: An in-band throughput probe is not possible this early in
+    // initialization (the radio is not streaming yet), so this applies
+    // sizings known to be sustainable per controller generation.
+    device_addr_t xport_hints = device_addr;
+    if (device_addr.has_key("usb_auto_params")) {
+        const int auto_frame_size =
+            usb_speed == 3 ? B200_USB3_DATA_FRAME_SIZE : B200_USB2_DATA_FRAME_SIZE;
+        const int auto_num_frames =
+            usb_speed == 3 ? B200_USB3_DATA_NUM_FRAMES : B200_USB2_DATA_NUM_FRAMES;
+        for (const std::string& key : {"recv_frame_size", "send_frame_size"}) {
+            if (not xport_hints.has_key(key)) {
+                xport_hints[key] = std::to_string(auto_frame_size);
+            }
+        }
+        for (const std::string& key : {"num_recv_frames", "num_send_frames"}) {
+            if (not xport_hints.has_key(key)) {
+                xport_hints[key] = std::to_string(auto_num_frames);
+            }
+        }
+        UHD_LOGGER_DEBUG("B200")
+            << "usb_auto_params: using frame size " << auto_frame_size << " and "
+            << auto_num_frames << " frames per endpoint (USB "
+            << (usb_speed == 3 ? "3.0" : "2.0") << ")";
+    }
+
     int recv_frame_size =
-        device_addr.cast<int>("recv_frame_size", B200_USB_DATA_DEFAULT_FRAME_SIZE);
+        xport_hints.cast<int>("recv_frame_size", B200_USB_DATA_DEFAULT_FRAME_SIZE);
     // Check that recv_frame_size limits.
     if (recv_frame_size < B200_USB_DATA_MIN_RECV_FRAME_SIZE) {
         UHD_LOGGER_WARNING("B200") << "Requested recv_frame_size of " << recv_frame_size
@@ -585,14 +629,42 @@ b200_impl::b200_impl(
         UHD_LOGGER_WARNING("B200")
             << "The recv_frame_size must be a multiple of 8 bytes and not a multiple of "
             << max_transfer << " bytes.  Requested recv_frame_size of "
-            << device_addr["recv_frame_size"] << " coerced to " << recv_frame_size << ".";
+            << xport_hints["recv_frame_size"] << " coerced to " << recv_frame_size << ".";
     }
 
+    int send_frame_size =
+        xport_hints.cast<int>("send_frame_size", B200_USB_DATA_DEFAULT_FRAME_SIZE);
+    if (send_frame_size < B200_USB_DATA_MIN_SEND_FRAME_SIZE) {
+        UHD_LOGGER_WARNING("B200") << "Requested send_frame_size of " << send_frame_size
+                                   << " is too small. It will be set to "
+                                   << B200_USB_DATA_MIN_SEND_FRAME_SIZE << ".";
+        send_frame_size = B200_USB_DATA_MIN_SEND_FRAME_SIZE;
+    } else if (send_frame_size > B200_USB_DATA_MAX_SEND_FRAME_SIZE) {
+        UHD_LOGGER_WARNING("B200") << "Requested send_frame_size of " << send_frame_size
+                                   << " is too large. It will be set to "
+                                   << B200_USB_DATA_MAX_SEND_FRAME_SIZE << ".";
+        send_frame_size = B200_USB_DATA_MAX_SEND_FRAME_SIZE;
+    }
+
+    auto coerce_num_frames = [](const std::string& key, int num_frames) {
+        if (num_frames < B200_USB_DATA_MIN_NUM_FRAMES) {
+            UHD_LOGGER_WARNING("B200")
+                << "Requested " << key << " of " << num_frames
+                << " is too small. It will be set to " << B200_USB_DATA_MIN_NUM_FRAMES
+                << ".";
+            num_frames = B200_USB_DATA_MIN_NUM_FRAMES;
+        }
+        return num_frames;
+    };
+    const int num_recv_frames =
+        coerce_num_frames("num_recv_frames", xport_hints.cast<int>("num_recv_frames", 16));
+    const int num_send_frames =
+        coerce_num_frames("num_send_frames", xport_hints.cast<int>("num_send_frames", 16));
+
     data_xport_args["recv_frame_size"] = std::to_string(recv_frame_size);
-    data_xport_args["num_recv_frames"] = device_addr.get("num_recv_frames", "16");
-    data_xport_args["send_frame_size"] = device_addr.get(
-        "send_frame_size", std::to_string(B200_USB_DATA_DEFAULT_FRAME_SIZE));
-    data_xport_args["num_send_frames"] = device_addr.get("num_send_frames", "16");
+    data_xport_args["num_recv_frames"] = std::to_string(num_recv_frames);
+    data_xport_args["send_frame_size"] = std::to_string(send_frame_size);
+    data_xport_args["num_send_frames"] = std::to_string(num_send_frames);
 
     // This may throw a uhd::usb_error, which will be caught by b200_make().
     _data_transport = usb_zero_copy::make(handle, // identifier
@@ -88,6 +88,17 @@ static const int B200_USB_DATA_DEFAULT_FRAME_SIZE = 8176;
 // recv_frame_size values below this will be upped to this value
 static const int B200_USB_DATA_MIN_RECV_FRAME_SIZE = 40;
 static const int B200_USB_DATA_MAX_RECV_FRAME_SIZE = 16360;
+// send_frame_size limits (same endpoint buffer sizing as the recv side)
+static const int B200_USB_DATA_MIN_SEND_FRAME_SIZE = 40;
+static const int B200_USB_DATA_MAX_SEND_FRAME_SIZE = 16360;
+// Fewer frames than this cannot keep the bulk endpoint busy
+static const int B200_USB_DATA_MIN_NUM_FRAMES = 2;
+// Sizings applied by the usb_auto_params device arg: deep queues and large
+// transfers for USB 3.0 (xHCI) hosts, conservative values for USB 2.0
+static const int B200_USB3_DATA_FRAME_SIZE = 16360;
+static const int B200_USB3_DATA_NUM_FRAMES = 32;
+static const int B200_USB2_DATA_FRAME_SIZE = 8176;
+static const int B200_USB2_DATA_NUM_FRAMES = 16;
 
 /*
  * VID/PID pairs for all B2xx products
@@ -175,6 +186,8 @@ private:
         uhd::transport::zero_copy_if::sptr, std::shared_ptr<AsyncTaskData>);
 
     void register_loopback_self_test(uhd::wb_iface::sptr iface);
+    //! Label for the host-side EEPROM cache; derived from the USB serial
+    std::string _eeprom_cache_label;
     void set_mb_eeprom(const uhd::usrp::mboard_eeprom_t&);
     void check_fw_compat(void);
     void check_fpga_compat(void);
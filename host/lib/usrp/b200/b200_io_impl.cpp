@@ -441,8 +441,9 @@ rx_streamer::sptr b200_impl::get_rx_stream(const uhd::stream_args_t& args_)
             my_streamer = std::make_shared<sph::recv_packet_streamer>(spp);
         my_streamer->resize(args.channels.size());
 
-        // init some streamer stuff
-        my_streamer->set_vrt_unpacker(&b200_if_hdr_unpack_le);
+        // init some streamer stuff; the built-in CHDR parse avoids an
+        // indirect call per packet
+        my_streamer->set_chdr_unpacker();
 
         // set the converter
         uhd::convert::id_type id;
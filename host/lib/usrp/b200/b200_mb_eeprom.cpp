@@ -6,6 +6,7 @@
 
 #include "b200_impl.hpp"
 #include <uhd/usrp/mboard_eeprom.hpp>
+#include <uhdlib/utils/eeprom_cache.hpp>
 #include <uhdlib/utils/eeprom_utils.hpp>
 #include <unordered_map>
 
@@ -136,6 +137,9 @@ mboard_eeprom_t b200_impl::get_mb_eeprom(uhd::i2c_iface::sptr iface)
 
 void b200_impl::set_mb_eeprom(const mboard_eeprom_t& mb_eeprom)
 {
+    // The host-side copy no longer matches the hardware
+    uhd::eeprom_cache::invalidate(_eeprom_cache_label);
+
     const auto rev  = _get_rev(_iface);
     auto eeprom_map = (rev == 0) ? B200_REV0_MAP : B200_REV1_MAP;
     auto base_addr  = (rev == 0) ? REV0_BASE_ADDR : REV1_BASE_ADDR;
@@ -1321,6 +1321,11 @@ double ad9361_device_t::_tune_helper(direction_t direction, const double value)
     double actual_vcorate = fref * (nint + (double)(nfrac) / modulus);
     double actual_lo      = actual_vcorate / vcodiv;
 
+    /* The register image tracks what is programmed, so band-select writes
+     * can be skipped when the band did not change (the common case when
+     * hopping within a band). */
+    const uint8_t prev_inputsel = _regs.inputsel;
+
     if (direction == RX) {
         _req_rx_freq = value;
 
@@ -1338,7 +1343,9 @@ double ad9361_device_t::_tune_helper(direction_t direction, const double value)
                 "[ad9361_device_t] [_tune_helper] INVALID_CODE_PATH");
         }
 
-        _io_iface->poke8(0x004, _regs.inputsel);
+        if (_regs.inputsel != prev_inputsel) {
+            _io_iface->poke8(0x004, _regs.inputsel);
+        }
 
         /* Store vcodiv setting. */
         _regs.vcodivs = (_regs.vcodivs & 0xF0) | (i & 0x0F);
@@ -1378,7 +1385,9 @@ double ad9361_device_t::_tune_helper(direction_t direction, const double value)
                 "[ad9361_device_t] [_tune_helper] INVALID_CODE_PATH");
         }
 
-        _io_iface->poke8(0x004, _regs.inputsel);
+        if (_regs.inputsel != prev_inputsel) {
+            _io_iface->poke8(0x004, _regs.inputsel);
+        }
 
         /* Store vcodiv setting. */
         _regs.vcodivs = (_regs.vcodivs & 0x0F) | ((i & 0x0F) << 4);
@@ -2160,23 +2169,35 @@ double ad9361_device_t::tune(direction_t direction, const double value)
      * Rx quadrature unless Rx quad-cal is disabled.
      */
     if (std::abs(last_cal_freq - tune_freq) > AD9361_CAL_VALID_WINDOW) {
-        /* Run the calibration algorithms. */
-        if (direction == RX) {
-            _calibrate_rf_dc_offset();
-            if (!_use_iq_balance_tracking)
-                _calibrate_rx_quadrature();
-            if (_use_dc_offset_tracking)
-                _configure_bb_dc_tracking();
-
-            _last_rx_cal_freq = tune_freq;
+        if (_defer_cals) {
+            /* Fast-tune mode: only note that the calibrations are due. They
+             * will run in run_deferred_calibration(). Until then,
+             * _last_*_cal_freq keeps its old value, so re-enabling normal
+             * tuning behaves correctly. */
+            if (direction == RX) {
+                _rx_cal_pending = true;
+            } else {
+                _tx_cal_pending = true;
+            }
         } else {
-            _calibrate_tx_quadrature();
-            _last_tx_cal_freq = tune_freq;
-        }
+            /* Run the calibration algorithms. */
+            if (direction == RX) {
+                _calibrate_rf_dc_offset();
+                if (!_use_iq_balance_tracking)
+                    _calibrate_rx_quadrature();
+                if (_use_dc_offset_tracking)
+                    _configure_bb_dc_tracking();
+
+                _last_rx_cal_freq = tune_freq;
+            } else {
+                _calibrate_tx_quadrature();
+                _last_tx_cal_freq = tune_freq;
+            }
 
-        /* Rx IQ tracking can be disabled on Rx or Tx re-calibration */
-        if (_use_iq_balance_tracking)
-            _configure_rx_iq_tracking();
+            /* Rx IQ tracking can be disabled on Rx or Tx re-calibration */
+            if (_use_iq_balance_tracking)
+                _configure_rx_iq_tracking();
+        }
     }
 
     /* If we were in the FDD state, return it now. */
@@ -2187,6 +2208,62 @@ double ad9361_device_t::tune(direction_t direction, const double value)
     return get_freq(direction);
 }
 
+/* Enable or disable deferred calibration (fast-tune mode).
+ *
+ * Disabling the mode runs any calibrations that are still pending. */
+void ad9361_device_t::set_deferred_calibration(const bool enable)
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    _defer_cals = enable;
+    if (!enable) {
+        run_deferred_calibration();
+    }
+}
+
+/* Run the calibrations that tune() skipped while deferred calibration was
+ * enabled.
+ *
+ * Like tune(), this requires the ALERT state, so we force it here and
+ * restore FDD afterwards if necessary. */
+void ad9361_device_t::run_deferred_calibration()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    if (!_rx_cal_pending && !_tx_cal_pending) {
+        return;
+    }
+
+    int not_in_alert = 0;
+    if ((_io_iface->peek8(0x017) & 0x0F) != 5) {
+        /* Force the device into the ALERT state. */
+        not_in_alert = 1;
+        _io_iface->poke8(0x014, 0x01);
+    }
+
+    if (_rx_cal_pending) {
+        _calibrate_rf_dc_offset();
+        if (!_use_iq_balance_tracking)
+            _calibrate_rx_quadrature();
+        if (_use_dc_offset_tracking)
+            _configure_bb_dc_tracking();
+
+        _last_rx_cal_freq = _rx_freq;
+        _rx_cal_pending   = false;
+    }
+    if (_tx_cal_pending) {
+        _calibrate_tx_quadrature();
+        _last_tx_cal_freq = _tx_freq;
+        _tx_cal_pending   = false;
+    }
+
+    /* Rx IQ tracking can be disabled on Rx or Tx re-calibration */
+    if (_use_iq_balance_tracking)
+        _configure_rx_iq_tracking();
+
+    if (not_in_alert) {
+        _io_iface->poke8(0x014, 0x21);
+    }
+}
+
 /* Get the current RX or TX frequency. */
 double ad9361_device_t::get_freq(direction_t direction)
 {
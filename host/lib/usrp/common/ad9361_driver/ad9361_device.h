@@ -50,6 +50,9 @@ public:
         , _rx2_agc_enable(false)
         , _use_dc_offset_tracking(false)
         , _use_iq_balance_tracking(false)
+        , _defer_cals(false)
+        , _rx_cal_pending(false)
+        , _tx_cal_pending(false)
         , _rx_filters{{"LPF_TIA",
                           std::make_tuple(
                               [this](const chain_t) {
@@ -170,6 +173,22 @@ public:
      * After tuning, it runs any appropriate calibrations. */
     double tune(direction_t direction, const double value);
 
+    /* Enable or disable deferred calibration (fast-tune mode).
+     *
+     * When enabled, tune() still programs the synthesizer, band selects and
+     * gains, but the RF DC offset and quadrature calibrations that normally
+     * run after moving far from the last calibration point are only recorded
+     * as pending instead of executed. This removes the dominant cost of a
+     * retune and enables sub-millisecond hops, at the price of degraded
+     * image rejection until run_deferred_calibration() is called (e.g. once
+     * a hop sequence settles). Disabling this mode also runs any pending
+     * calibrations. */
+    void set_deferred_calibration(const bool enable);
+
+    /* Run any calibrations that were skipped by tune() while deferred
+     * calibration was enabled. */
+    void run_deferred_calibration();
+
     /* Get the current RX or TX frequency. */
     double get_freq(direction_t direction);
 
@@ -339,6 +358,10 @@ private: // Members
     std::recursive_mutex _mutex;
     bool _use_dc_offset_tracking;
     bool _use_iq_balance_tracking;
+    //! Deferred calibration (fast-tune) state, see set_deferred_calibration()
+    bool _defer_cals;
+    bool _rx_cal_pending;
+    bool _tx_cal_pending;
 
     // Filter API
     using filter_tuple =
@@ -18,6 +18,12 @@ static const char* send_offload_str             = "send_offload";
 static const char* recv_offload_wait_mode_str   = "recv_offload_wait_mode";
 static const char* send_offload_wait_mode_str   = "send_offload_wait_mode";
 static const char* num_poll_offload_threads_str = "num_poll_offload_threads";
+static const char* poll_offload_shared_pool_str = "poll_offload_shared_pool";
+static const char* recv_wait_strategy_str       = "recv_wait_strategy";
+static const char* recv_spin_duration_us_str    = "recv_spin_duration_us";
+static const char* recv_cpu_str                 = "recv_cpu";
+static const char* send_cpu_str                 = "send_cpu";
+static const char* offload_cpu_str              = "offload_cpu";
 
 static const std::regex recv_offload_thread_cpu_expr("^recv_offload_thread_(\\d+)_cpu");
 static const std::regex send_offload_thread_cpu_expr("^send_offload_thread_(\\d+)_cpu");
@@ -50,6 +56,24 @@ io_service_args_t::wait_mode_t get_wait_mode_arg(const device_addr_t& args,
     return arg.get();
 }
 
+io_service_args_t::recv_wait_strategy_t get_recv_wait_strategy_arg(
+    const device_addr_t& args,
+    const std::string& key,
+    const io_service_args_t::recv_wait_strategy_t def)
+{
+    constrained_device_args_t::enum_arg<io_service_args_t::recv_wait_strategy_t> arg(key,
+        def,
+        {{"block", io_service_args_t::WAIT_BLOCK},
+            {"spin", io_service_args_t::WAIT_SPIN},
+            {"spin_yield", io_service_args_t::WAIT_SPIN_YIELD},
+            {"spin_block", io_service_args_t::WAIT_SPIN_BLOCK}});
+
+    if (args.has_key(key)) {
+        arg.parse(args[key]);
+    }
+    return arg.get();
+}
+
 }; // namespace
 
 io_service_args_t read_io_service_args(
@@ -77,6 +101,9 @@ io_service_args_t read_io_service_args(
         io_srv_args.num_poll_offload_threads = 1;
     }
 
+    io_srv_args.poll_offload_shared_pool =
+        get_bool_arg(args, poll_offload_shared_pool_str, defaults.poll_offload_shared_pool);
+
     auto read_thread_args = [&args](
                                 const std::regex& expr, std::map<size_t, size_t>& dest) {
         auto keys = args.keys();
@@ -91,10 +118,26 @@ io_service_args_t read_io_service_args(
         }
     };
 
+    io_srv_args.recv_wait_strategy = get_recv_wait_strategy_arg(
+        args, recv_wait_strategy_str, defaults.recv_wait_strategy);
+    io_srv_args.recv_spin_duration_us = args.cast<size_t>(
+        recv_spin_duration_us_str, defaults.recv_spin_duration_us);
+
     read_thread_args(recv_offload_thread_cpu_expr, io_srv_args.recv_offload_thread_cpu);
     read_thread_args(send_offload_thread_cpu_expr, io_srv_args.send_offload_thread_cpu);
     read_thread_args(poll_offload_thread_cpu_expr, io_srv_args.poll_offload_thread_cpu);
 
+    // shorthand affinity keys, used when no per-thread entry matches
+    if (args.has_key(recv_cpu_str)) {
+        io_srv_args.recv_cpu = args.cast<size_t>(recv_cpu_str, 0);
+    }
+    if (args.has_key(send_cpu_str)) {
+        io_srv_args.send_cpu = args.cast<size_t>(send_cpu_str, 0);
+    }
+    if (args.has_key(offload_cpu_str)) {
+        io_srv_args.offload_cpu = args.cast<size_t>(offload_cpu_str, 0);
+    }
+
     return io_srv_args;
 }
 
@@ -118,6 +161,12 @@ device_addr_t merge_io_service_dev_args(
     merge_args(dev_args, args, recv_offload_wait_mode_str);
     merge_args(dev_args, args, send_offload_wait_mode_str);
     merge_args(dev_args, args, num_poll_offload_threads_str);
+    merge_args(dev_args, args, poll_offload_shared_pool_str);
+    merge_args(dev_args, args, recv_wait_strategy_str);
+    merge_args(dev_args, args, recv_spin_duration_us_str);
+    merge_args(dev_args, args, recv_cpu_str);
+    merge_args(dev_args, args, send_cpu_str);
+    merge_args(dev_args, args, offload_cpu_str);
 
     auto merge_thread_args = [&merge_args](const device_addr_t& dev_args,
                                  device_addr_t& stream_args,
@@ -40,8 +40,10 @@ namespace uhd { namespace usrp {
 class inline_io_service_mgr
 {
 public:
-    io_service::sptr connect_links(
-        recv_link_if::sptr recv_link, send_link_if::sptr send_link);
+    io_service::sptr connect_links(recv_link_if::sptr recv_link,
+        send_link_if::sptr send_link,
+        const link_type_t link_type,
+        const io_service_args_t& args);
 
     void disconnect_links(recv_link_if::sptr recv_link, send_link_if::sptr send_link);
 
@@ -56,8 +58,10 @@ private:
     std::map<link_pair_t, link_info_t> _link_info_map;
 };
 
-io_service::sptr inline_io_service_mgr::connect_links(
-    recv_link_if::sptr recv_link, send_link_if::sptr send_link)
+io_service::sptr inline_io_service_mgr::connect_links(recv_link_if::sptr recv_link,
+    send_link_if::sptr send_link,
+    const link_type_t link_type,
+    const io_service_args_t& args)
 {
     // Check if links are already connected
     const link_pair_t links{recv_link, send_link};
@@ -69,8 +73,28 @@ io_service::sptr inline_io_service_mgr::connect_links(
         return it->second.io_srv;
     }
 
-    // Links are not muxed, create a new inline I/O service
-    auto io_srv = inline_io_service::make();
+    // Links are not muxed, create a new inline I/O service. Data links honor
+    // the configured receive wait strategy; control links always block.
+    inline_io_service::recv_wait_params_t wait_params;
+    if (link_type != link_type_t::CTRL) {
+        switch (args.recv_wait_strategy) {
+            case io_service_args_t::WAIT_SPIN:
+                wait_params.mode = inline_io_service::recv_wait_mode_t::SPIN;
+                break;
+            case io_service_args_t::WAIT_SPIN_YIELD:
+                wait_params.mode = inline_io_service::recv_wait_mode_t::SPIN_YIELD;
+                break;
+            case io_service_args_t::WAIT_SPIN_BLOCK:
+                wait_params.mode = inline_io_service::recv_wait_mode_t::SPIN_BLOCK;
+                break;
+            case io_service_args_t::WAIT_BLOCK:
+            default:
+                wait_params.mode = inline_io_service::recv_wait_mode_t::BLOCK;
+                break;
+        }
+        wait_params.spin_duration_us = args.recv_spin_duration_us;
+    }
+    auto io_srv = inline_io_service::make(wait_params);
 
     if (recv_link) {
         io_srv->attach_recv_link(recv_link);
@@ -254,12 +278,17 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
     const auto& cpu_map = (link_type == link_type_t::RX_DATA)
                               ? args.recv_offload_thread_cpu
                               : args.send_offload_thread_cpu;
+    const auto& fallback_cpu = (link_type == link_type_t::RX_DATA) ? args.recv_cpu
+                                                                   : args.send_cpu;
 
     std::string cpu_affinity_str;
     if (cpu_map.count(thread_index) != 0) {
         const size_t cpu         = cpu_map.at(thread_index);
         params.cpu_affinity_list = {cpu};
         cpu_affinity_str         = ", cpu affinity: " + std::to_string(cpu);
+    } else if (fallback_cpu) {
+        params.cpu_affinity_list = {*fallback_cpu};
+        cpu_affinity_str         = ", cpu affinity: " + std::to_string(*fallback_cpu);
     } else {
         cpu_affinity_str = ", cpu affinity: none";
     }
@@ -327,9 +356,13 @@ io_service::sptr polling_io_service_mgr::connect_links(recv_link_if::sptr recv_l
 
     // Links are not muxed. If there are fewer offload threads than requested in
     // the args, create a new service and add the links to it. Otherwise, add it
-    // to the service that has the fewest connections.
+    // to the service that has the fewest connections. In shared pool mode, a
+    // single I/O service runs all the worker threads, so every connection goes
+    // to that one service and the workers balance the load among themselves.
+    const size_t num_io_services =
+        args.poll_offload_shared_pool ? 1 : args.num_poll_offload_threads;
     io_service::sptr io_srv;
-    if (_io_srv_info_map.size() < args.num_poll_offload_threads) {
+    if (_io_srv_info_map.size() < num_io_services) {
         const size_t thread_index = _io_srv_info_map.size();
         io_srv                    = _create_new_io_service(args, thread_index);
         _link_info_map[links]     = {io_srv, 1 /*mux_ref_count*/};
@@ -388,10 +421,38 @@ io_service::sptr polling_io_service_mgr::_create_new_io_service(
     const auto& cpu_map = args.poll_offload_thread_cpu;
 
     std::string cpu_affinity_str;
+    if (args.poll_offload_shared_pool) {
+        // All workers of the shared pool live in one I/O service, so gather
+        // the per-thread affinity entries into a single allowed-CPU list
+        params.num_worker_threads = args.num_poll_offload_threads;
+        for (const auto& cpu : cpu_map) {
+            params.cpu_affinity_list.push_back(cpu.second);
+        }
+        if (params.cpu_affinity_list.empty() && args.offload_cpu) {
+            params.cpu_affinity_list = {*args.offload_cpu};
+        }
+        for (const size_t cpu : params.cpu_affinity_list) {
+            cpu_affinity_str += (cpu_affinity_str.empty() ? ", cpu affinity: " : ",")
+                                + std::to_string(cpu);
+        }
+        if (cpu_affinity_str.empty()) {
+            cpu_affinity_str = ", cpu affinity: none";
+        }
+
+        UHD_LOG_INFO(LOG_ID,
+            "Creating new polling I/O service with a shared pool of "
+                << params.num_worker_threads << " worker threads" << cpu_affinity_str);
+
+        return offload_io_service::make(inline_io_service::make(), params);
+    }
+
     if (cpu_map.count(thread_index) != 0) {
         const size_t cpu         = cpu_map.at(thread_index);
         params.cpu_affinity_list = {cpu};
         cpu_affinity_str         = ", cpu affinity: " + std::to_string(cpu);
+    } else if (args.offload_cpu) {
+        params.cpu_affinity_list = {*args.offload_cpu};
+        cpu_affinity_str         = ", cpu affinity: " + std::to_string(*args.offload_cpu);
     } else {
         cpu_affinity_str = ", cpu affinity: none";
     }
@@ -533,7 +594,8 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
 
     switch (io_srv_type) {
         case INLINE_IO_SRV:
-            io_srv = _inline_io_srv_mgr.connect_links(recv_link, send_link);
+            io_srv =
+                _inline_io_srv_mgr.connect_links(recv_link, send_link, link_type, args);
             break;
         case BLOCKING_IO_SRV:
             io_srv = _blocking_io_srv_mgr.connect_links(
@@ -48,9 +48,12 @@ class lmx2572_impl : public lmx2572_iface
 public:
     enum class muxout_state_t { LOCKDETECT, SDO };
 
-    explicit lmx2572_impl(
-        write_fn_t&& poke_fn, read_fn_t&& peek_fn, sleep_fn_t&& sleep_fn)
+    lmx2572_impl(write_fn_t&& poke_fn,
+        write_seq_fn_t&& poke_seq_fn,
+        read_fn_t&& peek_fn,
+        sleep_fn_t&& sleep_fn)
         : _poke16(std::move(poke_fn))
+        , _poke16_seq(std::move(poke_seq_fn))
         , _peek16(std::move(peek_fn))
         , _sleep(std::move(sleep_fn))
         , _regs()
@@ -61,15 +64,21 @@ public:
     void commit() override
     {
         UHD_LOG_TRACE(LOG_ID, "Storing register cache to LMX2572...");
+        // Diff against the shadow registers and hand the changed registers
+        // to the burst writer in a single call; whether the writes coalesce
+        // into one control transaction is up to the backend
         const auto changed_addrs = _regs.get_changed_addrs<uint8_t>();
+        std::vector<std::pair<uint8_t, uint16_t>> writes;
+        writes.reserve(changed_addrs.size() + 1);
         for (const auto addr : changed_addrs) {
             // We write R0 last, for double-buffering
             if (addr == 0) {
                 continue;
             }
-            _poke16(addr, _regs.get_reg(addr));
+            writes.emplace_back(addr, _regs.get_reg(addr));
         }
-        _poke16(0, _regs.get_reg(0));
+        writes.emplace_back(uint8_t(0), _regs.get_reg(0));
+        _poke16_seq(writes);
         _regs.save_state();
         UHD_LOG_TRACE(LOG_ID,
             "Storing cache complete: Updated " << changed_addrs.size() << " registers.");
@@ -377,6 +386,7 @@ private:
      * Attributes
      *************************************************************************/
     write_fn_t _poke16;
+    write_seq_fn_t _poke16_seq;
     read_fn_t _peek16;
     sleep_fn_t _sleep;
     lmx2572_regs_t _regs = lmx2572_regs_t();
@@ -1023,6 +1033,27 @@ lmx2572_iface::sptr lmx2572_iface::make(lmx2572_iface::write_fn_t&& poke_fn,
     lmx2572_iface::read_fn_t&& peek_fn,
     lmx2572_iface::sleep_fn_t&& sleep_fn)
 {
-    return std::make_shared<lmx2572_impl>(
-        std::move(poke_fn), std::move(peek_fn), std::move(sleep_fn));
+    // No burst writer provided: fall back to one poke per register
+    auto poke = std::move(poke_fn);
+    lmx2572_iface::write_seq_fn_t poke_seq =
+        [poke](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+            for (const auto& write : writes) {
+                poke(write.first, write.second);
+            }
+        };
+    return std::make_shared<lmx2572_impl>(std::move(poke),
+        std::move(poke_seq),
+        std::move(peek_fn),
+        std::move(sleep_fn));
+}
+
+lmx2572_iface::sptr lmx2572_iface::make(lmx2572_iface::write_fn_t&& poke_fn,
+    lmx2572_iface::write_seq_fn_t&& poke_seq_fn,
+    lmx2572_iface::read_fn_t&& peek_fn,
+    lmx2572_iface::sleep_fn_t&& sleep_fn)
+{
+    return std::make_shared<lmx2572_impl>(std::move(poke_fn),
+        std::move(poke_seq_fn),
+        std::move(peek_fn),
+        std::move(sleep_fn));
 }
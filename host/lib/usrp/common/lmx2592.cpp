@@ -117,12 +117,13 @@ inline bool offset_abs_less_than_compare(const offset_t a, const offset_t b)
 class lmx2592_impl : public lmx2592_iface
 {
 public:
-    explicit lmx2592_impl(write_spi_t write_fn, read_spi_t read_fn)
+    lmx2592_impl(write_spi_t write_fn, write_seq_spi_t write_seq_fn, read_spi_t read_fn)
         : _write_fn([write_fn](const uint8_t addr, const uint16_t data) {
             const uint32_t spi_transaction =
                 0 | ((addr & SPI_ADDR_MASK) << SPI_ADDR_SHIFT) | data;
             write_fn(spi_transaction);
         })
+        , _write_seq_fn(std::move(write_seq_fn))
         , _read_fn([read_fn](const uint8_t addr) {
             const uint32_t spi_transaction = SPI_READ_FLAG
                                              | ((addr & SPI_ADDR_MASK) << SPI_ADDR_SHIFT);
@@ -405,13 +406,18 @@ public:
         const auto changed_addrs = _rewrite_regs ? _regs.get_all_addrs()
                                                  : _regs.get_changed_addrs<size_t>();
 
+        // Pack the changed registers into one SPI burst
+        std::vector<uint32_t> spi_transactions;
+        spi_transactions.reserve(changed_addrs.size());
         for (const auto addr : changed_addrs) {
-            _write_fn(addr, _regs.get_reg(addr));
+            spi_transactions.push_back(
+                0 | ((addr & SPI_ADDR_MASK) << SPI_ADDR_SHIFT) | _regs.get_reg(addr));
             UHD_LOGGER_TRACE("LMX2592")
                 << "Register " << std::setw(2) << static_cast<unsigned int>(addr)
                 << ": 0x" << std::hex << std::uppercase << std::setw(4)
                 << std::setfill('0') << static_cast<unsigned int>(_regs.get_reg(addr));
         }
+        _write_seq_fn(spi_transactions);
 
         _regs.save_state();
         UHD_LOG_DEBUG("LMX2592",
@@ -429,6 +435,7 @@ private: // Members
     using read_fn_t = std::function<uint16_t(uint8_t)>;
 
     write_fn_t _write_fn;
+    write_seq_spi_t _write_seq_fn;
     read_fn_t _read_fn;
     lmx2592_regs_t _regs;
     bool _rewrite_regs;
@@ -762,5 +769,17 @@ private: // Members
 
 lmx2592_impl::sptr lmx2592_iface::make(write_spi_t write, read_spi_t read)
 {
-    return std::make_shared<lmx2592_impl>(write, read);
+    // No burst writer provided: fall back to one SPI transaction per register
+    write_seq_spi_t write_seq = [write](const std::vector<uint32_t>& transactions) {
+        for (const auto transaction : transactions) {
+            write(transaction);
+        }
+    };
+    return std::make_shared<lmx2592_impl>(write, std::move(write_seq), read);
+}
+
+lmx2592_impl::sptr lmx2592_iface::make(
+    write_spi_t write, write_seq_spi_t write_seq, read_spi_t read)
+{
+    return std::make_shared<lmx2592_impl>(write, std::move(write_seq), read);
 }
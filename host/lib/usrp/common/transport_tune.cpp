@@ -0,0 +1,270 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/transport/adapter_id.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/offload_io_service.hpp>
+#include <uhdlib/usrp/common/transport_tune.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <uhdlib/utils/prefs.hpp>
+#include <boost/asio/ip/host_name.hpp>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+static const std::string LOG_ID = "TRANSPORT_TUNE";
+
+using namespace uhd::transport;
+
+namespace uhd { namespace usrp {
+
+namespace {
+
+//! Candidate frame sizes in bytes
+constexpr size_t CANDIDATE_FRAME_SIZES[] = {2000, 4000, 8000};
+//! Candidate link depths in frames
+constexpr size_t CANDIDATE_NUM_FRAMES[] = {32, 128};
+//! Measurement duration per candidate
+constexpr auto MEASURE_DURATION = std::chrono::milliseconds(25);
+
+//! Frame buff whose data pointer is fixed at construction
+class tune_frame_buff : public frame_buff
+{
+public:
+    tune_frame_buff(void* mem)
+    {
+        _data = mem;
+    }
+};
+
+/*! Synthetic recv link that always has a full frame available
+ *
+ * Receiving from this link measures the host-side ceiling of the transport
+ * stack (I/O service and frame handling overhead), as if the device could
+ * saturate the wire.
+ */
+class tune_recv_link : public recv_link_base<tune_recv_link>
+{
+public:
+    using sptr = std::shared_ptr<tune_recv_link>;
+
+    tune_recv_link(const size_t num_frames, const size_t frame_size)
+        : recv_link_base_t(num_frames, frame_size)
+        , _pool(buffer_pool::make(num_frames, frame_size))
+    {
+        _buffs.reserve(num_frames);
+        for (size_t i = 0; i < num_frames; i++) {
+            _buffs.emplace_back(_pool->at(i));
+            preload_free_buff(&_buffs.back());
+        }
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return NULL_ADAPTER_ID;
+    }
+
+    bool supports_recv_buff_out_of_order() const override
+    {
+        return true;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<tune_recv_link>;
+    friend recv_link_base_t;
+
+    size_t get_recv_buff_derived(frame_buff& /*buff*/, int32_t /*timeout_ms*/)
+    {
+        return get_recv_frame_size();
+    }
+
+    void release_recv_buff_derived(frame_buff& /*buff*/) {}
+
+    buffer_pool::sptr _pool;
+    std::vector<tune_frame_buff> _buffs;
+};
+
+/*! Measure the achievable packet rate for one candidate combination
+ *
+ * \return packets per second
+ */
+double measure_candidate(
+    const size_t frame_size, const size_t num_frames, const bool recv_offload)
+{
+    auto link = std::make_shared<tune_recv_link>(num_frames, frame_size);
+
+    io_service::sptr io_srv = inline_io_service::make();
+    if (recv_offload) {
+        offload_io_service::params_t params;
+        params.client_type = offload_io_service::RECV_ONLY;
+        params.wait_mode   = offload_io_service::POLL;
+        io_srv             = offload_io_service::make(io_srv, params);
+    }
+    io_srv->attach_recv_link(link);
+
+    auto recv_cb = [](frame_buff::uptr& /*buff*/,
+                       recv_link_if* /*recv_link*/,
+                       send_link_if* /*send_link*/) { return true; };
+    auto fc_cb   = [](frame_buff::uptr buff,
+                     recv_link_if* recv_link,
+                     send_link_if* /*send_link*/) {
+        recv_link->release_recv_buff(std::move(buff));
+    };
+    auto recv_io =
+        io_srv->make_recv_client(link, num_frames, recv_cb, nullptr, 0, fc_cb);
+
+    // Consume frames for a fixed duration, touching one byte per cache line
+    // of the payload so the frame size has a realistic per-byte cost
+    uint64_t accum     = 0;
+    size_t num_packets = 0;
+    const auto start   = std::chrono::steady_clock::now();
+    const auto end     = start + MEASURE_DURATION;
+    while (std::chrono::steady_clock::now() < end) {
+        auto buff = recv_io->get_recv_buff(10);
+        if (!buff) {
+            continue;
+        }
+        const uint8_t* data = static_cast<const uint8_t*>(buff->data());
+        for (size_t i = 0; i < frame_size; i += 64) {
+            accum += data[i];
+        }
+        recv_io->release_recv_buff(std::move(buff));
+        num_packets++;
+    }
+    const auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start);
+
+    recv_io.reset();
+
+    // Keep the payload reads from being optimized away
+    if (accum == uint64_t(-1)) {
+        UHD_LOG_TRACE(LOG_ID, "Unexpected payload checksum");
+    }
+
+    return double(num_packets) / elapsed.count();
+}
+
+//! Run the benchmark across all candidates and return the winning hints
+device_addr_t run_benchmark()
+{
+    double best_tput       = 0.0;
+    size_t best_frame_size = 0;
+    size_t best_num_frames = 0;
+    bool best_offload      = false;
+
+    for (const bool recv_offload : {false, true}) {
+        for (const size_t frame_size : CANDIDATE_FRAME_SIZES) {
+            for (const size_t num_frames : CANDIDATE_NUM_FRAMES) {
+                const double pkt_rate =
+                    measure_candidate(frame_size, num_frames, recv_offload);
+                // Compare byte throughput so frame sizes are comparable
+                const double tput = pkt_rate * double(frame_size);
+                UHD_LOG_TRACE(LOG_ID,
+                    "frame_size=" << frame_size << " num_frames=" << num_frames
+                                  << " recv_offload=" << recv_offload << ": "
+                                  << (pkt_rate / 1e6) << " Mpps");
+                if (tput > best_tput) {
+                    best_tput       = tput;
+                    best_frame_size = frame_size;
+                    best_num_frames = num_frames;
+                    best_offload    = recv_offload;
+                }
+            }
+        }
+    }
+
+    device_addr_t tuned;
+    tuned["recv_frame_size"] = std::to_string(best_frame_size);
+    tuned["num_recv_frames"] = std::to_string(best_num_frames);
+    tuned["recv_offload"]    = best_offload ? "true" : "false";
+    return tuned;
+}
+
+//! Config file section identifying this (host, device) pair
+std::string get_tune_section(const device_addr_t& args)
+{
+    // Identify the device the way config file sections do, preferring the
+    // most specific key available
+    std::string dev_id;
+    for (const std::string key : {"serial", "product", "type"}) {
+        if (args.has_key(key) && !args[key].empty()) {
+            dev_id = args[key];
+            break;
+        }
+    }
+    return "transport_tune=" + boost::asio::ip::host_name() + "/" + dev_id;
+}
+
+//! Persist the tuned hints to the user's uhd.conf
+void persist_tune_result(const std::string& section, const device_addr_t& tuned)
+{
+    try {
+        const auto conf_dir = get_xdg_config_home();
+        boost::filesystem::create_directories(conf_dir);
+        const std::string conf_path = (conf_dir / "uhd.conf").string();
+        config_parser user_conf(
+            boost::filesystem::exists(conf_path) ? conf_path : "");
+        for (const auto& key : tuned.keys()) {
+            user_conf.set<std::string>(section, key, tuned[key]);
+        }
+        user_conf.save_file(conf_path);
+        UHD_LOG_INFO(LOG_ID, "Persisted transport tuning to " << conf_path);
+    } catch (const std::exception& ex) {
+        UHD_LOG_WARNING(
+            LOG_ID, "Could not persist transport tuning: " << ex.what());
+    }
+}
+
+} // namespace
+
+device_addr_t apply_transport_tune(const device_addr_t& args)
+{
+    const std::string mode = args.get("auto_tune_transport", "0");
+    if (mode == "0" || mode.empty()) {
+        return args;
+    }
+
+    const std::string section = get_tune_section(args);
+    auto& conf                = prefs::get_uhd_config();
+
+    device_addr_t tuned;
+    const auto persisted = conf.options(section);
+    if (!persisted.empty() && mode != "force") {
+        for (const auto& key : persisted) {
+            tuned[key] = conf.get<std::string>(section, key, "");
+        }
+        UHD_LOG_INFO(LOG_ID,
+            "Applying persisted transport tuning [" << section
+                                                    << "]: " << tuned.to_string());
+    } else {
+        UHD_LOG_INFO(LOG_ID,
+            "Benchmarking transport configurations, this can take a few seconds...");
+        tuned = run_benchmark();
+        UHD_LOG_INFO(
+            LOG_ID, "Transport tuning result [" << section << "]: " << tuned.to_string());
+        persist_tune_result(section, tuned);
+        // Update the in-memory config so this session's prefs are coherent
+        for (const auto& key : tuned.keys()) {
+            conf.set<std::string>(section, key, tuned[key]);
+        }
+    }
+
+    // Merge the tuned hints; keys the user provided explicitly win
+    device_addr_t merged = args;
+    for (const auto& key : tuned.keys()) {
+        if (!merged.has_key(key)) {
+            merged[key] = tuned[key];
+        }
+    }
+    return merged;
+}
+
+}} // namespace uhd::usrp
@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/usrp/cores/batched_wb_iface.hpp>
+
+using namespace uhd;
+using namespace uhd::usrp;
+
+class batched_wb_iface_impl : public batched_wb_iface
+{
+public:
+    batched_wb_iface_impl(wb_iface::sptr iface, block_poke32_fn_t block_poke32)
+        : _iface(iface), _block_poke32(block_poke32)
+    {
+    }
+
+    ~batched_wb_iface_impl(void) override
+    {
+        // Anything left unbatched is dropped on purpose: an exception during
+        // a configure sequence must not replay a half-built register set.
+    }
+
+    void start_batch(void) override
+    {
+        _depth++;
+    }
+
+    void commit_batch(void) override
+    {
+        UHD_ASSERT_THROW(_depth > 0);
+        if (--_depth == 0) {
+            _flush();
+        }
+    }
+
+    void poke32(const wb_addr_type addr, const uint32_t data) override
+    {
+        if (_depth > 0) {
+            _queue.emplace_back(addr, data);
+        } else {
+            _iface->poke32(addr, data);
+        }
+    }
+
+    uint32_t peek32(const wb_addr_type addr) override
+    {
+        _flush();
+        return _iface->peek32(addr);
+    }
+
+    // Only 32-bit writes are buffered; other widths flush first so the
+    // underlying interface observes all accesses in program order.
+    void poke64(const wb_addr_type addr, const uint64_t data) override
+    {
+        _flush();
+        _iface->poke64(addr, data);
+    }
+
+    uint64_t peek64(const wb_addr_type addr) override
+    {
+        _flush();
+        return _iface->peek64(addr);
+    }
+
+    void poke16(const wb_addr_type addr, const uint16_t data) override
+    {
+        _flush();
+        _iface->poke16(addr, data);
+    }
+
+    uint16_t peek16(const wb_addr_type addr) override
+    {
+        _flush();
+        return _iface->peek16(addr);
+    }
+
+private:
+    void _flush(void)
+    {
+        if (_queue.empty()) {
+            return;
+        }
+        if (_block_poke32) {
+            _block_poke32(_queue);
+        } else {
+            for (const auto& op : _queue) {
+                _iface->poke32(op.first, op.second);
+            }
+        }
+        _queue.clear();
+    }
+
+    wb_iface::sptr _iface;
+    block_poke32_fn_t _block_poke32;
+    size_t _depth = 0;
+    std::vector<poke32_op_t> _queue;
+};
+
+batched_wb_iface::sptr batched_wb_iface::make(
+    wb_iface::sptr iface, block_poke32_fn_t block_poke32)
+{
+    return std::make_shared<batched_wb_iface_impl>(iface, block_poke32);
+}
@@ -144,6 +144,16 @@ public:
             (stream_cmd.stream_now) ? 0 : stream_cmd.time_spec.to_ticks(_tick_rate);
         _iface->poke32(REG_RX_CTRL_TIME_HI, uint32_t(ticks >> 32));
         _iface->poke32(REG_RX_CTRL_TIME_LO, uint32_t(ticks >> 0)); // latches the command
+
+        // Pre-arm an immediate restart for overflow recovery: the command
+        // and time-high registers only stage values until time-low latches
+        // them, so they can be loaded with a stream-now command here and
+        // handle_overflow() can fire it with a single poke.
+        _restart_armed = _continuous_streaming and _fast_restart;
+        if (_restart_armed) {
+            _iface->poke32(REG_RX_CTRL_STREAM_CMD, cmd_word | (uint32_t(1) << 31));
+            _iface->poke32(REG_RX_CTRL_TIME_HI, 0);
+        }
     }
 
     void set_mux(const std::string& mode, const bool fe_swapped) override
@@ -256,8 +266,15 @@ public:
 
     void handle_overflow(void) override
     {
-        if (_continuous_streaming)
-            issue_stream_command(stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+        if (not _continuous_streaming)
+            return;
+        if (_restart_armed) {
+            // the restart command was staged when streaming started;
+            // latching time-low fires it with one control transaction
+            _iface->poke32(REG_RX_CTRL_TIME_LO, 0);
+            return;
+        }
+        issue_stream_command(stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
     }
 
     void setup(const uhd::stream_args_t& stream_args) override
@@ -265,6 +282,8 @@ public:
         if (not stream_args.args.has_key("noclear"))
             this->clear();
 
+        _fast_restart = stream_args.args.has_key("overflow_fast_restart");
+
         unsigned format_word = 0;
         if (stream_args.otw_format == "sc16") {
             format_word         = 0;
@@ -293,6 +312,8 @@ private:
     const size_t _dsp_base, _ctrl_base;
     double _tick_rate, _link_rate;
     bool _continuous_streaming;
+    bool _fast_restart  = false;
+    bool _restart_armed = false;
     double _scaling_adjustment, _dsp_extra_scaling, _host_extra_scaling,
         _fxpt_scalar_correction;
     const uint32_t _sid;
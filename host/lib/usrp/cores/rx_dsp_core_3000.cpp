@@ -9,6 +9,7 @@
 #include <uhd/types/dict.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/safe_call.hpp>
+#include <uhdlib/usrp/cores/batched_wb_iface.hpp>
 #include <uhdlib/usrp/cores/dsp_core_utils.hpp>
 #include <uhdlib/usrp/cores/rx_dsp_core_3000.hpp>
 #include <algorithm>
@@ -47,7 +48,9 @@ class rx_dsp_core_3000_impl : public rx_dsp_core_3000
 {
 public:
     rx_dsp_core_3000_impl(wb_iface::sptr iface, const size_t dsp_base, const bool is_b200)
-        : _iface(iface), _dsp_base(dsp_base), _is_b200(is_b200)
+        : _iface(usrp::batched_wb_iface::make(iface))
+        , _dsp_base(dsp_base)
+        , _is_b200(is_b200)
     {
     }
 
@@ -134,6 +137,8 @@ public:
 
     double set_host_rate(const double rate) override
     {
+        // Release the decimation and scalar writes as one transaction
+        usrp::batched_wb_iface::batch batch(_iface);
         const size_t decim_rate =
             std::lround(_tick_rate / this->get_host_rates().clip(rate, true));
         size_t decim = decim_rate;
@@ -310,7 +315,7 @@ public:
     }
 
 private:
-    wb_iface::sptr _iface;
+    usrp::batched_wb_iface::sptr _iface;
     const size_t _dsp_base;
     const bool _is_b200; // TODO: Obsolete this when we switch to the new DDC on the B200
 
@@ -8,6 +8,7 @@
 #include <uhd/types/dict.hpp>
 #include <uhd/types/ranges.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhdlib/usrp/cores/batched_wb_iface.hpp>
 #include <uhdlib/usrp/cores/dsp_core_utils.hpp>
 #include <uhdlib/usrp/cores/rx_frontend_core_3000.hpp>
 #include <cmath>
@@ -67,7 +68,7 @@ public:
         , _q_dc_off(0)
         , _adc_rate(0.0)
         , _fe_conn(fe_connection_t("IQ"))
-        , _iface(iface)
+        , _iface(batched_wb_iface::make(iface))
         , _rx_fe_mag_corr_reg(REG_RX_FE_MAG_CORRECTION)
         , _rx_fe_phase_corr_reg(REG_RX_FE_PHASE_CORRECTION)
         , _rx_fe_offset_i_reg(REG_RX_FE_OFFSET_I)
@@ -162,12 +163,14 @@ public:
 
     void _set_dc_offset(const uint32_t flags)
     {
+        batched_wb_iface::batch batch(_iface);
         _iface->poke32(_rx_fe_offset_i_reg, flags | (_i_dc_off & ~FLAG_MASK));
         _iface->poke32(_rx_fe_offset_q_reg, flags | (_q_dc_off & ~FLAG_MASK));
     }
 
     void set_iq_balance(const std::complex<double>& cor) override
     {
+        batched_wb_iface::batch batch(_iface);
         _iface->poke32(_rx_fe_mag_corr_reg, fs_to_bits(cor.real(), 18));
         _iface->poke32(_rx_fe_phase_corr_reg, fs_to_bits(cor.imag(), 18));
     }
@@ -194,7 +197,7 @@ private:
     int32_t _i_dc_off, _q_dc_off;
     double _adc_rate;
     fe_connection_t _fe_conn;
-    wb_iface::sptr _iface;
+    batched_wb_iface::sptr _iface;
     const size_t _rx_fe_mag_corr_reg;
     const size_t _rx_fe_phase_corr_reg;
     const size_t _rx_fe_offset_i_reg;
@@ -132,6 +132,16 @@ struct rx_vita_core_3000_impl : rx_vita_core_3000
             (stream_cmd.stream_now) ? 0 : stream_cmd.time_spec.to_ticks(_tick_rate);
         _iface->poke32(REG_CTRL_TIME_HI, uint32_t(ticks >> 32));
         _iface->poke32(REG_CTRL_TIME_LO, uint32_t(ticks >> 0)); // latches the command
+
+        // Pre-arm an immediate restart for overflow recovery: the command
+        // and time-high registers only stage values until time-low latches
+        // them, so they can be loaded with a stream-now command here and
+        // handle_overflow() can fire it with a single poke.
+        _restart_armed = _continuous_streaming and _fast_restart;
+        if (_restart_armed) {
+            _iface->poke32(REG_CTRL_CMD, cmd_word | (uint32_t(1) << 31));
+            _iface->poke32(REG_CTRL_TIME_HI, 0);
+        }
     }
 
     void set_tick_rate(const double rate) override
@@ -146,13 +156,21 @@ struct rx_vita_core_3000_impl : rx_vita_core_3000
 
     void handle_overflow(void) override
     {
-        if (_continuous_streaming)
-            this->issue_stream_command(stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+        if (not _continuous_streaming)
+            return;
+        if (_restart_armed) {
+            // the restart command was staged when streaming started;
+            // latching time-low fires it with one control transaction
+            _iface->poke32(REG_CTRL_TIME_LO, 0);
+            return;
+        }
+        this->issue_stream_command(stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
     }
 
-    void setup(const uhd::stream_args_t&) override
+    void setup(const uhd::stream_args_t& stream_args) override
     {
-        _is_setup = true;
+        _fast_restart = stream_args.args.has_key("overflow_fast_restart");
+        _is_setup     = true;
     }
 
     bool in_continuous_streaming_mode(void) override
@@ -165,6 +183,8 @@ struct rx_vita_core_3000_impl : rx_vita_core_3000
     double _tick_rate;
     bool _continuous_streaming;
     bool _is_setup;
+    bool _fast_restart  = false;
+    bool _restart_armed = false;
 };
 
 rx_vita_core_3000::sptr rx_vita_core_3000::make(wb_iface::sptr iface, const size_t base)
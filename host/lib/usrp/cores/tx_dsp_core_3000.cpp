@@ -9,6 +9,7 @@
 #include <uhd/types/dict.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhdlib/usrp/cores/batched_wb_iface.hpp>
 #include <uhdlib/usrp/cores/dsp_core_utils.hpp>
 #include <uhdlib/usrp/cores/tx_dsp_core_3000.hpp>
 #include <algorithm>
@@ -39,7 +40,7 @@ class tx_dsp_core_3000_impl : public tx_dsp_core_3000
 {
 public:
     tx_dsp_core_3000_impl(wb_iface::sptr iface, const size_t dsp_base)
-        : _iface(iface), _dsp_base(dsp_base)
+        : _iface(usrp::batched_wb_iface::make(iface)), _dsp_base(dsp_base)
     {
         this->set_tick_rate(1.0);
     }
@@ -73,6 +74,8 @@ public:
 
     double set_host_rate(const double rate) override
     {
+        // Release the interpolation and scalar writes as one transaction
+        usrp::batched_wb_iface::batch batch(_iface);
         const size_t interp_rate =
             std::lround(_tick_rate / this->get_host_rates().clip(rate, true));
         size_t interp = interp_rate;
@@ -197,7 +200,7 @@ public:
     }
 
 private:
-    wb_iface::sptr _iface;
+    usrp::batched_wb_iface::sptr _iface;
     const size_t _dsp_base;
     double _tick_rate              = 1.0;
     double _link_rate              = 0.0;
@@ -207,6 +207,25 @@ public:
         expert_factory::add_prop_node<std::string>(
             _expert, get_rx_subtree(), "id", prepend_ch("id", _ch_name), "twinrx");
 
+        // Fast hop plan. Writing a frequency list to hop_plan/freqs compiles
+        // each frequency through the expert chain once and records the
+        // resulting LO/CPLD programming in a table inside twinrx_ctrl.
+        // Writing an index to hop_plan/execute replays the precompiled
+        // programming for that entry without re-running expert resolution,
+        // honoring any command time set on the device.
+        get_rx_subtree()
+            ->create<std::vector<double>>("hop_plan/freqs")
+            .add_coerced_subscriber(
+                [this](const std::vector<double>& freqs) { compile_hop_plan(freqs); });
+        get_rx_subtree()->create<size_t>("hop_plan/size").set_publisher([this]() {
+            return _ctrl->get_hop_plan_size();
+        });
+        get_rx_subtree()
+            ->create<size_t>("hop_plan/execute")
+            .add_coerced_subscriber([this](const size_t index) {
+                _ctrl->execute_hop(index);
+            });
+
         // Readback
         get_rx_subtree()
             ->create<sensor_value_t>("sensors/lo_locked")
@@ -257,6 +276,36 @@ public:
 
     ~twinrx_rcvr_fe(void) override {}
 
+    void compile_hop_plan(const std::vector<double>& freqs)
+    {
+        _ctrl->erase_hop_plan();
+        if (freqs.empty()) {
+            return;
+        }
+        // Detune away from the first hop so that the first entry captures a
+        // complete LO programming sequence even if the board is already tuned
+        // to it. This also lets a plan that stays within one band be executed
+        // in a loop, since entry 0 then reprograms the synthesizers fully.
+        const meta_range_t freq_range =
+            get_rx_subtree()->access<meta_range_t>("freq/range").get();
+        const double detune_freq = (freqs.front() + 100e6 <= freq_range.stop())
+                                       ? freqs.front() + 100e6
+                                       : freqs.front() - 100e6;
+        get_rx_subtree()->access<double>("freq/value").set(detune_freq);
+
+        try {
+            for (const double freq : freqs) {
+                _ctrl->start_hop_capture();
+                get_rx_subtree()->access<double>("freq/value").set(freq);
+                _ctrl->commit_hop_capture();
+            }
+        } catch (...) {
+            // Do not leave a partially compiled plan (or a dangling capture)
+            _ctrl->erase_hop_plan();
+            throw;
+        }
+    }
+
     sensor_value_t get_lo_locked()
     {
         bool locked               = true;
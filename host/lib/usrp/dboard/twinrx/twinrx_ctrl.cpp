@@ -16,6 +16,7 @@
 #include <chrono>
 #include <cmath>
 #include <thread>
+#include <vector>
 
 using namespace uhd;
 using namespace usrp;
@@ -120,18 +121,14 @@ public:
                     [this](const std::vector<uint32_t>& regs) {
                         _write_lo_spi(dboard_iface::UNIT_TX, regs);
                     },
-                    [this](uint32_t microseconds) {
-                        _db_iface->sleep(std::chrono::microseconds(microseconds));
-                    });
+                    [this](uint32_t microseconds) { _wait_lo_spi(microseconds); });
                 _lo1_pfd_freq = TWINRX_REV_C_PFD_FREQ;
             } else {
                 _lo1_iface[i] = adf535x_iface::make_adf5355(
                     [this](const std::vector<uint32_t>& regs) {
                         _write_lo_spi(dboard_iface::UNIT_TX, regs);
                     },
-                    [this](uint32_t microseconds) {
-                        _db_iface->sleep(std::chrono::microseconds(microseconds));
-                    });
+                    [this](uint32_t microseconds) { _wait_lo_spi(microseconds); });
                 _lo1_pfd_freq = TWINRX_REV_AB_PFD_FREQ;
             }
             _lo1_iface[i]->set_pfd_freq(_lo1_pfd_freq);
@@ -686,6 +683,80 @@ public:
         return locked;
     }
 
+    void erase_hop_plan() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_capturing) {
+            _gpio_iface->set_poke_observer(nullptr);
+            _capturing = false;
+        }
+        _capture_ops.clear();
+        _hop_plan.clear();
+    }
+
+    void start_hop_capture() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_capturing) {
+            throw uhd::runtime_error("twinrx: hop capture already in progress");
+        }
+        // Flush any pending state so the entry only records this hop's writes
+        _commit();
+        _capture_ops.clear();
+        _capturing = true;
+        _gpio_iface->set_poke_observer([this](uint32_t addr, uint32_t data) {
+            _capture_ops.push_back(
+                {hop_op_t::CPLD_POKE, dboard_iface::UNIT_RX, addr, data});
+        });
+    }
+
+    size_t commit_hop_capture() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (not _capturing) {
+            throw uhd::runtime_error("twinrx: no hop capture in progress");
+        }
+        _gpio_iface->set_poke_observer(nullptr);
+        _capturing = false;
+        _hop_plan.push_back(std::move(_capture_ops));
+        _capture_ops.clear();
+        return _hop_plan.size() - 1;
+    }
+
+    size_t get_hop_plan_size() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _hop_plan.size();
+    }
+
+    void execute_hop(size_t index) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_capturing) {
+            throw uhd::runtime_error("twinrx: cannot execute hops while capturing");
+        }
+        if (index >= _hop_plan.size()) {
+            throw uhd::index_error(
+                str(boost::format("twinrx: hop index %d out of range (plan has %d "
+                                  "entries)")
+                    % index % _hop_plan.size()));
+        }
+        for (const hop_op_t& op : _hop_plan[index]) {
+            switch (op.op) {
+                case hop_op_t::CPLD_POKE:
+                    _gpio_iface->poke32(
+                        static_cast<wb_iface::wb_addr_type>(op.addr), op.data);
+                    break;
+                case hop_op_t::LO_SPI:
+                    _db_iface->write_spi(op.unit, _spi_config, op.data, 32);
+                    break;
+                case hop_op_t::WAIT:
+                    _db_iface->sleep(std::chrono::microseconds(op.data));
+                    break;
+            }
+        }
+    }
+
 private: // Functions
     void _set_cal_mode(cal_mode_t cal_mode, lo_export_source_t lo1_export_src)
     {
@@ -720,21 +791,48 @@ private: // Functions
             bool2bin(lo == LO1 and (channel == CH1 or channel == BOTH)));
         _cpld_regs->rf0_reg2.set(rm::rf0_reg2_t::LO1_LE_CH2,
             bool2bin(lo == LO1 and (channel == CH2 or channel == BOTH)));
-        _cpld_regs->rf0_reg2.flush();
+        _flush_lo_route_reg(_cpld_regs->rf0_reg2, cpld::addr(2, 2));
         _cpld_regs->if0_reg2.set(rm::if0_reg2_t::LO2_LE_CH1,
             bool2bin(lo == LO2 and (channel == CH1 or channel == BOTH)));
         _cpld_regs->if0_reg2.set(rm::if0_reg2_t::LO2_LE_CH2,
             bool2bin(lo == LO2 and (channel == CH2 or channel == BOTH)));
-        _cpld_regs->if0_reg2.flush();
+        _flush_lo_route_reg(_cpld_regs->if0_reg2, cpld::addr(1, 2));
+    }
+
+    template <typename reg_t>
+    void _flush_lo_route_reg(reg_t& reg, const wb_iface::wb_addr_type addr)
+    {
+        if (_capturing) {
+            // Poke unconditionally so that every captured hop entry carries
+            // its own LE routing, independent of the route left behind by the
+            // previously captured entry
+            _gpio_iface->poke32(addr, reg.get(reg_t::REGISTER));
+        } else {
+            reg.flush();
+        }
     }
 
     void _write_lo_spi(dboard_iface::unit_t unit, const std::vector<uint32_t>& regs)
     {
         for (uint32_t reg : regs) {
+            if (_capturing) {
+                _capture_ops.push_back({hop_op_t::LO_SPI, unit, 0, reg});
+            }
             _db_iface->write_spi(unit, _spi_config, reg, 32);
         }
     }
 
+    void _wait_lo_spi(uint32_t microseconds)
+    {
+        if (_capturing) {
+            // Record synthesizer settling waits so that a replayed hop has the
+            // same timing as the original programming sequence
+            _capture_ops.push_back(
+                {hop_op_t::WAIT, dboard_iface::UNIT_RX, 0, microseconds});
+        }
+        _db_iface->sleep(std::chrono::microseconds(microseconds));
+    }
+
     void _commit()
     {
         // Commit everything except the LO synthesizers
@@ -836,6 +934,15 @@ private: // Functions
 private: // Members
     static const size_t NUM_CHANS = 2;
 
+    //! A single recorded hardware write belonging to a fast-hop entry
+    struct hop_op_t
+    {
+        enum op_type_t { CPLD_POKE, LO_SPI, WAIT } op;
+        dboard_iface::unit_t unit; // LO_SPI only
+        uint32_t addr; // CPLD_POKE only
+        uint32_t data; // register word, or wait duration in microseconds
+    };
+
     struct tune_freq_t : public uhd::math::fp_compare::fp_compare_delta<double>
     {
         tune_freq_t()
@@ -868,6 +975,9 @@ private: // Members
     lo_export_source_t _lo1_export;
     lo_export_source_t _lo2_export;
     bool _chan_enabled[NUM_CHANS];
+    bool _capturing = false;
+    std::vector<hop_op_t> _capture_ops;
+    std::vector<std::vector<hop_op_t>> _hop_plan;
 };
 
 twinrx_ctrl::sptr twinrx_ctrl::make(dboard_iface::sptr db_iface,
@@ -104,6 +104,40 @@ public:
     virtual bool read_lo1_locked(channel_t ch) = 0;
 
     virtual bool read_lo2_locked(channel_t ch) = 0;
+
+    /**************************************************************************
+     * Fast-hop plan API
+     *
+     * A hop plan is a table of precompiled hardware programming sequences.
+     * While a capture is active, every CPLD register poke, LO SPI word and
+     * synthesizer settling wait produced by the regular tune path is recorded
+     * (in addition to being written to hardware) and stored as one hop entry.
+     * execute_hop() replays an entry verbatim through the dboard interface,
+     * bypassing expert resolution and all software register caching, which
+     * makes it suitable for timed command sequences at high hop rates.
+     *
+     * Entries record the programming delta produced while compiling that hop,
+     * so a plan must be executed in the order it was compiled. After executing
+     * hops, the software register caches no longer reflect hardware state; the
+     * frontend must be retuned through the regular tune path to a frequency
+     * outside the plan before resuming normal operation.
+     *************************************************************************/
+
+    //! Discard the precompiled hop plan and abort any capture in progress
+    virtual void erase_hop_plan() = 0;
+
+    //! Start recording hardware programming for the next hop entry
+    virtual void start_hop_capture() = 0;
+
+    //! Stop recording and append the captured entry to the plan. Returns the
+    //! index of the new entry.
+    virtual size_t commit_hop_capture() = 0;
+
+    //! Number of entries in the precompiled hop plan
+    virtual size_t get_hop_plan_size() = 0;
+
+    //! Replay the programming sequence of the given hop entry
+    virtual void execute_hop(size_t index) = 0;
 };
 
 }}}} // namespace uhd::usrp::dboard::twinrx
@@ -13,6 +13,7 @@
 #include <uhd/utils/soft_register.hpp>
 #include <uhdlib/usrp/cores/gpio_atr_3000.hpp>
 #include <chrono>
+#include <functional>
 
 namespace uhd { namespace usrp { namespace dboard { namespace twinrx {
 
@@ -110,12 +111,29 @@ public:
                >> shift(field);
     }
 
+    /*! Observe all CPLD register writes.
+     *
+     * The observer is called for every poke32 in addition to (not instead of)
+     * the hardware write. Used by the fast-hop capture logic in twinrx_ctrl
+     * to record the exact register traffic of a tune. Pass an empty function
+     * to stop observing.
+     */
+    void set_poke_observer(std::function<void(uint32_t, uint32_t)> observer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _poke_observer = observer;
+    }
+
     // CPLD register write-only interface
     void poke32(const wb_addr_type addr, const uint32_t data) override
     {
         std::lock_guard<std::mutex> lock(_mutex);
         using namespace soft_reg_field;
 
+        if (_poke_observer) {
+            _poke_observer(static_cast<uint32_t>(addr), data);
+        }
+
         // Step 1: Write the reg offset and data to the GPIO bus and de-assert all enables
         _db_iface->set_gpio_out(dboard_iface::UNIT_BOTH,
             (cpld::get_reg(addr) << shift(CPLD_FULL_ADDR)) | (data << shift(CPLD_DATA)),
@@ -141,6 +159,7 @@ private: // Members/definitions
     // Members
     dboard_iface::sptr _db_iface;
     std::mutex _mutex;
+    std::function<void(uint32_t, uint32_t)> _poke_observer;
 };
 
 class twinrx_cpld_regmap : public uhd::soft_regmap_t
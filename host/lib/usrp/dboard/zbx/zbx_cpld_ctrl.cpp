@@ -9,6 +9,7 @@
 #include <chrono>
 #include <map>
 #include <thread>
+#include <vector>
 
 namespace {
 //! The time we need to wait after sending a SPI command
@@ -57,10 +58,34 @@ const std::unordered_map<std::string, zbx_cpld_ctrl::dsa_type> zbx_cpld_ctrl::ds
     {ZBX_GAIN_STAGE_DSA3B, zbx_cpld_ctrl::dsa_type::DSA3B}};
 
 zbx_cpld_ctrl::zbx_cpld_ctrl(poke_fn_type&& poke_fn,
+    peek_fn_type&& peek_fn,
+    sleep_fn_type&& sleep_fn,
+    const std::string& log_id)
+    : zbx_cpld_ctrl(
+          std::move(poke_fn),
+          // No block-write function provided: fall back to one poke per
+          // register
+          [this](const uint32_t first_addr,
+              const std::vector<uint32_t>& data,
+              const chan_t chan) {
+              for (size_t i = 0; i < data.size(); i++) {
+                  _poke32(first_addr + i * 4, data[i], chan);
+              }
+          },
+          std::move(peek_fn),
+          std::move(sleep_fn),
+          log_id)
+{
+    // nop
+}
+
+zbx_cpld_ctrl::zbx_cpld_ctrl(poke_fn_type&& poke_fn,
+    block_poke_fn_type&& block_poke_fn,
     peek_fn_type&& peek_fn,
     sleep_fn_type&& sleep_fn,
     const std::string& log_id)
     : _poke32(std::move(poke_fn))
+    , _block_poke32(std::move(block_poke_fn))
     , _peek32(std::move(peek_fn))
     , _sleep(std::move(sleep_fn))
     , _lo_spi_offset(_regs.get_addr("SPI_READY"))
@@ -655,6 +680,17 @@ void zbx_cpld_ctrl::lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint1
     // to throttle.
 }
 
+void zbx_cpld_ctrl::lo_poke16_seq(
+    const zbx_lo_t lo, const std::vector<std::pair<uint8_t, uint16_t>>& writes)
+{
+    // Same per-register poke-plus-throttle path as lo_poke16(); the CPLD's
+    // SPI engine takes one transaction at a time, so there is nothing to
+    // coalesce here. See the header for why this is a separate entry point.
+    for (const auto& write : writes) {
+        _lo_spi_transact(lo, write.first, write.second, spi_xact_t::WRITE, true);
+    }
+}
+
 uint16_t zbx_cpld_ctrl::lo_peek16(const zbx_lo_t lo, const uint8_t addr)
 {
     _lo_spi_transact(lo, addr, 0, spi_xact_t::READ, true);
@@ -902,8 +938,31 @@ void zbx_cpld_ctrl::commit(const chan_t chan, const bool save_all)
                                   << " to CPLD...");
     const auto changed_addrs = save_all ? _regs.get_all_addrs<size_t>()
                                         : _regs.get_changed_addrs<size_t>();
-    for (const auto addr : changed_addrs) {
-        _poke32(addr, _regs.get_reg(addr), save_all ? NO_CHAN : chan);
+    // Merge runs of contiguous addresses into block writes, so that a large
+    // update (e.g., a band change touching dozens of registers) costs a
+    // handful of control transactions instead of one per register. The
+    // addresses come out of a std::set, so they are already sorted.
+    const std::vector<size_t> sorted_addrs(changed_addrs.cbegin(), changed_addrs.cend());
+    const chan_t poke_chan = save_all ? NO_CHAN : chan;
+    size_t run_start       = 0;
+    while (run_start < sorted_addrs.size()) {
+        size_t run_end = run_start + 1;
+        while (run_end < sorted_addrs.size()
+               && sorted_addrs[run_end] == sorted_addrs[run_end - 1] + 4) {
+            run_end++;
+        }
+        if (run_end - run_start == 1) {
+            const size_t addr = sorted_addrs[run_start];
+            _poke32(addr, _regs.get_reg(addr), poke_chan);
+        } else {
+            std::vector<uint32_t> data;
+            data.reserve(run_end - run_start);
+            for (size_t i = run_start; i < run_end; i++) {
+                data.push_back(_regs.get_reg(sorted_addrs[i]));
+            }
+            _block_poke32(sorted_addrs[run_start], data, poke_chan);
+        }
+        run_start = run_end;
     }
     _regs.save_state();
     UHD_LOG_TRACE(_log_id,
@@ -85,6 +85,14 @@ void zbx_dboard_impl::_init_cpld()
                                                                     : _time_accessor(0);
             _regs.poke32(_reg_base_address + addr, data, time_spec);
         },
+        [this](const uint32_t first_addr,
+            const std::vector<uint32_t>& data,
+            const zbx_cpld_ctrl::chan_t chan) {
+            const auto time_spec = (chan == zbx_cpld_ctrl::NO_CHAN) ? time_spec_t::ASAP
+                                   : (chan == zbx_cpld_ctrl::CHAN1) ? _time_accessor(1)
+                                                                    : _time_accessor(0);
+            _regs.block_poke32(_reg_base_address + first_addr, data, time_spec);
+        },
         [this](const uint32_t addr) {
             // We don't do timed peeks, so no chan parameter here.
             return _regs.peek32(_reg_base_address + addr);
@@ -360,6 +368,9 @@ void zbx_dboard_impl::_init_experts(uhd::property_tree::sptr subtree,
                 [this, lo](const uint32_t addr, const uint16_t data) {
                     _cpld->lo_poke16(lo, addr, data);
                 },
+                [this, lo](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+                    _cpld->lo_poke16_seq(lo, writes);
+                },
                 [this, lo](const uint32_t addr) { return _cpld->lo_peek16(lo, addr); },
                 [this](const uhd::time_spec_t& sleep_time) { _regs.sleep(sleep_time); },
                 LMX2572_DEFAULT_FREQ,
@@ -13,6 +13,7 @@ namespace uhd { namespace usrp { namespace zbx {
 
 zbx_lo_ctrl::zbx_lo_ctrl(zbx_lo_t lo,
     lmx2572_iface::write_fn_t&& poke16,
+    lmx2572_iface::write_seq_fn_t&& poke16_seq,
     lmx2572_iface::read_fn_t&& peek16,
     lmx2572_iface::sleep_fn_t&& sleep,
     const double default_frequency,
@@ -23,7 +24,8 @@ zbx_lo_ctrl::zbx_lo_ctrl(zbx_lo_t lo,
     , _db_prc_rate(db_prc_rate)
     , _testing_mode_enabled(testing_mode_enabled)
 {
-    _lmx = lmx2572_iface::make(std::move(poke16), std::move(peek16), std::move(sleep));
+    _lmx = lmx2572_iface::make(
+        std::move(poke16), std::move(poke16_seq), std::move(peek16), std::move(sleep));
     UHD_ASSERT_THROW(_lmx);
     UHD_LOG_TRACE(_log_id, "LO initialized...");
     _lmx->reset();
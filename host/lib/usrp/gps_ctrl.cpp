@@ -9,7 +9,9 @@
 #include <uhd/types/sensors.hpp>
 #include <uhd/usrp/gps_ctrl.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/tasks.hpp>
 #include <stdint.h>
+#include <atomic>
 #include <boost/algorithm/string.hpp>
 #include <boost/date_time.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -35,6 +37,7 @@ constexpr int GPS_SERVO_FRESHNESS       = 1000;
 constexpr int GPS_LOCK_FRESHNESS        = 2500;
 constexpr int GPS_TIMEOUT_DELAY_MS      = 200;
 constexpr int GPSDO_COMMAND_DELAY_MS    = 200;
+constexpr int GPS_POLL_INTERVAL_MS      = 100;
 } // namespace
 
 /*!
@@ -63,6 +66,23 @@ private:
         boost::system_time exit_time = now + milliseconds(timeout);
         boost::posix_time::time_duration age;
 
+        if (_polling_enabled) {
+            // The background task keeps the cache fresh, so this becomes a
+            // pure cache lookup: Either a recent enough sentence is available,
+            // or we fail right away instead of stalling the caller on serial
+            // I/O. Note that wait_for_next is ignored here -- waiting for the
+            // next sentence defeats the purpose of this mode.
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            if (sentences.find(which) != sentences.end()) {
+                age = boost::get_system_time() - std::get<1>(sentences[which]);
+                if (age < milliseconds(max_age_ms)) {
+                    std::get<2>(sentences[which]) = true;
+                    return std::get<0>(sentences[which]);
+                }
+            }
+            throw uhd::value_error("gps ctrl: No " + which + " message found");
+        }
+
         if (wait_for_next) {
             std::lock_guard<std::mutex> lock(cache_mutex);
             update_cache();
@@ -251,7 +271,8 @@ public:
 
     ~gps_ctrl_impl(void) override
     {
-        /* NOP */
+        // Stop the polling task before the UART goes away
+        _poll_task.reset();
     }
 
     // return a list of supported sensors
@@ -285,6 +306,26 @@ public:
         }
     }
 
+    void set_background_polling(const bool enable) override
+    {
+        if (enable and not _poll_task and gps_detected()) {
+            _poll_task = uhd::task::make(
+                [this] {
+                    {
+                        std::lock_guard<std::mutex> lock(cache_mutex);
+                        update_cache();
+                    }
+                    std::this_thread::sleep_for(
+                        std::chrono::milliseconds(GPS_POLL_INTERVAL_MS));
+                },
+                "gps_ctrl_poll");
+            _polling_enabled = true;
+        } else if (not enable) {
+            _polling_enabled = false;
+            _poll_task.reset();
+        }
+    }
+
 private:
     void init_gpsdo(void)
     {
@@ -413,6 +454,12 @@ private:
     }
 
     enum { GPS_TYPE_INTERNAL_GPSDO, GPS_TYPE_GENERIC_NMEA, GPS_TYPE_NONE } _gps_type;
+
+    //! True if sensor getters read the cache without touching the UART
+    std::atomic<bool> _polling_enabled{false};
+
+    //! Continuously updates the sentence cache when background polling is on
+    uhd::task::sptr _poll_task;
 };
 
 /***********************************************************************
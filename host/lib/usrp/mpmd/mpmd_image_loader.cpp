@@ -25,6 +25,7 @@
 #include <boost/property_tree/xml_parser.hpp>
 #include <cctype>
 #include <fstream>
+#include <future>
 #include <iterator>
 #include <string>
 #include <vector>
@@ -351,6 +352,28 @@ static void mpmd_send_fpga_to_device(
     UHD_LOG_INFO("MPMD IMAGE LOADER", "Update component function succeeded.");
 }
 
+/*
+ * Update a single device and fire the FPGA load notification
+ */
+static void mpmd_update_device(
+    const image_loader::image_loader_args_t& image_loader_args, device_addr_t dev_addr)
+{
+    mpmd_send_fpga_to_device(image_loader_args, dev_addr);
+
+    {
+        // All MPM devices use RFNoC
+        auto graph = rfnoc::rfnoc_graph::make(dev_addr);
+        for (size_t mb_index = 0; mb_index < graph->get_num_mboards(); mb_index++) {
+            auto mboard = graph->get_mb_controller(mb_index);
+            if (mboard->has_feature<uhd::features::fpga_load_notification_iface>()) {
+                auto& notifier =
+                    mboard->get_feature<uhd::features::fpga_load_notification_iface>();
+                notifier.onload();
+            }
+        }
+    }
+}
+
 /*
  * Function to be registered with uhd_image_loader
  */
@@ -361,34 +384,47 @@ static bool mpmd_image_loader(const image_loader::image_loader_args_t& image_loa
     find_hint.set("find_all", "1"); // We need to find all devices
     device_addrs_t devs = mpmd_find(find_hint);
 
-    if (devs.size() > 1) {
-        UHD_LOG_ERROR(
-            "MPMD IMAGE LOADER", "mpmd_image_loader only supports a single device.");
-        return false;
-    } else if (devs.empty()) {
+    if (devs.empty()) {
         UHD_LOG_ERROR(
             "MPMD IMAGE LOADER", "No MPM devices found for the specified arguments.");
         return false;
     }
-    // Grab the first device_addr
-    device_addr_t dev_addr(devs[0]);
+    if (devs.size() > 1 and not image_loader_args.args.has_key("update_all")) {
+        UHD_LOG_ERROR("MPMD IMAGE LOADER",
+            "Multiple MPM devices found. Narrow down the device args, or pass "
+            "update_all to update all of them concurrently.");
+        return false;
+    }
 
-    mpmd_send_fpga_to_device(image_loader_args, dev_addr);
+    if (devs.size() == 1) {
+        mpmd_update_device(image_loader_args, devs[0]);
+        return true;
+    }
 
-    {
-        // All MPM devices use RFNoC
-        auto graph = rfnoc::rfnoc_graph::make(find_hint);
-        for (size_t mb_index = 0; mb_index < graph->get_num_mboards(); mb_index++) {
-            auto mboard = graph->get_mb_controller(mb_index);
-            if (mboard->has_feature<uhd::features::fpga_load_notification_iface>()) {
-                auto& notifier =
-                    mboard->get_feature<uhd::features::fpga_load_notification_iface>();
-                notifier.onload();
-            }
+    // Concurrent multi-device mode: The update time is dominated by the
+    // device-side flash programming, so updating all devices in parallel
+    // takes roughly as long as updating one.
+    UHD_LOG_INFO(
+        "MPMD IMAGE LOADER", "Updating " << devs.size() << " devices concurrently.");
+    std::vector<std::future<void>> update_tasks;
+    update_tasks.reserve(devs.size());
+    for (const auto& dev_addr : devs) {
+        update_tasks.push_back(std::async(std::launch::async,
+            [image_loader_args, dev_addr]() {
+                mpmd_update_device(image_loader_args, dev_addr);
+            }));
+    }
+    bool all_succeeded = true;
+    for (size_t i = 0; i < update_tasks.size(); i++) {
+        try {
+            update_tasks[i].get();
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR("MPMD IMAGE LOADER",
+                "Failed to update device " << devs[i].to_string() << ": " << ex.what());
+            all_succeeded = false;
         }
     }
-
-    return true;
+    return all_succeeded;
 }
 
 }} // namespace uhd
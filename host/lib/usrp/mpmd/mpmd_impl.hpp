@@ -143,6 +143,14 @@ private:
     /*! Reference to the RPC client that handles claiming
      */
     uhd::rpc_client::sptr _claim_rpc;
+
+    /*! Reference to the RPC client that handles log buffer readback
+     *
+     * Reading the log buffer can take a while when MPM is chatty, so it gets
+     * its own connection to keep it from delaying reclaim calls or foreground
+     * RPC calls.
+     */
+    uhd::rpc_client::sptr _log_rpc;
     /*************************************************************************
      * Private methods
      ************************************************************************/
@@ -161,9 +169,11 @@ private:
 
     uhd::task::sptr make_claim_loop_task();
 
+    uhd::task::sptr make_log_loop_task();
+
     uhd::task::sptr claim_device_and_make_task();
 
-    //! Reset the _claim_rpc and _claimer_task
+    //! Reset the _claim_rpc/_log_rpc clients and their tasks
     void reset_claim_loop();
 
     /*! Read out the log buffer from the MPM device and send it to native
@@ -178,6 +188,10 @@ private:
      */
     uhd::task::sptr _claimer_task;
 
+    /*! Continuously forwards the MPM log buffer to the UHD logging system.
+     */
+    uhd::task::sptr _log_task;
+
     /*! A copy of the device access token
      */
     std::string _token;
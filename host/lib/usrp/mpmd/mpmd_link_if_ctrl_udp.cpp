@@ -12,15 +12,27 @@
 #include <uhd/transport/udp_constants.hpp>
 #include <uhd/transport/udp_simple.hpp>
 #include <uhd/utils/cast.hpp>
+#include <uhd/utils/paths.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/usrp/common/parallel_fan_out.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <string>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_LIBURING
+#    include <uhdlib/transport/udp_iouring_link.hpp>
+#endif
+#ifdef HAVE_LIBXDP
+#    include <uhdlib/transport/udp_afxdp_link.hpp>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -50,6 +62,12 @@ const double MPMD_BUFFER_DEPTH = 20.0e-3; // s
 //! For MTU discovery, the time we wait for a packet before calling it
 // oversized (seconds).
 const double MPMD_MTU_DISCOVERY_TIMEOUT = 0.02;
+//! Default time-to-live for cached MTU discovery results (seconds). The
+// binary search costs the better part of a second per link on routed
+// networks, so repeated sessions reuse the previous result until the entry
+// goes stale. Override with the `mtu_cache_ttl` device arg (0 disables
+// caching).
+const double MPMD_MTU_CACHE_DEFAULT_TTL = 24 * 60 * 60;
 
 // TODO: move these to appropriate header file for all other devices
 const size_t MAX_RATE_1GIGE  = 1e9 / 8; // byte/s
@@ -178,6 +196,60 @@ size_t run_mtu_plausibility_check(const size_t detected_mtu)
     return detected_mtu;
 }
 
+/*! File-backed cache of discovered path MTUs
+ *
+ * Keyed by the device address; the routed host interface is implied by the
+ * destination. Entries carry the discovery timestamp so they can be
+ * revalidated after a TTL. The cache lives in the temp path: losing it only
+ * costs one re-probe, and a reboot (which may change the routing anyway)
+ * starts fresh. All failures to read or write the cache are non-fatal and
+ * fall back to a regular probe.
+ */
+std::mutex mtu_cache_mutex;
+
+std::string get_mtu_cache_path()
+{
+    return uhd::get_tmp_path() + "/uhd_mtu_cache.txt";
+}
+
+//! Load the cache, pruning entries older than \p ttl seconds
+std::map<std::string, std::pair<size_t, uint64_t>> load_mtu_cache(const double ttl)
+{
+    std::map<std::string, std::pair<size_t, uint64_t>> cache;
+    std::lock_guard<std::mutex> lock(mtu_cache_mutex);
+    std::ifstream file(get_mtu_cache_path());
+    if (!file) {
+        return cache;
+    }
+    const uint64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+    std::string address;
+    size_t mtu;
+    uint64_t timestamp;
+    while (file >> address >> mtu >> timestamp) {
+        if (timestamp > now or (now - timestamp) > ttl) {
+            continue; // stale (or clock went backwards): re-probe
+        }
+        cache[address] = {mtu, timestamp};
+    }
+    return cache;
+}
+
+void store_mtu_cache(const std::map<std::string, std::pair<size_t, uint64_t>>& cache)
+{
+    std::lock_guard<std::mutex> lock(mtu_cache_mutex);
+    std::ofstream file(get_mtu_cache_path(), std::ios::trunc);
+    if (!file) {
+        UHD_LOG_TRACE("MPMD", "Could not write MTU cache: " << get_mtu_cache_path());
+        return;
+    }
+    for (const auto& entry : cache) {
+        file << entry.first << ' ' << entry.second.first << ' ' << entry.second.second
+             << '\n';
+    }
+}
+
 /*! Do a binary search to discover MTU
  *
  * Uses the MPM echo service to figure out MTU. We simply send a bunch of
@@ -309,29 +381,76 @@ mpmd_link_if_ctrl_udp::mpmd_link_if_ctrl_udp(const uhd::device_addr_t& mb_args,
 
     const std::vector<std::string> requested_addrs(
         get_addrs_from_mb_args(mb_args, _udp_info));
-    for (const auto& ip_addr : requested_addrs) {
-        try {
-            // If MTU discovery fails, we gracefully recover, but declare that
-            // link invalid.
-            auto& info = _udp_info.at(ip_addr);
-            if (info.link_type == "internal") {
-                UHD_LOG_TRACE("MPMD::XPORT::UDP",
-                    "MTU for internal interface " << ip_addr << " is "
-                                                  << std::to_string(info.if_mtu));
-                _mtu = std::min(_mtu, info.if_mtu);
-            } else {
-                _mtu = std::min(_mtu,
-                    discover_mtu_for_ip(ip_addr,
-                        info.link_rate == MAX_RATE_1GIGE
-                            ? MPMD_1GE_DATA_FRAME_MAX_SIZE
-                            : MPMD_10GE_DATA_FRAME_MAX_SIZE));
+
+    // Look up previously discovered MTUs so repeated sessions skip the
+    // binary-search probe entirely until the entries go stale
+    const double mtu_cache_ttl =
+        mb_args.cast<double>("mtu_cache_ttl", MPMD_MTU_CACHE_DEFAULT_TTL);
+    auto mtu_cache = (mtu_cache_ttl > 0.0)
+                         ? load_mtu_cache(mtu_cache_ttl)
+                         : std::map<std::string, std::pair<size_t, uint64_t>>();
+
+    // Probe all links in parallel: the probes are dominated by timed-out
+    // datagrams, so running them concurrently costs one link's probe time
+    // instead of one per link. An entry of 0 means discovery failed; we
+    // gracefully recover, but declare that link invalid.
+    std::vector<size_t> discovered_mtus(requested_addrs.size(), 0);
+    // Deliberately not vector<bool>: its elements are bit-packed, so
+    // concurrent writes to distinct indices from the fan-out workers would
+    // race on the shared bytes
+    std::vector<char> from_cache(requested_addrs.size(), 0);
+    uhd::usrp::parallel_fan_out(
+        requested_addrs.size(),
+        [&](const size_t idx) {
+            const std::string& ip_addr = requested_addrs[idx];
+            try {
+                auto& info = _udp_info.at(ip_addr);
+                if (info.link_type == "internal") {
+                    UHD_LOG_TRACE("MPMD::XPORT::UDP",
+                        "MTU for internal interface "
+                            << ip_addr << " is " << std::to_string(info.if_mtu));
+                    discovered_mtus[idx] = info.if_mtu;
+                    from_cache[idx]      = 1; // nothing to re-store
+                    return;
+                }
+                const auto cache_it = mtu_cache.find(ip_addr);
+                if (cache_it != mtu_cache.end()) {
+                    UHD_LOG_DEBUG("MPMD",
+                        "Using cached path MTU for address "
+                            << ip_addr << ": " << cache_it->second.first);
+                    discovered_mtus[idx] = cache_it->second.first;
+                    from_cache[idx]      = 1;
+                    return;
+                }
+                discovered_mtus[idx] = discover_mtu_for_ip(ip_addr,
+                    info.link_rate == MAX_RATE_1GIGE ? MPMD_1GE_DATA_FRAME_MAX_SIZE
+                                                     : MPMD_10GE_DATA_FRAME_MAX_SIZE);
+            } catch (const uhd::exception& ex) {
+                UHD_LOG_WARNING("MPMD::XPORT::UDP",
+                    "Error during MTU discovery on address " << ip_addr << ": "
+                                                             << ex.what());
             }
-            _available_addrs.push_back(ip_addr);
-        } catch (const uhd::exception& ex) {
-            UHD_LOG_WARNING("MPMD::XPORT::UDP",
-                "Error during MTU discovery on address " << ip_addr << ": " << ex.what());
+        },
+        "link");
+
+    bool cache_dirty = false;
+    const uint64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+    for (size_t idx = 0; idx < requested_addrs.size(); idx++) {
+        if (discovered_mtus[idx] == 0) {
+            continue;
+        }
+        _mtu = std::min(_mtu, discovered_mtus[idx]);
+        _available_addrs.push_back(requested_addrs[idx]);
+        if (mtu_cache_ttl > 0.0 and not from_cache[idx]) {
+            mtu_cache[requested_addrs[idx]] = {discovered_mtus[idx], now};
+            cache_dirty                     = true;
         }
     }
+    if (cache_dirty) {
+        store_mtu_cache(mtu_cache);
+    }
 }
 
 /******************************************************************************
@@ -399,11 +518,95 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
         UHD_LOG_WARNING("MPMD", "Cannot create DPDK transport, falling back to UDP");
 #endif
     }
+#ifdef UHD_PLATFORM_LINUX
+    // Program NIC flow steering so that each stream's flow lands on its own
+    // RX queue instead of RSS hashing multiple streams onto the same one
+    const bool rx_flow_steering = uhd::cast::from_str<bool>(
+        link_args.get("rx_flow_steering", _mb_args.get("rx_flow_steering", "0")));
+    auto steer_rx_flow = [&](const uint16_t local_port) {
+        if (!rx_flow_steering) {
+            return;
+        }
+        const uint32_t queue = uhd::narrow_cast<uint32_t>(link_idx);
+        if (uhd::transport::program_udp_flow_steering(ip_addr, local_port, queue)) {
+            UHD_LOG_DEBUG("MPMD",
+                "Steered RX flow for " << ip_addr << " (local port " << local_port
+                                       << ") to NIC queue " << queue);
+        } else {
+            UHD_LOG_WARNING("MPMD",
+                "Failed to program RX flow steering for "
+                    << ip_addr
+                    << ". This requires CAP_NET_ADMIN and a NIC with ntuple "
+                       "filter support; falling back to default RSS hashing.");
+        }
+    };
+#endif
+#ifdef HAVE_LIBURING
+    const std::string transport_arg =
+        link_args.get("transport", _mb_args.get("transport", ""));
+    if (transport_arg == "io_uring") {
+        auto link = uhd::transport::udp_iouring_link::make(ip_addr,
+            udp_port,
+            link_params,
+            link_params.recv_buff_size,
+            link_params.send_buff_size);
+        steer_rx_flow(link->get_local_port());
+        return std::make_tuple(link,
+            link_params.send_buff_size,
+            link,
+            link_params.recv_buff_size,
+            lossy_xport,
+            false,
+            enable_fc);
+    }
+#endif
+#ifdef HAVE_LIBXDP
+    if (_mb_args.has_key("use_xdp")) {
+        // One frame per UMEM chunk, so frames are capped below the MTU-based
+        // defaults used by the other backends
+        if (link_params.recv_frame_size > udp_afxdp_link::MAX_FRAME_SIZE
+            || link_params.send_frame_size > udp_afxdp_link::MAX_FRAME_SIZE) {
+            UHD_LOG_WARNING("MPMD",
+                "AF_XDP transport caps frame sizes at "
+                    << udp_afxdp_link::MAX_FRAME_SIZE << " bytes; clamping.");
+            link_params.recv_frame_size = std::min(
+                link_params.recv_frame_size, udp_afxdp_link::MAX_FRAME_SIZE);
+            link_params.send_frame_size = std::min(
+                link_params.send_frame_size, udp_afxdp_link::MAX_FRAME_SIZE);
+        }
+        // Each link gets its own NIC queue; the flow must be steered there
+        // or the stream's packets never reach the XDP socket
+        const uint32_t queue = uhd::narrow_cast<uint32_t>(link_idx);
+        auto link =
+            uhd::transport::udp_afxdp_link::make(ip_addr, udp_port, queue, link_params);
+        if (!uhd::transport::program_udp_flow_steering(
+                ip_addr, link->get_local_port(), queue)) {
+            UHD_LOG_WARNING("MPMD",
+                "Failed to steer RX flow for "
+                    << ip_addr << " to NIC queue " << queue
+                    << "; the AF_XDP transport will not receive data unless the "
+                       "rule is programmed manually (via ethtool --config-ntuple).");
+        }
+        return std::make_tuple(link,
+            link_params.send_buff_size,
+            link,
+            link_params.recv_buff_size,
+            lossy_xport,
+            false,
+            enable_fc);
+    }
+#endif
+    const bool recv_batching = uhd::cast::from_str<bool>(
+        link_args.get("udp_batching", _mb_args.get("udp_batching", "0")));
     auto link = uhd::transport::udp_boost_asio_link::make(ip_addr,
         udp_port,
         link_params,
         link_params.recv_buff_size,
-        link_params.send_buff_size);
+        link_params.send_buff_size,
+        recv_batching);
+#ifdef UHD_PLATFORM_LINUX
+    steer_rx_flow(link->get_local_port());
+#endif
     return std::make_tuple(link,
         link_params.send_buff_size,
         link,
@@ -152,6 +152,38 @@ mpmd_mb_controller::mpmd_mb_controller(
             std::make_shared<uhd::usrp::dio_rpc>(get_rpc_client()), _gpio_banks);
         register_feature(_gpio_power);
     }
+
+    // Optionally serve sensor reads from a background-refreshed cache so
+    // telemetry pollers never block on per-sensor RPC round trips
+    const size_t sensor_cache_ms =
+        _device_info.cast<size_t>("sensor_cache_ms", 0);
+    if (sensor_cache_ms > 0) {
+        _sensor_cache_staleness = std::chrono::milliseconds(sensor_cache_ms);
+        UHD_LOG_DEBUG("MPMD",
+            "Enabling background sensor cache with " << sensor_cache_ms
+                                                     << " ms refresh interval.");
+        _sensor_cache_task = uhd::task::make(
+            [this]() {
+                _refresh_sensor_cache();
+                std::unique_lock<std::mutex> lock(_sensor_cache_mutex);
+                _sensor_cache_cv.wait_for(lock, _sensor_cache_staleness, [this]() {
+                    return _sensor_cache_stop;
+                });
+            },
+            "mpmd_sensors");
+    }
+}
+
+mpmd_mb_controller::~mpmd_mb_controller()
+{
+    if (_sensor_cache_task) {
+        {
+            std::lock_guard<std::mutex> lock(_sensor_cache_mutex);
+            _sensor_cache_stop = true;
+        }
+        _sensor_cache_cv.notify_all();
+        _sensor_cache_task.reset();
+    }
 }
 
 /******************************************************************************
@@ -302,9 +334,77 @@ sensor_value_t mpmd_mb_controller::get_sensor(const std::string& name)
     if (!_sensor_names.count(name)) {
         throw uhd::key_error(std::string("Invalid motherboard sensor name: ") + name);
     }
+    if (_sensor_cache_staleness.count() > 0) {
+        std::lock_guard<std::mutex> lock(_sensor_cache_mutex);
+        auto it = _sensor_cache.find(name);
+        if (it != _sensor_cache.end()) {
+            return sensor_value_t(it->second);
+        }
+        // Cache not populated yet (first refresh pending): fall through to
+        // the blocking RPC
+    }
     return sensor_value_t(_rpc->get_mb_sensor(name));
 }
 
+std::map<std::string, sensor_value_t> mpmd_mb_controller::get_sensors()
+{
+    if (_sensor_cache_staleness.count() > 0) {
+        std::lock_guard<std::mutex> lock(_sensor_cache_mutex);
+        if (!_sensor_cache.empty()) {
+            std::map<std::string, sensor_value_t> sensors;
+            for (const auto& sensor : _sensor_cache) {
+                sensors.emplace(sensor.first, sensor_value_t(sensor.second));
+            }
+            return sensors;
+        }
+    }
+    if (_bulk_sensors_supported) {
+        try {
+            std::map<std::string, sensor_value_t> sensors;
+            for (const auto& sensor : _rpc->get_mb_sensors_bulk()) {
+                sensors.emplace(sensor.first, sensor_value_t(sensor.second));
+            }
+            return sensors;
+        } catch (const std::exception& ex) {
+            UHD_LOG_DEBUG("MPMD",
+                "Bulk sensor query not available (" << ex.what()
+                                                    << "), reading sensors "
+                                                       "individually.");
+            _bulk_sensors_supported = false;
+        }
+    }
+    return mb_controller::get_sensors();
+}
+
+void mpmd_mb_controller::_refresh_sensor_cache()
+{
+    std::map<std::string, sensor_value_t::sensor_map_t> sensors;
+    try {
+        if (_bulk_sensors_supported) {
+            try {
+                sensors = _rpc->get_mb_sensors_bulk();
+            } catch (const std::exception& ex) {
+                UHD_LOG_DEBUG("MPMD",
+                    "Bulk sensor query not available (" << ex.what()
+                                                        << "), reading sensors "
+                                                           "individually.");
+                _bulk_sensors_supported = false;
+            }
+        }
+        if (!_bulk_sensors_supported) {
+            for (const auto& name : _sensor_names) {
+                sensors.emplace(name, _rpc->get_mb_sensor(name));
+            }
+        }
+    } catch (const std::exception& ex) {
+        // Keep serving the previous readings; the next refresh retries
+        UHD_LOG_WARNING("MPMD", "Sensor cache refresh failed: " << ex.what());
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_sensor_cache_mutex);
+    _sensor_cache = std::move(sensors);
+}
+
 std::vector<std::string> mpmd_mb_controller::get_sensor_names()
 {
     std::vector<std::string> sensor_names(_sensor_names.cbegin(), _sensor_names.cend());
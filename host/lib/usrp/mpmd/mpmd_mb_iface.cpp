@@ -272,7 +272,7 @@ mpmd_mboard_impl::mpmd_mb_iface::make_rx_data_transport(
         packet_fc ? static_cast<uint32_t>(recv_link->get_num_recv_frames())
                   : uhd::rfnoc::MAX_FC_CAPACITY_PKTS};
 
-    const double ratio = 1.0 / 32;
+    const double ratio = xport_args.cast<double>("fc_freq_ratio", 1.0 / 32);
 
     uhd::rfnoc::stream_buff_params_t fc_freq;
     if (enable_fc) {
@@ -331,10 +331,125 @@ mpmd_mboard_impl::mpmd_mb_iface::make_rx_data_transport(
         epids,
         recv_link->get_num_recv_frames(),
         fc_params,
+        xport_args.get("fc_poller", "0") == "1",
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
         });
 
+    // Striped streaming: attach a second physical port carrying a stripe of
+    // this stream for rates that exceed a single link. The device-side
+    // round-robin is done by the transport adapter; on the host, the xport
+    // merges packets from both links back into sequence order. Both link
+    // pairs are connected with the same streamer ID so they share an I/O
+    // service context.
+    if (xport_args.has_key("stripe_links")) {
+        size_t stripe_idx = _link_if_mgr->get_num_links();
+        for (size_t idx = 0; idx < _link_if_mgr->get_num_links(); idx++) {
+            if (idx != link_idx) {
+                stripe_idx = idx;
+                break;
+            }
+        }
+        if (stripe_idx == _link_if_mgr->get_num_links()) {
+            throw uhd::value_error("[MPMD::MB_IFACE] Cannot enable link striping: "
+                                   "Device has no second link (specify, e.g., "
+                                   "`second_addr' to make one available)!");
+        }
+
+        uhd::transport::send_link_if::sptr stripe_send_link;
+        uhd::transport::recv_link_if::sptr stripe_recv_link;
+        std::tie(stripe_send_link,
+            std::ignore,
+            stripe_recv_link,
+            std::ignore,
+            std::ignore,
+            std::ignore,
+            std::ignore) = _link_if_mgr->get_link(stripe_idx,
+            uhd::transport::link_type_t::RX_DATA,
+            xport_args);
+
+        auto stripe_io_srv = get_io_srv_mgr()->connect_links(stripe_recv_link,
+            stripe_send_link,
+            transport::link_type_t::RX_DATA,
+            get_default_io_srv_args(),
+            xport_args,
+            streamer_id);
+
+        rx_xport->add_striped_link(stripe_io_srv,
+            stripe_recv_link,
+            stripe_send_link,
+            stripe_recv_link->get_num_recv_frames(),
+            [io_srv_mgr, stripe_recv_link, stripe_send_link]() {
+                io_srv_mgr->disconnect_links(stripe_recv_link, stripe_send_link);
+            });
+        UHD_LOG_DEBUG("MPMD::MB_IFACE",
+            "Striping rx streamer " << streamer_id << " across links " << link_idx
+                                    << " and " << stripe_idx);
+    }
+
+    // Hot-standby secondary link: pre-open the data links on another physical
+    // port now, so a failover does not depend on link setup at failure time,
+    // and install a handler that re-points the transport to them. After the
+    // failover, the SEP must still be re-armed over the management link (see
+    // link_stream_manager::reconnect_data_stream()), which re-programs the
+    // device's return route through the standby adapter.
+    if (xport_args.has_key("standby_link")) {
+        size_t standby_idx = _link_if_mgr->get_num_links();
+        for (size_t idx = 0; idx < _link_if_mgr->get_num_links(); idx++) {
+            if (idx != link_idx) {
+                standby_idx = idx;
+                break;
+            }
+        }
+        if (standby_idx == _link_if_mgr->get_num_links()) {
+            throw uhd::value_error("[MPMD::MB_IFACE] Cannot enable standby link: "
+                                   "Device has no second link (specify, e.g., "
+                                   "`second_addr' to make one available)!");
+        }
+
+        uhd::transport::send_link_if::sptr standby_send_link;
+        uhd::transport::recv_link_if::sptr standby_recv_link;
+        std::tie(standby_send_link,
+            std::ignore,
+            standby_recv_link,
+            std::ignore,
+            std::ignore,
+            std::ignore,
+            std::ignore) = _link_if_mgr->get_link(standby_idx,
+            uhd::transport::link_type_t::RX_DATA,
+            xport_args);
+
+        // The streamer's buffers and the SEP's stream config were sized
+        // against the primary link, so the standby must match them
+        UHD_ASSERT_THROW(
+            standby_recv_link->get_recv_frame_size() >= recv_link->get_recv_frame_size());
+
+        const bool fc_poller = xport_args.get("fc_poller", "0") == "1";
+        rx_xport->set_failover_handler(
+            [io_srv_mgr, standby_recv_link, standby_send_link, xport_args, streamer_id,
+                fc_poller, io_srv_args = get_default_io_srv_args()](
+                chdr_rx_data_xport& xport) {
+                auto standby_io_srv = io_srv_mgr->connect_links(standby_recv_link,
+                    standby_send_link,
+                    transport::link_type_t::RX_DATA,
+                    io_srv_args,
+                    xport_args,
+                    streamer_id);
+                xport.switch_links(standby_io_srv,
+                    standby_recv_link,
+                    standby_send_link,
+                    standby_recv_link->get_num_recv_frames(),
+                    fc_poller,
+                    [io_srv_mgr, standby_recv_link, standby_send_link]() {
+                        io_srv_mgr->disconnect_links(
+                            standby_recv_link, standby_send_link);
+                    });
+            });
+        UHD_LOG_DEBUG("MPMD::MB_IFACE",
+            "Opened hot-standby link " << standby_idx << " for rx streamer "
+                                       << streamer_id);
+    }
+
     return rx_xport;
 }
 
@@ -392,6 +507,7 @@ mpmd_mboard_impl::mpmd_mb_iface::make_tx_data_transport(
         mdata_buff_fmt,
         fc_freq_ratio,
         fc_headroom_ratio,
+        xport_args,
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
         });
@@ -10,6 +10,7 @@
 #include <uhd/transport/udp_simple.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/safe_call.hpp>
+#include <uhd/utils/thread.hpp>
 #include <chrono>
 #include <memory>
 #include <thread>
@@ -275,6 +276,7 @@ mpmd_mboard_impl::mpmd_mboard_impl(
     : mb_args(mb_args_)
     , rpc(make_mpm_rpc_client(rpc_server_addr, mb_args_))
     , _claim_rpc(make_mpm_rpc_client(rpc_server_addr, mb_args, MPMD_CLAIMER_RPC_TIMEOUT))
+    , _log_rpc(make_mpm_rpc_client(rpc_server_addr, mb_args, MPMD_CLAIMER_RPC_TIMEOUT))
     , _rpc_server_addr(rpc_server_addr)
 {
     UHD_LOGGER_TRACE("MPMD") << "Initializing mboard, connecting to RPC server address: "
@@ -282,18 +284,22 @@ mpmd_mboard_impl::mpmd_mboard_impl(
                              << " mboard args: " << mb_args.to_string();
 
     _claimer_task = claim_device_and_make_task();
+    _log_task     = make_log_loop_task();
     if (mb_args_.has_key(MPMD_MEAS_LATENCY_KEY)) {
         measure_rpc_latency(rpc, MPMD_MEAS_LATENCY_DURATION);
     }
 
-    /// Get device info
-    const auto device_info_dict = rpc->request<dev_info>("get_device_info");
+    /// Get device info and dboard info (pipelined, so the two round trips
+    /// overlap)
+    auto device_info_task = rpc->request_async<dev_info>("get_device_info");
+    auto dboards_info_task =
+        rpc->request_async<std::vector<dev_info>>("get_dboard_info");
+    const auto device_info_dict = device_info_task.get();
     for (const auto& info_pair : device_info_dict) {
         device_info[info_pair.first] = info_pair.second;
     }
     UHD_LOG_DEBUG("MPMD", "MPM reports device info: " << device_info.to_string());
-    /// Get dboard info
-    const auto dboards_info = rpc->request<std::vector<dev_info>>("get_dboard_info");
+    const auto dboards_info = dboards_info_task.get();
     UHD_ASSERT_THROW(this->dboard_info.empty());
     for (const auto& dboard_info_dict : dboards_info) {
         uhd::device_addr_t this_db_info;
@@ -319,7 +325,7 @@ mpmd_mboard_impl::~mpmd_mboard_impl()
 {
     // Destroy the claimer task to avoid spurious asynchronous reclaim call
     // after the unclaim.
-    UHD_SAFE_CALL(dump_logs(); _claimer_task.reset();
+    UHD_SAFE_CALL(_log_task.reset(); dump_logs(); _claimer_task.reset();
                   if (not rpc->request_with_token<bool>("unclaim")) {
                       UHD_LOG_WARNING("MPMD", "Failure to ack unclaim!");
                   });
@@ -386,17 +392,21 @@ bool mpmd_mboard_impl::claim()
 
 uhd::task::sptr mpmd_mboard_impl::make_claim_loop_task()
 {
+    // The loop does nothing but renew the claim: Log forwarding runs in its
+    // own task (see make_log_loop_task()), so a slow get_log_buf call can
+    // never delay a reclaim past the session timeout.
     return uhd::task::make(
-        [this] {
+        [this, prio_elevated = false]() mutable {
+            if (not prio_elevated) {
+                // Elevate the claimer thread above regular worker threads, so
+                // reclaims also go out on time when the host is under load.
+                // This may fail without the right permissions; that's fine.
+                uhd::set_thread_priority_safe();
+                prio_elevated = true;
+            }
             auto now = std::chrono::steady_clock::now();
             if (not this->claim()) {
                 throw uhd::value_error("mpmd device reclaiming loop failed!");
-            } else {
-                try {
-                    this->dump_logs();
-                } catch (const uhd::runtime_error&) {
-                    UHD_LOG_WARNING("MPMD", "Could not read back log queue!");
-                }
             }
             std::this_thread::sleep_until(
                 now + std::chrono::milliseconds(MPMD_RECLAIM_INTERVAL_MS));
@@ -404,6 +414,22 @@ uhd::task::sptr mpmd_mboard_impl::make_claim_loop_task()
         "mpmd_claimer_task");
 }
 
+uhd::task::sptr mpmd_mboard_impl::make_log_loop_task()
+{
+    return uhd::task::make(
+        [this] {
+            auto now = std::chrono::steady_clock::now();
+            try {
+                this->dump_logs();
+            } catch (const uhd::runtime_error&) {
+                UHD_LOG_WARNING("MPMD", "Could not read back log queue!");
+            }
+            std::this_thread::sleep_until(
+                now + std::chrono::milliseconds(MPMD_RECLAIM_INTERVAL_MS));
+        },
+        "mpmd_logger_task");
+}
+
 uhd::task::sptr mpmd_mboard_impl::claim_device_and_make_task()
 {
     auto rpc_token = _claim_rpc->request<std::string>(
@@ -412,8 +438,9 @@ uhd::task::sptr mpmd_mboard_impl::claim_device_and_make_task()
         throw uhd::value_error("mpmd device claiming failed!");
     }
     UHD_LOG_TRACE("MPMD", "Received claim token " << rpc_token);
-    // Save token for both RPC clients
+    // Save token for all RPC clients
     _claim_rpc->set_token(rpc_token);
+    _log_rpc->set_token(rpc_token);
     rpc->set_token(rpc_token);
     _token = rpc_token;
     // Optionally clear log buf
@@ -429,22 +456,28 @@ uhd::task::sptr mpmd_mboard_impl::claim_device_and_make_task()
 
 void mpmd_mboard_impl::reset_claim_loop()
 {
-    // Rebooting MPM puts the _claim_rpc in weird state where it cannot communicate
-    // with the rpc server properly, so reset the client and claim loop
+    // Rebooting MPM puts the _claim_rpc and _log_rpc in a weird state where
+    // they cannot communicate with the rpc server properly, so reset the
+    // clients and their loops
+    _log_task.reset();
     _claimer_task.reset();
     _claim_rpc = make_mpm_rpc_client(_rpc_server_addr, mb_args, MPMD_CLAIMER_RPC_TIMEOUT);
     _claim_rpc->set_token(_token);
+    _log_rpc = make_mpm_rpc_client(_rpc_server_addr, mb_args, MPMD_CLAIMER_RPC_TIMEOUT);
+    _log_rpc->set_token(_token);
     _claimer_task = make_claim_loop_task();
+    _log_task     = make_log_loop_task();
 }
 
 void mpmd_mboard_impl::dump_logs(const bool dump_to_null)
 {
-    // We need to use _claim_rpc instead of rpc because this currently only
-    // gets called in the claimer loop.
+    // We use a dedicated RPC connection for the log queue: Reading it can be
+    // slow when MPM is chatty, and we neither want to block foreground calls
+    // on `rpc' nor delay the reclaim calls on _claim_rpc.
     if (dump_to_null) {
-        _claim_rpc->request_with_token<log_buf_t>("get_log_buf");
+        _log_rpc->request_with_token<log_buf_t>("get_log_buf");
     } else {
-        forward_logs(_claim_rpc->request_with_token<log_buf_t>("get_log_buf"));
+        forward_logs(_log_rpc->request_with_token<log_buf_t>("get_log_buf"));
     }
 }
 
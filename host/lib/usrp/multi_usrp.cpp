@@ -20,6 +20,7 @@
 #include <uhd/utils/math.hpp>
 #include <uhd/utils/soft_register.hpp>
 #include <uhdlib/rfnoc/rfnoc_device.hpp>
+#include <uhdlib/usrp/common/parallel_fan_out.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
 #include <uhdlib/usrp/multi_usrp_utils.hpp>
 #include <boost/algorithm/string.hpp>
@@ -525,6 +526,62 @@ public:
         }
     }
 
+    std::vector<double> sync_time_unknown_pps(const time_spec_t& time_spec) override
+    {
+        UHD_LOGGER_INFO("MULTI_USRP") << "    1) catch time transition at pps edge";
+        auto end_time =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(1100);
+        time_spec_t time_start_last_pps = get_time_last_pps();
+        while (time_start_last_pps == get_time_last_pps()) {
+            if (std::chrono::steady_clock::now() > end_time) {
+                throw uhd::runtime_error("Board 0 may not be getting a PPS signal!\n"
+                                         "No PPS detected within the time interval.\n"
+                                         "See the application notes for your device.\n");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        UHD_LOGGER_INFO("MULTI_USRP") << "    2) arm times next pps on all boards";
+        parallel_fan_out(
+            get_num_mboards(),
+            [this, &time_spec](const size_t m) { set_time_next_pps(time_spec, m); },
+            "mboard");
+
+        UHD_LOGGER_INFO("MULTI_USRP") << "    3) wait for the edge to latch the time";
+        const time_spec_t armed_last_pps = get_time_last_pps();
+        end_time = std::chrono::steady_clock::now() + std::chrono::milliseconds(1100);
+        while (armed_last_pps == get_time_last_pps()) {
+            if (std::chrono::steady_clock::now() > end_time) {
+                throw uhd::runtime_error("Board 0 may not be getting a PPS signal!\n"
+                                         "No PPS detected within the time interval.\n"
+                                         "See the application notes for your device.\n");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // read back all time registers concurrently so the skew measurements
+        // share one host time reference, then report relative to board 0
+        std::vector<time_spec_t> times(get_num_mboards());
+        parallel_fan_out(
+            get_num_mboards(),
+            [this, &times](const size_t m) { times[m] = get_time_now(m); },
+            "mboard");
+        std::vector<double> skews(get_num_mboards(), 0.0);
+        for (size_t m = 1; m < get_num_mboards(); m++) {
+            skews[m] = (times[m] - times[0]).get_real_secs();
+            // 10 ms: greater than RTT but not too big
+            if (times[m] < times[0] or (times[m] - times[0]) > time_spec_t(0.01)) {
+                UHD_LOGGER_WARNING("MULTI_USRP")
+                    << boost::format(
+                           "Detected time deviation between board %d and board 0.\n"
+                           "Board 0 time is %f seconds.\n"
+                           "Board %d time is %f seconds.\n")
+                           % m % times[0].get_real_secs() % m % times[m].get_real_secs();
+            }
+        }
+        return skews;
+    }
+
     bool get_time_synchronized(void) override
     {
         for (size_t m = 1; m < get_num_mboards(); m++) {
@@ -846,8 +903,9 @@ public:
     /*******************************************************************
      * RX methods
      ******************************************************************/
-    rx_streamer::sptr get_rx_stream(const stream_args_t& args) override
+    rx_streamer::sptr get_rx_stream(const stream_args_t& args_in) override
     {
+        const stream_args_t args = _resolve_auto_otw_format(args_in, false);
         _check_link_rate(args, false);
         stream_args_t args_ = args;
         if (!args.args.has_key("spp")) {
@@ -919,9 +977,8 @@ public:
             do_samp_rate_warning_message(rate, get_rx_rate(chan), "RX");
             return;
         }
-        for (size_t c = 0; c < get_rx_num_channels(); c++) {
-            set_rx_rate(rate, c);
-        }
+        parallel_fan_out(
+            get_rx_num_channels(), [&](const size_t c) { set_rx_rate(rate, c); });
     }
 
     void set_rx_spp(const size_t spp, const size_t chan = ALL_CHANS) override
@@ -1453,11 +1510,8 @@ public:
      *************************************************************************/
     void set_rx_gain(double gain, const std::string& name, size_t chan) override
     {
-        /* Check if any AGC mode is enabled and if so warn the user */
-        for (size_t c = 0; c < get_rx_num_channels(); c++) {
-            if (chan != ALL_CHANS && c != chan) {
-                continue;
-            }
+        auto set_gain_chan = [&](const size_t c) {
+            /* Check if the AGC mode is enabled and if so warn the user */
             if (_tree->exists(rx_rf_fe_root(c) / "gain" / "agc")) {
                 bool agc =
                     _tree->access<bool>(rx_rf_fe_root(c) / "gain" / "agc" / "enable")
@@ -1467,14 +1521,19 @@ public:
                                                      << ". Setting will be ignored.";
                 }
             }
-            /* Apply gain settings to all channels.
+            /* Apply gain setting to the channel.
              * If device is in AGC mode it will ignore the setting. */
             try {
                 rx_gain_group(c)->set_value(gain, name);
             } catch (uhd::key_error&) {
                 THROW_GAIN_NAME_ERROR(name, c, rx);
             }
+        };
+        if (chan != ALL_CHANS) {
+            set_gain_chan(chan);
+            return;
         }
+        parallel_fan_out(get_rx_num_channels(), set_gain_chan);
     }
 
     void set_rx_gain_profile(const std::string& profile, const size_t chan) override
@@ -1890,8 +1949,9 @@ public:
     /*******************************************************************
      * TX methods
      ******************************************************************/
-    tx_streamer::sptr get_tx_stream(const stream_args_t& args) override
+    tx_streamer::sptr get_tx_stream(const stream_args_t& args_in) override
     {
+        const stream_args_t args = _resolve_auto_otw_format(args_in, true);
         _check_link_rate(args, true);
         return this->get_device()->get_tx_stream(args);
     }
@@ -1954,9 +2014,8 @@ public:
             do_samp_rate_warning_message(rate, get_tx_rate(chan), "TX");
             return;
         }
-        for (size_t c = 0; c < get_tx_num_channels(); c++) {
-            set_tx_rate(rate, c);
-        }
+        parallel_fan_out(
+            get_tx_num_channels(), [&](const size_t c) { set_tx_rate(rate, c); });
     }
 
     double get_tx_rate(size_t chan) override
@@ -2001,16 +2060,18 @@ public:
 
     void set_tx_gain(double gain, const std::string& name, size_t chan) override
     {
-        for (size_t c = 0; c < get_tx_num_channels(); c++) {
-            if (chan != ALL_CHANS && c != chan) {
-                continue;
-            }
+        auto set_gain_chan = [&](const size_t c) {
             try {
                 tx_gain_group(c)->set_value(gain, name);
             } catch (uhd::key_error&) {
                 THROW_GAIN_NAME_ERROR(name, c, tx);
             }
+        };
+        if (chan != ALL_CHANS) {
+            set_gain_chan(chan);
+            return;
         }
+        parallel_fan_out(get_tx_num_channels(), set_gain_chan);
     }
 
     void set_tx_gain_profile(const std::string& profile, const size_t chan) override
@@ -2705,6 +2766,72 @@ private:
         return gg;
     }
 
+    //! Check if a converter for the given wire format is registered
+    //
+    // RX streamers convert from the wire format to the CPU format, TX
+    // streamers the other way around. All legacy devices stream item32
+    // words, so matching on the "<otw>_item32" prefix covers both byte
+    // orderings without knowing which one the device uses.
+    bool _otw_format_is_convertible(
+        const std::string& otw_format, const std::string& cpu_format, const bool is_tx)
+    {
+        for (const auto& id : convert::get_ids()) {
+            const std::string& wire_format = is_tx ? id.output_format : id.input_format;
+            const std::string& host_format = is_tx ? id.input_format : id.output_format;
+            if (host_format == cpu_format and id.num_inputs == 1 and id.num_outputs == 1
+                and wire_format.find(otw_format + "_item32") == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Replace otw_format=auto with a concrete wire format
+    //
+    // Uses the same link budget computation as _check_link_rate(): if the
+    // link can carry the requested rates at four bytes per sample, pick
+    // sc16, otherwise drop to sc8 when a suitable converter is registered.
+    // sc12 is never selected automatically since not all devices that
+    // register its converters support it over the wire. When the link
+    // capacity is unknown, this conservatively falls back to sc16.
+    stream_args_t _resolve_auto_otw_format(const stream_args_t& args, const bool is_tx)
+    {
+        if (args.otw_format != "auto") {
+            return args;
+        }
+        stream_args_t resolved = args;
+        resolved.otw_format    = "sc16";
+        const std::string cpu_format =
+            args.cpu_format.empty() ? "fc32" : args.cpu_format;
+        double max_link_rate = 0;
+        double sum_rate      = 0;
+        for (const size_t chan : args.channels) {
+            mboard_chan_pair mcp = is_tx ? tx_chan_to_mcp(chan) : rx_chan_to_mcp(chan);
+            if (_tree->exists(mb_root(mcp.mboard) / "link_max_rate")) {
+                max_link_rate = std::max(max_link_rate,
+                    _tree->access<double>(mb_root(mcp.mboard) / "link_max_rate").get());
+            }
+            sum_rate += is_tx ? get_tx_rate(chan) : get_rx_rate(chan);
+        }
+        sum_rate /= get_num_mboards();
+        if (max_link_rate <= 0 or sum_rate <= 0) {
+            UHD_LOGGER_DEBUG("MULTI_USRP")
+                << "otw_format=auto: Link capacity unknown, using sc16";
+            return resolved;
+        }
+        const double bytes_per_sample_budget = max_link_rate / sum_rate;
+        if (bytes_per_sample_budget < convert::get_bytes_per_item("sc16")
+            and _otw_format_is_convertible("sc8", cpu_format, is_tx)) {
+            resolved.otw_format = "sc8";
+        }
+        UHD_LOGGER_INFO("MULTI_USRP")
+            << boost::format("otw_format=auto: Selecting %s (%f MSps requested on "
+                             "%u channels, link capacity %f MB/s)")
+                   % resolved.otw_format % (sum_rate / 1e6) % args.channels.size()
+                   % (max_link_rate / 1e6);
+        return resolved;
+    }
+
     //! \param is_tx True for tx
     // Assumption is that all mboards use the same link
     // and that the rate sum is evenly distributed among the mboards
@@ -2743,6 +2870,52 @@ multi_usrp::~multi_usrp(void)
     /* NOP */
 }
 
+void multi_usrp::run_command_batch(std::vector<batch_entry_t> batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    // Issue the commands in time order, setting the command time once per
+    // distinct timestamp instead of a set/clear pair per command
+    std::stable_sort(batch.begin(),
+        batch.end(),
+        [](const batch_entry_t& lhs, const batch_entry_t& rhs) {
+            return lhs.time < rhs.time;
+        });
+    try {
+        for (size_t i = 0; i < batch.size(); i++) {
+            const batch_entry_t& entry = batch[i];
+            if (i == 0 or entry.time != batch[i - 1].time) {
+                set_command_time(entry.time);
+            }
+            switch (entry.op) {
+                case batch_op_t::RX_FREQ:
+                    set_rx_freq(tune_request_t(entry.value), entry.chan);
+                    break;
+                case batch_op_t::TX_FREQ:
+                    set_tx_freq(tune_request_t(entry.value), entry.chan);
+                    break;
+                case batch_op_t::RX_GAIN:
+                    set_rx_gain(entry.value, entry.chan);
+                    break;
+                case batch_op_t::TX_GAIN:
+                    set_tx_gain(entry.value, entry.chan);
+                    break;
+                case batch_op_t::RX_ANTENNA:
+                    set_rx_antenna(entry.str_value, entry.chan);
+                    break;
+                case batch_op_t::TX_ANTENNA:
+                    set_tx_antenna(entry.str_value, entry.chan);
+                    break;
+            }
+        }
+    } catch (...) {
+        clear_command_time();
+        throw;
+    }
+    clear_command_time();
+}
+
 
 /***********************************************************************
  * The Make Function
@@ -71,6 +71,7 @@ void export_multi_usrp(py::module& m)
         .def("set_time_now"            , &multi_usrp::set_time_now, py::arg("time_spec"), py::arg("mboard") = ALL_MBOARDS)
         .def("set_time_next_pps"       , &multi_usrp::set_time_next_pps, py::arg("time_spec"), py::arg("mboard") = ALL_MBOARDS)
         .def("set_time_unknown_pps"    , &multi_usrp::set_time_unknown_pps)
+        .def("sync_time_unknown_pps"   , &multi_usrp::sync_time_unknown_pps)
         .def("get_time_synchronized"   , &multi_usrp::get_time_synchronized)
         .def("set_command_time"        , &multi_usrp::set_command_time, py::arg("time_spec"), py::arg("mboard") = ALL_MBOARDS)
         .def("clear_command_time"      , &multi_usrp::clear_command_time, py::arg("mboard") = ALL_MBOARDS)
@@ -23,13 +23,16 @@
 #include <uhdlib/rfnoc/rfnoc_rx_streamer.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer_replay_buffered.hpp>
+#include <uhdlib/usrp/common/parallel_fan_out.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
 #include <uhdlib/usrp/multi_usrp_utils.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <unordered_set>
 #include <boost/format.hpp>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -59,6 +62,24 @@ using namespace uhd::rfnoc;
 #define MUX_MB_API_CALL(api_call, ...) \
     MUX_API_CALL(get_num_mboards(), api_call, mboard, ALL_MBOARDS, __VA_ARGS__)
 
+//! Like MUX_API_CALL, but runs the per-index calls in parallel and joins
+// before returning. Used for calls dominated by per-device I/O (gain, rate,
+// antenna) where the channels are independent and a serial loop multiplies
+// the round-trip latency by the channel count.
+#define PAR_MUX_API_CALL(max_index, api_call, mux_var, mux_cond, ...)            \
+    if (mux_var == mux_cond) {                                                   \
+        uhd::usrp::parallel_fan_out(max_index,                                   \
+            [&](const size_t __index) { api_call(__VA_ARGS__, __index); });      \
+        return;                                                                  \
+    }
+
+//! Fan out (mux) an RX-specific API call to all channels in parallel
+#define PAR_MUX_RX_API_CALL(api_call, ...) \
+    PAR_MUX_API_CALL(get_rx_num_channels(), api_call, chan, ALL_CHANS, __VA_ARGS__)
+//! Fan out (mux) a TX-specific API call to all channels in parallel
+#define PAR_MUX_TX_API_CALL(api_call, ...) \
+    PAR_MUX_API_CALL(get_tx_num_channels(), api_call, chan, ALL_CHANS, __VA_ARGS__)
+
 
 namespace {
 constexpr char DEFAULT_CPU_FORMAT[] = "fc32";
@@ -67,6 +88,39 @@ constexpr double RX_SIGN            = +1.0;
 constexpr double TX_SIGN            = -1.0;
 constexpr char LOG_ID[]             = "MULTI_USRP";
 
+//! Versioned cache entry for hot getters (see get_cached())
+struct getter_cache_t
+{
+    //! Bumped by mutators that may change the underlying value
+    std::atomic<uint64_t> version{1};
+    //! Version the cached value was read at (0 == no value cached yet)
+    std::atomic<uint64_t> cached_version{0};
+    std::atomic<double> value{0.0};
+    //! Serializes refreshes so a stale value can't be published against a
+    // newer version
+    std::mutex refresh_mutex;
+};
+
+//! Return the cached value if it is current, otherwise refresh it via
+// \p reader (which does the actual device/graph access). The steady-state
+// path is two atomic loads; invalidation is a version bump on the entry.
+double get_cached(getter_cache_t& cache, const std::function<double(void)>& reader)
+{
+    uint64_t version = cache.version.load(std::memory_order_acquire);
+    if (cache.cached_version.load(std::memory_order_acquire) == version) {
+        return cache.value.load(std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> l(cache.refresh_mutex);
+    // Re-read the version under the lock: if an invalidation raced us, the
+    // value we are about to read is tagged with the bumped version at worst,
+    // causing one extra refresh, never a stale hit
+    version            = cache.version.load(std::memory_order_acquire);
+    const double value = reader();
+    cache.value.store(value, std::memory_order_relaxed);
+    cache.cached_version.store(version, std::memory_order_release);
+    return value;
+}
+
 //! A faux container for a UHD device
 //
 // Note that multi_usrp_rfnoc no longer gives access to the underlying device
@@ -285,6 +339,7 @@ public:
             throw uhd::runtime_error(
                 "[multi_usrp] No valid radio channels found in connected devices.");
         }
+        _rebuild_chan_tables();
 
         // Manually propagate radio block sample rates to DDC/DUC blocks in order to
         // allow DDC/DUC blocks to have valid internal state before graph is (later)
@@ -304,6 +359,20 @@ public:
             }
         }
 
+        // Pre-populate the getter caches; the channel and mboard sets are
+        // fixed from here on
+        for (auto& chan : _rx_chans) {
+            _rx_rate_cache[chan.first];
+            _rx_freq_cache[chan.first];
+        }
+        for (auto& chan : _tx_chans) {
+            _tx_rate_cache[chan.first];
+            _tx_freq_cache[chan.first];
+        }
+        for (size_t mboard = 0; mboard < get_num_mboards(); ++mboard) {
+            _tick_rate_cache[mboard];
+        }
+
         _graph->commit();
     }
 
@@ -745,37 +814,55 @@ public:
                 radio->set_rate(rate);
             }
         }
+        // The tick rate feeds into every rate and frequency, so flush all of
+        // the getter caches. This must happen after the rate change: a getter
+        // that refreshes between the invalidation and the write would cache
+        // the old value against the new version.
+        _invalidate_cache(_tick_rate_cache, mboard);
+        _invalidate_cache(_rx_rate_cache, ALL_CHANS);
+        _invalidate_cache(_tx_rate_cache, ALL_CHANS);
+        _invalidate_cache(_rx_freq_cache, ALL_CHANS);
+        _invalidate_cache(_tx_freq_cache, ALL_CHANS);
     }
 
     double get_master_clock_rate(size_t mboard) override
     {
-        // We pick the first radio we can find on this mboard and get its master clock
-        // rate. A warning is thrown if there are different rates in different radios.
-        std::vector<double> mcrs;
-        for (auto& chain : _rx_chans) {
-            auto radio = chain.second.radio;
-            radio->get_unique_id();
-            if (radio->get_block_id().get_device_no() == mboard) {
-                mcrs.push_back(radio->get_tick_rate());
+        auto read_rate = [&]() {
+            // We pick the first radio we can find on this mboard and get its master
+            // clock rate. A warning is thrown if there are different rates in different
+            // radios.
+            std::vector<double> mcrs;
+            for (auto& chain : _rx_chans) {
+                auto radio = chain.second.radio;
+                radio->get_unique_id();
+                if (radio->get_block_id().get_device_no() == mboard) {
+                    mcrs.push_back(radio->get_tick_rate());
+                }
             }
-        }
-        for (auto& chain : _tx_chans) {
-            auto radio = chain.second.radio;
-            if (radio->get_block_id().get_device_no() == mboard) {
-                mcrs.push_back(radio->get_tick_rate());
+            for (auto& chain : _tx_chans) {
+                auto radio = chain.second.radio;
+                if (radio->get_block_id().get_device_no() == mboard) {
+                    mcrs.push_back(radio->get_tick_rate());
+                }
             }
-        }
-        if (!mcrs.empty()) {
-            if (!std::equal(mcrs.begin() + 1, mcrs.end(), mcrs.begin())) {
-                UHD_LOGGER_WARNING("MULTI_USRP")
-                    << "Different master clock rates on different radio blocks. "
-                       "Returning value for radio block #0 only. Consider using "
-                       "get_tick_rate() on the RFNoC radio block to retrieve the master "
-                       "clock rates per radio block.";
+            if (!mcrs.empty()) {
+                if (!std::equal(mcrs.begin() + 1, mcrs.end(), mcrs.begin())) {
+                    UHD_LOGGER_WARNING("MULTI_USRP")
+                        << "Different master clock rates on different radio blocks. "
+                           "Returning value for radio block #0 only. Consider using "
+                           "get_tick_rate() on the RFNoC radio block to retrieve the "
+                           "master "
+                           "clock rates per radio block.";
+                }
+                return mcrs[0];
             }
-            return mcrs[0];
+            throw uhd::key_error("Invalid mboard index!");
+        };
+        auto it = _tick_rate_cache.find(mboard);
+        if (it == _tick_rate_cache.end()) {
+            return read_rate();
         }
-        throw uhd::key_error("Invalid mboard index!");
+        return get_cached(it->second, read_rate);
     }
 
     meta_range_t get_master_clock_rate_range(const size_t mboard) override
@@ -930,6 +1017,62 @@ public:
         }
     }
 
+    std::vector<double> sync_time_unknown_pps(const time_spec_t& time_spec) override
+    {
+        UHD_LOGGER_INFO("MULTI_USRP") << "    1) catch time transition at pps edge";
+        auto end_time                   = std::chrono::steady_clock::now() + 1100ms;
+        time_spec_t time_start_last_pps = get_time_last_pps();
+        while (time_start_last_pps == get_time_last_pps()) {
+            if (std::chrono::steady_clock::now() > end_time) {
+                throw uhd::runtime_error("Board 0 may not be getting a PPS signal!\n"
+                                         "No PPS detected within the time interval.\n"
+                                         "See the application notes for your device.\n");
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+
+        UHD_LOGGER_INFO("MULTI_USRP") << "    2) arm times next pps on all boards";
+        parallel_fan_out(
+            get_num_mboards(),
+            [this, &time_spec](const size_t m) { set_time_next_pps(time_spec, m); },
+            "mboard");
+
+        UHD_LOGGER_INFO("MULTI_USRP") << "    3) wait for the edge to latch the time";
+        const time_spec_t armed_last_pps = get_time_last_pps();
+        end_time = std::chrono::steady_clock::now() + 1100ms;
+        while (armed_last_pps == get_time_last_pps()) {
+            if (std::chrono::steady_clock::now() > end_time) {
+                throw uhd::runtime_error("Board 0 may not be getting a PPS signal!\n"
+                                         "No PPS detected within the time interval.\n"
+                                         "See the application notes for your device.\n");
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+
+        // read back the first timekeeper of every board concurrently so the
+        // skew measurements share one host time reference, then report
+        // relative to board 0
+        std::vector<time_spec_t> times(get_num_mboards());
+        parallel_fan_out(
+            get_num_mboards(),
+            [this, &times](const size_t m) { times[m] = _get_time_now(m, 0); },
+            "mboard");
+        std::vector<double> skews(get_num_mboards(), 0.0);
+        for (size_t m = 1; m < get_num_mboards(); m++) {
+            skews[m] = (times[m] - times[0]).get_real_secs();
+            // 10 ms: greater than RTT but not too big
+            if (times[m] < times[0] or (times[m] - times[0]) > time_spec_t(0.01)) {
+                UHD_LOGGER_WARNING("MULTI_USRP")
+                    << boost::format(
+                           "Detected time deviation between board %1% and board 0.\n"
+                           "Board 0 time is %2% seconds.\n"
+                           "Board %1% time is %3% seconds.\n")
+                           % m % times[0].get_real_secs() % times[m].get_real_secs();
+            }
+        }
+        return skews;
+    }
+
     bool get_time_synchronized(void) override
     {
         // verify that the time registers are read to be within a few RTT
@@ -1005,7 +1148,37 @@ public:
     void issue_stream_cmd(
         const stream_cmd_t& stream_cmd, size_t chan = ALL_CHANS) override
     {
-        MUX_RX_API_CALL(issue_stream_cmd, stream_cmd);
+        if (chan == ALL_CHANS) {
+            // Broadcast path: The command (and thus its time spec) is
+            // computed once and fanned out, rather than re-posted through the
+            // graph once per channel. Channels that share a DDC block are
+            // folded into a single batched graph action (one graph traversal
+            // per block), and the radio-only channels get their control
+            // writes issued in parallel, so a timed multi-channel start is
+            // programmed with minimal host-side skew.
+            std::map<ddc_block_control*, std::pair<ddc_block_control::sptr,
+                                             std::vector<size_t>>>
+                ddc_ports;
+            std::vector<size_t> radio_chans;
+            for (size_t rx_chan = 0; rx_chan < get_rx_num_channels(); ++rx_chan) {
+                auto& rx_chain = _get_rx_chan(rx_chan);
+                if (rx_chain.ddc) {
+                    auto& entry = ddc_ports[rx_chain.ddc.get()];
+                    entry.first = rx_chain.ddc;
+                    entry.second.push_back(rx_chain.block_chan);
+                } else {
+                    radio_chans.push_back(rx_chan);
+                }
+            }
+            for (auto& ddc : ddc_ports) {
+                ddc.second.first->issue_stream_cmd(stream_cmd, ddc.second.second);
+            }
+            parallel_fan_out(radio_chans.size(), [&](const size_t index) {
+                auto& rx_chain = _get_rx_chan(radio_chans[index]);
+                rx_chain.radio->issue_stream_cmd(stream_cmd, rx_chain.block_chan);
+            });
+            return;
+        }
         auto& rx_chain = _get_rx_chan(chan);
         if (rx_chain.ddc) {
             rx_chain.ddc->issue_stream_cmd(stream_cmd, rx_chain.block_chan);
@@ -1294,6 +1467,10 @@ public:
     void set_rx_rate(double rate, size_t chan = ALL_CHANS) override
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        // Not parallelized: the per-channel calls reacquire _graph_mutex,
+        // which this thread already holds, so worker threads would block on
+        // the lock while we join them. A serial loop loses nothing here,
+        // since the workers would serialize on the lock anyway.
         MUX_RX_API_CALL(set_rx_rate, rate);
         const double actual_rate = [&]() {
             auto rx_chain = _get_rx_chan(chan);
@@ -1310,6 +1487,7 @@ public:
                        % (rate / 1.0e6) % (actual_rate / 1.0e6);
         }
         _rx_rates[chan] = actual_rate;
+        _invalidate_cache(_rx_rate_cache, chan);
     }
 
     void set_rx_spp(const size_t spp, const size_t chan = ALL_CHANS) override
@@ -1323,12 +1501,19 @@ public:
 
     double get_rx_rate(size_t chan = 0) override
     {
-        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        auto& rx_chain = _get_rx_chan(chan);
-        if (rx_chain.ddc) {
-            return rx_chain.ddc->get_output_rate(rx_chain.block_chan);
+        auto read_rate = [&]() {
+            std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+            auto& rx_chain = _get_rx_chan(chan);
+            if (rx_chain.ddc) {
+                return rx_chain.ddc->get_output_rate(rx_chain.block_chan);
+            }
+            return rx_chain.radio->get_rate();
+        };
+        auto it = _rx_rate_cache.find(chan);
+        if (it == _rx_rate_cache.end()) {
+            return read_rate();
         }
-        return rx_chain.radio->get_rate();
+        return get_cached(it->second, read_rate);
     }
 
     meta_range_t get_rx_rates(size_t chan = 0) override
@@ -1383,7 +1568,7 @@ public:
         auto get_dsp_freq = [rx_chain](void) {
             return (rx_chain.ddc) ? rx_chain.ddc->get_freq(rx_chain.block_chan) : 0.0;
         };
-        return tune_xx_subdev_and_dsp(RX_SIGN,
+        const tune_result_t tune_result = tune_xx_subdev_and_dsp(RX_SIGN,
             tune_range,
             rf_range,
             dsp_range,
@@ -1392,19 +1577,30 @@ public:
             set_dsp_freq,
             get_dsp_freq,
             tune_request);
+        // Invalidate only after the tune completes, so a concurrent getter
+        // cannot cache the pre-tune frequency against the new version
+        _invalidate_cache(_rx_freq_cache, chan);
+        return tune_result;
     }
 
     double get_rx_freq(size_t chan = 0) override
     {
-        auto& rx_chain = _get_rx_chan(chan);
+        auto read_freq = [&]() {
+            auto& rx_chain = _get_rx_chan(chan);
 
-        // extract actual dsp and IF frequencies
-        const double actual_rf_freq =
-            rx_chain.rf_core->get_rx_frequency(rx_chain.block_chan);
-        const double actual_dsp_freq =
-            (rx_chain.ddc) ? rx_chain.ddc->get_freq(rx_chain.block_chan) : 0.0;
+            // extract actual dsp and IF frequencies
+            const double actual_rf_freq =
+                rx_chain.rf_core->get_rx_frequency(rx_chain.block_chan);
+            const double actual_dsp_freq =
+                (rx_chain.ddc) ? rx_chain.ddc->get_freq(rx_chain.block_chan) : 0.0;
 
-        return actual_rf_freq - actual_dsp_freq * RX_SIGN;
+            return actual_rf_freq - actual_dsp_freq * RX_SIGN;
+        };
+        auto it = _rx_freq_cache.find(chan);
+        if (it == _rx_freq_cache.end()) {
+            return read_freq();
+        }
+        return get_cached(it->second, read_freq);
     }
 
     freq_range_t get_rx_freq_range(size_t chan = 0) override
@@ -1442,6 +1638,7 @@ public:
         MUX_RX_API_CALL(set_rx_lo_source, src, name);
         auto rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_lo_source(src, name, rx_chain.block_chan);
+        _invalidate_cache(_rx_freq_cache, chan);
     }
 
     const std::string get_rx_lo_source(
@@ -1476,7 +1673,10 @@ public:
     double set_rx_lo_freq(double freq, const std::string& name, size_t chan = 0) override
     {
         auto rx_chain = _get_rx_chan(chan);
-        return rx_chain.radio->set_rx_lo_freq(freq, name, rx_chain.block_chan);
+        const double coerced_freq =
+            rx_chain.radio->set_rx_lo_freq(freq, name, rx_chain.block_chan);
+        _invalidate_cache(_rx_freq_cache, chan);
+        return coerced_freq;
     }
 
     double get_rx_lo_freq(const std::string& name, size_t chan = 0) override
@@ -1505,6 +1705,7 @@ public:
         MUX_TX_API_CALL(set_tx_lo_source, src, name);
         auto tx_chain = _get_tx_chan(chan);
         tx_chain.radio->set_tx_lo_source(src, name, tx_chain.block_chan);
+        _invalidate_cache(_tx_freq_cache, chan);
     }
 
     const std::string get_tx_lo_source(
@@ -1541,7 +1742,10 @@ public:
         const double freq, const std::string& name, const size_t chan = 0) override
     {
         auto tx_chain = _get_tx_chan(chan);
-        return tx_chain.radio->set_tx_lo_freq(freq, name, tx_chain.block_chan);
+        const double coerced_freq =
+            tx_chain.radio->set_tx_lo_freq(freq, name, tx_chain.block_chan);
+        _invalidate_cache(_tx_freq_cache, chan);
+        return coerced_freq;
     }
 
     double get_tx_lo_freq(const std::string& name, const size_t chan = 0) override
@@ -1562,7 +1766,7 @@ public:
      *************************************************************************/
     void set_rx_gain(double gain, const std::string& name, size_t chan = 0) override
     {
-        MUX_RX_API_CALL(set_rx_gain, gain, name);
+        PAR_MUX_RX_API_CALL(set_rx_gain, gain, name);
         auto rx_chain = _get_rx_chan(chan);
         rx_chain.rf_core->set_rx_gain(gain, name, rx_chain.block_chan);
     }
@@ -1665,7 +1869,7 @@ public:
 
     void set_rx_antenna(const std::string& ant, size_t chan = 0) override
     {
-        MUX_RX_API_CALL(set_rx_antenna, ant);
+        PAR_MUX_RX_API_CALL(set_rx_antenna, ant);
         auto& rx_chain = _get_rx_chan(chan);
         rx_chain.rf_core->set_rx_antenna(ant, rx_chain.block_chan);
     }
@@ -1974,6 +2178,7 @@ public:
     void set_tx_rate(double rate, size_t chan = ALL_CHANS) override
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        // Not parallelized: see set_rx_rate above
         MUX_TX_API_CALL(set_tx_rate, rate);
         const double actual_rate = [&]() {
             auto tx_chain = _get_tx_chan(chan);
@@ -1990,16 +2195,24 @@ public:
                        % (rate / 1.0e6) % (actual_rate / 1.0e6);
         }
         _tx_rates[chan] = actual_rate;
+        _invalidate_cache(_tx_rate_cache, chan);
     }
 
     double get_tx_rate(size_t chan = 0) override
     {
-        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        auto& tx_chain = _get_tx_chan(chan);
-        if (tx_chain.duc) {
-            return tx_chain.duc->get_input_rate(tx_chain.block_chan);
+        auto read_rate = [&]() {
+            std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+            auto& tx_chain = _get_tx_chan(chan);
+            if (tx_chain.duc) {
+                return tx_chain.duc->get_input_rate(tx_chain.block_chan);
+            }
+            return tx_chain.radio->get_rate();
+        };
+        auto it = _tx_rate_cache.find(chan);
+        if (it == _tx_rate_cache.end()) {
+            return read_rate();
         }
-        return tx_chain.radio->get_rate();
+        return get_cached(it->second, read_rate);
     }
 
     meta_range_t get_tx_rates(size_t chan = 0) override
@@ -2051,7 +2264,7 @@ public:
         auto get_dsp_freq = [tx_chain](void) {
             return (tx_chain.duc) ? tx_chain.duc->get_freq(tx_chain.block_chan) : 0.0;
         };
-        return tune_xx_subdev_and_dsp(TX_SIGN,
+        const tune_result_t tune_result = tune_xx_subdev_and_dsp(TX_SIGN,
             tune_range,
             rf_range,
             dsp_range,
@@ -2060,18 +2273,29 @@ public:
             set_dsp_freq,
             get_dsp_freq,
             tune_request);
+        // Invalidate only after the tune completes, so a concurrent getter
+        // cannot cache the pre-tune frequency against the new version
+        _invalidate_cache(_tx_freq_cache, chan);
+        return tune_result;
     }
 
     double get_tx_freq(size_t chan = 0) override
     {
-        auto& tx_chain = _get_tx_chan(chan);
-        // extract actual dsp and IF frequencies
-        const double actual_rf_freq =
-            tx_chain.rf_core->get_tx_frequency(tx_chain.block_chan);
-        const double actual_dsp_freq =
-            (tx_chain.duc) ? tx_chain.duc->get_freq(tx_chain.block_chan) : 0.0;
+        auto read_freq = [&]() {
+            auto& tx_chain = _get_tx_chan(chan);
+            // extract actual dsp and IF frequencies
+            const double actual_rf_freq =
+                tx_chain.rf_core->get_tx_frequency(tx_chain.block_chan);
+            const double actual_dsp_freq =
+                (tx_chain.duc) ? tx_chain.duc->get_freq(tx_chain.block_chan) : 0.0;
 
-        return actual_rf_freq - actual_dsp_freq * TX_SIGN;
+            return actual_rf_freq - actual_dsp_freq * TX_SIGN;
+        };
+        auto it = _tx_freq_cache.find(chan);
+        if (it == _tx_freq_cache.end()) {
+            return read_freq();
+        }
+        return get_cached(it->second, read_freq);
     }
 
     freq_range_t get_tx_freq_range(size_t chan = 0) override
@@ -2091,7 +2315,7 @@ public:
 
     void set_tx_gain(double gain, const std::string& name, size_t chan = 0) override
     {
-        MUX_TX_API_CALL(set_tx_gain, gain, name);
+        PAR_MUX_TX_API_CALL(set_tx_gain, gain, name);
         auto tx_chain = _get_tx_chan(chan);
         tx_chain.rf_core->set_tx_gain(gain, name, tx_chain.block_chan);
     }
@@ -2188,7 +2412,7 @@ public:
 
     void set_tx_antenna(const std::string& ant, size_t chan = 0) override
     {
-        MUX_TX_API_CALL(set_tx_antenna, ant);
+        PAR_MUX_TX_API_CALL(set_tx_antenna, ant);
         auto tx_chain = _get_tx_chan(chan);
         tx_chain.rf_core->set_tx_antenna(ant, tx_chain.block_chan);
     }
@@ -2656,20 +2880,20 @@ private:
 
     rx_chan_t& _get_rx_chan(const size_t chan)
     {
-        if (!_rx_chans.count(chan)) {
+        if (chan >= _rx_chan_table.size()) {
             throw uhd::key_error(
                 std::string("Invalid RX channel: ") + std::to_string(chan));
         }
-        return _rx_chans.at(chan);
+        return *_rx_chan_table[chan];
     }
 
     tx_chan_t& _get_tx_chan(const size_t chan)
     {
-        if (!_tx_chans.count(chan)) {
+        if (chan >= _tx_chan_table.size()) {
             throw uhd::key_error(
                 std::string("Invalid TX channel: ") + std::to_string(chan));
         }
-        return _tx_chans.at(chan);
+        return *_tx_chan_table[chan];
     }
 
     // private function to query multiple timekeepers
@@ -2822,12 +3046,49 @@ private:
         for (auto chan : new_chans) {
             chans.emplace(musrp_channel++, chan);
         }
+        _rebuild_chan_tables();
+    }
+
+    //! Regenerate the dense channel lookup tables from the channel maps
+    //
+    // Pointers into a std::map stay valid until the entry is erased, and the
+    // channel maps are only ever rebuilt wholesale (in the ctor and in
+    // _set_subdev_spec()), so this only needs to be called from those places.
+    void _rebuild_chan_tables()
+    {
+        _rx_chan_table.clear();
+        _rx_chan_table.reserve(_rx_chans.size());
+        for (auto& chan : _rx_chans) {
+            _rx_chan_table.push_back(&chan.second);
+        }
+        _tx_chan_table.clear();
+        _tx_chan_table.reserve(_tx_chans.size());
+        for (auto& chan : _tx_chans) {
+            _tx_chan_table.push_back(&chan.second);
+        }
     }
 
     /**************************************************************************
      * Private Attributes
      *************************************************************************/
     //! Devices args used to spawn this multi_usrp
+    //! Bump the version of one getter cache entry (or all of them, for
+    // ALL_CHANS/ALL_MBOARDS) so the next getter call refreshes its value
+    static void _invalidate_cache(
+        std::unordered_map<size_t, getter_cache_t>& cache, const size_t index)
+    {
+        if (index == ALL_CHANS) {
+            for (auto& entry : cache) {
+                entry.second.version++;
+            }
+            return;
+        }
+        auto it = cache.find(index);
+        if (it != cache.end()) {
+            it->second.version++;
+        }
+    }
+
     const uhd::device_addr_t _args;
     //! Reference to rfnoc_graph
     rfnoc_graph::sptr _graph;
@@ -2841,10 +3102,26 @@ private:
     std::map<size_t, rx_chan_t> _rx_chans;
     //! Mapping between channel number and the RFNoC blocks in that TX chain
     std::map<size_t, tx_chan_t> _tx_chans;
+    //! Dense channel tables pointing into _rx_chans/_tx_chans, so that the
+    // per-call channel resolution in _get_rx_chan()/_get_tx_chan() is a
+    // bounds check plus an array index. Rebuilt by _rebuild_chan_tables().
+    std::vector<rx_chan_t*> _rx_chan_table;
+    std::vector<tx_chan_t*> _tx_chan_table;
     //! Cache the requested RX rates
     std::unordered_map<size_t, double> _rx_rates;
     //! Cache the requested TX rates
     std::unordered_map<size_t, double> _tx_rates;
+    //! Versioned client-side caches for the hot getters, keyed by channel
+    // (by mboard for the master clock rate). Populated once in the ctor, so
+    // lookups on the read path never mutate the maps. Any multi_usrp call
+    // that can change the underlying value bumps the matching version;
+    // direct block control access (via get_block() etc.) bypasses these
+    // caches.
+    std::unordered_map<size_t, getter_cache_t> _rx_rate_cache;
+    std::unordered_map<size_t, getter_cache_t> _tx_rate_cache;
+    std::unordered_map<size_t, getter_cache_t> _rx_freq_cache;
+    std::unordered_map<size_t, getter_cache_t> _tx_freq_cache;
+    std::unordered_map<size_t, getter_cache_t> _tick_rate_cache;
 
     std::recursive_mutex _graph_mutex;
 
@@ -13,6 +13,7 @@
 #include <uhd/utils/paths.hpp>
 #include <uhd/utils/safe_call.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/transport/zero_copy_recv_offload.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
@@ -184,6 +185,11 @@ usrp1_impl::usrp1_impl(const device_addr_t& device_addr)
         2, // OUT interface, endpoint
         device_addr // param hints
     );
+    // Keep the USB transfer pipeline full from a dedicated thread so a
+    // late caller doesn't drop samples. Disable with recv_offload=0.
+    if (device_addr.cast<bool>("recv_offload", true)) {
+        _data_transport = zero_copy_recv_offload::make(_data_transport, 0.1);
+    }
     _iface          = usrp1_iface::make(_fx2_ctrl);
     _soft_time_ctrl = soft_time_ctrl::make(
         std::bind(&usrp1_impl::rx_stream_on_off, this, std::placeholders::_1));
@@ -77,7 +77,7 @@ private:
     uhd::usrp::fx2_ctrl::sptr _fx2_ctrl;
     usrp1_iface::sptr _iface;
     uhd::usrp::soft_time_ctrl::sptr _soft_time_ctrl;
-    uhd::transport::usb_zero_copy::sptr _data_transport;
+    uhd::transport::zero_copy_if::sptr _data_transport;
     struct db_container_type
     {
         usrp1_codec_ctrl::sptr codec;
@@ -517,6 +517,17 @@ rx_streamer::sptr usrp2_impl::get_rx_stream(const uhd::stream_args_t& args_)
         }
     }
 
+    // optionally pre-stage packets with one worker thread per channel, so
+    // multi-channel alignment does not serialize on the slowest link
+    if (args.args.has_key("recv_prefetch")) {
+        my_streamer->set_channel_prefetch(args.args.cast<size_t>("recv_prefetch", 4));
+    }
+
+    // optionally absorb out-of-order packets ahead of the alignment logic
+    if (args.args.has_key("recv_reorder")) {
+        my_streamer->set_reorder_depth(args.args.cast<size_t>("recv_reorder", 4));
+    }
+
     // set the packet threshold to be an entire socket buffer's worth
     const size_t packets_per_sock_buff =
         size_t(50e6 / _mbc[_mbc.keys().front()].rx_dsp_xports[0]->get_recv_frame_size());
@@ -598,6 +609,19 @@ tx_streamer::sptr usrp2_impl::get_tx_stream(const uhd::stream_args_t& args_)
         }
     }
 
+    // optionally prefetch the next send buffer at commit time, so the
+    // per-packet fetch leaves the dependency chain
+    if (args.args.has_key("send_pipeline")) {
+        my_streamer->set_pipelined_sends(args.args.cast<size_t>("send_pipeline", 1) != 0);
+    }
+
+    // optionally busy-poll for send buffers to dodge scheduler wakeup
+    // jitter ahead of timed bursts
+    if (args.args.has_key("send_spin_wait")) {
+        my_streamer->set_spin_wait_send(
+            args.args.cast<size_t>("send_spin_wait", 1) != 0);
+    }
+
     // sets all tick and samp rates on this streamer
     this->update_rates();
 
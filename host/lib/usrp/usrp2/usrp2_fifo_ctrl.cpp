@@ -21,7 +21,15 @@ static const size_t POKE32_CMD      = (1 << 8);
 static const size_t PEEK32_CMD      = 0;
 static const double ACK_TIMEOUT     = 0.5;
 static const double MASSIVE_TIMEOUT = 10.0; // for when we wait on a timed command
-static const uint32_t MAX_SEQS_OUT  = 63;
+
+// The FPGA fifo ctrl processes exactly one command per VRT packet and replies
+// with one ack packet, so multiple pokes cannot be packed into a single
+// datagram. Instead, pokes stream back-to-back with acks collected lazily: a
+// poke only blocks once more than MAX_SEQS_OUT commands are outstanding, so a
+// burst of register writes (e.g. a tune sequence) goes out at link rate
+// rather than paying one round trip per write. Peeks always wait for their
+// own ack, draining all outstanding commands in the process.
+static const uint32_t MAX_SEQS_OUT = 63;
 
 #define SPI_DIV      SR_SPI_CORE + 0
 #define SPI_CTRL     SR_SPI_CORE + 1
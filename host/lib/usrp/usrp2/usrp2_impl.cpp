@@ -20,6 +20,7 @@
 #include <boost/format.hpp>
 #include <cmath>
 #include <functional>
+#include <future>
 
 using namespace uhd;
 using namespace uhd::usrp;
@@ -72,6 +73,9 @@ device_addrs_t usrp2_find(const device_addr_t& hint_)
 
     // if no address was specified, send a broadcast on each interface
     if (not hint.has_key("addr")) {
+        // Each probe waits out the full discovery timeout, so run all
+        // interfaces in parallel
+        std::vector<std::future<device_addrs_t>> find_tasks;
         for (const if_addrs_t& if_addrs : get_if_addrs()) {
             // avoid the loopback device
             if (if_addrs.inet == boost::asio::ip::address_v4::loopback().to_string())
@@ -81,8 +85,12 @@ device_addrs_t usrp2_find(const device_addr_t& hint_)
             device_addr_t new_hint = hint;
             new_hint["addr"]       = if_addrs.bcast;
 
-            // call discover with the new hint and append results
-            device_addrs_t new_usrp2_addrs = usrp2_find(new_hint);
+            // call discover with the new hint
+            find_tasks.emplace_back(std::async(
+                std::launch::async, [new_hint]() { return usrp2_find(new_hint); }));
+        }
+        for (auto& find_task : find_tasks) {
+            const device_addrs_t new_usrp2_addrs = find_task.get();
             usrp2_addrs.insert(
                 usrp2_addrs.begin(), new_usrp2_addrs.begin(), new_usrp2_addrs.end());
         }
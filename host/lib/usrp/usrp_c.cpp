@@ -68,6 +68,20 @@ struct uhd_rx_streamer
     std::string last_error;
 };
 
+struct uhd_rx_streamer_fast
+{
+    uhd::rx_streamer* streamer;
+    uhd_rx_streamer_handle parent;
+    std::vector<void*> buffs;
+};
+
+struct uhd_tx_streamer_fast
+{
+    uhd::tx_streamer* streamer;
+    uhd_tx_streamer_handle parent;
+    std::vector<const void*> buffs;
+};
+
 /* Not public: We use this for our internal registry */
 struct usrp_ptr
 {
@@ -139,6 +153,51 @@ uhd_error uhd_rx_streamer_last_error(
                strncpy(error_out, h->last_error.c_str(), strbuffer_len);)
 }
 
+uhd_error uhd_rx_streamer_fast_make(
+    uhd_rx_streamer_handle h, void** buffs, uhd_rx_streamer_fast_handle* fh_out)
+{
+    UHD_SAFE_C_SAVE_ERROR(
+        h, const size_t num_channels = h->streamer->get_num_channels();
+        (*fh_out)           = new uhd_rx_streamer_fast;
+        (*fh_out)->streamer = h->streamer.get();
+        (*fh_out)->parent   = h;
+        (*fh_out)->buffs.assign(buffs, buffs + num_channels);)
+}
+
+uhd_error uhd_rx_streamer_fast_free(uhd_rx_streamer_fast_handle* fh)
+{
+    UHD_SAFE_C(delete (*fh); (*fh) = NULL;)
+}
+
+uhd_error uhd_rx_streamer_recv_fast(uhd_rx_streamer_fast_handle fh,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle* md,
+    double timeout,
+    bool one_packet,
+    size_t* items_recvd)
+{
+    /* Unlike UHD_SAFE_C_SAVE_ERROR, the success path performs no error
+     * string bookkeeping at all; the fast handle exists to keep this call
+     * free of per-call string and handle overhead. */
+    try {
+        *items_recvd = fh->streamer->recv(
+            fh->buffs, samps_per_buff, (*md)->rx_metadata_cpp, timeout, one_packet);
+        return UHD_ERROR_NONE;
+    } catch (const uhd::exception& e) {
+        set_c_global_error_string(e.what());
+        fh->parent->last_error = e.what();
+        return error_from_uhd_exception(&e);
+    } catch (const std::exception& e) {
+        set_c_global_error_string(e.what());
+        fh->parent->last_error = e.what();
+        return UHD_ERROR_STDEXCEPT;
+    } catch (...) {
+        set_c_global_error_string("Unrecognized exception caught.");
+        fh->parent->last_error = "Unrecognized exception caught.";
+        return UHD_ERROR_UNKNOWN;
+    }
+}
+
 /****************************************************************************
  * TX Streamer
  ***************************************************************************/
@@ -196,6 +255,49 @@ uhd_error uhd_tx_streamer_last_error(
                strncpy(error_out, h->last_error.c_str(), strbuffer_len);)
 }
 
+uhd_error uhd_tx_streamer_fast_make(
+    uhd_tx_streamer_handle h, const void** buffs, uhd_tx_streamer_fast_handle* fh_out)
+{
+    UHD_SAFE_C_SAVE_ERROR(
+        h, const size_t num_channels = h->streamer->get_num_channels();
+        (*fh_out)           = new uhd_tx_streamer_fast;
+        (*fh_out)->streamer = h->streamer.get();
+        (*fh_out)->parent   = h;
+        (*fh_out)->buffs.assign(buffs, buffs + num_channels);)
+}
+
+uhd_error uhd_tx_streamer_fast_free(uhd_tx_streamer_fast_handle* fh)
+{
+    UHD_SAFE_C(delete (*fh); (*fh) = NULL;)
+}
+
+uhd_error uhd_tx_streamer_send_fast(uhd_tx_streamer_fast_handle fh,
+    size_t samps_per_buff,
+    uhd_tx_metadata_handle* md,
+    double timeout,
+    size_t* items_sent)
+{
+    /* See uhd_rx_streamer_recv_fast() for why this does not use
+     * UHD_SAFE_C_SAVE_ERROR */
+    try {
+        *items_sent = fh->streamer->send(
+            fh->buffs, samps_per_buff, (*md)->tx_metadata_cpp, timeout);
+        return UHD_ERROR_NONE;
+    } catch (const uhd::exception& e) {
+        set_c_global_error_string(e.what());
+        fh->parent->last_error = e.what();
+        return error_from_uhd_exception(&e);
+    } catch (const std::exception& e) {
+        set_c_global_error_string(e.what());
+        fh->parent->last_error = e.what();
+        return UHD_ERROR_STDEXCEPT;
+    } catch (...) {
+        set_c_global_error_string("Unrecognized exception caught.");
+        fh->parent->last_error = "Unrecognized exception caught.";
+        return UHD_ERROR_UNKNOWN;
+    }
+}
+
 /****************************************************************************
  * Generate / Destroy API calls
  ***************************************************************************/
@@ -30,6 +30,7 @@ public:
         , _ext_adc_self_test_duration(
               "ext_adc_self_test", DEFAULT_EXT_ADC_SELF_TEST_DURATION)
         , _recover_mb_eeprom("recover_mb_eeprom", false)
+        , _use_eeprom_cache("eeprom_cache", false)
         , _ignore_cal_file("ignore_cal_file", false)
         , _niusrprio_rpc_port("niusrprio_rpc_port", NIUSRPRIO_DEFAULT_RPC_PORT)
         , _has_fw_file("fw", false)
@@ -89,6 +90,10 @@ public:
     {
         return _recover_mb_eeprom.get();
     }
+    bool get_use_eeprom_cache() const
+    {
+        return _use_eeprom_cache.get();
+    }
     bool get_ignore_cal_file() const
     {
         return _ignore_cal_file.get();
@@ -242,6 +247,7 @@ private:
             }
         }
         PARSE_DEFAULT(_recover_mb_eeprom)
+        PARSE_DEFAULT(_use_eeprom_cache)
         PARSE_DEFAULT(_ignore_cal_file)
         PARSE_DEFAULT(_niusrprio_rpc_port)
         if (dev_args.has_key("fw")) {
@@ -283,6 +289,7 @@ private:
     constrained_device_args_t::bool_arg _ext_adc_self_test;
     constrained_device_args_t::num_arg<double> _ext_adc_self_test_duration;
     constrained_device_args_t::bool_arg _recover_mb_eeprom;
+    constrained_device_args_t::bool_arg _use_eeprom_cache;
     constrained_device_args_t::bool_arg _ignore_cal_file;
     constrained_device_args_t::num_arg<size_t> _niusrprio_rpc_port;
     constrained_device_args_t::bool_arg _has_fw_file;
@@ -29,6 +29,9 @@
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_LIBURING
+#    include <uhdlib/transport/udp_iouring_link.hpp>
+#endif
 #include <boost/asio.hpp>
 #include <string>
 
@@ -285,11 +288,32 @@ both_links_t eth_manager::get_links(link_type_t link_type,
         UHD_LOG_WARNING("X300", "Cannot create DPDK transport, falling back to UDP");
 #endif
     }
+#ifdef HAVE_LIBURING
+    const std::string transport_arg =
+        link_args.get("transport", _args.get_orig_args().get("transport", ""));
+    if (transport_arg == "io_uring") {
+        auto link = uhd::transport::udp_iouring_link::make(conn.addr,
+            BOOST_STRINGIZE(X300_VITA_UDP_PORT),
+            link_params,
+            link_params.recv_buff_size,
+            link_params.send_buff_size);
+        return std::make_tuple(link,
+            link_params.send_buff_size,
+            link,
+            link_params.recv_buff_size,
+            lossy_xport,
+            false,
+            enable_fc);
+    }
+#endif
+    const bool recv_batching = uhd::cast::from_str<bool>(link_args.get(
+        "udp_batching", _args.get_orig_args().get("udp_batching", "0")));
     auto link = uhd::transport::udp_boost_asio_link::make(conn.addr,
         BOOST_STRINGIZE(X300_VITA_UDP_PORT),
         link_params,
         link_params.recv_buff_size,
-        link_params.send_buff_size);
+        link_params.send_buff_size,
+        recv_batching);
     return std::make_tuple(link,
         link_params.send_buff_size,
         link,
@@ -24,9 +24,11 @@
 #include <uhd/utils/static.hpp>
 #include <uhdlib/rfnoc/device_id.hpp>
 #include <uhdlib/utils/compat_check.hpp>
+#include <uhdlib/utils/eeprom_cache.hpp>
 #include <uhdlib/utils/paths.hpp>
 #include <chrono>
 #include <fstream>
+#include <future>
 #include <thread>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk/common.hpp>
@@ -304,20 +306,40 @@ void x300_impl::setup_mb(const size_t mb_i, const uhd::device_addr_t& dev_addr)
     UHD_LOGGER_DEBUG("X300") << "Loading values from EEPROM...";
     x300_mb_eeprom_iface::sptr eeprom16 =
         x300_mb_eeprom_iface::make(mb.zpu_ctrl, mb.zpu_i2c);
+    const std::string eeprom_cache_label =
+        "x300_"
+        + (mb.args.get_resource().empty() ? mb.args.get_first_addr()
+                                          : mb.args.get_resource());
     if (mb.args.get_blank_eeprom()) {
         UHD_LOGGER_WARNING("X300") << "Obliterating the motherboard EEPROM...";
         eeprom16->write_eeprom(0x50, 0, byte_vector_t(256, 0xff));
+        uhd::eeprom_cache::invalidate(eeprom_cache_label);
     }
 
-    const mboard_eeprom_t mb_eeprom = get_mb_eeprom(eeprom16);
+    // The host-side EEPROM cache is only trustworthy when we're not about to
+    // modify or recover the EEPROM contents
+    const bool use_eeprom_cache = mb.args.get_use_eeprom_cache()
+                                  and not mb.args.get_blank_eeprom()
+                                  and not mb.args.get_recover_mb_eeprom();
+    mboard_eeprom_t mb_eeprom;
+    if (not use_eeprom_cache
+        or not uhd::eeprom_cache::load(eeprom_cache_label, mb_eeprom)) {
+        mb_eeprom = get_mb_eeprom(eeprom16);
+        if (use_eeprom_cache) {
+            uhd::eeprom_cache::store(eeprom_cache_label, mb_eeprom);
+        }
+    }
     _tree
         ->create<mboard_eeprom_t>(mb_path / "eeprom")
         // Initialize the property with a current copy of the EEPROM contents
         .set(mb_eeprom)
         // Whenever this property is written, update the chip
-        .add_coerced_subscriber([eeprom16](const mboard_eeprom_t& mb_eeprom) {
-            set_mb_eeprom(eeprom16, mb_eeprom);
-        });
+        .add_coerced_subscriber(
+            [eeprom16, eeprom_cache_label](const mboard_eeprom_t& mb_eeprom) {
+                // The host-side copy no longer matches the hardware
+                uhd::eeprom_cache::invalidate(eeprom_cache_label);
+                set_mb_eeprom(eeprom16, mb_eeprom);
+            });
 
     if (mb.args.get_recover_mb_eeprom()) {
         UHD_LOGGER_WARNING("X300")
@@ -347,6 +369,44 @@ void x300_impl::setup_mb(const size_t mb_i, const uhd::device_addr_t& dev_addr)
     ////////////////////////////////////////////////////////////////////
     // discover interfaces, frame sizes, and link rates
     ////////////////////////////////////////////////////////////////////
+    // The default daughterboard clock rate may have to be overridden. This is due to the
+    // limitation on X300 devices where both daughterboards must use the same clock rate.
+    // The daughterboards that require specific clock rates are UBX and TwinRX. TwinRX
+    // requires a clock rate of 100 MHz for the best RF performance. UBX daughterboards
+    // require a clock rate of no more than the max pfd frequency to maintain phase
+    // synchronization. If there is no UBX, the default daughterboard clock rate is half
+    // of the master clock rate for X300.
+    // Determining this requires reading all daughterboard EEPROMs over I2C,
+    // which is slow, so overlap it with the link bring-up below. This is safe
+    // because the I2C transactions go through the ZPU control interface, which
+    // is already shared with the concurrently running claimer task.
+    std::future<double> dboard_clock_rate_task =
+        std::async(std::launch::async, [dev_addr, mb]() -> double {
+            // Do not override use-specified dboard clock rates
+            if (dev_addr.has_key("dboard_clock_rate")) {
+                return mb.args.get_dboard_clock_rate();
+            }
+            const double mcr         = mb.args.get_master_clock_rate();
+            double dboard_clock_rate = mb.args.get_dboard_clock_rate();
+            // Check for UBX daughterboards
+            std::vector<dboard_id_t> dboard_ids = get_dboard_ids(*mb.zpu_i2c);
+            for (dboard_id_t dboard_id : dboard_ids) {
+                if (std::find(dboard::ubx::ubx_ids.begin(),
+                        dboard::ubx::ubx_ids.end(),
+                        dboard_id)
+                    != dboard::ubx::ubx_ids.end()) {
+                    double ubx_clock_rate = mcr;
+                    for (int i = 2;
+                         ubx_clock_rate > dboard::ubx::get_max_pfd_freq(dboard_id);
+                         i++) {
+                        ubx_clock_rate = mcr / i;
+                    }
+                    dboard_clock_rate = std::min(dboard_clock_rate, ubx_clock_rate);
+                }
+            }
+            return dboard_clock_rate;
+        });
+
     if (mb.xport_path == xport_path_t::NIRIO) {
         std::dynamic_pointer_cast<pcie_manager>(mb.conn_mgr)->init_link();
     } else if (mb.xport_path == xport_path_t::ETH) {
@@ -364,36 +424,7 @@ void x300_impl::setup_mb(const size_t mb_i, const uhd::device_addr_t& dev_addr)
     ////////////////////////////////////////////////////////////////////
     UHD_LOGGER_DEBUG("X300") << "Setting up RF frontend clocking...";
 
-    // The default daughterboard clock rate may have to be overridden. This is due to the
-    // limitation on X300 devices where both daughterboards must use the same clock rate.
-    // The daughterboards that require specific clock rates are UBX and TwinRX. TwinRX
-    // requires a clock rate of 100 MHz for the best RF performance. UBX daughterboards
-    // require a clock rate of no more than the max pfd frequency to maintain phase
-    // synchronization. If there is no UBX, the default daughterboard clock rate is half
-    // of the master clock rate for X300.
-    const double x300_dboard_clock_rate = [dev_addr, mb]() -> double {
-        // Do not override use-specified dboard clock rates
-        if (dev_addr.has_key("dboard_clock_rate")) {
-            return mb.args.get_dboard_clock_rate();
-        }
-        const double mcr         = mb.args.get_master_clock_rate();
-        double dboard_clock_rate = mb.args.get_dboard_clock_rate();
-        // Check for UBX daughterboards
-        std::vector<dboard_id_t> dboard_ids = get_dboard_ids(*mb.zpu_i2c);
-        for (dboard_id_t dboard_id : dboard_ids) {
-            if (std::find(
-                    dboard::ubx::ubx_ids.begin(), dboard::ubx::ubx_ids.end(), dboard_id)
-                != dboard::ubx::ubx_ids.end()) {
-                double ubx_clock_rate = mcr;
-                for (int i = 2; ubx_clock_rate > dboard::ubx::get_max_pfd_freq(dboard_id);
-                     i++) {
-                    ubx_clock_rate = mcr / i;
-                }
-                dboard_clock_rate = std::min(dboard_clock_rate, ubx_clock_rate);
-            }
-        }
-        return dboard_clock_rate;
-    }();
+    const double x300_dboard_clock_rate = dboard_clock_rate_task.get();
 
     // Initialize clock control registers.
     // NOTE: This does not configure the LMK yet.
@@ -217,7 +217,7 @@ uhd::rfnoc::chdr_rx_data_xport::uptr x300_impl::x300_mb_iface::make_rx_data_tran
         packet_fc ? static_cast<uint32_t>(recv_link->get_num_recv_frames())
                   : uhd::rfnoc::MAX_FC_CAPACITY_PKTS};
 
-    const double ratio = 1.0 / 32;
+    const double ratio = xport_args.cast<double>("fc_freq_ratio", 1.0 / 32);
 
     uhd::rfnoc::stream_buff_params_t fc_freq;
     if (enable_fc) {
@@ -276,6 +276,7 @@ uhd::rfnoc::chdr_rx_data_xport::uptr x300_impl::x300_mb_iface::make_rx_data_tran
         epids,
         recv_link->get_num_recv_frames(),
         fc_params,
+        xport_args.get("fc_poller", "0") == "1",
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
         });
@@ -335,6 +336,7 @@ uhd::rfnoc::chdr_tx_data_xport::uptr x300_impl::x300_mb_iface::make_tx_data_tran
         mdata_buff_fmt,
         fc_freq_ratio,
         fc_headroom_ratio,
+        xport_args,
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
         });
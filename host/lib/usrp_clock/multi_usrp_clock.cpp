@@ -10,7 +10,9 @@
 #include <uhd/usrp_clock/multi_usrp_clock.hpp>
 #include <uhd/usrp_clock/octoclock_eeprom.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/usrp/common/parallel_fan_out.hpp>
 #include <boost/format.hpp>
+#include <map>
 
 using namespace uhd;
 using namespace uhd::usrp_clock;
@@ -71,6 +73,23 @@ public:
         return _tree->list(board_str / "sensors");
     }
 
+    std::vector<std::map<std::string, sensor_value_t>> get_status(void) override
+    {
+        const size_t num_boards = get_num_boards();
+        std::vector<std::map<std::string, sensor_value_t>> status(num_boards);
+        // Each board has its own control transport, so the probes can run
+        // concurrently; within a board the sensors are read sequentially
+        uhd::usrp::parallel_fan_out(
+            num_boards,
+            [this, &status](const size_t board) {
+                for (const std::string& name : get_sensor_names(board)) {
+                    status[board].emplace(name, get_sensor(name, board));
+                }
+            },
+            "board");
+        return status;
+    }
+
 private:
     device::sptr _dev;
     property_tree::sptr _tree;
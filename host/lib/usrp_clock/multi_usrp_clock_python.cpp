@@ -29,6 +29,7 @@ void export_multi_usrp_clock(py::module& m)
         .def("get_time"                , &multi_usrp_clock::get_time, py::arg("board") = 0)
         .def("get_sensor"              , &multi_usrp_clock::get_sensor, py::arg("name"), py::arg("board") = 0)
         .def("get_sensor_names"        , &multi_usrp_clock::get_sensor_names, py::arg("board") = 0)
+        .def("get_status"              , &multi_usrp_clock::get_status, py::call_guard<py::gil_scoped_release>())
         // clang-format off
         ;
     // clang-format on
@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/alloc_sentinel.hpp>
+
+#ifdef UHD_ALLOC_SENTINEL
+
+#    include <uhd/utils/log.hpp>
+#    include <cstdlib>
+#    include <new>
+#    include <sstream>
+#    if defined(__GLIBC__)
+#        include <execinfo.h>
+#    endif
+
+namespace {
+
+constexpr char LOG_ID[] = "ALLOC_SENTINEL";
+
+//! Number of stack frames captured for a violation report
+constexpr int MAX_BACKTRACE_FRAMES = 32;
+
+thread_local int armed_depth           = 0;
+thread_local const char* armed_context = nullptr;
+//! Suppresses recursion while a violation is being reported (the report
+//! itself allocates)
+thread_local bool reporting = false;
+
+void report_violation(const std::size_t size)
+{
+    reporting = true;
+    std::ostringstream report;
+    report << "Allocation of " << size << " bytes inside zero-allocation section '"
+           << (armed_context ? armed_context : "?") << "'";
+#    if defined(__GLIBC__)
+    void* frames[MAX_BACKTRACE_FRAMES];
+    const int num_frames = backtrace(frames, MAX_BACKTRACE_FRAMES);
+    char** symbols       = backtrace_symbols(frames, num_frames);
+    if (symbols != nullptr) {
+        for (int i = 0; i < num_frames; i++) {
+            report << "\n    " << symbols[i];
+        }
+        std::free(symbols);
+    }
+#    endif
+    UHD_LOG_WARNING(LOG_ID, report.str());
+    reporting = false;
+}
+
+void on_allocation(const std::size_t size)
+{
+    if (armed_depth > 0 and not reporting) {
+        report_violation(size);
+    }
+}
+
+} // namespace
+
+namespace uhd { namespace alloc_sentinel {
+
+scope_guard::scope_guard(const char* context) : _prev_context(armed_context)
+{
+    armed_context = context;
+    armed_depth++;
+}
+
+scope_guard::~scope_guard()
+{
+    armed_depth--;
+    armed_context = _prev_context;
+}
+
+}} // namespace uhd::alloc_sentinel
+
+// Global allocation hooks: route every allocation past the sentinel. The
+// matching deletes are replaced as well so that allocation and release
+// always pair malloc with free.
+void* operator new(std::size_t size)
+{
+    void* ptr = std::malloc(size ? size : 1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    on_allocation(size);
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#endif /* UHD_ALLOC_SENTINEL */
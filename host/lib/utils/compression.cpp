@@ -0,0 +1,121 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/compression.hpp>
+#ifdef HAVE_LZ4
+#    include <lz4frame.h>
+#endif
+#ifdef HAVE_ZSTD
+#    include <zstd.h>
+#endif
+
+using namespace uhd;
+
+namespace {
+
+#ifdef HAVE_LZ4
+class lz4_compressor : public chunk_compressor
+{
+public:
+    lz4_compressor(const int level) : _prefs(LZ4F_preferences_t())
+    {
+        _prefs.compressionLevel = level;
+    }
+
+    size_t bound(size_t nbytes) const override
+    {
+        return LZ4F_compressFrameBound(nbytes, &_prefs);
+    }
+
+    size_t compress(
+        void* dst, size_t dst_capacity, const void* src, size_t nbytes) override
+    {
+        const size_t result =
+            LZ4F_compressFrame(dst, dst_capacity, src, nbytes, &_prefs);
+        if (LZ4F_isError(result)) {
+            throw uhd::runtime_error(std::string("LZ4 compression failed: ")
+                                     + LZ4F_getErrorName(result));
+        }
+        return result;
+    }
+
+private:
+    LZ4F_preferences_t _prefs;
+};
+#endif /* HAVE_LZ4 */
+
+#ifdef HAVE_ZSTD
+class zstd_compressor : public chunk_compressor
+{
+public:
+    zstd_compressor(const int level)
+        : _ctx(ZSTD_createCCtx()), _level(level == 0 ? ZSTD_CLEVEL_DEFAULT : level)
+    {
+        if (not _ctx) {
+            throw uhd::runtime_error(
+                "zstd: could not allocate a compression context");
+        }
+    }
+
+    ~zstd_compressor() override
+    {
+        ZSTD_freeCCtx(_ctx);
+    }
+
+    size_t bound(size_t nbytes) const override
+    {
+        return ZSTD_compressBound(nbytes);
+    }
+
+    size_t compress(
+        void* dst, size_t dst_capacity, const void* src, size_t nbytes) override
+    {
+        const size_t result =
+            ZSTD_compressCCtx(_ctx, dst, dst_capacity, src, nbytes, _level);
+        if (ZSTD_isError(result)) {
+            throw uhd::runtime_error(std::string("zstd compression failed: ")
+                                     + ZSTD_getErrorName(result));
+        }
+        return result;
+    }
+
+private:
+    ZSTD_CCtx* _ctx;
+    const int _level;
+};
+#endif /* HAVE_ZSTD */
+
+} // namespace
+
+chunk_compressor::sptr chunk_compressor::make(const std::string& codec, int level)
+{
+#ifdef HAVE_LZ4
+    if (codec == "lz4") {
+        return std::make_shared<lz4_compressor>(level);
+    }
+#endif
+#ifdef HAVE_ZSTD
+    if (codec == "zstd") {
+        return std::make_shared<zstd_compressor>(level);
+    }
+#endif
+    (void)level;
+    throw uhd::runtime_error(
+        "Compression codec not available in this build: " + codec);
+}
+
+std::vector<std::string> chunk_compressor::get_available_codecs(void)
+{
+    std::vector<std::string> codecs;
+#ifdef HAVE_LZ4
+    codecs.push_back("lz4");
+#endif
+#ifdef HAVE_ZSTD
+    codecs.push_back("zstd");
+#endif
+    return codecs;
+}
@@ -33,6 +33,15 @@ void config_parser::read_file(const std::string& path)
     }
 }
 
+void config_parser::save_file(const std::string& path)
+{
+    try {
+        boost::property_tree::ini_parser::write_ini(path, _pt);
+    } catch (const boost::property_tree::ini_parser_error&) {
+        throw uhd::runtime_error(str(boost::format("Unable to write file %s") % path));
+    }
+}
+
 std::vector<std::string> config_parser::sections()
 {
     try {
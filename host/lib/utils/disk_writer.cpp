@@ -0,0 +1,432 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/compression.hpp>
+#include <uhd/utils/disk_writer.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef UHD_PLATFORM_WIN32
+#    include <cstdio>
+#else
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <sys/types.h>
+#    include <unistd.h>
+#endif
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[] = "DISK_WRITER";
+
+// Covers both 512 B and 4 KiB logical sector sizes for O_DIRECT
+constexpr size_t IO_ALIGNMENT = 4096;
+
+class disk_writer_impl : public disk_writer
+{
+public:
+    disk_writer_impl(const config_t& config)
+        : _block_size(config.block_size)
+        , _num_blocks(config.num_blocks)
+        , _compress(not config.compression.empty())
+    {
+        if (_block_size == 0 or _block_size % IO_ALIGNMENT != 0) {
+            throw uhd::value_error(
+                "disk_writer: block_size must be a non-zero multiple of "
+                + std::to_string(IO_ALIGNMENT));
+        }
+        if (_num_blocks < 2) {
+            throw uhd::value_error("disk_writer: num_blocks must be at least 2");
+        }
+        if (_compress) {
+            // One single-threaded codec instance per compressor thread; this
+            // throws before any file is touched if the codec is unavailable
+            const size_t num_threads = std::max<size_t>(1, config.compression_threads);
+            for (size_t i = 0; i < num_threads; i++) {
+                _codecs.push_back(chunk_compressor::make(
+                    config.compression, config.compression_level));
+            }
+        }
+
+        _open_file(config);
+        _alloc_ring();
+
+        if (_compress) {
+            // Compressed blocks are variable-size, so they get their own
+            // output buffers, sized for the worst case
+            const size_t comp_bound = _codecs.front()->bound(_block_size);
+            _comp_bufs.resize(_num_blocks);
+            for (auto& buf : _comp_bufs) {
+                buf.resize(comp_bound);
+            }
+            _comp_sizes.resize(_num_blocks, 0);
+            _comp_ready.assign(_num_blocks, 0);
+            for (size_t i = 0; i < _codecs.size(); i++) {
+                _compressors.emplace_back([this, i]() { this->_compress_loop(i); });
+                uhd::set_thread_name(&_compressors.back(), "uhd_disk_comp");
+            }
+            _worker = std::thread([this]() { this->_write_loop_compressed(); });
+        } else {
+            _worker = std::thread([this]() { this->_write_loop(); });
+        }
+        uhd::set_thread_name(&_worker, "uhd_disk_wr");
+    }
+
+    ~disk_writer_impl() override
+    {
+        try {
+            close();
+        } catch (const uhd::exception& e) {
+            UHD_LOG_ERROR(LOG_ID, "Error on close: " << e.what());
+        }
+    }
+
+    size_t write(const void* buff, size_t nbytes) override
+    {
+        const char* src = static_cast<const char*>(buff);
+        size_t accepted = 0;
+
+        while (accepted < nbytes) {
+            if (_produce_count - _consume_count.load(std::memory_order_acquire)
+                >= _num_blocks) {
+                // Ring full: drop the rest rather than stall the receiver
+                _bytes_dropped += nbytes - accepted;
+                break;
+            }
+
+            char* block = _ring + (_produce_count % _num_blocks) * _block_size;
+            const size_t ncopy = std::min(nbytes - accepted, _block_size - _fill);
+            std::memcpy(block + _fill, src + accepted, ncopy);
+            _fill += ncopy;
+            accepted += ncopy;
+
+            if (_fill == _block_size) {
+                _fill = 0;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _produce_count++;
+                }
+                // notify_all: with compression there are several waiters
+                _cv.notify_all();
+            }
+        }
+        return accepted;
+    }
+
+    uint64_t get_bytes_written() const override
+    {
+        return _bytes_written;
+    }
+
+    uint64_t get_bytes_dropped() const override
+    {
+        return _bytes_dropped;
+    }
+
+    void close() override
+    {
+        if (not _worker.joinable()) {
+            return;
+        }
+        // Drain full blocks, then stop the workers
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        for (auto& compressor : _compressors) {
+            compressor.join();
+        }
+        _compressors.clear();
+        _worker.join();
+
+        if (_compress) {
+            // The tail block gets its own (smaller) frame; buffered I/O
+            // needs no alignment padding
+            if (_fill > 0 and not _write_failed) {
+                const char* block = _ring + (_produce_count % _num_blocks) * _block_size;
+                auto& out         = _comp_bufs[_produce_count % _num_blocks];
+                try {
+                    const size_t nbytes =
+                        _codecs.front()->compress(out.data(), out.size(), block, _fill);
+                    _write_block(out.data(), nbytes);
+                } catch (const uhd::exception& e) {
+                    UHD_LOG_ERROR(LOG_ID, "Compression failed: " << e.what());
+                    _write_failed = true;
+                }
+            }
+        } else if (_fill > 0 and not _write_failed) {
+            // Write the partial tail block, padded up to the I/O alignment,
+            // then trim the file back to the true data length
+            char* block = _ring + (_produce_count % _num_blocks) * _block_size;
+            const size_t padded = ((_fill + IO_ALIGNMENT - 1) / IO_ALIGNMENT)
+                                  * IO_ALIGNMENT;
+            std::memset(block + _fill, 0, padded - _fill);
+            _write_block(block, padded);
+            _bytes_written = _bytes_written - padded + _fill;
+        }
+        _close_file();
+
+        if (_write_failed) {
+            throw uhd::io_error("disk_writer: a disk write failed during capture");
+        }
+    }
+
+private:
+    void _write_loop()
+    {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() {
+                    return _stop or _produce_count > _consume_count;
+                });
+                if (_consume_count == _produce_count and _stop) {
+                    return;
+                }
+            }
+            char* block = _ring + (_consume_count % _num_blocks) * _block_size;
+            _write_block(block, _block_size);
+            _consume_count.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    //! Claim raw ring blocks in order and compress each into its output
+    // buffer (one of several such threads)
+    void _compress_loop(const size_t codec_idx)
+    {
+        while (true) {
+            uint64_t index = 0;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() {
+                    return _stop or _compress_next < _produce_count;
+                });
+                if (_compress_next == _produce_count) {
+                    return; // stopped and nothing left to claim
+                }
+                index = _compress_next++;
+            }
+            const char* raw = _ring + (index % _num_blocks) * _block_size;
+            auto& out       = _comp_bufs[index % _num_blocks];
+            size_t nbytes   = 0;
+            try {
+                nbytes = _codecs[codec_idx]->compress(
+                    out.data(), out.size(), raw, _block_size);
+            } catch (const uhd::exception& e) {
+                UHD_LOG_ERROR(LOG_ID, "Compression failed: " << e.what());
+                _write_failed = true;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _comp_sizes[index % _num_blocks] = nbytes;
+                _comp_ready[index % _num_blocks] = 1;
+            }
+            _cv.notify_all();
+        }
+    }
+
+    //! Write compressed frames to disk in block order. Blocks may finish
+    // compressing out of order; this waits for the next-in-order one.
+    void _write_loop_compressed()
+    {
+        while (true) {
+            size_t nbytes = 0;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() {
+                    return _comp_ready[_consume_count % _num_blocks]
+                           or (_stop and _produce_count == _consume_count);
+                });
+                const size_t slot = _consume_count % _num_blocks;
+                if (not _comp_ready[slot]) {
+                    return; // stopped and drained
+                }
+                _comp_ready[slot] = 0;
+                nbytes            = _comp_sizes[slot];
+            }
+            if (nbytes > 0) {
+                _write_block(_comp_bufs[_consume_count % _num_blocks].data(), nbytes);
+            }
+            _consume_count.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    void _write_block(const char* block, const size_t nbytes)
+    {
+        if (_write_failed) {
+            _bytes_dropped += nbytes;
+            return;
+        }
+#ifdef UHD_PLATFORM_WIN32
+        if (std::fwrite(block, 1, nbytes, _file) != nbytes) {
+            _write_failed = true;
+            UHD_LOG_ERROR(LOG_ID, "Disk write failed");
+            return;
+        }
+#else
+        size_t written = 0;
+        while (written < nbytes) {
+            const ssize_t ret = ::write(_fd, block + written, nbytes - written);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                _write_failed = true;
+                UHD_LOG_ERROR(
+                    LOG_ID, "Disk write failed: " << std::strerror(errno));
+                return;
+            }
+            written += ret;
+        }
+#endif
+        _bytes_written += nbytes;
+    }
+
+    void _open_file(const config_t& config)
+    {
+#ifdef UHD_PLATFORM_WIN32
+        _file = std::fopen(config.path.c_str(), "wb");
+        if (not _file) {
+            throw uhd::io_error("disk_writer: could not open " + config.path);
+        }
+#else
+        // Compressed frames are variable-size and not sector-aligned, so
+        // compression always uses buffered I/O
+        const bool direct_io = config.direct_io and not _compress;
+        int flags            = O_WRONLY | O_CREAT | O_TRUNC;
+#    ifdef O_DIRECT
+        if (direct_io) {
+            flags |= O_DIRECT;
+        }
+#    endif
+        _fd = ::open(config.path.c_str(), flags, 0644);
+#    ifdef O_DIRECT
+        if (_fd < 0 and direct_io and errno == EINVAL) {
+            // Filesystem rejects O_DIRECT (e.g. tmpfs): fall back to buffered
+            UHD_LOG_WARNING(LOG_ID,
+                "O_DIRECT not supported on this filesystem, "
+                "falling back to buffered I/O");
+            _fd = ::open(
+                config.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        }
+#    endif
+        if (_fd < 0) {
+            throw uhd::io_error("disk_writer: could not open " + config.path + ": "
+                                + std::strerror(errno));
+        }
+#    ifdef __linux__
+        if (config.preallocate_bytes > 0) {
+            const int err = ::posix_fallocate(_fd, 0, config.preallocate_bytes);
+            if (err != 0) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "Could not preallocate file extent: " << std::strerror(err));
+            }
+        }
+#    endif
+#endif
+    }
+
+    void _close_file()
+    {
+#ifdef UHD_PLATFORM_WIN32
+        if (_file) {
+            std::fclose(_file);
+            _file = nullptr;
+        }
+#else
+        if (_fd >= 0) {
+            // Trim off tail padding and any unused preallocated extent
+            if (::ftruncate(_fd, _bytes_written) != 0) {
+                UHD_LOG_WARNING(
+                    LOG_ID, "Could not trim file: " << std::strerror(errno));
+            }
+            ::close(_fd);
+            _fd = -1;
+        }
+#endif
+    }
+
+    void _alloc_ring()
+    {
+        const size_t ring_bytes = _block_size * _num_blocks;
+#ifdef UHD_PLATFORM_WIN32
+        _ring_storage.resize(ring_bytes);
+        _ring = _ring_storage.data();
+#else
+        void* mem = nullptr;
+        if (::posix_memalign(&mem, IO_ALIGNMENT, ring_bytes) != 0) {
+            _close_file();
+            throw uhd::io_error("disk_writer: could not allocate "
+                                + std::to_string(ring_bytes) + " bytes of ring buffer");
+        }
+        _ring_mem.reset(static_cast<char*>(mem));
+        _ring = _ring_mem.get();
+#endif
+    }
+
+    const size_t _block_size;
+    const size_t _num_blocks;
+
+#ifdef UHD_PLATFORM_WIN32
+    std::FILE* _file = nullptr;
+    std::vector<char> _ring_storage;
+#else
+    int _fd = -1;
+    struct free_deleter
+    {
+        void operator()(char* ptr) const
+        {
+            std::free(ptr);
+        }
+    };
+    std::unique_ptr<char, free_deleter> _ring_mem;
+#endif
+    char* _ring = nullptr;
+
+    // Producer state (receive thread only)
+    size_t _fill = 0;
+    uint64_t _produce_count = 0;
+
+    // Consumer state
+    std::atomic<uint64_t> _consume_count{0};
+
+    // Compression stage (only populated when compression is enabled)
+    const bool _compress;
+    std::vector<chunk_compressor::sptr> _codecs;
+    std::vector<std::thread> _compressors;
+    std::vector<std::vector<char>> _comp_bufs;
+    std::vector<size_t> _comp_sizes;
+    std::vector<char> _comp_ready;
+    uint64_t _compress_next = 0;
+
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop = false;
+
+    std::atomic<uint64_t> _bytes_written{0};
+    std::atomic<uint64_t> _bytes_dropped{0};
+    std::atomic<bool> _write_failed{false};
+};
+
+} // namespace
+
+disk_writer::sptr disk_writer::make(const config_t& config)
+{
+    return std::make_shared<disk_writer_impl>(config);
+}
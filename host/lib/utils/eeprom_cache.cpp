@@ -0,0 +1,104 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhdlib/utils/eeprom_cache.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <boost/filesystem.hpp>
+#include <cctype>
+#include <fstream>
+#include <string>
+
+namespace fs = boost::filesystem;
+
+namespace {
+constexpr char LOG_ID[]     = "EEPROM_CACHE";
+constexpr char CACHE_EXT[]  = ".eeprom";
+constexpr char CACHE_DIR[]  = "eeprom_cache";
+
+//! Map a cache label to its file path, replacing characters that are
+// unsuitable for filenames
+fs::path get_cache_path(const std::string& label)
+{
+    std::string filename;
+    filename.reserve(label.size() + sizeof(CACHE_EXT));
+    for (const char c : label) {
+        filename += (std::isalnum(static_cast<unsigned char>(c)) || c == '-'
+                        || c == '_')
+                        ? c
+                        : '_';
+    }
+    filename += CACHE_EXT;
+    return uhd::get_xdg_data_home() / "uhd" / CACHE_DIR / filename;
+}
+} // namespace
+
+bool uhd::eeprom_cache::load(
+    const std::string& label, uhd::dict<std::string, std::string>& eeprom)
+{
+    const fs::path cache_path = get_cache_path(label);
+    boost::system::error_code ec;
+    if (!fs::is_regular_file(cache_path, ec)) {
+        UHD_LOG_TRACE(LOG_ID, "No cached EEPROM contents at " << cache_path.string());
+        return false;
+    }
+    std::ifstream file(cache_path.string());
+    if (!file) {
+        UHD_LOG_DEBUG(
+            LOG_ID, "Unable to open EEPROM cache file " << cache_path.string());
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        const size_t pos = line.find('=');
+        if (pos == std::string::npos) {
+            UHD_LOG_DEBUG(
+                LOG_ID, "Corrupt EEPROM cache file " << cache_path.string());
+            return false;
+        }
+        eeprom[line.substr(0, pos)] = line.substr(pos + 1);
+    }
+    UHD_LOG_DEBUG(
+        LOG_ID, "Loaded cached EEPROM contents from " << cache_path.string());
+    return true;
+}
+
+void uhd::eeprom_cache::store(
+    const std::string& label, const uhd::dict<std::string, std::string>& eeprom)
+{
+    const fs::path cache_path = get_cache_path(label);
+    boost::system::error_code ec;
+    fs::create_directories(cache_path.parent_path(), ec);
+    if (ec) {
+        UHD_LOG_DEBUG(LOG_ID,
+            "Unable to create EEPROM cache directory "
+                << cache_path.parent_path().string());
+        return;
+    }
+    std::ofstream file(cache_path.string(), std::ios::trunc);
+    if (!file) {
+        UHD_LOG_DEBUG(
+            LOG_ID, "Unable to write EEPROM cache file " << cache_path.string());
+        return;
+    }
+    for (const std::string& key : eeprom.keys()) {
+        file << key << "=" << eeprom[key] << "\n";
+    }
+    UHD_LOG_DEBUG(LOG_ID, "Cached EEPROM contents to " << cache_path.string());
+}
+
+void uhd::eeprom_cache::invalidate(const std::string& label)
+{
+    const fs::path cache_path = get_cache_path(label);
+    boost::system::error_code ec;
+    if (fs::remove(cache_path, ec)) {
+        UHD_LOG_DEBUG(
+            LOG_ID, "Dropped cached EEPROM contents at " << cache_path.string());
+    }
+}
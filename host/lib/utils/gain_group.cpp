@@ -12,15 +12,13 @@
 #include <uhd/utils/log.hpp>
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <vector>
 
 using namespace uhd;
 
-static bool compare_by_step_size(
-    const size_t& rhs, const size_t& lhs, std::vector<gain_fcns_t>& fcns)
-{
-    return fcns.at(rhs).get_range().step() > fcns.at(lhs).get_range().step();
-}
+//! Maximum number of memoized gain distributions before the cache is flushed
+static constexpr size_t BUCKET_CACHE_MAX_SIZE = 256;
 
 /*!
  * Get a multiple of step with the following relation:
@@ -104,10 +102,33 @@ public:
         if (all_fcns.empty())
             return; // nothing to set!
 
+        // snapshot the ranges once; the old code re-read them in every loop
+        // (and in every sort comparison), which hits the property tree per
+        // call. The snapshot also validates the distribution cache below.
+        std::vector<gain_range_t> ranges;
+        ranges.reserve(all_fcns.size());
+        for (const gain_fcns_t& fcns : all_fcns) {
+            ranges.push_back(fcns.get_range());
+        }
+        if (ranges != _cached_ranges) {
+            _bucket_cache.clear();
+            _cached_ranges = ranges;
+        }
+
+        // re-use a memoized distribution for this total gain if the ranges
+        // have not changed since it was computed
+        auto cache_it = _bucket_cache.find(gain);
+        if (cache_it != _bucket_cache.end()) {
+            for (size_t i = 0; i < cache_it->second.size(); i++) {
+                all_fcns.at(i).set_value(cache_it->second.at(i));
+            }
+            return;
+        }
+
         // get the max step size among the gains
         double max_step = 0;
-        for (const gain_fcns_t& fcns : all_fcns) {
-            max_step = std::max(max_step, fcns.get_range().step());
+        for (const gain_range_t& range : ranges) {
+            max_step = std::max(max_step, range.step());
         }
 
         // create gain bucket to distribute power
@@ -115,8 +136,7 @@ public:
 
         // distribute power according to priority (round to max step)
         double gain_left_to_distribute = gain;
-        for (const gain_fcns_t& fcns : all_fcns) {
-            const gain_range_t range = fcns.get_range();
+        for (const gain_range_t& range : ranges) {
             gain_bucket.push_back(floor_step(
                 uhd::clip(gain_left_to_distribute, range.start(), range.stop()),
                 max_step));
@@ -130,17 +150,16 @@ public:
         }
         std::sort(indexes_step_size_dec.begin(),
             indexes_step_size_dec.end(),
-            std::bind(&compare_by_step_size,
-                std::placeholders::_1,
-                std::placeholders::_2,
-                all_fcns));
-        UHD_ASSERT_THROW(all_fcns.at(indexes_step_size_dec.front()).get_range().step()
-                         >= all_fcns.at(indexes_step_size_dec.back()).get_range().step());
+            [&ranges](const size_t lhs, const size_t rhs) {
+                return ranges.at(lhs).step() > ranges.at(rhs).step();
+            });
+        UHD_ASSERT_THROW(ranges.at(indexes_step_size_dec.front()).step()
+                         >= ranges.at(indexes_step_size_dec.back()).step());
 
         // distribute the remainder (less than max step)
         // fill in the largest step sizes first that are less than the remainder
         for (size_t i : indexes_step_size_dec) {
-            const gain_range_t range = all_fcns.at(i).get_range();
+            const gain_range_t& range = ranges.at(i);
             double additional_gain =
                 floor_step(uhd::clip(gain_bucket.at(i) + gain_left_to_distribute,
                                range.start(),
@@ -151,6 +170,12 @@ public:
             gain_left_to_distribute -= additional_gain;
         }
 
+        // memoize the distribution for repeated sets of the same total gain
+        if (_bucket_cache.size() >= BUCKET_CACHE_MAX_SIZE) {
+            _bucket_cache.clear();
+        }
+        _bucket_cache[gain] = gain_bucket;
+
         // now write the bucket out to the individual gain values
         for (size_t i = 0; i < gain_bucket.size(); i++) {
             all_fcns.at(i).set_value(gain_bucket.at(i));
@@ -171,6 +196,9 @@ public:
         }
         _registry[priority].push_back(gain_fcns);
         _name_to_fcns[name] = gain_fcns;
+        // the element set changed, so any memoized distribution is stale
+        _bucket_cache.clear();
+        _cached_ranges.clear();
     }
 
 private:
@@ -187,6 +215,10 @@ private:
 
     uhd::dict<size_t, std::vector<gain_fcns_t>> _registry;
     uhd::dict<std::string, gain_fcns_t> _name_to_fcns;
+    //! Ranges the memoized distributions below were computed against
+    std::vector<gain_range_t> _cached_ranges;
+    //! Memoized gain distributions, keyed by the requested overall gain
+    std::map<double, std::vector<double>> _bucket_cache;
 };
 
 /***********************************************************************
@@ -4,19 +4,104 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <uhd/rfnoc/graph_edge.hpp>
+#include <uhd/rfnoc/keep_one_in_n_block_control.hpp>
+#include <uhd/rfnoc/moving_average_block_control.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/rfnoc/switchboard_block_control.hpp>
 #include <uhd/utils/graph_utils.hpp>
 #include <uhd/utils/log.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <tuple>
 #include <utility>
 
 
 namespace uhd { namespace rfnoc {
 
+namespace {
+
+//! Cache key for a resolved block chain: start block, port, direction, and
+// the bypass list (joined into one string) the chain was resolved with
+using chain_key_t = std::tuple<std::string, size_t, bool, std::string>;
+
+/*! Per-graph cache of resolved block chains
+ *
+ * Chains are derived exclusively from the graph's static connections, which
+ * are fixed for the lifetime of a graph, so cached entries never go stale
+ * and no topology versioning is needed. Caches are keyed by the graph they
+ * belong to and dropped once that graph has been destroyed, so a scanner
+ * that reconnects paths at a high rate pays for the graph walk only once
+ * per route.
+ */
+class chain_cache_t
+{
+public:
+    bool lookup(const rfnoc_graph::sptr& graph,
+        const chain_key_t& key,
+        std::vector<graph_edge_t>& chain)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _chains.find(graph);
+        if (it == _chains.end()) {
+            return false;
+        }
+        auto chain_it = it->second.find(key);
+        if (chain_it == it->second.end()) {
+            return false;
+        }
+        chain = chain_it->second;
+        return true;
+    }
+
+    void store(const rfnoc_graph::sptr& graph,
+        const chain_key_t& key,
+        const std::vector<graph_edge_t>& chain)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Drop caches whose graph has been destroyed
+        for (auto it = _chains.begin(); it != _chains.end();) {
+            it = it->first.expired() ? _chains.erase(it) : std::next(it);
+        }
+        _chains[graph][key] = chain;
+    }
+
+private:
+    std::mutex _mutex;
+    std::map<std::weak_ptr<rfnoc_graph>,
+        std::map<chain_key_t, std::vector<graph_edge_t>>,
+        std::owner_less<std::weak_ptr<rfnoc_graph>>>
+        _chains;
+};
+
+chain_cache_t& get_chain_cache()
+{
+    static chain_cache_t cache;
+    return cache;
+}
+
+chain_key_t make_chain_key(const block_id_t& start_block,
+    const size_t port,
+    const bool source_chain,
+    const std::vector<std::string>& bypass_blocks = {})
+{
+    const std::string bypass = std::accumulate(bypass_blocks.begin(),
+        bypass_blocks.end(),
+        std::string(),
+        [](const std::string& joined, const std::string& block) {
+            return joined.empty() ? block : joined + "," + block;
+        });
+    return std::make_tuple(start_block.to_string(), port, source_chain, bypass);
+}
+
+} // namespace
+
 
 //! Returns whether or not a block (and port) is know to to terminate data paths
 bool check_terminator_block(const block_id_t blk_id, const size_t port)
@@ -38,10 +123,15 @@ std::vector<graph_edge_t> get_block_chain(const rfnoc_graph::sptr graph,
     const size_t port,
     const bool source_chain)
 {
+    const auto cache_key = make_chain_key(start_block, port, source_chain);
+    std::vector<graph_edge_t> block_chain;
+    if (get_chain_cache().lookup(graph, cache_key, block_chain)) {
+        return block_chain;
+    }
+
     // Enumerate blocks in the chain
     auto edges = graph->enumerate_static_connections();
 
-    std::vector<graph_edge_t> block_chain;
     std::string current_block = start_block.to_string();
     size_t current_port       = port;
     while (true) {
@@ -80,20 +170,93 @@ std::vector<graph_edge_t> get_block_chain(const rfnoc_graph::sptr graph,
             break;
         }
     }
+    get_chain_cache().store(graph, cache_key, block_chain);
     return block_chain;
 }
 
 
-std::vector<graph_edge_t> connect_through_blocks(rfnoc_graph::sptr graph,
-    const block_id_t src_blk,
-    const size_t src_port,
+std::vector<graph_edge_t> get_block_chain(const rfnoc_graph::sptr graph,
+    const block_id_t start_block,
+    const size_t port,
+    const bool source_chain,
+    const std::vector<std::string>& bypass_blocks)
+{
+    const auto cache_key = make_chain_key(start_block, port, source_chain, bypass_blocks);
+    std::vector<graph_edge_t> cached_chain;
+    if (get_chain_cache().lookup(graph, cache_key, cached_chain)) {
+        return cached_chain;
+    }
+
+    auto is_bypassed = [&bypass_blocks](const std::string& blockid) {
+        const std::string name = block_id_t(blockid).get_block_name();
+        return std::find(bypass_blocks.begin(), bypass_blocks.end(), name)
+               != bypass_blocks.end();
+    };
+    auto contains_bypassed = [&](const std::vector<graph_edge_t>& chain) {
+        for (const auto& edge : chain) {
+            if (is_bypassed(source_chain ? edge.dst_blockid : edge.src_blockid)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto block_chain = get_block_chain(graph, start_block, port, source_chain);
+    if (!contains_bypassed(block_chain)) {
+        get_chain_cache().store(graph, cache_key, block_chain);
+        return block_chain;
+    }
+
+    // The default path contains blocks we'd rather avoid. Find the first
+    // switchboard in the chain and look for a branch off of it whose
+    // downstream chain is clean.
+    const auto edges = graph->enumerate_static_connections();
+    for (size_t i = 0; i < block_chain.size(); i++) {
+        const std::string sb_id =
+            source_chain ? block_chain[i].dst_blockid : block_chain[i].src_blockid;
+        if (block_id_t(sb_id).get_block_name() != "Switchboard") {
+            continue;
+        }
+        for (const auto& edge : edges) {
+            if ((source_chain ? edge.src_blockid : edge.dst_blockid) != sb_id) {
+                continue;
+            }
+            auto branch = get_block_chain(graph,
+                block_id_t(sb_id),
+                source_chain ? edge.src_port : edge.dst_port,
+                source_chain);
+            if (branch.empty() || contains_bypassed(branch)) {
+                continue;
+            }
+            // Found a clean branch: keep the chain up to the switchboard and
+            // continue along the branch
+            UHD_LOG_TRACE("GRAPH_UTILS",
+                "Routing around bypassed blocks via switchboard " + sb_id);
+            block_chain.resize(i + 1);
+            block_chain.insert(block_chain.end(), branch.begin(), branch.end());
+            get_chain_cache().store(graph, cache_key, block_chain);
+            return block_chain;
+        }
+    }
+
+    UHD_LOG_DEBUG("GRAPH_UTILS",
+        "No path from " + start_block.to_string()
+            + " avoids the bypassed blocks; keeping the default path");
+    get_chain_cache().store(graph, cache_key, block_chain);
+    return block_chain;
+}
+
+
+namespace {
+//! Merge a source chain with the chain reaching dst_blk and make all the
+// connections. This is the shared back half of the connect_through_blocks()
+// overloads.
+std::vector<graph_edge_t> connect_chain_through_blocks(rfnoc_graph::sptr graph,
+    std::vector<graph_edge_t> block_chain,
     const block_id_t dst_blk,
     const size_t dst_port,
     const bool skip_property_propagation)
 {
-    // First, create a chain from the source block to a stream endpoint
-    auto block_chain = get_block_chain(graph, src_blk, src_port, true);
-    UHD_LOG_TRACE("GRAPH_UTILS", "Found source chain for " + src_blk.to_string());
     // See if dst_blk is in our block_chain already
     const bool dst_found = std::accumulate(block_chain.begin(),
         block_chain.end(),
@@ -169,5 +332,143 @@ std::vector<graph_edge_t> connect_through_blocks(rfnoc_graph::sptr graph,
     }
     return block_chain;
 }
+} // namespace
+
+
+std::vector<graph_edge_t> connect_through_blocks(rfnoc_graph::sptr graph,
+    const block_id_t src_blk,
+    const size_t src_port,
+    const block_id_t dst_blk,
+    const size_t dst_port,
+    const bool skip_property_propagation)
+{
+    // First, create a chain from the source block to a stream endpoint
+    auto block_chain = get_block_chain(graph, src_blk, src_port, true);
+    UHD_LOG_TRACE("GRAPH_UTILS", "Found source chain for " + src_blk.to_string());
+    return connect_chain_through_blocks(
+        graph, std::move(block_chain), dst_blk, dst_port, skip_property_propagation);
+}
+
+std::vector<graph_edge_t> connect_through_blocks(rfnoc_graph::sptr graph,
+    const block_id_t src_blk,
+    const size_t src_port,
+    const block_id_t dst_blk,
+    const size_t dst_port,
+    const bool skip_property_propagation,
+    const std::vector<std::string>& bypass_blocks)
+{
+    // Select the path, routing around the bypassed block types at
+    // switchboards where possible
+    auto block_chain = get_block_chain(graph, src_blk, src_port, true, bypass_blocks);
+    UHD_LOG_TRACE("GRAPH_UTILS", "Found source chain for " + src_blk.to_string());
+
+    // Program any switchboard along the chosen path to realize it
+    for (const auto& edge : block_chain) {
+        if (block_id_t(edge.src_blockid).get_block_name() != "Switchboard") {
+            continue;
+        }
+        for (const auto& in_edge : block_chain) {
+            if (in_edge.dst_blockid == edge.src_blockid) {
+                graph->get_block<switchboard_block_control>(block_id_t(edge.src_blockid))
+                    ->connect(in_edge.dst_port, edge.src_port);
+                break;
+            }
+        }
+    }
+
+    return connect_chain_through_blocks(
+        graph, std::move(block_chain), dst_blk, dst_port, skip_property_propagation);
+}
+
+namespace {
+//! Find a free channel on a block matching \p hint on device \p device_no.
+// A channel counts as free if neither its input nor its output is part of an
+// active connection.
+std::pair<block_id_t, size_t> find_free_block_chan(
+    rfnoc_graph::sptr graph, const std::string& hint, const size_t device_no)
+{
+    const auto active = graph->enumerate_active_connections();
+    for (const auto& blk_id : graph->find_blocks(hint)) {
+        if (blk_id.get_device_no() != device_no) {
+            continue;
+        }
+        auto blk = graph->get_block(blk_id);
+        for (size_t port = 0; port < blk->get_num_input_ports(); port++) {
+            bool in_use = false;
+            for (const auto& edge : active) {
+                if ((edge.src_blockid == blk_id.to_string() && edge.src_port == port)
+                    || (edge.dst_blockid == blk_id.to_string()
+                        && edge.dst_port == port)) {
+                    in_use = true;
+                    break;
+                }
+            }
+            if (!in_use) {
+                return {blk_id, port};
+            }
+        }
+    }
+    throw uhd::runtime_error("[graph_utils] No free " + hint
+                             + " block available on device "
+                             + std::to_string(device_no));
+}
+} // namespace
+
+power_telemetry_path_t connect_power_telemetry_path(rfnoc_graph::sptr graph,
+    const block_id_t src_blk,
+    const size_t src_port,
+    const uint8_t avg_len,
+    const size_t decimation)
+{
+    const size_t device_no = src_blk.get_device_no();
+    power_telemetry_path_t path;
+    std::tie(path.logpwr_id, path.logpwr_port) =
+        find_free_block_chan(graph, "LogPwr", device_no);
+    std::tie(path.moving_average_id, path.moving_average_port) =
+        find_free_block_chan(graph, "MovingAverage", device_no);
+    std::tie(path.keep_one_in_n_id, path.keep_one_in_n_port) =
+        find_free_block_chan(graph, "KeepOneInN", device_no);
+
+    // Configure all three blocks before making any connections, so the
+    // property cascade only runs once when the path is wired up instead of
+    // once per block.
+    auto avg = graph->get_block<moving_average_block_control>(path.moving_average_id);
+    avg->set_sum_len(avg_len);
+    avg->set_divisor(avg_len);
+    auto k1n = graph->get_block<keep_one_in_n_block_control>(path.keep_one_in_n_id);
+    k1n->set_mode(
+        keep_one_in_n_block_control::mode::SAMPLE_MODE, path.keep_one_in_n_port);
+    k1n->set_n(decimation, path.keep_one_in_n_port);
+
+    // Now wire up src -> LogPwr -> MovingAverage -> KeepOneInN
+    path.edges = connect_through_blocks(
+        graph, src_blk, src_port, path.logpwr_id, path.logpwr_port);
+    auto avg_edges = connect_through_blocks(graph,
+        path.logpwr_id,
+        path.logpwr_port,
+        path.moving_average_id,
+        path.moving_average_port);
+    path.edges.insert(path.edges.end(), avg_edges.begin(), avg_edges.end());
+    auto k1n_edges = connect_through_blocks(graph,
+        path.moving_average_id,
+        path.moving_average_port,
+        path.keep_one_in_n_id,
+        path.keep_one_in_n_port);
+    path.edges.insert(path.edges.end(), k1n_edges.begin(), k1n_edges.end());
+    return path;
+}
+
+uhd::rx_streamer::sptr create_power_telemetry_streamer(rfnoc_graph::sptr graph,
+    const std::vector<power_telemetry_path_t>& paths,
+    const uhd::stream_args_t& args)
+{
+    UHD_ASSERT_THROW(!paths.empty());
+    auto streamer = graph->create_rx_streamer(paths.size(), args);
+    for (size_t i = 0; i < paths.size(); i++) {
+        graph->connect(
+            paths[i].keep_one_in_n_id, paths[i].keep_one_in_n_port, streamer, i);
+    }
+    return streamer;
+}
 
 }} // namespace uhd::rfnoc
@@ -8,11 +8,14 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/paths.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <uhdlib/utils/paths.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -56,13 +59,38 @@ static void load_module(const std::string& file_name)
 /***********************************************************************
  * Load Modules
  **********************************************************************/
+namespace {
+
+//! Modules indexed at static initialization but not yet loaded
+struct deferred_modules_t
+{
+    std::mutex mutex;
+    std::vector<std::string> pending;
+};
+
+deferred_modules_t& get_deferred_modules()
+{
+    static deferred_modules_t deferred;
+    return deferred;
+}
+
+//! Load one module, printing (not throwing) on failure
+void load_module_with_warning(const std::string& file_name)
+{
+    try {
+        load_module(file_name);
+    } catch (const std::exception& err) {
+        std::cerr << boost::format("Error: %s") % err.what() << std::endl;
+    }
+}
+
 /*!
- * Load all modules in a given path.
+ * Index all modules in a given path.
  * This will recurse into sub-directories.
- * Does not throw, prints to std error.
  * \param path the filesystem path
+ * \param modules the list of module files to append to
  */
-static void load_module_path(const fs::path& path)
+void index_module_path(const fs::path& path, std::vector<std::string>& modules)
 {
     if (not fs::exists(path)) {
         // std::cerr << boost::format("Module path \"%s\" not found.") % path.string() <<
@@ -70,32 +98,26 @@ static void load_module_path(const fs::path& path)
         return;
     }
 
-    // try to load the files in this path
+    // recurse into directories
     if (fs::is_directory(path)) {
         for (fs::directory_iterator dir_itr(path); dir_itr != fs::directory_iterator();
              ++dir_itr) {
-            load_module_path(dir_itr->path());
+            index_module_path(dir_itr->path(), modules);
         }
         return;
     }
 
-    // its not a directory, try to load it
-    try {
-        load_module(path.string());
-    } catch (const std::exception& err) {
-        std::cerr << boost::format("Error: %s") % err.what() << std::endl;
-    }
+    // its not a directory, it's a module
+    modules.push_back(path.string());
 }
 
-namespace {
-
-// Load all modules listed in a given directory.
+// Index all modules listed in a given directory.
 //
 // This will:
 // - Open each file in the directory
 // - Read each line from the file
-// - Load the module named by each line
-void load_module_d_path(const fs::path& path)
+// - Index the module named by each line
+void index_module_d_path(const fs::path& path, std::vector<std::string>& modules)
 {
     for (fs::directory_iterator dir_itr(path); dir_itr != fs::directory_iterator();
          ++dir_itr) {
@@ -107,7 +129,7 @@ void load_module_d_path(const fs::path& path)
                 if (line.empty() or line[0] == '#') {
                     continue;
                 }
-                load_module(line);
+                modules.push_back(line);
             }
         }
     }
@@ -115,18 +137,47 @@ void load_module_d_path(const fs::path& path)
 
 } /* anonymous namespace */
 
+void uhd::load_deferred_modules()
+{
+    deferred_modules_t& deferred = get_deferred_modules();
+    std::lock_guard<std::mutex> lock(deferred.mutex);
+    for (const std::string& file_name : deferred.pending) {
+        load_module_with_warning(file_name);
+    }
+    deferred.pending.clear();
+}
 
 /*!
- * Load all the modules given in the module paths.
+ * Index all the modules given in the module paths.
+ *
+ * Loading is normally deferred until a factory lookup misses (see
+ * load_deferred_modules()), so that processes that never use a
+ * module-provided factory do not pay the load cost of every installed
+ * module. Setting UHD_MODULE_PRELOAD to anything but "0" loads all modules
+ * right here, which is required when a module provides something that is
+ * looked up without a miss hook (e.g., a device type for discovery).
  */
 UHD_STATIC_BLOCK(load_modules)
 {
+    std::vector<std::string> modules;
     for (const fs::path& path : uhd::get_module_paths()) {
-        load_module_path(path);
+        index_module_path(path, modules);
     }
     for (const fs::path& path : uhd::get_module_d_paths()) {
         if (fs::is_directory(path)) {
-            load_module_d_path(path);
+            index_module_d_path(path, modules);
         }
     }
+
+    const char* preload = std::getenv("UHD_MODULE_PRELOAD");
+    if (preload != NULL and std::string(preload) != "0") {
+        for (const std::string& file_name : modules) {
+            load_module_with_warning(file_name);
+        }
+        return;
+    }
+
+    deferred_modules_t& deferred = get_deferred_modules();
+    std::lock_guard<std::mutex> lock(deferred.mutex);
+    deferred.pending = std::move(modules);
 }
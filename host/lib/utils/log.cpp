@@ -215,7 +215,10 @@ private:
 class log_resource
 {
 public:
-    uhd::log::severity_level global_level;
+    // Atomic: this is read on every UHD_LOG* invocation from arbitrary
+    // threads (see log_level_enabled()) while set_log_level() may write it
+    // concurrently.
+    std::atomic<uhd::log::severity_level> global_level;
 
     log_resource(void)
         : global_level(uhd::log::off)
@@ -524,6 +527,11 @@ UHD_SINGLETON_FCN(log_resource, log_rs);
 /***********************************************************************
  * The logger object implementation
  **********************************************************************/
+bool uhd::_log::log_level_enabled(const uhd::log::severity_level level)
+{
+    return level >= log_rs().global_level.load(std::memory_order_relaxed);
+}
+
 uhd::_log::log::log(const uhd::log::severity_level verbosity,
     const std::string& file,
     const unsigned int line,
@@ -268,25 +268,41 @@ std::string uhd::get_appdata_path(void)
 
 std::string uhd::get_pkg_path(void)
 {
-    fs::path pkg_path = fs::path(uhd::get_lib_path()).parent_path().lexically_normal();
-    return get_env_var("UHD_PKG_PATH", pkg_path.string());
+    // Resolved once; see get_lib_path() for the rationale
+    static const std::string pkg_path_cached = [] {
+        fs::path pkg_path =
+            fs::path(uhd::get_lib_path()).parent_path().lexically_normal();
+        return get_env_var("UHD_PKG_PATH", pkg_path.string());
+    }();
+    return pkg_path_cached;
 }
 
 
 std::string uhd::get_pkg_data_path()
 {
-    return get_env_var("UHD_PKG_DATA_PATH",
-        (fs::path(uhd::get_pkg_path() / fs::path(uhd::build_info::pkg_data_dir()))
-                .string()));
+    // Resolved once; see get_lib_path() for the rationale
+    static const std::string pkg_data_path_cached = [] {
+        return get_env_var("UHD_PKG_DATA_PATH",
+            (fs::path(uhd::get_pkg_path() / fs::path(uhd::build_info::pkg_data_dir()))
+                    .string()));
+    }();
+    return pkg_data_path_cached;
 }
 
 
 std::string uhd::get_lib_path(void)
 {
-    fs::path runtime_libfile_path = boost::dll::this_line_location();
-    // Normalize before decomposing path so result is reliable
-    fs::path lib_path = runtime_libfile_path.lexically_normal().parent_path();
-    return lib_path.string();
+    // The library location cannot change within a process, but
+    // this_line_location() does a symbol table lookup on every call, and this
+    // path gets requested repeatedly during device and module setup. Resolve
+    // it once and hand out the cached copy.
+    static const std::string lib_path_cached = [] {
+        fs::path runtime_libfile_path = boost::dll::this_line_location();
+        // Normalize before decomposing path so result is reliable
+        fs::path lib_path = runtime_libfile_path.lexically_normal().parent_path();
+        return lib_path.string();
+    }();
+    return lib_path_cached;
 }
 
 std::string uhd::get_cal_data_path(void)
@@ -75,18 +75,21 @@ device_addr_t get_args(const uhd::device_addr_t& user_args,
 
 config_parser& uhd::prefs::get_uhd_config()
 {
-    static config_parser _conf_files{};
-    static bool init_done = false;
-    if (not init_done) {
+    // The config files are read and parsed once per process; all sessions
+    // share the resulting tree. Initializing inside a magic static keeps
+    // concurrent first callers (e.g., parallel device construction) from
+    // racing the file loads, which the previous init_done flag did not.
+    static config_parser _conf_files = [] {
+        config_parser conf_files{};
         UHD_LOG_TRACE("CONF", "Initializing config file object...");
         const std::string sys_conf_file = path_expandvars(UHD_SYS_CONF_FILE);
-        _update_conf_file(sys_conf_file, "system", _conf_files);
+        _update_conf_file(sys_conf_file, "system", conf_files);
         // prefer .config/uhd.conf
         // otherwise ~/.uhd/uhd.conf
         const std::string user_conf_file =
             (get_xdg_config_home() / std::string(UHD_USER_CONF_FILE)).string();
         const bool user_conf_loaded =
-            _update_conf_file(user_conf_file, "user", _conf_files);
+            _update_conf_file(user_conf_file, "user", conf_files);
         // Config files can be in ~/.config/ or in ~/.uhd. The latter is
         // considered deprecated. We load from there (if we have not already
         // loaded from ~/.config), but we show a warning.
@@ -94,7 +97,7 @@ config_parser& uhd::prefs::get_uhd_config()
             && _update_conf_file(
                 (get_legacy_config_home() / std::string(UHD_USER_CONF_FILE)).string(),
                 "user",
-                _conf_files)) {
+                conf_files)) {
             UHD_LOG_WARNING("PREFS",
                 "Loaded config from " << get_legacy_config_home().string()
                                       << ". This location is considered deprecated, "
@@ -106,13 +109,13 @@ config_parser& uhd::prefs::get_uhd_config()
             if (std::getenv(UHD_CONF_FILE_VAR) != NULL) {
                 env_conf_file = std::string(std::getenv(UHD_CONF_FILE_VAR));
             }
-            _update_conf_file(env_conf_file, "ENV", _conf_files);
+            _update_conf_file(env_conf_file, "ENV", conf_files);
         } catch (const std::exception&) {
             // nop
         }
-        init_done = true;
         UHD_LOG_TRACE("PREFS", "Done initializing.");
-    }
+        return conf_files;
+    }();
 
     return _conf_files;
 }
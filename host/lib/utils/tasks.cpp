@@ -10,6 +10,7 @@
 #include <uhd/utils/msg_task.hpp>
 #include <uhd/utils/tasks.hpp>
 #include <uhd/utils/thread.hpp>
+#include <uhdlib/utils/thread_policy.hpp>
 #include <boost/thread/barrier.hpp>
 #include <boost/thread/thread.hpp>
 #include <atomic>
@@ -44,6 +45,7 @@ public:
 private:
     void task_loop(const task_fcn_type& task_fcn)
     {
+        apply_thread_policy("task");
         try {
             while (!_exit) {
                 task_fcn();
@@ -124,6 +126,7 @@ private:
     {
         _running = true;
         _spawn_barrier.wait();
+        apply_thread_policy("task");
 
         try {
             while (_running) {
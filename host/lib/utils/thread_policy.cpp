@@ -0,0 +1,269 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/cast.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/utils/prefs.hpp>
+#include <uhdlib/utils/thread_policy.hpp>
+#include <boost/algorithm/string.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef UHD_PLATFORM_LINUX
+#    include <sched.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[]           = "UHD";
+constexpr char THREADS_SECTION[]  = "threads";
+constexpr size_t DEFAULT_WATCHDOG_INTERVAL_MS = 1000;
+
+thread_policy_t parse_thread_policy(const std::string& role)
+{
+    thread_policy_t policy;
+    auto& conf = uhd::prefs::get_uhd_config();
+
+    const std::string affinity =
+        conf.get<std::string>(THREADS_SECTION, role + "_cpu_affinity", "");
+    if (not affinity.empty()) {
+        std::vector<std::string> tokens;
+        boost::split(
+            tokens, affinity, boost::is_any_of(", "), boost::token_compress_on);
+        for (const std::string& token : tokens) {
+            try {
+                policy.cpu_affinity_list.push_back(std::stoul(token));
+            } catch (const std::exception&) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "Ignoring invalid CPU number in " << role << "_cpu_affinity: "
+                                                      << token);
+            }
+        }
+    }
+
+    const std::string priority =
+        conf.get<std::string>(THREADS_SECTION, role + "_priority", "");
+    if (not priority.empty()) {
+        try {
+            policy.priority = std::stof(priority);
+        } catch (const std::exception&) {
+            UHD_LOG_WARNING(
+                LOG_ID, "Ignoring invalid " << role << "_priority value: " << priority);
+        }
+    }
+
+    const std::string realtime =
+        conf.get<std::string>(THREADS_SECTION, role + "_realtime", "");
+    if (not realtime.empty()) {
+        try {
+            policy.realtime = uhd::cast::from_str<bool>(realtime);
+        } catch (const std::exception&) {
+            UHD_LOG_WARNING(
+                LOG_ID, "Ignoring invalid " << role << "_realtime value: " << realtime);
+        }
+    }
+
+    return policy;
+}
+
+#ifdef UHD_PLATFORM_LINUX
+
+/*! Priority watchdog for realtime UHD threads
+ *
+ * Every thread that successfully applied a realtime policy registers here.
+ * A single low-impact monitor thread then samples each registered thread's
+ * scheduler run queue statistics once per interval and warns when:
+ *  - the thread lost its realtime scheduling class (something reset it), or
+ *  - the thread spent more than a tenth of the interval runnable but not
+ *    running, which for an RT thread indicates kernel RT throttling
+ *    (sched_rt_runtime_us) or a priority inversion against another thread.
+ */
+class rt_watchdog
+{
+public:
+    static rt_watchdog& get()
+    {
+        static rt_watchdog watchdog;
+        return watchdog;
+    }
+
+    void register_thread(const std::string& role)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_interval_ms == 0) {
+            return;
+        }
+        const pid_t tid = static_cast<pid_t>(::syscall(SYS_gettid));
+        _threads.push_back({role, tid, read_wait_ns(tid), false});
+        if (not _monitor.joinable()) {
+            _monitor = std::thread([this]() { monitor_loop(); });
+            set_thread_name(&_monitor, "uhd_rt_watchdog");
+        }
+    }
+
+private:
+    struct watched_thread_t
+    {
+        std::string role;
+        pid_t tid;
+        uint64_t last_wait_ns;
+        bool policy_warned;
+    };
+
+    rt_watchdog()
+    {
+        const std::string interval = uhd::prefs::get_uhd_config().get<std::string>(
+            THREADS_SECTION, "watchdog_interval_ms", "");
+        _interval_ms = DEFAULT_WATCHDOG_INTERVAL_MS;
+        if (not interval.empty()) {
+            try {
+                _interval_ms = std::stoul(interval);
+            } catch (const std::exception&) {
+                UHD_LOG_WARNING(
+                    LOG_ID, "Ignoring invalid watchdog_interval_ms value: " << interval);
+            }
+        }
+
+        // One-time hint: with the default kernel settings, RT threads are
+        // throttled to 95% of each period, which shows up as periodic gaps
+        // in high-duty-cycle streaming threads.
+        std::ifstream rt_runtime("/proc/sys/kernel/sched_rt_runtime_us");
+        long long runtime_us = -1;
+        if (rt_runtime >> runtime_us and runtime_us >= 0) {
+            UHD_LOG_DEBUG(LOG_ID,
+                "Kernel RT throttling is enabled (sched_rt_runtime_us="
+                    << runtime_us
+                    << "). Realtime UHD threads may be throttled under full load.");
+        }
+    }
+
+    ~rt_watchdog()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        if (_monitor.joinable()) {
+            _monitor.join();
+        }
+    }
+
+    //! Read the time this thread has spent runnable-but-not-running, in ns
+    // (second field of /proc/self/task/<tid>/schedstat)
+    static uint64_t read_wait_ns(const pid_t tid)
+    {
+        std::ifstream schedstat(
+            "/proc/self/task/" + std::to_string(tid) + "/schedstat");
+        uint64_t run_ns = 0, wait_ns = 0;
+        if (schedstat >> run_ns >> wait_ns) {
+            return wait_ns;
+        }
+        return 0;
+    }
+
+    void monitor_loop()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (not _stop) {
+            _cv.wait_for(lock, std::chrono::milliseconds(_interval_ms), [this]() {
+                return _stop;
+            });
+            if (_stop) {
+                break;
+            }
+            const uint64_t wait_limit_ns = _interval_ms * 1000000ULL / 10;
+            for (auto it = _threads.begin(); it != _threads.end();) {
+                const int policy = sched_getscheduler(it->tid);
+                if (policy < 0) {
+                    // The thread has exited; stop watching it
+                    it = _threads.erase(it);
+                    continue;
+                }
+                if (policy == SCHED_OTHER and not it->policy_warned) {
+                    UHD_LOG_WARNING(LOG_ID,
+                        "Thread " << it->tid << " (role: " << it->role
+                                  << ") lost its realtime scheduling class. "
+                                     "Performance may be negatively affected.");
+                    it->policy_warned = true;
+                }
+                const uint64_t wait_ns = read_wait_ns(it->tid);
+                const uint64_t delta   = wait_ns - it->last_wait_ns;
+                it->last_wait_ns       = wait_ns;
+                if (delta > wait_limit_ns) {
+                    UHD_LOG_WARNING(LOG_ID,
+                        "Thread " << it->tid << " (role: " << it->role << ") spent "
+                                  << (delta / 1000000) << " ms of the last "
+                                  << _interval_ms
+                                  << " ms runnable but not running. This indicates "
+                                     "RT throttling or a priority inversion.");
+                }
+                ++it;
+            }
+        }
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::thread _monitor;
+    std::vector<watched_thread_t> _threads;
+    size_t _interval_ms = DEFAULT_WATCHDOG_INTERVAL_MS;
+    bool _stop          = false;
+};
+
+#endif /* UHD_PLATFORM_LINUX */
+
+} // namespace
+
+thread_policy_t uhd::get_thread_policy(const std::string& role)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, thread_policy_t> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(role);
+    if (it == cache.end()) {
+        it = cache.emplace(role, parse_thread_policy(role)).first;
+    }
+    return it->second;
+}
+
+void uhd::apply_thread_policy(const std::string& role)
+{
+    const thread_policy_t policy = get_thread_policy(role);
+
+    if (not policy.cpu_affinity_list.empty()) {
+        set_thread_affinity(policy.cpu_affinity_list);
+    }
+
+    bool realtime_applied = false;
+    if (policy.priority) {
+        realtime_applied =
+            set_thread_priority_safe(*policy.priority, policy.realtime)
+            and policy.realtime;
+    } else if (policy.realtime) {
+        realtime_applied = set_thread_priority_safe();
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    if (realtime_applied) {
+        rt_watchdog::get().register_thread(role);
+    }
+#else
+    (void)realtime_applied;
+#endif
+}
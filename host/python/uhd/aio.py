@@ -0,0 +1,271 @@
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+"""Native asyncio support for UHD.
+
+This module lets asyncio-based applications overlap streaming I/O with other
+coroutines without running the data path through a thread-pool executor.
+
+The data path is driven by the C++ ring buffer workers (see
+uhd.usrp.RXRingBuffer and uhd.usrp.TXRingBuffer): samples move between the
+device and a preallocated NumPy ring entirely in C++, and readiness is
+signalled to the event loop through a file descriptor registered with
+loop.add_reader(). Awaiting a segment therefore costs one fd wakeup, not a
+thread handoff per call.
+
+Control-path calls (tuning, sensor reads) have no completion source in the
+C++ layer; the coroutines here bridge them with the default executor. They
+are rare and latency-insensitive, so this does not affect streaming.
+
+Example::
+
+    usrp = uhd.usrp.MultiUSRP("addr=...")
+    streamer = usrp.get_rx_stream(uhd.usrp.StreamArgs("fc32", "sc16"))
+    rx = uhd.aio.AsyncRXStreamer(streamer)
+    rx.start()
+    rx.issue_stream_cmd(stream_cmd)
+    async for _ in some_schedule():
+        segment = await rx.acquire()
+        process(segment)
+        rx.release()
+
+On platforms without fd notification (Windows), the awaitables fall back to
+short non-blocking polls of the ring.
+"""
+
+import asyncio
+import functools
+
+import numpy as np
+
+from . import libpyuhd as lib
+
+# Polling interval for platforms where the ring buffers report no notify fd
+_POLL_INTERVAL = 0.001
+
+
+async def _wait_readable(fd):
+    """Suspend the current task until fd becomes readable."""
+    loop = asyncio.get_running_loop()
+    future = loop.create_future()
+    loop.add_reader(fd, future.set_result, None)
+    try:
+        await future
+    finally:
+        loop.remove_reader(fd)
+
+
+async def call_blocking(func, *args, **kwargs):
+    """Run a blocking UHD call without stalling the event loop.
+
+    Bridges a control-path call (tune, sensor read, ...) onto the default
+    executor. Use this for infrequent calls only; the streaming classes below
+    do not go through an executor.
+    """
+    loop = asyncio.get_running_loop()
+    return await loop.run_in_executor(None, functools.partial(func, *args, **kwargs))
+
+
+async def tune_rx(usrp, target, chan=0):
+    """Coroutine version of MultiUSRP.set_rx_freq().
+
+    :param target: center frequency in Hz, or a TuneRequest
+    :return: the TuneResult
+    """
+    if not isinstance(target, lib.types.tune_request):
+        target = lib.types.tune_request(target)
+    return await call_blocking(usrp.set_rx_freq, target, chan)
+
+
+async def tune_tx(usrp, target, chan=0):
+    """Coroutine version of MultiUSRP.set_tx_freq().
+
+    :param target: center frequency in Hz, or a TuneRequest
+    :return: the TuneResult
+    """
+    if not isinstance(target, lib.types.tune_request):
+        target = lib.types.tune_request(target)
+    return await call_blocking(usrp.set_tx_freq, target, chan)
+
+
+async def get_rx_sensor(usrp, name, chan=0):
+    """Coroutine version of MultiUSRP.get_rx_sensor()."""
+    return await call_blocking(usrp.get_rx_sensor, name, chan)
+
+
+async def get_tx_sensor(usrp, name, chan=0):
+    """Coroutine version of MultiUSRP.get_tx_sensor()."""
+    return await call_blocking(usrp.get_tx_sensor, name, chan)
+
+
+async def get_mboard_sensor(usrp, name, mboard=0):
+    """Coroutine version of MultiUSRP.get_mboard_sensor()."""
+    return await call_blocking(usrp.get_mboard_sensor, name, mboard)
+
+
+class AsyncRXStreamer:
+    """Awaitable receive interface over an RX streamer.
+
+    Owns a NumPy ring filled continuously by a C++ worker thread. The
+    producing side never touches Python; consuming a segment is an fd-based
+    await plus an index handshake.
+    """
+
+    def __init__(self, streamer, num_segments=8, segment_size=None, dtype=np.complex64):
+        """AsyncRXStreamer constructor.
+
+        :param streamer: an RXStreamer object
+        :param num_segments: number of ring segments
+        :param segment_size: samples per segment (default: 16 packets worth)
+        :param dtype: ring dtype, must match the streamer's CPU format
+        """
+        self._streamer = streamer
+        if segment_size is None:
+            segment_size = streamer.get_max_num_samps() * 16
+        self._segment_size = segment_size
+        num_chans = streamer.get_num_channels()
+        self._ring = np.empty((num_chans, num_segments * segment_size), dtype=dtype)
+        self._buffer = lib.usrp.rx_ring_buffer(streamer, self._ring, num_segments)
+        self._fd = self._buffer.get_notify_fd()
+
+    def start(self):
+        """Start the C++ worker thread (does not start the stream itself)."""
+        self._buffer.start()
+
+    def stop(self):
+        """Stop and join the C++ worker thread."""
+        self._buffer.stop()
+
+    def issue_stream_cmd(self, stream_cmd):
+        """Forward a stream command to the underlying streamer."""
+        self._streamer.issue_stream_cmd(stream_cmd)
+
+    async def acquire(self):
+        """Await the oldest filled ring segment.
+
+        :return: a (num_channels, segment_size) view into the ring; it stays
+                 valid until release() is called
+        """
+        while True:
+            index = self._buffer.acquire(0.0)
+            if index >= 0:
+                start = index * self._segment_size
+                return self._ring[:, start : start + self._segment_size]
+            if self._fd >= 0:
+                await _wait_readable(self._fd)
+                self._buffer.clear_notify()
+            else:
+                await asyncio.sleep(_POLL_INTERVAL)
+
+    def release(self):
+        """Return the acquired segment to the ring."""
+        self._buffer.release()
+
+    async def recv(self, out=None):
+        """Await one segment and copy it out of the ring.
+
+        Convenience wrapper around acquire()/release() for consumers that
+        want to keep the samples past the handshake.
+
+        :param out: optional destination array of shape
+                    (num_channels, segment_size)
+        :return: the destination array
+        """
+        segment = await self.acquire()
+        if out is None:
+            out = np.array(segment)
+        else:
+            np.copyto(out, segment)
+        self.release()
+        return out
+
+    def get_overflow_count(self):
+        """Return the number of overflows seen by the worker."""
+        return self._buffer.get_overflow_count()
+
+    def get_error_count(self):
+        """Return the number of non-overflow stream errors seen by the worker."""
+        return self._buffer.get_error_count()
+
+
+class AsyncTXStreamer:
+    """Awaitable transmit interface over a TX streamer.
+
+    Owns a NumPy ring drained continuously by a C++ worker thread. Awaiting
+    ring space is an fd-based await plus an index handshake.
+    """
+
+    def __init__(self, streamer, num_segments=8, segment_size=None, dtype=np.complex64):
+        """AsyncTXStreamer constructor.
+
+        :param streamer: a TXStreamer object
+        :param num_segments: number of ring segments
+        :param segment_size: samples per segment (default: 16 packets worth)
+        :param dtype: ring dtype, must match the streamer's CPU format
+        """
+        self._streamer = streamer
+        if segment_size is None:
+            segment_size = streamer.get_max_num_samps() * 16
+        self._segment_size = segment_size
+        num_chans = streamer.get_num_channels()
+        self._ring = np.zeros((num_chans, num_segments * segment_size), dtype=dtype)
+        self._buffer = lib.usrp.tx_ring_buffer(streamer, self._ring, num_segments)
+        self._fd = self._buffer.get_notify_fd()
+
+    def start(self):
+        """Start the C++ worker thread."""
+        self._buffer.start()
+
+    def stop(self):
+        """Stop the worker; unsent segments are dropped and the burst closed."""
+        self._buffer.stop()
+
+    async def acquire(self):
+        """Await the next free ring segment.
+
+        :return: a writable (num_channels, segment_size) view into the ring;
+                 fill it in place, then publish it with commit()
+        """
+        while True:
+            index = self._buffer.acquire(0.0)
+            if index >= 0:
+                start = index * self._segment_size
+                return self._ring[:, start : start + self._segment_size]
+            if self._fd >= 0:
+                await _wait_readable(self._fd)
+                self._buffer.clear_notify()
+            else:
+                await asyncio.sleep(_POLL_INTERVAL)
+
+    def commit(self):
+        """Publish the acquired segment for sending."""
+        self._buffer.commit()
+
+    async def send(self, samples):
+        """Copy samples into the ring and publish them.
+
+        Convenience wrapper around acquire()/commit(). The last segment is
+        zero-padded if the sample count is not a multiple of the segment
+        size.
+
+        :param samples: array of shape (num_channels, nsamps) or (nsamps,)
+        :return: the number of samples queued (excluding padding)
+        """
+        samples = np.atleast_2d(samples)
+        total = samples.shape[1]
+        sent = 0
+        while sent < total:
+            segment = await self.acquire()
+            nsamps = min(self._segment_size, total - sent)
+            segment[:, :nsamps] = samples[:, sent : sent + nsamps]
+            if nsamps < self._segment_size:
+                segment[:, nsamps:] = 0
+            self.commit()
+            sent += nsamps
+        return sent
+
+    def get_timeout_count(self):
+        """Return the number of send timeouts seen by the worker."""
+        return self._buffer.get_timeout_count()
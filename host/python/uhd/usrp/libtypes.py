@@ -26,4 +26,6 @@ FEConnection = lib.usrp.fe_connection
 StreamArgs = lib.usrp.stream_args
 RXStreamer = lib.usrp.rx_streamer
 TXStreamer = lib.usrp.tx_streamer
+RXRingBuffer = lib.usrp.rx_ring_buffer
+TXRingBuffer = lib.usrp.tx_ring_buffer
 # pylint: enable=invalid-name
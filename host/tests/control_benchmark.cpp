@@ -0,0 +1,367 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/experts/expert_container.hpp>
+#include <uhd/experts/expert_factory.hpp>
+#include <uhd/property_tree.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/rfnoc/clock_iface.hpp>
+#include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd;
+using namespace uhd::experts;
+using namespace uhd::rfnoc;
+
+/*!
+ * Benchmark harness: times each operation individually and reports the
+ * throughput and latency distribution. Control-plane operations are hundreds
+ * of nanoseconds and up, so the per-call clock overhead is in the noise.
+ */
+template <typename op_fn>
+void run_benchmark(const std::string& name, const size_t iterations, op_fn&& op)
+{
+    std::vector<double> samples_ns;
+    samples_ns.reserve(iterations);
+
+    for (size_t i = 0; i < iterations; i++) {
+        const auto start_time = std::chrono::steady_clock::now();
+        op(i);
+        const auto end_time = std::chrono::steady_clock::now();
+        samples_ns.push_back(
+            std::chrono::duration<double, std::nano>(end_time - start_time).count());
+    }
+
+    std::sort(samples_ns.begin(), samples_ns.end());
+    const double mean = std::accumulate(samples_ns.begin(), samples_ns.end(), 0.0)
+                        / samples_ns.size();
+    auto percentile = [&samples_ns](const double pct) {
+        const size_t index = std::min(samples_ns.size() - 1,
+            static_cast<size_t>(pct * double(samples_ns.size())));
+        return samples_ns[index];
+    };
+
+    std::cout << boost::format("%-36s %12.0f ops/s  mean %8.0f ns  p50 %8.0f ns  "
+                               "p99 %8.0f ns  max %8.0f ns\n")
+                     % name % (1e9 / mean) % mean % percentile(0.5) % percentile(0.99)
+                     % samples_ns.back();
+}
+
+/*!
+ * Property tree benchmarks
+ */
+void benchmark_property_tree()
+{
+    auto tree = property_tree::make();
+
+    // A property with a coercer and a subscriber, the typical shape of a
+    // tune-relevant property (e.g. a frequency with bounds clipping and a
+    // hardware-update callback)
+    double shadow = 0.0;
+    tree->create<double>("/mboards/0/rx_frontends/0/freq")
+        .set_coercer([](const double freq) { return std::max(freq, 0.0); })
+        .add_coerced_subscriber([&shadow](const double freq) { shadow = freq; })
+        .set(1e9);
+
+    // Resolving a path to a property is a tree walk; real code does this on
+    // every access<> call
+    run_benchmark("prop tree: access by path", 100000, [&tree](const size_t) {
+        tree->access<double>("/mboards/0/rx_frontends/0/freq");
+    });
+
+    auto& freq_prop = tree->access<double>("/mboards/0/rx_frontends/0/freq");
+    run_benchmark("prop tree: set (coerce + subscriber)", 100000,
+        [&freq_prop](const size_t i) { freq_prop.set(1e9 + double(i)); });
+    run_benchmark("prop tree: get", 100000,
+        [&freq_prop](const size_t) { freq_prop.get(); });
+}
+
+/*!
+ * Expert framework benchmarks
+ *
+ * The worker graph is the A..G cascade from expert_test.cpp: writing A
+ * triggers resolution of C = A + B, E = C * D, F = -B, and G = E - F.
+ */
+class worker1_t : public worker_node_t
+{
+public:
+    worker1_t(const node_retriever_t& db)
+        : worker_node_t("A+B=C"), _a(db, "A/desired"), _b(db, "B"), _c(db, "C")
+    {
+        bind_accessor(_a);
+        bind_accessor(_b);
+        bind_accessor(_c);
+    }
+
+private:
+    void resolve() override
+    {
+        _c = _a + _b;
+    }
+
+    data_reader_t<int> _a;
+    data_reader_t<int> _b;
+    data_writer_t<int> _c;
+};
+
+class worker2_t : public worker_node_t
+{
+public:
+    worker2_t(const node_retriever_t& db)
+        : worker_node_t("C*D=E"), _c(db, "C"), _d(db, "D"), _e(db, "E")
+    {
+        bind_accessor(_c);
+        bind_accessor(_d);
+        bind_accessor(_e);
+    }
+
+private:
+    void resolve() override
+    {
+        _e.set(_c.get() * _d.get());
+    }
+
+    data_reader_t<int> _c;
+    data_reader_t<int> _d;
+    data_writer_t<int> _e;
+};
+
+class worker3_t : public worker_node_t
+{
+public:
+    worker3_t(const node_retriever_t& db)
+        : worker_node_t("-B=F"), _b(db, "B"), _f(db, "F")
+    {
+        bind_accessor(_b);
+        bind_accessor(_f);
+    }
+
+private:
+    void resolve() override
+    {
+        _f.set(-_b.get());
+    }
+
+    data_reader_t<int> _b;
+    data_writer_t<int> _f;
+};
+
+class worker4_t : public worker_node_t
+{
+public:
+    worker4_t(const node_retriever_t& db)
+        : worker_node_t("E-F=G"), _e(db, "E"), _f(db, "F"), _g(db, "G")
+    {
+        bind_accessor(_e);
+        bind_accessor(_f);
+        bind_accessor(_g);
+    }
+
+private:
+    void resolve() override
+    {
+        _g.set(_e.get() - _f.get());
+    }
+
+    data_reader_t<int> _e;
+    data_reader_t<int> _f;
+    data_writer_t<int> _g;
+};
+
+void benchmark_experts()
+{
+    expert_container::sptr container = expert_factory::create_container("benchmark");
+    property_tree::sptr tree         = property_tree::make();
+
+    expert_factory::add_dual_prop_node<int>(
+        container, tree, "A", 0, uhd::experts::AUTO_RESOLVE_ON_WRITE);
+    expert_factory::add_prop_node<int>(container, tree, "B", 0);
+    expert_factory::add_data_node<int>(container, "C", 0);
+    expert_factory::add_data_node<int>(container, "D", 1);
+    expert_factory::add_prop_node<int>(
+        container, tree, "E", 0, uhd::experts::AUTO_RESOLVE_ON_READ);
+    expert_factory::add_data_node<int>(container, "F", 0);
+    expert_factory::add_data_node<int>(container, "G", 0);
+
+    expert_factory::add_worker_node<worker1_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker2_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker3_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker4_t>(container, container->node_retriever());
+
+    auto& node_a = tree->access<int>("A");
+    auto& node_e = tree->access<int>("E");
+
+    run_benchmark("experts: dirty write + full resolve", 100000,
+        [&node_a](const size_t i) { node_a.set(int(i & 0xFF)); });
+    run_benchmark("experts: resolve-on-read access", 100000,
+        [&node_e](const size_t) { node_e.get(); });
+    run_benchmark("experts: clean resolve_all", 100000,
+        [&container](const size_t) { container->resolve_all(); });
+}
+
+/*!
+ * Control port endpoint benchmarks
+ *
+ * A mock register file on a responder thread plays the role of the device:
+ * every request the endpoint sends is acknowledged (writes are stored, reads
+ * return the stored value), so the benchmark exercises the full transaction
+ * machinery (flow control, sequence tracking, ACK matching) without hardware.
+ * The responder runs on its own thread because the endpoint invokes the send
+ * function with its lock held, just like a real transport delivers responses
+ * from a separate receiver thread.
+ */
+class mock_reg_responder
+{
+public:
+    ~mock_reg_responder()
+    {
+        if (_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _cv.notify_one();
+            _thread.join();
+        }
+    }
+
+    void start(ctrlport_endpoint::sptr endpoint)
+    {
+        _endpoint = endpoint;
+        _thread   = std::thread([this]() { responder_loop(); });
+    }
+
+    void post_request(const chdr::ctrl_payload& payload)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _requests.push_back(payload);
+        }
+        _cv.notify_one();
+    }
+
+private:
+    void responder_loop()
+    {
+        while (true) {
+            chdr::ctrl_payload request;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() { return _stop || !_requests.empty(); });
+                if (_requests.empty()) {
+                    return;
+                }
+                request = _requests.front();
+                _requests.pop_front();
+            }
+
+            chdr::ctrl_payload response = request;
+            response.is_ack             = true;
+            if (request.op_code == chdr::OP_WRITE) {
+                _regs[request.address] = request.data_vtr.front();
+            } else if (request.op_code == chdr::OP_READ) {
+                response.data_vtr = {_regs[request.address]};
+            }
+            _endpoint->handle_recv(response);
+        }
+    }
+
+    ctrlport_endpoint::sptr _endpoint;
+    std::map<uint32_t, uint32_t> _regs;
+    std::deque<chdr::ctrl_payload> _requests;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::thread _thread;
+    bool _stop = false;
+};
+
+void benchmark_ctrlport()
+{
+    auto responder = std::make_shared<mock_reg_responder>();
+    ctrlport_endpoint::send_fn_t send_fn =
+        [responder](const chdr::ctrl_payload& payload, double /*timeout*/) {
+            responder->post_request(payload);
+        };
+    auto clock = std::make_shared<clock_iface>("mock_clock");
+    clock->set_running(true);
+
+    auto endpoint = ctrlport_endpoint::make(send_fn,
+        0, // my_epid
+        0, // local_port
+        1024, // buff_capacity
+        10, // max_outstanding_async_msgs
+        *clock, // client_clk
+        *clock // timebase_clk
+    );
+    responder->start(endpoint);
+
+    run_benchmark("ctrlport: poke32", 50000, [&endpoint](const size_t i) {
+        endpoint->poke32(uint32_t(i & 0xFF) * sizeof(uint32_t), uint32_t(i));
+    });
+    run_benchmark("ctrlport: peek32 (full round trip)", 50000,
+        [&endpoint](const size_t i) {
+            endpoint->peek32(uint32_t(i & 0xFF) * sizeof(uint32_t));
+        });
+    run_benchmark("ctrlport: poke32 + ack", 50000, [&endpoint](const size_t i) {
+        endpoint->poke32(
+            uint32_t(i & 0xFF) * sizeof(uint32_t), uint32_t(i), time_spec_t::ASAP, true);
+    });
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    po::options_description desc("Allowed options");
+    desc.add_options()("help", "help message");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Control Plane Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of control plane operations: property\n"
+                     "    tree access, expert graph resolution, and control\n"
+                     "    port transactions against a mock register file. No\n"
+                     "    parameters are needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of property tree operations                     \n";
+    std::cout << "----------------------------------------------------------\n";
+    benchmark_property_tree();
+    std::cout << "\n";
+
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of expert graph resolution                      \n";
+    std::cout << "----------------------------------------------------------\n";
+    benchmark_experts();
+    std::cout << "\n";
+
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of ctrlport transactions with mock registers    \n";
+    std::cout << "----------------------------------------------------------\n";
+    benchmark_ctrlport();
+    std::cout << "\n";
+
+    return EXIT_SUCCESS;
+}
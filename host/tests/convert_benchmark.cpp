@@ -0,0 +1,188 @@
+//
+// Copyright 2024 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Benchmark for the converter registry. Times every registered converter
+// ID at every registered priority across a range of buffer sizes and
+// reports throughput, so converter performance can be measured on a given
+// CPU before a deployment. If a lower-priority kernel outperforms the one
+// the registry would select, the benchmark flags it.
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd;
+
+namespace {
+
+struct benchmark_result
+{
+    double samps_per_sec = 0.0;
+    double bytes_per_sec = 0.0;
+};
+
+//! Get the item size for a format, or 0 if the registry doesn't know it
+size_t get_item_size(const std::string& format)
+{
+    try {
+        return convert::get_bytes_per_item(format);
+    } catch (const uhd::key_error&) {
+        return 0;
+    }
+}
+
+//! Time one converter instance on buffers of nsamps items
+benchmark_result run_benchmark(convert::converter::sptr conv,
+    const convert::id_type& id,
+    const size_t bytes_in,
+    const size_t bytes_out,
+    const size_t nsamps,
+    const double duration_s)
+{
+    // Buffers are zero-filled; the kernels are data-independent
+    std::vector<std::vector<char>> in_buffs(id.num_inputs);
+    std::vector<std::vector<char>> out_buffs(id.num_outputs);
+    std::vector<const void*> in_ptrs;
+    std::vector<void*> out_ptrs;
+    for (auto& buff : in_buffs) {
+        buff.resize(nsamps * bytes_in);
+        in_ptrs.push_back(buff.data());
+    }
+    for (auto& buff : out_buffs) {
+        buff.resize(nsamps * bytes_out);
+        out_ptrs.push_back(buff.data());
+    }
+
+    conv->set_scalar(1.0 / 32767.0);
+
+    // warm up caches and branch predictors
+    conv->conv(in_ptrs, out_ptrs, nsamps);
+
+    using clock = std::chrono::steady_clock;
+    size_t iterations = 0;
+    const auto start  = clock::now();
+    auto elapsed      = start - start;
+    while (std::chrono::duration<double>(elapsed).count() < duration_s) {
+        conv->conv(in_ptrs, out_ptrs, nsamps);
+        iterations++;
+        elapsed = clock::now() - start;
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    benchmark_result result;
+    result.samps_per_sec = iterations * nsamps / seconds;
+    result.bytes_per_sec =
+        iterations * nsamps
+        * (bytes_in * id.num_inputs + bytes_out * id.num_outputs) / seconds;
+    return result;
+}
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t min_size_bytes, max_size_bytes;
+    double duration_s;
+    std::string filter;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("min-size", po::value<size_t>(&min_size_bytes)->default_value(4096), "smallest buffer size in bytes")
+        ("max-size", po::value<size_t>(&max_size_bytes)->default_value(8 * 1024 * 1024), "largest buffer size in bytes")
+        ("duration", po::value<double>(&duration_s)->default_value(0.25), "time to spend on each measurement in seconds")
+        ("filter", po::value<std::string>(&filter)->default_value(""), "only benchmark IDs whose string contains this substring")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << "UHD Converter Benchmark " << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    auto ids = convert::get_ids();
+    std::sort(ids.begin(), ids.end(),
+        [](const convert::id_type& lhs, const convert::id_type& rhs) {
+            return lhs.to_string() < rhs.to_string();
+        });
+
+    std::cout << "Throughput in Msps (samples per second, per channel) and GB/s\n"
+              << "(input plus output bytes). The kernel the registry selects is\n"
+              << "marked with '*'.\n"
+              << std::endl;
+
+    for (const auto& id : ids) {
+        if (not filter.empty() and id.to_string().find(filter) == std::string::npos) {
+            continue;
+        }
+
+        const size_t bytes_in  = get_item_size(id.input_format);
+        const size_t bytes_out = get_item_size(id.output_format);
+        if (bytes_in == 0 or bytes_out == 0) {
+            std::cout << id.to_string() << ": skipped (unknown item size)"
+                      << std::endl;
+            continue;
+        }
+
+        auto prios = convert::get_priorities(id);
+        std::sort(prios.begin(), prios.end(), std::greater<convert::priority_type>());
+        const auto selected_prio = prios.front();
+
+        std::cout << id.to_string() << std::endl;
+
+        // size -> (prio -> result), to compare kernels per buffer size
+        std::map<size_t, std::map<convert::priority_type, benchmark_result>> results;
+
+        for (const auto prio : prios) {
+            auto conv = convert::get_converter(id, prio)();
+            std::cout << "  prio " << prio << (prio == selected_prio ? " *" : "  ");
+            for (size_t size = min_size_bytes; size <= max_size_bytes; size *= 8) {
+                const size_t nsamps = size / std::max(bytes_in, bytes_out);
+                if (nsamps == 0) {
+                    continue;
+                }
+                const auto result = run_benchmark(
+                    conv, id, bytes_in, bytes_out, nsamps, duration_s);
+                results[size][prio] = result;
+                std::cout << " | " << size / 1024 << " KiB: "
+                          << size_t(result.samps_per_sec / 1e6) << " Msps, "
+                          << result.bytes_per_sec / 1e9 << " GB/s";
+            }
+            std::cout << std::endl;
+        }
+
+        // flag buffer sizes where a lower-priority kernel wins
+        for (const auto& size_results : results) {
+            const auto& by_prio = size_results.second;
+            const double selected = by_prio.at(selected_prio).samps_per_sec;
+            for (const auto& prio_result : by_prio) {
+                if (prio_result.first != selected_prio
+                    and prio_result.second.samps_per_sec > selected * 1.05) {
+                    std::cout << "  WARNING: prio " << prio_result.first
+                              << " outperforms selected prio " << selected_prio
+                              << " at " << size_results.first / 1024 << " KiB ("
+                              << size_t(prio_result.second.samps_per_sec / 1e6)
+                              << " vs " << size_t(selected / 1e6) << " Msps)"
+                              << std::endl;
+                }
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
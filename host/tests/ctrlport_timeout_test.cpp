@@ -0,0 +1,61 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/rfnoc/clock_iface.hpp>
+#include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+BOOST_AUTO_TEST_CASE(test_async_transaction_timeout)
+{
+    // A send function that swallows every request: no response will ever
+    // arrive, so the endpoint's timer wheel is the only thing that can
+    // complete the futures below
+    ctrlport_endpoint::send_fn_t mock_send_fn = [](const chdr::ctrl_payload& /*payload*/,
+                                                    double /*timeout*/) {
+        // noop
+    };
+    std::shared_ptr<clock_iface> mock_clock = std::make_shared<clock_iface>("mock_clock");
+    mock_clock->set_running(true);
+
+    std::shared_ptr<ctrlport_endpoint> endpoint = ctrlport_endpoint::make(mock_send_fn,
+        0, // my_epid
+        0, // local_port
+        1024, // buff_capacity
+        10, // max_outstanding_async_msgs
+        *mock_clock, // client_clk
+        *mock_clock // timebase_clk
+    );
+
+    // Shorten the policy timeout so the test doesn't dawdle
+    endpoint->set_policy("default", uhd::device_addr_t("timeout=0.05"));
+
+    // Issue a burst of async pokes. Every future must become ready on its
+    // own (no further traffic arrives to nudge the endpoint) and surface the
+    // timeout as an exception.
+    std::vector<std::future<void>> futures;
+    for (uint32_t i = 0; i < 16; i++) {
+        futures.push_back(endpoint->poke32_async(i * sizeof(uint32_t), i));
+    }
+    for (auto& future : futures) {
+        BOOST_REQUIRE(
+            future.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        BOOST_CHECK_THROW(future.get(), uhd::op_timeout);
+    }
+
+    // Async reads fail the same way
+    std::future<uint32_t> peek_future = endpoint->peek32_async(0);
+    BOOST_REQUIRE(
+        peek_future.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    BOOST_CHECK_THROW(peek_future.get(), uhd::op_timeout);
+}
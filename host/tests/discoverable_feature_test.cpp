@@ -87,6 +87,17 @@ BOOST_AUTO_TEST_CASE(test_get_feature_works)
     BOOST_CHECK_EQUAL(f1.get_feature_name(), "test_feature1");
 }
 
+BOOST_AUTO_TEST_CASE(test_get_feature_sptr_works)
+{
+    test_feature_getter feature_getter(true, false);
+    auto f0 = feature_getter.get_feature_sptr<test_feature0>();
+    BOOST_REQUIRE(f0);
+    BOOST_CHECK_EQUAL(f0->get_feature_name(), "test_feature0");
+    // Missing features yield a null handle instead of throwing
+    auto f1 = feature_getter.get_feature_sptr<test_feature1>();
+    BOOST_CHECK(!f1);
+}
+
 BOOST_AUTO_TEST_CASE(test_get_feature_throws)
 {
     test_feature_getter feature_getter(false, true);
@@ -0,0 +1,128 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/compression.hpp>
+#include <uhd/utils/disk_writer.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+const std::string TEST_FILENAME = "disk_writer_test.dat";
+
+//! Read the whole file back as bytes
+std::vector<char> read_file(const std::string& path)
+{
+    std::ifstream file(path, std::ifstream::binary);
+    return std::vector<char>(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_disk_writer_roundtrip)
+{
+    // Buffered I/O so the test also passes on filesystems without O_DIRECT
+    uhd::disk_writer::config_t config;
+    config.path       = TEST_FILENAME;
+    config.block_size = 4096;
+    config.num_blocks = 4;
+    config.direct_io  = false;
+
+    // Three full blocks plus a partial tail, so both the worker path and the
+    // padded tail write get exercised
+    std::vector<char> data(3 * 4096 + 1000);
+    std::iota(data.begin(), data.end(), 0);
+
+    {
+        auto writer = uhd::disk_writer::make(config);
+        size_t accepted = 0;
+        // Write in odd-sized chunks to hit the block-spanning copy path.
+        // Writes may be dropped if the worker falls behind the tiny ring, so
+        // only the accepted prefix is guaranteed on disk.
+        size_t offset = 0;
+        while (offset < data.size()) {
+            const size_t nbytes = std::min<size_t>(777, data.size() - offset);
+            const size_t ret    = writer->write(&data[offset], nbytes);
+            accepted += ret;
+            if (ret < nbytes) {
+                break;
+            }
+            offset += nbytes;
+        }
+        writer->close();
+        // Everything that was accepted into the ring must reach the disk, in
+        // order, with no tail padding left behind
+        BOOST_CHECK_EQUAL(writer->get_bytes_written(), accepted);
+
+        const std::vector<char> readback = read_file(TEST_FILENAME);
+        BOOST_REQUIRE_EQUAL(readback.size(), accepted);
+        BOOST_CHECK(std::equal(readback.begin(), readback.end(), data.begin()));
+    }
+
+    std::remove(TEST_FILENAME.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_disk_writer_invalid_config)
+{
+    uhd::disk_writer::config_t config;
+    config.path       = TEST_FILENAME;
+    config.block_size = 1000; // not a multiple of 4096
+    BOOST_CHECK_THROW(uhd::disk_writer::make(config), uhd::value_error);
+
+    config.block_size = 4096;
+    config.num_blocks = 1;
+    BOOST_CHECK_THROW(uhd::disk_writer::make(config), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_disk_writer_compression)
+{
+    // Codec availability is a build-time option: exercise whichever codecs
+    // this build has, and check that an unknown codec is rejected before any
+    // file is created
+    for (const std::string& codec : uhd::chunk_compressor::get_available_codecs()) {
+        BOOST_CHECK(codec == "lz4" or codec == "zstd");
+
+        // The frame must fit the bound and 4 KiB of a constant byte must
+        // shrink substantially
+        auto compressor = uhd::chunk_compressor::make(codec);
+        const std::vector<char> input(4096, 'u');
+        std::vector<char> frame(compressor->bound(input.size()));
+        const size_t nbytes = compressor->compress(
+            frame.data(), frame.size(), input.data(), input.size());
+        BOOST_CHECK(nbytes > 0);
+        BOOST_CHECK(nbytes <= frame.size());
+        BOOST_CHECK(nbytes < input.size() / 2);
+
+        // A compressed capture must also come out smaller than its input
+        uhd::disk_writer::config_t config;
+        config.path        = TEST_FILENAME;
+        config.block_size  = 4096;
+        config.num_blocks  = 4;
+        config.compression = codec;
+        auto writer        = uhd::disk_writer::make(config);
+        size_t accepted    = 0;
+        for (size_t i = 0; i < 8; i++) {
+            accepted += writer->write(input.data(), input.size());
+        }
+        writer->close();
+        BOOST_CHECK(writer->get_bytes_written() > 0);
+        BOOST_CHECK(writer->get_bytes_written() < accepted);
+        BOOST_CHECK_EQUAL(read_file(TEST_FILENAME).size(), writer->get_bytes_written());
+        std::remove(TEST_FILENAME.c_str());
+    }
+
+    BOOST_CHECK_THROW(
+        uhd::chunk_compressor::make("nonexistent"), uhd::runtime_error);
+    uhd::disk_writer::config_t config;
+    config.path        = TEST_FILENAME;
+    config.compression = "nonexistent";
+    BOOST_CHECK_THROW(uhd::disk_writer::make(config), uhd::runtime_error);
+}
@@ -0,0 +1,217 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_block.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+//! A mock RX streamer that produces a per-channel ramp of floats
+class mock_rx_streamer : public uhd::rx_streamer
+{
+public:
+    mock_rx_streamer(const size_t num_chans) : _num_chans(num_chans) {}
+
+    size_t get_num_channels() const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps() const override
+    {
+        return 1000;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        const double,
+        const bool) override
+    {
+        metadata.reset();
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            float* buff = static_cast<float*>(buffs[chan]);
+            for (size_t i = 0; i < nsamps_per_buff; i++) {
+                buff[i] = float(chan * 10000 + _counter + i);
+            }
+        }
+        _counter += nsamps_per_buff;
+        last_recv_nsamps = nsamps_per_buff;
+        return nsamps_per_buff;
+    }
+
+    void issue_stream_cmd(const uhd::stream_cmd_t& stream_cmd) override
+    {
+        last_stream_mode = stream_cmd.stream_mode;
+    }
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+
+    size_t last_recv_nsamps = 0;
+    uhd::stream_cmd_t::stream_mode_t last_stream_mode =
+        uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS;
+
+private:
+    const size_t _num_chans;
+    size_t _counter = 0;
+};
+
+//! Rate-preserving stage: multiplies every sample by a constant
+class gain_block : public host_block
+{
+public:
+    gain_block(const float gain) : _gain(gain) {}
+
+    size_t process(const void* in, const size_t in_nitems, void* out) override
+    {
+        const float* in_f = static_cast<const float*>(in);
+        float* out_f      = static_cast<float*>(out);
+        for (size_t i = 0; i < in_nitems; i++) {
+            out_f[i] = in_f[i] * _gain;
+        }
+        return in_nitems;
+    }
+
+private:
+    const float _gain;
+};
+
+//! Decimating stage: keeps every other sample
+class decim_block : public host_block
+{
+public:
+    size_t process(const void* in, const size_t in_nitems, void* out) override
+    {
+        const float* in_f = static_cast<const float*>(in);
+        float* out_f      = static_cast<float*>(out);
+        for (size_t i = 0; i < in_nitems / 2; i++) {
+            out_f[i] = in_f[2 * i];
+        }
+        return in_nitems / 2;
+    }
+};
+
+//! Interpolating stage: repeats every sample twice
+class interp_block : public host_block
+{
+public:
+    size_t get_output_bound(const size_t in_nitems) const override
+    {
+        return 2 * in_nitems;
+    }
+
+    size_t process(const void* in, const size_t in_nitems, void* out) override
+    {
+        const float* in_f = static_cast<const float*>(in);
+        float* out_f      = static_cast<float*>(out);
+        for (size_t i = 0; i < in_nitems; i++) {
+            out_f[2 * i]     = in_f[i];
+            out_f[2 * i + 1] = in_f[i];
+        }
+        return 2 * in_nitems;
+    }
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_host_block_make_errors)
+{
+    auto source = std::make_shared<mock_rx_streamer>(2);
+    // One chain for two channels
+    BOOST_CHECK_THROW(
+        host_block_streamer::make(source, {{}}, sizeof(float)), uhd::value_error);
+    BOOST_CHECK_THROW(host_block_streamer::make(source, {{}, {}}, 0), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_host_block_passthrough)
+{
+    auto source   = std::make_shared<mock_rx_streamer>(1);
+    auto streamer = host_block_streamer::make(source, {{}}, sizeof(float));
+    BOOST_CHECK_EQUAL(streamer->get_num_channels(), 1);
+    BOOST_CHECK_EQUAL(streamer->get_max_num_samps(), source->get_max_num_samps());
+
+    std::vector<float> buff(256);
+    uhd::rx_metadata_t md;
+    BOOST_REQUIRE_EQUAL(streamer->recv({buff.data()}, buff.size(), md), buff.size());
+    for (size_t i = 0; i < buff.size(); i++) {
+        BOOST_REQUIRE_EQUAL(buff[i], float(i));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_block_chains_parallel)
+{
+    constexpr size_t NUM_CHANS = 4;
+    auto source                = std::make_shared<mock_rx_streamer>(NUM_CHANS);
+    // Two stages per channel (x2 then x3), executed on three workers plus
+    // the recv() caller
+    std::vector<std::vector<host_block::sptr>> chains;
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        chains.push_back(
+            {std::make_shared<gain_block>(2.0f), std::make_shared<gain_block>(3.0f)});
+    }
+    auto streamer = host_block_streamer::make(source, chains, sizeof(float), 3);
+
+    std::vector<std::vector<float>> buffs(NUM_CHANS, std::vector<float>(512));
+    std::vector<void*> buff_ptrs;
+    for (auto& buff : buffs) {
+        buff_ptrs.push_back(buff.data());
+    }
+    uhd::rx_metadata_t md;
+    BOOST_REQUIRE_EQUAL(streamer->recv(buff_ptrs, 512, md), 512);
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        for (size_t i = 0; i < 512; i++) {
+            BOOST_REQUIRE_EQUAL(buffs[chan][i], 6.0f * float(chan * 10000 + i));
+        }
+    }
+
+    // Stream commands pass through to the source
+    streamer->issue_stream_cmd(
+        uhd::stream_cmd_t(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS));
+    BOOST_CHECK(
+        source->last_stream_mode == uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+}
+
+BOOST_AUTO_TEST_CASE(test_host_block_interpolation)
+{
+    auto source   = std::make_shared<mock_rx_streamer>(1);
+    auto streamer = host_block_streamer::make(
+        source, {{std::make_shared<interp_block>()}}, sizeof(float));
+    // A x2 interpolator doubles the advertised max output...
+    BOOST_CHECK_EQUAL(streamer->get_max_num_samps(), 2 * source->get_max_num_samps());
+
+    // ...and recv() must pull only half the requested samples so the
+    // expanded output still fits the caller's buffer
+    std::vector<float> buff(500);
+    uhd::rx_metadata_t md;
+    BOOST_REQUIRE_EQUAL(streamer->recv({buff.data()}, buff.size(), md), 500);
+    BOOST_CHECK_EQUAL(source->last_recv_nsamps, 250);
+    for (size_t i = 0; i < 250; i++) {
+        BOOST_REQUIRE_EQUAL(buff[2 * i], float(i));
+        BOOST_REQUIRE_EQUAL(buff[2 * i + 1], float(i));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_block_misaligned_chains)
+{
+    auto source   = std::make_shared<mock_rx_streamer>(2);
+    auto streamer = host_block_streamer::make(source,
+        {{std::make_shared<decim_block>()}, {std::make_shared<gain_block>(1.0f)}},
+        sizeof(float));
+
+    std::vector<float> buff0(64), buff1(64);
+    std::vector<void*> buff_ptrs{buff0.data(), buff1.data()};
+    uhd::rx_metadata_t md;
+    BOOST_CHECK_THROW(streamer->recv(buff_ptrs, 64, md), uhd::runtime_error);
+}
@@ -142,3 +142,51 @@ BOOST_AUTO_TEST_CASE(lmx_sync_tune_test)
     // VCO_PHASE_SYNC_EN must be on in this case
     BOOST_CHECK(mem.mem[0] & (1 << 14));
 }
+
+BOOST_AUTO_TEST_CASE(lmx_burst_commit_test)
+{
+    // Drive two identical LOs, one through the burst factory and one through
+    // single pokes, and check the bursts produce the same register state
+    auto mem       = lmx2572_mem{};
+    auto burst_mem = lmx2572_mem{};
+    size_t num_bursts = 0;
+    size_t last_burst_len = 0;
+    auto lo = lmx2572_iface::make(
+        [&](const uint8_t addr, const uint16_t data) { mem.poke16(addr, data); },
+        [&](const uint8_t addr) -> uint16_t { return mem.peek16(addr); },
+        [](const uhd::time_spec_t&) {});
+    auto burst_lo = lmx2572_iface::make(
+        [&](const uint8_t addr, const uint16_t data) { burst_mem.poke16(addr, data); },
+        [&](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+            num_bursts++;
+            last_burst_len = writes.size();
+            // R0 must come last for double-buffering
+            BOOST_REQUIRE(!writes.empty());
+            BOOST_CHECK_EQUAL(writes.back().first, 0);
+            for (const auto& write : writes) {
+                burst_mem.poke16(write.first, write.second);
+            }
+        },
+        [&](const uint8_t addr) -> uint16_t { return burst_mem.peek16(addr); },
+        [](const uhd::time_spec_t&) {});
+
+    for (auto& dut : {lo, burst_lo}) {
+        dut->reset();
+        dut->set_sync_mode(true);
+        dut->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, true);
+        dut->set_frequency(50 * 64e6, 64e6, false);
+        dut->commit();
+    }
+    // A retune must be exactly one burst
+    num_bursts = 0;
+    for (auto& dut : {lo, burst_lo}) {
+        dut->set_frequency(10 * 64e6, 64e6, false);
+        dut->commit();
+    }
+    BOOST_CHECK_EQUAL(num_bursts, 1);
+    // Only the changed registers plus R0 go out in the burst
+    BOOST_CHECK(last_burst_len < size_t(burst_mem.regs.get_num_regs()));
+    for (const auto& reg : mem.mem) {
+        BOOST_CHECK_EQUAL(reg.second, burst_mem.mem.at(reg.first));
+    }
+}
@@ -4,9 +4,12 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhdlib/features/discoverable_feature_registry.hpp>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 
 using namespace uhd;
@@ -169,3 +172,43 @@ BOOST_AUTO_TEST_CASE(test_mb_controller)
     tk->set_time_next_pps(uhd::time_spec_t(TIME_1));
     BOOST_CHECK_EQUAL(tk->get_ticks_last_pps(), TIME_1 * TICK_RATE);
 }
+
+BOOST_AUTO_TEST_CASE(test_timekeeper_clock_model)
+{
+    auto mmbc = std::make_shared<mock_mb_controller>();
+    auto tk   = mmbc->get_timekeeper(0);
+    auto tk_mock = std::dynamic_pointer_cast<mock_timekeeper>(tk);
+    BOOST_REQUIRE(tk_mock);
+    tk_mock->update_tick_rate(200e6);
+
+    // Without any observations, conversions must fail
+    BOOST_CHECK_THROW(
+        tk->device_time_to_host_time(uhd::time_spec_t(1.0)), uhd::runtime_error);
+
+    // A single round-trip observation anchors the model: converting the
+    // current device time must yield approximately the current host time
+    constexpr double TIME_NOW = 100.0;
+    tk->set_time_now(uhd::time_spec_t(TIME_NOW));
+    tk->update_clock_model();
+    const auto host_now = std::chrono::system_clock::now();
+    const auto converted = tk->device_time_to_host_time(uhd::time_spec_t(TIME_NOW));
+    const double anchor_error =
+        std::abs(std::chrono::duration<double>(converted - host_now).count());
+    BOOST_CHECK_LT(anchor_error, 0.1);
+
+    // Device time deltas must map to host time deltas (drift is 1.0 here)
+    const auto converted_later =
+        tk->device_time_to_host_time(uhd::time_spec_t(TIME_NOW + 0.5));
+    const double delta =
+        std::chrono::duration<double>(converted_later - converted).count();
+    BOOST_CHECK_CLOSE(delta, 0.5, 0.1);
+
+    // Conversions anchor to the most recent observation, so a jump in the
+    // device time (e.g. after set_time_now()) doesn't corrupt them
+    tk->observe_device_time(uhd::time_spec_t(5000.0));
+    const auto converted_reset = tk->device_time_to_host_time(uhd::time_spec_t(5000.0));
+    const double reset_error = std::abs(
+        std::chrono::duration<double>(converted_reset - std::chrono::system_clock::now())
+            .count());
+    BOOST_CHECK_LT(reset_error, 0.1);
+}
@@ -5,6 +5,7 @@
 //
 
 #include "common/mock_link.hpp"
+#include <uhd/exception.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <boost/test/unit_test.hpp>
 #include <atomic>
@@ -239,6 +240,38 @@ BOOST_AUTO_TEST_CASE(test_recv)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_batch_release)
+{
+    for (const auto wait_mode : wait_modes) {
+        params_t params  = {{}, RECV_ONLY, wait_mode};
+        auto mock_io_srv = std::make_shared<mock_io_service>();
+        auto io_srv      = offload_io_service::make(mock_io_srv, params);
+        auto recv_link   = make_recv_link(8);
+        io_srv->attach_recv_link(recv_link);
+
+        auto recv_client =
+            io_srv->make_recv_client(recv_link, 4, nullptr, nullptr, 0, nullptr);
+
+        for (size_t iteration = 0; iteration < 3; iteration++) {
+            for (size_t i = 0; i < 4; i++) {
+                recv_link->push_back_recv_packet(
+                    boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+            }
+            mock_io_srv->allocate_recv_frames(0, 4);
+
+            // Hold a batch of buffers and release them in one call
+            std::vector<frame_buff::uptr> buffs;
+            for (size_t i = 0; i < 4; i++) {
+                auto buff = recv_client->get_recv_buff(100);
+                BOOST_CHECK(buff != nullptr);
+                buffs.push_back(std::move(buff));
+            }
+            recv_client->release_recv_buffs(buffs.data(), buffs.size());
+        }
+        recv_client.reset();
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_send_recv)
 {
     auto mock_io_srv = std::make_shared<mock_io_service>();
@@ -351,3 +384,60 @@ BOOST_AUTO_TEST_CASE(test_attach_detach)
     mock_io_srv->allocate_recv_frames(2, 1);
     recv_client2->release_recv_buff(recv_client2->get_recv_buff(100));
 }
+
+BOOST_AUTO_TEST_CASE(test_worker_pool)
+{
+    params_t params;
+    params.num_worker_threads = 3;
+
+    auto mock_io_srv = std::make_shared<mock_io_service>();
+    auto io_srv      = offload_io_service::make(mock_io_srv, params);
+
+    constexpr size_t num_channels = 4;
+    std::vector<mock_recv_link::sptr> recv_links;
+    std::vector<mock_send_link::sptr> send_links;
+    std::vector<recv_io_if::sptr> recv_clients;
+    std::vector<send_io_if::sptr> send_clients;
+
+    for (size_t ch = 0; ch < num_channels; ch++) {
+        auto recv_link = make_recv_link(5);
+        auto send_link = make_send_link(5);
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+        recv_clients.push_back(
+            io_srv->make_recv_client(recv_link, 1, nullptr, nullptr, 0, nullptr));
+        send_clients.push_back(io_srv->make_send_client(
+            send_link, 1, nullptr, nullptr, 0, nullptr, nullptr));
+        recv_links.push_back(recv_link);
+        send_links.push_back(send_link);
+    }
+
+    for (size_t ch = 0; ch < num_channels; ch++) {
+        for (size_t i = 0; i < 10; i++) {
+            recv_links[ch]->push_back_recv_packet(
+                boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+        }
+    }
+
+    for (size_t i = 0; i < 10; i++) {
+        for (size_t ch = 0; ch < num_channels; ch++) {
+            send_clients[ch]->release_send_buff(send_clients[ch]->get_send_buff(100));
+            mock_io_srv->allocate_recv_frames(ch, 1);
+            recv_clients[ch]->release_recv_buff(recv_clients[ch]->get_recv_buff(100));
+        }
+    }
+
+    send_clients.clear();
+    recv_clients.clear();
+}
+
+BOOST_AUTO_TEST_CASE(test_worker_pool_requires_poll)
+{
+    params_t params;
+    params.client_type        = RECV_ONLY;
+    params.wait_mode          = BLOCK;
+    params.num_worker_threads = 2;
+
+    auto mock_io_srv = std::make_shared<mock_io_service>();
+    BOOST_CHECK_THROW(offload_io_service::make(mock_io_srv, params), uhd::value_error);
+}
@@ -253,6 +253,77 @@ BOOST_AUTO_TEST_CASE(test_prop_tree_wrong_type_range)
     BOOST_CHECK_EQUAL(prop.get().start(), 5.0);
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_tree_access_cached)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    tree->create<int>("/test/prop0");
+
+    uhd::path_handle handle = tree->intern("/test/prop0");
+    tree->access_cached<int>(handle).set(42);
+    BOOST_CHECK_EQUAL(tree->access_cached<int>(handle).get(), 42);
+    BOOST_CHECK_EQUAL(tree->access<int>("/test/prop0").get(), 42);
+
+    // Accessing through the handle with the wrong type throws like access()
+    BOOST_CHECK_THROW(tree->access_cached<std::string>(handle), uhd::type_error);
+    BOOST_CHECK_EQUAL(tree->access_cached<int>(handle).get(), 42);
+
+    // Re-creating the property at the same path expires the handle, and the
+    // next access resolves the path again
+    tree->pop<int>("/test/prop0");
+    tree->create<int>("/test/prop0").set(34);
+    BOOST_CHECK_EQUAL(tree->access_cached<int>(handle).get(), 34);
+
+    // A removed path throws on access through the handle
+    tree->remove("/test/prop0");
+    BOOST_CHECK_THROW(tree->access_cached<int>(handle), uhd::lookup_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_prop_update_transaction)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    uhd::property<int>& prop0     = tree->create<int>("/test/prop0");
+    uhd::property<int>& prop1     = tree->create<int>("/test/prop1");
+
+    setter_type setter0, setter1;
+    prop0.add_coerced_subscriber(
+        std::bind(&setter_type::doit, &setter0, std::placeholders::_1));
+    prop1.add_coerced_subscriber(
+        std::bind(&setter_type::doit, &setter1, std::placeholders::_1));
+
+    // Repeated writes inside a transaction fire each subscriber once, with
+    // the final value, at commit
+    tree->begin_update();
+    prop0.set(1);
+    prop0.set(2);
+    prop0.set(3);
+    prop1.set(42);
+    BOOST_CHECK_EQUAL(setter0._count, 0);
+    BOOST_CHECK_EQUAL(setter1._count, 0);
+    BOOST_CHECK_EQUAL(prop0.get(), 3);
+    tree->commit();
+    BOOST_CHECK_EQUAL(setter0._count, 1);
+    BOOST_CHECK_EQUAL(setter0._x, 3);
+    BOOST_CHECK_EQUAL(setter1._count, 1);
+    BOOST_CHECK_EQUAL(setter1._x, 42);
+
+    // Nested transactions defer until the outermost commit
+    tree->begin_update();
+    tree->begin_update();
+    prop0.set(7);
+    tree->commit();
+    BOOST_CHECK_EQUAL(setter0._count, 1);
+    tree->commit();
+    BOOST_CHECK_EQUAL(setter0._count, 2);
+    BOOST_CHECK_EQUAL(setter0._x, 7);
+
+    // Outside a transaction, subscribers fire synchronously as before
+    prop0.set(8);
+    BOOST_CHECK_EQUAL(setter0._count, 3);
+    BOOST_CHECK_EQUAL(setter0._x, 8);
+
+    BOOST_CHECK_THROW(tree->commit(), uhd::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_prop_subtree)
 {
     uhd::property_tree::sptr tree = uhd::property_tree::make();
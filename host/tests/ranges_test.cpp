@@ -81,6 +81,29 @@ BOOST_AUTO_TEST_CASE(test_ranges_clip2)
     BOOST_CHECK_CLOSE(mr.clip(4., true), 3., tolerance);
 }
 
+BOOST_AUTO_TEST_CASE(test_ranges_clip_index)
+{
+    // Exercise the lazily-built clip index on a fine-grained range list and
+    // make sure it is rebuilt when the meta-range is mutated
+    meta_range_t mr;
+    for (size_t i = 0; i < 500; i++) {
+        mr.push_back(range_t(i * 10.0, i * 10.0 + 5.0));
+    }
+
+    BOOST_CHECK_CLOSE(mr.clip(1002.0), 1002.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(1006.0), 1005.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(1009.0), 1010.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.clip(1.0e9), 4995.0, tolerance);
+    BOOST_CHECK_EQUAL(mr.clip(-10.0), 0.0);
+
+    mr.push_back(range_t(6000.0, 7000.0));
+    BOOST_CHECK_CLOSE(mr.clip(1.0e9), 7000.0, tolerance);
+    BOOST_CHECK_CLOSE(mr.stop(), 7000.0, tolerance);
+
+    const meta_range_t copy = mr;
+    BOOST_CHECK_CLOSE(copy.clip(6500.0), 6500.0, tolerance);
+}
+
 BOOST_AUTO_TEST_CASE(test_ranges_compare)
 {
     range_t range(1);
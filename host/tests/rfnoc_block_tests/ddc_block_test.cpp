@@ -66,7 +66,7 @@ BOOST_AUTO_TEST_CASE(test_ddc_block)
     edge_info.is_forward_edge = true;
     edge_info.edge            = detail::graph_t::graph_edge_t::DYNAMIC;
 
-    mock_terminator_t mock_source_term(1, {ACTION_KEY_TUNE_REQUEST});
+    mock_terminator_t mock_source_term(1, {ACTION_KEY_TUNE_REQUEST, ACTION_KEY_STREAM_CMD});
     mock_terminator_t mock_sink_term(1, {ACTION_KEY_TUNE_REQUEST});
 
     UHD_LOG_INFO("TEST", "Priming mock source node props");
@@ -162,4 +162,20 @@ BOOST_AUTO_TEST_CASE(test_ddc_block)
     BOOST_CHECK_CLOSE(tune_req_received->tune_result.target_dsp_freq,
         tune_req_received->tune_result.actual_dsp_freq,
         1e-5);
+
+    // The batched stream command variant must deliver one scaled command per
+    // port to the upstream node
+    UHD_LOG_INFO("TEST", "DDC: Testing batched stream command delivery");
+    test_ddc->set_property<int>("decim", TEST_DECIM, 0);
+    uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+    stream_cmd.num_samps            = 100;
+    const size_t num_actions_before = mock_source_term.received_actions.size();
+    test_ddc->issue_stream_cmd(stream_cmd, std::vector<size_t>{0});
+    BOOST_REQUIRE_EQUAL(
+        mock_source_term.received_actions.size(), num_actions_before + 1);
+    auto stream_cmd_received = std::dynamic_pointer_cast<stream_cmd_action_info>(
+        mock_source_term.received_actions.back());
+    BOOST_REQUIRE(stream_cmd_received);
+    BOOST_CHECK_EQUAL(
+        stream_cmd_received->stream_cmd.num_samps, 100 * size_t(TEST_DECIM));
 }
@@ -159,6 +159,24 @@ BOOST_FIXTURE_TEST_CASE(fft_test_range_errors, fft_block_fixture)
     BOOST_CHECK_THROW(test_fft->set_length(65535), uhd::value_error);
 }
 
+/*
+ * This test case exercises the argument checking of the spectral capture API.
+ * Running an actual capture requires a live streamer and is covered by the
+ * hardware tests.
+ */
+BOOST_FIXTURE_TEST_CASE(fft_test_capture_errors, fft_block_fixture)
+{
+    // A capture cannot be started without a streamer
+    BOOST_CHECK_THROW(
+        test_fft->start_capture(uhd::rx_streamer::sptr(), 16), uhd::value_error);
+    // Pulling spectra without a running capture must fail
+    std::vector<std::complex<int16_t>> buff(test_fft->get_length());
+    BOOST_CHECK_THROW(test_fft->get_spectra(buff.data(), 1, 0.0), uhd::runtime_error);
+    // Stopping without a running capture is a no-op
+    test_fft->stop_capture();
+    BOOST_CHECK_EQUAL(test_fft->get_capture_count(), 0);
+}
+
 /*
  * This test case ensures that the FFT block controller can be added
  * to a graph.
@@ -318,6 +318,35 @@ BOOST_FIXTURE_TEST_CASE(fosphor_test_range_errors, fosphor_block_fixture)
         test_fosphor->set_property<int>("wf_decimation", 300), uhd::value_error);
 }
 
+/*
+ * This test case exercises the argument checking of the managed capture API.
+ * Running an actual capture requires a live streamer and is covered by the
+ * hardware tests.
+ */
+BOOST_FIXTURE_TEST_CASE(fosphor_test_capture_errors, fosphor_block_fixture)
+{
+    std::vector<uint8_t> ring(16 * 1024);
+
+    // A capture cannot be started without a streamer
+    BOOST_CHECK_THROW(
+        test_fosphor->start_capture(uhd::rx_streamer::sptr(), ring.data(), 16, 1024),
+        uhd::value_error);
+    // Invalid ring geometries must be rejected
+    BOOST_CHECK_THROW(
+        test_fosphor->start_capture(uhd::rx_streamer::sptr(), nullptr, 16, 1024),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        test_fosphor->start_capture(uhd::rx_streamer::sptr(), ring.data(), 0, 1024),
+        uhd::value_error);
+    // A pitch smaller than the row size must be rejected
+    BOOST_CHECK_THROW(
+        test_fosphor->start_capture(uhd::rx_streamer::sptr(), ring.data(), 16, 1024, 512),
+        uhd::value_error);
+    // Stopping without a running capture is a no-op
+    test_fosphor->stop_capture();
+    BOOST_CHECK_EQUAL(test_fosphor->get_capture_count(), uint64_t(0));
+}
+
 BOOST_FIXTURE_TEST_CASE(fosphor_test_graph, fosphor_block_fixture)
 {
     detail::graph_t graph{};
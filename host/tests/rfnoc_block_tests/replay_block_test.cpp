@@ -62,6 +62,17 @@ public:
             read_memory[reg_play_fifo_space]   = CMD_Q_MAX;
         }
     }
+
+    //! Every poke is also logged here, in order, so tests can verify write
+    // sequences (e.g., that a play command is issued after its region config)
+    std::vector<std::pair<uint32_t, uint32_t>> poke_history;
+
+protected:
+    void _poke_cb(
+        uint32_t addr, uint32_t data, uhd::time_spec_t /*time*/, bool /*ack*/) override
+    {
+        poke_history.push_back({addr, data});
+    }
 };
 
 /*
@@ -803,6 +814,81 @@ BOOST_FIXTURE_TEST_CASE(replay_test_play_cmd_limit, replay_block_fixture)
     }
 }
 
+/*
+ * This test case ensures that a queued play sequence issues one command per
+ * entry, latches each entry's region before its command, suppresses the
+ * end-of-burst flag on all but the final entry, and validates the sequence
+ * before anything is queued.
+ */
+BOOST_FIXTURE_TEST_CASE(replay_test_play_queued, replay_block_fixture)
+{
+    const size_t port = 0;
+    const uint32_t reg_stream_cmd =
+        get_addr(replay_block_control::REG_PLAY_CMD_ADDR, port);
+    const uint32_t reg_play_base_addr =
+        get_addr(replay_block_control::REG_PLAY_BASE_ADDR_LO_ADDR, port);
+    const uint32_t cmd_no_eob_mask = 1 << 30;
+
+    std::vector<replay_block_control::play_command_t> commands(3);
+    for (size_t i = 0; i < commands.size(); i++) {
+        commands[i].offset = (i + 1) * 0x1000;
+        commands[i].size   = 0x800;
+    }
+
+    reg_iface->poke_history.clear();
+    test_replay->play_queued(commands, port);
+
+    // Walk the poke history and extract (base address at time of command,
+    // command word) for every play command that was issued
+    std::vector<std::pair<uint32_t, uint32_t>> issued_cmds;
+    uint32_t current_base = 0;
+    for (const auto& poke : reg_iface->poke_history) {
+        if (poke.first == reg_play_base_addr) {
+            current_base = poke.second;
+        } else if (poke.first == reg_stream_cmd) {
+            issued_cmds.push_back({current_base, poke.second});
+        }
+    }
+    BOOST_REQUIRE_EQUAL(issued_cmds.size(), commands.size());
+    for (size_t i = 0; i < commands.size(); i++) {
+        const bool last = (i + 1 == commands.size());
+        BOOST_CHECK_EQUAL(issued_cmds[i].first, commands[i].offset);
+        // All entries but the last must suppress the end-of-burst flag
+        BOOST_CHECK_EQUAL(issued_cmds[i].second,
+            replay_block_control::PLAY_CMD_FINITE | (last ? 0 : cmd_no_eob_mask));
+    }
+
+    // A repeating final entry ends in a continuous command
+    commands.back().repeat = true;
+    test_replay->play_queued(commands, port);
+    BOOST_CHECK_EQUAL(reg_iface->write_memory[reg_stream_cmd],
+        replay_block_control::PLAY_CMD_CONTINUOUS);
+    test_replay->stop(port);
+
+    // Only the final entry may repeat
+    commands.front().repeat = true;
+    BOOST_CHECK_THROW(test_replay->play_queued(commands, port), uhd::value_error);
+    commands.front().repeat = false;
+
+    // The whole sequence must fit into the command queue
+    const uint32_t reg_play_cmd_fifo_space =
+        get_addr(replay_block_control::REG_PLAY_CMD_FIFO_SPACE_ADDR, port);
+    reg_iface->read_memory[reg_play_cmd_fifo_space] = commands.size() - 1;
+    reg_iface->poke_history.clear();
+    BOOST_CHECK_THROW(test_replay->play_queued(commands, port), uhd::op_failed);
+    // ...and nothing may have been queued if it does not
+    for (const auto& poke : reg_iface->poke_history) {
+        BOOST_CHECK(poke.first != reg_stream_cmd);
+    }
+    reg_iface->read_memory[reg_play_cmd_fifo_space] = CMD_Q_MAX;
+
+    // Check the free queue space is readable
+    BOOST_CHECK_EQUAL(test_replay->get_play_cmd_fifo_space(port), CMD_Q_MAX);
+
+    // An empty sequence is a no-op
+    test_replay->play_queued({}, port);
+}
+
 /*
  * This test case ensures that the Replay Block can be added to an RFNoC graph.
  */
@@ -41,11 +41,12 @@ public:
         , constants(_num_ports, 0)
         , phase_increments(_num_ports, 0)
         , phasors(_num_ports, 0)
+        , phase_increment_history(_num_ports)
     {
     }
 
     void _poke_cb(
-        uint32_t addr, uint32_t data, uhd::time_spec_t /*time*/, bool /*ack*/) override
+        uint32_t addr, uint32_t data, uhd::time_spec_t time, bool /*ack*/) override
     {
         const size_t port = addr / siggen_block_control::REG_BLOCK_SIZE;
         if (port >= _num_ports) {
@@ -65,6 +66,7 @@ public:
             constants[port] = data;
         } else if (offset == siggen_block_control::REG_PHASE_INC_OFFSET) {
             phase_increments[port] = data;
+            phase_increment_history[port].push_back({data, time});
         } else if (offset == siggen_block_control::REG_CARTESIAN_OFFSET) {
             phasors[port] = data;
         } else {
@@ -146,6 +148,9 @@ public:
     std::vector<uint32_t> constants;
     std::vector<uint32_t> phase_increments;
     std::vector<uint32_t> phasors;
+    //! Every phase increment write, with its command time, in write order
+    std::vector<std::vector<std::pair<uint32_t, uhd::time_spec_t>>>
+        phase_increment_history;
 };
 
 /*
@@ -322,6 +327,75 @@ BOOST_FIXTURE_TEST_CASE(siggen_test_ranges, siggen_block_fixture)
     }
 }
 
+/*
+ * This test case exercises the atomic, timed application of a complete
+ * parameter set, ensuring that all register writes carry the commit time and
+ * that the command time is restored afterwards.
+ */
+BOOST_FIXTURE_TEST_CASE(siggen_test_apply_config, siggen_block_fixture)
+{
+    const size_t port = 0;
+    const uhd::time_spec_t commit_time(5.0);
+
+    siggen_block_control::config_t config;
+    config.waveform             = siggen_waveform::SINE_WAVE;
+    config.amplitude            = 0.5;
+    config.sine_phase_increment = 0.25;
+    test_siggen->apply_config(config, commit_time, port);
+
+    BOOST_CHECK(reg_iface->waveforms.at(port) == siggen_waveform::SINE_WAVE);
+    BOOST_CHECK_EQUAL(reg_iface->phasors.at(port),
+        siggen_mock_reg_iface_t::phasor_to_register({0.5, 0.0}));
+    BOOST_CHECK_EQUAL(reg_iface->phase_increments.at(port),
+        siggen_mock_reg_iface_t::phase_increment_to_register(0.25));
+    BOOST_CHECK_EQUAL(test_siggen->get_amplitude(port), 0.5);
+    BOOST_CHECK_EQUAL(test_siggen->get_sine_phase_increment(port), 0.25);
+
+    // The phase increment write must have been queued at the commit time...
+    BOOST_REQUIRE(!reg_iface->phase_increment_history.at(port).empty());
+    BOOST_CHECK(
+        reg_iface->phase_increment_history.at(port).back().second == commit_time);
+    // ...and the command time must be back to its previous value
+    BOOST_CHECK(test_siggen->get_command_time(port) == uhd::time_spec_t(0.0));
+}
+
+/*
+ * This test case exercises the batched phase increment sweep, ensuring that
+ * one timed write is queued per step at the correct time and that the cached
+ * property ends up at the final value.
+ */
+BOOST_FIXTURE_TEST_CASE(siggen_test_phase_inc_sweep, siggen_block_fixture)
+{
+    const size_t port = 0;
+    test_siggen->set_waveform(siggen_waveform::SINE_WAVE, port);
+
+    const std::vector<double> steps{0.1, 0.2, 0.3, 0.4};
+    const uhd::time_spec_t start_time(10.0);
+    const double interval = 0.001;
+
+    reg_iface->phase_increment_history.at(port).clear();
+    test_siggen->sweep_sine_phase_increments(steps, start_time, interval, port);
+
+    const auto& history = reg_iface->phase_increment_history.at(port);
+    BOOST_REQUIRE(history.size() >= steps.size());
+    for (size_t i = 0; i < steps.size(); i++) {
+        BOOST_CHECK_EQUAL(history[i].first,
+            siggen_mock_reg_iface_t::phase_increment_to_register(steps[i]));
+        BOOST_CHECK(
+            history[i].second == start_time + uhd::time_spec_t(i * interval));
+    }
+    BOOST_CHECK_EQUAL(test_siggen->get_sine_phase_increment(port), steps.back());
+    BOOST_CHECK(test_siggen->get_command_time(port) == uhd::time_spec_t(0.0));
+
+    // The whole table is validated before anything is queued
+    BOOST_CHECK_THROW(test_siggen->sweep_sine_phase_increments(
+                          {0.1, 5 * uhd::math::PI}, start_time, interval, port),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        test_siggen->sweep_sine_phase_increments(steps, start_time, 0.0, port),
+        uhd::value_error);
+}
+
 /*
  * This test case exercises the coercion of the SPP parameter to ensure that
  * it does not surpass the MTU.
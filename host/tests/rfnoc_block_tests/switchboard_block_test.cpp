@@ -131,6 +131,23 @@ BOOST_FIXTURE_TEST_CASE(swboard_test_exceptions, switchboard_block_fixture)
     BOOST_CHECK_EQUAL(reg_iface->input_select.at(0), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE(swboard_test_switch_path, switchboard_block_fixture)
+{
+    // Check that switch_path() pokes the select registers and keeps the
+    // select properties coherent
+    test_switchboard->switch_path(2, 3);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(2), 3);
+    BOOST_CHECK_EQUAL(reg_iface->input_select.at(3), 2);
+    BOOST_CHECK_EQUAL(test_switchboard->get_property<int>("input_select", 3), 2);
+    BOOST_CHECK_EQUAL(test_switchboard->get_property<int>("output_select", 2), 3);
+
+    // Check that out of bounds value is not written and exception thrown
+    BOOST_CHECK_THROW(test_switchboard->switch_path(0, NUM_OUTPUTS), uhd::value_error);
+    BOOST_CHECK_THROW(test_switchboard->switch_path(NUM_INPUTS, 0), uhd::value_error);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(0), 0);
+    BOOST_CHECK_EQUAL(reg_iface->input_select.at(0), 0);
+}
+
 BOOST_FIXTURE_TEST_CASE(swboard_test_graph, switchboard_block_fixture)
 {
     detail::graph_t graph{};
@@ -144,6 +144,31 @@ BOOST_AUTO_TEST_CASE(test_node_prop_access)
     BOOST_CHECK_EQUAL(TN1.get_property<double>("double_prop"), 4.2);
 }
 
+BOOST_AUTO_TEST_CASE(test_node_prop_snapshot)
+{
+    test_node_t TN1(2, 3);
+
+    TN1.set_property<double>("double_prop", 4.2);
+    TN1.set_property<double>("multi_instance_prop", 1.234, 0);
+
+    // The snapshot captures all user properties
+    auto snapshot = TN1.snapshot_props();
+    BOOST_REQUIRE_EQUAL(snapshot.size(), 3);
+
+    // Restoring onto the same node brings back the snapshotted values
+    TN1.set_property<double>("double_prop", -1.0);
+    TN1.set_property<double>("multi_instance_prop", -1.0, 0);
+    TN1.restore_props(snapshot);
+    BOOST_CHECK_EQUAL(TN1.get_property<double>("double_prop"), 4.2);
+    BOOST_CHECK_EQUAL(TN1.get_property<double>("multi_instance_prop", 0), 1.234);
+
+    // Restoring onto another node of the same type works, too
+    test_node_t TN2(2, 3);
+    TN2.restore_props(snapshot);
+    BOOST_CHECK_EQUAL(TN2.get_property<double>("double_prop"), 4.2);
+    BOOST_CHECK_EQUAL(TN2.get_property<double>("multi_instance_prop", 0), 1.234);
+}
+
 BOOST_AUTO_TEST_CASE(test_node_accessor)
 {
     test_node_t TN1(2, 3);
@@ -172,3 +197,60 @@ BOOST_AUTO_TEST_CASE(test_node_accessor)
     node_accessor.init_props(&TN1);
     BOOST_CHECK(TN1.user_prop_cb_called);
 }
+
+class fast_prop_node_t : public node_t
+{
+public:
+    fast_prop_node_t()
+    {
+        register_property(&_gain, [this](const double gain) {
+            last_applied_gain = gain;
+            apply_count++;
+        });
+        register_property(&_gain_mirror);
+        add_property_resolver(
+            {&_gain}, {&_gain_mirror}, [this]() { _gain_mirror.set(_gain.get()); });
+    }
+
+    size_t get_num_input_ports() const override
+    {
+        return 1;
+    }
+    size_t get_num_output_ports() const override
+    {
+        return 1;
+    }
+
+    double last_applied_gain = 0.0;
+    size_t apply_count       = 0;
+
+private:
+    property_t<double> _gain{"gain", 1.0, {res_source_info::USER}};
+    property_t<double> _gain_mirror{"gain_mirror", 1.0, {res_source_info::USER}};
+};
+
+BOOST_AUTO_TEST_CASE(test_fast_props)
+{
+    fast_prop_node_t TN{};
+
+    // Only properties registered through the fast-property overload are
+    // reachable through the fast path
+    BOOST_REQUIRE_THROW(TN.set_fast_property("gain_mirror", 1.0), uhd::lookup_error);
+    BOOST_REQUIRE_THROW(TN.get_fast_property("nonexistant_prop"), uhd::lookup_error);
+
+    // The fast path applies immediately, without triggering a resolution
+    TN.set_fast_property("gain", 7.0);
+    BOOST_CHECK_EQUAL(TN.last_applied_gain, 7.0);
+    BOOST_CHECK_EQUAL(TN.apply_count, 1);
+    BOOST_CHECK_EQUAL(TN.get_fast_property("gain"), 7.0);
+
+    // The next resolution picks up the fast value and runs its resolvers
+    BOOST_CHECK_EQUAL(TN.get_property<double>("gain"), 7.0);
+    BOOST_CHECK_EQUAL(TN.get_property<double>("gain_mirror"), 7.0);
+
+    // Slow-path updates become visible on the fast path, but do not invoke
+    // the apply callback
+    TN.set_property<double>("gain", 3.0);
+    BOOST_CHECK_EQUAL(TN.get_fast_property("gain"), 3.0);
+    BOOST_CHECK_EQUAL(TN.apply_count, 1);
+}
@@ -901,3 +901,27 @@ BOOST_AUTO_TEST_CASE(test_recv_zero_samples)
     // timeout period of 10 seconds.
     BOOST_CHECK_LE(elapsed_time.count(), 0.5);
 }
+
+// release_xports() exists so that teardown of the transports can be
+// decoupled from the destruction of the streamer (fast teardown). It must
+// hand back every connected transport and leave the streamer with its
+// channel count intact.
+BOOST_AUTO_TEST_CASE(test_release_xports)
+{
+    const std::string format("fc64");
+
+    auto recv_links = make_links(2);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    auto xports = streamer->release_xports();
+
+    BOOST_REQUIRE_EQUAL(xports.size(), 2);
+    for (auto& xport : xports) {
+        BOOST_CHECK(xport != nullptr);
+    }
+    BOOST_CHECK_EQUAL(streamer->get_num_channels(), 2);
+
+    // Destroying the streamer before the transports must be safe now
+    streamer.reset();
+    xports.clear();
+}
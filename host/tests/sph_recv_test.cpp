@@ -794,3 +794,118 @@ BOOST_AUTO_TEST_CASE(test_sph_recv_multi_channel_fragment)
     BOOST_REQUIRE_THROW(
         handler.recv(buffs, NUM_SAMPS_PER_BUFF, metadata, 1.0, true), uhd::io_error);
 }
+
+////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_sph_recv_one_channel_tags)
+{
+    ////////////////////////////////////////////////////////////////////////
+    uhd::convert::id_type id;
+    id.input_format  = "sc16_item32_be";
+    id.num_inputs    = 1;
+    id.output_format = "fc32";
+    id.num_outputs   = 1;
+
+    mock_zero_copy xport(vrt::if_packet_info_t::LINK_TYPE_VRLP);
+
+    vrt::if_packet_info_t ifpi;
+    ifpi.packet_type         = vrt::if_packet_info_t::PACKET_TYPE_DATA;
+    ifpi.num_payload_words32 = 0;
+    ifpi.packet_count        = 0;
+    ifpi.sob                 = true;
+    ifpi.eob                 = false;
+    ifpi.has_sid             = false;
+    ifpi.has_cid             = false;
+    ifpi.has_tsi             = true;
+    ifpi.has_tsf             = true;
+    ifpi.tsi                 = 0;
+    ifpi.tsf                 = 0;
+    ifpi.has_tlr             = false;
+
+    static const double TICK_RATE         = 100e6;
+    static const double SAMP_RATE         = 10e6;
+    static const size_t NUM_PKTS_TO_TEST  = 12;
+    static const size_t SAMPS_PER_PKT     = 10;
+    static const size_t TICKS_PER_SAMP    = size_t(TICK_RATE / SAMP_RATE);
+    static const size_t TIME_JUMP_SAMPS   = 1000;
+
+    // generate a bunch of packets with boundary events sprinkled in:
+    // - packet 3 ends a burst
+    // - packet 6 is lost (sequence gap)
+    // - packet 9 jumps ahead in time (discontinuity)
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        ifpi.num_payload_words32 = SAMPS_PER_PKT;
+        ifpi.sob                 = (i == 0 or i == 4);
+        ifpi.eob                 = (i == 3);
+        if (i == 9) {
+            ifpi.tsf += TIME_JUMP_SAMPS * TICKS_PER_SAMP;
+        }
+        if (i != 6) { // simulate a lost packet
+            std::vector<uint32_t> data(ifpi.num_payload_words32, 0);
+            xport.push_back_recv_packet(ifpi, data);
+        }
+        ifpi.packet_count++;
+        ifpi.tsf += ifpi.num_payload_words32 * TICKS_PER_SAMP;
+    }
+
+    // create the super receive packet handler
+    sph::recv_packet_handler handler(1);
+    handler.set_vrt_unpacker(&vrt::if_hdr_unpack_be);
+    handler.set_tick_rate(TICK_RATE);
+    handler.set_samp_rate(SAMP_RATE);
+    handler.set_xport_chan_get_buff(
+        0, [&xport](double timeout) { return xport.get_recv_buff(timeout); });
+    handler.set_converter(id);
+    handler.enable_tags(true);
+
+    std::vector<std::complex<float>> buff(200);
+    std::vector<uhd::rx_streamer::rx_tag_t> tags;
+    uhd::rx_metadata_t metadata;
+
+    // first call stops at the end of burst after packets 0-3
+    std::cout << "eob tag check" << std::endl;
+    size_t num_samps_ret =
+        handler.recv(&buff.front(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK(metadata.end_of_burst);
+    BOOST_CHECK_EQUAL(num_samps_ret, 4 * SAMPS_PER_PKT);
+    BOOST_REQUIRE_EQUAL(handler.get_tags(tags), 1UL);
+    BOOST_CHECK_EQUAL(tags[0].event, uhd::rx_streamer::rx_tag_t::EVENT_END_OF_BURST);
+    BOOST_CHECK_EQUAL(tags[0].offset, 4 * SAMPS_PER_PKT - 1);
+    BOOST_CHECK_TS_CLOSE(tags[0].time_spec,
+        uhd::time_spec_t::from_ticks(4 * SAMPS_PER_PKT - 1, SAMP_RATE));
+
+    // second call delivers packets 4-5, then hits the gap where 6 was lost
+    std::cout << "sequence gap tag check" << std::endl;
+    num_samps_ret = handler.recv(&buff.front(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(num_samps_ret, 2 * SAMPS_PER_PKT);
+    BOOST_REQUIRE_EQUAL(handler.get_tags(tags), 1UL);
+    BOOST_CHECK_EQUAL(tags[0].event, uhd::rx_streamer::rx_tag_t::EVENT_SEQUENCE_GAP);
+    BOOST_CHECK_EQUAL(tags[0].offset, 2 * SAMPS_PER_PKT);
+    BOOST_CHECK_TS_CLOSE(
+        tags[0].time_spec, uhd::time_spec_t::from_ticks(6 * SAMPS_PER_PKT, SAMP_RATE));
+
+    // third call returns the queued sequence error and records no tags
+    handler.recv(&buff.front(), buff.size(), metadata, 1.0, false);
+    BOOST_REQUIRE(metadata.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+    BOOST_REQUIRE(metadata.out_of_sequence == true);
+    BOOST_CHECK_EQUAL(handler.get_tags(tags), 0UL);
+
+    // fourth call delivers packets 7-11; packet 9's forward time jump is
+    // tagged as a discontinuity at its offset
+    std::cout << "time discontinuity tag check" << std::endl;
+    num_samps_ret = handler.recv(&buff.front(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(num_samps_ret, 5 * SAMPS_PER_PKT);
+    BOOST_REQUIRE_EQUAL(handler.get_tags(tags), 1UL);
+    BOOST_CHECK_EQUAL(tags[0].event,
+        uhd::rx_streamer::rx_tag_t::EVENT_TIME_DISCONTINUITY);
+    BOOST_CHECK_EQUAL(tags[0].offset, 2 * SAMPS_PER_PKT);
+    BOOST_CHECK_TS_CLOSE(tags[0].time_spec,
+        uhd::time_spec_t::from_ticks(
+            9 * SAMPS_PER_PKT + TIME_JUMP_SAMPS, SAMP_RATE));
+
+    // disabling tags stops the recording
+    handler.enable_tags(false);
+    BOOST_CHECK_EQUAL(handler.get_tags(tags), 0UL);
+}
@@ -0,0 +1,62 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/transport/stream_health_accumulator.hpp>
+#include <boost/test/unit_test.hpp>
+
+using uhd::transport::stream_health_accumulator;
+
+BOOST_AUTO_TEST_CASE(test_health_default_is_zero)
+{
+    stream_health_accumulator acc;
+    const auto health = acc.get_health();
+    BOOST_CHECK_EQUAL(health.overruns.count, 0);
+    BOOST_CHECK_EQUAL(health.underruns.count, 0);
+    BOOST_CHECK_EQUAL(health.seq_errors.count, 0);
+    BOOST_CHECK_EQUAL(health.lates.count, 0);
+    BOOST_CHECK_EQUAL(health.timeouts.count, 0);
+    BOOST_CHECK_EQUAL(health.overruns.last_time, 0.0);
+    BOOST_CHECK_EQUAL(health.overruns.rate, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_health_counts_events)
+{
+    stream_health_accumulator acc;
+    acc.record_overrun();
+    acc.record_overrun();
+    acc.record_underrun();
+    acc.record_seq_error();
+    acc.record_late();
+    acc.record_timeout();
+
+    const auto health = acc.get_health();
+    BOOST_CHECK_EQUAL(health.overruns.count, 2);
+    BOOST_CHECK_EQUAL(health.underruns.count, 1);
+    BOOST_CHECK_EQUAL(health.seq_errors.count, 1);
+    BOOST_CHECK_EQUAL(health.lates.count, 1);
+    BOOST_CHECK_EQUAL(health.timeouts.count, 1);
+
+    // An event must leave a timestamp and a positive rate behind
+    BOOST_CHECK_GT(health.overruns.last_time, 0.0);
+    BOOST_CHECK_GT(health.overruns.rate, 0.0);
+
+    // Counters without events remain untouched by the ones with events
+    BOOST_CHECK_GT(health.underruns.rate, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_health_rate_accumulates)
+{
+    stream_health_accumulator acc;
+    acc.record_overrun();
+    const double rate_one = acc.get_health().overruns.rate;
+
+    // Back-to-back events must drive the EWMA rate up
+    for (size_t i = 0; i < 10; i++) {
+        acc.record_overrun();
+    }
+    const double rate_many = acc.get_health().overruns.rate;
+    BOOST_CHECK_GT(rate_many, rate_one);
+}
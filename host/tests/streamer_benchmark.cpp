@@ -333,6 +333,7 @@ static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_mock_link(
         epids,
         send_link->get_num_send_frames(),
         fc_params,
+        false, // fc_poller
         [io_srv = io_srv, recv_link, send_link]() {
             io_srv->detach_recv_link(recv_link);
             io_srv->detach_send_link(send_link);
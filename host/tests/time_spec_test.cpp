@@ -11,6 +11,7 @@
 #include <boost/thread.hpp> //sleep
 #include <iomanip>
 #include <iostream>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(test_time_spec_compare)
 {
@@ -105,3 +106,32 @@ BOOST_AUTO_TEST_CASE(test_time_error_irrational_rate)
 
     BOOST_CHECK_EQUAL(err, (long long)(0));
 }
+
+BOOST_AUTO_TEST_CASE(test_time_spec_batch_conversion)
+{
+    std::cout << "Testing batch tick conversions..." << std::endl;
+
+    // Integer rate takes the fast path, fractional rate the fallback
+    for (const double rate : {200e6, 1625e3 / 6.0}) {
+        const std::vector<long long> ticks{
+            0ll, 1ll, 12345678ll, 23423436291667ll, -12345678ll};
+
+        std::vector<uhd::time_spec_t> times(ticks.size());
+        uhd::time_spec_t::from_ticks(ticks.data(), ticks.size(), rate, times.data());
+
+        std::vector<double> secs(ticks.size());
+        uhd::time_spec_t::ticks_to_secs(ticks.data(), ticks.size(), rate, secs.data());
+
+        std::vector<long long> ticks_out(ticks.size());
+        uhd::time_spec_t::to_ticks(times.data(), times.size(), rate, ticks_out.data());
+
+        for (size_t i = 0; i < ticks.size(); i++) {
+            const uhd::time_spec_t expected =
+                uhd::time_spec_t::from_ticks(ticks[i], rate);
+            BOOST_CHECK_EQUAL(times[i].get_full_secs(), expected.get_full_secs());
+            BOOST_CHECK_EQUAL(times[i].get_frac_secs(), expected.get_frac_secs());
+            BOOST_CHECK_EQUAL(secs[i], expected.get_real_secs());
+            BOOST_CHECK_EQUAL(ticks_out[i], expected.to_ticks(rate));
+        }
+    }
+}
@@ -0,0 +1,155 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/types/metadata.hpp>
+#include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using namespace uhd;
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr size_t QUEUE_CAPACITY = 32;
+
+async_metadata_t make_event(const async_metadata_t::event_code_t event_code,
+    const size_t channel,
+    const double time = 0.0)
+{
+    async_metadata_t md;
+    md.channel       = channel;
+    md.event_code    = event_code;
+    md.has_time_spec = (time != 0.0);
+    md.time_spec     = time_spec_t(time);
+    return md;
+}
+
+//! Pop everything currently available from the queue (zero timeout)
+std::vector<async_metadata_t> drain(tx_async_msg_queue& queue)
+{
+    std::vector<async_metadata_t> result;
+    async_metadata_t md;
+    while (queue.recv_async_msg(md, 0)) {
+        result.push_back(md);
+    }
+    return result;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_single_events_pass_through)
+{
+    tx_async_msg_queue queue(QUEUE_CAPACITY);
+
+    // A consumer that keeps up sees every event individually: each
+    // recv_async_msg() call drains the queue, which releases any pending
+    // run summary immediately.
+    for (size_t i = 0; i < 5; i++) {
+        queue.enqueue(make_event(async_metadata_t::EVENT_CODE_TIME_ERROR, 0));
+        const auto events = drain(queue);
+        BOOST_REQUIRE_EQUAL(events.size(), 1);
+        BOOST_CHECK_EQUAL(events[0].event_count, 1);
+        BOOST_CHECK(events[0].event_code == async_metadata_t::EVENT_CODE_TIME_ERROR);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_storm_is_coalesced)
+{
+    tx_async_msg_queue queue(QUEUE_CAPACITY);
+
+    // An undrained storm of homogeneous errors must not fill the queue:
+    // The first event is reported immediately and the rest fold into
+    // summary records released at most once per reporting interval.
+    constexpr size_t NUM_EVENTS = 1000;
+    for (size_t i = 0; i < NUM_EVENTS; i++) {
+        queue.enqueue(make_event(
+            async_metadata_t::EVENT_CODE_TIME_ERROR, 0, 1.0 + 0.001 * double(i)));
+    }
+
+    const auto events = drain(queue);
+    // Far fewer records than events (first event, plus one summary per
+    // elapsed reporting interval, plus the tail flushed by the drain)
+    BOOST_REQUIRE(!events.empty());
+    BOOST_CHECK_LT(events.size(), NUM_EVENTS / 10);
+
+    // The first event of the run is never delayed or folded
+    BOOST_CHECK_EQUAL(events[0].event_count, 1);
+    BOOST_CHECK(events[0].time_spec == time_spec_t(1.0));
+
+    // No event is lost: the counts add up to the number enqueued
+    size_t total = 0;
+    for (const auto& md : events) {
+        BOOST_CHECK(md.event_code == async_metadata_t::EVENT_CODE_TIME_ERROR);
+        total += md.event_count;
+    }
+    BOOST_CHECK_EQUAL(total, NUM_EVENTS);
+
+    // The last summary brackets the tail of the run
+    const auto& tail = events.back();
+    BOOST_REQUIRE_GT(tail.event_count, 1);
+    BOOST_CHECK(tail.last_time_spec == time_spec_t(1.0 + 0.001 * (NUM_EVENTS - 1)));
+}
+
+BOOST_AUTO_TEST_CASE(test_run_breaks_on_code_and_channel)
+{
+    tx_async_msg_queue queue(QUEUE_CAPACITY);
+
+    // Five late packets on channel 0, then an underflow on channel 0, then
+    // a late packet on channel 1. Every run break flushes the pending
+    // summary and reports the new event immediately, in order.
+    for (size_t i = 0; i < 5; i++) {
+        queue.enqueue(make_event(
+            async_metadata_t::EVENT_CODE_TIME_ERROR, 0, 1.0 + 0.001 * double(i)));
+    }
+    queue.enqueue(make_event(async_metadata_t::EVENT_CODE_UNDERFLOW, 0, 2.0));
+    queue.enqueue(make_event(async_metadata_t::EVENT_CODE_TIME_ERROR, 1, 3.0));
+
+    const auto events = drain(queue);
+    BOOST_REQUIRE_EQUAL(events.size(), 4);
+
+    BOOST_CHECK(events[0].event_code == async_metadata_t::EVENT_CODE_TIME_ERROR);
+    BOOST_CHECK_EQUAL(events[0].event_count, 1);
+    BOOST_CHECK(events[0].time_spec == time_spec_t(1.0));
+
+    // Summary of the four coalesced followers, bracketed by their times
+    BOOST_CHECK(events[1].event_code == async_metadata_t::EVENT_CODE_TIME_ERROR);
+    BOOST_CHECK_EQUAL(events[1].channel, 0);
+    BOOST_CHECK_EQUAL(events[1].event_count, 4);
+    BOOST_CHECK(events[1].time_spec == time_spec_t(1.001));
+    BOOST_CHECK(events[1].last_time_spec == time_spec_t(1.004));
+
+    BOOST_CHECK(events[2].event_code == async_metadata_t::EVENT_CODE_UNDERFLOW);
+    BOOST_CHECK_EQUAL(events[2].event_count, 1);
+
+    BOOST_CHECK(events[3].event_code == async_metadata_t::EVENT_CODE_TIME_ERROR);
+    BOOST_CHECK_EQUAL(events[3].channel, 1);
+    BOOST_CHECK_EQUAL(events[3].event_count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_burst_acks_never_coalesce)
+{
+    tx_async_msg_queue queue(QUEUE_CAPACITY);
+
+    // ACKs must be delivered one record per event, and an ACK arriving
+    // mid-storm flushes the pending error summary ahead of itself
+    for (size_t i = 0; i < 3; i++) {
+        queue.enqueue(make_event(async_metadata_t::EVENT_CODE_SEQ_ERROR, 0));
+    }
+    queue.enqueue(make_event(async_metadata_t::EVENT_CODE_BURST_ACK, 0));
+    queue.enqueue(make_event(async_metadata_t::EVENT_CODE_BURST_ACK, 0));
+
+    const auto events = drain(queue);
+    BOOST_REQUIRE_EQUAL(events.size(), 4);
+    BOOST_CHECK(events[0].event_code == async_metadata_t::EVENT_CODE_SEQ_ERROR);
+    BOOST_CHECK_EQUAL(events[0].event_count, 1);
+    BOOST_CHECK(events[1].event_code == async_metadata_t::EVENT_CODE_SEQ_ERROR);
+    BOOST_CHECK_EQUAL(events[1].event_count, 2);
+    BOOST_CHECK(events[2].event_code == async_metadata_t::EVENT_CODE_BURST_ACK);
+    BOOST_CHECK_EQUAL(events[2].event_count, 1);
+    BOOST_CHECK(events[3].event_code == async_metadata_t::EVENT_CODE_BURST_ACK);
+    BOOST_CHECK_EQUAL(events[3].event_count, 1);
+}
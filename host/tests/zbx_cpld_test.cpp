@@ -8,6 +8,8 @@
 #include <uhdlib/usrp/dboard/zbx/zbx_cpld_ctrl.hpp>
 #include <boost/test/unit_test.hpp>
 #include <iostream>
+#include <map>
+#include <vector>
 
 using namespace uhd::usrp::zbx;
 
@@ -153,3 +155,36 @@ BOOST_FIXTURE_TEST_CASE(zbx_set_from_table_test, zbx_cpld_fixture)
     cpld.set_tx_gain_switches(chan, idx, 23);
     BOOST_REQUIRE_EQUAL(tx_table_select, 23);
 }
+
+BOOST_AUTO_TEST_CASE(zbx_cpld_block_poke_test)
+{
+    std::map<uint32_t, uint32_t> memory;
+    size_t num_block_pokes  = 0;
+    size_t num_single_pokes = 0;
+    zbx_cpld_ctrl cpld(
+        [&](const uint32_t addr, const uint32_t data, const zbx_cpld_ctrl::chan_t) {
+            num_single_pokes++;
+            memory[addr] = data;
+        },
+        [&](const uint32_t first_addr,
+            const std::vector<uint32_t>& data,
+            const zbx_cpld_ctrl::chan_t) {
+            num_block_pokes++;
+            for (size_t i = 0; i < data.size(); i++) {
+                memory[first_addr + i * 4] = data[i];
+            }
+        },
+        [&](const uint32_t addr) -> uint32_t { return memory.at(addr); },
+        [&](const uhd::time_spec_t&) {},
+        "TEST::CPLD");
+    // The initial save-all commit writes the entire register map, and the
+    // contiguous runs must have been merged into far fewer transactions than
+    // there are registers
+    BOOST_CHECK(num_block_pokes > 0);
+    BOOST_CHECK(num_block_pokes + num_single_pokes < memory.size());
+    // A single-register update must not turn into a block write
+    num_block_pokes = 0;
+    cpld.set_scratch(23);
+    BOOST_CHECK_EQUAL(cpld.get_scratch(), 23);
+    BOOST_CHECK_EQUAL(num_block_pokes, 0);
+}
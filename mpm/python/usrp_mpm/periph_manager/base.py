@@ -1050,6 +1050,20 @@ class PeriphManagerBase:
             self, self.mboard_sensor_callback_map.get(sensor_name)
         )()
 
+    def get_mb_sensors_bulk(self):
+        """
+        Return a dictionary that maps every sensor name to its current value
+        dictionary (see get_mb_sensor() for the value format).
+
+        This reads all sensors in a single RPC round trip, which is much
+        cheaper for telemetry pollers than one get_mb_sensor() call per
+        sensor.
+        """
+        return {
+            sensor_name: self.get_mb_sensor(sensor_name)
+            for sensor_name in self.get_mb_sensors()
+        }
+
     ##########################################################################
     # EEPROMS
     ##########################################################################
@@ -0,0 +1,731 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+// chdr_pcap_analyzer: Offline analyzer for packet captures of CHDR traffic.
+//
+// Reads a classic pcap file (as written by tcpdump/wireshark), finds CHDR
+// packets inside UDP datagrams, and reconstructs per-EPID timelines:
+// sequence number gaps and reorderings, stream status (strs) errors, and
+// flow-control credit starvation intervals (periods where the downstream
+// buffer was nearly full and the sender was blocked waiting for credits).
+//
+// The input file is mmap'd and scanned in one sequential pass, so multi-GB
+// captures are processed at close to memory/disk bandwidth. The CHDR field
+// definitions are the ones UHD itself uses (uhd/rfnoc/chdr_types.hpp); the
+// Makefile compiles chdr_types.cpp straight out of the source tree, so this
+// tool does not require an installed libuhd.
+//
+// pcapng captures are not supported; convert them first, e.g.:
+//   tshark -r capture.pcapng -w capture.pcap -F pcap
+
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace uhd::rfnoc::chdr;
+
+namespace {
+
+/******************************************************************************
+ * Configuration
+ *****************************************************************************/
+struct config_t
+{
+    std::string filename;
+    std::set<uint16_t> ports; // empty: auto-detect CHDR on any UDP port
+    int endianness  = -1; // 0: little, 1: big, -1: auto-detect
+    size_t chdr_w   = 64; // CHDR width in bits
+    double fc_thresh = 0.9; // buffer fullness that counts as starvation
+    size_t max_detail = 20; // per-flow cap on detailed event records
+};
+
+void print_usage()
+{
+    std::printf(
+        "Usage: chdr_pcap_analyzer [options] <capture.pcap>\n"
+        "\n"
+        "Options:\n"
+        "  --port <n>          Only treat UDP packets on this port as CHDR\n"
+        "                      (may be given multiple times; default is to\n"
+        "                      auto-detect CHDR on any UDP port)\n"
+        "  --endian <e>        CHDR link byte order: little, big, or auto\n"
+        "                      (default: auto)\n"
+        "  --chdr-width <w>    CHDR width in bits (default: 64)\n"
+        "  --fc-threshold <f>  Downstream buffer fullness ratio above which\n"
+        "                      the flow counts as credit-starved\n"
+        "                      (default: 0.9)\n"
+        "  --max-detail <n>    Per-flow cap on detailed event lines\n"
+        "                      (default: 20)\n"
+        "  --help              Print this message\n");
+}
+
+/******************************************************************************
+ * pcap file structures (classic pcap only)
+ *****************************************************************************/
+struct pcap_file_header_t
+{
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct pcap_rec_header_t
+{
+    uint32_t ts_sec;
+    uint32_t ts_frac; // microseconds or nanoseconds, depending on magic
+    uint32_t incl_len;
+    uint32_t orig_len;
+};
+
+constexpr uint32_t PCAP_MAGIC_US      = 0xa1b2c3d4;
+constexpr uint32_t PCAP_MAGIC_US_SWAP = 0xd4c3b2a1;
+constexpr uint32_t PCAP_MAGIC_NS      = 0xa1b23c4d;
+constexpr uint32_t PCAP_MAGIC_NS_SWAP = 0x4d3cb2a1;
+constexpr uint32_t PCAPNG_MAGIC       = 0x0a0d0d0a;
+
+constexpr uint32_t LINKTYPE_ETHERNET = 1;
+constexpr uint32_t LINKTYPE_RAW      = 101;
+
+/******************************************************************************
+ * Per-flow state
+ *****************************************************************************/
+struct gap_record_t
+{
+    double time;
+    uint16_t expected;
+    uint16_t got;
+    uint16_t missing;
+};
+
+struct starve_record_t
+{
+    double start;
+    double duration;
+    uint64_t outstanding;
+    uint64_t capacity;
+};
+
+//! Statistics for all traffic addressed to one EPID
+struct flow_t
+{
+    // Packet type counters
+    uint64_t data_pkts  = 0;
+    uint64_t data_bytes = 0;
+    uint64_t strs_pkts  = 0;
+    uint64_t strc_pkts  = 0;
+    uint64_t ctrl_pkts  = 0;
+    uint64_t mgmt_pkts  = 0;
+
+    // Data sequence tracking
+    bool have_seq         = false;
+    uint16_t expected_seq = 0;
+    uint64_t gap_events   = 0;
+    uint64_t gap_pkts     = 0;
+    uint64_t reorders     = 0;
+    std::vector<gap_record_t> gaps;
+
+    // Device timestamps seen on data packets (ticks)
+    bool have_dev_ts     = false;
+    uint64_t first_dev_ts = 0;
+    uint64_t last_dev_ts  = 0;
+
+    // Stream status / flow control. strs packets whose payload src_epid
+    // matches this flow's EPID ack the data bytes this EPID has received.
+    uint64_t strs_errors    = 0;
+    uint64_t capacity_bytes = 0;
+    bool have_fc_baseline   = false;
+    uint64_t sent_baseline  = 0; // data_bytes at the first strs
+    uint64_t acked_baseline = 0; // xfer_count_bytes of the first strs
+    uint64_t acked_bytes    = 0; // xfer_count_bytes of the latest strs
+    bool starved            = false;
+    double starve_start     = 0.0;
+    uint64_t starve_peak    = 0;
+    uint64_t starve_events  = 0;
+    double starve_total     = 0.0;
+    std::vector<starve_record_t> starvations;
+
+    // strc op counters (INIT, PING, RESYNC)
+    uint64_t strc_ops[3] = {0, 0, 0};
+
+    // Wallclock window of this flow (pcap timestamps)
+    bool have_wall   = false;
+    double first_wall = 0.0;
+    double last_wall  = 0.0;
+};
+
+/******************************************************************************
+ * Analyzer
+ *****************************************************************************/
+class analyzer
+{
+public:
+    analyzer(const config_t& cfg) : _cfg(cfg), _endianness(cfg.endianness) {}
+
+    //! Process one UDP payload with the pcap timestamp of its frame
+    void process_udp(const uint8_t* buff,
+        const size_t len,
+        const uint16_t src_port,
+        const uint16_t dst_port,
+        const double time)
+    {
+        _udp_pkts++;
+        if (!_cfg.ports.empty() && !_cfg.ports.count(src_port)
+            && !_cfg.ports.count(dst_port)) {
+            return;
+        }
+        if (len < sizeof(uint64_t)) {
+            return;
+        }
+        // The payload sits at an arbitrary offset in the mmap'd file, so
+        // all word accesses go through read_word() (memcpy compiles down to
+        // a plain unaligned load here)
+        const uint64_t word0 = read_word(buff, 0);
+
+        // Resolve the link byte order on the first packet that parses as
+        // CHDR, then stick with it
+        if (_endianness < 0) {
+            if (_plausible(word0, len, 0)) {
+                _endianness = 0;
+            } else if (_plausible(word0, len, 1)) {
+                _endianness = 1;
+            } else {
+                return;
+            }
+        }
+        if (!_plausible(word0, len, _endianness)) {
+            return;
+        }
+        const chdr_header header(_to_host(word0));
+        _chdr_pkts++;
+        _chdr_bytes += header.get_length();
+
+        switch (header.get_pkt_type()) {
+            case PKT_TYPE_DATA_NO_TS:
+            case PKT_TYPE_DATA_WITH_TS:
+                _process_data(
+                    _touch_flow(header.get_dst_epid(), time), header, buff, time);
+                break;
+            case PKT_TYPE_STRS:
+                _process_strs(header, buff, len, time);
+                break;
+            case PKT_TYPE_STRC:
+                _process_strc(
+                    _touch_flow(header.get_dst_epid(), time), header, buff, len);
+                break;
+            case PKT_TYPE_CTRL:
+                _touch_flow(header.get_dst_epid(), time).ctrl_pkts++;
+                break;
+            case PKT_TYPE_MGMT:
+                _touch_flow(header.get_dst_epid(), time).mgmt_pkts++;
+                break;
+            default:
+                break;
+        }
+    }
+
+    void print_report() const
+    {
+        std::printf("Parsed %llu UDP packets, %llu CHDR packets (%.1f MB of CHDR)\n",
+            (unsigned long long)_udp_pkts,
+            (unsigned long long)_chdr_pkts,
+            _chdr_bytes / 1e6);
+        if (_chdr_pkts && _endianness >= 0) {
+            std::printf("CHDR link byte order: %s-endian\n",
+                _endianness ? "big" : "little");
+        }
+        for (const auto& it : _flows) {
+            const flow_t& flow = it.second;
+            const double span  = flow.last_wall - flow.first_wall;
+            std::printf("\n==== EPID %u (%.6f s to %.6f s) ====\n",
+                it.first,
+                flow.first_wall,
+                flow.last_wall);
+            if (flow.data_pkts) {
+                std::printf("  data: %llu pkts, %.1f MB",
+                    (unsigned long long)flow.data_pkts,
+                    flow.data_bytes / 1e6);
+                if (span > 0.0) {
+                    std::printf(" (%.1f MB/s)", flow.data_bytes / span / 1e6);
+                }
+                std::printf("\n");
+                std::printf("        %llu gap events (%llu pkts missing), "
+                            "%llu reordered\n",
+                    (unsigned long long)flow.gap_events,
+                    (unsigned long long)flow.gap_pkts,
+                    (unsigned long long)flow.reorders);
+                for (const auto& gap : flow.gaps) {
+                    std::printf("        gap at %.6f s: expected seq %u, got %u "
+                                "(%u missing)\n",
+                        gap.time,
+                        gap.expected,
+                        gap.got,
+                        gap.missing);
+                }
+                if (flow.gaps.size() < flow.gap_events) {
+                    std::printf("        ... %llu more gap events not shown\n",
+                        (unsigned long long)(flow.gap_events - flow.gaps.size()));
+                }
+            }
+            if (flow.strs_pkts) {
+                std::printf("  strs: %llu pkts, %llu with error status",
+                    (unsigned long long)flow.strs_pkts,
+                    (unsigned long long)flow.strs_errors);
+                if (flow.capacity_bytes) {
+                    std::printf(", buffer capacity %llu B",
+                        (unsigned long long)flow.capacity_bytes);
+                }
+                std::printf("\n");
+            }
+            if (flow.strc_pkts) {
+                std::printf("  strc: %llu pkts (INIT: %llu, PING: %llu, "
+                            "RESYNC: %llu)\n",
+                    (unsigned long long)flow.strc_pkts,
+                    (unsigned long long)flow.strc_ops[STRC_INIT],
+                    (unsigned long long)flow.strc_ops[STRC_PING],
+                    (unsigned long long)flow.strc_ops[STRC_RESYNC]);
+            }
+            if (flow.ctrl_pkts || flow.mgmt_pkts) {
+                std::printf("  ctrl: %llu pkts, mgmt: %llu pkts\n",
+                    (unsigned long long)flow.ctrl_pkts,
+                    (unsigned long long)flow.mgmt_pkts);
+            }
+            if (flow.starve_events) {
+                std::printf("  flow control: buffer above %.0f%% full for "
+                            "%.6f s total in %llu intervals\n",
+                    _cfg.fc_thresh * 100,
+                    flow.starve_total,
+                    (unsigned long long)flow.starve_events);
+                for (const auto& s : flow.starvations) {
+                    std::printf("        starved at %.6f s for %.6f s "
+                                "(outstanding %llu/%llu B)\n",
+                        s.start,
+                        s.duration,
+                        (unsigned long long)s.outstanding,
+                        (unsigned long long)s.capacity);
+                }
+                if (flow.starvations.size() < flow.starve_events) {
+                    std::printf("        ... %llu more intervals not shown\n",
+                        (unsigned long long)(
+                            flow.starve_events - flow.starvations.size()));
+                }
+            } else if (flow.capacity_bytes) {
+                std::printf("  flow control: no credit starvation detected\n");
+            }
+        }
+        if (_flows.empty()) {
+            std::printf("No CHDR traffic found. If this capture uses a "
+                        "non-standard port, pass it with --port; pcapng files "
+                        "must be converted to classic pcap first.\n");
+        }
+    }
+
+private:
+    //! Unaligned 64-bit load from a byte buffer (in link byte order)
+    static uint64_t read_word(const uint8_t* buff, const size_t word_idx)
+    {
+        uint64_t word;
+        std::memcpy(&word, buff + word_idx * sizeof(uint64_t), sizeof(uint64_t));
+        return word;
+    }
+
+    uint64_t _to_host(const uint64_t word) const
+    {
+        return _endianness ? uhd::ntohx<uint64_t>(word) : uhd::wtohx<uint64_t>(word);
+    }
+
+    //! Look up a flow and update its wallclock window
+    flow_t& _touch_flow(const uint16_t epid, const double time)
+    {
+        flow_t& flow = _flows[epid];
+        if (!flow.have_wall) {
+            flow.have_wall  = true;
+            flow.first_wall = time;
+        }
+        flow.last_wall = time;
+        return flow;
+    }
+
+    //! Heuristic check whether a UDP payload starts with a CHDR header
+    static bool _plausible(const uint64_t word, const size_t udp_len, const int big)
+    {
+        const chdr_header header(
+            big ? uhd::ntohx<uint64_t>(word) : uhd::wtohx<uint64_t>(word));
+        const size_t chdr_len = header.get_length();
+        const auto pkt_type   = header.get_pkt_type();
+        if (pkt_type != PKT_TYPE_MGMT && pkt_type != PKT_TYPE_STRS
+            && pkt_type != PKT_TYPE_STRC && pkt_type != PKT_TYPE_CTRL
+            && pkt_type != PKT_TYPE_DATA_NO_TS && pkt_type != PKT_TYPE_DATA_WITH_TS) {
+            return false;
+        }
+        // The CHDR length must fit in the datagram; short datagrams may be
+        // padded up to the minimum Ethernet frame size
+        return chdr_len >= sizeof(uint64_t) && chdr_len <= udp_len
+               && (udp_len - chdr_len) <= 40;
+    }
+
+    size_t _payload_offset_words(const chdr_header& header) const
+    {
+        // Mirrors chdr_packet_writer: for 64-bit CHDR the timestamp occupies
+        // its own word, for wider CHDR it shares the first CHDR word
+        const size_t stride = _cfg.chdr_w / 64;
+        if (_cfg.chdr_w == 64) {
+            const size_t mdata_off =
+                (header.get_pkt_type() == PKT_TYPE_DATA_WITH_TS) ? 2 : 1;
+            return mdata_off + header.get_num_mdata();
+        }
+        return (1 + header.get_num_mdata()) * stride;
+    }
+
+    void _process_data(flow_t& flow,
+        const chdr_header& header,
+        const uint8_t* buff,
+        const double time)
+    {
+        flow.data_pkts++;
+        flow.data_bytes += header.get_length();
+
+        if (header.get_pkt_type() == PKT_TYPE_DATA_WITH_TS) {
+            const uint64_t ts = _to_host(read_word(buff, 1));
+            if (!flow.have_dev_ts) {
+                flow.have_dev_ts  = true;
+                flow.first_dev_ts = ts;
+            }
+            flow.last_dev_ts = ts;
+        }
+
+        const uint16_t seq = header.get_seq_num();
+        if (!flow.have_seq) {
+            flow.have_seq     = true;
+            flow.expected_seq = uint16_t(seq + 1);
+        } else if (seq == flow.expected_seq) {
+            flow.expected_seq = uint16_t(seq + 1);
+        } else {
+            const uint16_t diff = uint16_t(seq - flow.expected_seq);
+            if (diff < 0x8000) {
+                // Packets went missing (or arrive later, which a matching
+                // reorder event will then flag)
+                flow.gap_events++;
+                flow.gap_pkts += diff;
+                if (flow.gaps.size() < _cfg.max_detail) {
+                    flow.gaps.push_back({time, flow.expected_seq, seq, diff});
+                }
+                flow.expected_seq = uint16_t(seq + 1);
+            } else {
+                // A packet from the past: late delivery / reordering
+                flow.reorders++;
+            }
+        }
+        _update_starvation(flow, time);
+    }
+
+    void _process_strs(const chdr_header& header,
+        const uint8_t* buff,
+        const size_t len,
+        const double time)
+    {
+        strs_payload payload;
+        const size_t offset = _payload_offset_words(header);
+        const size_t avail  = len / sizeof(uint64_t);
+        if (offset + payload.get_length() > avail) {
+            return;
+        }
+        std::vector<uint64_t> payload_buff(payload.get_length());
+        for (size_t i = 0; i < payload_buff.size(); i++) {
+            payload_buff[i] = read_word(buff, offset + i);
+        }
+        if (_endianness) {
+            payload.deserialize<uhd::ENDIANNESS_BIG>(
+                payload_buff.data(), payload_buff.size());
+        } else {
+            payload.deserialize<uhd::ENDIANNESS_LITTLE>(
+                payload_buff.data(), payload_buff.size());
+        }
+
+        // The strs source EPID is the endpoint that received the data, so
+        // the credit accounting belongs to that flow, not to the flow of the
+        // strs packet's own destination
+        flow_t& flow = _touch_flow(payload.src_epid, time);
+        flow.strs_pkts++;
+        if (payload.status != STRS_OKAY) {
+            flow.strs_errors++;
+        }
+        flow.capacity_bytes = payload.capacity_bytes;
+        if (!flow.have_fc_baseline) {
+            flow.have_fc_baseline = true;
+            if (payload.xfer_count_bytes <= flow.data_bytes) {
+                // The capture contains the start of the stream (the acked
+                // byte count is covered by the data we saw), so the absolute
+                // counters can be compared directly
+                flow.sent_baseline  = 0;
+                flow.acked_baseline = 0;
+            } else {
+                // Mid-stream capture; track from here on and assume the
+                // buffer was empty at this point
+                flow.sent_baseline  = flow.data_bytes;
+                flow.acked_baseline = payload.xfer_count_bytes;
+            }
+        }
+        flow.acked_bytes = payload.xfer_count_bytes;
+        _update_starvation(flow, time);
+    }
+
+    void _process_strc(flow_t& flow,
+        const chdr_header& header,
+        const uint8_t* buff,
+        const size_t len)
+    {
+        strc_payload payload;
+        const size_t offset = _payload_offset_words(header);
+        const size_t avail  = len / sizeof(uint64_t);
+        if (offset + payload.get_length() > avail) {
+            return;
+        }
+        std::vector<uint64_t> payload_buff(payload.get_length());
+        for (size_t i = 0; i < payload_buff.size(); i++) {
+            payload_buff[i] = read_word(buff, offset + i);
+        }
+        if (_endianness) {
+            payload.deserialize<uhd::ENDIANNESS_BIG>(
+                payload_buff.data(), payload_buff.size());
+        } else {
+            payload.deserialize<uhd::ENDIANNESS_LITTLE>(
+                payload_buff.data(), payload_buff.size());
+        }
+        flow.strc_pkts++;
+        if (payload.op_code <= STRC_RESYNC) {
+            flow.strc_ops[payload.op_code]++;
+        }
+    }
+
+    //! Re-evaluate the credit state of a flow after an ack or data packet
+    void _update_starvation(flow_t& flow, const double time)
+    {
+        if (!flow.have_fc_baseline || !flow.capacity_bytes) {
+            return;
+        }
+        const uint64_t sent  = flow.data_bytes - flow.sent_baseline;
+        const uint64_t acked = flow.acked_bytes - flow.acked_baseline;
+        const uint64_t outstanding = (sent > acked) ? (sent - acked) : 0;
+        const bool starved =
+            outstanding >= uint64_t(_cfg.fc_thresh * flow.capacity_bytes);
+        if (starved && !flow.starved) {
+            flow.starved      = true;
+            flow.starve_start = time;
+            flow.starve_peak  = outstanding;
+        } else if (starved) {
+            flow.starve_peak = std::max(flow.starve_peak, outstanding);
+        } else if (flow.starved) {
+            flow.starved = false;
+            flow.starve_events++;
+            flow.starve_total += time - flow.starve_start;
+            if (flow.starvations.size() < _cfg.max_detail) {
+                flow.starvations.push_back({flow.starve_start,
+                    time - flow.starve_start,
+                    flow.starve_peak,
+                    flow.capacity_bytes});
+            }
+        }
+    }
+
+    const config_t& _cfg;
+    int _endianness = -1;
+    uint64_t _udp_pkts   = 0;
+    uint64_t _chdr_pkts  = 0;
+    uint64_t _chdr_bytes = 0;
+    std::map<uint16_t, flow_t> _flows;
+};
+
+/******************************************************************************
+ * Frame decapsulation
+ *****************************************************************************/
+inline uint16_t read_be16(const uint8_t* p)
+{
+    return uint16_t((p[0] << 8) | p[1]);
+}
+
+//! Strip the link and IP layers, call the analyzer for every UDP payload
+void process_frame(analyzer& an,
+    const uint8_t* frame,
+    size_t len,
+    const uint32_t linktype,
+    const double time)
+{
+    const uint8_t* p = frame;
+    if (linktype == LINKTYPE_ETHERNET) {
+        if (len < 14) {
+            return;
+        }
+        uint16_t ethertype = read_be16(p + 12);
+        p += 14;
+        len -= 14;
+        // Skip VLAN tags
+        while (ethertype == 0x8100 || ethertype == 0x88a8) {
+            if (len < 4) {
+                return;
+            }
+            ethertype = read_be16(p + 2);
+            p += 4;
+            len -= 4;
+        }
+        if (ethertype != 0x0800) {
+            return;
+        }
+    } else if (linktype != LINKTYPE_RAW) {
+        return;
+    }
+
+    // IPv4
+    if (len < 20 || (p[0] >> 4) != 4) {
+        return;
+    }
+    const size_t ihl = size_t(p[0] & 0x0F) * 4;
+    if (len < ihl + 8 || p[9] != 17 /* UDP */) {
+        return;
+    }
+    // Ignore non-leading fragments
+    if (read_be16(p + 6) & 0x1FFF) {
+        return;
+    }
+    const uint8_t* udp      = p + ihl;
+    const uint16_t src_port = read_be16(udp);
+    const uint16_t dst_port = read_be16(udp + 2);
+    const size_t udp_len    = read_be16(udp + 4);
+    if (udp_len < 8 || udp_len > len - ihl) {
+        return;
+    }
+    an.process_udp(udp + 8, udp_len - 8, src_port, dst_port, time);
+}
+
+inline uint32_t maybe_swap32(const uint32_t val, const bool swap)
+{
+    return swap ? __builtin_bswap32(val) : val;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    config_t cfg;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg(argv[i]);
+        if (arg == "--help" || arg == "-h") {
+            print_usage();
+            return 0;
+        } else if (arg == "--port" && i + 1 < argc) {
+            cfg.ports.insert(uint16_t(std::stoul(argv[++i])));
+        } else if (arg == "--endian" && i + 1 < argc) {
+            const std::string e(argv[++i]);
+            cfg.endianness = (e == "big") ? 1 : (e == "little") ? 0 : -1;
+        } else if (arg == "--chdr-width" && i + 1 < argc) {
+            cfg.chdr_w = std::stoul(argv[++i]);
+            if (cfg.chdr_w < 64 || cfg.chdr_w % 64) {
+                std::fprintf(stderr, "Invalid CHDR width: %zu\n", cfg.chdr_w);
+                return 1;
+            }
+        } else if (arg == "--fc-threshold" && i + 1 < argc) {
+            cfg.fc_thresh = std::stod(argv[++i]);
+        } else if (arg == "--max-detail" && i + 1 < argc) {
+            cfg.max_detail = std::stoul(argv[++i]);
+        } else if (!arg.empty() && arg[0] != '-' && cfg.filename.empty()) {
+            cfg.filename = arg;
+        } else {
+            std::fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+            print_usage();
+            return 1;
+        }
+    }
+    if (cfg.filename.empty()) {
+        print_usage();
+        return 1;
+    }
+
+    const int fd = ::open(cfg.filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::perror("open");
+        return 1;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(pcap_file_header_t)) {
+        std::fprintf(stderr, "Not a pcap file: %s\n", cfg.filename.c_str());
+        ::close(fd);
+        return 1;
+    }
+    const size_t file_size = size_t(st.st_size);
+    void* map = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        std::perror("mmap");
+        return 1;
+    }
+    ::madvise(map, file_size, MADV_SEQUENTIAL);
+    const uint8_t* base = static_cast<const uint8_t*>(map);
+
+    pcap_file_header_t fh;
+    std::memcpy(&fh, base, sizeof(fh));
+    if (fh.magic == PCAPNG_MAGIC) {
+        std::fprintf(stderr,
+            "%s is a pcapng file; convert it first, e.g.:\n"
+            "  tshark -r %s -w out.pcap -F pcap\n",
+            cfg.filename.c_str(),
+            cfg.filename.c_str());
+        ::munmap(map, file_size);
+        return 1;
+    }
+    const bool swap = (fh.magic == PCAP_MAGIC_US_SWAP || fh.magic == PCAP_MAGIC_NS_SWAP);
+    const bool nano = (fh.magic == PCAP_MAGIC_NS || fh.magic == PCAP_MAGIC_NS_SWAP);
+    if (!swap && fh.magic != PCAP_MAGIC_US && fh.magic != PCAP_MAGIC_NS) {
+        std::fprintf(stderr, "Not a pcap file: %s\n", cfg.filename.c_str());
+        ::munmap(map, file_size);
+        return 1;
+    }
+    const uint32_t linktype  = maybe_swap32(fh.linktype, swap);
+    const double frac_scale  = nano ? 1e-9 : 1e-6;
+
+    analyzer an(cfg);
+    size_t offset      = sizeof(pcap_file_header_t);
+    uint64_t truncated = 0;
+    while (offset + sizeof(pcap_rec_header_t) <= file_size) {
+        pcap_rec_header_t rh;
+        std::memcpy(&rh, base + offset, sizeof(rh));
+        offset += sizeof(rh);
+        const size_t incl_len = maybe_swap32(rh.incl_len, swap);
+        const size_t orig_len = maybe_swap32(rh.orig_len, swap);
+        if (offset + incl_len > file_size) {
+            break; // truncated capture tail
+        }
+        if (incl_len == orig_len) {
+            const double time = maybe_swap32(rh.ts_sec, swap)
+                                + maybe_swap32(rh.ts_frac, swap) * frac_scale;
+            process_frame(an, base + offset, incl_len, linktype, time);
+        } else {
+            truncated++; // snaplen cut the frame short, can't parse it
+        }
+        offset += incl_len;
+    }
+    ::munmap(map, file_size);
+
+    if (truncated) {
+        std::printf("Skipped %llu frames truncated by snaplen (capture with "
+                    "'tcpdump -s 0' for full analysis)\n",
+            (unsigned long long)truncated);
+    }
+    an.print_report();
+    return 0;
+}